@@ -0,0 +1,154 @@
+#include "benchmark_utils.h"
+
+#include <benchmark/benchmark.h>
+#include <quiver/c/attribute_handle.h>
+#include <quiver/c/database.h>
+#include <quiver/c/element.h>
+#include <quiver/database.h>
+#include <string>
+
+namespace {
+
+// Same files as the C++ benchmarks, opened through the C API
+quiver_database_t* open_collections_c(int64_t size) {
+    const auto path = quiver::bench::open_collections(size).path();
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    options.file_level = QUIVER_LOG_OFF;
+    return quiver_database_open(path.c_str(), &options);
+}
+
+void BM_CApiReadScalarIntegers(benchmark::State& state) {
+    auto* db = open_collections_c(state.range(0));
+    for (auto _ : state) {
+        int64_t* values = nullptr;
+        size_t count = 0;
+        quiver_database_read_scalar_integers(db, "Collection", "some_integer", &values, &count);
+        quiver_free_integer_array(values);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    quiver_database_close(db);
+}
+BENCHMARK(BM_CApiReadScalarIntegers)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+void BM_CApiReadScalarIntegersById(benchmark::State& state) {
+    auto* db = open_collections_c(state.range(0));
+    quiver::bench::RandomIds ids(state.range(0));
+    for (auto _ : state) {
+        int64_t value = 0;
+        int has_value = 0;
+        quiver_database_read_scalar_integers_by_id(db, "Collection", "some_integer", ids.next(), &value, &has_value);
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+    quiver_database_close(db);
+}
+BENCHMARK(BM_CApiReadScalarIntegersById)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMicrosecond);
+
+// 1k Collection elements created through the C API; from_schema loads the schema, which handles need
+quiver_database_t* small_collections_c() {
+    const auto schema = quiver::bench::schema_path("collections.sql");
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    options.file_level = QUIVER_LOG_OFF;
+    auto* db = quiver_database_from_schema(":memory:", schema.c_str(), &options);
+    quiver_database_begin_transaction(db);
+    for (int64_t i = 1; i <= 1'000; ++i) {
+        const auto label = "Item " + std::to_string(i);
+        auto* element = quiver_element_create();
+        quiver_element_set_string(element, "label", label.c_str());
+        quiver_element_set_integer(element, "some_integer", i);
+        quiver_database_create_element(db, "Collection", element);
+        quiver_element_destroy(element);
+    }
+    quiver_database_commit(db);
+    return db;
+}
+
+// Per-call overhead of one by-id read: names converted and looked up on every call, against a handle resolved once.
+// A small in-memory database keeps the SQLite work identical and minimal.
+void BM_CApiCallOverheadByName(benchmark::State& state) {
+    auto* db = small_collections_c();
+    quiver::bench::RandomIds ids(1'000);
+    for (auto _ : state) {
+        int64_t value = 0;
+        int has_value = 0;
+        quiver_database_read_scalar_integers_by_id(db, "Collection", "some_integer", ids.next(), &value, &has_value);
+        benchmark::DoNotOptimize(value);
+    }
+    quiver_database_close(db);
+}
+BENCHMARK(BM_CApiCallOverheadByName)->Unit(benchmark::kMicrosecond);
+
+void BM_CApiCallOverheadByHandle(benchmark::State& state) {
+    auto* db = small_collections_c();
+    quiver_attribute_handle_t* handle = nullptr;
+    quiver_database_attribute_handle(db, "Collection", "some_integer", &handle);
+    quiver::bench::RandomIds ids(1'000);
+    for (auto _ : state) {
+        int64_t value = 0;
+        int has_value = 0;
+        quiver_database_read_scalar_integer_by_handle(db, handle, ids.next(), &value, &has_value);
+        benchmark::DoNotOptimize(value);
+    }
+    quiver_attribute_handle_free(handle);
+    quiver_database_close(db);
+}
+BENCHMARK(BM_CApiCallOverheadByHandle)->Unit(benchmark::kMicrosecond);
+
+void BM_CApiUpdateByName(benchmark::State& state) {
+    auto* db = small_collections_c();
+    quiver::bench::RandomIds ids(1'000);
+    int64_t value = 0;
+    for (auto _ : state) {
+        quiver_database_update_scalar_integer(db, "Collection", "some_integer", ids.next(), ++value);
+    }
+    quiver_database_close(db);
+}
+BENCHMARK(BM_CApiUpdateByName)->Unit(benchmark::kMicrosecond);
+
+void BM_CApiUpdateByHandle(benchmark::State& state) {
+    auto* db = small_collections_c();
+    quiver_attribute_handle_t* handle = nullptr;
+    quiver_database_attribute_handle(db, "Collection", "some_integer", &handle);
+    quiver::bench::RandomIds ids(1'000);
+    int64_t value = 0;
+    for (auto _ : state) {
+        quiver_database_update_scalar_integer_by_handle(db, handle, ids.next(), ++value);
+    }
+    quiver_attribute_handle_free(handle);
+    quiver_database_close(db);
+}
+BENCHMARK(BM_CApiUpdateByHandle)->Unit(benchmark::kMicrosecond);
+
+// Element construction through the C API included, as a binding would do it
+void BM_CApiCreateElement(benchmark::State& state) {
+    const auto count = state.range(0);
+    const auto schema = quiver::bench::schema_path("collections.sql");
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    options.file_level = QUIVER_LOG_OFF;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto* db = quiver_database_from_schema(":memory:", schema.c_str(), &options);
+        state.ResumeTiming();
+        quiver_database_begin_transaction(db);
+        for (int64_t i = 1; i <= count; ++i) {
+            const auto label = "Item " + std::to_string(i);
+            auto* element = quiver_element_create();
+            quiver_element_set_string(element, "label", label.c_str());
+            quiver_element_set_integer(element, "some_integer", i);
+            quiver_element_set_float(element, "some_float", i * 0.5);
+            quiver_database_create_element(db, "Collection", element);
+            quiver_element_destroy(element);
+        }
+        quiver_database_commit(db);
+        state.PauseTiming();
+        quiver_database_close(db);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_CApiCreateElement)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+}  // namespace
@@ -0,0 +1,93 @@
+#include "benchmark_utils.h"
+
+#include <benchmark/benchmark.h>
+#include <optional>
+#include <quiver/database.h>
+#include <quiver/element.h>
+#include <quiver/study_generator.h>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Each iteration creates state.range(0) elements in one transaction on a fresh in-memory database
+template <typename Create>
+void run_create(benchmark::State& state, const std::string& schema, Create create) {
+    const auto count = state.range(0);
+    std::optional<quiver::Database> db;
+    for (auto _ : state) {
+        state.PauseTiming();
+        db.reset();
+        db.emplace(quiver::Database::from_schema(":memory:", quiver::bench::schema_path(schema),
+                                                 quiver::bench::quiet_options()));
+        state.ResumeTiming();
+        create(*db, count);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+void BM_CreateElementScalars(benchmark::State& state) {
+    run_create(state, "collections.sql", [](quiver::Database& db, int64_t count) {
+        db.begin_transaction();
+        for (int64_t i = 1; i <= count; ++i) {
+            db.create_element("Collection", quiver::bench::collection_element(i, false));
+        }
+        db.commit();
+    });
+}
+BENCHMARK(BM_CreateElementScalars)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+void BM_CreateElementVectors(benchmark::State& state) {
+    run_create(state, "collections.sql", [](quiver::Database& db, int64_t count) {
+        db.begin_transaction();
+        for (int64_t i = 1; i <= count; ++i) {
+            db.create_element("Collection", quiver::bench::collection_element(i, true));
+        }
+        db.commit();
+    });
+}
+BENCHMARK(BM_CreateElementVectors)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+// Array values given as labels of the referenced Parent elements, resolved through the label cache
+void BM_CreateElementFkLabels(benchmark::State& state) {
+    run_create(state, "relations.sql", [](quiver::Database& db, int64_t count) {
+        constexpr int64_t kParents = 100;
+        db.begin_transaction();
+        for (int64_t i = 1; i <= kParents; ++i) {
+            db.create_element("Parent", quiver::Element().set("label", "Parent " + std::to_string(i)));
+        }
+        for (int64_t i = 1; i <= count; ++i) {
+            auto child = quiver::Element().set("label", "Child " + std::to_string(i));
+            child.set("parent_ref",
+                      std::vector<std::string>{"Parent " + std::to_string(1 + i % kParents),
+                                               "Parent " + std::to_string(1 + (i + 1) % kParents)});
+            db.create_element("Child", child);
+        }
+        db.commit();
+    });
+}
+BENCHMARK(BM_CreateElementFkLabels)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+void BM_CreateElementsBatch(benchmark::State& state) {
+    run_create(state, "collections.sql", [](quiver::Database& db, int64_t count) {
+        std::vector<quiver::Element> elements;
+        elements.reserve(static_cast<size_t>(count));
+        for (int64_t i = 1; i <= count; ++i) {
+            elements.push_back(quiver::bench::collection_element(i, true));
+        }
+        db.create_elements("Collection", elements);
+    });
+}
+BENCHMARK(BM_CreateElementsBatch)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+// Whole-study load: state.range(0) Collection elements with vectors, sets and 24 time series samples each
+void BM_GenerateStudy(benchmark::State& state) {
+    quiver::StudyGeneratorOptions options;
+    options.elements = state.range(0);
+    run_create(state, "collections.sql", [&](quiver::Database& db, int64_t) {
+        benchmark::DoNotOptimize(quiver::StudyGenerator(options).generate(db));
+    });
+}
+BENCHMARK(BM_GenerateStudy)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+}  // namespace
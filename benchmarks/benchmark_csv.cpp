@@ -0,0 +1,45 @@
+#include "benchmark_utils.h"
+
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <quiver/database.h>
+#include <string>
+
+namespace {
+
+// CSV round trips of the Collection table, one row per element; bytes processed is the size of the exported file
+
+std::string csv_path(int64_t size) {
+    return (std::filesystem::temp_directory_path() / ("quiver_benchmark_" + std::to_string(size) + ".csv")).string();
+}
+
+void BM_ExportCsv(benchmark::State& state) {
+    auto& db = quiver::bench::open_collections(state.range(0));
+    const auto path = csv_path(state.range(0));
+    for (auto _ : state) {
+        db.export_to_csv("Collection", path);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(path)));
+    std::filesystem::remove(path);
+}
+BENCHMARK(BM_ExportCsv)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+void BM_ImportCsv(benchmark::State& state) {
+    auto& source = quiver::bench::open_collections(state.range(0));
+    const auto path = csv_path(state.range(0));
+    source.export_to_csv("Collection", path);
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto db = quiver::Database::from_schema(
+            ":memory:", quiver::bench::schema_path("collections.sql"), quiver::bench::quiet_options());
+        state.ResumeTiming();
+        db.import_from_csv("Collection", path);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(path)));
+    std::filesystem::remove(path);
+}
+BENCHMARK(BM_ImportCsv)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+}  // namespace
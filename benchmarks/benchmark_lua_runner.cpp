@@ -0,0 +1,55 @@
+#include "benchmark_utils.h"
+
+#include <benchmark/benchmark.h>
+#include <optional>
+#include <quiver/database.h>
+#include <quiver/lua_runner.h>
+#include <string>
+
+namespace {
+
+void BM_LuaReadScalarIntegers(benchmark::State& state) {
+    auto& db = quiver::bench::open_collections(state.range(0));
+    quiver::LuaRunner lua(db);
+    for (auto _ : state) {
+        lua.run(R"(local values = db:read_scalar_integers("Collection", "some_integer"))");
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LuaReadScalarIntegers)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+// One script creating state.range(0) elements, so the per-call cost of the Lua bridge shows up against
+// BM_CreateElementScalars
+void BM_LuaCreateElement(benchmark::State& state) {
+    const auto script = "for i = 1, " + std::to_string(state.range(0)) +
+                        " do db:create_element(\"Collection\", { label = \"Item \" .. i, some_integer = i }) end";
+    std::optional<quiver::Database> db;
+    std::optional<quiver::LuaRunner> lua;
+    for (auto _ : state) {
+        state.PauseTiming();
+        lua.reset();
+        db.reset();
+        db.emplace(quiver::Database::from_schema(
+            ":memory:", quiver::bench::schema_path("collections.sql"), quiver::bench::quiet_options()));
+        lua.emplace(*db);
+        state.ResumeTiming();
+        db->begin_transaction();
+        lua->run(script);
+        db->commit();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LuaCreateElement)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+// Fixed cost of entering the interpreter for a trivial script
+void BM_LuaRunEmpty(benchmark::State& state) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", quiver::bench::schema_path("collections.sql"), quiver::bench::quiet_options());
+    quiver::LuaRunner lua(db);
+    for (auto _ : state) {
+        lua.run("local x = 1");
+    }
+}
+BENCHMARK(BM_LuaRunEmpty)->Unit(benchmark::kMicrosecond);
+
+}  // namespace
@@ -0,0 +1,126 @@
+#include "benchmark_utils.h"
+
+#include <benchmark/benchmark.h>
+#include <quiver/database.h>
+
+namespace {
+
+// Bulk reads return one value (or one vector/set) per element of the collection
+
+void BM_ReadScalarIntegers(benchmark::State& state) {
+    auto& db = quiver::bench::open_collections(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(db.read_scalar_integers("Collection", "some_integer"));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadScalarIntegers)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+void BM_ReadScalarStrings(benchmark::State& state) {
+    auto& db = quiver::bench::open_collections(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(db.read_scalar_strings("Collection", "label"));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadScalarStrings)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+void BM_ReadScalarStringsArena(benchmark::State& state) {
+    auto& db = quiver::bench::open_collections(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(db.read_scalar_strings_arena("Collection", "label"));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadScalarStringsArena)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+void BM_ReadVectorIntegers(benchmark::State& state) {
+    auto& db = quiver::bench::open_collections(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(db.read_vector_integers("Collection", "value_int"));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadVectorIntegers)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+void BM_ReadVectorIntegersFlat(benchmark::State& state) {
+    auto& db = quiver::bench::open_collections(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(db.read_vector_integers_flat("Collection", "value_int"));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadVectorIntegersFlat)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+void BM_ReadSetStrings(benchmark::State& state) {
+    auto& db = quiver::bench::open_collections(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(db.read_set_strings("Collection", "tag"));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadSetStrings)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+void BM_ReadSetStringsArenaInterned(benchmark::State& state) {
+    auto& db = quiver::bench::open_collections(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(db.read_set_strings_arena("Collection", "tag", true));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadSetStringsArenaInterned)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+void BM_ReadScalarRelation(benchmark::State& state) {
+    auto& db = quiver::bench::open_relations(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(db.read_scalar_relation("Child", "parent_id"));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadScalarRelation)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMillisecond);
+
+// By-id reads look up one random element per iteration; the size shows how the cost grows with the table
+
+void BM_ReadScalarIntegersById(benchmark::State& state) {
+    auto& db = quiver::bench::open_collections(state.range(0));
+    quiver::bench::RandomIds ids(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(db.read_scalar_integers_by_id("Collection", "some_integer", ids.next()));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ReadScalarIntegersById)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMicrosecond);
+
+// Same read through a handle resolved before the loop
+void BM_ReadScalarIntegersByIdHandle(benchmark::State& state) {
+    auto& db = quiver::bench::open_collections(state.range(0));
+    const auto handle = db.attribute_handle("Collection", "some_integer");
+    quiver::bench::RandomIds ids(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(db.read_scalar_integers_by_id(handle, ids.next()));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ReadScalarIntegersByIdHandle)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMicrosecond);
+
+void BM_ReadVectorIntegersById(benchmark::State& state) {
+    auto& db = quiver::bench::open_collections(state.range(0));
+    quiver::bench::RandomIds ids(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(db.read_vector_integers_by_id("Collection", "value_int", ids.next()));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ReadVectorIntegersById)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMicrosecond);
+
+void BM_ReadSetStringsById(benchmark::State& state) {
+    auto& db = quiver::bench::open_collections(state.range(0));
+    quiver::bench::RandomIds ids(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(db.read_set_strings_by_id("Collection", "tag", ids.next()));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ReadSetStringsById)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMicrosecond);
+
+}  // namespace
@@ -0,0 +1,47 @@
+#include "benchmark_utils.h"
+
+#include <benchmark/benchmark.h>
+#include <quiver/database.h>
+#include <quiver/element.h>
+#include <vector>
+
+namespace {
+
+// Each iteration updates one random element; the data-size files are shared, but updates keep their size
+
+void BM_UpdateElementScalars(benchmark::State& state) {
+    auto& db = quiver::bench::open_collections(state.range(0));
+    quiver::bench::RandomIds ids(state.range(0));
+    int64_t value = 0;
+    for (auto _ : state) {
+        db.update_element("Collection", ids.next(), quiver::Element().set("some_integer", ++value));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_UpdateElementScalars)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMicrosecond);
+
+void BM_UpdateElementVectors(benchmark::State& state) {
+    auto& db = quiver::bench::open_collections(state.range(0));
+    quiver::bench::RandomIds ids(state.range(0));
+    int64_t value = 0;
+    for (auto _ : state) {
+        ++value;
+        auto element = quiver::Element().set("value_int", std::vector<int64_t>{value, value, value, value, value});
+        db.update_element("Collection", ids.next(), element);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_UpdateElementVectors)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMicrosecond);
+
+void BM_UpdateScalarInteger(benchmark::State& state) {
+    auto& db = quiver::bench::open_collections(state.range(0));
+    quiver::bench::RandomIds ids(state.range(0));
+    int64_t value = 0;
+    for (auto _ : state) {
+        db.update_scalar_integer("Collection", "some_integer", ids.next(), ++value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_UpdateScalarInteger)->Apply(quiver::bench::data_sizes)->Unit(benchmark::kMicrosecond);
+
+}  // namespace
@@ -0,0 +1,109 @@
+#ifndef QUIVER_BENCHMARK_UTILS_H
+#define QUIVER_BENCHMARK_UTILS_H
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <quiver/database.h>
+#include <quiver/element.h>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace quiver::bench {
+
+// Schema from tests/schemas/valid
+inline std::string schema_path(const std::string& name) {
+    return std::string(QUIVER_BENCHMARK_SCHEMAS_DIR) + "/" + name;
+}
+
+// No console or file logging, so log formatting stays out of the measurements
+inline DatabaseOptions quiet_options() {
+    DatabaseOptions options;
+    options.console_level = LogLevel::off;
+    options.file_level = LogLevel::off;
+    return options;
+}
+
+// Element counts every data-size benchmark runs at
+inline void data_sizes(::benchmark::internal::Benchmark* benchmark) {
+    benchmark->Arg(1'000)->Arg(100'000)->Arg(1'000'000);
+}
+
+// Collection element from collections.sql; with_arrays adds a 5-entry vector group and a 2-entry set
+inline Element collection_element(int64_t i, bool with_arrays) {
+    Element element;
+    element.set("label", "Item " + std::to_string(i)).set("some_integer", i).set("some_float", i * 0.5);
+    if (with_arrays) {
+        element.set("value_int", std::vector<int64_t>{i, i + 1, i + 2, i + 3, i + 4})
+            .set("value_float", std::vector<double>{0.1, 0.2, 0.3, 0.4, 0.5})
+            .set("tag", std::vector<std::string>{"week " + std::to_string(i % 7), "group " + std::to_string(i % 11)});
+    }
+    return element;
+}
+
+// Builds the database once per process and size and keeps it open; building 1M elements takes a while, so every
+// benchmark at that size shares one connection. The file stays behind for C API benchmarks that open it again.
+template <typename Populate>
+Database& open_populated(const std::string& name, const std::string& schema, int64_t size, Populate populate) {
+    static std::map<std::string, Database> built;
+    const auto key = name + "_" + std::to_string(size);
+    auto it = built.find(key);
+    if (it == built.end()) {
+        const auto path = (std::filesystem::temp_directory_path() / ("quiver_benchmark_" + key + ".db")).string();
+        std::filesystem::remove(path);
+        auto db = Database::from_schema(path, schema_path(schema), quiet_options());
+        populate(db, size);
+        it = built.emplace(key, std::move(db)).first;
+    }
+    return it->second;
+}
+
+// collections.sql with size Collection elements, each with vectors and a set
+inline Database& open_collections(int64_t size) {
+    return open_populated("collections", "collections.sql", size, [](Database& db, int64_t count) {
+        constexpr int64_t kBatch = 10'000;
+        std::vector<Element> batch;
+        for (int64_t i = 1; i <= count; i += kBatch) {
+            batch.clear();
+            for (int64_t j = i; j < i + kBatch && j <= count; ++j) {
+                batch.push_back(collection_element(j, true));
+            }
+            db.create_elements("Collection", batch);
+        }
+    });
+}
+
+// relations.sql with size Child elements, each pointing at one of size / 10 Parent elements
+inline Database& open_relations(int64_t size) {
+    return open_populated("relations", "relations.sql", size, [](Database& db, int64_t count) {
+        const auto parents = std::max<int64_t>(count / 10, 1);
+        db.begin_transaction();
+        for (int64_t i = 1; i <= parents; ++i) {
+            db.create_element("Parent", Element().set("label", "Parent " + std::to_string(i)));
+        }
+        for (int64_t i = 1; i <= count; ++i) {
+            db.create_element("Child",
+                              Element().set("label", "Child " + std::to_string(i)).set("parent_id", 1 + i % parents));
+        }
+        db.commit();
+    });
+}
+
+// Ids in [1, size] in a fixed pseudo-random order, so by-id benchmarks do not just walk the B-tree in order
+class RandomIds {
+public:
+    explicit RandomIds(int64_t size) : distribution_(1, size) {}
+    int64_t next() { return distribution_(engine_); }
+
+private:
+    std::mt19937_64 engine_{42};
+    std::uniform_int_distribution<int64_t> distribution_;
+};
+
+}  // namespace quiver::bench
+
+#endif  // QUIVER_BENCHMARK_UTILS_H
@@ -3,13 +3,16 @@ library quiver;
 export 'src/database.dart'
     show
         Database,
+        DatabaseAsync,
         DatabaseCreate,
         DatabaseCSV,
         DatabaseDelete,
+        DatabaseFuture,
         DatabaseMetadata,
         DatabaseQuery,
         DatabaseRead,
         DatabaseRelations,
+        DatabaseTransaction,
         DatabaseUpdate;
 export 'src/date_time.dart' show dateTimeToString, stringToDateTime;
 export 'src/element.dart' show Element;
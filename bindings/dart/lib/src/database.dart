@@ -1,4 +1,5 @@
 import 'dart:ffi';
+import 'dart:typed_data';
 
 import 'package:ffi/ffi.dart';
 
@@ -8,6 +9,7 @@ import 'date_time.dart';
 import 'element.dart';
 import 'exceptions.dart';
 
+part 'database_async.dart';
 part 'database_create.dart';
 part 'database_csv.dart';
 part 'database_delete.dart';
@@ -15,6 +17,7 @@ part 'database_metadata.dart';
 part 'database_query.dart';
 part 'database_read.dart';
 part 'database_relations.dart';
+part 'database_transaction.dart';
 part 'database_update.dart';
 
 /// A wrapper for the Quiver database.
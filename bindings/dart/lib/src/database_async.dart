@@ -0,0 +1,284 @@
+part of 'database.dart';
+
+/// An operation queued on the database's worker thread.
+///
+/// Await [value] for its outcome or call [cancel] to skip (or interrupt) it. The native handle is released once
+/// [value] completes; call [dispose] to drop an operation whose value is never awaited.
+/// While operations are pending, call nothing else on their database but further async operations.
+class DatabaseFuture<T> {
+  Pointer<quiver_future_t> _ptr;
+  final T Function(Pointer<quiver_result_t> result) _decode;
+  final String _context;
+  Future<T>? _value;
+
+  /// How long [value] sleeps between checks of the worker thread.
+  static Duration pollInterval = const Duration(milliseconds: 1);
+
+  DatabaseFuture._(this._ptr, this._decode, this._context);
+
+  void _ensureNotDisposed() {
+    if (_ptr == nullptr) {
+      throw const DatabaseOperationException('DatabaseFuture has been disposed');
+    }
+  }
+
+  /// Whether the operation has finished, successfully, with an error or cancelled.
+  bool get isDone {
+    _ensureNotDisposed();
+    final outDone = calloc<Int>();
+    try {
+      final err = bindings.quiver_future_wait(_ptr, 0, outDone);
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, 'Failed to poll async operation');
+      }
+      return outDone.value != 0;
+    } finally {
+      calloc.free(outDone);
+    }
+  }
+
+  /// Completes with the operation's value once the worker thread is done with it.
+  ///
+  /// Throws [CancelledException] if the operation was cancelled before it finished.
+  Future<T> get value => _value ??= _complete();
+
+  /// Requests cancellation: a queued operation never runs and a running one is interrupted.
+  void cancel() {
+    _ensureNotDisposed();
+    final err = bindings.quiver_future_cancel(_ptr);
+    if (err != quiver_error_t.QUIVER_OK) {
+      throw DatabaseException.fromError(err, 'Failed to cancel async operation');
+    }
+  }
+
+  /// Frees the native handle. A pending operation still runs (unless cancelled) and its result is discarded.
+  void dispose() {
+    if (_ptr == nullptr) return;
+    bindings.quiver_future_free(_ptr);
+    _ptr = nullptr;
+  }
+
+  Future<T> _complete() async {
+    _ensureNotDisposed();
+    while (!isDone) {
+      await Future<void>.delayed(pollInterval);
+    }
+
+    final outResult = calloc<Pointer<quiver_result_t>>();
+    try {
+      final err = bindings.quiver_future_result(_ptr, outResult);
+      if (err != quiver_error_t.QUIVER_OK) {
+        final errorMsg = bindings.quiver_get_last_error().cast<Utf8>().toDartString();
+        throw DatabaseException.fromError(err, errorMsg.isNotEmpty ? '$_context: $errorMsg' : _context);
+      }
+      final result = outResult.value;
+      try {
+        return _decode(result);
+      } finally {
+        if (result != nullptr) {
+          bindings.quiver_result_free(result);
+        }
+      }
+    } finally {
+      calloc.free(outResult);
+      dispose();
+    }
+  }
+}
+
+/// Async operations for Database, run one at a time on a worker thread owned by the database.
+extension DatabaseAsync on Database {
+  /// Reads all integer values for a scalar attribute from a collection on the worker thread.
+  DatabaseFuture<List<int>> readScalarIntegersAsync(String collection, String attribute) {
+    return _submit(
+      bindings.quiver_database_read_scalar_integers_async,
+      collection,
+      attribute,
+      _decodeIntegers,
+      "Failed to read scalar integers from '$collection.$attribute'",
+    );
+  }
+
+  /// Reads all float values for a scalar attribute from a collection on the worker thread.
+  DatabaseFuture<List<double>> readScalarFloatsAsync(String collection, String attribute) {
+    return _submit(
+      bindings.quiver_database_read_scalar_floats_async,
+      collection,
+      attribute,
+      _decodeFloats,
+      "Failed to read scalar floats from '$collection.$attribute'",
+    );
+  }
+
+  /// Reads all string values for a scalar attribute from a collection on the worker thread.
+  DatabaseFuture<List<String>> readScalarStringsAsync(String collection, String attribute) {
+    return _submit(
+      bindings.quiver_database_read_scalar_strings_async,
+      collection,
+      attribute,
+      _decodeStrings,
+      "Failed to read scalar strings from '$collection.$attribute'",
+    );
+  }
+
+  /// Reads the integer vectors of every element of a collection on the worker thread.
+  DatabaseFuture<List<List<int>>> readVectorIntegersAsync(String collection, String attribute) {
+    return _submit(
+      bindings.quiver_database_read_vector_integers_async,
+      collection,
+      attribute,
+      (result) => _group(result, _decodeIntegers(result)),
+      "Failed to read vector integers from '$collection.$attribute'",
+    );
+  }
+
+  /// Reads the float vectors of every element of a collection on the worker thread.
+  DatabaseFuture<List<List<double>>> readVectorFloatsAsync(String collection, String attribute) {
+    return _submit(
+      bindings.quiver_database_read_vector_floats_async,
+      collection,
+      attribute,
+      (result) => _group(result, _decodeFloats(result)),
+      "Failed to read vector floats from '$collection.$attribute'",
+    );
+  }
+
+  /// Reads the string vectors of every element of a collection on the worker thread.
+  DatabaseFuture<List<List<String>>> readVectorStringsAsync(String collection, String attribute) {
+    return _submit(
+      bindings.quiver_database_read_vector_strings_async,
+      collection,
+      attribute,
+      (result) => _group(result, _decodeStrings(result)),
+      "Failed to read vector strings from '$collection.$attribute'",
+    );
+  }
+
+  /// Exports a table to a CSV file on the worker thread.
+  DatabaseFuture<void> exportToCSVAsync(String table, String path) {
+    return _submit(
+      bindings.quiver_database_export_to_csv_async,
+      table,
+      path,
+      (_) {},
+      "Failed to export table '$table' to '$path'",
+    );
+  }
+
+  /// Imports a CSV file into a table on the worker thread.
+  DatabaseFuture<void> importFromCSVAsync(String table, String path) {
+    return _submit(
+      bindings.quiver_database_import_from_csv_async,
+      table,
+      path,
+      (_) {},
+      "Failed to import CSV from '$path' into table '$table'",
+    );
+  }
+
+  /// Exports a collection to Arrow IPC files in [directory] on the worker thread.
+  DatabaseFuture<void> exportCollectionAsync(String collection, String directory) {
+    return _submit(
+      bindings.quiver_database_export_collection_async,
+      collection,
+      directory,
+      (_) {},
+      "Failed to export collection '$collection' to '$directory'",
+    );
+  }
+
+  /// Imports a collection written by [DatabaseCSV.exportCollection] from [directory] on the worker thread.
+  DatabaseFuture<void> importCollectionAsync(String collection, String directory) {
+    return _submit(
+      bindings.quiver_database_import_collection_async,
+      collection,
+      directory,
+      (_) {},
+      "Failed to import collection '$collection' from '$directory'",
+    );
+  }
+
+  DatabaseFuture<T> _submit<T>(
+    int Function(Pointer<quiver_database_t>, Pointer<Char>, Pointer<Char>, Pointer<Pointer<quiver_future_t>>) submit,
+    String first,
+    String second,
+    T Function(Pointer<quiver_result_t> result) decode,
+    String context,
+  ) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final outFuture = arena<Pointer<quiver_future_t>>();
+      final err = submit(
+        _ptr,
+        first.toNativeUtf8(allocator: arena).cast(),
+        second.toNativeUtf8(allocator: arena).cast(),
+        outFuture,
+      );
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, context);
+      }
+      return DatabaseFuture._(outFuture.value, decode, context);
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  static int _resultCount(Pointer<quiver_result_t> result) {
+    final outCount = calloc<Size>();
+    try {
+      bindings.quiver_result_count(result, outCount);
+      return outCount.value;
+    } finally {
+      calloc.free(outCount);
+    }
+  }
+
+  static List<int> _decodeIntegers(Pointer<quiver_result_t> result) {
+    final count = _resultCount(result);
+    final outValues = calloc<Pointer<Int64>>();
+    try {
+      bindings.quiver_result_integers(result, outValues);
+      return count == 0 ? [] : List<int>.of(outValues.value.asTypedList(count));
+    } finally {
+      calloc.free(outValues);
+    }
+  }
+
+  static List<double> _decodeFloats(Pointer<quiver_result_t> result) {
+    final count = _resultCount(result);
+    final outValues = calloc<Pointer<Double>>();
+    try {
+      bindings.quiver_result_floats(result, outValues);
+      return count == 0 ? [] : List<double>.of(outValues.value.asTypedList(count));
+    } finally {
+      calloc.free(outValues);
+    }
+  }
+
+  static List<String> _decodeStrings(Pointer<quiver_result_t> result) {
+    final count = _resultCount(result);
+    final outValues = calloc<Pointer<Pointer<Char>>>();
+    try {
+      bindings.quiver_result_strings(result, outValues);
+      return List<String>.generate(count, (i) => outValues.value[i].cast<Utf8>().toDartString());
+    } finally {
+      calloc.free(outValues);
+    }
+  }
+
+  // Splits the flat values of a vector read into one list per element
+  static List<List<T>> _group<T>(Pointer<quiver_result_t> result, List<T> values) {
+    final outOffsets = calloc<Pointer<Size>>();
+    final outGroupCount = calloc<Size>();
+    try {
+      bindings.quiver_result_offsets(result, outOffsets, outGroupCount);
+      final offsets = outOffsets.value;
+      return List<List<T>>.generate(outGroupCount.value, (i) => values.sublist(offsets[i], offsets[i + 1]));
+    } finally {
+      calloc.free(outOffsets);
+      calloc.free(outGroupCount);
+    }
+  }
+}
@@ -38,4 +38,129 @@ extension DatabaseCreate on Database {
       arena.releaseAll();
     }
   }
+
+  /// Creates multiple elements in the specified collection in a single transaction.
+  /// Returns the new element IDs in input order.
+  List<int> createElements(String collection, List<Map<String, Object?>> values) {
+    _ensureNotClosed();
+
+    final elements = <Element>[];
+    try {
+      for (final map in values) {
+        final element = Element();
+        elements.add(element);
+        for (final entry in map.entries) {
+          element.set(entry.key, entry.value);
+        }
+      }
+      return createElementsFromBuilders(collection, elements);
+    } finally {
+      for (final element in elements) {
+        element.dispose();
+      }
+    }
+  }
+
+  /// Creates multiple elements in the specified collection in a single transaction using Element builders.
+  /// Returns the new element IDs in input order.
+  List<int> createElementsFromBuilders(String collection, List<Element> elements) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final nativeElements = arena<Pointer<quiver_element_t>>(elements.length);
+      for (var i = 0; i < elements.length; i++) {
+        nativeElements[i] = elements[i].ptr.cast();
+      }
+      final outIds = arena<Int64>(elements.length);
+
+      final err = bindings.quiver_database_create_elements(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        nativeElements,
+        elements.length,
+        outIds,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to create elements in '$collection'");
+      }
+
+      return List<int>.generate(elements.length, (i) => outIds[i]);
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  /// Creates the element, or updates the one with the same label, in a single statement.
+  /// Returns its ID; groups it does not carry are left as stored.
+  int upsertElement(String collection, Map<String, Object?> values) {
+    _ensureNotClosed();
+
+    final element = Element();
+    final arena = Arena();
+    try {
+      for (final entry in values.entries) {
+        element.set(entry.key, entry.value);
+      }
+      final outId = arena<Int64>();
+      final err = bindings.quiver_database_upsert_element(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        element.ptr.cast(),
+        outId,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to upsert element in '$collection'");
+      }
+
+      return outId.value;
+    } finally {
+      arena.releaseAll();
+      element.dispose();
+    }
+  }
+
+  /// Upserts multiple elements by label in a single transaction.
+  /// Returns their IDs in input order.
+  List<int> upsertElements(String collection, List<Map<String, Object?>> values) {
+    _ensureNotClosed();
+
+    final elements = <Element>[];
+    final arena = Arena();
+    try {
+      for (final map in values) {
+        final element = Element();
+        elements.add(element);
+        for (final entry in map.entries) {
+          element.set(entry.key, entry.value);
+        }
+      }
+      final nativeElements = arena<Pointer<quiver_element_t>>(elements.length);
+      for (var i = 0; i < elements.length; i++) {
+        nativeElements[i] = elements[i].ptr.cast();
+      }
+      final outIds = arena<Int64>(elements.length);
+
+      final err = bindings.quiver_database_upsert_elements(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        nativeElements,
+        elements.length,
+        outIds,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to upsert elements in '$collection'");
+      }
+
+      return List<int>.generate(elements.length, (i) => outIds[i]);
+    } finally {
+      arena.releaseAll();
+      for (final element in elements) {
+        element.dispose();
+      }
+    }
+  }
 }
@@ -37,4 +37,40 @@ extension DatabaseCSV on Database {
       arena.releaseAll();
     }
   }
+
+  /// Exports a collection and its vector, set and time series tables to Arrow IPC files in [directory].
+  void exportCollection(String collection, String directory) {
+    _ensureNotClosed();
+    final arena = Arena();
+    try {
+      final err = bindings.quiver_database_export_collection(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        directory.toNativeUtf8(allocator: arena).cast(),
+      );
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to export collection '$collection' to '$directory'");
+      }
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  /// Imports a collection written by [exportCollection] from [directory].
+  void importCollection(String collection, String directory) {
+    _ensureNotClosed();
+    final arena = Arena();
+    try {
+      final err = bindings.quiver_database_import_collection(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        directory.toNativeUtf8(allocator: arena).cast(),
+      );
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to import collection '$collection' from '$directory'");
+      }
+    } finally {
+      arena.releaseAll();
+    }
+  }
 }
@@ -22,4 +22,29 @@ extension DatabaseDelete on Database {
       arena.releaseAll();
     }
   }
+
+  /// Deletes elements by ID in a single transaction, clearing their vector/set/time series rows first.
+  /// Unknown IDs are skipped; returns the number of elements deleted.
+  int deleteElementsByIds(String collection, List<int> ids) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final outDeleted = arena<Size>();
+      final err = bindings.quiver_database_delete_elements_by_ids(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        _nativeIds(arena, ids),
+        ids.length,
+        outDeleted,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to delete elements from '$collection'");
+      }
+      return outDeleted.value;
+    } finally {
+      arena.releaseAll();
+    }
+  }
 }
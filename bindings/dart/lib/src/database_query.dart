@@ -220,4 +220,90 @@ extension DatabaseQuery on Database {
     if (result == null) return null;
     return stringToDateTime(result);
   }
+
+  /// Streams the rows of a SQL query, calling [onRow] with the column values of each row.
+  /// Rows are stepped one at a time, so memory use does not grow with the result size.
+  /// Values are int, double, String, or null. Returns the number of rows visited.
+  int forEachRow(String sql, void Function(List<Object?> row) onRow, [List<Object?> params = const []]) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final nativeParams = _marshalParams(arena, params);
+      final outCursor = arena<Pointer<quiver_cursor_t>>();
+
+      final err = bindings.quiver_database_open_cursor(
+        _ptr,
+        sql.toNativeUtf8(allocator: arena).cast(),
+        nativeParams.types,
+        nativeParams.values,
+        params.length,
+        outCursor,
+      );
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, 'Failed to open cursor');
+      }
+
+      final cursor = outCursor.value;
+      try {
+        final outCount = arena<Size>();
+        bindings.quiver_cursor_column_count(cursor, outCount);
+        final columnCount = outCount.value;
+
+        final outHasRow = arena<Int>();
+        var count = 0;
+        while (true) {
+          final stepErr = bindings.quiver_cursor_next(cursor, outHasRow);
+          if (stepErr != quiver_error_t.QUIVER_OK) {
+            throw DatabaseException.fromError(stepErr, 'Failed to step cursor');
+          }
+          if (outHasRow.value == 0) break;
+          onRow([for (var i = 0; i < columnCount; i++) _cursorValue(arena, cursor, i)]);
+          count++;
+        }
+        return count;
+      } finally {
+        bindings.quiver_cursor_free(cursor);
+      }
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  Object? _cursorValue(Arena arena, Pointer<quiver_cursor_t> cursor, int column) {
+    final outType = arena<Int32>();
+    final outHasValue = arena<Int>();
+    final err = bindings.quiver_cursor_column_type(cursor, column, outType);
+    if (err != quiver_error_t.QUIVER_OK) {
+      throw DatabaseException.fromError(err, 'Failed to read cursor column type');
+    }
+
+    switch (outType.value) {
+      case quiver_data_type_t.QUIVER_DATA_TYPE_INTEGER:
+        final outValue = arena<Int64>();
+        bindings.quiver_cursor_get_integer(cursor, column, outValue, outHasValue);
+        return outValue.value;
+      case quiver_data_type_t.QUIVER_DATA_TYPE_FLOAT:
+        final outValue = arena<Double>();
+        bindings.quiver_cursor_get_float(cursor, column, outValue, outHasValue);
+        return outValue.value;
+      case quiver_data_type_t.QUIVER_DATA_TYPE_STRING:
+        final outValue = arena<Pointer<Char>>();
+        bindings.quiver_cursor_get_string(cursor, column, outValue, outHasValue);
+        final result = outValue.value.cast<Utf8>().toDartString();
+        bindings.quiver_string_free(outValue.value);
+        return result;
+      case quiver_data_type_t.QUIVER_DATA_TYPE_BLOB:
+        final outData = arena<Pointer<Uint8>>();
+        final outSize = arena<Size>();
+        bindings.quiver_cursor_get_blob(cursor, column, outData, outSize, outHasValue);
+        // An empty BLOB comes back as a null pointer
+        final result =
+            outSize.value == 0 ? Uint8List(0) : Uint8List.fromList(outData.value.asTypedList(outSize.value));
+        bindings.quiver_blob_free(outData.value);
+        return result;
+      default:
+        return null;
+    }
+  }
 }
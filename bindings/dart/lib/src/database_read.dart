@@ -7,15 +7,99 @@ extension DatabaseRead on Database {
   // ==========================================================================
 
   /// Reads all integer values for a scalar attribute from a collection.
+  /// Values are read straight into a natively allocated buffer that the returned list views.
   List<int> readScalarIntegers(String collection, String attribute) {
     _ensureNotClosed();
 
     final arena = Arena();
     try {
-      final outValues = arena<Pointer<Int64>>();
+      final nativeCollection = collection.toNativeUtf8(allocator: arena).cast<Char>();
+      final nativeAttribute = attribute.toNativeUtf8(allocator: arena).cast<Char>();
+      final outCount = arena<Size>();
+
+      var err = bindings.quiver_database_count_scalar_values(_ptr, nativeCollection, nativeAttribute, outCount);
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to read scalar integers from '$collection.$attribute'");
+      }
+
+      final capacity = outCount.value;
+      if (capacity == 0) {
+        return [];
+      }
+
+      final buffer = malloc<Int64>(capacity);
+      err = bindings.quiver_database_read_scalar_integers_into(
+        _ptr,
+        nativeCollection,
+        nativeAttribute,
+        buffer,
+        capacity,
+        outCount,
+      );
+      if (err != quiver_error_t.QUIVER_OK) {
+        malloc.free(buffer);
+        throw DatabaseException.fromError(err, "Failed to read scalar integers from '$collection.$attribute'");
+      }
+
+      final count = outCount.value < capacity ? outCount.value : capacity;
+      return buffer.asTypedList(count, finalizer: malloc.nativeFree);
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  /// Reads all float values for a scalar attribute from a collection.
+  /// Values are read straight into a natively allocated buffer that the returned list views.
+  List<double> readScalarFloats(String collection, String attribute) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final nativeCollection = collection.toNativeUtf8(allocator: arena).cast<Char>();
+      final nativeAttribute = attribute.toNativeUtf8(allocator: arena).cast<Char>();
+      final outCount = arena<Size>();
+
+      var err = bindings.quiver_database_count_scalar_values(_ptr, nativeCollection, nativeAttribute, outCount);
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to read scalar floats from '$collection.$attribute'");
+      }
+
+      final capacity = outCount.value;
+      if (capacity == 0) {
+        return [];
+      }
+
+      final buffer = malloc<Double>(capacity);
+      err = bindings.quiver_database_read_scalar_floats_into(
+        _ptr,
+        nativeCollection,
+        nativeAttribute,
+        buffer,
+        capacity,
+        outCount,
+      );
+      if (err != quiver_error_t.QUIVER_OK) {
+        malloc.free(buffer);
+        throw DatabaseException.fromError(err, "Failed to read scalar floats from '$collection.$attribute'");
+      }
+
+      final count = outCount.value < capacity ? outCount.value : capacity;
+      return buffer.asTypedList(count, finalizer: malloc.nativeFree);
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  /// Reads all string values for a scalar attribute from a collection.
+  List<String> readScalarStrings(String collection, String attribute) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final outValues = arena<Pointer<Pointer<Char>>>();
       final outCount = arena<Size>();
 
-      final err = bindings.quiver_database_read_scalar_integers(
+      final err = bindings.quiver_database_read_scalar_strings(
         _ptr,
         collection.toNativeUtf8(allocator: arena).cast(),
         attribute.toNativeUtf8(allocator: arena).cast(),
@@ -24,7 +108,7 @@ extension DatabaseRead on Database {
       );
 
       if (err != quiver_error_t.QUIVER_OK) {
-        throw DatabaseException.fromError(err, "Failed to read scalar integers from '$collection.$attribute'");
+        throw DatabaseException.fromError(err, "Failed to read scalar strings from '$collection.$attribute'");
       }
 
       final count = outCount.value;
@@ -32,82 +116,192 @@ extension DatabaseRead on Database {
         return [];
       }
 
-      final result = List<int>.generate(count, (i) => outValues.value[i]);
+      final result = List<String>.generate(count, (i) => outValues.value[i].cast<Utf8>().toDartString());
+      bindings.quiver_free_string_array(outValues.value, count);
+      return result;
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  /// Reads integer values for a scalar attribute, one per element in readElementIds order (null where unset).
+  List<int?> readScalarIntegersNullable(String collection, String attribute) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final outValues = arena<Pointer<Int64>>();
+      final outValidity = arena<Pointer<Uint8>>();
+      final outCount = arena<Size>();
+
+      final err = bindings.quiver_database_read_scalar_integers_nullable(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        outValues,
+        outValidity,
+        outCount,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to read nullable scalar integers from '$collection.$attribute'");
+      }
+
+      final count = outCount.value;
+      if (count == 0) {
+        return [];
+      }
+
+      final validity = outValidity.value;
+      final result = List<int?>.generate(
+        count,
+        (i) => (validity[i >> 3] >> (i & 7)) & 1 != 0 ? outValues.value[i] : null,
+      );
       bindings.quiver_free_integer_array(outValues.value);
+      bindings.quiver_free_validity_bitmap(validity);
       return result;
     } finally {
       arena.releaseAll();
     }
   }
 
-  /// Reads all float values for a scalar attribute from a collection.
-  List<double> readScalarFloats(String collection, String attribute) {
+  /// Reads float values for a scalar attribute, one per element in readElementIds order (null where unset).
+  List<double?> readScalarFloatsNullable(String collection, String attribute) {
     _ensureNotClosed();
 
     final arena = Arena();
     try {
       final outValues = arena<Pointer<Double>>();
+      final outValidity = arena<Pointer<Uint8>>();
       final outCount = arena<Size>();
 
-      final err = bindings.quiver_database_read_scalar_floats(
+      final err = bindings.quiver_database_read_scalar_floats_nullable(
         _ptr,
         collection.toNativeUtf8(allocator: arena).cast(),
         attribute.toNativeUtf8(allocator: arena).cast(),
         outValues,
+        outValidity,
         outCount,
       );
 
       if (err != quiver_error_t.QUIVER_OK) {
-        throw DatabaseException.fromError(err, "Failed to read scalar floats from '$collection.$attribute'");
+        throw DatabaseException.fromError(err, "Failed to read nullable scalar floats from '$collection.$attribute'");
       }
 
       final count = outCount.value;
-      if (count == 0 || outValues.value == nullptr) {
+      if (count == 0) {
         return [];
       }
 
-      final result = List<double>.generate(count, (i) => outValues.value[i]);
+      final validity = outValidity.value;
+      final result = List<double?>.generate(
+        count,
+        (i) => (validity[i >> 3] >> (i & 7)) & 1 != 0 ? outValues.value[i] : null,
+      );
       bindings.quiver_free_float_array(outValues.value);
+      bindings.quiver_free_validity_bitmap(validity);
       return result;
     } finally {
       arena.releaseAll();
     }
   }
 
-  /// Reads all string values for a scalar attribute from a collection.
-  List<String> readScalarStrings(String collection, String attribute) {
+  /// Reads string values for a scalar attribute, one per element in readElementIds order (null where unset).
+  List<String?> readScalarStringsNullable(String collection, String attribute) {
     _ensureNotClosed();
 
     final arena = Arena();
     try {
       final outValues = arena<Pointer<Pointer<Char>>>();
+      final outValidity = arena<Pointer<Uint8>>();
       final outCount = arena<Size>();
 
-      final err = bindings.quiver_database_read_scalar_strings(
+      final err = bindings.quiver_database_read_scalar_strings_nullable(
         _ptr,
         collection.toNativeUtf8(allocator: arena).cast(),
         attribute.toNativeUtf8(allocator: arena).cast(),
         outValues,
+        outValidity,
         outCount,
       );
 
       if (err != quiver_error_t.QUIVER_OK) {
-        throw DatabaseException.fromError(err, "Failed to read scalar strings from '$collection.$attribute'");
+        throw DatabaseException.fromError(err, "Failed to read nullable scalar strings from '$collection.$attribute'");
       }
 
       final count = outCount.value;
-      if (count == 0 || outValues.value == nullptr) {
+      if (count == 0) {
         return [];
       }
 
-      final result = List<String>.generate(count, (i) => outValues.value[i].cast<Utf8>().toDartString());
+      final validity = outValidity.value;
+      final result = List<String?>.generate(
+        count,
+        (i) => (validity[i >> 3] >> (i & 7)) & 1 != 0 ? outValues.value[i].cast<Utf8>().toDartString() : null,
+      );
       bindings.quiver_free_string_array(outValues.value, count);
+      bindings.quiver_free_validity_bitmap(validity);
       return result;
     } finally {
       arena.releaseAll();
     }
   }
 
+  /// Reads several scalar attributes in one pass.
+  /// columns[name][i] belongs to ids[i]; null where the element has no value.
+  ({List<int> ids, Map<String, List<Object?>> columns}) readScalars(String collection, List<String> attributes) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final nativeAttributes = arena<Pointer<Char>>(attributes.length);
+      for (var i = 0; i < attributes.length; i++) {
+        nativeAttributes[i] = attributes[i].toNativeUtf8(allocator: arena).cast();
+      }
+      final outIds = arena<Pointer<Int64>>();
+      final outColumns = arena<Pointer<quiver_scalar_column_t>>();
+      final outCount = arena<Size>();
+
+      final err = bindings.quiver_database_read_scalars(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        nativeAttributes,
+        attributes.length,
+        outIds,
+        outColumns,
+        outCount,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to read scalars from '$collection'");
+      }
+
+      final count = outCount.value;
+      final ids = List<int>.generate(count, (i) => outIds.value[i]);
+      final columns = <String, List<Object?>>{};
+      for (var c = 0; c < attributes.length; c++) {
+        final column = outColumns.value[c];
+        final name = column.name.cast<Utf8>().toDartString();
+        bool isNull(int i) => column.nulls[i] != 0;
+        switch (column.data_type) {
+          case quiver_data_type_t.QUIVER_DATA_TYPE_INTEGER:
+            columns[name] = List<int?>.generate(count, (i) => isNull(i) ? null : column.integers[i]);
+          case quiver_data_type_t.QUIVER_DATA_TYPE_FLOAT:
+            columns[name] = List<double?>.generate(count, (i) => isNull(i) ? null : column.floats[i]);
+          default:
+            columns[name] = List<String?>.generate(
+              count,
+              (i) => isNull(i) ? null : column.strings[i].cast<Utf8>().toDartString(),
+            );
+        }
+      }
+      bindings.quiver_free_scalar_columns(outIds.value, outColumns.value, attributes.length, count);
+      return (ids: ids, columns: columns);
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
   /// Reads all int vectors for a vector attribute from a collection.
   List<List<int>> readVectorIntegers(String collection, String attribute) {
     _ensureNotClosed();
@@ -372,6 +566,115 @@ extension DatabaseRead on Database {
     }
   }
 
+  // ==========================================================================
+  // Read all vector/set values in flat (CSR) layout
+  // ==========================================================================
+
+  /// Reads all integer values for a vector attribute with a single contiguous copy.
+  /// Each group is a view into one shared buffer.
+  List<Int64List> readVectorIntegersFlat(String collection, String attribute) =>
+      _readFlatIntegers(bindings.quiver_database_read_vector_integers_flat, collection, attribute, 'vector integers');
+
+  /// Reads all float values for a vector attribute with a single contiguous copy.
+  List<Float64List> readVectorFloatsFlat(String collection, String attribute) =>
+      _readFlatFloats(bindings.quiver_database_read_vector_floats_flat, collection, attribute, 'vector floats');
+
+  /// Reads all integer values for a set attribute with a single contiguous copy.
+  List<Int64List> readSetIntegersFlat(String collection, String attribute) =>
+      _readFlatIntegers(bindings.quiver_database_read_set_integers_flat, collection, attribute, 'set integers');
+
+  /// Reads all float values for a set attribute with a single contiguous copy.
+  List<Float64List> readSetFloatsFlat(String collection, String attribute) =>
+      _readFlatFloats(bindings.quiver_database_read_set_floats_flat, collection, attribute, 'set floats');
+
+  List<Int64List> _readFlatIntegers(
+    int Function(Pointer<quiver_database_t>, Pointer<Char>, Pointer<Char>, Pointer<Pointer<Int64>>,
+            Pointer<Pointer<Size>>, Pointer<Size>)
+        read,
+    String collection,
+    String attribute,
+    String context,
+  ) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final outValues = arena<Pointer<Int64>>();
+      final outOffsets = arena<Pointer<Size>>();
+      final outCount = arena<Size>();
+
+      final err = read(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        outValues,
+        outOffsets,
+        outCount,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to read $context from '$collection.$attribute'");
+      }
+
+      final count = outCount.value;
+      final offsets = outOffsets.value;
+      final total = offsets[count];
+      final values = total == 0 ? Int64List(0) : Int64List.fromList(outValues.value.asTypedList(total));
+      final result = List<Int64List>.generate(
+        count,
+        (i) => Int64List.sublistView(values, offsets[i], offsets[i + 1]),
+      );
+      bindings.quiver_free_integer_flat(outValues.value, offsets);
+      return result;
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  List<Float64List> _readFlatFloats(
+    int Function(Pointer<quiver_database_t>, Pointer<Char>, Pointer<Char>, Pointer<Pointer<Double>>,
+            Pointer<Pointer<Size>>, Pointer<Size>)
+        read,
+    String collection,
+    String attribute,
+    String context,
+  ) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final outValues = arena<Pointer<Double>>();
+      final outOffsets = arena<Pointer<Size>>();
+      final outCount = arena<Size>();
+
+      final err = read(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        outValues,
+        outOffsets,
+        outCount,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to read $context from '$collection.$attribute'");
+      }
+
+      final count = outCount.value;
+      final offsets = outOffsets.value;
+      final total = offsets[count];
+      final values = total == 0 ? Float64List(0) : Float64List.fromList(outValues.value.asTypedList(total));
+      final result = List<Float64List>.generate(
+        count,
+        (i) => Float64List.sublistView(values, offsets[i], offsets[i + 1]),
+      );
+      bindings.quiver_free_float_flat(outValues.value, offsets);
+      return result;
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
   // ==========================================================================
   // Read scalar by ID
   // ==========================================================================
@@ -709,6 +1012,351 @@ extension DatabaseRead on Database {
     return readSetStringsById(collection, attribute, id).map((s) => stringToDateTime(s)).toList();
   }
 
+  // ==========================================================================
+  // Read by IDs (batch)
+  // ==========================================================================
+
+  /// Reads integer values for a scalar attribute for each id, in input order (null for unknown ids and nulls).
+  List<int?> readScalarIntegersByIds(String collection, String attribute, List<int> ids) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final nativeIds = _nativeIds(arena, ids);
+      final outValues = arena<Pointer<Int64>>();
+      final outValidity = arena<Pointer<Uint8>>();
+
+      final err = bindings.quiver_database_read_scalar_integers_by_ids(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        nativeIds,
+        ids.length,
+        outValues,
+        outValidity,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to read scalar integers by ids from '$collection.$attribute'");
+      }
+
+      if (ids.isEmpty) {
+        return [];
+      }
+
+      final validity = outValidity.value;
+      final result = List<int?>.generate(
+        ids.length,
+        (i) => (validity[i >> 3] >> (i & 7)) & 1 != 0 ? outValues.value[i] : null,
+      );
+      bindings.quiver_free_integer_array(outValues.value);
+      bindings.quiver_free_validity_bitmap(validity);
+      return result;
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  /// Reads float values for a scalar attribute for each id, in input order (null for unknown ids and nulls).
+  List<double?> readScalarFloatsByIds(String collection, String attribute, List<int> ids) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final nativeIds = _nativeIds(arena, ids);
+      final outValues = arena<Pointer<Double>>();
+      final outValidity = arena<Pointer<Uint8>>();
+
+      final err = bindings.quiver_database_read_scalar_floats_by_ids(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        nativeIds,
+        ids.length,
+        outValues,
+        outValidity,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to read scalar floats by ids from '$collection.$attribute'");
+      }
+
+      if (ids.isEmpty) {
+        return [];
+      }
+
+      final validity = outValidity.value;
+      final result = List<double?>.generate(
+        ids.length,
+        (i) => (validity[i >> 3] >> (i & 7)) & 1 != 0 ? outValues.value[i] : null,
+      );
+      bindings.quiver_free_float_array(outValues.value);
+      bindings.quiver_free_validity_bitmap(validity);
+      return result;
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  /// Reads string values for a scalar attribute for each id, in input order (null for unknown ids and nulls).
+  List<String?> readScalarStringsByIds(String collection, String attribute, List<int> ids) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final nativeIds = _nativeIds(arena, ids);
+      final outValues = arena<Pointer<Pointer<Char>>>();
+      final outValidity = arena<Pointer<Uint8>>();
+
+      final err = bindings.quiver_database_read_scalar_strings_by_ids(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        nativeIds,
+        ids.length,
+        outValues,
+        outValidity,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to read scalar strings by ids from '$collection.$attribute'");
+      }
+
+      if (ids.isEmpty) {
+        return [];
+      }
+
+      final validity = outValidity.value;
+      final result = List<String?>.generate(
+        ids.length,
+        (i) => (validity[i >> 3] >> (i & 7)) & 1 != 0 ? outValues.value[i].cast<Utf8>().toDartString() : null,
+      );
+      bindings.quiver_free_string_array(outValues.value, ids.length);
+      bindings.quiver_free_validity_bitmap(validity);
+      return result;
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  /// Reads the integer values of a vector attribute for each id, in input order (empty for unknown ids).
+  List<Int64List> readVectorIntegersByIds(String collection, String attribute, List<int> ids) =>
+      _readIntegerGroupsByIds(bindings.quiver_database_read_vector_integers_by_ids, collection, attribute, ids);
+
+  /// Reads the float values of a vector attribute for each id, in input order (empty for unknown ids).
+  List<Float64List> readVectorFloatsByIds(String collection, String attribute, List<int> ids) =>
+      _readFloatGroupsByIds(bindings.quiver_database_read_vector_floats_by_ids, collection, attribute, ids);
+
+  /// Reads the string values of a vector attribute for each id, in input order (empty for unknown ids).
+  List<List<String>> readVectorStringsByIds(String collection, String attribute, List<int> ids) =>
+      _readStringGroupsByIds(bindings.quiver_database_read_vector_strings_by_ids, collection, attribute, ids);
+
+  /// Reads the integer values of a set attribute for each id, in input order (empty for unknown ids).
+  List<Int64List> readSetIntegersByIds(String collection, String attribute, List<int> ids) =>
+      _readIntegerGroupsByIds(bindings.quiver_database_read_set_integers_by_ids, collection, attribute, ids);
+
+  /// Reads the float values of a set attribute for each id, in input order (empty for unknown ids).
+  List<Float64List> readSetFloatsByIds(String collection, String attribute, List<int> ids) =>
+      _readFloatGroupsByIds(bindings.quiver_database_read_set_floats_by_ids, collection, attribute, ids);
+
+  /// Reads the string values of a set attribute for each id, in input order (empty for unknown ids).
+  List<List<String>> readSetStringsByIds(String collection, String attribute, List<int> ids) =>
+      _readStringGroupsByIds(bindings.quiver_database_read_set_strings_by_ids, collection, attribute, ids);
+
+  List<Int64List> _readIntegerGroupsByIds(
+    int Function(Pointer<quiver_database_t>, Pointer<Char>, Pointer<Char>, Pointer<Int64>, int,
+            Pointer<Pointer<Int64>>, Pointer<Pointer<Size>>)
+        read,
+    String collection,
+    String attribute,
+    List<int> ids,
+  ) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final nativeIds = _nativeIds(arena, ids);
+      final outValues = arena<Pointer<Int64>>();
+      final outOffsets = arena<Pointer<Size>>();
+
+      final err = read(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        nativeIds,
+        ids.length,
+        outValues,
+        outOffsets,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to read groups by ids from '$collection.$attribute'");
+      }
+
+      final offsets = outOffsets.value;
+      final total = offsets[ids.length];
+      final values = total == 0 ? Int64List(0) : Int64List.fromList(outValues.value.asTypedList(total));
+      final result = List<Int64List>.generate(
+        ids.length,
+        (i) => Int64List.sublistView(values, offsets[i], offsets[i + 1]),
+      );
+      bindings.quiver_free_integer_flat(outValues.value, offsets);
+      return result;
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  List<Float64List> _readFloatGroupsByIds(
+    int Function(Pointer<quiver_database_t>, Pointer<Char>, Pointer<Char>, Pointer<Int64>, int,
+            Pointer<Pointer<Double>>, Pointer<Pointer<Size>>)
+        read,
+    String collection,
+    String attribute,
+    List<int> ids,
+  ) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final nativeIds = _nativeIds(arena, ids);
+      final outValues = arena<Pointer<Double>>();
+      final outOffsets = arena<Pointer<Size>>();
+
+      final err = read(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        nativeIds,
+        ids.length,
+        outValues,
+        outOffsets,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to read groups by ids from '$collection.$attribute'");
+      }
+
+      final offsets = outOffsets.value;
+      final total = offsets[ids.length];
+      final values = total == 0 ? Float64List(0) : Float64List.fromList(outValues.value.asTypedList(total));
+      final result = List<Float64List>.generate(
+        ids.length,
+        (i) => Float64List.sublistView(values, offsets[i], offsets[i + 1]),
+      );
+      bindings.quiver_free_float_flat(outValues.value, offsets);
+      return result;
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  List<List<String>> _readStringGroupsByIds(
+    int Function(Pointer<quiver_database_t>, Pointer<Char>, Pointer<Char>, Pointer<Int64>, int,
+            Pointer<Pointer<Pointer<Char>>>, Pointer<Pointer<Size>>)
+        read,
+    String collection,
+    String attribute,
+    List<int> ids,
+  ) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final nativeIds = _nativeIds(arena, ids);
+      final outValues = arena<Pointer<Pointer<Char>>>();
+      final outOffsets = arena<Pointer<Size>>();
+
+      final err = read(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        nativeIds,
+        ids.length,
+        outValues,
+        outOffsets,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to read groups by ids from '$collection.$attribute'");
+      }
+
+      final offsets = outOffsets.value;
+      final total = offsets[ids.length];
+      final values = List<String>.generate(total, (i) => outValues.value[i].cast<Utf8>().toDartString());
+      final result = List<List<String>>.generate(
+        ids.length,
+        (i) => values.sublist(offsets[i], offsets[i + 1]),
+      );
+      bindings.quiver_free_string_flat(outValues.value, offsets, ids.length);
+      return result;
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  Pointer<Int64> _nativeIds(Arena arena, List<int> ids) {
+    final nativeIds = arena<Int64>(ids.isEmpty ? 1 : ids.length);
+    for (var i = 0; i < ids.length; i++) {
+      nativeIds[i] = ids[i];
+    }
+    return nativeIds;
+  }
+
+  // ==========================================================================
+  // Read time series
+  // ==========================================================================
+
+  /// Reads a float time series value column for an element by ID, ordered by date_time.
+  /// [dateTimeFrom] and [dateTimeTo] are inclusive bounds; missing values are NaN.
+  ({List<String> dateTimes, Float64List values}) readTimeSeriesFloats(
+    String collection,
+    String attribute,
+    int id, {
+    String? dateTimeFrom,
+    String? dateTimeTo,
+  }) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final outDateTimes = arena<Pointer<Pointer<Char>>>();
+      final outValues = arena<Pointer<Double>>();
+      final outCount = arena<Size>();
+
+      final err = bindings.quiver_database_read_time_series_floats(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        id,
+        dateTimeFrom == null ? nullptr : dateTimeFrom.toNativeUtf8(allocator: arena).cast(),
+        dateTimeTo == null ? nullptr : dateTimeTo.toNativeUtf8(allocator: arena).cast(),
+        outDateTimes,
+        outValues,
+        outCount,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(
+          err,
+          "Failed to read time series floats from '$collection.$attribute' for id $id",
+        );
+      }
+
+      final count = outCount.value;
+      if (count == 0) {
+        return (dateTimes: <String>[], values: Float64List(0));
+      }
+
+      final dateTimes = List<String>.generate(count, (i) => outDateTimes.value[i].cast<Utf8>().toDartString());
+      final values = Float64List.fromList(outValues.value.asTypedList(count));
+      bindings.quiver_free_time_series_floats(outDateTimes.value, outValues.value, count);
+      return (dateTimes: dateTimes, values: values);
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
   // ==========================================================================
   // Read element IDs
   // ==========================================================================
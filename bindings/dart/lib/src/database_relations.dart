@@ -24,6 +24,42 @@ extension DatabaseRelations on Database {
     }
   }
 
+  /// Sets fromLabels[i] -> toLabels[i] for every pair in one transaction.
+  /// Nothing is written if any target label does not exist.
+  void setScalarRelations(String collection, String attribute, List<String> fromLabels, List<String> toLabels) {
+    _ensureNotClosed();
+    if (fromLabels.length != toLabels.length) {
+      throw ArgumentError(
+        'Relation $attribute has ${fromLabels.length} source labels but ${toLabels.length} target labels',
+      );
+    }
+
+    final arena = Arena();
+    try {
+      final nativeFrom = arena<Pointer<Char>>(fromLabels.length);
+      final nativeTo = arena<Pointer<Char>>(toLabels.length);
+      for (var i = 0; i < fromLabels.length; i++) {
+        nativeFrom[i] = fromLabels[i].toNativeUtf8(allocator: arena).cast();
+        nativeTo[i] = toLabels[i].toNativeUtf8(allocator: arena).cast();
+      }
+
+      final err = bindings.quiver_database_set_scalar_relations(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        nativeFrom,
+        nativeTo,
+        fromLabels.length,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to set scalar relations '$attribute' in '$collection'");
+      }
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
   /// Reads scalar relation values (target labels) for a FK attribute.
   /// Returns null for elements with no relation set.
   List<String?> readScalarRelation(String collection, String attribute) {
@@ -67,4 +103,39 @@ extension DatabaseRelations on Database {
       arena.releaseAll();
     }
   }
+
+  /// Reads scalar relation target ids for a FK attribute, one per element.
+  /// Returns 0 for elements with no relation set.
+  List<int> readScalarRelationIds(String collection, String attribute) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final outValues = arena<Pointer<Int64>>();
+      final outCount = arena<Size>();
+
+      final err = bindings.quiver_database_read_scalar_relation_ids(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        outValues,
+        outCount,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to read scalar relation ids '$attribute' from '$collection'");
+      }
+
+      final count = outCount.value;
+      if (count == 0 || outValues.value == nullptr) {
+        return [];
+      }
+
+      final result = List<int>.generate(count, (i) => outValues.value[i]);
+      bindings.quiver_free_integer_array(outValues.value);
+      return result;
+    } finally {
+      arena.releaseAll();
+    }
+  }
 }
@@ -0,0 +1,66 @@
+part of 'database.dart';
+
+/// Transaction operations for Database.
+///
+/// Nested calls use SAVEPOINTs; [commit] and [rollback] always close the innermost level.
+extension DatabaseTransaction on Database {
+  /// Begins a transaction, or a savepoint if a transaction is already active.
+  void beginTransaction() {
+    _ensureNotClosed();
+
+    final err = bindings.quiver_database_begin_transaction(_ptr);
+    if (err != quiver_error_t.QUIVER_OK) {
+      throw DatabaseException.fromError(err, 'Failed to begin transaction');
+    }
+  }
+
+  /// Commits the innermost transaction level.
+  void commit() {
+    _ensureNotClosed();
+
+    final err = bindings.quiver_database_commit(_ptr);
+    if (err != quiver_error_t.QUIVER_OK) {
+      throw DatabaseException.fromError(err, 'Failed to commit transaction');
+    }
+  }
+
+  /// Rolls back the innermost transaction level.
+  void rollback() {
+    _ensureNotClosed();
+
+    final err = bindings.quiver_database_rollback(_ptr);
+    if (err != quiver_error_t.QUIVER_OK) {
+      throw DatabaseException.fromError(err, 'Failed to rollback transaction');
+    }
+  }
+
+  /// Whether a transaction is currently active.
+  bool get inTransaction {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final outActive = arena<Int>();
+      final err = bindings.quiver_database_in_transaction(_ptr, outActive);
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, 'Failed to query transaction state');
+      }
+      return outActive.value != 0;
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  /// Runs [fn] inside a transaction, committing on return and rolling back if it throws.
+  T transaction<T>(T Function() fn) {
+    beginTransaction();
+    try {
+      final result = fn();
+      commit();
+      return result;
+    } catch (_) {
+      rollback();
+      rethrow;
+    }
+  }
+}
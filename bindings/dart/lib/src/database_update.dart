@@ -107,6 +107,103 @@ extension DatabaseUpdate on Database {
     }
   }
 
+  /// Updates one scalar attribute for many elements: values[i] is written to element ids[i].
+  /// All rows are written in a single transaction.
+  void updateScalarIntegers(String collection, String attribute, List<int> ids, List<int> values) {
+    _ensureNotClosed();
+    _checkBatchLength(attribute, ids, values);
+
+    final arena = Arena();
+    try {
+      final nativeIds = _nativeIds(arena, ids);
+      final nativeValues = arena<Int64>(values.isEmpty ? 1 : values.length);
+      for (var i = 0; i < values.length; i++) {
+        nativeValues[i] = values[i];
+      }
+
+      final err = bindings.quiver_database_update_scalar_integers(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        nativeIds,
+        nativeValues,
+        ids.length,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to update scalar integers '$collection.$attribute'");
+      }
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  /// Updates one float scalar attribute for many elements in a single transaction.
+  void updateScalarFloats(String collection, String attribute, List<int> ids, List<double> values) {
+    _ensureNotClosed();
+    _checkBatchLength(attribute, ids, values);
+
+    final arena = Arena();
+    try {
+      final nativeIds = _nativeIds(arena, ids);
+      final nativeValues = arena<Double>(values.isEmpty ? 1 : values.length);
+      for (var i = 0; i < values.length; i++) {
+        nativeValues[i] = values[i];
+      }
+
+      final err = bindings.quiver_database_update_scalar_floats(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        nativeIds,
+        nativeValues,
+        ids.length,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to update scalar floats '$collection.$attribute'");
+      }
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  /// Updates one string scalar attribute for many elements in a single transaction.
+  void updateScalarStrings(String collection, String attribute, List<int> ids, List<String> values) {
+    _ensureNotClosed();
+    _checkBatchLength(attribute, ids, values);
+
+    final arena = Arena();
+    try {
+      final nativeIds = _nativeIds(arena, ids);
+      final nativeValues = arena<Pointer<Char>>(values.isEmpty ? 1 : values.length);
+      for (var i = 0; i < values.length; i++) {
+        nativeValues[i] = values[i].toNativeUtf8(allocator: arena).cast();
+      }
+
+      final err = bindings.quiver_database_update_scalar_strings(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        nativeIds,
+        nativeValues,
+        ids.length,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to update scalar strings '$collection.$attribute'");
+      }
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  void _checkBatchLength(String attribute, List<int> ids, List<Object> values) {
+    if (ids.length != values.length) {
+      throw ArgumentError('Update of $attribute has ${ids.length} ids but ${values.length} values');
+    }
+  }
+
   // ==========================================================================
   // Update vector attributes
   // ==========================================================================
@@ -195,6 +292,172 @@ extension DatabaseUpdate on Database {
     }
   }
 
+  // ==========================================================================
+  // Append / entry update vector attributes
+  // ==========================================================================
+
+  /// Appends integer values to a vector attribute by element ID, after the last stored entry.
+  void appendVectorIntegers(String collection, String attribute, int id, List<int> values) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final nativeValues = arena<Int64>(values.length);
+      for (var i = 0; i < values.length; i++) {
+        nativeValues[i] = values[i];
+      }
+
+      final err = bindings.quiver_database_append_vector_integers(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        id,
+        nativeValues,
+        values.length,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to append vector integers '$collection.$attribute' for id $id");
+      }
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  /// Appends float values to a vector attribute by element ID, after the last stored entry.
+  void appendVectorFloats(String collection, String attribute, int id, List<double> values) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final nativeValues = arena<Double>(values.length);
+      for (var i = 0; i < values.length; i++) {
+        nativeValues[i] = values[i];
+      }
+
+      final err = bindings.quiver_database_append_vector_floats(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        id,
+        nativeValues,
+        values.length,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to append vector floats '$collection.$attribute' for id $id");
+      }
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  /// Appends string values to a vector attribute by element ID, after the last stored entry.
+  void appendVectorStrings(String collection, String attribute, int id, List<String> values) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final nativePtrs = arena<Pointer<Char>>(values.length);
+      for (var i = 0; i < values.length; i++) {
+        nativePtrs[i] = values[i].toNativeUtf8(allocator: arena).cast();
+      }
+
+      final err = bindings.quiver_database_append_vector_strings(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        id,
+        nativePtrs,
+        values.length,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(err, "Failed to append vector strings '$collection.$attribute' for id $id");
+      }
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  /// Updates the vector entry at 0-based [index] by element ID; throws if the entry does not exist.
+  void updateVectorIntegerEntry(String collection, String attribute, int id, int index, int value) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final err = bindings.quiver_database_update_vector_integer_entry(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        id,
+        index,
+        value,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(
+          err,
+          "Failed to update vector entry $index of '$collection.$attribute' for id $id",
+        );
+      }
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  /// Updates the vector entry at 0-based [index] by element ID; throws if the entry does not exist.
+  void updateVectorFloatEntry(String collection, String attribute, int id, int index, double value) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final err = bindings.quiver_database_update_vector_float_entry(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        id,
+        index,
+        value,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(
+          err,
+          "Failed to update vector entry $index of '$collection.$attribute' for id $id",
+        );
+      }
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
+  /// Updates the vector entry at 0-based [index] by element ID; throws if the entry does not exist.
+  void updateVectorStringEntry(String collection, String attribute, int id, int index, String value) {
+    _ensureNotClosed();
+
+    final arena = Arena();
+    try {
+      final err = bindings.quiver_database_update_vector_string_entry(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        id,
+        index,
+        value.toNativeUtf8(allocator: arena).cast(),
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(
+          err,
+          "Failed to update vector entry $index of '$collection.$attribute' for id $id",
+        );
+      }
+    } finally {
+      arena.releaseAll();
+    }
+  }
+
   // ==========================================================================
   // Update set attributes
   // ==========================================================================
@@ -282,4 +545,50 @@ extension DatabaseUpdate on Database {
       arena.releaseAll();
     }
   }
+
+  /// Updates a float time series for an element by ID, replacing the element's rows in the group.
+  /// NaN values are stored as NULL.
+  void updateTimeSeriesFloats(
+    String collection,
+    String attribute,
+    int id,
+    List<String> dateTimes,
+    List<double> values,
+  ) {
+    _ensureNotClosed();
+    if (dateTimes.length != values.length) {
+      throw ArgumentError('Time series $attribute has ${dateTimes.length} date_times but ${values.length} values');
+    }
+
+    final arena = Arena();
+    try {
+      final nativeDateTimes = arena<Pointer<Char>>(dateTimes.length);
+      for (var i = 0; i < dateTimes.length; i++) {
+        nativeDateTimes[i] = dateTimes[i].toNativeUtf8(allocator: arena).cast();
+      }
+      final nativeValues = arena<Double>(values.length);
+      for (var i = 0; i < values.length; i++) {
+        nativeValues[i] = values[i];
+      }
+
+      final err = bindings.quiver_database_update_time_series_floats(
+        _ptr,
+        collection.toNativeUtf8(allocator: arena).cast(),
+        attribute.toNativeUtf8(allocator: arena).cast(),
+        id,
+        nativeDateTimes,
+        nativeValues,
+        values.length,
+      );
+
+      if (err != quiver_error_t.QUIVER_OK) {
+        throw DatabaseException.fromError(
+          err,
+          "Failed to update time series floats '$collection.$attribute' for id $id",
+        );
+      }
+    } finally {
+      arena.releaseAll();
+    }
+  }
 }
@@ -15,6 +15,7 @@ sealed class DatabaseException implements Exception {
       -4 => SchemaException(context ?? 'Schema error'),
       -5 => CreateElementException(context ?? 'Failed to create element'),
       -6 => NotFoundException(context ?? 'Not found'),
+      -7 => CancelledException(context ?? 'Operation cancelled'),
       _ => UnknownDatabaseException('Unknown error: $errorCode'),
     };
   }
@@ -44,6 +45,10 @@ class NotFoundException extends DatabaseException {
   const NotFoundException(super.message);
 }
 
+class CancelledException extends DatabaseException {
+  const CancelledException(super.message);
+}
+
 class UnknownDatabaseException extends DatabaseException {
   const UnknownDatabaseException(super.message);
 }
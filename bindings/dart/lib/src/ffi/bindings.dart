@@ -190,2038 +190,7370 @@ class QuiverDatabaseBindings {
   late final _quiver_database_path = _quiver_database_pathPtr
       .asFunction<ffi.Pointer<ffi.Char> Function(ffi.Pointer<quiver_database_t>)>();
 
+  ffi.Pointer<quiver_database_t> quiver_database_from_snapshot(
+    ffi.Pointer<ffi.Char> path,
+    ffi.Pointer<quiver_database_options_t> options,
+  ) {
+    return _quiver_database_from_snapshot(
+      path,
+      options,
+    );
+  }
+
+  late final _quiver_database_from_snapshotPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<quiver_database_t> Function(ffi.Pointer<ffi.Char>, ffi.Pointer<quiver_database_options_t>)
+        >
+      >('quiver_database_from_snapshot');
+  late final _quiver_database_from_snapshot = _quiver_database_from_snapshotPtr
+      .asFunction<
+        ffi.Pointer<quiver_database_t> Function(ffi.Pointer<ffi.Char>, ffi.Pointer<quiver_database_options_t>)
+      >();
+
+  int quiver_database_backup_to(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> path,
+    int pages_per_step,
+    quiver_backup_progress_t progress,
+    ffi.Pointer<ffi.Void> user_data,
+  ) {
+    return _quiver_database_backup_to(
+      db,
+      path,
+      pages_per_step,
+      progress,
+      user_data,
+    );
+  }
+
+  late final _quiver_database_backup_toPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int,
+            quiver_backup_progress_t,
+            ffi.Pointer<ffi.Void>,
+          )
+        >
+      >('quiver_database_backup_to');
+  late final _quiver_database_backup_to = _quiver_database_backup_toPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          quiver_backup_progress_t,
+          ffi.Pointer<ffi.Void>,
+        )
+      >();
+
+  int quiver_database_clone_in_memory(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Pointer<quiver_database_t>> out_db,
+  ) {
+    return _quiver_database_clone_in_memory(
+      db,
+      out_db,
+    );
+  }
+
+  late final _quiver_database_clone_in_memoryPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Pointer<quiver_database_t>>)
+        >
+      >('quiver_database_clone_in_memory');
+  late final _quiver_database_clone_in_memory = _quiver_database_clone_in_memoryPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Pointer<quiver_database_t>>)>();
+
+  int quiver_database_flush(
+    ffi.Pointer<quiver_database_t> db,
+  ) {
+    return _quiver_database_flush(
+      db,
+    );
+  }
+
+  late final _quiver_database_flushPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>)>>('quiver_database_flush');
+  late final _quiver_database_flush = _quiver_database_flushPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>)>();
+
   int quiver_database_current_version(
     ffi.Pointer<quiver_database_t> db,
   ) {
-    return _quiver_database_current_version(
+    return _quiver_database_current_version(
+      db,
+    );
+  }
+
+  late final _quiver_database_current_versionPtr =
+      _lookup<ffi.NativeFunction<ffi.Int64 Function(ffi.Pointer<quiver_database_t>)>>(
+        'quiver_database_current_version',
+      );
+  late final _quiver_database_current_version = _quiver_database_current_versionPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>)>();
+
+  int quiver_database_change_token(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Int64> out_token,
+  ) {
+    return _quiver_database_change_token(
+      db,
+      out_token,
+    );
+  }
+
+  late final _quiver_database_change_tokenPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Int64>)>>(
+        'quiver_database_change_token',
+      );
+  late final _quiver_database_change_token = _quiver_database_change_tokenPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Int64>)>();
+
+  int quiver_database_changes_since(
+    ffi.Pointer<quiver_database_t> db,
+    int token,
+    ffi.Pointer<ffi.Pointer<quiver_change_t>> out_changes,
+    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<ffi.Int64> out_token,
+  ) {
+    return _quiver_database_changes_since(
+      db,
+      token,
+      out_changes,
+      out_count,
+      out_token,
+    );
+  }
+
+  late final _quiver_database_changes_sincePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<quiver_change_t>>,
+            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<ffi.Int64>,
+          )
+        >
+      >('quiver_database_changes_since');
+  late final _quiver_database_changes_since = _quiver_database_changes_sincePtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          int,
+          ffi.Pointer<ffi.Pointer<quiver_change_t>>,
+          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<ffi.Int64>,
+        )
+      >();
+
+  int quiver_database_discard_changes(
+    ffi.Pointer<quiver_database_t> db,
+    int token,
+  ) {
+    return _quiver_database_discard_changes(
+      db,
+      token,
+    );
+  }
+
+  late final _quiver_database_discard_changesPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Int64)>>(
+        'quiver_database_discard_changes',
+      );
+  late final _quiver_database_discard_changes = _quiver_database_discard_changesPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, int)>();
+
+  void quiver_free_changes(
+    ffi.Pointer<quiver_change_t> changes,
+    int count,
+  ) {
+    return _quiver_free_changes(
+      changes,
+      count,
+    );
+  }
+
+  late final _quiver_free_changesPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_change_t>, ffi.Size)>>('quiver_free_changes');
+  late final _quiver_free_changes = _quiver_free_changesPtr
+      .asFunction<void Function(ffi.Pointer<quiver_change_t>, int)>();
+
+  int quiver_database_interrupt(
+    ffi.Pointer<quiver_database_t> db,
+  ) {
+    return _quiver_database_interrupt(
+      db,
+    );
+  }
+
+  late final _quiver_database_interruptPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>)>>('quiver_database_interrupt');
+  late final _quiver_database_interrupt = _quiver_database_interruptPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>)>();
+
+  int quiver_database_set_busy_timeout(
+    ffi.Pointer<quiver_database_t> db,
+    int timeout_ms,
+  ) {
+    return _quiver_database_set_busy_timeout(
+      db,
+      timeout_ms,
+    );
+  }
+
+  late final _quiver_database_set_busy_timeoutPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Int64)>>(
+        'quiver_database_set_busy_timeout',
+      );
+  late final _quiver_database_set_busy_timeout = _quiver_database_set_busy_timeoutPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, int)>();
+
+  int quiver_database_set_statement_timeout(
+    ffi.Pointer<quiver_database_t> db,
+    int timeout_ms,
+  ) {
+    return _quiver_database_set_statement_timeout(
+      db,
+      timeout_ms,
+    );
+  }
+
+  late final _quiver_database_set_statement_timeoutPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Int64)>>(
+        'quiver_database_set_statement_timeout',
+      );
+  late final _quiver_database_set_statement_timeout = _quiver_database_set_statement_timeoutPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, int)>();
+
+  int quiver_database_set_progress_handler(
+    ffi.Pointer<quiver_database_t> db,
+    quiver_progress_callback_t callback,
+    ffi.Pointer<ffi.Void> user_data,
+  ) {
+    return _quiver_database_set_progress_handler(
+      db,
+      callback,
+      user_data,
+    );
+  }
+
+  late final _quiver_database_set_progress_handlerPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_database_t>, quiver_progress_callback_t, ffi.Pointer<ffi.Void>)
+        >
+      >('quiver_database_set_progress_handler');
+  late final _quiver_database_set_progress_handler = _quiver_database_set_progress_handlerPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, quiver_progress_callback_t, ffi.Pointer<ffi.Void>)>();
+
+  int quiver_database_statement_cache_stats(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<quiver_statement_cache_stats_t> out_stats,
+  ) {
+    return _quiver_database_statement_cache_stats(
+      db,
+      out_stats,
+    );
+  }
+
+  late final _quiver_database_statement_cache_statsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<quiver_statement_cache_stats_t>)
+        >
+      >('quiver_database_statement_cache_stats');
+  late final _quiver_database_statement_cache_stats = _quiver_database_statement_cache_statsPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<quiver_statement_cache_stats_t>)>();
+
+  int quiver_database_stats(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<quiver_database_stats_t> out_stats,
+  ) {
+    return _quiver_database_stats(
+      db,
+      out_stats,
+    );
+  }
+
+  late final _quiver_database_statsPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<quiver_database_stats_t>)>
+      >('quiver_database_stats');
+  late final _quiver_database_stats = _quiver_database_statsPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<quiver_database_stats_t>)>();
+
+  int quiver_database_reset_stats(
+    ffi.Pointer<quiver_database_t> db,
+  ) {
+    return _quiver_database_reset_stats(
+      db,
+    );
+  }
+
+  late final _quiver_database_reset_statsPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>)>>('quiver_database_reset_stats');
+  late final _quiver_database_reset_stats = _quiver_database_reset_statsPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>)>();
+
+  void quiver_free_database_stats(
+    ffi.Pointer<quiver_database_stats_t> stats,
+  ) {
+    return _quiver_free_database_stats(
+      stats,
+    );
+  }
+
+  late final _quiver_free_database_statsPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_database_stats_t>)>>(
+        'quiver_free_database_stats',
+      );
+  late final _quiver_free_database_stats = _quiver_free_database_statsPtr
+      .asFunction<void Function(ffi.Pointer<quiver_database_stats_t>)>();
+
+  int quiver_database_memory_usage(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<quiver_memory_usage_t> out_usage,
+  ) {
+    return _quiver_database_memory_usage(
+      db,
+      out_usage,
+    );
+  }
+
+  late final _quiver_database_memory_usagePtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<quiver_memory_usage_t>)>
+      >('quiver_database_memory_usage');
+  late final _quiver_database_memory_usage = _quiver_database_memory_usagePtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<quiver_memory_usage_t>)>();
+
+  int quiver_database_shrink_memory(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Int64> out_released,
+  ) {
+    return _quiver_database_shrink_memory(
+      db,
+      out_released,
+    );
+  }
+
+  late final _quiver_database_shrink_memoryPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Int64>)>>(
+        'quiver_database_shrink_memory',
+      );
+  late final _quiver_database_shrink_memory = _quiver_database_shrink_memoryPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Int64>)>();
+
+  int quiver_database_begin_transaction(
+    ffi.Pointer<quiver_database_t> db,
+  ) {
+    return _quiver_database_begin_transaction(
+      db,
+    );
+  }
+
+  late final _quiver_database_begin_transactionPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>)>>(
+        'quiver_database_begin_transaction',
+      );
+  late final _quiver_database_begin_transaction = _quiver_database_begin_transactionPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>)>();
+
+  int quiver_database_commit(
+    ffi.Pointer<quiver_database_t> db,
+  ) {
+    return _quiver_database_commit(
+      db,
+    );
+  }
+
+  late final _quiver_database_commitPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>)>>('quiver_database_commit');
+  late final _quiver_database_commit = _quiver_database_commitPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>)>();
+
+  int quiver_database_rollback(
+    ffi.Pointer<quiver_database_t> db,
+  ) {
+    return _quiver_database_rollback(
+      db,
+    );
+  }
+
+  late final _quiver_database_rollbackPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>)>>('quiver_database_rollback');
+  late final _quiver_database_rollback = _quiver_database_rollbackPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>)>();
+
+  int quiver_database_in_transaction(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Int> out_active,
+  ) {
+    return _quiver_database_in_transaction(
+      db,
+      out_active,
+    );
+  }
+
+  late final _quiver_database_in_transactionPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Int>)>>(
+        'quiver_database_in_transaction',
+      );
+  late final _quiver_database_in_transaction = _quiver_database_in_transactionPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Int>)>();
+
+  int quiver_database_create_element(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<quiver_element_t> element,
+  ) {
+    return _quiver_database_create_element(
+      db,
+      collection,
+      element,
+    );
+  }
+
+  late final _quiver_database_create_elementPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int64 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<quiver_element_t>)
+        >
+      >('quiver_database_create_element');
+  late final _quiver_database_create_element = _quiver_database_create_elementPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<quiver_element_t>)>();
+
+  int quiver_database_create_elements(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Pointer<quiver_element_t>> elements,
+    int count,
+    ffi.Pointer<ffi.Int64> out_ids,
+  ) {
+    return _quiver_database_create_elements(
+      db,
+      collection,
+      elements,
+      count,
+      out_ids,
+    );
+  }
+
+  late final _quiver_database_create_elementsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<quiver_element_t>>,
+            ffi.Size,
+            ffi.Pointer<ffi.Int64>,
+          )
+        >
+      >('quiver_database_create_elements');
+  late final _quiver_database_create_elements = _quiver_database_create_elementsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<quiver_element_t>>,
+          int,
+          ffi.Pointer<ffi.Int64>,
+        )
+      >();
+
+  int quiver_database_update_element(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    int id,
+    ffi.Pointer<quiver_element_t> element,
+  ) {
+    return _quiver_database_update_element(
+      db,
+      collection,
+      id,
+      element,
+    );
+  }
+
+  late final _quiver_database_update_elementPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<quiver_element_t>,
+          )
+        >
+      >('quiver_database_update_element');
+  late final _quiver_database_update_element = _quiver_database_update_elementPtr
+      .asFunction<
+        int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, int, ffi.Pointer<quiver_element_t>)
+      >();
+
+  int quiver_database_upsert_element(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<quiver_element_t> element,
+    ffi.Pointer<ffi.Int64> out_id,
+  ) {
+    return _quiver_database_upsert_element(
+      db,
+      collection,
+      element,
+      out_id,
+    );
+  }
+
+  late final _quiver_database_upsert_elementPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_element_t>,
+            ffi.Pointer<ffi.Int64>,
+          )
+        >
+      >('quiver_database_upsert_element');
+  late final _quiver_database_upsert_element = _quiver_database_upsert_elementPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_element_t>,
+          ffi.Pointer<ffi.Int64>,
+        )
+      >();
+
+  int quiver_database_upsert_elements(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Pointer<quiver_element_t>> elements,
+    int count,
+    ffi.Pointer<ffi.Int64> out_ids,
+  ) {
+    return _quiver_database_upsert_elements(
+      db,
+      collection,
+      elements,
+      count,
+      out_ids,
+    );
+  }
+
+  late final _quiver_database_upsert_elementsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<quiver_element_t>>,
+            ffi.Size,
+            ffi.Pointer<ffi.Int64>,
+          )
+        >
+      >('quiver_database_upsert_elements');
+  late final _quiver_database_upsert_elements = _quiver_database_upsert_elementsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<quiver_element_t>>,
+          int,
+          ffi.Pointer<ffi.Int64>,
+        )
+      >();
+
+  int quiver_database_read_element(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    int id,
+    ffi.Pointer<ffi.Pointer<quiver_element_t>> out_element,
+  ) {
+    return _quiver_database_read_element(
+      db,
+      collection,
+      id,
+      out_element,
+    );
+  }
+
+  late final _quiver_database_read_elementPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<quiver_element_t>>,
+          )
+        >
+      >('quiver_database_read_element');
+  late final _quiver_database_read_element = _quiver_database_read_elementPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Pointer<quiver_element_t>>,
+        )
+      >();
+
+  int quiver_database_delete_element_by_id(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    int id,
+  ) {
+    return _quiver_database_delete_element_by_id(
+      db,
+      collection,
+      id,
+    );
+  }
+
+  late final _quiver_database_delete_element_by_idPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Int64)>>(
+        'quiver_database_delete_element_by_id',
+      );
+  late final _quiver_database_delete_element_by_id = _quiver_database_delete_element_by_idPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, int)>();
+
+  int quiver_database_delete_elements_by_ids(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Int64> ids,
+    int count,
+    ffi.Pointer<ffi.Size> out_deleted,
+  ) {
+    return _quiver_database_delete_elements_by_ids(
+      db,
+      collection,
+      ids,
+      count,
+      out_deleted,
+    );
+  }
+
+  late final _quiver_database_delete_elements_by_idsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_delete_elements_by_ids');
+  late final _quiver_database_delete_elements_by_ids = _quiver_database_delete_elements_by_idsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
+          int,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_set_scalar_relation(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Char> from_label,
+    ffi.Pointer<ffi.Char> to_label,
+  ) {
+    return _quiver_database_set_scalar_relation(
+      db,
+      collection,
+      attribute,
+      from_label,
+      to_label,
+    );
+  }
+
+  late final _quiver_database_set_scalar_relationPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+          )
+        >
+      >('quiver_database_set_scalar_relation');
+  late final _quiver_database_set_scalar_relation = _quiver_database_set_scalar_relationPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+        )
+      >();
+
+  int quiver_database_set_scalar_relations(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> from_labels,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> to_labels,
+    int count,
+  ) {
+    return _quiver_database_set_scalar_relations(
+      db,
+      collection,
+      attribute,
+      from_labels,
+      to_labels,
+      count,
+    );
+  }
+
+  late final _quiver_database_set_scalar_relationsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Size,
+          )
+        >
+      >('quiver_database_set_scalar_relations');
+  late final _quiver_database_set_scalar_relations = _quiver_database_set_scalar_relationsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          int,
+        )
+      >();
+
+  int quiver_database_read_scalar_relation(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_scalar_relation(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_scalar_relationPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_scalar_relation');
+  late final _quiver_database_read_scalar_relation = _quiver_database_read_scalar_relationPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_scalar_relation_ids(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_scalar_relation_ids(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_scalar_relation_idsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_scalar_relation_ids');
+  late final _quiver_database_read_scalar_relation_ids = _quiver_database_read_scalar_relation_idsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_scalar_integers(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_scalar_integers(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_scalar_integersPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_scalar_integers');
+  late final _quiver_database_read_scalar_integers = _quiver_database_read_scalar_integersPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_scalar_floats(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_scalar_floats(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_scalar_floatsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_scalar_floats');
+  late final _quiver_database_read_scalar_floats = _quiver_database_read_scalar_floatsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_scalar_strings(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_scalar_strings(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_scalar_stringsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_scalar_strings');
+  late final _quiver_database_read_scalar_strings = _quiver_database_read_scalar_stringsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_count_scalar_values(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_count_scalar_values(
+      db,
+      collection,
+      attribute,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_count_scalar_valuesPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_count_scalar_values');
+  late final _quiver_database_count_scalar_values = _quiver_database_count_scalar_valuesPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_scalar_integers_into(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Int64> buffer,
+    int capacity,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_scalar_integers_into(
+      db,
+      collection,
+      attribute,
+      buffer,
+      capacity,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_scalar_integers_intoPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_scalar_integers_into');
+  late final _quiver_database_read_scalar_integers_into = _quiver_database_read_scalar_integers_intoPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
+          int,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_scalar_floats_into(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Double> buffer,
+    int capacity,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_scalar_floats_into(
+      db,
+      collection,
+      attribute,
+      buffer,
+      capacity,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_scalar_floats_intoPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Double>,
+            ffi.Size,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_scalar_floats_into');
+  late final _quiver_database_read_scalar_floats_into = _quiver_database_read_scalar_floats_intoPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Double>,
+          int,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_scalar_integers_nullable(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Uint8>> out_validity,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_scalar_integers_nullable(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_validity,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_scalar_integers_nullablePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_scalar_integers_nullable');
+  late final _quiver_database_read_scalar_integers_nullable = _quiver_database_read_scalar_integers_nullablePtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_scalar_floats_nullable(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Uint8>> out_validity,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_scalar_floats_nullable(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_validity,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_scalar_floats_nullablePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_scalar_floats_nullable');
+  late final _quiver_database_read_scalar_floats_nullable = _quiver_database_read_scalar_floats_nullablePtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_scalar_strings_nullable(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Uint8>> out_validity,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_scalar_strings_nullable(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_validity,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_scalar_strings_nullablePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_scalar_strings_nullable');
+  late final _quiver_database_read_scalar_strings_nullable = _quiver_database_read_scalar_strings_nullablePtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_vector_integers(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Int64>>> out_vectors,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_sizes,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_vector_integers(
+      db,
+      collection,
+      attribute,
+      out_vectors,
+      out_sizes,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_vector_integersPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Int64>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_vector_integers');
+  late final _quiver_database_read_vector_integers = _quiver_database_read_vector_integersPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Int64>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_vector_floats(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Double>>> out_vectors,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_sizes,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_vector_floats(
+      db,
+      collection,
+      attribute,
+      out_vectors,
+      out_sizes,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_vector_floatsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Double>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_vector_floats');
+  late final _quiver_database_read_vector_floats = _quiver_database_read_vector_floatsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Double>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_vector_strings(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>> out_vectors,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_sizes,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_vector_strings(
+      db,
+      collection,
+      attribute,
+      out_vectors,
+      out_sizes,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_vector_stringsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_vector_strings');
+  late final _quiver_database_read_vector_strings = _quiver_database_read_vector_stringsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_set_integers(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Int64>>> out_sets,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_sizes,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_set_integers(
+      db,
+      collection,
+      attribute,
+      out_sets,
+      out_sizes,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_set_integersPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Int64>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_set_integers');
+  late final _quiver_database_read_set_integers = _quiver_database_read_set_integersPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Int64>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_set_floats(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Double>>> out_sets,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_sizes,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_set_floats(
+      db,
+      collection,
+      attribute,
+      out_sets,
+      out_sizes,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_set_floatsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Double>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_set_floats');
+  late final _quiver_database_read_set_floats = _quiver_database_read_set_floatsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Double>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_set_strings(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>> out_sets,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_sizes,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_set_strings(
+      db,
+      collection,
+      attribute,
+      out_sets,
+      out_sizes,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_set_stringsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_set_strings');
+  late final _quiver_database_read_set_strings = _quiver_database_read_set_stringsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_vector_integers_flat(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_vector_integers_flat(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_offsets,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_vector_integers_flatPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_vector_integers_flat');
+  late final _quiver_database_read_vector_integers_flat = _quiver_database_read_vector_integers_flatPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_vector_floats_flat(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_vector_floats_flat(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_offsets,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_vector_floats_flatPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_vector_floats_flat');
+  late final _quiver_database_read_vector_floats_flat = _quiver_database_read_vector_floats_flatPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_vector_strings_flat(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_vector_strings_flat(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_offsets,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_vector_strings_flatPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_vector_strings_flat');
+  late final _quiver_database_read_vector_strings_flat = _quiver_database_read_vector_strings_flatPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_set_integers_flat(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_set_integers_flat(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_offsets,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_set_integers_flatPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_set_integers_flat');
+  late final _quiver_database_read_set_integers_flat = _quiver_database_read_set_integers_flatPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_set_floats_flat(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_set_floats_flat(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_offsets,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_set_floats_flatPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_set_floats_flat');
+  late final _quiver_database_read_set_floats_flat = _quiver_database_read_set_floats_flatPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_set_strings_flat(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_set_strings_flat(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_offsets,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_set_strings_flatPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_set_strings_flat');
+  late final _quiver_database_read_set_strings_flat = _quiver_database_read_set_strings_flatPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_vector_integers_flat_aligned(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_vector_integers_flat_aligned(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_offsets,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_vector_integers_flat_alignedPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_vector_integers_flat_aligned');
+  late final _quiver_database_read_vector_integers_flat_aligned = _quiver_database_read_vector_integers_flat_alignedPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_vector_floats_flat_aligned(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_vector_floats_flat_aligned(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_offsets,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_vector_floats_flat_alignedPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_vector_floats_flat_aligned');
+  late final _quiver_database_read_vector_floats_flat_aligned = _quiver_database_read_vector_floats_flat_alignedPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_vector_strings_flat_aligned(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_vector_strings_flat_aligned(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_offsets,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_vector_strings_flat_alignedPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_vector_strings_flat_aligned');
+  late final _quiver_database_read_vector_strings_flat_aligned = _quiver_database_read_vector_strings_flat_alignedPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_set_integers_flat_aligned(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_set_integers_flat_aligned(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_offsets,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_set_integers_flat_alignedPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_set_integers_flat_aligned');
+  late final _quiver_database_read_set_integers_flat_aligned = _quiver_database_read_set_integers_flat_alignedPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_set_floats_flat_aligned(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_set_floats_flat_aligned(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_offsets,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_set_floats_flat_alignedPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_set_floats_flat_aligned');
+  late final _quiver_database_read_set_floats_flat_aligned = _quiver_database_read_set_floats_flat_alignedPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_set_strings_flat_aligned(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_set_strings_flat_aligned(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_offsets,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_set_strings_flat_alignedPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_set_strings_flat_aligned');
+  late final _quiver_database_read_set_strings_flat_aligned = _quiver_database_read_set_strings_flat_alignedPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_scalar_strings_arena(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int intern,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_scalar_strings_arena(
+      db,
+      collection,
+      attribute,
+      intern,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_scalar_strings_arenaPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_scalar_strings_arena');
+  late final _quiver_database_read_scalar_strings_arena = _quiver_database_read_scalar_strings_arenaPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_scalar_relation_arena(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int intern,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_scalar_relation_arena(
+      db,
+      collection,
+      attribute,
+      intern,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_scalar_relation_arenaPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_scalar_relation_arena');
+  late final _quiver_database_read_scalar_relation_arena = _quiver_database_read_scalar_relation_arenaPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_vector_strings_arena(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int intern,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_vector_strings_arena(
+      db,
+      collection,
+      attribute,
+      intern,
+      out_values,
+      out_offsets,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_vector_strings_arenaPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_vector_strings_arena');
+  late final _quiver_database_read_vector_strings_arena = _quiver_database_read_vector_strings_arenaPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_set_strings_arena(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int intern,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_set_strings_arena(
+      db,
+      collection,
+      attribute,
+      intern,
+      out_values,
+      out_offsets,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_set_strings_arenaPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_set_strings_arena');
+  late final _quiver_database_read_set_strings_arena = _quiver_database_read_set_strings_arenaPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_scalar_integers_by_id(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Int64> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_database_read_scalar_integers_by_id(
+      db,
+      collection,
+      attribute,
+      id,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_database_read_scalar_integers_by_idPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Pointer<ffi.Int>,
+          )
+        >
+      >('quiver_database_read_scalar_integers_by_id');
+  late final _quiver_database_read_scalar_integers_by_id = _quiver_database_read_scalar_integers_by_idPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Int64>,
+          ffi.Pointer<ffi.Int>,
+        )
+      >();
+
+  int quiver_database_read_scalar_floats_by_id(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Double> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_database_read_scalar_floats_by_id(
+      db,
+      collection,
+      attribute,
+      id,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_database_read_scalar_floats_by_idPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Double>,
+            ffi.Pointer<ffi.Int>,
+          )
+        >
+      >('quiver_database_read_scalar_floats_by_id');
+  late final _quiver_database_read_scalar_floats_by_id = _quiver_database_read_scalar_floats_by_idPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Double>,
+          ffi.Pointer<ffi.Int>,
+        )
+      >();
+
+  int quiver_database_read_scalar_strings_by_id(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_database_read_scalar_strings_by_id(
+      db,
+      collection,
+      attribute,
+      id,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_database_read_scalar_strings_by_idPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Pointer<ffi.Int>,
+          )
+        >
+      >('quiver_database_read_scalar_strings_by_id');
+  late final _quiver_database_read_scalar_strings_by_id = _quiver_database_read_scalar_strings_by_idPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          ffi.Pointer<ffi.Int>,
+        )
+      >();
+
+  int quiver_database_read_vector_integers_by_id(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_vector_integers_by_id(
+      db,
+      collection,
+      attribute,
+      id,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_vector_integers_by_idPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_vector_integers_by_id');
+  late final _quiver_database_read_vector_integers_by_id = _quiver_database_read_vector_integers_by_idPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_vector_floats_by_id(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_vector_floats_by_id(
+      db,
+      collection,
+      attribute,
+      id,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_vector_floats_by_idPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_vector_floats_by_id');
+  late final _quiver_database_read_vector_floats_by_id = _quiver_database_read_vector_floats_by_idPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_vector_strings_by_id(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_vector_strings_by_id(
+      db,
+      collection,
+      attribute,
+      id,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_vector_strings_by_idPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_vector_strings_by_id');
+  late final _quiver_database_read_vector_strings_by_id = _quiver_database_read_vector_strings_by_idPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_vector_floats_range(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    int first,
+    int count,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_vector_floats_range(
+      db,
+      collection,
+      attribute,
+      id,
+      first,
+      count,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_vector_floats_rangePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Int64,
+            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_vector_floats_range');
+  late final _quiver_database_read_vector_floats_range = _quiver_database_read_vector_floats_rangePtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          int,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_set_integers_by_id(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_set_integers_by_id(
+      db,
+      collection,
+      attribute,
+      id,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_set_integers_by_idPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_set_integers_by_id');
+  late final _quiver_database_read_set_integers_by_id = _quiver_database_read_set_integers_by_idPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_set_floats_by_id(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_set_floats_by_id(
+      db,
+      collection,
+      attribute,
+      id,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_set_floats_by_idPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_set_floats_by_id');
+  late final _quiver_database_read_set_floats_by_id = _quiver_database_read_set_floats_by_idPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_set_strings_by_id(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_set_strings_by_id(
+      db,
+      collection,
+      attribute,
+      id,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_set_strings_by_idPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_set_strings_by_id');
+  late final _quiver_database_read_set_strings_by_id = _quiver_database_read_set_strings_by_idPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_scalar_integers_by_ids(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Int64> ids,
+    int id_count,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Uint8>> out_validity,
+  ) {
+    return _quiver_database_read_scalar_integers_by_ids(
+      db,
+      collection,
+      attribute,
+      ids,
+      id_count,
+      out_values,
+      out_validity,
+    );
+  }
+
+  late final _quiver_database_read_scalar_integers_by_idsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+          )
+        >
+      >('quiver_database_read_scalar_integers_by_ids');
+  late final _quiver_database_read_scalar_integers_by_ids = _quiver_database_read_scalar_integers_by_idsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+        )
+      >();
+
+  int quiver_database_read_scalar_floats_by_ids(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Int64> ids,
+    int id_count,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Uint8>> out_validity,
+  ) {
+    return _quiver_database_read_scalar_floats_by_ids(
+      db,
+      collection,
+      attribute,
+      ids,
+      id_count,
+      out_values,
+      out_validity,
+    );
+  }
+
+  late final _quiver_database_read_scalar_floats_by_idsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+          )
+        >
+      >('quiver_database_read_scalar_floats_by_ids');
+  late final _quiver_database_read_scalar_floats_by_ids = _quiver_database_read_scalar_floats_by_idsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+        )
+      >();
+
+  int quiver_database_read_scalar_strings_by_ids(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Int64> ids,
+    int id_count,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Uint8>> out_validity,
+  ) {
+    return _quiver_database_read_scalar_strings_by_ids(
+      db,
+      collection,
+      attribute,
+      ids,
+      id_count,
+      out_values,
+      out_validity,
+    );
+  }
+
+  late final _quiver_database_read_scalar_strings_by_idsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+          )
+        >
+      >('quiver_database_read_scalar_strings_by_ids');
+  late final _quiver_database_read_scalar_strings_by_ids = _quiver_database_read_scalar_strings_by_idsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+        )
+      >();
+
+  int quiver_database_read_vector_integers_by_ids(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Int64> ids,
+    int id_count,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+  ) {
+    return _quiver_database_read_vector_integers_by_ids(
+      db,
+      collection,
+      attribute,
+      ids,
+      id_count,
+      out_values,
+      out_offsets,
+    );
+  }
+
+  late final _quiver_database_read_vector_integers_by_idsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          )
+        >
+      >('quiver_database_read_vector_integers_by_ids');
+  late final _quiver_database_read_vector_integers_by_ids = _quiver_database_read_vector_integers_by_idsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+        )
+      >();
+
+  int quiver_database_read_vector_floats_by_ids(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Int64> ids,
+    int id_count,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+  ) {
+    return _quiver_database_read_vector_floats_by_ids(
+      db,
+      collection,
+      attribute,
+      ids,
+      id_count,
+      out_values,
+      out_offsets,
+    );
+  }
+
+  late final _quiver_database_read_vector_floats_by_idsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          )
+        >
+      >('quiver_database_read_vector_floats_by_ids');
+  late final _quiver_database_read_vector_floats_by_ids = _quiver_database_read_vector_floats_by_idsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+        )
+      >();
+
+  int quiver_database_read_vector_strings_by_ids(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Int64> ids,
+    int id_count,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+  ) {
+    return _quiver_database_read_vector_strings_by_ids(
+      db,
+      collection,
+      attribute,
+      ids,
+      id_count,
+      out_values,
+      out_offsets,
+    );
+  }
+
+  late final _quiver_database_read_vector_strings_by_idsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          )
+        >
+      >('quiver_database_read_vector_strings_by_ids');
+  late final _quiver_database_read_vector_strings_by_ids = _quiver_database_read_vector_strings_by_idsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+        )
+      >();
+
+  int quiver_database_read_set_integers_by_ids(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Int64> ids,
+    int id_count,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+  ) {
+    return _quiver_database_read_set_integers_by_ids(
+      db,
+      collection,
+      attribute,
+      ids,
+      id_count,
+      out_values,
+      out_offsets,
+    );
+  }
+
+  late final _quiver_database_read_set_integers_by_idsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          )
+        >
+      >('quiver_database_read_set_integers_by_ids');
+  late final _quiver_database_read_set_integers_by_ids = _quiver_database_read_set_integers_by_idsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+        )
+      >();
+
+  int quiver_database_read_set_floats_by_ids(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Int64> ids,
+    int id_count,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+  ) {
+    return _quiver_database_read_set_floats_by_ids(
+      db,
+      collection,
+      attribute,
+      ids,
+      id_count,
+      out_values,
+      out_offsets,
+    );
+  }
+
+  late final _quiver_database_read_set_floats_by_idsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          )
+        >
+      >('quiver_database_read_set_floats_by_ids');
+  late final _quiver_database_read_set_floats_by_ids = _quiver_database_read_set_floats_by_idsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+        )
+      >();
+
+  int quiver_database_read_set_strings_by_ids(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Int64> ids,
+    int id_count,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+  ) {
+    return _quiver_database_read_set_strings_by_ids(
+      db,
+      collection,
+      attribute,
+      ids,
+      id_count,
+      out_values,
+      out_offsets,
+    );
+  }
+
+  late final _quiver_database_read_set_strings_by_idsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          )
+        >
+      >('quiver_database_read_set_strings_by_ids');
+  late final _quiver_database_read_set_strings_by_ids = _quiver_database_read_set_strings_by_idsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+        )
+      >();
+
+  int quiver_database_read_time_series_floats(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Char> date_time_from,
+    ffi.Pointer<ffi.Char> date_time_to,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_date_times,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_time_series_floats(
+      db,
+      collection,
+      attribute,
+      id,
+      date_time_from,
+      date_time_to,
+      out_date_times,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_time_series_floatsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_time_series_floats');
+  late final _quiver_database_read_time_series_floats = _quiver_database_read_time_series_floatsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_aggregate_vector(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Int32> statistics,
+    int statistic_count,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_ids,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_aggregate_vector(
+      db,
+      collection,
+      attribute,
+      statistics,
+      statistic_count,
+      out_ids,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_aggregate_vectorPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int32>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_aggregate_vector');
+  late final _quiver_database_aggregate_vector = _quiver_database_aggregate_vectorPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int32>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_aggregate_time_series(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int bucket,
+    ffi.Pointer<ffi.Int32> statistics,
+    int statistic_count,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_ids,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_buckets,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_aggregate_time_series(
+      db,
+      collection,
+      attribute,
+      bucket,
+      statistics,
+      statistic_count,
+      out_ids,
+      out_buckets,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_aggregate_time_seriesPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int32,
+            ffi.Pointer<ffi.Int32>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_aggregate_time_series');
+  late final _quiver_database_aggregate_time_series = _quiver_database_aggregate_time_seriesPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Int32>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_element_ids(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_ids,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_element_ids(
+      db,
+      collection,
+      out_ids,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_element_idsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_element_ids');
+  late final _quiver_database_read_element_ids = _quiver_database_read_element_idsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_scalars(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> attributes,
+    int attribute_count,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_ids,
+    ffi.Pointer<ffi.Pointer<quiver_scalar_column_t>> out_columns,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_scalars(
+      db,
+      collection,
+      attributes,
+      attribute_count,
+      out_ids,
+      out_columns,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_scalarsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Pointer<quiver_scalar_column_t>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_scalars');
+  late final _quiver_database_read_scalars = _quiver_database_read_scalarsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Pointer<quiver_scalar_column_t>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_create_elements_columns(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<quiver_scalar_column_t> columns,
+    int column_count,
+    int count,
+    ffi.Pointer<ffi.Int64> out_ids,
+  ) {
+    return _quiver_database_create_elements_columns(
+      db,
+      collection,
+      columns,
+      column_count,
+      count,
+      out_ids,
+    );
+  }
+
+  late final _quiver_database_create_elements_columnsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_scalar_column_t>,
+            ffi.Size,
+            ffi.Size,
+            ffi.Pointer<ffi.Int64>,
+          )
+        >
+      >('quiver_database_create_elements_columns');
+  late final _quiver_database_create_elements_columns = _quiver_database_create_elements_columnsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_scalar_column_t>,
+          int,
+          int,
+          ffi.Pointer<ffi.Int64>,
+        )
+      >();
+
+  int quiver_database_get_scalar_metadata(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<quiver_scalar_metadata_t> out_metadata,
+  ) {
+    return _quiver_database_get_scalar_metadata(
+      db,
+      collection,
+      attribute,
+      out_metadata,
+    );
+  }
+
+  late final _quiver_database_get_scalar_metadataPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_scalar_metadata_t>,
+          )
+        >
+      >('quiver_database_get_scalar_metadata');
+  late final _quiver_database_get_scalar_metadata = _quiver_database_get_scalar_metadataPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_scalar_metadata_t>,
+        )
+      >();
+
+  int quiver_database_get_vector_metadata(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> group_name,
+    ffi.Pointer<quiver_vector_metadata_t> out_metadata,
+  ) {
+    return _quiver_database_get_vector_metadata(
+      db,
+      collection,
+      group_name,
+      out_metadata,
+    );
+  }
+
+  late final _quiver_database_get_vector_metadataPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_vector_metadata_t>,
+          )
+        >
+      >('quiver_database_get_vector_metadata');
+  late final _quiver_database_get_vector_metadata = _quiver_database_get_vector_metadataPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_vector_metadata_t>,
+        )
+      >();
+
+  int quiver_database_get_set_metadata(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> group_name,
+    ffi.Pointer<quiver_set_metadata_t> out_metadata,
+  ) {
+    return _quiver_database_get_set_metadata(
+      db,
+      collection,
+      group_name,
+      out_metadata,
+    );
+  }
+
+  late final _quiver_database_get_set_metadataPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_set_metadata_t>,
+          )
+        >
+      >('quiver_database_get_set_metadata');
+  late final _quiver_database_get_set_metadata = _quiver_database_get_set_metadataPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_set_metadata_t>,
+        )
+      >();
+
+  void quiver_free_scalar_metadata(
+    ffi.Pointer<quiver_scalar_metadata_t> metadata,
+  ) {
+    return _quiver_free_scalar_metadata(
+      metadata,
+    );
+  }
+
+  late final _quiver_free_scalar_metadataPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_scalar_metadata_t>)>>(
+        'quiver_free_scalar_metadata',
+      );
+  late final _quiver_free_scalar_metadata = _quiver_free_scalar_metadataPtr
+      .asFunction<void Function(ffi.Pointer<quiver_scalar_metadata_t>)>();
+
+  void quiver_free_vector_metadata(
+    ffi.Pointer<quiver_vector_metadata_t> metadata,
+  ) {
+    return _quiver_free_vector_metadata(
+      metadata,
+    );
+  }
+
+  late final _quiver_free_vector_metadataPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_vector_metadata_t>)>>(
+        'quiver_free_vector_metadata',
+      );
+  late final _quiver_free_vector_metadata = _quiver_free_vector_metadataPtr
+      .asFunction<void Function(ffi.Pointer<quiver_vector_metadata_t>)>();
+
+  void quiver_free_set_metadata(
+    ffi.Pointer<quiver_set_metadata_t> metadata,
+  ) {
+    return _quiver_free_set_metadata(
+      metadata,
+    );
+  }
+
+  late final _quiver_free_set_metadataPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_set_metadata_t>)>>('quiver_free_set_metadata');
+  late final _quiver_free_set_metadata = _quiver_free_set_metadataPtr
+      .asFunction<void Function(ffi.Pointer<quiver_set_metadata_t>)>();
+
+  int quiver_database_list_scalar_attributes(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Pointer<quiver_scalar_metadata_t>> out_metadata,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_list_scalar_attributes(
+      db,
+      collection,
+      out_metadata,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_list_scalar_attributesPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<quiver_scalar_metadata_t>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_list_scalar_attributes');
+  late final _quiver_database_list_scalar_attributes = _quiver_database_list_scalar_attributesPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<quiver_scalar_metadata_t>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_list_vector_groups(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Pointer<quiver_vector_metadata_t>> out_metadata,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_list_vector_groups(
+      db,
+      collection,
+      out_metadata,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_list_vector_groupsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<quiver_vector_metadata_t>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_list_vector_groups');
+  late final _quiver_database_list_vector_groups = _quiver_database_list_vector_groupsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<quiver_vector_metadata_t>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_list_set_groups(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Pointer<quiver_set_metadata_t>> out_metadata,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_list_set_groups(
+      db,
+      collection,
+      out_metadata,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_list_set_groupsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<quiver_set_metadata_t>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_list_set_groups');
+  late final _quiver_database_list_set_groups = _quiver_database_list_set_groupsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<quiver_set_metadata_t>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  void quiver_free_scalar_metadata_array(
+    ffi.Pointer<quiver_scalar_metadata_t> metadata,
+    int count,
+  ) {
+    return _quiver_free_scalar_metadata_array(
+      metadata,
+      count,
+    );
+  }
+
+  late final _quiver_free_scalar_metadata_arrayPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_scalar_metadata_t>, ffi.Size)>>(
+        'quiver_free_scalar_metadata_array',
+      );
+  late final _quiver_free_scalar_metadata_array = _quiver_free_scalar_metadata_arrayPtr
+      .asFunction<void Function(ffi.Pointer<quiver_scalar_metadata_t>, int)>();
+
+  void quiver_free_vector_metadata_array(
+    ffi.Pointer<quiver_vector_metadata_t> metadata,
+    int count,
+  ) {
+    return _quiver_free_vector_metadata_array(
+      metadata,
+      count,
+    );
+  }
+
+  late final _quiver_free_vector_metadata_arrayPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_vector_metadata_t>, ffi.Size)>>(
+        'quiver_free_vector_metadata_array',
+      );
+  late final _quiver_free_vector_metadata_array = _quiver_free_vector_metadata_arrayPtr
+      .asFunction<void Function(ffi.Pointer<quiver_vector_metadata_t>, int)>();
+
+  void quiver_free_set_metadata_array(
+    ffi.Pointer<quiver_set_metadata_t> metadata,
+    int count,
+  ) {
+    return _quiver_free_set_metadata_array(
+      metadata,
+      count,
+    );
+  }
+
+  late final _quiver_free_set_metadata_arrayPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_set_metadata_t>, ffi.Size)>>(
+        'quiver_free_set_metadata_array',
+      );
+  late final _quiver_free_set_metadata_array = _quiver_free_set_metadata_arrayPtr
+      .asFunction<void Function(ffi.Pointer<quiver_set_metadata_t>, int)>();
+
+  int quiver_database_update_scalar_integer(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    int value,
+  ) {
+    return _quiver_database_update_scalar_integer(
+      db,
+      collection,
+      attribute,
+      id,
+      value,
+    );
+  }
+
+  late final _quiver_database_update_scalar_integerPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Int64,
+          )
+        >
+      >('quiver_database_update_scalar_integer');
+  late final _quiver_database_update_scalar_integer = _quiver_database_update_scalar_integerPtr
+      .asFunction<
+        int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>, int, int)
+      >();
+
+  int quiver_database_update_scalar_float(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    double value,
+  ) {
+    return _quiver_database_update_scalar_float(
+      db,
+      collection,
+      attribute,
+      id,
+      value,
+    );
+  }
+
+  late final _quiver_database_update_scalar_floatPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Double,
+          )
+        >
+      >('quiver_database_update_scalar_float');
+  late final _quiver_database_update_scalar_float = _quiver_database_update_scalar_floatPtr
+      .asFunction<
+        int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>, int, double)
+      >();
+
+  int quiver_database_update_scalar_string(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Char> value,
+  ) {
+    return _quiver_database_update_scalar_string(
+      db,
+      collection,
+      attribute,
+      id,
+      value,
+    );
+  }
+
+  late final _quiver_database_update_scalar_stringPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Char>,
+          )
+        >
+      >('quiver_database_update_scalar_string');
+  late final _quiver_database_update_scalar_string = _quiver_database_update_scalar_stringPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Char>,
+        )
+      >();
+
+  int quiver_database_update_scalar_integers(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Int64> ids,
+    ffi.Pointer<ffi.Int64> values,
+    int count,
+  ) {
+    return _quiver_database_update_scalar_integers(
+      db,
+      collection,
+      attribute,
+      ids,
+      values,
+      count,
+    );
+  }
+
+  late final _quiver_database_update_scalar_integersPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
+          )
+        >
+      >('quiver_database_update_scalar_integers');
+  late final _quiver_database_update_scalar_integers = _quiver_database_update_scalar_integersPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
+          ffi.Pointer<ffi.Int64>,
+          int,
+        )
+      >();
+
+  int quiver_database_update_scalar_floats(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Int64> ids,
+    ffi.Pointer<ffi.Double> values,
+    int count,
+  ) {
+    return _quiver_database_update_scalar_floats(
+      db,
+      collection,
+      attribute,
+      ids,
+      values,
+      count,
+    );
+  }
+
+  late final _quiver_database_update_scalar_floatsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Pointer<ffi.Double>,
+            ffi.Size,
+          )
+        >
+      >('quiver_database_update_scalar_floats');
+  late final _quiver_database_update_scalar_floats = _quiver_database_update_scalar_floatsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
+          ffi.Pointer<ffi.Double>,
+          int,
+        )
+      >();
+
+  int quiver_database_update_scalar_strings(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Int64> ids,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> values,
+    int count,
+  ) {
+    return _quiver_database_update_scalar_strings(
+      db,
+      collection,
+      attribute,
+      ids,
+      values,
+      count,
+    );
+  }
+
+  late final _quiver_database_update_scalar_stringsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Size,
+          )
+        >
+      >('quiver_database_update_scalar_strings');
+  late final _quiver_database_update_scalar_strings = _quiver_database_update_scalar_stringsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          int,
+        )
+      >();
+
+  int quiver_database_update_vector_integers(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Int64> values,
+    int count,
+  ) {
+    return _quiver_database_update_vector_integers(
+      db,
+      collection,
+      attribute,
+      id,
+      values,
+      count,
+    );
+  }
+
+  late final _quiver_database_update_vector_integersPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
+          )
+        >
+      >('quiver_database_update_vector_integers');
+  late final _quiver_database_update_vector_integers = _quiver_database_update_vector_integersPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Int64>,
+          int,
+        )
+      >();
+
+  int quiver_database_update_vector_floats(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Double> values,
+    int count,
+  ) {
+    return _quiver_database_update_vector_floats(
+      db,
+      collection,
+      attribute,
+      id,
+      values,
+      count,
+    );
+  }
+
+  late final _quiver_database_update_vector_floatsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Double>,
+            ffi.Size,
+          )
+        >
+      >('quiver_database_update_vector_floats');
+  late final _quiver_database_update_vector_floats = _quiver_database_update_vector_floatsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Double>,
+          int,
+        )
+      >();
+
+  int quiver_database_update_vector_strings(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> values,
+    int count,
+  ) {
+    return _quiver_database_update_vector_strings(
+      db,
+      collection,
+      attribute,
+      id,
+      values,
+      count,
+    );
+  }
+
+  late final _quiver_database_update_vector_stringsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Size,
+          )
+        >
+      >('quiver_database_update_vector_strings');
+  late final _quiver_database_update_vector_strings = _quiver_database_update_vector_stringsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          int,
+        )
+      >();
+
+  int quiver_database_append_vector_integers(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Int64> values,
+    int count,
+  ) {
+    return _quiver_database_append_vector_integers(
+      db,
+      collection,
+      attribute,
+      id,
+      values,
+      count,
+    );
+  }
+
+  late final _quiver_database_append_vector_integersPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
+          )
+        >
+      >('quiver_database_append_vector_integers');
+  late final _quiver_database_append_vector_integers = _quiver_database_append_vector_integersPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Int64>,
+          int,
+        )
+      >();
+
+  int quiver_database_append_vector_floats(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Double> values,
+    int count,
+  ) {
+    return _quiver_database_append_vector_floats(
+      db,
+      collection,
+      attribute,
+      id,
+      values,
+      count,
+    );
+  }
+
+  late final _quiver_database_append_vector_floatsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Double>,
+            ffi.Size,
+          )
+        >
+      >('quiver_database_append_vector_floats');
+  late final _quiver_database_append_vector_floats = _quiver_database_append_vector_floatsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Double>,
+          int,
+        )
+      >();
+
+  int quiver_database_append_vector_strings(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> values,
+    int count,
+  ) {
+    return _quiver_database_append_vector_strings(
+      db,
+      collection,
+      attribute,
+      id,
+      values,
+      count,
+    );
+  }
+
+  late final _quiver_database_append_vector_stringsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Size,
+          )
+        >
+      >('quiver_database_append_vector_strings');
+  late final _quiver_database_append_vector_strings = _quiver_database_append_vector_stringsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          int,
+        )
+      >();
+
+  int quiver_database_update_vector_integer_entry(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    int index,
+    int value,
+  ) {
+    return _quiver_database_update_vector_integer_entry(
+      db,
+      collection,
+      attribute,
+      id,
+      index,
+      value,
+    );
+  }
+
+  late final _quiver_database_update_vector_integer_entryPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Int64,
+            ffi.Int64,
+          )
+        >
+      >('quiver_database_update_vector_integer_entry');
+  late final _quiver_database_update_vector_integer_entry = _quiver_database_update_vector_integer_entryPtr
+      .asFunction<
+        int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>, int, int, int)
+      >();
+
+  int quiver_database_update_vector_float_entry(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    int index,
+    double value,
+  ) {
+    return _quiver_database_update_vector_float_entry(
+      db,
+      collection,
+      attribute,
+      id,
+      index,
+      value,
+    );
+  }
+
+  late final _quiver_database_update_vector_float_entryPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Int64,
+            ffi.Double,
+          )
+        >
+      >('quiver_database_update_vector_float_entry');
+  late final _quiver_database_update_vector_float_entry = _quiver_database_update_vector_float_entryPtr
+      .asFunction<
+        int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>, int, int, double)
+      >();
+
+  int quiver_database_update_vector_string_entry(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    int index,
+    ffi.Pointer<ffi.Char> value,
+  ) {
+    return _quiver_database_update_vector_string_entry(
+      db,
+      collection,
+      attribute,
+      id,
+      index,
+      value,
+    );
+  }
+
+  late final _quiver_database_update_vector_string_entryPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Int64,
+            ffi.Pointer<ffi.Char>,
+          )
+        >
+      >('quiver_database_update_vector_string_entry');
+  late final _quiver_database_update_vector_string_entry = _quiver_database_update_vector_string_entryPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          int,
+          ffi.Pointer<ffi.Char>,
+        )
+      >();
+
+  int quiver_database_update_set_integers(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Int64> values,
+    int count,
+  ) {
+    return _quiver_database_update_set_integers(
+      db,
+      collection,
+      attribute,
+      id,
+      values,
+      count,
+    );
+  }
+
+  late final _quiver_database_update_set_integersPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
+          )
+        >
+      >('quiver_database_update_set_integers');
+  late final _quiver_database_update_set_integers = _quiver_database_update_set_integersPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Int64>,
+          int,
+        )
+      >();
+
+  int quiver_database_update_set_floats(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Double> values,
+    int count,
+  ) {
+    return _quiver_database_update_set_floats(
+      db,
+      collection,
+      attribute,
+      id,
+      values,
+      count,
+    );
+  }
+
+  late final _quiver_database_update_set_floatsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Double>,
+            ffi.Size,
+          )
+        >
+      >('quiver_database_update_set_floats');
+  late final _quiver_database_update_set_floats = _quiver_database_update_set_floatsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Double>,
+          int,
+        )
+      >();
+
+  int quiver_database_update_set_strings(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> values,
+    int count,
+  ) {
+    return _quiver_database_update_set_strings(
+      db,
+      collection,
+      attribute,
+      id,
+      values,
+      count,
+    );
+  }
+
+  late final _quiver_database_update_set_stringsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Size,
+          )
+        >
+      >('quiver_database_update_set_strings');
+  late final _quiver_database_update_set_strings = _quiver_database_update_set_stringsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          int,
+        )
+      >();
+
+  int quiver_database_update_time_series_floats(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> date_times,
+    ffi.Pointer<ffi.Double> values,
+    int count,
+  ) {
+    return _quiver_database_update_time_series_floats(
+      db,
+      collection,
+      attribute,
+      id,
+      date_times,
+      values,
+      count,
+    );
+  }
+
+  late final _quiver_database_update_time_series_floatsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Pointer<ffi.Double>,
+            ffi.Size,
+          )
+        >
+      >('quiver_database_update_time_series_floats');
+  late final _quiver_database_update_time_series_floats = _quiver_database_update_time_series_floatsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          ffi.Pointer<ffi.Double>,
+          int,
+        )
+      >();
+
+  void quiver_free_integer_array(
+    ffi.Pointer<ffi.Int64> values,
+  ) {
+    return _quiver_free_integer_array(
+      values,
+    );
+  }
+
+  late final _quiver_free_integer_arrayPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Int64>)>>(
+    'quiver_free_integer_array',
+  );
+  late final _quiver_free_integer_array = _quiver_free_integer_arrayPtr
+      .asFunction<void Function(ffi.Pointer<ffi.Int64>)>();
+
+  void quiver_free_float_array(
+    ffi.Pointer<ffi.Double> values,
+  ) {
+    return _quiver_free_float_array(
+      values,
+    );
+  }
+
+  late final _quiver_free_float_arrayPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Double>)>>(
+    'quiver_free_float_array',
+  );
+  late final _quiver_free_float_array = _quiver_free_float_arrayPtr
+      .asFunction<void Function(ffi.Pointer<ffi.Double>)>();
+
+  void quiver_free_string_array(
+    ffi.Pointer<ffi.Pointer<ffi.Char>> values,
+    int count,
+  ) {
+    return _quiver_free_string_array(
+      values,
+      count,
+    );
+  }
+
+  late final _quiver_free_string_arrayPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Pointer<ffi.Char>>, ffi.Size)>>(
+        'quiver_free_string_array',
+      );
+  late final _quiver_free_string_array = _quiver_free_string_arrayPtr
+      .asFunction<void Function(ffi.Pointer<ffi.Pointer<ffi.Char>>, int)>();
+
+  void quiver_free_validity_bitmap(
+    ffi.Pointer<ffi.Uint8> validity,
+  ) {
+    return _quiver_free_validity_bitmap(
+      validity,
+    );
+  }
+
+  late final _quiver_free_validity_bitmapPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Uint8>)>>(
+    'quiver_free_validity_bitmap',
+  );
+  late final _quiver_free_validity_bitmap = _quiver_free_validity_bitmapPtr
+      .asFunction<void Function(ffi.Pointer<ffi.Uint8>)>();
+
+  void quiver_free_integer_vectors(
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> vectors,
+    ffi.Pointer<ffi.Size> sizes,
+    int count,
+  ) {
+    return _quiver_free_integer_vectors(
+      vectors,
+      sizes,
+      count,
+    );
+  }
+
+  late final _quiver_free_integer_vectorsPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Pointer<ffi.Int64>>, ffi.Pointer<ffi.Size>, ffi.Size)>
+      >('quiver_free_integer_vectors');
+  late final _quiver_free_integer_vectors = _quiver_free_integer_vectorsPtr
+      .asFunction<void Function(ffi.Pointer<ffi.Pointer<ffi.Int64>>, ffi.Pointer<ffi.Size>, int)>();
+
+  void quiver_free_float_vectors(
+    ffi.Pointer<ffi.Pointer<ffi.Double>> vectors,
+    ffi.Pointer<ffi.Size> sizes,
+    int count,
+  ) {
+    return _quiver_free_float_vectors(
+      vectors,
+      sizes,
+      count,
+    );
+  }
+
+  late final _quiver_free_float_vectorsPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Pointer<ffi.Double>>, ffi.Pointer<ffi.Size>, ffi.Size)>
+      >('quiver_free_float_vectors');
+  late final _quiver_free_float_vectors = _quiver_free_float_vectorsPtr
+      .asFunction<void Function(ffi.Pointer<ffi.Pointer<ffi.Double>>, ffi.Pointer<ffi.Size>, int)>();
+
+  void quiver_free_string_vectors(
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> vectors,
+    ffi.Pointer<ffi.Size> sizes,
+    int count,
+  ) {
+    return _quiver_free_string_vectors(
+      vectors,
+      sizes,
+      count,
+    );
+  }
+
+  late final _quiver_free_string_vectorsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>, ffi.Pointer<ffi.Size>, ffi.Size)
+        >
+      >('quiver_free_string_vectors');
+  late final _quiver_free_string_vectors = _quiver_free_string_vectorsPtr
+      .asFunction<void Function(ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>, ffi.Pointer<ffi.Size>, int)>();
+
+  void quiver_free_integer_flat(
+    ffi.Pointer<ffi.Int64> values,
+    ffi.Pointer<ffi.Size> offsets,
+  ) {
+    return _quiver_free_integer_flat(
+      values,
+      offsets,
+    );
+  }
+
+  late final _quiver_free_integer_flatPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Int64>, ffi.Pointer<ffi.Size>)>>(
+        'quiver_free_integer_flat',
+      );
+  late final _quiver_free_integer_flat = _quiver_free_integer_flatPtr
+      .asFunction<void Function(ffi.Pointer<ffi.Int64>, ffi.Pointer<ffi.Size>)>();
+
+  void quiver_free_float_flat(
+    ffi.Pointer<ffi.Double> values,
+    ffi.Pointer<ffi.Size> offsets,
+  ) {
+    return _quiver_free_float_flat(
+      values,
+      offsets,
+    );
+  }
+
+  late final _quiver_free_float_flatPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Double>, ffi.Pointer<ffi.Size>)>>(
+        'quiver_free_float_flat',
+      );
+  late final _quiver_free_float_flat = _quiver_free_float_flatPtr
+      .asFunction<void Function(ffi.Pointer<ffi.Double>, ffi.Pointer<ffi.Size>)>();
+
+  void quiver_free_string_flat(
+    ffi.Pointer<ffi.Pointer<ffi.Char>> values,
+    ffi.Pointer<ffi.Size> offsets,
+    int count,
+  ) {
+    return _quiver_free_string_flat(
+      values,
+      offsets,
+      count,
+    );
+  }
+
+  late final _quiver_free_string_flatPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Pointer<ffi.Char>>, ffi.Pointer<ffi.Size>, ffi.Size)>
+      >('quiver_free_string_flat');
+  late final _quiver_free_string_flat = _quiver_free_string_flatPtr
+      .asFunction<void Function(ffi.Pointer<ffi.Pointer<ffi.Char>>, ffi.Pointer<ffi.Size>, int)>();
+
+  void quiver_free_string_arena(
+    ffi.Pointer<ffi.Pointer<ffi.Char>> values,
+  ) {
+    return _quiver_free_string_arena(
+      values,
+    );
+  }
+
+  late final _quiver_free_string_arenaPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Pointer<ffi.Char>>)>>('quiver_free_string_arena');
+  late final _quiver_free_string_arena = _quiver_free_string_arenaPtr
+      .asFunction<void Function(ffi.Pointer<ffi.Pointer<ffi.Char>>)>();
+
+  void quiver_free_string_arena_flat(
+    ffi.Pointer<ffi.Pointer<ffi.Char>> values,
+    ffi.Pointer<ffi.Size> offsets,
+  ) {
+    return _quiver_free_string_arena_flat(
+      values,
+      offsets,
+    );
+  }
+
+  late final _quiver_free_string_arena_flatPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Pointer<ffi.Char>>, ffi.Pointer<ffi.Size>)>>(
+        'quiver_free_string_arena_flat',
+      );
+  late final _quiver_free_string_arena_flat = _quiver_free_string_arena_flatPtr
+      .asFunction<void Function(ffi.Pointer<ffi.Pointer<ffi.Char>>, ffi.Pointer<ffi.Size>)>();
+
+  void quiver_free_time_series_floats(
+    ffi.Pointer<ffi.Pointer<ffi.Char>> date_times,
+    ffi.Pointer<ffi.Double> values,
+    int count,
+  ) {
+    return _quiver_free_time_series_floats(
+      date_times,
+      values,
+      count,
+    );
+  }
+
+  late final _quiver_free_time_series_floatsPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Pointer<ffi.Char>>, ffi.Pointer<ffi.Double>, ffi.Size)>
+      >('quiver_free_time_series_floats');
+  late final _quiver_free_time_series_floats = _quiver_free_time_series_floatsPtr
+      .asFunction<void Function(ffi.Pointer<ffi.Pointer<ffi.Char>>, ffi.Pointer<ffi.Double>, int)>();
+
+  void quiver_free_scalar_columns(
+    ffi.Pointer<ffi.Int64> ids,
+    ffi.Pointer<quiver_scalar_column_t> columns,
+    int column_count,
+    int count,
+  ) {
+    return _quiver_free_scalar_columns(
+      ids,
+      columns,
+      column_count,
+      count,
+    );
+  }
+
+  late final _quiver_free_scalar_columnsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(ffi.Pointer<ffi.Int64>, ffi.Pointer<quiver_scalar_column_t>, ffi.Size, ffi.Size)
+        >
+      >('quiver_free_scalar_columns');
+  late final _quiver_free_scalar_columns = _quiver_free_scalar_columnsPtr
+      .asFunction<void Function(ffi.Pointer<ffi.Int64>, ffi.Pointer<quiver_scalar_column_t>, int, int)>();
+
+  int quiver_database_export_to_csv(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> table,
+    ffi.Pointer<ffi.Char> path,
+  ) {
+    return _quiver_database_export_to_csv(
+      db,
+      table,
+      path,
+    );
+  }
+
+  late final _quiver_database_export_to_csvPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>)
+        >
+      >('quiver_database_export_to_csv');
+  late final _quiver_database_export_to_csv = _quiver_database_export_to_csvPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>)>();
+
+  int quiver_database_import_from_csv(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> table,
+    ffi.Pointer<ffi.Char> path,
+  ) {
+    return _quiver_database_import_from_csv(
+      db,
+      table,
+      path,
+    );
+  }
+
+  late final _quiver_database_import_from_csvPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>)
+        >
+      >('quiver_database_import_from_csv');
+  late final _quiver_database_import_from_csv = _quiver_database_import_from_csvPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>)>();
+
+  int quiver_database_export_collection(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> directory,
+  ) {
+    return _quiver_database_export_collection(
+      db,
+      collection,
+      directory,
+    );
+  }
+
+  late final _quiver_database_export_collectionPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>)
+        >
+      >('quiver_database_export_collection');
+  late final _quiver_database_export_collection = _quiver_database_export_collectionPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>)>();
+
+  int quiver_database_import_collection(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> directory,
+  ) {
+    return _quiver_database_import_collection(
+      db,
+      collection,
+      directory,
+    );
+  }
+
+  late final _quiver_database_import_collectionPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>)
+        >
+      >('quiver_database_import_collection');
+  late final _quiver_database_import_collection = _quiver_database_import_collectionPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>)>();
+
+  int quiver_database_query_string(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> sql,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_database_query_string(
+      db,
+      sql,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_database_query_stringPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Pointer<ffi.Int>,
+          )
+        >
+      >('quiver_database_query_string');
+  late final _quiver_database_query_string = _quiver_database_query_stringPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          ffi.Pointer<ffi.Int>,
+        )
+      >();
+
+  int quiver_database_query_integer(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> sql,
+    ffi.Pointer<ffi.Int64> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_database_query_integer(
+      db,
+      sql,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_database_query_integerPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Pointer<ffi.Int>,
+          )
+        >
+      >('quiver_database_query_integer');
+  late final _quiver_database_query_integer = _quiver_database_query_integerPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
+          ffi.Pointer<ffi.Int>,
+        )
+      >();
+
+  int quiver_database_query_float(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> sql,
+    ffi.Pointer<ffi.Double> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_database_query_float(
+      db,
+      sql,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_database_query_floatPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Double>,
+            ffi.Pointer<ffi.Int>,
+          )
+        >
+      >('quiver_database_query_float');
+  late final _quiver_database_query_float = _quiver_database_query_floatPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Double>,
+          ffi.Pointer<ffi.Int>,
+        )
+      >();
+
+  int quiver_database_query_string_params(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> sql,
+    ffi.Pointer<ffi.Int> param_types,
+    ffi.Pointer<ffi.Pointer<ffi.Void>> param_values,
+    int param_count,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_database_query_string_params(
+      db,
+      sql,
+      param_types,
+      param_values,
+      param_count,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_database_query_string_paramsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Pointer<ffi.Void>>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Pointer<ffi.Int>,
+          )
+        >
+      >('quiver_database_query_string_params');
+  late final _quiver_database_query_string_params = _quiver_database_query_string_paramsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Pointer<ffi.Void>>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          ffi.Pointer<ffi.Int>,
+        )
+      >();
+
+  int quiver_database_query_integer_params(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> sql,
+    ffi.Pointer<ffi.Int> param_types,
+    ffi.Pointer<ffi.Pointer<ffi.Void>> param_values,
+    int param_count,
+    ffi.Pointer<ffi.Int64> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_database_query_integer_params(
+      db,
+      sql,
+      param_types,
+      param_values,
+      param_count,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_database_query_integer_paramsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Pointer<ffi.Void>>,
+            ffi.Size,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Pointer<ffi.Int>,
+          )
+        >
+      >('quiver_database_query_integer_params');
+  late final _quiver_database_query_integer_params = _quiver_database_query_integer_paramsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Pointer<ffi.Void>>,
+          int,
+          ffi.Pointer<ffi.Int64>,
+          ffi.Pointer<ffi.Int>,
+        )
+      >();
+
+  int quiver_database_query_float_params(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> sql,
+    ffi.Pointer<ffi.Int> param_types,
+    ffi.Pointer<ffi.Pointer<ffi.Void>> param_values,
+    int param_count,
+    ffi.Pointer<ffi.Double> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_database_query_float_params(
       db,
+      sql,
+      param_types,
+      param_values,
+      param_count,
+      out_value,
+      out_has_value,
     );
   }
 
-  late final _quiver_database_current_versionPtr =
-      _lookup<ffi.NativeFunction<ffi.Int64 Function(ffi.Pointer<quiver_database_t>)>>(
-        'quiver_database_current_version',
-      );
-  late final _quiver_database_current_version = _quiver_database_current_versionPtr
+  late final _quiver_database_query_float_paramsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Pointer<ffi.Void>>,
+            ffi.Size,
+            ffi.Pointer<ffi.Double>,
+            ffi.Pointer<ffi.Int>,
+          )
+        >
+      >('quiver_database_query_float_params');
+  late final _quiver_database_query_float_params = _quiver_database_query_float_paramsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Pointer<ffi.Void>>,
+          int,
+          ffi.Pointer<ffi.Double>,
+          ffi.Pointer<ffi.Int>,
+        )
+      >();
+
+  int quiver_database_describe(
+    ffi.Pointer<quiver_database_t> db,
+  ) {
+    return _quiver_database_describe(
+      db,
+    );
+  }
+
+  late final _quiver_database_describePtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>)>>('quiver_database_describe');
+  late final _quiver_database_describe = _quiver_database_describePtr
       .asFunction<int Function(ffi.Pointer<quiver_database_t>)>();
 
-  int quiver_database_create_element(
+  int quiver_database_create_missing_indexes(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<quiver_element_t> element,
+    ffi.Pointer<ffi.Size> out_created,
   ) {
-    return _quiver_database_create_element(
+    return _quiver_database_create_missing_indexes(
       db,
-      collection,
-      element,
+      out_created,
     );
   }
 
-  late final _quiver_database_create_elementPtr =
-      _lookup<
-        ffi.NativeFunction<
-          ffi.Int64 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<quiver_element_t>)
-        >
-      >('quiver_database_create_element');
-  late final _quiver_database_create_element = _quiver_database_create_elementPtr
-      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<quiver_element_t>)>();
+  late final _quiver_database_create_missing_indexesPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Size>)>>(
+        'quiver_database_create_missing_indexes',
+      );
+  late final _quiver_database_create_missing_indexes = _quiver_database_create_missing_indexesPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Size>)>();
 
-  int quiver_database_update_element(
+  int quiver_database_attribute_handle(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
-    int id,
-    ffi.Pointer<quiver_element_t> element,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<quiver_attribute_handle_t>> out_handle,
   ) {
-    return _quiver_database_update_element(
+    return _quiver_database_attribute_handle(
       db,
       collection,
-      id,
-      element,
+      attribute,
+      out_handle,
     );
   }
 
-  late final _quiver_database_update_elementPtr =
+  late final _quiver_database_attribute_handlePtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<quiver_element_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<quiver_attribute_handle_t>>,
           )
         >
-      >('quiver_database_update_element');
-  late final _quiver_database_update_element = _quiver_database_update_elementPtr
+      >('quiver_database_attribute_handle');
+  late final _quiver_database_attribute_handle = _quiver_database_attribute_handlePtr
       .asFunction<
-        int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, int, ffi.Pointer<quiver_element_t>)
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<quiver_attribute_handle_t>>,
+        )
       >();
 
-  int quiver_database_delete_element_by_id(
-    ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    int id,
+  void quiver_attribute_handle_free(
+    ffi.Pointer<quiver_attribute_handle_t> handle,
   ) {
-    return _quiver_database_delete_element_by_id(
-      db,
-      collection,
-      id,
+    return _quiver_attribute_handle_free(
+      handle,
     );
   }
 
-  late final _quiver_database_delete_element_by_idPtr =
-      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Int64)>>(
-        'quiver_database_delete_element_by_id',
+  late final _quiver_attribute_handle_freePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_attribute_handle_t>)>>(
+        'quiver_attribute_handle_free',
       );
-  late final _quiver_database_delete_element_by_id = _quiver_database_delete_element_by_idPtr
-      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, int)>();
+  late final _quiver_attribute_handle_free = _quiver_attribute_handle_freePtr
+      .asFunction<void Function(ffi.Pointer<quiver_attribute_handle_t>)>();
 
-  int quiver_database_set_scalar_relation(
+  int quiver_attribute_handle_info(
+    ffi.Pointer<quiver_attribute_handle_t> handle,
+    ffi.Pointer<ffi.Int32> out_structure,
+    ffi.Pointer<ffi.Int32> out_type,
+  ) {
+    return _quiver_attribute_handle_info(
+      handle,
+      out_structure,
+      out_type,
+    );
+  }
+
+  late final _quiver_attribute_handle_infoPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_attribute_handle_t>, ffi.Pointer<ffi.Int32>, ffi.Pointer<ffi.Int32>)
+        >
+      >('quiver_attribute_handle_info');
+  late final _quiver_attribute_handle_info = _quiver_attribute_handle_infoPtr
+      .asFunction<
+        int Function(ffi.Pointer<quiver_attribute_handle_t>, ffi.Pointer<ffi.Int32>, ffi.Pointer<ffi.Int32>)
+      >();
+
+  int quiver_database_read_scalar_integer_by_handle(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    ffi.Pointer<ffi.Char> from_label,
-    ffi.Pointer<ffi.Char> to_label,
+    ffi.Pointer<quiver_attribute_handle_t> handle,
+    int id,
+    ffi.Pointer<ffi.Int64> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
   ) {
-    return _quiver_database_set_scalar_relation(
+    return _quiver_database_read_scalar_integer_by_handle(
       db,
-      collection,
-      attribute,
-      from_label,
-      to_label,
+      handle,
+      id,
+      out_value,
+      out_has_value,
     );
   }
 
-  late final _quiver_database_set_scalar_relationPtr =
+  late final _quiver_database_read_scalar_integer_by_handlePtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_attribute_handle_t>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Pointer<ffi.Int>,
           )
         >
-      >('quiver_database_set_scalar_relation');
-  late final _quiver_database_set_scalar_relation = _quiver_database_set_scalar_relationPtr
+      >('quiver_database_read_scalar_integer_by_handle');
+  late final _quiver_database_read_scalar_integer_by_handle = _quiver_database_read_scalar_integer_by_handlePtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_attribute_handle_t>,
+          int,
+          ffi.Pointer<ffi.Int64>,
+          ffi.Pointer<ffi.Int>,
         )
       >();
 
-  int quiver_database_read_scalar_relation(
+  int quiver_database_read_scalar_float_by_handle(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<quiver_attribute_handle_t> handle,
+    int id,
+    ffi.Pointer<ffi.Double> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
   ) {
-    return _quiver_database_read_scalar_relation(
+    return _quiver_database_read_scalar_float_by_handle(
       db,
-      collection,
-      attribute,
-      out_values,
-      out_count,
+      handle,
+      id,
+      out_value,
+      out_has_value,
     );
   }
 
-  late final _quiver_database_read_scalar_relationPtr =
+  late final _quiver_database_read_scalar_float_by_handlePtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
-            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<quiver_attribute_handle_t>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Double>,
+            ffi.Pointer<ffi.Int>,
           )
         >
-      >('quiver_database_read_scalar_relation');
-  late final _quiver_database_read_scalar_relation = _quiver_database_read_scalar_relationPtr
+      >('quiver_database_read_scalar_float_by_handle');
+  late final _quiver_database_read_scalar_float_by_handle = _quiver_database_read_scalar_float_by_handlePtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
-          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<quiver_attribute_handle_t>,
+          int,
+          ffi.Pointer<ffi.Double>,
+          ffi.Pointer<ffi.Int>,
         )
       >();
 
-  int quiver_database_read_scalar_integers(
+  int quiver_database_read_scalar_string_by_handle(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<quiver_attribute_handle_t> handle,
+    int id,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
   ) {
-    return _quiver_database_read_scalar_integers(
+    return _quiver_database_read_scalar_string_by_handle(
       db,
-      collection,
-      attribute,
-      out_values,
-      out_count,
+      handle,
+      id,
+      out_value,
+      out_has_value,
     );
   }
 
-  late final _quiver_database_read_scalar_integersPtr =
+  late final _quiver_database_read_scalar_string_by_handlePtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
-            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<quiver_attribute_handle_t>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Pointer<ffi.Int>,
           )
         >
-      >('quiver_database_read_scalar_integers');
-  late final _quiver_database_read_scalar_integers = _quiver_database_read_scalar_integersPtr
+      >('quiver_database_read_scalar_string_by_handle');
+  late final _quiver_database_read_scalar_string_by_handle = _quiver_database_read_scalar_string_by_handlePtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
-          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<quiver_attribute_handle_t>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          ffi.Pointer<ffi.Int>,
         )
       >();
 
-  int quiver_database_read_scalar_floats(
+  int quiver_database_read_vector_integers_by_handle(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<quiver_attribute_handle_t> handle,
+    int id,
+    ffi.Pointer<ffi.Int64> buffer,
+    int capacity,
     ffi.Pointer<ffi.Size> out_count,
   ) {
-    return _quiver_database_read_scalar_floats(
+    return _quiver_database_read_vector_integers_by_handle(
       db,
-      collection,
-      attribute,
-      out_values,
+      handle,
+      id,
+      buffer,
+      capacity,
       out_count,
     );
   }
 
-  late final _quiver_database_read_scalar_floatsPtr =
+  late final _quiver_database_read_vector_integers_by_handlePtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<quiver_attribute_handle_t>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
             ffi.Pointer<ffi.Size>,
           )
         >
-      >('quiver_database_read_scalar_floats');
-  late final _quiver_database_read_scalar_floats = _quiver_database_read_scalar_floatsPtr
+      >('quiver_database_read_vector_integers_by_handle');
+  late final _quiver_database_read_vector_integers_by_handle = _quiver_database_read_vector_integers_by_handlePtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<quiver_attribute_handle_t>,
+          int,
+          ffi.Pointer<ffi.Int64>,
+          int,
           ffi.Pointer<ffi.Size>,
         )
       >();
 
-  int quiver_database_read_scalar_strings(
+  int quiver_database_read_vector_floats_by_handle(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<quiver_attribute_handle_t> handle,
+    int id,
+    ffi.Pointer<ffi.Double> buffer,
+    int capacity,
     ffi.Pointer<ffi.Size> out_count,
   ) {
-    return _quiver_database_read_scalar_strings(
+    return _quiver_database_read_vector_floats_by_handle(
       db,
-      collection,
-      attribute,
-      out_values,
+      handle,
+      id,
+      buffer,
+      capacity,
       out_count,
     );
   }
 
-  late final _quiver_database_read_scalar_stringsPtr =
+  late final _quiver_database_read_vector_floats_by_handlePtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<quiver_attribute_handle_t>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Double>,
+            ffi.Size,
             ffi.Pointer<ffi.Size>,
           )
         >
-      >('quiver_database_read_scalar_strings');
-  late final _quiver_database_read_scalar_strings = _quiver_database_read_scalar_stringsPtr
+      >('quiver_database_read_vector_floats_by_handle');
+  late final _quiver_database_read_vector_floats_by_handle = _quiver_database_read_vector_floats_by_handlePtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<quiver_attribute_handle_t>,
+          int,
+          ffi.Pointer<ffi.Double>,
+          int,
           ffi.Pointer<ffi.Size>,
         )
       >();
 
-  int quiver_database_read_vector_integers(
+  int quiver_database_update_scalar_integer_by_handle(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Int64>>> out_vectors,
-    ffi.Pointer<ffi.Pointer<ffi.Size>> out_sizes,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<quiver_attribute_handle_t> handle,
+    int id,
+    int value,
   ) {
-    return _quiver_database_read_vector_integers(
+    return _quiver_database_update_scalar_integer_by_handle(
       db,
-      collection,
-      attribute,
-      out_vectors,
-      out_sizes,
-      out_count,
+      handle,
+      id,
+      value,
     );
   }
 
-  late final _quiver_database_read_vector_integersPtr =
+  late final _quiver_database_update_scalar_integer_by_handlePtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Int64>>>,
-            ffi.Pointer<ffi.Pointer<ffi.Size>>,
-            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<quiver_attribute_handle_t>,
+            ffi.Int64,
+            ffi.Int64,
           )
         >
-      >('quiver_database_read_vector_integers');
-  late final _quiver_database_read_vector_integers = _quiver_database_read_vector_integersPtr
-      .asFunction<
-        int Function(
-          ffi.Pointer<quiver_database_t>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Int64>>>,
-          ffi.Pointer<ffi.Pointer<ffi.Size>>,
-          ffi.Pointer<ffi.Size>,
-        )
-      >();
+      >('quiver_database_update_scalar_integer_by_handle');
+  late final _quiver_database_update_scalar_integer_by_handle = _quiver_database_update_scalar_integer_by_handlePtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<quiver_attribute_handle_t>, int, int)>();
 
-  int quiver_database_read_vector_floats(
+  int quiver_database_update_scalar_float_by_handle(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Double>>> out_vectors,
-    ffi.Pointer<ffi.Pointer<ffi.Size>> out_sizes,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<quiver_attribute_handle_t> handle,
+    int id,
+    double value,
   ) {
-    return _quiver_database_read_vector_floats(
+    return _quiver_database_update_scalar_float_by_handle(
       db,
-      collection,
-      attribute,
-      out_vectors,
-      out_sizes,
-      out_count,
+      handle,
+      id,
+      value,
     );
   }
 
-  late final _quiver_database_read_vector_floatsPtr =
+  late final _quiver_database_update_scalar_float_by_handlePtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Double>>>,
-            ffi.Pointer<ffi.Pointer<ffi.Size>>,
-            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<quiver_attribute_handle_t>,
+            ffi.Int64,
+            ffi.Double,
           )
         >
-      >('quiver_database_read_vector_floats');
-  late final _quiver_database_read_vector_floats = _quiver_database_read_vector_floatsPtr
-      .asFunction<
-        int Function(
-          ffi.Pointer<quiver_database_t>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Double>>>,
-          ffi.Pointer<ffi.Pointer<ffi.Size>>,
-          ffi.Pointer<ffi.Size>,
-        )
-      >();
+      >('quiver_database_update_scalar_float_by_handle');
+  late final _quiver_database_update_scalar_float_by_handle = _quiver_database_update_scalar_float_by_handlePtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<quiver_attribute_handle_t>, int, double)>();
 
-  int quiver_database_read_vector_strings(
+  int quiver_database_update_scalar_string_by_handle(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>> out_vectors,
-    ffi.Pointer<ffi.Pointer<ffi.Size>> out_sizes,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<quiver_attribute_handle_t> handle,
+    int id,
+    ffi.Pointer<ffi.Char> value,
   ) {
-    return _quiver_database_read_vector_strings(
+    return _quiver_database_update_scalar_string_by_handle(
       db,
-      collection,
-      attribute,
-      out_vectors,
-      out_sizes,
-      out_count,
+      handle,
+      id,
+      value,
     );
   }
 
-  late final _quiver_database_read_vector_stringsPtr =
+  late final _quiver_database_update_scalar_string_by_handlePtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<quiver_attribute_handle_t>,
+            ffi.Int64,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>>,
-            ffi.Pointer<ffi.Pointer<ffi.Size>>,
-            ffi.Pointer<ffi.Size>,
           )
         >
-      >('quiver_database_read_vector_strings');
-  late final _quiver_database_read_vector_strings = _quiver_database_read_vector_stringsPtr
+      >('quiver_database_update_scalar_string_by_handle');
+  late final _quiver_database_update_scalar_string_by_handle = _quiver_database_update_scalar_string_by_handlePtr
       .asFunction<
-        int Function(
-          ffi.Pointer<quiver_database_t>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>>,
-          ffi.Pointer<ffi.Pointer<ffi.Size>>,
-          ffi.Pointer<ffi.Size>,
-        )
+        int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<quiver_attribute_handle_t>, int, ffi.Pointer<ffi.Char>)
       >();
 
-  int quiver_database_read_set_integers(
+  int quiver_database_open_cursor(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Int64>>> out_sets,
-    ffi.Pointer<ffi.Pointer<ffi.Size>> out_sizes,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<ffi.Char> sql,
+    ffi.Pointer<ffi.Int> param_types,
+    ffi.Pointer<ffi.Pointer<ffi.Void>> param_values,
+    int param_count,
+    ffi.Pointer<ffi.Pointer<quiver_cursor_t>> out_cursor,
   ) {
-    return _quiver_database_read_set_integers(
+    return _quiver_database_open_cursor(
       db,
-      collection,
-      attribute,
-      out_sets,
-      out_sizes,
-      out_count,
+      sql,
+      param_types,
+      param_values,
+      param_count,
+      out_cursor,
     );
   }
 
-  late final _quiver_database_read_set_integersPtr =
+  late final _quiver_database_open_cursorPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Int64>>>,
-            ffi.Pointer<ffi.Pointer<ffi.Size>>,
-            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Pointer<ffi.Void>>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<quiver_cursor_t>>,
           )
         >
-      >('quiver_database_read_set_integers');
-  late final _quiver_database_read_set_integers = _quiver_database_read_set_integersPtr
+      >('quiver_database_open_cursor');
+  late final _quiver_database_open_cursor = _quiver_database_open_cursorPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Int64>>>,
-          ffi.Pointer<ffi.Pointer<ffi.Size>>,
-          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Pointer<ffi.Void>>,
+          int,
+          ffi.Pointer<ffi.Pointer<quiver_cursor_t>>,
         )
       >();
 
-  int quiver_database_read_set_floats(
+  int quiver_database_open_scalars_cursor(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Double>>> out_sets,
-    ffi.Pointer<ffi.Pointer<ffi.Size>> out_sizes,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> attributes,
+    int attribute_count,
+    ffi.Pointer<ffi.Pointer<quiver_cursor_t>> out_cursor,
   ) {
-    return _quiver_database_read_set_floats(
+    return _quiver_database_open_scalars_cursor(
       db,
       collection,
-      attribute,
-      out_sets,
-      out_sizes,
-      out_count,
+      attributes,
+      attribute_count,
+      out_cursor,
     );
   }
 
-  late final _quiver_database_read_set_floatsPtr =
+  late final _quiver_database_open_scalars_cursorPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Double>>>,
-            ffi.Pointer<ffi.Pointer<ffi.Size>>,
-            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<quiver_cursor_t>>,
           )
         >
-      >('quiver_database_read_set_floats');
-  late final _quiver_database_read_set_floats = _quiver_database_read_set_floatsPtr
+      >('quiver_database_open_scalars_cursor');
+  late final _quiver_database_open_scalars_cursor = _quiver_database_open_scalars_cursorPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Double>>>,
-          ffi.Pointer<ffi.Pointer<ffi.Size>>,
-          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          int,
+          ffi.Pointer<ffi.Pointer<quiver_cursor_t>>,
         )
       >();
 
-  int quiver_database_read_set_strings(
+  int quiver_database_open_vector_cursor(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
     ffi.Pointer<ffi.Char> attribute,
-    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>> out_sets,
-    ffi.Pointer<ffi.Pointer<ffi.Size>> out_sizes,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<ffi.Pointer<quiver_cursor_t>> out_cursor,
   ) {
-    return _quiver_database_read_set_strings(
+    return _quiver_database_open_vector_cursor(
       db,
       collection,
       attribute,
-      out_sets,
-      out_sizes,
-      out_count,
+      out_cursor,
     );
   }
 
-  late final _quiver_database_read_set_stringsPtr =
+  late final _quiver_database_open_vector_cursorPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>>,
-            ffi.Pointer<ffi.Pointer<ffi.Size>>,
-            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<ffi.Pointer<quiver_cursor_t>>,
           )
         >
-      >('quiver_database_read_set_strings');
-  late final _quiver_database_read_set_strings = _quiver_database_read_set_stringsPtr
+      >('quiver_database_open_vector_cursor');
+  late final _quiver_database_open_vector_cursor = _quiver_database_open_vector_cursorPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>>,
-          ffi.Pointer<ffi.Pointer<ffi.Size>>,
-          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<ffi.Pointer<quiver_cursor_t>>,
         )
       >();
 
-  int quiver_database_read_scalar_integers_by_id(
-    ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    int id,
+  void quiver_cursor_free(
+    ffi.Pointer<quiver_cursor_t> cursor,
+  ) {
+    return _quiver_cursor_free(
+      cursor,
+    );
+  }
+
+  late final _quiver_cursor_freePtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_cursor_t>)>>(
+    'quiver_cursor_free',
+  );
+  late final _quiver_cursor_free = _quiver_cursor_freePtr.asFunction<void Function(ffi.Pointer<quiver_cursor_t>)>();
+
+  int quiver_cursor_next(
+    ffi.Pointer<quiver_cursor_t> cursor,
+    ffi.Pointer<ffi.Int> out_has_row,
+  ) {
+    return _quiver_cursor_next(
+      cursor,
+      out_has_row,
+    );
+  }
+
+  late final _quiver_cursor_nextPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_cursor_t>, ffi.Pointer<ffi.Int>)>>(
+        'quiver_cursor_next',
+      );
+  late final _quiver_cursor_next = _quiver_cursor_nextPtr
+      .asFunction<int Function(ffi.Pointer<quiver_cursor_t>, ffi.Pointer<ffi.Int>)>();
+
+  int quiver_cursor_column_count(
+    ffi.Pointer<quiver_cursor_t> cursor,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_cursor_column_count(
+      cursor,
+      out_count,
+    );
+  }
+
+  late final _quiver_cursor_column_countPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_cursor_t>, ffi.Pointer<ffi.Size>)>>(
+        'quiver_cursor_column_count',
+      );
+  late final _quiver_cursor_column_count = _quiver_cursor_column_countPtr
+      .asFunction<int Function(ffi.Pointer<quiver_cursor_t>, ffi.Pointer<ffi.Size>)>();
+
+  int quiver_cursor_column_name(
+    ffi.Pointer<quiver_cursor_t> cursor,
+    int column,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> out_name,
+  ) {
+    return _quiver_cursor_column_name(
+      cursor,
+      column,
+      out_name,
+    );
+  }
+
+  late final _quiver_cursor_column_namePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_cursor_t>, ffi.Size, ffi.Pointer<ffi.Pointer<ffi.Char>>)
+        >
+      >('quiver_cursor_column_name');
+  late final _quiver_cursor_column_name = _quiver_cursor_column_namePtr
+      .asFunction<int Function(ffi.Pointer<quiver_cursor_t>, int, ffi.Pointer<ffi.Pointer<ffi.Char>>)>();
+
+  int quiver_cursor_column_type(
+    ffi.Pointer<quiver_cursor_t> cursor,
+    int column,
+    ffi.Pointer<ffi.Int32> out_type,
+  ) {
+    return _quiver_cursor_column_type(
+      cursor,
+      column,
+      out_type,
+    );
+  }
+
+  late final _quiver_cursor_column_typePtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_cursor_t>, ffi.Size, ffi.Pointer<ffi.Int32>)>>(
+        'quiver_cursor_column_type',
+      );
+  late final _quiver_cursor_column_type = _quiver_cursor_column_typePtr
+      .asFunction<int Function(ffi.Pointer<quiver_cursor_t>, int, ffi.Pointer<ffi.Int32>)>();
+
+  int quiver_cursor_get_integer(
+    ffi.Pointer<quiver_cursor_t> cursor,
+    int column,
     ffi.Pointer<ffi.Int64> out_value,
     ffi.Pointer<ffi.Int> out_has_value,
   ) {
-    return _quiver_database_read_scalar_integers_by_id(
-      db,
-      collection,
-      attribute,
-      id,
+    return _quiver_cursor_get_integer(
+      cursor,
+      column,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_cursor_get_integerPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_cursor_t>, ffi.Size, ffi.Pointer<ffi.Int64>, ffi.Pointer<ffi.Int>)
+        >
+      >('quiver_cursor_get_integer');
+  late final _quiver_cursor_get_integer = _quiver_cursor_get_integerPtr
+      .asFunction<int Function(ffi.Pointer<quiver_cursor_t>, int, ffi.Pointer<ffi.Int64>, ffi.Pointer<ffi.Int>)>();
+
+  int quiver_cursor_get_float(
+    ffi.Pointer<quiver_cursor_t> cursor,
+    int column,
+    ffi.Pointer<ffi.Double> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_cursor_get_float(
+      cursor,
+      column,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_cursor_get_floatPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_cursor_t>, ffi.Size, ffi.Pointer<ffi.Double>, ffi.Pointer<ffi.Int>)
+        >
+      >('quiver_cursor_get_float');
+  late final _quiver_cursor_get_float = _quiver_cursor_get_floatPtr
+      .asFunction<int Function(ffi.Pointer<quiver_cursor_t>, int, ffi.Pointer<ffi.Double>, ffi.Pointer<ffi.Int>)>();
+
+  int quiver_cursor_get_string(
+    ffi.Pointer<quiver_cursor_t> cursor,
+    int column,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_cursor_get_string(
+      cursor,
+      column,
       out_value,
       out_has_value,
     );
   }
 
-  late final _quiver_database_read_scalar_integers_by_idPtr =
+  late final _quiver_cursor_get_stringPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
-            ffi.Pointer<quiver_database_t>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Int64>,
+            ffi.Pointer<quiver_cursor_t>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
             ffi.Pointer<ffi.Int>,
           )
         >
-      >('quiver_database_read_scalar_integers_by_id');
-  late final _quiver_database_read_scalar_integers_by_id = _quiver_database_read_scalar_integers_by_idPtr
+      >('quiver_cursor_get_string');
+  late final _quiver_cursor_get_string = _quiver_cursor_get_stringPtr
       .asFunction<
-        int Function(
-          ffi.Pointer<quiver_database_t>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
-          int,
-          ffi.Pointer<ffi.Int64>,
-          ffi.Pointer<ffi.Int>,
-        )
+        int Function(ffi.Pointer<quiver_cursor_t>, int, ffi.Pointer<ffi.Pointer<ffi.Char>>, ffi.Pointer<ffi.Int>)
       >();
 
-  int quiver_database_read_scalar_floats_by_id(
-    ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    int id,
-    ffi.Pointer<ffi.Double> out_value,
+  int quiver_cursor_get_blob(
+    ffi.Pointer<quiver_cursor_t> cursor,
+    int column,
+    ffi.Pointer<ffi.Pointer<ffi.Uint8>> out_data,
+    ffi.Pointer<ffi.Size> out_size,
     ffi.Pointer<ffi.Int> out_has_value,
   ) {
-    return _quiver_database_read_scalar_floats_by_id(
-      db,
-      collection,
-      attribute,
-      id,
-      out_value,
+    return _quiver_cursor_get_blob(
+      cursor,
+      column,
+      out_data,
+      out_size,
       out_has_value,
     );
   }
 
-  late final _quiver_database_read_scalar_floats_by_idPtr =
+  late final _quiver_cursor_get_blobPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
-            ffi.Pointer<quiver_database_t>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Double>,
+            ffi.Pointer<quiver_cursor_t>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+            ffi.Pointer<ffi.Size>,
             ffi.Pointer<ffi.Int>,
           )
         >
-      >('quiver_database_read_scalar_floats_by_id');
-  late final _quiver_database_read_scalar_floats_by_id = _quiver_database_read_scalar_floats_by_idPtr
+      >('quiver_cursor_get_blob');
+  late final _quiver_cursor_get_blob = _quiver_cursor_get_blobPtr
       .asFunction<
         int Function(
-          ffi.Pointer<quiver_database_t>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_cursor_t>,
           int,
-          ffi.Pointer<ffi.Double>,
+          ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+          ffi.Pointer<ffi.Size>,
           ffi.Pointer<ffi.Int>,
         )
       >();
 
-  int quiver_database_read_scalar_strings_by_id(
+  void quiver_blob_free(
+    ffi.Pointer<ffi.Uint8> data,
+  ) {
+    return _quiver_blob_free(
+      data,
+    );
+  }
+
+  late final _quiver_blob_freePtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Uint8>)>>(
+    'quiver_blob_free',
+  );
+  late final _quiver_blob_free = _quiver_blob_freePtr.asFunction<void Function(ffi.Pointer<ffi.Uint8>)>();
+
+  int quiver_database_read_scalar_integers_result(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
     ffi.Pointer<ffi.Char> attribute,
-    int id,
-    ffi.Pointer<ffi.Pointer<ffi.Char>> out_value,
-    ffi.Pointer<ffi.Int> out_has_value,
+    ffi.Pointer<ffi.Pointer<quiver_result_t>> out_result,
   ) {
-    return _quiver_database_read_scalar_strings_by_id(
+    return _quiver_database_read_scalar_integers_result(
       db,
       collection,
       attribute,
-      id,
-      out_value,
-      out_has_value,
+      out_result,
     );
   }
 
-  late final _quiver_database_read_scalar_strings_by_idPtr =
+  late final _quiver_database_read_scalar_integers_resultPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Pointer<ffi.Char>>,
-            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Pointer<quiver_result_t>>,
           )
         >
-      >('quiver_database_read_scalar_strings_by_id');
-  late final _quiver_database_read_scalar_strings_by_id = _quiver_database_read_scalar_strings_by_idPtr
+      >('quiver_database_read_scalar_integers_result');
+  late final _quiver_database_read_scalar_integers_result = _quiver_database_read_scalar_integers_resultPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          int,
-          ffi.Pointer<ffi.Pointer<ffi.Char>>,
-          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Pointer<quiver_result_t>>,
         )
       >();
 
-  int quiver_database_read_vector_integers_by_id(
+  int quiver_database_read_scalar_floats_result(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
     ffi.Pointer<ffi.Char> attribute,
-    int id,
-    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<ffi.Pointer<quiver_result_t>> out_result,
   ) {
-    return _quiver_database_read_vector_integers_by_id(
+    return _quiver_database_read_scalar_floats_result(
       db,
       collection,
       attribute,
-      id,
-      out_values,
-      out_count,
+      out_result,
     );
   }
 
-  late final _quiver_database_read_vector_integers_by_idPtr =
+  late final _quiver_database_read_scalar_floats_resultPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
-            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<ffi.Pointer<quiver_result_t>>,
           )
         >
-      >('quiver_database_read_vector_integers_by_id');
-  late final _quiver_database_read_vector_integers_by_id = _quiver_database_read_vector_integers_by_idPtr
+      >('quiver_database_read_scalar_floats_result');
+  late final _quiver_database_read_scalar_floats_result = _quiver_database_read_scalar_floats_resultPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          int,
-          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
-          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<ffi.Pointer<quiver_result_t>>,
         )
       >();
 
-  int quiver_database_read_vector_floats_by_id(
+  int quiver_database_read_scalar_strings_result(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
     ffi.Pointer<ffi.Char> attribute,
-    int id,
-    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<ffi.Pointer<quiver_result_t>> out_result,
   ) {
-    return _quiver_database_read_vector_floats_by_id(
+    return _quiver_database_read_scalar_strings_result(
       db,
       collection,
       attribute,
-      id,
-      out_values,
-      out_count,
+      out_result,
     );
   }
 
-  late final _quiver_database_read_vector_floats_by_idPtr =
+  late final _quiver_database_read_scalar_strings_resultPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Pointer<ffi.Double>>,
-            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<ffi.Pointer<quiver_result_t>>,
           )
         >
-      >('quiver_database_read_vector_floats_by_id');
-  late final _quiver_database_read_vector_floats_by_id = _quiver_database_read_vector_floats_by_idPtr
+      >('quiver_database_read_scalar_strings_result');
+  late final _quiver_database_read_scalar_strings_result = _quiver_database_read_scalar_strings_resultPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          int,
-          ffi.Pointer<ffi.Pointer<ffi.Double>>,
-          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<ffi.Pointer<quiver_result_t>>,
         )
       >();
 
-  int quiver_database_read_vector_strings_by_id(
+  void quiver_result_free(
+    ffi.Pointer<quiver_result_t> result,
+  ) {
+    return _quiver_result_free(
+      result,
+    );
+  }
+
+  late final _quiver_result_freePtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_result_t>)>>(
+    'quiver_result_free',
+  );
+  late final _quiver_result_free = _quiver_result_freePtr.asFunction<void Function(ffi.Pointer<quiver_result_t>)>();
+
+  int quiver_result_type(
+    ffi.Pointer<quiver_result_t> result,
+    ffi.Pointer<ffi.Int32> out_type,
+  ) {
+    return _quiver_result_type(
+      result,
+      out_type,
+    );
+  }
+
+  late final _quiver_result_typePtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_result_t>, ffi.Pointer<ffi.Int32>)>>(
+        'quiver_result_type',
+      );
+  late final _quiver_result_type = _quiver_result_typePtr
+      .asFunction<int Function(ffi.Pointer<quiver_result_t>, ffi.Pointer<ffi.Int32>)>();
+
+  int quiver_result_count(
+    ffi.Pointer<quiver_result_t> result,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_result_count(
+      result,
+      out_count,
+    );
+  }
+
+  late final _quiver_result_countPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_result_t>, ffi.Pointer<ffi.Size>)>>(
+        'quiver_result_count',
+      );
+  late final _quiver_result_count = _quiver_result_countPtr
+      .asFunction<int Function(ffi.Pointer<quiver_result_t>, ffi.Pointer<ffi.Size>)>();
+
+  int quiver_result_offsets(
+    ffi.Pointer<quiver_result_t> result,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_group_count,
+  ) {
+    return _quiver_result_offsets(
+      result,
+      out_offsets,
+      out_group_count,
+    );
+  }
+
+  late final _quiver_result_offsetsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_result_t>, ffi.Pointer<ffi.Pointer<ffi.Size>>, ffi.Pointer<ffi.Size>)
+        >
+      >('quiver_result_offsets');
+  late final _quiver_result_offsets = _quiver_result_offsetsPtr
+      .asFunction<
+        int Function(ffi.Pointer<quiver_result_t>, ffi.Pointer<ffi.Pointer<ffi.Size>>, ffi.Pointer<ffi.Size>)
+      >();
+
+  int quiver_result_integers(
+    ffi.Pointer<quiver_result_t> result,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+  ) {
+    return _quiver_result_integers(
+      result,
+      out_values,
+    );
+  }
+
+  late final _quiver_result_integersPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_result_t>, ffi.Pointer<ffi.Pointer<ffi.Int64>>)>
+      >('quiver_result_integers');
+  late final _quiver_result_integers = _quiver_result_integersPtr
+      .asFunction<int Function(ffi.Pointer<quiver_result_t>, ffi.Pointer<ffi.Pointer<ffi.Int64>>)>();
+
+  int quiver_result_floats(
+    ffi.Pointer<quiver_result_t> result,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+  ) {
+    return _quiver_result_floats(
+      result,
+      out_values,
+    );
+  }
+
+  late final _quiver_result_floatsPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_result_t>, ffi.Pointer<ffi.Pointer<ffi.Double>>)>
+      >('quiver_result_floats');
+  late final _quiver_result_floats = _quiver_result_floatsPtr
+      .asFunction<int Function(ffi.Pointer<quiver_result_t>, ffi.Pointer<ffi.Pointer<ffi.Double>>)>();
+
+  int quiver_result_strings(
+    ffi.Pointer<quiver_result_t> result,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+  ) {
+    return _quiver_result_strings(
+      result,
+      out_values,
+    );
+  }
+
+  late final _quiver_result_stringsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_result_t>, ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>)
+        >
+      >('quiver_result_strings');
+  late final _quiver_result_strings = _quiver_result_stringsPtr
+      .asFunction<int Function(ffi.Pointer<quiver_result_t>, ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>)>();
+
+  int quiver_database_read_scalar_integers_arrow(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
     ffi.Pointer<ffi.Char> attribute,
-    int id,
-    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<ArrowSchema> out_schema,
+    ffi.Pointer<ArrowArray> out_array,
   ) {
-    return _quiver_database_read_vector_strings_by_id(
+    return _quiver_database_read_scalar_integers_arrow(
       db,
       collection,
       attribute,
-      id,
-      out_values,
-      out_count,
+      out_schema,
+      out_array,
     );
   }
 
-  late final _quiver_database_read_vector_strings_by_idPtr =
+  late final _quiver_database_read_scalar_integers_arrowPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
-            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<ArrowSchema>,
+            ffi.Pointer<ArrowArray>,
           )
         >
-      >('quiver_database_read_vector_strings_by_id');
-  late final _quiver_database_read_vector_strings_by_id = _quiver_database_read_vector_strings_by_idPtr
+      >('quiver_database_read_scalar_integers_arrow');
+  late final _quiver_database_read_scalar_integers_arrow = _quiver_database_read_scalar_integers_arrowPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          int,
-          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
-          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<ArrowSchema>,
+          ffi.Pointer<ArrowArray>,
         )
       >();
 
-  int quiver_database_read_set_integers_by_id(
+  int quiver_database_read_scalar_floats_arrow(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
     ffi.Pointer<ffi.Char> attribute,
-    int id,
-    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<ArrowSchema> out_schema,
+    ffi.Pointer<ArrowArray> out_array,
   ) {
-    return _quiver_database_read_set_integers_by_id(
+    return _quiver_database_read_scalar_floats_arrow(
       db,
       collection,
       attribute,
-      id,
-      out_values,
-      out_count,
+      out_schema,
+      out_array,
     );
   }
 
-  late final _quiver_database_read_set_integers_by_idPtr =
+  late final _quiver_database_read_scalar_floats_arrowPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
-            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<ArrowSchema>,
+            ffi.Pointer<ArrowArray>,
           )
         >
-      >('quiver_database_read_set_integers_by_id');
-  late final _quiver_database_read_set_integers_by_id = _quiver_database_read_set_integers_by_idPtr
+      >('quiver_database_read_scalar_floats_arrow');
+  late final _quiver_database_read_scalar_floats_arrow = _quiver_database_read_scalar_floats_arrowPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          int,
-          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
-          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<ArrowSchema>,
+          ffi.Pointer<ArrowArray>,
         )
       >();
 
-  int quiver_database_read_set_floats_by_id(
+  int quiver_database_read_scalar_strings_arrow(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
     ffi.Pointer<ffi.Char> attribute,
-    int id,
-    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<ArrowSchema> out_schema,
+    ffi.Pointer<ArrowArray> out_array,
   ) {
-    return _quiver_database_read_set_floats_by_id(
+    return _quiver_database_read_scalar_strings_arrow(
       db,
       collection,
       attribute,
-      id,
-      out_values,
-      out_count,
+      out_schema,
+      out_array,
     );
   }
 
-  late final _quiver_database_read_set_floats_by_idPtr =
+  late final _quiver_database_read_scalar_strings_arrowPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Pointer<ffi.Double>>,
-            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<ArrowSchema>,
+            ffi.Pointer<ArrowArray>,
           )
         >
-      >('quiver_database_read_set_floats_by_id');
-  late final _quiver_database_read_set_floats_by_id = _quiver_database_read_set_floats_by_idPtr
+      >('quiver_database_read_scalar_strings_arrow');
+  late final _quiver_database_read_scalar_strings_arrow = _quiver_database_read_scalar_strings_arrowPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          int,
-          ffi.Pointer<ffi.Pointer<ffi.Double>>,
-          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<ArrowSchema>,
+          ffi.Pointer<ArrowArray>,
         )
       >();
 
-  int quiver_database_read_set_strings_by_id(
+  int quiver_database_read_vector_integers_arrow(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
     ffi.Pointer<ffi.Char> attribute,
-    int id,
-    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<ArrowSchema> out_schema,
+    ffi.Pointer<ArrowArray> out_array,
   ) {
-    return _quiver_database_read_set_strings_by_id(
+    return _quiver_database_read_vector_integers_arrow(
       db,
       collection,
       attribute,
-      id,
-      out_values,
-      out_count,
+      out_schema,
+      out_array,
     );
   }
 
-  late final _quiver_database_read_set_strings_by_idPtr =
+  late final _quiver_database_read_vector_integers_arrowPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
-            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<ArrowSchema>,
+            ffi.Pointer<ArrowArray>,
           )
         >
-      >('quiver_database_read_set_strings_by_id');
-  late final _quiver_database_read_set_strings_by_id = _quiver_database_read_set_strings_by_idPtr
+      >('quiver_database_read_vector_integers_arrow');
+  late final _quiver_database_read_vector_integers_arrow = _quiver_database_read_vector_integers_arrowPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          int,
-          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
-          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<ArrowSchema>,
+          ffi.Pointer<ArrowArray>,
         )
       >();
 
-  int quiver_database_read_element_ids(
+  int quiver_database_read_vector_floats_arrow(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_ids,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ArrowSchema> out_schema,
+    ffi.Pointer<ArrowArray> out_array,
   ) {
-    return _quiver_database_read_element_ids(
+    return _quiver_database_read_vector_floats_arrow(
       db,
       collection,
-      out_ids,
-      out_count,
+      attribute,
+      out_schema,
+      out_array,
     );
   }
 
-  late final _quiver_database_read_element_idsPtr =
+  late final _quiver_database_read_vector_floats_arrowPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
-            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ArrowSchema>,
+            ffi.Pointer<ArrowArray>,
           )
         >
-      >('quiver_database_read_element_ids');
-  late final _quiver_database_read_element_ids = _quiver_database_read_element_idsPtr
+      >('quiver_database_read_vector_floats_arrow');
+  late final _quiver_database_read_vector_floats_arrow = _quiver_database_read_vector_floats_arrowPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
-          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ArrowSchema>,
+          ffi.Pointer<ArrowArray>,
         )
       >();
 
-  int quiver_database_get_scalar_metadata(
+  int quiver_database_read_vector_strings_arrow(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
     ffi.Pointer<ffi.Char> attribute,
-    ffi.Pointer<quiver_scalar_metadata_t> out_metadata,
+    ffi.Pointer<ArrowSchema> out_schema,
+    ffi.Pointer<ArrowArray> out_array,
   ) {
-    return _quiver_database_get_scalar_metadata(
+    return _quiver_database_read_vector_strings_arrow(
       db,
       collection,
       attribute,
-      out_metadata,
+      out_schema,
+      out_array,
     );
   }
 
-  late final _quiver_database_get_scalar_metadataPtr =
+  late final _quiver_database_read_vector_strings_arrowPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<quiver_scalar_metadata_t>,
+            ffi.Pointer<ArrowSchema>,
+            ffi.Pointer<ArrowArray>,
           )
         >
-      >('quiver_database_get_scalar_metadata');
-  late final _quiver_database_get_scalar_metadata = _quiver_database_get_scalar_metadataPtr
+      >('quiver_database_read_vector_strings_arrow');
+  late final _quiver_database_read_vector_strings_arrow = _quiver_database_read_vector_strings_arrowPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<quiver_scalar_metadata_t>,
+          ffi.Pointer<ArrowSchema>,
+          ffi.Pointer<ArrowArray>,
         )
       >();
 
-  int quiver_database_get_vector_metadata(
+  int quiver_database_read_set_integers_arrow(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> group_name,
-    ffi.Pointer<quiver_vector_metadata_t> out_metadata,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ArrowSchema> out_schema,
+    ffi.Pointer<ArrowArray> out_array,
   ) {
-    return _quiver_database_get_vector_metadata(
+    return _quiver_database_read_set_integers_arrow(
       db,
       collection,
-      group_name,
-      out_metadata,
+      attribute,
+      out_schema,
+      out_array,
     );
   }
 
-  late final _quiver_database_get_vector_metadataPtr =
+  late final _quiver_database_read_set_integers_arrowPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<quiver_vector_metadata_t>,
+            ffi.Pointer<ArrowSchema>,
+            ffi.Pointer<ArrowArray>,
           )
         >
-      >('quiver_database_get_vector_metadata');
-  late final _quiver_database_get_vector_metadata = _quiver_database_get_vector_metadataPtr
+      >('quiver_database_read_set_integers_arrow');
+  late final _quiver_database_read_set_integers_arrow = _quiver_database_read_set_integers_arrowPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<quiver_vector_metadata_t>,
+          ffi.Pointer<ArrowSchema>,
+          ffi.Pointer<ArrowArray>,
         )
       >();
 
-  int quiver_database_get_set_metadata(
+  int quiver_database_read_set_floats_arrow(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> group_name,
-    ffi.Pointer<quiver_set_metadata_t> out_metadata,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ArrowSchema> out_schema,
+    ffi.Pointer<ArrowArray> out_array,
   ) {
-    return _quiver_database_get_set_metadata(
+    return _quiver_database_read_set_floats_arrow(
       db,
       collection,
-      group_name,
-      out_metadata,
+      attribute,
+      out_schema,
+      out_array,
     );
   }
 
-  late final _quiver_database_get_set_metadataPtr =
+  late final _quiver_database_read_set_floats_arrowPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<quiver_set_metadata_t>,
+            ffi.Pointer<ArrowSchema>,
+            ffi.Pointer<ArrowArray>,
           )
         >
-      >('quiver_database_get_set_metadata');
-  late final _quiver_database_get_set_metadata = _quiver_database_get_set_metadataPtr
+      >('quiver_database_read_set_floats_arrow');
+  late final _quiver_database_read_set_floats_arrow = _quiver_database_read_set_floats_arrowPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<quiver_set_metadata_t>,
+          ffi.Pointer<ArrowSchema>,
+          ffi.Pointer<ArrowArray>,
         )
       >();
 
-  void quiver_free_scalar_metadata(
-    ffi.Pointer<quiver_scalar_metadata_t> metadata,
-  ) {
-    return _quiver_free_scalar_metadata(
-      metadata,
-    );
-  }
-
-  late final _quiver_free_scalar_metadataPtr =
-      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_scalar_metadata_t>)>>(
-        'quiver_free_scalar_metadata',
-      );
-  late final _quiver_free_scalar_metadata = _quiver_free_scalar_metadataPtr
-      .asFunction<void Function(ffi.Pointer<quiver_scalar_metadata_t>)>();
-
-  void quiver_free_vector_metadata(
-    ffi.Pointer<quiver_vector_metadata_t> metadata,
-  ) {
-    return _quiver_free_vector_metadata(
-      metadata,
-    );
-  }
-
-  late final _quiver_free_vector_metadataPtr =
-      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_vector_metadata_t>)>>(
-        'quiver_free_vector_metadata',
-      );
-  late final _quiver_free_vector_metadata = _quiver_free_vector_metadataPtr
-      .asFunction<void Function(ffi.Pointer<quiver_vector_metadata_t>)>();
-
-  void quiver_free_set_metadata(
-    ffi.Pointer<quiver_set_metadata_t> metadata,
-  ) {
-    return _quiver_free_set_metadata(
-      metadata,
-    );
-  }
-
-  late final _quiver_free_set_metadataPtr =
-      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_set_metadata_t>)>>('quiver_free_set_metadata');
-  late final _quiver_free_set_metadata = _quiver_free_set_metadataPtr
-      .asFunction<void Function(ffi.Pointer<quiver_set_metadata_t>)>();
-
-  int quiver_database_list_scalar_attributes(
+  int quiver_database_read_set_strings_arrow(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Pointer<quiver_scalar_metadata_t>> out_metadata,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ArrowSchema> out_schema,
+    ffi.Pointer<ArrowArray> out_array,
   ) {
-    return _quiver_database_list_scalar_attributes(
+    return _quiver_database_read_set_strings_arrow(
       db,
       collection,
-      out_metadata,
-      out_count,
+      attribute,
+      out_schema,
+      out_array,
     );
   }
 
-  late final _quiver_database_list_scalar_attributesPtr =
+  late final _quiver_database_read_set_strings_arrowPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<quiver_scalar_metadata_t>>,
-            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ArrowSchema>,
+            ffi.Pointer<ArrowArray>,
           )
         >
-      >('quiver_database_list_scalar_attributes');
-  late final _quiver_database_list_scalar_attributes = _quiver_database_list_scalar_attributesPtr
+      >('quiver_database_read_set_strings_arrow');
+  late final _quiver_database_read_set_strings_arrow = _quiver_database_read_set_strings_arrowPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<quiver_scalar_metadata_t>>,
-          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ArrowSchema>,
+          ffi.Pointer<ArrowArray>,
         )
       >();
 
-  int quiver_database_list_vector_groups(
+  int quiver_database_query_arrow(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Pointer<quiver_vector_metadata_t>> out_metadata,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<ffi.Char> sql,
+    ffi.Pointer<ffi.Int> param_types,
+    ffi.Pointer<ffi.Pointer<ffi.Void>> param_values,
+    int param_count,
+    ffi.Pointer<ArrowSchema> out_schema,
+    ffi.Pointer<ArrowArray> out_array,
   ) {
-    return _quiver_database_list_vector_groups(
+    return _quiver_database_query_arrow(
       db,
-      collection,
-      out_metadata,
-      out_count,
+      sql,
+      param_types,
+      param_values,
+      param_count,
+      out_schema,
+      out_array,
     );
   }
 
-  late final _quiver_database_list_vector_groupsPtr =
+  late final _quiver_database_query_arrowPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<quiver_vector_metadata_t>>,
-            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Pointer<ffi.Void>>,
+            ffi.Size,
+            ffi.Pointer<ArrowSchema>,
+            ffi.Pointer<ArrowArray>,
           )
         >
-      >('quiver_database_list_vector_groups');
-  late final _quiver_database_list_vector_groups = _quiver_database_list_vector_groupsPtr
+      >('quiver_database_query_arrow');
+  late final _quiver_database_query_arrow = _quiver_database_query_arrowPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<quiver_vector_metadata_t>>,
-          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Pointer<ffi.Void>>,
+          int,
+          ffi.Pointer<ArrowSchema>,
+          ffi.Pointer<ArrowArray>,
         )
       >();
 
-  int quiver_database_list_set_groups(
+  int quiver_database_read_scalar_integers_async(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Pointer<quiver_set_metadata_t>> out_metadata,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<quiver_future_t>> out_future,
   ) {
-    return _quiver_database_list_set_groups(
+    return _quiver_database_read_scalar_integers_async(
       db,
       collection,
-      out_metadata,
-      out_count,
+      attribute,
+      out_future,
     );
   }
 
-  late final _quiver_database_list_set_groupsPtr =
+  late final _quiver_database_read_scalar_integers_asyncPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<quiver_set_metadata_t>>,
-            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<quiver_future_t>>,
           )
         >
-      >('quiver_database_list_set_groups');
-  late final _quiver_database_list_set_groups = _quiver_database_list_set_groupsPtr
+      >('quiver_database_read_scalar_integers_async');
+  late final _quiver_database_read_scalar_integers_async = _quiver_database_read_scalar_integers_asyncPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<quiver_set_metadata_t>>,
-          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<quiver_future_t>>,
         )
       >();
 
-  void quiver_free_scalar_metadata_array(
-    ffi.Pointer<quiver_scalar_metadata_t> metadata,
-    int count,
-  ) {
-    return _quiver_free_scalar_metadata_array(
-      metadata,
-      count,
-    );
-  }
-
-  late final _quiver_free_scalar_metadata_arrayPtr =
-      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_scalar_metadata_t>, ffi.Size)>>(
-        'quiver_free_scalar_metadata_array',
-      );
-  late final _quiver_free_scalar_metadata_array = _quiver_free_scalar_metadata_arrayPtr
-      .asFunction<void Function(ffi.Pointer<quiver_scalar_metadata_t>, int)>();
-
-  void quiver_free_vector_metadata_array(
-    ffi.Pointer<quiver_vector_metadata_t> metadata,
-    int count,
-  ) {
-    return _quiver_free_vector_metadata_array(
-      metadata,
-      count,
-    );
-  }
-
-  late final _quiver_free_vector_metadata_arrayPtr =
-      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_vector_metadata_t>, ffi.Size)>>(
-        'quiver_free_vector_metadata_array',
-      );
-  late final _quiver_free_vector_metadata_array = _quiver_free_vector_metadata_arrayPtr
-      .asFunction<void Function(ffi.Pointer<quiver_vector_metadata_t>, int)>();
-
-  void quiver_free_set_metadata_array(
-    ffi.Pointer<quiver_set_metadata_t> metadata,
-    int count,
-  ) {
-    return _quiver_free_set_metadata_array(
-      metadata,
-      count,
-    );
-  }
-
-  late final _quiver_free_set_metadata_arrayPtr =
-      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_set_metadata_t>, ffi.Size)>>(
-        'quiver_free_set_metadata_array',
-      );
-  late final _quiver_free_set_metadata_array = _quiver_free_set_metadata_arrayPtr
-      .asFunction<void Function(ffi.Pointer<quiver_set_metadata_t>, int)>();
-
-  int quiver_database_update_scalar_integer(
+  int quiver_database_read_scalar_floats_async(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
     ffi.Pointer<ffi.Char> attribute,
-    int id,
-    int value,
+    ffi.Pointer<ffi.Pointer<quiver_future_t>> out_future,
   ) {
-    return _quiver_database_update_scalar_integer(
+    return _quiver_database_read_scalar_floats_async(
       db,
       collection,
       attribute,
-      id,
-      value,
+      out_future,
     );
   }
 
-  late final _quiver_database_update_scalar_integerPtr =
+  late final _quiver_database_read_scalar_floats_asyncPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<quiver_future_t>>,
           )
         >
-      >('quiver_database_update_scalar_integer');
-  late final _quiver_database_update_scalar_integer = _quiver_database_update_scalar_integerPtr
+      >('quiver_database_read_scalar_floats_async');
+  late final _quiver_database_read_scalar_floats_async = _quiver_database_read_scalar_floats_asyncPtr
       .asFunction<
-        int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>, int, int)
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<quiver_future_t>>,
+        )
       >();
 
-  int quiver_database_update_scalar_float(
+  int quiver_database_read_scalar_strings_async(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
     ffi.Pointer<ffi.Char> attribute,
-    int id,
-    double value,
+    ffi.Pointer<ffi.Pointer<quiver_future_t>> out_future,
   ) {
-    return _quiver_database_update_scalar_float(
+    return _quiver_database_read_scalar_strings_async(
       db,
       collection,
       attribute,
-      id,
-      value,
+      out_future,
     );
   }
 
-  late final _quiver_database_update_scalar_floatPtr =
+  late final _quiver_database_read_scalar_strings_asyncPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Double,
+            ffi.Pointer<ffi.Pointer<quiver_future_t>>,
           )
         >
-      >('quiver_database_update_scalar_float');
-  late final _quiver_database_update_scalar_float = _quiver_database_update_scalar_floatPtr
+      >('quiver_database_read_scalar_strings_async');
+  late final _quiver_database_read_scalar_strings_async = _quiver_database_read_scalar_strings_asyncPtr
       .asFunction<
-        int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>, int, double)
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<quiver_future_t>>,
+        )
       >();
 
-  int quiver_database_update_scalar_string(
+  int quiver_database_read_vector_integers_async(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
     ffi.Pointer<ffi.Char> attribute,
-    int id,
-    ffi.Pointer<ffi.Char> value,
+    ffi.Pointer<ffi.Pointer<quiver_future_t>> out_future,
   ) {
-    return _quiver_database_update_scalar_string(
+    return _quiver_database_read_vector_integers_async(
       db,
       collection,
       attribute,
-      id,
-      value,
+      out_future,
     );
   }
 
-  late final _quiver_database_update_scalar_stringPtr =
+  late final _quiver_database_read_vector_integers_asyncPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<quiver_future_t>>,
           )
         >
-      >('quiver_database_update_scalar_string');
-  late final _quiver_database_update_scalar_string = _quiver_database_update_scalar_stringPtr
+      >('quiver_database_read_vector_integers_async');
+  late final _quiver_database_read_vector_integers_async = _quiver_database_read_vector_integers_asyncPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          int,
-          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<quiver_future_t>>,
         )
       >();
 
-  int quiver_database_update_vector_integers(
+  int quiver_database_read_vector_floats_async(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
     ffi.Pointer<ffi.Char> attribute,
-    int id,
-    ffi.Pointer<ffi.Int64> values,
-    int count,
+    ffi.Pointer<ffi.Pointer<quiver_future_t>> out_future,
   ) {
-    return _quiver_database_update_vector_integers(
+    return _quiver_database_read_vector_floats_async(
       db,
       collection,
       attribute,
-      id,
-      values,
-      count,
+      out_future,
     );
   }
 
-  late final _quiver_database_update_vector_integersPtr =
+  late final _quiver_database_read_vector_floats_asyncPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Int64>,
-            ffi.Size,
+            ffi.Pointer<ffi.Pointer<quiver_future_t>>,
           )
         >
-      >('quiver_database_update_vector_integers');
-  late final _quiver_database_update_vector_integers = _quiver_database_update_vector_integersPtr
+      >('quiver_database_read_vector_floats_async');
+  late final _quiver_database_read_vector_floats_async = _quiver_database_read_vector_floats_asyncPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          int,
-          ffi.Pointer<ffi.Int64>,
-          int,
+          ffi.Pointer<ffi.Pointer<quiver_future_t>>,
         )
       >();
 
-  int quiver_database_update_vector_floats(
+  int quiver_database_read_vector_strings_async(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
     ffi.Pointer<ffi.Char> attribute,
-    int id,
-    ffi.Pointer<ffi.Double> values,
-    int count,
+    ffi.Pointer<ffi.Pointer<quiver_future_t>> out_future,
   ) {
-    return _quiver_database_update_vector_floats(
+    return _quiver_database_read_vector_strings_async(
       db,
-      collection,
-      attribute,
-      id,
-      values,
-      count,
+      collection,
+      attribute,
+      out_future,
     );
   }
 
-  late final _quiver_database_update_vector_floatsPtr =
+  late final _quiver_database_read_vector_strings_asyncPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Double>,
-            ffi.Size,
+            ffi.Pointer<ffi.Pointer<quiver_future_t>>,
           )
         >
-      >('quiver_database_update_vector_floats');
-  late final _quiver_database_update_vector_floats = _quiver_database_update_vector_floatsPtr
+      >('quiver_database_read_vector_strings_async');
+  late final _quiver_database_read_vector_strings_async = _quiver_database_read_vector_strings_asyncPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          int,
-          ffi.Pointer<ffi.Double>,
-          int,
+          ffi.Pointer<ffi.Pointer<quiver_future_t>>,
         )
       >();
 
-  int quiver_database_update_vector_strings(
+  int quiver_database_export_to_csv_async(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    int id,
-    ffi.Pointer<ffi.Pointer<ffi.Char>> values,
-    int count,
+    ffi.Pointer<ffi.Char> table,
+    ffi.Pointer<ffi.Char> path,
+    ffi.Pointer<ffi.Pointer<quiver_future_t>> out_future,
   ) {
-    return _quiver_database_update_vector_strings(
+    return _quiver_database_export_to_csv_async(
       db,
-      collection,
-      attribute,
-      id,
-      values,
-      count,
+      table,
+      path,
+      out_future,
     );
   }
 
-  late final _quiver_database_update_vector_stringsPtr =
+  late final _quiver_database_export_to_csv_asyncPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Pointer<ffi.Char>>,
-            ffi.Size,
+            ffi.Pointer<ffi.Pointer<quiver_future_t>>,
           )
         >
-      >('quiver_database_update_vector_strings');
-  late final _quiver_database_update_vector_strings = _quiver_database_update_vector_stringsPtr
+      >('quiver_database_export_to_csv_async');
+  late final _quiver_database_export_to_csv_async = _quiver_database_export_to_csv_asyncPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          int,
-          ffi.Pointer<ffi.Pointer<ffi.Char>>,
-          int,
+          ffi.Pointer<ffi.Pointer<quiver_future_t>>,
         )
       >();
 
-  int quiver_database_update_set_integers(
+  int quiver_database_import_from_csv_async(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    int id,
-    ffi.Pointer<ffi.Int64> values,
-    int count,
+    ffi.Pointer<ffi.Char> table,
+    ffi.Pointer<ffi.Char> path,
+    ffi.Pointer<ffi.Pointer<quiver_future_t>> out_future,
   ) {
-    return _quiver_database_update_set_integers(
+    return _quiver_database_import_from_csv_async(
       db,
-      collection,
-      attribute,
-      id,
-      values,
-      count,
+      table,
+      path,
+      out_future,
     );
   }
 
-  late final _quiver_database_update_set_integersPtr =
+  late final _quiver_database_import_from_csv_asyncPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Int64>,
-            ffi.Size,
+            ffi.Pointer<ffi.Pointer<quiver_future_t>>,
           )
         >
-      >('quiver_database_update_set_integers');
-  late final _quiver_database_update_set_integers = _quiver_database_update_set_integersPtr
+      >('quiver_database_import_from_csv_async');
+  late final _quiver_database_import_from_csv_async = _quiver_database_import_from_csv_asyncPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          int,
-          ffi.Pointer<ffi.Int64>,
-          int,
+          ffi.Pointer<ffi.Pointer<quiver_future_t>>,
         )
       >();
 
-  int quiver_database_update_set_floats(
+  int quiver_database_export_collection_async(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    int id,
-    ffi.Pointer<ffi.Double> values,
-    int count,
+    ffi.Pointer<ffi.Char> directory,
+    ffi.Pointer<ffi.Pointer<quiver_future_t>> out_future,
   ) {
-    return _quiver_database_update_set_floats(
+    return _quiver_database_export_collection_async(
       db,
       collection,
-      attribute,
-      id,
-      values,
-      count,
+      directory,
+      out_future,
     );
   }
 
-  late final _quiver_database_update_set_floatsPtr =
+  late final _quiver_database_export_collection_asyncPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Double>,
-            ffi.Size,
+            ffi.Pointer<ffi.Pointer<quiver_future_t>>,
           )
         >
-      >('quiver_database_update_set_floats');
-  late final _quiver_database_update_set_floats = _quiver_database_update_set_floatsPtr
+      >('quiver_database_export_collection_async');
+  late final _quiver_database_export_collection_async = _quiver_database_export_collection_asyncPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          int,
-          ffi.Pointer<ffi.Double>,
-          int,
+          ffi.Pointer<ffi.Pointer<quiver_future_t>>,
         )
       >();
 
-  int quiver_database_update_set_strings(
+  int quiver_database_import_collection_async(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    int id,
-    ffi.Pointer<ffi.Pointer<ffi.Char>> values,
-    int count,
+    ffi.Pointer<ffi.Char> directory,
+    ffi.Pointer<ffi.Pointer<quiver_future_t>> out_future,
   ) {
-    return _quiver_database_update_set_strings(
+    return _quiver_database_import_collection_async(
       db,
       collection,
-      attribute,
-      id,
-      values,
-      count,
+      directory,
+      out_future,
     );
   }
 
-  late final _quiver_database_update_set_stringsPtr =
+  late final _quiver_database_import_collection_asyncPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Pointer<ffi.Char>>,
-            ffi.Size,
+            ffi.Pointer<ffi.Pointer<quiver_future_t>>,
           )
         >
-      >('quiver_database_update_set_strings');
-  late final _quiver_database_update_set_strings = _quiver_database_update_set_stringsPtr
+      >('quiver_database_import_collection_async');
+  late final _quiver_database_import_collection_async = _quiver_database_import_collection_asyncPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          int,
-          ffi.Pointer<ffi.Pointer<ffi.Char>>,
-          int,
+          ffi.Pointer<ffi.Pointer<quiver_future_t>>,
         )
       >();
 
-  void quiver_free_integer_array(
-    ffi.Pointer<ffi.Int64> values,
+  int quiver_future_wait(
+    ffi.Pointer<quiver_future_t> future,
+    int timeout_ms,
+    ffi.Pointer<ffi.Int> out_done,
   ) {
-    return _quiver_free_integer_array(
-      values,
+    return _quiver_future_wait(
+      future,
+      timeout_ms,
+      out_done,
     );
   }
 
-  late final _quiver_free_integer_arrayPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Int64>)>>(
-    'quiver_free_integer_array',
+  late final _quiver_future_waitPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_future_t>, ffi.Int64, ffi.Pointer<ffi.Int>)>>(
+        'quiver_future_wait',
+      );
+  late final _quiver_future_wait = _quiver_future_waitPtr
+      .asFunction<int Function(ffi.Pointer<quiver_future_t>, int, ffi.Pointer<ffi.Int>)>();
+
+  int quiver_future_cancel(
+    ffi.Pointer<quiver_future_t> future,
+  ) {
+    return _quiver_future_cancel(
+      future,
+    );
+  }
+
+  late final _quiver_future_cancelPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_future_t>)>>(
+    'quiver_future_cancel',
   );
-  late final _quiver_free_integer_array = _quiver_free_integer_arrayPtr
-      .asFunction<void Function(ffi.Pointer<ffi.Int64>)>();
+  late final _quiver_future_cancel = _quiver_future_cancelPtr.asFunction<int Function(ffi.Pointer<quiver_future_t>)>();
 
-  void quiver_free_float_array(
-    ffi.Pointer<ffi.Double> values,
+  int quiver_future_result(
+    ffi.Pointer<quiver_future_t> future,
+    ffi.Pointer<ffi.Pointer<quiver_result_t>> out_result,
   ) {
-    return _quiver_free_float_array(
-      values,
+    return _quiver_future_result(
+      future,
+      out_result,
     );
   }
 
-  late final _quiver_free_float_arrayPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Double>)>>(
-    'quiver_free_float_array',
+  late final _quiver_future_resultPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_future_t>, ffi.Pointer<ffi.Pointer<quiver_result_t>>)>
+      >('quiver_future_result');
+  late final _quiver_future_result = _quiver_future_resultPtr
+      .asFunction<int Function(ffi.Pointer<quiver_future_t>, ffi.Pointer<ffi.Pointer<quiver_result_t>>)>();
+
+  void quiver_future_free(
+    ffi.Pointer<quiver_future_t> future,
+  ) {
+    return _quiver_future_free(
+      future,
+    );
+  }
+
+  late final _quiver_future_freePtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_future_t>)>>(
+    'quiver_future_free',
   );
-  late final _quiver_free_float_array = _quiver_free_float_arrayPtr
-      .asFunction<void Function(ffi.Pointer<ffi.Double>)>();
+  late final _quiver_future_free = _quiver_future_freePtr.asFunction<void Function(ffi.Pointer<quiver_future_t>)>();
 
-  void quiver_free_string_array(
-    ffi.Pointer<ffi.Pointer<ffi.Char>> values,
-    int count,
+  ffi.Pointer<quiver_filter_t> quiver_filter_create() {
+    return _quiver_filter_create();
+  }
+
+  late final _quiver_filter_createPtr = _lookup<ffi.NativeFunction<ffi.Pointer<quiver_filter_t> Function()>>(
+    'quiver_filter_create',
+  );
+  late final _quiver_filter_create = _quiver_filter_createPtr.asFunction<ffi.Pointer<quiver_filter_t> Function()>();
+
+  void quiver_filter_destroy(
+    ffi.Pointer<quiver_filter_t> filter,
   ) {
-    return _quiver_free_string_array(
-      values,
-      count,
+    return _quiver_filter_destroy(
+      filter,
     );
   }
 
-  late final _quiver_free_string_arrayPtr =
-      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Pointer<ffi.Char>>, ffi.Size)>>(
-        'quiver_free_string_array',
+  late final _quiver_filter_destroyPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<quiver_filter_t>)>>(
+    'quiver_filter_destroy',
+  );
+  late final _quiver_filter_destroy = _quiver_filter_destroyPtr
+      .asFunction<void Function(ffi.Pointer<quiver_filter_t>)>();
+
+  int quiver_filter_id_range(
+    ffi.Pointer<quiver_filter_t> filter,
+    int from,
+    int to,
+  ) {
+    return _quiver_filter_id_range(
+      filter,
+      from,
+      to,
+    );
+  }
+
+  late final _quiver_filter_id_rangePtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_filter_t>, ffi.Int64, ffi.Int64)>>(
+        'quiver_filter_id_range',
       );
-  late final _quiver_free_string_array = _quiver_free_string_arrayPtr
-      .asFunction<void Function(ffi.Pointer<ffi.Pointer<ffi.Char>>, int)>();
+  late final _quiver_filter_id_range = _quiver_filter_id_rangePtr
+      .asFunction<int Function(ffi.Pointer<quiver_filter_t>, int, int)>();
 
-  void quiver_free_integer_vectors(
-    ffi.Pointer<ffi.Pointer<ffi.Int64>> vectors,
-    ffi.Pointer<ffi.Size> sizes,
+  int quiver_filter_id_in(
+    ffi.Pointer<quiver_filter_t> filter,
+    ffi.Pointer<ffi.Int64> ids,
     int count,
   ) {
-    return _quiver_free_integer_vectors(
-      vectors,
-      sizes,
+    return _quiver_filter_id_in(
+      filter,
+      ids,
       count,
     );
   }
 
-  late final _quiver_free_integer_vectorsPtr =
+  late final _quiver_filter_id_inPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_filter_t>, ffi.Pointer<ffi.Int64>, ffi.Size)>>(
+        'quiver_filter_id_in',
+      );
+  late final _quiver_filter_id_in = _quiver_filter_id_inPtr
+      .asFunction<int Function(ffi.Pointer<quiver_filter_t>, ffi.Pointer<ffi.Int64>, int)>();
+
+  int quiver_filter_where_integer(
+    ffi.Pointer<quiver_filter_t> filter,
+    ffi.Pointer<ffi.Char> attribute,
+    int op,
+    int value,
+  ) {
+    return _quiver_filter_where_integer(
+      filter,
+      attribute,
+      op,
+      value,
+    );
+  }
+
+  late final _quiver_filter_where_integerPtr =
       _lookup<
-        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Pointer<ffi.Int64>>, ffi.Pointer<ffi.Size>, ffi.Size)>
-      >('quiver_free_integer_vectors');
-  late final _quiver_free_integer_vectors = _quiver_free_integer_vectorsPtr
-      .asFunction<void Function(ffi.Pointer<ffi.Pointer<ffi.Int64>>, ffi.Pointer<ffi.Size>, int)>();
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_filter_t>, ffi.Pointer<ffi.Char>, ffi.Int32, ffi.Int64)
+        >
+      >('quiver_filter_where_integer');
+  late final _quiver_filter_where_integer = _quiver_filter_where_integerPtr
+      .asFunction<int Function(ffi.Pointer<quiver_filter_t>, ffi.Pointer<ffi.Char>, int, int)>();
 
-  void quiver_free_float_vectors(
-    ffi.Pointer<ffi.Pointer<ffi.Double>> vectors,
-    ffi.Pointer<ffi.Size> sizes,
-    int count,
+  int quiver_filter_where_float(
+    ffi.Pointer<quiver_filter_t> filter,
+    ffi.Pointer<ffi.Char> attribute,
+    int op,
+    double value,
   ) {
-    return _quiver_free_float_vectors(
-      vectors,
-      sizes,
-      count,
+    return _quiver_filter_where_float(
+      filter,
+      attribute,
+      op,
+      value,
     );
   }
 
-  late final _quiver_free_float_vectorsPtr =
+  late final _quiver_filter_where_floatPtr =
       _lookup<
-        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Pointer<ffi.Double>>, ffi.Pointer<ffi.Size>, ffi.Size)>
-      >('quiver_free_float_vectors');
-  late final _quiver_free_float_vectors = _quiver_free_float_vectorsPtr
-      .asFunction<void Function(ffi.Pointer<ffi.Pointer<ffi.Double>>, ffi.Pointer<ffi.Size>, int)>();
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_filter_t>, ffi.Pointer<ffi.Char>, ffi.Int32, ffi.Double)
+        >
+      >('quiver_filter_where_float');
+  late final _quiver_filter_where_float = _quiver_filter_where_floatPtr
+      .asFunction<int Function(ffi.Pointer<quiver_filter_t>, ffi.Pointer<ffi.Char>, int, double)>();
+
+  int quiver_filter_where_string(
+    ffi.Pointer<quiver_filter_t> filter,
+    ffi.Pointer<ffi.Char> attribute,
+    int op,
+    ffi.Pointer<ffi.Char> value,
+  ) {
+    return _quiver_filter_where_string(
+      filter,
+      attribute,
+      op,
+      value,
+    );
+  }
+
+  late final _quiver_filter_where_stringPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_filter_t>, ffi.Pointer<ffi.Char>, ffi.Int32, ffi.Pointer<ffi.Char>)
+        >
+      >('quiver_filter_where_string');
+  late final _quiver_filter_where_string = _quiver_filter_where_stringPtr
+      .asFunction<int Function(ffi.Pointer<quiver_filter_t>, ffi.Pointer<ffi.Char>, int, ffi.Pointer<ffi.Char>)>();
+
+  int quiver_filter_where_null(
+    ffi.Pointer<quiver_filter_t> filter,
+    ffi.Pointer<ffi.Char> attribute,
+    int op,
+  ) {
+    return _quiver_filter_where_null(
+      filter,
+      attribute,
+      op,
+    );
+  }
+
+  late final _quiver_filter_where_nullPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_filter_t>, ffi.Pointer<ffi.Char>, ffi.Int32)>>(
+        'quiver_filter_where_null',
+      );
+  late final _quiver_filter_where_null = _quiver_filter_where_nullPtr
+      .asFunction<int Function(ffi.Pointer<quiver_filter_t>, ffi.Pointer<ffi.Char>, int)>();
+
+  int quiver_database_read_element_ids_filtered(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<quiver_filter_t> filter,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_ids,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_element_ids_filtered(
+      db,
+      collection,
+      filter,
+      out_ids,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_element_ids_filteredPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_filter_t>,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_element_ids_filtered');
+  late final _quiver_database_read_element_ids_filtered = _quiver_database_read_element_ids_filteredPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_filter_t>,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_scalar_integers_filtered(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<quiver_filter_t> filter,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_scalar_integers_filtered(
+      db,
+      collection,
+      attribute,
+      filter,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_scalar_integers_filteredPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_filter_t>,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_scalar_integers_filtered');
+  late final _quiver_database_read_scalar_integers_filtered = _quiver_database_read_scalar_integers_filteredPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_filter_t>,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
 
-  void quiver_free_string_vectors(
-    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> vectors,
-    ffi.Pointer<ffi.Size> sizes,
-    int count,
+  int quiver_database_read_scalar_floats_filtered(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<quiver_filter_t> filter,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
   ) {
-    return _quiver_free_string_vectors(
-      vectors,
-      sizes,
-      count,
+    return _quiver_database_read_scalar_floats_filtered(
+      db,
+      collection,
+      attribute,
+      filter,
+      out_values,
+      out_count,
     );
   }
 
-  late final _quiver_free_string_vectorsPtr =
+  late final _quiver_database_read_scalar_floats_filteredPtr =
       _lookup<
         ffi.NativeFunction<
-          ffi.Void Function(ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>, ffi.Pointer<ffi.Size>, ffi.Size)
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_filter_t>,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Size>,
+          )
         >
-      >('quiver_free_string_vectors');
-  late final _quiver_free_string_vectors = _quiver_free_string_vectorsPtr
-      .asFunction<void Function(ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>, ffi.Pointer<ffi.Size>, int)>();
+      >('quiver_database_read_scalar_floats_filtered');
+  late final _quiver_database_read_scalar_floats_filtered = _quiver_database_read_scalar_floats_filteredPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_filter_t>,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
 
-  int quiver_database_export_to_csv(
+  int quiver_database_read_scalar_strings_filtered(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> table,
-    ffi.Pointer<ffi.Char> path,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<quiver_filter_t> filter,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
   ) {
-    return _quiver_database_export_to_csv(
+    return _quiver_database_read_scalar_strings_filtered(
       db,
-      table,
-      path,
+      collection,
+      attribute,
+      filter,
+      out_values,
+      out_count,
     );
   }
 
-  late final _quiver_database_export_to_csvPtr =
+  late final _quiver_database_read_scalar_strings_filteredPtr =
       _lookup<
         ffi.NativeFunction<
-          ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>)
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_filter_t>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Size>,
+          )
         >
-      >('quiver_database_export_to_csv');
-  late final _quiver_database_export_to_csv = _quiver_database_export_to_csvPtr
-      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>)>();
+      >('quiver_database_read_scalar_strings_filtered');
+  late final _quiver_database_read_scalar_strings_filtered = _quiver_database_read_scalar_strings_filteredPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_filter_t>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
 
-  int quiver_database_import_from_csv(
+  int quiver_database_read_vector_integers_flat_filtered(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> table,
-    ffi.Pointer<ffi.Char> path,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<quiver_filter_t> filter,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
   ) {
-    return _quiver_database_import_from_csv(
+    return _quiver_database_read_vector_integers_flat_filtered(
       db,
-      table,
-      path,
+      collection,
+      attribute,
+      filter,
+      out_values,
+      out_offsets,
+      out_count,
     );
   }
 
-  late final _quiver_database_import_from_csvPtr =
+  late final _quiver_database_read_vector_integers_flat_filteredPtr =
       _lookup<
         ffi.NativeFunction<
-          ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>)
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_filter_t>,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
         >
-      >('quiver_database_import_from_csv');
-  late final _quiver_database_import_from_csv = _quiver_database_import_from_csvPtr
-      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>)>();
+      >('quiver_database_read_vector_integers_flat_filtered');
+  late final _quiver_database_read_vector_integers_flat_filtered = _quiver_database_read_vector_integers_flat_filteredPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_filter_t>,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
 
-  int quiver_database_query_string(
+  int quiver_database_read_vector_floats_flat_filtered(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> sql,
-    ffi.Pointer<ffi.Pointer<ffi.Char>> out_value,
-    ffi.Pointer<ffi.Int> out_has_value,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<quiver_filter_t> filter,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
   ) {
-    return _quiver_database_query_string(
+    return _quiver_database_read_vector_floats_flat_filtered(
       db,
-      sql,
-      out_value,
-      out_has_value,
+      collection,
+      attribute,
+      filter,
+      out_values,
+      out_offsets,
+      out_count,
     );
   }
 
-  late final _quiver_database_query_stringPtr =
+  late final _quiver_database_read_vector_floats_flat_filteredPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<ffi.Char>>,
-            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_filter_t>,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
           )
         >
-      >('quiver_database_query_string');
-  late final _quiver_database_query_string = _quiver_database_query_stringPtr
+      >('quiver_database_read_vector_floats_flat_filtered');
+  late final _quiver_database_read_vector_floats_flat_filtered = _quiver_database_read_vector_floats_flat_filteredPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<ffi.Char>>,
-          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_filter_t>,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
         )
       >();
 
-  int quiver_database_query_integer(
+  int quiver_database_read_vector_strings_flat_filtered(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> sql,
-    ffi.Pointer<ffi.Int64> out_value,
-    ffi.Pointer<ffi.Int> out_has_value,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<quiver_filter_t> filter,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
   ) {
-    return _quiver_database_query_integer(
+    return _quiver_database_read_vector_strings_flat_filtered(
       db,
-      sql,
-      out_value,
-      out_has_value,
+      collection,
+      attribute,
+      filter,
+      out_values,
+      out_offsets,
+      out_count,
     );
   }
 
-  late final _quiver_database_query_integerPtr =
+  late final _quiver_database_read_vector_strings_flat_filteredPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Int64>,
-            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_filter_t>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
           )
         >
-      >('quiver_database_query_integer');
-  late final _quiver_database_query_integer = _quiver_database_query_integerPtr
+      >('quiver_database_read_vector_strings_flat_filtered');
+  late final _quiver_database_read_vector_strings_flat_filtered = _quiver_database_read_vector_strings_flat_filteredPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Int64>,
-          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_filter_t>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
         )
       >();
 
-  int quiver_database_query_float(
+  int quiver_database_read_set_integers_flat_filtered(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> sql,
-    ffi.Pointer<ffi.Double> out_value,
-    ffi.Pointer<ffi.Int> out_has_value,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<quiver_filter_t> filter,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
   ) {
-    return _quiver_database_query_float(
+    return _quiver_database_read_set_integers_flat_filtered(
       db,
-      sql,
-      out_value,
-      out_has_value,
+      collection,
+      attribute,
+      filter,
+      out_values,
+      out_offsets,
+      out_count,
     );
   }
 
-  late final _quiver_database_query_floatPtr =
+  late final _quiver_database_read_set_integers_flat_filteredPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Double>,
-            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_filter_t>,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
           )
         >
-      >('quiver_database_query_float');
-  late final _quiver_database_query_float = _quiver_database_query_floatPtr
+      >('quiver_database_read_set_integers_flat_filtered');
+  late final _quiver_database_read_set_integers_flat_filtered = _quiver_database_read_set_integers_flat_filteredPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Double>,
-          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_filter_t>,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
         )
       >();
 
-  int quiver_database_query_string_params(
+  int quiver_database_read_set_floats_flat_filtered(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> sql,
-    ffi.Pointer<ffi.Int> param_types,
-    ffi.Pointer<ffi.Pointer<ffi.Void>> param_values,
-    int param_count,
-    ffi.Pointer<ffi.Pointer<ffi.Char>> out_value,
-    ffi.Pointer<ffi.Int> out_has_value,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<quiver_filter_t> filter,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
   ) {
-    return _quiver_database_query_string_params(
+    return _quiver_database_read_set_floats_flat_filtered(
       db,
-      sql,
-      param_types,
-      param_values,
-      param_count,
-      out_value,
-      out_has_value,
+      collection,
+      attribute,
+      filter,
+      out_values,
+      out_offsets,
+      out_count,
     );
   }
 
-  late final _quiver_database_query_string_paramsPtr =
+  late final _quiver_database_read_set_floats_flat_filteredPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Int>,
-            ffi.Pointer<ffi.Pointer<ffi.Void>>,
-            ffi.Size,
-            ffi.Pointer<ffi.Pointer<ffi.Char>>,
-            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_filter_t>,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
           )
         >
-      >('quiver_database_query_string_params');
-  late final _quiver_database_query_string_params = _quiver_database_query_string_paramsPtr
+      >('quiver_database_read_set_floats_flat_filtered');
+  late final _quiver_database_read_set_floats_flat_filtered = _quiver_database_read_set_floats_flat_filteredPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Int>,
-          ffi.Pointer<ffi.Pointer<ffi.Void>>,
-          int,
-          ffi.Pointer<ffi.Pointer<ffi.Char>>,
-          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_filter_t>,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
         )
       >();
 
-  int quiver_database_query_integer_params(
+  int quiver_database_read_set_strings_flat_filtered(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> sql,
-    ffi.Pointer<ffi.Int> param_types,
-    ffi.Pointer<ffi.Pointer<ffi.Void>> param_values,
-    int param_count,
-    ffi.Pointer<ffi.Int64> out_value,
-    ffi.Pointer<ffi.Int> out_has_value,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<quiver_filter_t> filter,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_offsets,
+    ffi.Pointer<ffi.Size> out_count,
   ) {
-    return _quiver_database_query_integer_params(
+    return _quiver_database_read_set_strings_flat_filtered(
       db,
-      sql,
-      param_types,
-      param_values,
-      param_count,
-      out_value,
-      out_has_value,
+      collection,
+      attribute,
+      filter,
+      out_values,
+      out_offsets,
+      out_count,
     );
   }
 
-  late final _quiver_database_query_integer_paramsPtr =
+  late final _quiver_database_read_set_strings_flat_filteredPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Int>,
-            ffi.Pointer<ffi.Pointer<ffi.Void>>,
-            ffi.Size,
-            ffi.Pointer<ffi.Int64>,
-            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_filter_t>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
           )
         >
-      >('quiver_database_query_integer_params');
-  late final _quiver_database_query_integer_params = _quiver_database_query_integer_paramsPtr
+      >('quiver_database_read_set_strings_flat_filtered');
+  late final _quiver_database_read_set_strings_flat_filtered = _quiver_database_read_set_strings_flat_filteredPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Int>,
-          ffi.Pointer<ffi.Pointer<ffi.Void>>,
-          int,
-          ffi.Pointer<ffi.Int64>,
-          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_filter_t>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
         )
       >();
 
-  int quiver_database_query_float_params(
+  int quiver_database_delete_elements_where(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> sql,
-    ffi.Pointer<ffi.Int> param_types,
-    ffi.Pointer<ffi.Pointer<ffi.Void>> param_values,
-    int param_count,
-    ffi.Pointer<ffi.Double> out_value,
-    ffi.Pointer<ffi.Int> out_has_value,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<quiver_filter_t> filter,
+    ffi.Pointer<ffi.Size> out_deleted,
   ) {
-    return _quiver_database_query_float_params(
+    return _quiver_database_delete_elements_where(
       db,
-      sql,
-      param_types,
-      param_values,
-      param_count,
-      out_value,
-      out_has_value,
+      collection,
+      filter,
+      out_deleted,
     );
   }
 
-  late final _quiver_database_query_float_paramsPtr =
+  late final _quiver_database_delete_elements_wherePtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Int>,
-            ffi.Pointer<ffi.Pointer<ffi.Void>>,
-            ffi.Size,
-            ffi.Pointer<ffi.Double>,
-            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<quiver_filter_t>,
+            ffi.Pointer<ffi.Size>,
           )
         >
-      >('quiver_database_query_float_params');
-  late final _quiver_database_query_float_params = _quiver_database_query_float_paramsPtr
+      >('quiver_database_delete_elements_where');
+  late final _quiver_database_delete_elements_where = _quiver_database_delete_elements_wherePtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Int>,
-          ffi.Pointer<ffi.Pointer<ffi.Void>>,
-          int,
-          ffi.Pointer<ffi.Double>,
-          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<quiver_filter_t>,
+          ffi.Pointer<ffi.Size>,
         )
       >();
 
-  int quiver_database_describe(
-    ffi.Pointer<quiver_database_t> db,
-  ) {
-    return _quiver_database_describe(
-      db,
-    );
-  }
-
-  late final _quiver_database_describePtr =
-      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>)>>('quiver_database_describe');
-  late final _quiver_database_describe = _quiver_database_describePtr
-      .asFunction<int Function(ffi.Pointer<quiver_database_t>)>();
-
   ffi.Pointer<quiver_element_t1> quiver_element_create() {
     return _quiver_element_create();
   }
@@ -2439,28 +7771,272 @@ class QuiverDatabaseBindings {
   int quiver_element_scalar_count(
     ffi.Pointer<quiver_element_t1> element,
   ) {
-    return _quiver_element_scalar_count(
+    return _quiver_element_scalar_count(
+      element,
+    );
+  }
+
+  late final _quiver_element_scalar_countPtr =
+      _lookup<ffi.NativeFunction<ffi.Size Function(ffi.Pointer<quiver_element_t1>)>>('quiver_element_scalar_count');
+  late final _quiver_element_scalar_count = _quiver_element_scalar_countPtr
+      .asFunction<int Function(ffi.Pointer<quiver_element_t1>)>();
+
+  int quiver_element_array_count(
+    ffi.Pointer<quiver_element_t1> element,
+  ) {
+    return _quiver_element_array_count(
+      element,
+    );
+  }
+
+  late final _quiver_element_array_countPtr =
+      _lookup<ffi.NativeFunction<ffi.Size Function(ffi.Pointer<quiver_element_t1>)>>('quiver_element_array_count');
+  late final _quiver_element_array_count = _quiver_element_array_countPtr
+      .asFunction<int Function(ffi.Pointer<quiver_element_t1>)>();
+
+  ffi.Pointer<ffi.Char> quiver_element_scalar_name(
+    ffi.Pointer<quiver_element_t1> element,
+    int index,
+  ) {
+    return _quiver_element_scalar_name(
+      element,
+      index,
+    );
+  }
+
+  late final _quiver_element_scalar_namePtr =
+      _lookup<ffi.NativeFunction<ffi.Pointer<ffi.Char> Function(ffi.Pointer<quiver_element_t1>, ffi.Size)>>(
+        'quiver_element_scalar_name',
+      );
+  late final _quiver_element_scalar_name = _quiver_element_scalar_namePtr
+      .asFunction<ffi.Pointer<ffi.Char> Function(ffi.Pointer<quiver_element_t1>, int)>();
+
+  ffi.Pointer<ffi.Char> quiver_element_array_name(
+    ffi.Pointer<quiver_element_t1> element,
+    int index,
+  ) {
+    return _quiver_element_array_name(
+      element,
+      index,
+    );
+  }
+
+  late final _quiver_element_array_namePtr =
+      _lookup<ffi.NativeFunction<ffi.Pointer<ffi.Char> Function(ffi.Pointer<quiver_element_t1>, ffi.Size)>>(
+        'quiver_element_array_name',
+      );
+  late final _quiver_element_array_name = _quiver_element_array_namePtr
+      .asFunction<ffi.Pointer<ffi.Char> Function(ffi.Pointer<quiver_element_t1>, int)>();
+
+  int quiver_element_get_integer(
+    ffi.Pointer<quiver_element_t1> element,
+    ffi.Pointer<ffi.Char> name,
+    ffi.Pointer<ffi.Int64> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_element_get_integer(
+      element,
+      name,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_element_get_integerPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_element_t1>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Pointer<ffi.Int>,
+          )
+        >
+      >('quiver_element_get_integer');
+  late final _quiver_element_get_integer = _quiver_element_get_integerPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_element_t1>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
+          ffi.Pointer<ffi.Int>,
+        )
+      >();
+
+  int quiver_element_get_float(
+    ffi.Pointer<quiver_element_t1> element,
+    ffi.Pointer<ffi.Char> name,
+    ffi.Pointer<ffi.Double> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_element_get_float(
+      element,
+      name,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_element_get_floatPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_element_t1>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Double>,
+            ffi.Pointer<ffi.Int>,
+          )
+        >
+      >('quiver_element_get_float');
+  late final _quiver_element_get_float = _quiver_element_get_floatPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_element_t1>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Double>,
+          ffi.Pointer<ffi.Int>,
+        )
+      >();
+
+  int quiver_element_get_string(
+    ffi.Pointer<quiver_element_t1> element,
+    ffi.Pointer<ffi.Char> name,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_element_get_string(
+      element,
+      name,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_element_get_stringPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_element_t1>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Pointer<ffi.Int>,
+          )
+        >
+      >('quiver_element_get_string');
+  late final _quiver_element_get_string = _quiver_element_get_stringPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_element_t1>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          ffi.Pointer<ffi.Int>,
+        )
+      >();
+
+  int quiver_element_get_array_integer(
+    ffi.Pointer<quiver_element_t1> element,
+    ffi.Pointer<ffi.Char> name,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_element_get_array_integer(
+      element,
+      name,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_element_get_array_integerPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_element_t1>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_element_get_array_integer');
+  late final _quiver_element_get_array_integer = _quiver_element_get_array_integerPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_element_t1>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_element_get_array_float(
+    ffi.Pointer<quiver_element_t1> element,
+    ffi.Pointer<ffi.Char> name,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_element_get_array_float(
       element,
+      name,
+      out_values,
+      out_count,
     );
   }
 
-  late final _quiver_element_scalar_countPtr =
-      _lookup<ffi.NativeFunction<ffi.Size Function(ffi.Pointer<quiver_element_t1>)>>('quiver_element_scalar_count');
-  late final _quiver_element_scalar_count = _quiver_element_scalar_countPtr
-      .asFunction<int Function(ffi.Pointer<quiver_element_t1>)>();
+  late final _quiver_element_get_array_floatPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_element_t1>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_element_get_array_float');
+  late final _quiver_element_get_array_float = _quiver_element_get_array_floatPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_element_t1>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
 
-  int quiver_element_array_count(
+  int quiver_element_get_array_string(
     ffi.Pointer<quiver_element_t1> element,
+    ffi.Pointer<ffi.Char> name,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
   ) {
-    return _quiver_element_array_count(
+    return _quiver_element_get_array_string(
       element,
+      name,
+      out_values,
+      out_count,
     );
   }
 
-  late final _quiver_element_array_countPtr =
-      _lookup<ffi.NativeFunction<ffi.Size Function(ffi.Pointer<quiver_element_t1>)>>('quiver_element_array_count');
-  late final _quiver_element_array_count = _quiver_element_array_countPtr
-      .asFunction<int Function(ffi.Pointer<quiver_element_t1>)>();
+  late final _quiver_element_get_array_stringPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_element_t1>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_element_get_array_string');
+  late final _quiver_element_get_array_string = _quiver_element_get_array_stringPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_element_t1>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
 
   ffi.Pointer<ffi.Char> quiver_element_to_string(
     ffi.Pointer<quiver_element_t1> element,
@@ -2535,7 +8111,97 @@ class QuiverDatabaseBindings {
   late final _quiver_lua_runner_run = _quiver_lua_runner_runPtr
       .asFunction<int Function(ffi.Pointer<quiver_lua_runner_t>, ffi.Pointer<ffi.Char>)>();
 
-  ffi.Pointer<ffi.Char> quiver_lua_runner_get_error(
+  int quiver_lua_runner_compile(
+    ffi.Pointer<quiver_lua_runner_t> runner,
+    ffi.Pointer<ffi.Char> name,
+    ffi.Pointer<ffi.Char> script,
+    ffi.Pointer<ffi.Size> out_handle,
+  ) {
+    return _quiver_lua_runner_compile(
+      runner,
+      name,
+      script,
+      out_handle,
+    );
+  }
+
+  late final _quiver_lua_runner_compilePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_lua_runner_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_lua_runner_compile');
+  late final _quiver_lua_runner_compile = _quiver_lua_runner_compilePtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_lua_runner_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_lua_runner_run_compiled(
+    ffi.Pointer<quiver_lua_runner_t> runner,
+    int handle,
+    ffi.Pointer<ffi.Int> arg_types,
+    ffi.Pointer<ffi.Pointer<ffi.Void>> arg_values,
+    int arg_count,
+  ) {
+    return _quiver_lua_runner_run_compiled(
+      runner,
+      handle,
+      arg_types,
+      arg_values,
+      arg_count,
+    );
+  }
+
+  late final _quiver_lua_runner_run_compiledPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_lua_runner_t>,
+            ffi.Size,
+            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Pointer<ffi.Void>>,
+            ffi.Size,
+          )
+        >
+      >('quiver_lua_runner_run_compiled');
+  late final _quiver_lua_runner_run_compiled = _quiver_lua_runner_run_compiledPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_lua_runner_t>,
+          int,
+          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Pointer<ffi.Void>>,
+          int,
+        )
+      >();
+
+  int quiver_lua_runner_release(
+    ffi.Pointer<quiver_lua_runner_t> runner,
+    int handle,
+  ) {
+    return _quiver_lua_runner_release(
+      runner,
+      handle,
+    );
+  }
+
+  late final _quiver_lua_runner_releasePtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_lua_runner_t>, ffi.Size)>>(
+        'quiver_lua_runner_release',
+      );
+  late final _quiver_lua_runner_release = _quiver_lua_runner_releasePtr
+      .asFunction<int Function(ffi.Pointer<quiver_lua_runner_t>, int)>();
+
     ffi.Pointer<quiver_lua_runner_t> runner,
   ) {
     return _quiver_lua_runner_get_error(
@@ -2559,6 +8225,7 @@ abstract class quiver_error_t {
   static const int QUIVER_ERROR_SCHEMA = -4;
   static const int QUIVER_ERROR_CREATE_ELEMENT = -5;
   static const int QUIVER_ERROR_NOT_FOUND = -6;
+  static const int QUIVER_ERROR_CANCELLED = -7;
 }
 
 abstract class quiver_log_level_t {
@@ -2569,12 +8236,214 @@ abstract class quiver_log_level_t {
   static const int QUIVER_LOG_OFF = 4;
 }
 
+abstract class quiver_journal_mode_t {
+  static const int QUIVER_JOURNAL_MODE_DEFAULT = 0;
+  static const int QUIVER_JOURNAL_MODE_DELETE = 1;
+  static const int QUIVER_JOURNAL_MODE_TRUNCATE = 2;
+  static const int QUIVER_JOURNAL_MODE_WAL = 3;
+  static const int QUIVER_JOURNAL_MODE_MEMORY = 4;
+  static const int QUIVER_JOURNAL_MODE_OFF = 5;
+}
+
+abstract class quiver_synchronous_t {
+  static const int QUIVER_SYNCHRONOUS_DEFAULT = 0;
+  static const int QUIVER_SYNCHRONOUS_OFF = 1;
+  static const int QUIVER_SYNCHRONOUS_NORMAL = 2;
+  static const int QUIVER_SYNCHRONOUS_FULL = 3;
+  static const int QUIVER_SYNCHRONOUS_EXTRA = 4;
+}
+
+abstract class quiver_temp_store_t {
+  static const int QUIVER_TEMP_STORE_DEFAULT = 0;
+  static const int QUIVER_TEMP_STORE_FILE = 1;
+  static const int QUIVER_TEMP_STORE_MEMORY = 2;
+}
+
 final class quiver_database_options_t extends ffi.Struct {
   @ffi.Int()
   external int read_only;
 
   @ffi.Int32()
   external int console_level;
+
+  @ffi.Int()
+  external int statement_cache_size;
+
+  @ffi.Int32()
+  external int journal_mode;
+
+  @ffi.Int32()
+  external int synchronous;
+
+  @ffi.Int32()
+  external int temp_store;
+
+  @ffi.Int()
+  external int page_size;
+
+  @ffi.Int64()
+  external int cache_size;
+
+  @ffi.Int64()
+  external int mmap_size;
+
+  @ffi.Int()
+  external int mapped;
+
+  @ffi.Int()
+  external int validate_schema;
+
+  @ffi.Int32()
+  external int file_level;
+
+  @ffi.Int()
+  external int async_logging;
+
+  @ffi.Int()
+  external int collect_stats;
+
+  @ffi.Int64()
+  external int slow_query_ms;
+
+  @ffi.Int64()
+  external int busy_timeout_ms;
+
+  @ffi.Int64()
+  external int statement_timeout_ms;
+
+  @ffi.Int()
+  external int load_into_memory;
+
+  @ffi.Int()
+  external int track_changes;
+
+  @ffi.Int()
+  external int cache_reads;
+
+  @ffi.Int64()
+  external int read_cache_limit;
+
+  @ffi.Int64()
+  external int soft_heap_limit;
+
+  @ffi.Int64()
+  external int hard_heap_limit;
+}
+
+final class quiver_statement_cache_stats_t extends ffi.Struct {
+  @ffi.Int64()
+  external int hits;
+
+  @ffi.Int64()
+  external int misses;
+
+  @ffi.Size()
+  external int size;
+
+  @ffi.Size()
+  external int capacity;
+}
+
+final class quiver_operation_stats_t extends ffi.Struct {
+  external ffi.Pointer<ffi.Char> name;
+
+  @ffi.Int64()
+  external int calls;
+
+  @ffi.Int64()
+  external int total_ns;
+
+  @ffi.Int64()
+  external int max_ns;
+
+  @ffi.Int64()
+  external int rows_read;
+
+  @ffi.Int64()
+  external int rows_written;
+}
+
+final class quiver_statement_stats_t extends ffi.Struct {
+  external ffi.Pointer<ffi.Char> sql;
+
+  @ffi.Int64()
+  external int prepares;
+
+  @ffi.Int64()
+  external int prepare_ns;
+
+  @ffi.Int64()
+  external int executions;
+
+  @ffi.Int64()
+  external int total_ns;
+
+  @ffi.Int64()
+  external int max_ns;
+
+  @ffi.Int64()
+  external int rows_read;
+
+  @ffi.Int64()
+  external int rows_written;
+}
+
+final class quiver_database_stats_t extends ffi.Struct {
+  external ffi.Pointer<quiver_operation_stats_t> operations;
+
+  @ffi.Size()
+  external int operation_count;
+
+  external ffi.Pointer<quiver_statement_stats_t> statements;
+
+  @ffi.Size()
+  external int statement_count;
+
+  external quiver_statement_cache_stats_t statement_cache;
+}
+
+final class quiver_memory_usage_t extends ffi.Struct {
+  @ffi.Int64()
+  external int page_cache;
+
+  @ffi.Int64()
+  external int sqlite_schema;
+
+  @ffi.Int64()
+  external int statements;
+
+  @ffi.Int64()
+  external int schema;
+
+  @ffi.Int64()
+  external int read_cache;
+
+  @ffi.Int64()
+  external int label_cache;
+
+  @ffi.Int64()
+  external int cache_hits;
+
+  @ffi.Int64()
+  external int cache_misses;
+
+  @ffi.Int64()
+  external int cache_writes;
+
+  @ffi.Int64()
+  external int cache_spills;
+
+  @ffi.Int64()
+  external int sqlite_heap;
+
+  @ffi.Int64()
+  external int sqlite_heap_highwater;
+
+  @ffi.Int64()
+  external int soft_heap_limit;
+
+  @ffi.Int64()
+  external int total;
 }
 
 abstract class quiver_data_structure_t {
@@ -2589,16 +8458,50 @@ abstract class quiver_data_type_t {
   static const int QUIVER_DATA_TYPE_STRING = 2;
   static const int QUIVER_DATA_TYPE_DATE_TIME = 3;
   static const int QUIVER_DATA_TYPE_NULL = 4;
+  static const int QUIVER_DATA_TYPE_BLOB = 5;
 }
 
 final class quiver_database extends ffi.Opaque {}
 
 typedef quiver_database_t = quiver_database;
+typedef quiver_backup_progress_t = ffi.Pointer<ffi.NativeFunction<quiver_backup_progress_tFunction>>;
+typedef quiver_backup_progress_tFunction = ffi.Void Function(ffi.Int remaining, ffi.Int total, ffi.Pointer<ffi.Void> user_data);
+typedef Dartquiver_backup_progress_tFunction = void Function(int remaining, int total, ffi.Pointer<ffi.Void> user_data);
+typedef quiver_progress_callback_t = ffi.Pointer<ffi.NativeFunction<quiver_progress_callback_tFunction>>;
+typedef quiver_progress_callback_tFunction = ffi.Int Function(ffi.Pointer<ffi.Void> user_data);
+typedef Dartquiver_progress_callback_tFunction = int Function(ffi.Pointer<ffi.Void> user_data);
 
 final class quiver_element extends ffi.Opaque {}
 
 typedef quiver_element_t = quiver_element;
 
+final class quiver_attribute_handle extends ffi.Opaque {}
+
+typedef quiver_attribute_handle_t = quiver_attribute_handle;
+
+final class quiver_cursor extends ffi.Opaque {}
+
+typedef quiver_cursor_t = quiver_cursor;
+
+final class quiver_result extends ffi.Opaque {}
+
+typedef quiver_result_t = quiver_result;
+
+final class quiver_scalar_column_t extends ffi.Struct {
+  external ffi.Pointer<ffi.Char> name;
+
+  @ffi.Int32()
+  external int data_type;
+
+  external ffi.Pointer<ffi.Int64> integers;
+
+  external ffi.Pointer<ffi.Double> floats;
+
+  external ffi.Pointer<ffi.Pointer<ffi.Char>> strings;
+
+  external ffi.Pointer<ffi.Uint8> nulls;
+}
+
 final class quiver_scalar_metadata_t extends ffi.Struct {
   external ffi.Pointer<ffi.Char> name;
 
@@ -2632,8 +8535,115 @@ final class quiver_set_metadata_t extends ffi.Struct {
   external int value_column_count;
 }
 
+final class ArrowSchema extends ffi.Struct {
+  external ffi.Pointer<ffi.Char> format;
+
+  external ffi.Pointer<ffi.Char> name;
+
+  external ffi.Pointer<ffi.Char> metadata;
+
+  @ffi.Int64()
+  external int flags;
+
+  @ffi.Int64()
+  external int n_children;
+
+  external ffi.Pointer<ffi.Pointer<ArrowSchema>> children;
+
+  external ffi.Pointer<ArrowSchema> dictionary;
+
+  external ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ArrowSchema>)>> release;
+
+  external ffi.Pointer<ffi.Void> private_data;
+}
+
+final class ArrowArray extends ffi.Struct {
+  @ffi.Int64()
+  external int length;
+
+  @ffi.Int64()
+  external int null_count;
+
+  @ffi.Int64()
+  external int offset;
+
+  @ffi.Int64()
+  external int n_buffers;
+
+  @ffi.Int64()
+  external int n_children;
+
+  external ffi.Pointer<ffi.Pointer<ffi.Void>> buffers;
+
+  external ffi.Pointer<ffi.Pointer<ArrowArray>> children;
+
+  external ffi.Pointer<ArrowArray> dictionary;
+
+  external ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ArrowArray>)>> release;
+
+  external ffi.Pointer<ffi.Void> private_data;
+}
+
+final class quiver_future extends ffi.Opaque {}
+
+typedef quiver_future_t = quiver_future;
+
+abstract class quiver_change_kind_t {
+  static const int QUIVER_CHANGE_CREATED = 0;
+  static const int QUIVER_CHANGE_UPDATED = 1;
+  static const int QUIVER_CHANGE_DELETED = 2;
+}
+
+final class quiver_change_t extends ffi.Struct {
+  external ffi.Pointer<ffi.Char> collection;
+
+  @ffi.Int64()
+  external int id;
+
+  external ffi.Pointer<ffi.Char> attribute;
+
+  @ffi.Int32()
+  external int kind;
+}
+
+final class quiver_filter extends ffi.Opaque {}
+
+typedef quiver_filter_t = quiver_filter;
+
+abstract class quiver_filter_op_t {
+  static const int QUIVER_FILTER_EQUAL = 0;
+  static const int QUIVER_FILTER_NOT_EQUAL = 1;
+  static const int QUIVER_FILTER_LESS = 2;
+  static const int QUIVER_FILTER_LESS_EQUAL = 3;
+  static const int QUIVER_FILTER_GREATER = 4;
+  static const int QUIVER_FILTER_GREATER_EQUAL = 5;
+  static const int QUIVER_FILTER_IS_NULL = 6;
+  static const int QUIVER_FILTER_IS_NOT_NULL = 7;
+}
+
+abstract class quiver_aggregate_t {
+  static const int QUIVER_AGGREGATE_SUM = 0;
+  static const int QUIVER_AGGREGATE_MEAN = 1;
+  static const int QUIVER_AGGREGATE_MIN = 2;
+  static const int QUIVER_AGGREGATE_MAX = 3;
+  static const int QUIVER_AGGREGATE_COUNT = 4;
+}
+
+abstract class quiver_time_bucket_t {
+  static const int QUIVER_TIME_BUCKET_YEAR = 0;
+  static const int QUIVER_TIME_BUCKET_MONTH = 1;
+  static const int QUIVER_TIME_BUCKET_DAY = 2;
+  static const int QUIVER_TIME_BUCKET_HOUR = 3;
+}
+
 typedef quiver_element_t1 = quiver_element;
 
 final class quiver_lua_runner extends ffi.Opaque {}
 
 typedef quiver_lua_runner_t = quiver_lua_runner;
+
+const int ARROW_FLAG_DICTIONARY_ORDERED = 1;
+
+const int ARROW_FLAG_NULLABLE = 2;
+
+const int ARROW_FLAG_MAP_KEYS_SORTED = 4;
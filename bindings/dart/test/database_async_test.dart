@@ -0,0 +1,88 @@
+import 'package:quiver_db/quiver_db.dart';
+import 'package:test/test.dart';
+import 'package:path/path.dart' as path;
+
+void main() {
+  // Path to central tests folder
+  final testsPath = path.join(
+    path.current,
+    '..',
+    '..',
+    'tests',
+  );
+
+  Database openCollections() {
+    final db = Database.fromSchema(
+      ':memory:',
+      path.join(testsPath, 'schemas', 'valid', 'collections.sql'),
+    );
+    db.createElement('Configuration', {'label': 'Test Config'});
+    db.createElement('Collection', {
+      'label': 'Item 1',
+      'some_integer': 10,
+      'value_float': [0.5],
+    });
+    db.createElement('Collection', {
+      'label': 'Item 2',
+      'some_integer': 20,
+      'value_float': [1.0, 1.5],
+    });
+    return db;
+  }
+
+  group('Async Reads', () {
+    test('reads scalars on the worker thread', () async {
+      final db = openCollections();
+      try {
+        expect(await db.readScalarIntegersAsync('Collection', 'some_integer').value, equals([10, 20]));
+        expect(await db.readScalarStringsAsync('Collection', 'label').value, equals(['Item 1', 'Item 2']));
+        expect(await db.readScalarFloatsAsync('Collection', 'some_float').value, isEmpty);
+      } finally {
+        db.close();
+      }
+    });
+
+    test('groups vector reads per element', () async {
+      final db = openCollections();
+      try {
+        expect(
+          await db.readVectorFloatsAsync('Collection', 'value_float').value,
+          equals([
+            [0.5],
+            [1.0, 1.5],
+          ]),
+        );
+      } finally {
+        db.close();
+      }
+    });
+
+    test('reports errors when the value is awaited', () async {
+      final db = openCollections();
+      try {
+        final future = db.readScalarIntegersAsync('NonexistentCollection', 'some_integer');
+        await expectLater(future.value, throwsA(isA<DatabaseException>()));
+      } finally {
+        db.close();
+      }
+    });
+  });
+
+  group('Async Cancellation', () {
+    test('cancelled operations throw CancelledException', () async {
+      final db = openCollections();
+      try {
+        final futures = List.generate(32, (_) => db.readVectorFloatsAsync('Collection', 'value_float'));
+        // The last operation is still queued behind the others
+        futures.last.cancel();
+        await expectLater(futures.last.value, throwsA(isA<CancelledException>()));
+        expect(await futures.first.value, hasLength(2));
+        for (final future in futures) {
+          future.dispose();
+        }
+      } finally {
+        db.close();
+      }
+    });
+  });
+}
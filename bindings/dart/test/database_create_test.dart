@@ -415,4 +415,47 @@ void main() {
       }
     });
   });
+
+  group('Create Multiple Elements', () {
+    test('creates elements in one call', () {
+      final db = Database.fromSchema(
+        ':memory:',
+        path.join(testsPath, 'schemas', 'valid', 'collections.sql'),
+      );
+      try {
+        db.createElement('Configuration', {'label': 'Test Config'});
+
+        final ids = db.createElements('Collection', [
+          {'label': 'Item 1', 'value_int': [1, 2]},
+          {'label': 'Item 2', 'tag': ['a', 'b']},
+          {'label': 'Item 3'},
+        ]);
+        expect(ids, equals([1, 2, 3]));
+
+        expect(db.readScalarStrings('Collection', 'label'), equals(['Item 1', 'Item 2', 'Item 3']));
+        expect(db.readVectorIntegersById('Collection', 'value_int', 1), equals([1, 2]));
+      } finally {
+        db.close();
+      }
+    });
+
+    test('rolls back all elements on failure', () {
+      final db = Database.fromSchema(
+        ':memory:',
+        path.join(testsPath, 'schemas', 'valid', 'basic.sql'),
+      );
+      try {
+        expect(
+          () => db.createElements('Configuration', [
+            {'label': 'Config 1'},
+            {'label': 'Config 1'},
+          ]),
+          throwsA(isA<DatabaseException>()),
+        );
+        expect(db.readScalarStrings('Configuration', 'label'), isEmpty);
+      } finally {
+        db.close();
+      }
+    });
+  });
 }
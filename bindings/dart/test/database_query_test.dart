@@ -388,4 +388,57 @@ void main() {
       }
     });
   });
+
+  group('For Each Row', () {
+    test('streams rows with typed values and nulls', () {
+      final db = Database.fromSchema(
+        ':memory:',
+        path.join(testsPath, 'schemas', 'valid', 'basic.sql'),
+      );
+      try {
+        db.createElement('Configuration', {'label': 'A', 'integer_attribute': 1, 'float_attribute': 1.5});
+        db.createElement('Configuration', {'label': 'B', 'integer_attribute': 2});
+
+        final rows = <List<Object?>>[];
+        final count = db.forEachRow(
+          'SELECT label, integer_attribute, float_attribute FROM Configuration ORDER BY id',
+          rows.add,
+        );
+        expect(count, equals(2));
+        expect(rows[0], equals(['A', 1, 1.5]));
+        expect(rows[1], equals(['B', 2, null]));
+      } finally {
+        db.close();
+      }
+    });
+
+    test('binds parameters', () {
+      final db = Database.fromSchema(
+        ':memory:',
+        path.join(testsPath, 'schemas', 'valid', 'basic.sql'),
+      );
+      try {
+        db.createElement('Configuration', {'label': 'A', 'integer_attribute': 1});
+        db.createElement('Configuration', {'label': 'B', 'integer_attribute': 2});
+
+        final labels = <Object?>[];
+        db.forEachRow('SELECT label FROM Configuration WHERE integer_attribute > ?', (row) => labels.add(row[0]), [1]);
+        expect(labels, equals(['B']));
+      } finally {
+        db.close();
+      }
+    });
+
+    test('throws on invalid SQL', () {
+      final db = Database.fromSchema(
+        ':memory:',
+        path.join(testsPath, 'schemas', 'valid', 'basic.sql'),
+      );
+      try {
+        expect(() => db.forEachRow('SELECT * FROM Missing', (_) {}), throwsA(isA<DatabaseException>()));
+      } finally {
+        db.close();
+      }
+    });
+  });
 }
@@ -87,6 +87,46 @@ void main() {
         db.close();
       }
     });
+
+    test('nullable readers keep gaps aligned with ids', () {
+      final db = Database.fromSchema(
+        ':memory:',
+        path.join(testsPath, 'schemas', 'valid', 'basic.sql'),
+      );
+      try {
+        db.createElement('Configuration', {'label': 'Config 1', 'float_attribute': 1.5});
+        db.createElement('Configuration', {'label': 'Config 2', 'string_attribute': 'x'});
+
+        expect(db.readScalarFloatsNullable('Configuration', 'float_attribute'), equals([1.5, null]));
+        expect(db.readScalarStringsNullable('Configuration', 'string_attribute'), equals([null, 'x']));
+        expect(db.readScalarIntegersNullable('Configuration', 'integer_attribute'), equals([6, 6]));
+      } finally {
+        db.close();
+      }
+    });
+
+    test('reads several attributes in one pass', () {
+      final db = Database.fromSchema(
+        ':memory:',
+        path.join(testsPath, 'schemas', 'valid', 'basic.sql'),
+      );
+      try {
+        db.createElement('Configuration', {'label': 'Config 1', 'float_attribute': 1.5});
+        db.createElement('Configuration', {'label': 'Config 2', 'integer_attribute': 9});
+
+        final result = db.readScalars('Configuration', ['label', 'integer_attribute', 'float_attribute']);
+        expect(result.ids, equals(db.readElementIds('Configuration')));
+        expect(result.columns['label'], equals(['Config 1', 'Config 2']));
+        expect(result.columns['integer_attribute'], equals([6, 9]));
+        expect(result.columns['float_attribute'], equals([1.5, null]));
+        expect(
+          () => db.readScalars('Configuration', ['missing']),
+          throwsA(isA<DatabaseException>()),
+        );
+      } finally {
+        db.close();
+      }
+    });
   });
 
   group('Read From Collections', () {
@@ -251,6 +291,53 @@ void main() {
     });
   });
 
+  group('Read Vector Flat', () {
+    test('returns groups as views into one buffer', () {
+      final db = Database.fromSchema(
+        ':memory:',
+        path.join(testsPath, 'schemas', 'valid', 'collections.sql'),
+      );
+      try {
+        db.createElement('Configuration', {'label': 'Test Config'});
+        db.createElement('Collection', {
+          'label': 'Item 1',
+          'value_int': [1, 2, 3],
+          'value_float': [1.5, 2.5, 3.5],
+        });
+        db.createElement('Collection', {'label': 'Item 2'});
+        db.createElement('Collection', {
+          'label': 'Item 3',
+          'value_int': [4, 5],
+          'value_float': [4.5, 5.5],
+        });
+
+        final ints = db.readVectorIntegersFlat('Collection', 'value_int');
+        expect(ints.length, equals(2));
+        expect(ints[0], equals([1, 2, 3]));
+        expect(ints[1], equals([4, 5]));
+        expect(identical(ints[0].buffer, ints[1].buffer), isTrue);
+
+        final floats = db.readVectorFloatsFlat('Collection', 'value_float');
+        expect(floats[1], equals([4.5, 5.5]));
+      } finally {
+        db.close();
+      }
+    });
+
+    test('returns empty list when no data', () {
+      final db = Database.fromSchema(
+        ':memory:',
+        path.join(testsPath, 'schemas', 'valid', 'collections.sql'),
+      );
+      try {
+        db.createElement('Configuration', {'label': 'Test Config'});
+        expect(db.readVectorFloatsFlat('Collection', 'value_float'), isEmpty);
+      } finally {
+        db.close();
+      }
+    });
+  });
+
   group('Read Set Attributes', () {
     test('reads string sets from Collection', () {
       final db = Database.fromSchema(
@@ -554,6 +641,50 @@ void main() {
     });
   });
 
+  group('Read by IDs', () {
+    test('returns one entry per id in input order', () {
+      final db = Database.fromSchema(
+        ':memory:',
+        path.join(testsPath, 'schemas', 'valid', 'collections.sql'),
+      );
+      try {
+        db.createElement('Configuration', {'label': 'Test Config'});
+        final id1 = db.createElement('Collection', {
+          'label': 'Item 1',
+          'some_integer': 7,
+          'value_int': [1, 2, 3],
+        });
+        final id2 = db.createElement('Collection', {
+          'label': 'Item 2',
+          'tag': ['a'],
+        });
+
+        final ids = [id2, 999, id1];
+        expect(db.readScalarIntegersByIds('Collection', 'some_integer', ids), equals([null, null, 7]));
+        expect(db.readScalarStringsByIds('Collection', 'label', ids), equals(['Item 2', null, 'Item 1']));
+        expect(
+          db.readVectorIntegersByIds('Collection', 'value_int', ids),
+          equals([<int>[], <int>[], [1, 2, 3]]),
+        );
+        expect(
+          db.readSetStringsByIds('Collection', 'tag', ids),
+          equals([
+            ['a'],
+            <String>[],
+            <String>[],
+          ]),
+        );
+        expect(db.readScalarFloatsByIds('Collection', 'some_float', []), isEmpty);
+        expect(
+          () => db.readScalarFloatsByIds('Collection', 'missing', ids),
+          throwsA(isA<DatabaseException>()),
+        );
+      } finally {
+        db.close();
+      }
+    });
+  });
+
   // Read element IDs tests
 
   group('Read Element IDs', () {
@@ -107,4 +107,35 @@ void main() {
       }
     });
   });
+
+  group('Set Scalar Relations Bulk', () {
+    test('sets many relations and reads ids', () {
+      final db = Database.fromSchema(
+        ':memory:',
+        path.join(testsPath, 'schemas', 'valid', 'relations.sql'),
+      );
+      try {
+        db.createElement('Parent', {'label': 'Parent 1'});
+        db.createElement('Parent', {'label': 'Parent 2'});
+        db.createElement('Child', {'label': 'Child 1'});
+        db.createElement('Child', {'label': 'Child 2'});
+        db.createElement('Child', {'label': 'Child 3'});
+
+        db.setScalarRelations('Child', 'parent_id', ['Child 1', 'Child 3'], ['Parent 2', 'Parent 1']);
+
+        expect(db.readScalarRelation('Child', 'parent_id'), equals(['Parent 2', null, 'Parent 1']));
+        expect(db.readScalarRelationIds('Child', 'parent_id'), equals([2, 0, 1]));
+        expect(
+          () => db.setScalarRelations('Child', 'parent_id', ['Child 2'], ['Parent 9']),
+          throwsA(isA<DatabaseException>()),
+        );
+        expect(
+          () => db.setScalarRelations('Child', 'parent_id', ['Child 2'], []),
+          throwsArgumentError,
+        );
+      } finally {
+        db.close();
+      }
+    });
+  });
 }
@@ -0,0 +1,74 @@
+import 'package:quiver_db/quiver_db.dart';
+import 'package:test/test.dart';
+import 'package:path/path.dart' as path;
+
+void main() {
+  // Path to central tests folder
+  final testsPath = path.join(
+    path.current,
+    '..',
+    '..',
+    'tests',
+  );
+
+  group('Transactions', () {
+    test('commit and rollback', () {
+      final db = Database.fromSchema(
+        ':memory:',
+        path.join(testsPath, 'schemas', 'valid', 'basic.sql'),
+      );
+      try {
+        expect(db.inTransaction, isFalse);
+        db.beginTransaction();
+        expect(db.inTransaction, isTrue);
+        db.createElement('Configuration', {'label': 'Kept'});
+        db.commit();
+
+        db.beginTransaction();
+        db.createElement('Configuration', {'label': 'Discarded'});
+        db.rollback();
+
+        expect(db.readScalarStrings('Configuration', 'label'), equals(['Kept']));
+        expect(() => db.commit(), throwsA(isA<DatabaseException>()));
+      } finally {
+        db.close();
+      }
+    });
+
+    test('transaction callback commits and returns value', () {
+      final db = Database.fromSchema(
+        ':memory:',
+        path.join(testsPath, 'schemas', 'valid', 'basic.sql'),
+      );
+      try {
+        final ids = db.transaction(() => [
+              for (var i = 1; i <= 5; i++) db.createElement('Configuration', {'label': 'Config $i'}),
+            ]);
+        expect(ids, equals([1, 2, 3, 4, 5]));
+        expect(db.inTransaction, isFalse);
+      } finally {
+        db.close();
+      }
+    });
+
+    test('transaction callback rolls back on exception', () {
+      final db = Database.fromSchema(
+        ':memory:',
+        path.join(testsPath, 'schemas', 'valid', 'basic.sql'),
+      );
+      try {
+        expect(
+          () => db.transaction(() {
+            db.createElement('Configuration', {'label': 'Config 1'});
+            throw StateError('abort');
+          }),
+          throwsStateError,
+        );
+        expect(db.readScalarStrings('Configuration', 'label'), isEmpty);
+        expect(db.inTransaction, isFalse);
+      } finally {
+        db.close();
+      }
+    });
+  });
+}
@@ -359,6 +359,39 @@ void main() {
   // Scalar update functions tests
   // ==========================================================================
 
+  group('Update Scalars Many', () {
+    test('writes one value per id in a single call', () {
+      final db = Database.fromSchema(
+        ':memory:',
+        path.join(testsPath, 'schemas', 'valid', 'basic.sql'),
+      );
+      try {
+        final ids = [
+          for (var i = 1; i <= 3; i++) db.createElement('Configuration', {'label': 'Config $i'}),
+        ];
+
+        db.updateScalarIntegers('Configuration', 'integer_attribute', ids, [10, 20, 30]);
+        db.updateScalarFloats('Configuration', 'float_attribute', ids, [1.5, 2.5, 3.5]);
+        db.updateScalarStrings('Configuration', 'string_attribute', ids.reversed.toList(), ['c', 'b', 'a']);
+
+        expect(db.readScalarIntegers('Configuration', 'integer_attribute'), equals([10, 20, 30]));
+        expect(db.readScalarFloats('Configuration', 'float_attribute'), equals([1.5, 2.5, 3.5]));
+        expect(db.readScalarStrings('Configuration', 'string_attribute'), equals(['a', 'b', 'c']));
+
+        expect(
+          () => db.updateScalarIntegers('Configuration', 'integer_attribute', ids, [1]),
+          throwsA(isA<ArgumentError>()),
+        );
+        expect(
+          () => db.updateScalarStrings('Configuration', 'integer_attribute', ids, ['x', 'y', 'z']),
+          throwsA(isA<DatabaseException>()),
+        );
+      } finally {
+        db.close();
+      }
+    });
+  });
+
   group('Update Scalar Integer', () {
     test('basic update', () {
       final db = Database.fromSchema(
@@ -969,4 +1002,71 @@ void main() {
       }
     });
   });
+
+  group('Append Vector', () {
+    test('appends and updates single entries', () {
+      final db = Database.fromSchema(
+        ':memory:',
+        path.join(testsPath, 'schemas', 'valid', 'collections.sql'),
+      );
+      try {
+        db.createElement('Configuration', {'label': 'Test Config'});
+        final id = db.createElement('Collection', {'label': 'Item 1'});
+
+        db.appendVectorIntegers('Collection', 'value_int', id, [1, 2]);
+        db.appendVectorIntegers('Collection', 'value_int', id, [3]);
+        db.updateVectorIntegerEntry('Collection', 'value_int', id, 0, 10);
+        expect(db.readVectorIntegersById('Collection', 'value_int', id), equals([10, 2, 3]));
+
+        expect(
+          () => db.updateVectorIntegerEntry('Collection', 'value_int', id, 3, 1),
+          throwsA(isA<DatabaseException>()),
+        );
+      } finally {
+        db.close();
+      }
+    });
+  });
+
+  group('Update Time Series', () {
+    test('replaces and reads back float time series', () {
+      final db = Database.fromSchema(
+        ':memory:',
+        path.join(testsPath, 'schemas', 'valid', 'collections.sql'),
+      );
+      try {
+        db.createElement('Configuration', {'label': 'Test Config'});
+        final id = db.createElement('Collection', {'label': 'Item 1'});
+
+        db.updateTimeSeriesFloats(
+          'Collection',
+          'value',
+          id,
+          ['2024-01-02 00:00:00', '2024-01-01 00:00:00', '2024-01-03 00:00:00'],
+          [2.0, 1.0, double.nan],
+        );
+
+        final series = db.readTimeSeriesFloats('Collection', 'value', id);
+        expect(series.dateTimes, equals(['2024-01-01 00:00:00', '2024-01-02 00:00:00', '2024-01-03 00:00:00']));
+        expect(series.values.sublist(0, 2), equals([1.0, 2.0]));
+        expect(series.values[2].isNaN, isTrue);
+
+        final range = db.readTimeSeriesFloats(
+          'Collection',
+          'value',
+          id,
+          dateTimeFrom: '2024-01-02 00:00:00',
+          dateTimeTo: '2024-01-02 00:00:00',
+        );
+        expect(range.values, equals([2.0]));
+
+        expect(
+          () => db.updateTimeSeriesFloats('Collection', 'nonexistent', id, [], []),
+          throwsA(isA<DatabaseException>()),
+        );
+      } finally {
+        db.close();
+      }
+    });
+  });
 }
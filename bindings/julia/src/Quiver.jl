@@ -14,11 +14,13 @@ include("database_csv.jl")
 include("database_metadata.jl")
 include("database_query.jl")
 include("database_read.jl")
+include("database_transaction.jl")
 include("database_update.jl")
 include("database_delete.jl")
+include("attribute_handle.jl")
 include("lua_runner.jl")
 
-export Element, Database, LuaRunner, DatabaseException
+export Element, Database, LuaRunner, DatabaseException, AttributeHandle
 export ScalarMetadata, VectorMetadata, SetMetadata
 export QUIVER_DATA_TYPE_INTEGER, QUIVER_DATA_TYPE_FLOAT, QUIVER_DATA_TYPE_STRING
 
@@ -0,0 +1,102 @@
+"""
+    AttributeHandle
+
+A collection attribute resolved once with `attribute_handle`. The by-id reads and updates that take a handle
+skip converting and looking up the collection and attribute names on every call, which matters in loops that
+touch millions of elements.
+"""
+mutable struct AttributeHandle
+    ptr::Ptr{C.quiver_attribute_handle}
+    collection::String
+    attribute::String
+
+    function AttributeHandle(ptr::Ptr{C.quiver_attribute_handle}, collection::String, attribute::String)
+        handle = new(ptr, collection, attribute)
+        finalizer(h -> h.ptr != C_NULL && C.quiver_attribute_handle_free(h.ptr), handle)
+        return handle
+    end
+end
+
+function attribute_handle(db::Database, collection::String, attribute::String)
+    out_handle = Ref{Ptr{C.quiver_attribute_handle_t}}(C_NULL)
+    err = C.quiver_database_attribute_handle(db.ptr, collection, attribute, out_handle)
+    check_error(err, "Failed to resolve attribute '$collection.$attribute'")
+    return AttributeHandle(out_handle[], collection, attribute)
+end
+
+# Error messages are only built on failure, so the success path does no string work
+function _check_handle_error(err, handle::AttributeHandle, operation::String)
+    if err != C.QUIVER_OK
+        check_error(err, "Failed to $operation '$(handle.collection).$(handle.attribute)'")
+    end
+    return nothing
+end
+
+function read_scalar_integers_by_id(db::Database, handle::AttributeHandle, id::Int64)
+    out_value = Ref{Int64}(0)
+    out_has_value = Ref{Cint}(0)
+    err = C.quiver_database_read_scalar_integer_by_handle(db.ptr, handle.ptr, id, out_value, out_has_value)
+    _check_handle_error(err, handle, "read scalar integer by id from")
+    return out_has_value[] == 0 ? nothing : out_value[]
+end
+
+function read_scalar_floats_by_id(db::Database, handle::AttributeHandle, id::Int64)
+    out_value = Ref{Float64}(0.0)
+    out_has_value = Ref{Cint}(0)
+    err = C.quiver_database_read_scalar_float_by_handle(db.ptr, handle.ptr, id, out_value, out_has_value)
+    _check_handle_error(err, handle, "read scalar float by id from")
+    return out_has_value[] == 0 ? nothing : out_value[]
+end
+
+function read_scalar_strings_by_id(db::Database, handle::AttributeHandle, id::Int64)
+    out_value = Ref{Ptr{Cchar}}(C_NULL)
+    out_has_value = Ref{Cint}(0)
+    err = C.quiver_database_read_scalar_string_by_handle(db.ptr, handle.ptr, id, out_value, out_has_value)
+    _check_handle_error(err, handle, "read scalar string by id from")
+    if out_has_value[] == 0 || out_value[] == C_NULL
+        return nothing
+    end
+    result = unsafe_string(out_value[])
+    C.quiver_string_free(out_value[])
+    return result
+end
+
+# Reads into a Julia-owned buffer, growing it once when the vector is longer than the first guess
+function _read_vector_by_handle(c_function, ::Type{T}, db::Database, handle::AttributeHandle, id::Int64) where {T}
+    buffer = Vector{T}(undef, 16)
+    out_count = Ref{Csize_t}(0)
+    err = c_function(db.ptr, handle.ptr, id, buffer, length(buffer), out_count)
+    _check_handle_error(err, handle, "read vector by id from")
+    if out_count[] > length(buffer)
+        resize!(buffer, out_count[])
+        err = c_function(db.ptr, handle.ptr, id, buffer, length(buffer), out_count)
+        _check_handle_error(err, handle, "read vector by id from")
+    end
+    return resize!(buffer, out_count[])
+end
+
+function read_vector_integers_by_id(db::Database, handle::AttributeHandle, id::Int64)
+    return _read_vector_by_handle(C.quiver_database_read_vector_integers_by_handle, Int64, db, handle, id)
+end
+
+function read_vector_floats_by_id(db::Database, handle::AttributeHandle, id::Int64)
+    return _read_vector_by_handle(C.quiver_database_read_vector_floats_by_handle, Float64, db, handle, id)
+end
+
+function update_scalar_integer!(db::Database, handle::AttributeHandle, id::Int64, value::Integer)
+    err = C.quiver_database_update_scalar_integer_by_handle(db.ptr, handle.ptr, id, Int64(value))
+    _check_handle_error(err, handle, "update scalar integer")
+    return nothing
+end
+
+function update_scalar_float!(db::Database, handle::AttributeHandle, id::Int64, value::Real)
+    err = C.quiver_database_update_scalar_float_by_handle(db.ptr, handle.ptr, id, Float64(value))
+    _check_handle_error(err, handle, "update scalar float")
+    return nothing
+end
+
+function update_scalar_string!(db::Database, handle::AttributeHandle, id::Int64, value::String)
+    err = C.quiver_database_update_scalar_string_by_handle(db.ptr, handle.ptr, id, value)
+    _check_handle_error(err, handle, "update scalar string")
+    return nothing
+end
@@ -35,6 +35,7 @@ const libquiver_c = joinpath(@__DIR__, "..", "..", "..", "build", library_dir(),
     QUIVER_ERROR_SCHEMA = -4
     QUIVER_ERROR_CREATE_ELEMENT = -5
     QUIVER_ERROR_NOT_FOUND = -6
+    QUIVER_ERROR_CANCELLED = -7
 end
 
 function quiver_error_string(error)
@@ -61,9 +62,105 @@ end
     QUIVER_LOG_OFF = 4
 end
 
+@cenum quiver_journal_mode_t::UInt32 begin
+    QUIVER_JOURNAL_MODE_DEFAULT = 0
+    QUIVER_JOURNAL_MODE_DELETE = 1
+    QUIVER_JOURNAL_MODE_TRUNCATE = 2
+    QUIVER_JOURNAL_MODE_WAL = 3
+    QUIVER_JOURNAL_MODE_MEMORY = 4
+    QUIVER_JOURNAL_MODE_OFF = 5
+end
+
+@cenum quiver_synchronous_t::UInt32 begin
+    QUIVER_SYNCHRONOUS_DEFAULT = 0
+    QUIVER_SYNCHRONOUS_OFF = 1
+    QUIVER_SYNCHRONOUS_NORMAL = 2
+    QUIVER_SYNCHRONOUS_FULL = 3
+    QUIVER_SYNCHRONOUS_EXTRA = 4
+end
+
+@cenum quiver_temp_store_t::UInt32 begin
+    QUIVER_TEMP_STORE_DEFAULT = 0
+    QUIVER_TEMP_STORE_FILE = 1
+    QUIVER_TEMP_STORE_MEMORY = 2
+end
+
 struct quiver_database_options_t
     read_only::Cint
     console_level::quiver_log_level_t
+    statement_cache_size::Cint
+    journal_mode::quiver_journal_mode_t
+    synchronous::quiver_synchronous_t
+    temp_store::quiver_temp_store_t
+    page_size::Cint
+    cache_size::Int64
+    mmap_size::Int64
+    mapped::Cint
+    validate_schema::Cint
+    file_level::quiver_log_level_t
+    async_logging::Cint
+    collect_stats::Cint
+    slow_query_ms::Int64
+    busy_timeout_ms::Int64
+    statement_timeout_ms::Int64
+    load_into_memory::Cint
+    track_changes::Cint
+    cache_reads::Cint
+    read_cache_limit::Int64
+    soft_heap_limit::Int64
+    hard_heap_limit::Int64
+end
+
+struct quiver_statement_cache_stats_t
+    hits::Int64
+    misses::Int64
+    size::Csize_t
+    capacity::Csize_t
+end
+
+struct quiver_operation_stats_t
+    name::Ptr{Cchar}
+    calls::Int64
+    total_ns::Int64
+    max_ns::Int64
+    rows_read::Int64
+    rows_written::Int64
+end
+
+struct quiver_statement_stats_t
+    sql::Ptr{Cchar}
+    prepares::Int64
+    prepare_ns::Int64
+    executions::Int64
+    total_ns::Int64
+    max_ns::Int64
+    rows_read::Int64
+    rows_written::Int64
+end
+
+struct quiver_database_stats_t
+    operations::Ptr{quiver_operation_stats_t}
+    operation_count::Csize_t
+    statements::Ptr{quiver_statement_stats_t}
+    statement_count::Csize_t
+    statement_cache::quiver_statement_cache_stats_t
+end
+
+struct quiver_memory_usage_t
+    page_cache::Int64
+    sqlite_schema::Int64
+    statements::Int64
+    schema::Int64
+    read_cache::Int64
+    label_cache::Int64
+    cache_hits::Int64
+    cache_misses::Int64
+    cache_writes::Int64
+    cache_spills::Int64
+    sqlite_heap::Int64
+    sqlite_heap_highwater::Int64
+    soft_heap_limit::Int64
+    total::Int64
 end
 
 @cenum quiver_data_structure_t::UInt32 begin
@@ -78,6 +175,7 @@ end
     QUIVER_DATA_TYPE_STRING = 2
     QUIVER_DATA_TYPE_DATE_TIME = 3
     QUIVER_DATA_TYPE_NULL = 4
+    QUIVER_DATA_TYPE_BLOB = 5
 end
 
 function quiver_database_options_default()
@@ -112,10 +210,117 @@ function quiver_database_path(db)
     @ccall libquiver_c.quiver_database_path(db::Ptr{quiver_database_t})::Ptr{Cchar}
 end
 
+# typedef void ( * quiver_backup_progress_t ) ( int remaining , int total , void * user_data )
+const quiver_backup_progress_t = Ptr{Cvoid}
+
+function quiver_database_from_snapshot(path, options)
+    @ccall libquiver_c.quiver_database_from_snapshot(path::Ptr{Cchar}, options::Ptr{quiver_database_options_t})::Ptr{quiver_database_t}
+end
+
+function quiver_database_backup_to(db, path, pages_per_step, progress, user_data)
+    @ccall libquiver_c.quiver_database_backup_to(db::Ptr{quiver_database_t}, path::Ptr{Cchar}, pages_per_step::Cint, progress::quiver_backup_progress_t, user_data::Ptr{Cvoid})::quiver_error_t
+end
+
+function quiver_database_clone_in_memory(db, out_db)
+    @ccall libquiver_c.quiver_database_clone_in_memory(db::Ptr{quiver_database_t}, out_db::Ptr{Ptr{quiver_database_t}})::quiver_error_t
+end
+
+function quiver_database_flush(db)
+    @ccall libquiver_c.quiver_database_flush(db::Ptr{quiver_database_t})::quiver_error_t
+end
+
 function quiver_database_current_version(db)
     @ccall libquiver_c.quiver_database_current_version(db::Ptr{quiver_database_t})::Int64
 end
 
+function quiver_database_change_token(db, out_token)
+    @ccall libquiver_c.quiver_database_change_token(db::Ptr{quiver_database_t}, out_token::Ptr{Int64})::quiver_error_t
+end
+
+@cenum quiver_change_kind_t::UInt32 begin
+    QUIVER_CHANGE_CREATED = 0
+    QUIVER_CHANGE_UPDATED = 1
+    QUIVER_CHANGE_DELETED = 2
+end
+
+struct quiver_change_t
+    collection::Ptr{Cchar}
+    id::Int64
+    attribute::Ptr{Cchar}
+    kind::quiver_change_kind_t
+end
+
+function quiver_database_changes_since(db, token, out_changes, out_count, out_token)
+    @ccall libquiver_c.quiver_database_changes_since(db::Ptr{quiver_database_t}, token::Int64, out_changes::Ptr{Ptr{quiver_change_t}}, out_count::Ptr{Csize_t}, out_token::Ptr{Int64})::quiver_error_t
+end
+
+function quiver_database_discard_changes(db, token)
+    @ccall libquiver_c.quiver_database_discard_changes(db::Ptr{quiver_database_t}, token::Int64)::quiver_error_t
+end
+
+function quiver_free_changes(changes, count)
+    @ccall libquiver_c.quiver_free_changes(changes::Ptr{quiver_change_t}, count::Csize_t)::Cvoid
+end
+
+# typedef int ( * quiver_progress_callback_t ) ( void * user_data )
+const quiver_progress_callback_t = Ptr{Cvoid}
+
+function quiver_database_interrupt(db)
+    @ccall libquiver_c.quiver_database_interrupt(db::Ptr{quiver_database_t})::quiver_error_t
+end
+
+function quiver_database_set_busy_timeout(db, timeout_ms)
+    @ccall libquiver_c.quiver_database_set_busy_timeout(db::Ptr{quiver_database_t}, timeout_ms::Int64)::quiver_error_t
+end
+
+function quiver_database_set_statement_timeout(db, timeout_ms)
+    @ccall libquiver_c.quiver_database_set_statement_timeout(db::Ptr{quiver_database_t}, timeout_ms::Int64)::quiver_error_t
+end
+
+function quiver_database_set_progress_handler(db, callback, user_data)
+    @ccall libquiver_c.quiver_database_set_progress_handler(db::Ptr{quiver_database_t}, callback::quiver_progress_callback_t, user_data::Ptr{Cvoid})::quiver_error_t
+end
+
+function quiver_database_statement_cache_stats(db, out_stats)
+    @ccall libquiver_c.quiver_database_statement_cache_stats(db::Ptr{quiver_database_t}, out_stats::Ptr{quiver_statement_cache_stats_t})::quiver_error_t
+end
+
+function quiver_database_stats(db, out_stats)
+    @ccall libquiver_c.quiver_database_stats(db::Ptr{quiver_database_t}, out_stats::Ptr{quiver_database_stats_t})::quiver_error_t
+end
+
+function quiver_database_reset_stats(db)
+    @ccall libquiver_c.quiver_database_reset_stats(db::Ptr{quiver_database_t})::quiver_error_t
+end
+
+function quiver_free_database_stats(stats)
+    @ccall libquiver_c.quiver_free_database_stats(stats::Ptr{quiver_database_stats_t})::Cvoid
+end
+
+function quiver_database_memory_usage(db, out_usage)
+    @ccall libquiver_c.quiver_database_memory_usage(db::Ptr{quiver_database_t}, out_usage::Ptr{quiver_memory_usage_t})::quiver_error_t
+end
+
+function quiver_database_shrink_memory(db, out_released)
+    @ccall libquiver_c.quiver_database_shrink_memory(db::Ptr{quiver_database_t}, out_released::Ptr{Int64})::quiver_error_t
+end
+
+function quiver_database_begin_transaction(db)
+    @ccall libquiver_c.quiver_database_begin_transaction(db::Ptr{quiver_database_t})::quiver_error_t
+end
+
+function quiver_database_commit(db)
+    @ccall libquiver_c.quiver_database_commit(db::Ptr{quiver_database_t})::quiver_error_t
+end
+
+function quiver_database_rollback(db)
+    @ccall libquiver_c.quiver_database_rollback(db::Ptr{quiver_database_t})::quiver_error_t
+end
+
+function quiver_database_in_transaction(db, out_active)
+    @ccall libquiver_c.quiver_database_in_transaction(db::Ptr{quiver_database_t}, out_active::Ptr{Cint})::quiver_error_t
+end
+
 mutable struct quiver_element end
 
 const quiver_element_t = quiver_element
@@ -124,22 +329,50 @@ function quiver_database_create_element(db, collection, element)
     @ccall libquiver_c.quiver_database_create_element(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, element::Ptr{quiver_element_t})::Int64
 end
 
+function quiver_database_create_elements(db, collection, elements, count, out_ids)
+    @ccall libquiver_c.quiver_database_create_elements(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, elements::Ptr{Ptr{quiver_element_t}}, count::Csize_t, out_ids::Ptr{Int64})::quiver_error_t
+end
+
 function quiver_database_update_element(db, collection, id, element)
     @ccall libquiver_c.quiver_database_update_element(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, id::Int64, element::Ptr{quiver_element_t})::quiver_error_t
 end
 
+function quiver_database_upsert_element(db, collection, element, out_id)
+    @ccall libquiver_c.quiver_database_upsert_element(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, element::Ptr{quiver_element_t}, out_id::Ptr{Int64})::quiver_error_t
+end
+
+function quiver_database_upsert_elements(db, collection, elements, count, out_ids)
+    @ccall libquiver_c.quiver_database_upsert_elements(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, elements::Ptr{Ptr{quiver_element_t}}, count::Csize_t, out_ids::Ptr{Int64})::quiver_error_t
+end
+
+function quiver_database_read_element(db, collection, id, out_element)
+    @ccall libquiver_c.quiver_database_read_element(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, id::Int64, out_element::Ptr{Ptr{quiver_element_t}})::quiver_error_t
+end
+
 function quiver_database_delete_element_by_id(db, collection, id)
     @ccall libquiver_c.quiver_database_delete_element_by_id(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, id::Int64)::quiver_error_t
 end
 
+function quiver_database_delete_elements_by_ids(db, collection, ids, count, out_deleted)
+    @ccall libquiver_c.quiver_database_delete_elements_by_ids(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, ids::Ptr{Int64}, count::Csize_t, out_deleted::Ptr{Csize_t})::quiver_error_t
+end
+
 function quiver_database_set_scalar_relation(db, collection, attribute, from_label, to_label)
     @ccall libquiver_c.quiver_database_set_scalar_relation(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, from_label::Ptr{Cchar}, to_label::Ptr{Cchar})::quiver_error_t
 end
 
+function quiver_database_set_scalar_relations(db, collection, attribute, from_labels, to_labels, count)
+    @ccall libquiver_c.quiver_database_set_scalar_relations(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, from_labels::Ptr{Ptr{Cchar}}, to_labels::Ptr{Ptr{Cchar}}, count::Csize_t)::quiver_error_t
+end
+
 function quiver_database_read_scalar_relation(db, collection, attribute, out_values, out_count)
     @ccall libquiver_c.quiver_database_read_scalar_relation(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_count::Ptr{Csize_t})::quiver_error_t
 end
 
+function quiver_database_read_scalar_relation_ids(db, collection, attribute, out_values, out_count)
+    @ccall libquiver_c.quiver_database_read_scalar_relation_ids(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Int64}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
 function quiver_database_read_scalar_integers(db, collection, attribute, out_values, out_count)
     @ccall libquiver_c.quiver_database_read_scalar_integers(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Int64}}, out_count::Ptr{Csize_t})::quiver_error_t
 end
@@ -152,6 +385,18 @@ function quiver_database_read_scalar_strings(db, collection, attribute, out_valu
     @ccall libquiver_c.quiver_database_read_scalar_strings(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_count::Ptr{Csize_t})::quiver_error_t
 end
 
+function quiver_database_count_scalar_values(db, collection, attribute, out_count)
+    @ccall libquiver_c.quiver_database_count_scalar_values(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_scalar_integers_into(db, collection, attribute, buffer, capacity, out_count)
+    @ccall libquiver_c.quiver_database_read_scalar_integers_into(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, buffer::Ptr{Int64}, capacity::Csize_t, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_scalar_floats_into(db, collection, attribute, buffer, capacity, out_count)
+    @ccall libquiver_c.quiver_database_read_scalar_floats_into(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, buffer::Ptr{Cdouble}, capacity::Csize_t, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
 function quiver_database_read_vector_integers(db, collection, attribute, out_vectors, out_sizes, out_count)
     @ccall libquiver_c.quiver_database_read_vector_integers(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_vectors::Ptr{Ptr{Ptr{Int64}}}, out_sizes::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
 end
@@ -176,6 +421,70 @@ function quiver_database_read_set_strings(db, collection, attribute, out_sets, o
     @ccall libquiver_c.quiver_database_read_set_strings(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_sets::Ptr{Ptr{Ptr{Ptr{Cchar}}}}, out_sizes::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
 end
 
+function quiver_database_read_vector_integers_flat(db, collection, attribute, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_vector_integers_flat(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Int64}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_vector_floats_flat(db, collection, attribute, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_vector_floats_flat(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Cdouble}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_vector_strings_flat(db, collection, attribute, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_vector_strings_flat(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_set_integers_flat(db, collection, attribute, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_set_integers_flat(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Int64}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_set_floats_flat(db, collection, attribute, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_set_floats_flat(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Cdouble}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_set_strings_flat(db, collection, attribute, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_set_strings_flat(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_vector_integers_flat_aligned(db, collection, attribute, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_vector_integers_flat_aligned(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Int64}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_vector_floats_flat_aligned(db, collection, attribute, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_vector_floats_flat_aligned(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Cdouble}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_vector_strings_flat_aligned(db, collection, attribute, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_vector_strings_flat_aligned(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_set_integers_flat_aligned(db, collection, attribute, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_set_integers_flat_aligned(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Int64}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_set_floats_flat_aligned(db, collection, attribute, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_set_floats_flat_aligned(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Cdouble}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_set_strings_flat_aligned(db, collection, attribute, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_set_strings_flat_aligned(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_scalar_strings_arena(db, collection, attribute, intern, out_values, out_count)
+    @ccall libquiver_c.quiver_database_read_scalar_strings_arena(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, intern::Cint, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_scalar_relation_arena(db, collection, attribute, intern, out_values, out_count)
+    @ccall libquiver_c.quiver_database_read_scalar_relation_arena(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, intern::Cint, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_vector_strings_arena(db, collection, attribute, intern, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_vector_strings_arena(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, intern::Cint, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_set_strings_arena(db, collection, attribute, intern, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_set_strings_arena(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, intern::Cint, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
 function quiver_database_read_scalar_integers_by_id(db, collection, attribute, id, out_value, out_has_value)
     @ccall libquiver_c.quiver_database_read_scalar_integers_by_id(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, out_value::Ptr{Int64}, out_has_value::Ptr{Cint})::quiver_error_t
 end
@@ -200,6 +509,10 @@ function quiver_database_read_vector_strings_by_id(db, collection, attribute, id
     @ccall libquiver_c.quiver_database_read_vector_strings_by_id(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_count::Ptr{Csize_t})::quiver_error_t
 end
 
+function quiver_database_read_vector_floats_range(db, collection, attribute, id, first, count, out_values, out_count)
+    @ccall libquiver_c.quiver_database_read_vector_floats_range(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, first::Int64, count::Int64, out_values::Ptr{Ptr{Cdouble}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
 function quiver_database_read_set_integers_by_id(db, collection, attribute, id, out_values, out_count)
     @ccall libquiver_c.quiver_database_read_set_integers_by_id(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, out_values::Ptr{Ptr{Int64}}, out_count::Ptr{Csize_t})::quiver_error_t
 end
@@ -212,10 +525,102 @@ function quiver_database_read_set_strings_by_id(db, collection, attribute, id, o
     @ccall libquiver_c.quiver_database_read_set_strings_by_id(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_count::Ptr{Csize_t})::quiver_error_t
 end
 
+function quiver_database_read_scalar_integers_by_ids(db, collection, attribute, ids, id_count, out_values, out_validity)
+    @ccall libquiver_c.quiver_database_read_scalar_integers_by_ids(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, ids::Ptr{Int64}, id_count::Csize_t, out_values::Ptr{Ptr{Int64}}, out_validity::Ptr{Ptr{UInt8}})::quiver_error_t
+end
+
+function quiver_database_read_scalar_floats_by_ids(db, collection, attribute, ids, id_count, out_values, out_validity)
+    @ccall libquiver_c.quiver_database_read_scalar_floats_by_ids(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, ids::Ptr{Int64}, id_count::Csize_t, out_values::Ptr{Ptr{Cdouble}}, out_validity::Ptr{Ptr{UInt8}})::quiver_error_t
+end
+
+function quiver_database_read_scalar_strings_by_ids(db, collection, attribute, ids, id_count, out_values, out_validity)
+    @ccall libquiver_c.quiver_database_read_scalar_strings_by_ids(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, ids::Ptr{Int64}, id_count::Csize_t, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_validity::Ptr{Ptr{UInt8}})::quiver_error_t
+end
+
+function quiver_database_read_vector_integers_by_ids(db, collection, attribute, ids, id_count, out_values, out_offsets)
+    @ccall libquiver_c.quiver_database_read_vector_integers_by_ids(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, ids::Ptr{Int64}, id_count::Csize_t, out_values::Ptr{Ptr{Int64}}, out_offsets::Ptr{Ptr{Csize_t}})::quiver_error_t
+end
+
+function quiver_database_read_vector_floats_by_ids(db, collection, attribute, ids, id_count, out_values, out_offsets)
+    @ccall libquiver_c.quiver_database_read_vector_floats_by_ids(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, ids::Ptr{Int64}, id_count::Csize_t, out_values::Ptr{Ptr{Cdouble}}, out_offsets::Ptr{Ptr{Csize_t}})::quiver_error_t
+end
+
+function quiver_database_read_vector_strings_by_ids(db, collection, attribute, ids, id_count, out_values, out_offsets)
+    @ccall libquiver_c.quiver_database_read_vector_strings_by_ids(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, ids::Ptr{Int64}, id_count::Csize_t, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_offsets::Ptr{Ptr{Csize_t}})::quiver_error_t
+end
+
+function quiver_database_read_set_integers_by_ids(db, collection, attribute, ids, id_count, out_values, out_offsets)
+    @ccall libquiver_c.quiver_database_read_set_integers_by_ids(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, ids::Ptr{Int64}, id_count::Csize_t, out_values::Ptr{Ptr{Int64}}, out_offsets::Ptr{Ptr{Csize_t}})::quiver_error_t
+end
+
+function quiver_database_read_set_floats_by_ids(db, collection, attribute, ids, id_count, out_values, out_offsets)
+    @ccall libquiver_c.quiver_database_read_set_floats_by_ids(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, ids::Ptr{Int64}, id_count::Csize_t, out_values::Ptr{Ptr{Cdouble}}, out_offsets::Ptr{Ptr{Csize_t}})::quiver_error_t
+end
+
+function quiver_database_read_set_strings_by_ids(db, collection, attribute, ids, id_count, out_values, out_offsets)
+    @ccall libquiver_c.quiver_database_read_set_strings_by_ids(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, ids::Ptr{Int64}, id_count::Csize_t, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_offsets::Ptr{Ptr{Csize_t}})::quiver_error_t
+end
+
+function quiver_database_read_time_series_floats(db, collection, attribute, id, date_time_from, date_time_to, out_date_times, out_values, out_count)
+    @ccall libquiver_c.quiver_database_read_time_series_floats(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, date_time_from::Ptr{Cchar}, date_time_to::Ptr{Cchar}, out_date_times::Ptr{Ptr{Ptr{Cchar}}}, out_values::Ptr{Ptr{Cdouble}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+@cenum quiver_aggregate_t::UInt32 begin
+    QUIVER_AGGREGATE_SUM = 0
+    QUIVER_AGGREGATE_MEAN = 1
+    QUIVER_AGGREGATE_MIN = 2
+    QUIVER_AGGREGATE_MAX = 3
+    QUIVER_AGGREGATE_COUNT = 4
+end
+
+function quiver_database_aggregate_vector(db, collection, attribute, statistics, statistic_count, out_ids, out_values, out_count)
+    @ccall libquiver_c.quiver_database_aggregate_vector(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, statistics::Ptr{quiver_aggregate_t}, statistic_count::Csize_t, out_ids::Ptr{Ptr{Int64}}, out_values::Ptr{Ptr{Cdouble}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+@cenum quiver_time_bucket_t::UInt32 begin
+    QUIVER_TIME_BUCKET_YEAR = 0
+    QUIVER_TIME_BUCKET_MONTH = 1
+    QUIVER_TIME_BUCKET_DAY = 2
+    QUIVER_TIME_BUCKET_HOUR = 3
+end
+
+function quiver_database_aggregate_time_series(db, collection, attribute, bucket, statistics, statistic_count, out_ids, out_buckets, out_values, out_count)
+    @ccall libquiver_c.quiver_database_aggregate_time_series(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, bucket::quiver_time_bucket_t, statistics::Ptr{quiver_aggregate_t}, statistic_count::Csize_t, out_ids::Ptr{Ptr{Int64}}, out_buckets::Ptr{Ptr{Ptr{Cchar}}}, out_values::Ptr{Ptr{Cdouble}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
 function quiver_database_read_element_ids(db, collection, out_ids, out_count)
     @ccall libquiver_c.quiver_database_read_element_ids(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, out_ids::Ptr{Ptr{Int64}}, out_count::Ptr{Csize_t})::quiver_error_t
 end
 
+function quiver_database_read_scalar_integers_nullable(db, collection, attribute, out_values, out_validity, out_count)
+    @ccall libquiver_c.quiver_database_read_scalar_integers_nullable(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Int64}}, out_validity::Ptr{Ptr{UInt8}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_scalar_floats_nullable(db, collection, attribute, out_values, out_validity, out_count)
+    @ccall libquiver_c.quiver_database_read_scalar_floats_nullable(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Cdouble}}, out_validity::Ptr{Ptr{UInt8}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_scalar_strings_nullable(db, collection, attribute, out_values, out_validity, out_count)
+    @ccall libquiver_c.quiver_database_read_scalar_strings_nullable(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_validity::Ptr{Ptr{UInt8}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+struct quiver_scalar_column_t
+    name::Ptr{Cchar}
+    data_type::quiver_data_type_t
+    integers::Ptr{Int64}
+    floats::Ptr{Cdouble}
+    strings::Ptr{Ptr{Cchar}}
+    nulls::Ptr{UInt8}
+end
+
+function quiver_database_read_scalars(db, collection, attributes, attribute_count, out_ids, out_columns, out_count)
+    @ccall libquiver_c.quiver_database_read_scalars(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attributes::Ptr{Ptr{Cchar}}, attribute_count::Csize_t, out_ids::Ptr{Ptr{Int64}}, out_columns::Ptr{Ptr{quiver_scalar_column_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_create_elements_columns(db, collection, columns, column_count, count, out_ids)
+    @ccall libquiver_c.quiver_database_create_elements_columns(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, columns::Ptr{quiver_scalar_column_t}, column_count::Csize_t, count::Csize_t, out_ids::Ptr{Int64})::quiver_error_t
+end
+
 struct quiver_scalar_metadata_t
     name::Ptr{Cchar}
     data_type::quiver_data_type_t
@@ -296,6 +701,18 @@ function quiver_database_update_scalar_string(db, collection, attribute, id, val
     @ccall libquiver_c.quiver_database_update_scalar_string(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, value::Ptr{Cchar})::quiver_error_t
 end
 
+function quiver_database_update_scalar_integers(db, collection, attribute, ids, values, count)
+    @ccall libquiver_c.quiver_database_update_scalar_integers(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, ids::Ptr{Int64}, values::Ptr{Int64}, count::Csize_t)::quiver_error_t
+end
+
+function quiver_database_update_scalar_floats(db, collection, attribute, ids, values, count)
+    @ccall libquiver_c.quiver_database_update_scalar_floats(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, ids::Ptr{Int64}, values::Ptr{Cdouble}, count::Csize_t)::quiver_error_t
+end
+
+function quiver_database_update_scalar_strings(db, collection, attribute, ids, values, count)
+    @ccall libquiver_c.quiver_database_update_scalar_strings(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, ids::Ptr{Int64}, values::Ptr{Ptr{Cchar}}, count::Csize_t)::quiver_error_t
+end
+
 function quiver_database_update_vector_integers(db, collection, attribute, id, values, count)
     @ccall libquiver_c.quiver_database_update_vector_integers(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, values::Ptr{Int64}, count::Csize_t)::quiver_error_t
 end
@@ -308,6 +725,30 @@ function quiver_database_update_vector_strings(db, collection, attribute, id, va
     @ccall libquiver_c.quiver_database_update_vector_strings(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, values::Ptr{Ptr{Cchar}}, count::Csize_t)::quiver_error_t
 end
 
+function quiver_database_append_vector_integers(db, collection, attribute, id, values, count)
+    @ccall libquiver_c.quiver_database_append_vector_integers(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, values::Ptr{Int64}, count::Csize_t)::quiver_error_t
+end
+
+function quiver_database_append_vector_floats(db, collection, attribute, id, values, count)
+    @ccall libquiver_c.quiver_database_append_vector_floats(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, values::Ptr{Cdouble}, count::Csize_t)::quiver_error_t
+end
+
+function quiver_database_append_vector_strings(db, collection, attribute, id, values, count)
+    @ccall libquiver_c.quiver_database_append_vector_strings(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, values::Ptr{Ptr{Cchar}}, count::Csize_t)::quiver_error_t
+end
+
+function quiver_database_update_vector_integer_entry(db, collection, attribute, id, index, value)
+    @ccall libquiver_c.quiver_database_update_vector_integer_entry(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, index::Int64, value::Int64)::quiver_error_t
+end
+
+function quiver_database_update_vector_float_entry(db, collection, attribute, id, index, value)
+    @ccall libquiver_c.quiver_database_update_vector_float_entry(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, index::Int64, value::Cdouble)::quiver_error_t
+end
+
+function quiver_database_update_vector_string_entry(db, collection, attribute, id, index, value)
+    @ccall libquiver_c.quiver_database_update_vector_string_entry(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, index::Int64, value::Ptr{Cchar})::quiver_error_t
+end
+
 function quiver_database_update_set_integers(db, collection, attribute, id, values, count)
     @ccall libquiver_c.quiver_database_update_set_integers(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, values::Ptr{Int64}, count::Csize_t)::quiver_error_t
 end
@@ -320,6 +761,10 @@ function quiver_database_update_set_strings(db, collection, attribute, id, value
     @ccall libquiver_c.quiver_database_update_set_strings(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, values::Ptr{Ptr{Cchar}}, count::Csize_t)::quiver_error_t
 end
 
+function quiver_database_update_time_series_floats(db, collection, attribute, id, date_times, values, count)
+    @ccall libquiver_c.quiver_database_update_time_series_floats(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, date_times::Ptr{Ptr{Cchar}}, values::Ptr{Cdouble}, count::Csize_t)::quiver_error_t
+end
+
 function quiver_free_integer_array(values)
     @ccall libquiver_c.quiver_free_integer_array(values::Ptr{Int64})::Cvoid
 end
@@ -332,6 +777,10 @@ function quiver_free_string_array(values, count)
     @ccall libquiver_c.quiver_free_string_array(values::Ptr{Ptr{Cchar}}, count::Csize_t)::Cvoid
 end
 
+function quiver_free_validity_bitmap(validity)
+    @ccall libquiver_c.quiver_free_validity_bitmap(validity::Ptr{UInt8})::Cvoid
+end
+
 function quiver_free_integer_vectors(vectors, sizes, count)
     @ccall libquiver_c.quiver_free_integer_vectors(vectors::Ptr{Ptr{Int64}}, sizes::Ptr{Csize_t}, count::Csize_t)::Cvoid
 end
@@ -344,6 +793,34 @@ function quiver_free_string_vectors(vectors, sizes, count)
     @ccall libquiver_c.quiver_free_string_vectors(vectors::Ptr{Ptr{Ptr{Cchar}}}, sizes::Ptr{Csize_t}, count::Csize_t)::Cvoid
 end
 
+function quiver_free_integer_flat(values, offsets)
+    @ccall libquiver_c.quiver_free_integer_flat(values::Ptr{Int64}, offsets::Ptr{Csize_t})::Cvoid
+end
+
+function quiver_free_float_flat(values, offsets)
+    @ccall libquiver_c.quiver_free_float_flat(values::Ptr{Cdouble}, offsets::Ptr{Csize_t})::Cvoid
+end
+
+function quiver_free_string_flat(values, offsets, count)
+    @ccall libquiver_c.quiver_free_string_flat(values::Ptr{Ptr{Cchar}}, offsets::Ptr{Csize_t}, count::Csize_t)::Cvoid
+end
+
+function quiver_free_string_arena(values)
+    @ccall libquiver_c.quiver_free_string_arena(values::Ptr{Ptr{Cchar}})::Cvoid
+end
+
+function quiver_free_string_arena_flat(values, offsets)
+    @ccall libquiver_c.quiver_free_string_arena_flat(values::Ptr{Ptr{Cchar}}, offsets::Ptr{Csize_t})::Cvoid
+end
+
+function quiver_free_time_series_floats(date_times, values, count)
+    @ccall libquiver_c.quiver_free_time_series_floats(date_times::Ptr{Ptr{Cchar}}, values::Ptr{Cdouble}, count::Csize_t)::Cvoid
+end
+
+function quiver_free_scalar_columns(ids, columns, column_count, count)
+    @ccall libquiver_c.quiver_free_scalar_columns(ids::Ptr{Int64}, columns::Ptr{quiver_scalar_column_t}, column_count::Csize_t, count::Csize_t)::Cvoid
+end
+
 function quiver_database_export_to_csv(db, table, path)
     @ccall libquiver_c.quiver_database_export_to_csv(db::Ptr{quiver_database_t}, table::Ptr{Cchar}, path::Ptr{Cchar})::quiver_error_t
 end
@@ -352,6 +829,14 @@ function quiver_database_import_from_csv(db, table, path)
     @ccall libquiver_c.quiver_database_import_from_csv(db::Ptr{quiver_database_t}, table::Ptr{Cchar}, path::Ptr{Cchar})::quiver_error_t
 end
 
+function quiver_database_export_collection(db, collection, directory)
+    @ccall libquiver_c.quiver_database_export_collection(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, directory::Ptr{Cchar})::quiver_error_t
+end
+
+function quiver_database_import_collection(db, collection, directory)
+    @ccall libquiver_c.quiver_database_import_collection(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, directory::Ptr{Cchar})::quiver_error_t
+end
+
 function quiver_database_query_string(db, sql, out_value, out_has_value)
     @ccall libquiver_c.quiver_database_query_string(db::Ptr{quiver_database_t}, sql::Ptr{Cchar}, out_value::Ptr{Ptr{Cchar}}, out_has_value::Ptr{Cint})::quiver_error_t
 end
@@ -380,6 +865,374 @@ function quiver_database_describe(db)
     @ccall libquiver_c.quiver_database_describe(db::Ptr{quiver_database_t})::quiver_error_t
 end
 
+function quiver_database_create_missing_indexes(db, out_created)
+    @ccall libquiver_c.quiver_database_create_missing_indexes(db::Ptr{quiver_database_t}, out_created::Ptr{Csize_t})::quiver_error_t
+end
+
+mutable struct quiver_attribute_handle end
+
+const quiver_attribute_handle_t = quiver_attribute_handle
+
+function quiver_database_attribute_handle(db, collection, attribute, out_handle)
+    @ccall libquiver_c.quiver_database_attribute_handle(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_handle::Ptr{Ptr{quiver_attribute_handle_t}})::quiver_error_t
+end
+
+function quiver_attribute_handle_free(handle)
+    @ccall libquiver_c.quiver_attribute_handle_free(handle::Ptr{quiver_attribute_handle_t})::Cvoid
+end
+
+function quiver_attribute_handle_info(handle, out_structure, out_type)
+    @ccall libquiver_c.quiver_attribute_handle_info(handle::Ptr{quiver_attribute_handle_t}, out_structure::Ptr{quiver_data_structure_t}, out_type::Ptr{quiver_data_type_t})::quiver_error_t
+end
+
+function quiver_database_read_scalar_integer_by_handle(db, handle, id, out_value, out_has_value)
+    @ccall libquiver_c.quiver_database_read_scalar_integer_by_handle(db::Ptr{quiver_database_t}, handle::Ptr{quiver_attribute_handle_t}, id::Int64, out_value::Ptr{Int64}, out_has_value::Ptr{Cint})::quiver_error_t
+end
+
+function quiver_database_read_scalar_float_by_handle(db, handle, id, out_value, out_has_value)
+    @ccall libquiver_c.quiver_database_read_scalar_float_by_handle(db::Ptr{quiver_database_t}, handle::Ptr{quiver_attribute_handle_t}, id::Int64, out_value::Ptr{Cdouble}, out_has_value::Ptr{Cint})::quiver_error_t
+end
+
+function quiver_database_read_scalar_string_by_handle(db, handle, id, out_value, out_has_value)
+    @ccall libquiver_c.quiver_database_read_scalar_string_by_handle(db::Ptr{quiver_database_t}, handle::Ptr{quiver_attribute_handle_t}, id::Int64, out_value::Ptr{Ptr{Cchar}}, out_has_value::Ptr{Cint})::quiver_error_t
+end
+
+function quiver_database_read_vector_integers_by_handle(db, handle, id, buffer, capacity, out_count)
+    @ccall libquiver_c.quiver_database_read_vector_integers_by_handle(db::Ptr{quiver_database_t}, handle::Ptr{quiver_attribute_handle_t}, id::Int64, buffer::Ptr{Int64}, capacity::Csize_t, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_vector_floats_by_handle(db, handle, id, buffer, capacity, out_count)
+    @ccall libquiver_c.quiver_database_read_vector_floats_by_handle(db::Ptr{quiver_database_t}, handle::Ptr{quiver_attribute_handle_t}, id::Int64, buffer::Ptr{Cdouble}, capacity::Csize_t, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_update_scalar_integer_by_handle(db, handle, id, value)
+    @ccall libquiver_c.quiver_database_update_scalar_integer_by_handle(db::Ptr{quiver_database_t}, handle::Ptr{quiver_attribute_handle_t}, id::Int64, value::Int64)::quiver_error_t
+end
+
+function quiver_database_update_scalar_float_by_handle(db, handle, id, value)
+    @ccall libquiver_c.quiver_database_update_scalar_float_by_handle(db::Ptr{quiver_database_t}, handle::Ptr{quiver_attribute_handle_t}, id::Int64, value::Cdouble)::quiver_error_t
+end
+
+function quiver_database_update_scalar_string_by_handle(db, handle, id, value)
+    @ccall libquiver_c.quiver_database_update_scalar_string_by_handle(db::Ptr{quiver_database_t}, handle::Ptr{quiver_attribute_handle_t}, id::Int64, value::Ptr{Cchar})::quiver_error_t
+end
+
+mutable struct quiver_cursor end
+
+const quiver_cursor_t = quiver_cursor
+
+function quiver_database_open_cursor(db, sql, param_types, param_values, param_count, out_cursor)
+    @ccall libquiver_c.quiver_database_open_cursor(db::Ptr{quiver_database_t}, sql::Ptr{Cchar}, param_types::Ptr{Cint}, param_values::Ptr{Ptr{Cvoid}}, param_count::Csize_t, out_cursor::Ptr{Ptr{quiver_cursor_t}})::quiver_error_t
+end
+
+function quiver_database_open_scalars_cursor(db, collection, attributes, attribute_count, out_cursor)
+    @ccall libquiver_c.quiver_database_open_scalars_cursor(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attributes::Ptr{Ptr{Cchar}}, attribute_count::Csize_t, out_cursor::Ptr{Ptr{quiver_cursor_t}})::quiver_error_t
+end
+
+function quiver_database_open_vector_cursor(db, collection, attribute, out_cursor)
+    @ccall libquiver_c.quiver_database_open_vector_cursor(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_cursor::Ptr{Ptr{quiver_cursor_t}})::quiver_error_t
+end
+
+function quiver_cursor_free(cursor)
+    @ccall libquiver_c.quiver_cursor_free(cursor::Ptr{quiver_cursor_t})::Cvoid
+end
+
+function quiver_cursor_next(cursor, out_has_row)
+    @ccall libquiver_c.quiver_cursor_next(cursor::Ptr{quiver_cursor_t}, out_has_row::Ptr{Cint})::quiver_error_t
+end
+
+function quiver_cursor_column_count(cursor, out_count)
+    @ccall libquiver_c.quiver_cursor_column_count(cursor::Ptr{quiver_cursor_t}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_cursor_column_name(cursor, column, out_name)
+    @ccall libquiver_c.quiver_cursor_column_name(cursor::Ptr{quiver_cursor_t}, column::Csize_t, out_name::Ptr{Ptr{Cchar}})::quiver_error_t
+end
+
+function quiver_cursor_column_type(cursor, column, out_type)
+    @ccall libquiver_c.quiver_cursor_column_type(cursor::Ptr{quiver_cursor_t}, column::Csize_t, out_type::Ptr{quiver_data_type_t})::quiver_error_t
+end
+
+function quiver_cursor_get_integer(cursor, column, out_value, out_has_value)
+    @ccall libquiver_c.quiver_cursor_get_integer(cursor::Ptr{quiver_cursor_t}, column::Csize_t, out_value::Ptr{Int64}, out_has_value::Ptr{Cint})::quiver_error_t
+end
+
+function quiver_cursor_get_float(cursor, column, out_value, out_has_value)
+    @ccall libquiver_c.quiver_cursor_get_float(cursor::Ptr{quiver_cursor_t}, column::Csize_t, out_value::Ptr{Cdouble}, out_has_value::Ptr{Cint})::quiver_error_t
+end
+
+function quiver_cursor_get_string(cursor, column, out_value, out_has_value)
+    @ccall libquiver_c.quiver_cursor_get_string(cursor::Ptr{quiver_cursor_t}, column::Csize_t, out_value::Ptr{Ptr{Cchar}}, out_has_value::Ptr{Cint})::quiver_error_t
+end
+
+function quiver_cursor_get_blob(cursor, column, out_data, out_size, out_has_value)
+    @ccall libquiver_c.quiver_cursor_get_blob(cursor::Ptr{quiver_cursor_t}, column::Csize_t, out_data::Ptr{Ptr{UInt8}}, out_size::Ptr{Csize_t}, out_has_value::Ptr{Cint})::quiver_error_t
+end
+
+function quiver_blob_free(data)
+    @ccall libquiver_c.quiver_blob_free(data::Ptr{UInt8})::Cvoid
+end
+
+mutable struct quiver_result end
+
+const quiver_result_t = quiver_result
+
+function quiver_database_read_scalar_integers_result(db, collection, attribute, out_result)
+    @ccall libquiver_c.quiver_database_read_scalar_integers_result(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_result::Ptr{Ptr{quiver_result_t}})::quiver_error_t
+end
+
+function quiver_database_read_scalar_floats_result(db, collection, attribute, out_result)
+    @ccall libquiver_c.quiver_database_read_scalar_floats_result(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_result::Ptr{Ptr{quiver_result_t}})::quiver_error_t
+end
+
+function quiver_database_read_scalar_strings_result(db, collection, attribute, out_result)
+    @ccall libquiver_c.quiver_database_read_scalar_strings_result(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_result::Ptr{Ptr{quiver_result_t}})::quiver_error_t
+end
+
+function quiver_result_free(result)
+    @ccall libquiver_c.quiver_result_free(result::Ptr{quiver_result_t})::Cvoid
+end
+
+function quiver_result_type(result, out_type)
+    @ccall libquiver_c.quiver_result_type(result::Ptr{quiver_result_t}, out_type::Ptr{quiver_data_type_t})::quiver_error_t
+end
+
+function quiver_result_count(result, out_count)
+    @ccall libquiver_c.quiver_result_count(result::Ptr{quiver_result_t}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_result_offsets(result, out_offsets, out_group_count)
+    @ccall libquiver_c.quiver_result_offsets(result::Ptr{quiver_result_t}, out_offsets::Ptr{Ptr{Csize_t}}, out_group_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_result_integers(result, out_values)
+    @ccall libquiver_c.quiver_result_integers(result::Ptr{quiver_result_t}, out_values::Ptr{Ptr{Int64}})::quiver_error_t
+end
+
+function quiver_result_floats(result, out_values)
+    @ccall libquiver_c.quiver_result_floats(result::Ptr{quiver_result_t}, out_values::Ptr{Ptr{Cdouble}})::quiver_error_t
+end
+
+function quiver_result_strings(result, out_values)
+    @ccall libquiver_c.quiver_result_strings(result::Ptr{quiver_result_t}, out_values::Ptr{Ptr{Ptr{Cchar}}})::quiver_error_t
+end
+
+struct ArrowSchema
+    format::Ptr{Cchar}
+    name::Ptr{Cchar}
+    metadata::Ptr{Cchar}
+    flags::Int64
+    n_children::Int64
+    children::Ptr{Ptr{ArrowSchema}}
+    dictionary::Ptr{ArrowSchema}
+    release::Ptr{Cvoid}
+    private_data::Ptr{Cvoid}
+end
+
+struct ArrowArray
+    length::Int64
+    null_count::Int64
+    offset::Int64
+    n_buffers::Int64
+    n_children::Int64
+    buffers::Ptr{Ptr{Cvoid}}
+    children::Ptr{Ptr{ArrowArray}}
+    dictionary::Ptr{ArrowArray}
+    release::Ptr{Cvoid}
+    private_data::Ptr{Cvoid}
+end
+
+function quiver_database_read_scalar_integers_arrow(db, collection, attribute, out_schema, out_array)
+    @ccall libquiver_c.quiver_database_read_scalar_integers_arrow(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_schema::Ptr{ArrowSchema}, out_array::Ptr{ArrowArray})::quiver_error_t
+end
+
+function quiver_database_read_scalar_floats_arrow(db, collection, attribute, out_schema, out_array)
+    @ccall libquiver_c.quiver_database_read_scalar_floats_arrow(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_schema::Ptr{ArrowSchema}, out_array::Ptr{ArrowArray})::quiver_error_t
+end
+
+function quiver_database_read_scalar_strings_arrow(db, collection, attribute, out_schema, out_array)
+    @ccall libquiver_c.quiver_database_read_scalar_strings_arrow(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_schema::Ptr{ArrowSchema}, out_array::Ptr{ArrowArray})::quiver_error_t
+end
+
+function quiver_database_read_vector_integers_arrow(db, collection, attribute, out_schema, out_array)
+    @ccall libquiver_c.quiver_database_read_vector_integers_arrow(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_schema::Ptr{ArrowSchema}, out_array::Ptr{ArrowArray})::quiver_error_t
+end
+
+function quiver_database_read_vector_floats_arrow(db, collection, attribute, out_schema, out_array)
+    @ccall libquiver_c.quiver_database_read_vector_floats_arrow(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_schema::Ptr{ArrowSchema}, out_array::Ptr{ArrowArray})::quiver_error_t
+end
+
+function quiver_database_read_vector_strings_arrow(db, collection, attribute, out_schema, out_array)
+    @ccall libquiver_c.quiver_database_read_vector_strings_arrow(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_schema::Ptr{ArrowSchema}, out_array::Ptr{ArrowArray})::quiver_error_t
+end
+
+function quiver_database_read_set_integers_arrow(db, collection, attribute, out_schema, out_array)
+    @ccall libquiver_c.quiver_database_read_set_integers_arrow(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_schema::Ptr{ArrowSchema}, out_array::Ptr{ArrowArray})::quiver_error_t
+end
+
+function quiver_database_read_set_floats_arrow(db, collection, attribute, out_schema, out_array)
+    @ccall libquiver_c.quiver_database_read_set_floats_arrow(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_schema::Ptr{ArrowSchema}, out_array::Ptr{ArrowArray})::quiver_error_t
+end
+
+function quiver_database_read_set_strings_arrow(db, collection, attribute, out_schema, out_array)
+    @ccall libquiver_c.quiver_database_read_set_strings_arrow(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_schema::Ptr{ArrowSchema}, out_array::Ptr{ArrowArray})::quiver_error_t
+end
+
+function quiver_database_query_arrow(db, sql, param_types, param_values, param_count, out_schema, out_array)
+    @ccall libquiver_c.quiver_database_query_arrow(db::Ptr{quiver_database_t}, sql::Ptr{Cchar}, param_types::Ptr{Cint}, param_values::Ptr{Ptr{Cvoid}}, param_count::Csize_t, out_schema::Ptr{ArrowSchema}, out_array::Ptr{ArrowArray})::quiver_error_t
+end
+
+mutable struct quiver_future end
+
+const quiver_future_t = quiver_future
+
+function quiver_database_read_scalar_integers_async(db, collection, attribute, out_future)
+    @ccall libquiver_c.quiver_database_read_scalar_integers_async(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_future::Ptr{Ptr{quiver_future_t}})::quiver_error_t
+end
+
+function quiver_database_read_scalar_floats_async(db, collection, attribute, out_future)
+    @ccall libquiver_c.quiver_database_read_scalar_floats_async(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_future::Ptr{Ptr{quiver_future_t}})::quiver_error_t
+end
+
+function quiver_database_read_scalar_strings_async(db, collection, attribute, out_future)
+    @ccall libquiver_c.quiver_database_read_scalar_strings_async(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_future::Ptr{Ptr{quiver_future_t}})::quiver_error_t
+end
+
+function quiver_database_read_vector_integers_async(db, collection, attribute, out_future)
+    @ccall libquiver_c.quiver_database_read_vector_integers_async(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_future::Ptr{Ptr{quiver_future_t}})::quiver_error_t
+end
+
+function quiver_database_read_vector_floats_async(db, collection, attribute, out_future)
+    @ccall libquiver_c.quiver_database_read_vector_floats_async(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_future::Ptr{Ptr{quiver_future_t}})::quiver_error_t
+end
+
+function quiver_database_read_vector_strings_async(db, collection, attribute, out_future)
+    @ccall libquiver_c.quiver_database_read_vector_strings_async(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, out_future::Ptr{Ptr{quiver_future_t}})::quiver_error_t
+end
+
+function quiver_database_export_to_csv_async(db, table, path, out_future)
+    @ccall libquiver_c.quiver_database_export_to_csv_async(db::Ptr{quiver_database_t}, table::Ptr{Cchar}, path::Ptr{Cchar}, out_future::Ptr{Ptr{quiver_future_t}})::quiver_error_t
+end
+
+function quiver_database_import_from_csv_async(db, table, path, out_future)
+    @ccall libquiver_c.quiver_database_import_from_csv_async(db::Ptr{quiver_database_t}, table::Ptr{Cchar}, path::Ptr{Cchar}, out_future::Ptr{Ptr{quiver_future_t}})::quiver_error_t
+end
+
+function quiver_database_export_collection_async(db, collection, directory, out_future)
+    @ccall libquiver_c.quiver_database_export_collection_async(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, directory::Ptr{Cchar}, out_future::Ptr{Ptr{quiver_future_t}})::quiver_error_t
+end
+
+function quiver_database_import_collection_async(db, collection, directory, out_future)
+    @ccall libquiver_c.quiver_database_import_collection_async(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, directory::Ptr{Cchar}, out_future::Ptr{Ptr{quiver_future_t}})::quiver_error_t
+end
+
+function quiver_future_wait(future, timeout_ms, out_done)
+    @ccall libquiver_c.quiver_future_wait(future::Ptr{quiver_future_t}, timeout_ms::Int64, out_done::Ptr{Cint})::quiver_error_t
+end
+
+function quiver_future_cancel(future)
+    @ccall libquiver_c.quiver_future_cancel(future::Ptr{quiver_future_t})::quiver_error_t
+end
+
+function quiver_future_result(future, out_result)
+    @ccall libquiver_c.quiver_future_result(future::Ptr{quiver_future_t}, out_result::Ptr{Ptr{quiver_result_t}})::quiver_error_t
+end
+
+function quiver_future_free(future)
+    @ccall libquiver_c.quiver_future_free(future::Ptr{quiver_future_t})::Cvoid
+end
+
+mutable struct quiver_filter end
+
+const quiver_filter_t = quiver_filter
+
+function quiver_filter_create()
+    @ccall libquiver_c.quiver_filter_create()::Ptr{quiver_filter_t}
+end
+
+function quiver_filter_destroy(filter)
+    @ccall libquiver_c.quiver_filter_destroy(filter::Ptr{quiver_filter_t})::Cvoid
+end
+
+function quiver_filter_id_range(filter, from, to)
+    @ccall libquiver_c.quiver_filter_id_range(filter::Ptr{quiver_filter_t}, from::Int64, to::Int64)::quiver_error_t
+end
+
+function quiver_filter_id_in(filter, ids, count)
+    @ccall libquiver_c.quiver_filter_id_in(filter::Ptr{quiver_filter_t}, ids::Ptr{Int64}, count::Csize_t)::quiver_error_t
+end
+
+@cenum quiver_filter_op_t::UInt32 begin
+    QUIVER_FILTER_EQUAL = 0
+    QUIVER_FILTER_NOT_EQUAL = 1
+    QUIVER_FILTER_LESS = 2
+    QUIVER_FILTER_LESS_EQUAL = 3
+    QUIVER_FILTER_GREATER = 4
+    QUIVER_FILTER_GREATER_EQUAL = 5
+    QUIVER_FILTER_IS_NULL = 6
+    QUIVER_FILTER_IS_NOT_NULL = 7
+end
+
+function quiver_filter_where_integer(filter, attribute, op, value)
+    @ccall libquiver_c.quiver_filter_where_integer(filter::Ptr{quiver_filter_t}, attribute::Ptr{Cchar}, op::quiver_filter_op_t, value::Int64)::quiver_error_t
+end
+
+function quiver_filter_where_float(filter, attribute, op, value)
+    @ccall libquiver_c.quiver_filter_where_float(filter::Ptr{quiver_filter_t}, attribute::Ptr{Cchar}, op::quiver_filter_op_t, value::Cdouble)::quiver_error_t
+end
+
+function quiver_filter_where_string(filter, attribute, op, value)
+    @ccall libquiver_c.quiver_filter_where_string(filter::Ptr{quiver_filter_t}, attribute::Ptr{Cchar}, op::quiver_filter_op_t, value::Ptr{Cchar})::quiver_error_t
+end
+
+function quiver_filter_where_null(filter, attribute, op)
+    @ccall libquiver_c.quiver_filter_where_null(filter::Ptr{quiver_filter_t}, attribute::Ptr{Cchar}, op::quiver_filter_op_t)::quiver_error_t
+end
+
+function quiver_database_read_element_ids_filtered(db, collection, filter, out_ids, out_count)
+    @ccall libquiver_c.quiver_database_read_element_ids_filtered(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, filter::Ptr{quiver_filter_t}, out_ids::Ptr{Ptr{Int64}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_scalar_integers_filtered(db, collection, attribute, filter, out_values, out_count)
+    @ccall libquiver_c.quiver_database_read_scalar_integers_filtered(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, filter::Ptr{quiver_filter_t}, out_values::Ptr{Ptr{Int64}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_scalar_floats_filtered(db, collection, attribute, filter, out_values, out_count)
+    @ccall libquiver_c.quiver_database_read_scalar_floats_filtered(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, filter::Ptr{quiver_filter_t}, out_values::Ptr{Ptr{Cdouble}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_scalar_strings_filtered(db, collection, attribute, filter, out_values, out_count)
+    @ccall libquiver_c.quiver_database_read_scalar_strings_filtered(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, filter::Ptr{quiver_filter_t}, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_vector_integers_flat_filtered(db, collection, attribute, filter, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_vector_integers_flat_filtered(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, filter::Ptr{quiver_filter_t}, out_values::Ptr{Ptr{Int64}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_vector_floats_flat_filtered(db, collection, attribute, filter, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_vector_floats_flat_filtered(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, filter::Ptr{quiver_filter_t}, out_values::Ptr{Ptr{Cdouble}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_vector_strings_flat_filtered(db, collection, attribute, filter, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_vector_strings_flat_filtered(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, filter::Ptr{quiver_filter_t}, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_set_integers_flat_filtered(db, collection, attribute, filter, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_set_integers_flat_filtered(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, filter::Ptr{quiver_filter_t}, out_values::Ptr{Ptr{Int64}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_set_floats_flat_filtered(db, collection, attribute, filter, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_set_floats_flat_filtered(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, filter::Ptr{quiver_filter_t}, out_values::Ptr{Ptr{Cdouble}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_set_strings_flat_filtered(db, collection, attribute, filter, out_values, out_offsets, out_count)
+    @ccall libquiver_c.quiver_database_read_set_strings_flat_filtered(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, filter::Ptr{quiver_filter_t}, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_offsets::Ptr{Ptr{Csize_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_delete_elements_where(db, collection, filter, out_deleted)
+    @ccall libquiver_c.quiver_database_delete_elements_where(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, filter::Ptr{quiver_filter_t}, out_deleted::Ptr{Csize_t})::quiver_error_t
+end
+
 function quiver_element_create()
     @ccall libquiver_c.quiver_element_create()::Ptr{quiver_element_t}
 end
@@ -436,6 +1289,38 @@ function quiver_element_array_count(element)
     @ccall libquiver_c.quiver_element_array_count(element::Ptr{quiver_element_t})::Csize_t
 end
 
+function quiver_element_scalar_name(element, index)
+    @ccall libquiver_c.quiver_element_scalar_name(element::Ptr{quiver_element_t}, index::Csize_t)::Ptr{Cchar}
+end
+
+function quiver_element_array_name(element, index)
+    @ccall libquiver_c.quiver_element_array_name(element::Ptr{quiver_element_t}, index::Csize_t)::Ptr{Cchar}
+end
+
+function quiver_element_get_integer(element, name, out_value, out_has_value)
+    @ccall libquiver_c.quiver_element_get_integer(element::Ptr{quiver_element_t}, name::Ptr{Cchar}, out_value::Ptr{Int64}, out_has_value::Ptr{Cint})::quiver_error_t
+end
+
+function quiver_element_get_float(element, name, out_value, out_has_value)
+    @ccall libquiver_c.quiver_element_get_float(element::Ptr{quiver_element_t}, name::Ptr{Cchar}, out_value::Ptr{Cdouble}, out_has_value::Ptr{Cint})::quiver_error_t
+end
+
+function quiver_element_get_string(element, name, out_value, out_has_value)
+    @ccall libquiver_c.quiver_element_get_string(element::Ptr{quiver_element_t}, name::Ptr{Cchar}, out_value::Ptr{Ptr{Cchar}}, out_has_value::Ptr{Cint})::quiver_error_t
+end
+
+function quiver_element_get_array_integer(element, name, out_values, out_count)
+    @ccall libquiver_c.quiver_element_get_array_integer(element::Ptr{quiver_element_t}, name::Ptr{Cchar}, out_values::Ptr{Ptr{Int64}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_element_get_array_float(element, name, out_values, out_count)
+    @ccall libquiver_c.quiver_element_get_array_float(element::Ptr{quiver_element_t}, name::Ptr{Cchar}, out_values::Ptr{Ptr{Cdouble}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_element_get_array_string(element, name, out_values, out_count)
+    @ccall libquiver_c.quiver_element_get_array_string(element::Ptr{quiver_element_t}, name::Ptr{Cchar}, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
 function quiver_element_to_string(element)
     @ccall libquiver_c.quiver_element_to_string(element::Ptr{quiver_element_t})::Ptr{Cchar}
 end
@@ -460,10 +1345,28 @@ function quiver_lua_runner_run(runner, script)
     @ccall libquiver_c.quiver_lua_runner_run(runner::Ptr{quiver_lua_runner_t}, script::Ptr{Cchar})::quiver_error_t
 end
 
+function quiver_lua_runner_compile(runner, name, script, out_handle)
+    @ccall libquiver_c.quiver_lua_runner_compile(runner::Ptr{quiver_lua_runner_t}, name::Ptr{Cchar}, script::Ptr{Cchar}, out_handle::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_lua_runner_run_compiled(runner, handle, arg_types, arg_values, arg_count)
+    @ccall libquiver_c.quiver_lua_runner_run_compiled(runner::Ptr{quiver_lua_runner_t}, handle::Csize_t, arg_types::Ptr{Cint}, arg_values::Ptr{Ptr{Cvoid}}, arg_count::Csize_t)::quiver_error_t
+end
+
+function quiver_lua_runner_release(runner, handle)
+    @ccall libquiver_c.quiver_lua_runner_release(runner::Ptr{quiver_lua_runner_t}, handle::Csize_t)::quiver_error_t
+end
+
 function quiver_lua_runner_get_error(runner)
     @ccall libquiver_c.quiver_lua_runner_get_error(runner::Ptr{quiver_lua_runner_t})::Ptr{Cchar}
 end
 
+const ARROW_FLAG_DICTIONARY_ORDERED = 1
+
+const ARROW_FLAG_NULLABLE = 2
+
+const ARROW_FLAG_MAP_KEYS_SORTED = 4
+
 #! format: on
 
 
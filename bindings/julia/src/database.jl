@@ -8,8 +8,39 @@ mutable struct Database
     end
 end
 
+function _default_options()
+    defaults = C.quiver_database_options_default()
+    return Ref(
+        C.quiver_database_options_t(
+            defaults.read_only,
+            C.QUIVER_LOG_DEBUG,
+            defaults.statement_cache_size,
+            defaults.journal_mode,
+            defaults.synchronous,
+            defaults.temp_store,
+            defaults.page_size,
+            defaults.cache_size,
+            defaults.mmap_size,
+            defaults.mapped,
+            defaults.validate_schema,
+            defaults.file_level,
+            defaults.async_logging,
+            defaults.collect_stats,
+            defaults.slow_query_ms,
+            defaults.busy_timeout_ms,
+            defaults.statement_timeout_ms,
+            defaults.load_into_memory,
+            defaults.track_changes,
+            defaults.cache_reads,
+            defaults.read_cache_limit,
+            defaults.soft_heap_limit,
+            defaults.hard_heap_limit,
+        ),
+    )
+end
+
 function from_schema(db_path, schema_path)
-    options = Ref(C.quiver_database_options_t(0, C.QUIVER_LOG_DEBUG))
+    options = _default_options()
     ptr = C.quiver_database_from_schema(db_path, schema_path, options)
     if ptr == C_NULL
         throw(DatabaseException("Failed to create database from schema '$schema_path'"))
@@ -18,7 +49,7 @@ function from_schema(db_path, schema_path)
 end
 
 function from_migrations(db_path, migrations_path)
-    options = Ref(C.quiver_database_options_t(0, C.QUIVER_LOG_DEBUG))
+    options = _default_options()
     ptr = C.quiver_database_from_migrations(db_path, migrations_path, options)
     if ptr == C_NULL
         throw(DatabaseException("Failed to create database from migrations '$migrations_path'"))
@@ -23,6 +23,41 @@ function create_element!(db::Database, collection::String; kwargs...)
     end
 end
 
+function create_elements!(db::Database, collection::String, elements::Vector{Element})
+    ptrs = [e.ptr for e in elements]
+    ids = Vector{Int64}(undef, length(elements))
+    err = C.quiver_database_create_elements(db.ptr, collection, ptrs, length(elements), ids)
+    check_error(err, "Failed to create elements in collection $collection")
+    return ids
+end
+
+function upsert_element!(db::Database, collection::String, e::Element)
+    id = Ref{Int64}(0)
+    err = C.quiver_database_upsert_element(db.ptr, collection, e.ptr, id)
+    check_error(err, "Failed to upsert element in collection $collection")
+    return id[]
+end
+
+function upsert_element!(db::Database, collection::String; kwargs...)
+    e = Element()
+    for (k, v) in kwargs
+        e[String(k)] = v
+    end
+    try
+        return upsert_element!(db, collection, e)
+    finally
+        destroy!(e)
+    end
+end
+
+function upsert_elements!(db::Database, collection::String, elements::Vector{Element})
+    ptrs = [e.ptr for e in elements]
+    ids = Vector{Int64}(undef, length(elements))
+    err = C.quiver_database_upsert_elements(db.ptr, collection, ptrs, length(elements), ids)
+    check_error(err, "Failed to upsert elements in collection $collection")
+    return ids
+end
+
 function set_scalar_relation!(
     db::Database,
     collection::String,
@@ -34,3 +69,35 @@ function set_scalar_relation!(
     check_error(err, "Failed to set scalar relation '$attribute' in '$collection'")
     return nothing
 end
+
+function set_scalar_relations!(
+    db::Database,
+    collection::String,
+    attribute::String,
+    from_labels::Vector{<:AbstractString},
+    to_labels::Vector{<:AbstractString},
+)
+    if length(from_labels) != length(to_labels)
+        throw(
+            DatabaseException(
+                "Relation '$attribute' has $(length(from_labels)) source labels but $(length(to_labels)) target labels",
+            ),
+        )
+    end
+    from_cstrings = [Base.cconvert(Cstring, s) for s in from_labels]
+    to_cstrings = [Base.cconvert(Cstring, s) for s in to_labels]
+    from_ptrs = [Base.unsafe_convert(Cstring, cs) for cs in from_cstrings]
+    to_ptrs = [Base.unsafe_convert(Cstring, cs) for cs in to_cstrings]
+    GC.@preserve from_cstrings to_cstrings begin
+        err = C.quiver_database_set_scalar_relations(
+            db.ptr,
+            collection,
+            attribute,
+            from_ptrs,
+            to_ptrs,
+            Csize_t(length(from_labels)),
+        )
+    end
+    check_error(err, "Failed to set scalar relations '$attribute' in '$collection'")
+    return nothing
+end
@@ -9,3 +9,15 @@ function import_from_csv(db::Database, table::String, path::String)
     check_error(err, "Failed to import CSV file '$path' into table '$table'")
     return nothing
 end
+
+function export_collection(db::Database, collection::String, directory::String)
+    err = C.quiver_database_export_collection(db.ptr, collection, directory)
+    check_error(err, "Failed to export collection '$collection' to '$directory'")
+    return nothing
+end
+
+function import_collection(db::Database, collection::String, directory::String)
+    err = C.quiver_database_import_collection(db.ptr, collection, directory)
+    check_error(err, "Failed to import collection '$collection' from '$directory'")
+    return nothing
+end
@@ -3,3 +3,11 @@ function delete_element_by_id!(db::Database, collection::String, id::Int64)
     check_error(err, "Failed to delete element $id from '$collection'")
     return nothing
 end
+
+# Deletes the elements and their vector/set/time series rows in a single transaction; returns how many were deleted
+function delete_elements_by_ids!(db::Database, collection::String, ids::Vector{Int64})
+    out_deleted = Ref{Csize_t}(0)
+    err = C.quiver_database_delete_elements_by_ids(db.ptr, collection, ids, Csize_t(length(ids)), out_deleted)
+    check_error(err, "Failed to delete elements from '$collection'")
+    return Int(out_deleted[])
+end
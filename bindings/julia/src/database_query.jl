@@ -227,3 +227,70 @@ function query_date_time(db::Database, sql::String, params::Vector)
     end
     return string_to_date_time(result)
 end
+
+function cursor_value(cursor::Ptr{C.quiver_cursor_t}, column::Integer)
+    out_type = Ref{C.quiver_data_type_t}(C.QUIVER_DATA_TYPE_NULL)
+    check_error(C.quiver_cursor_column_type(cursor, column, out_type), "Failed to read cursor column type")
+    out_has_value = Ref{Cint}(0)
+    if out_type[] == C.QUIVER_DATA_TYPE_INTEGER
+        out_value = Ref{Int64}(0)
+        check_error(C.quiver_cursor_get_integer(cursor, column, out_value, out_has_value), "Failed to read cursor value")
+        return out_value[]
+    elseif out_type[] == C.QUIVER_DATA_TYPE_FLOAT
+        out_value = Ref{Float64}(0.0)
+        check_error(C.quiver_cursor_get_float(cursor, column, out_value, out_has_value), "Failed to read cursor value")
+        return out_value[]
+    elseif out_type[] == C.QUIVER_DATA_TYPE_STRING
+        out_value = Ref{Ptr{Cchar}}(C_NULL)
+        check_error(C.quiver_cursor_get_string(cursor, column, out_value, out_has_value), "Failed to read cursor value")
+        result = unsafe_string(out_value[])
+        C.quiver_string_free(out_value[])
+        return result
+    elseif out_type[] == C.QUIVER_DATA_TYPE_BLOB
+        out_data = Ref{Ptr{UInt8}}(C_NULL)
+        out_size = Ref{Csize_t}(0)
+        check_error(C.quiver_cursor_get_blob(cursor, column, out_data, out_size, out_has_value), "Failed to read cursor value")
+        result = out_size[] == 0 ? UInt8[] : copy(unsafe_wrap(Vector{UInt8}, out_data[], out_size[]))
+        C.quiver_blob_free(out_data[])
+        return result
+    end
+    return nothing
+end
+
+"""
+    each_row(f, db::Database, sql::String, params::Vector = []) -> Int
+
+Stream the rows of a (parameterized) SQL query, calling `f(row)` with a `Vector{Any}` per row.
+Rows are stepped one at a time, so memory use does not grow with the result size.
+Returns the number of rows visited. Supports `do`-block syntax.
+"""
+function each_row(f, db::Database, sql::String, params::Vector = [])
+    param_types, param_values, refs = marshal_params(params)
+    out_cursor = Ref{Ptr{C.quiver_cursor_t}}(C_NULL)
+    err = GC.@preserve refs C.quiver_database_open_cursor(
+        db.ptr,
+        sql,
+        param_types,
+        param_values,
+        length(params),
+        out_cursor,
+    )
+    check_error(err, "Failed to open cursor")
+
+    cursor = out_cursor[]
+    count = 0
+    try
+        out_count = Ref{Csize_t}(0)
+        check_error(C.quiver_cursor_column_count(cursor, out_count), "Failed to read cursor columns")
+        out_has_row = Ref{Cint}(0)
+        while true
+            check_error(C.quiver_cursor_next(cursor, out_has_row), "Failed to step cursor")
+            out_has_row[] == 0 && break
+            f(Any[cursor_value(cursor, i) for i in 0:(out_count[]-1)])
+            count += 1
+        end
+    finally
+        C.quiver_cursor_free(cursor)
+    end
+    return count
+end
@@ -26,14 +26,12 @@ function read_scalar_relation(db::Database, collection::String, attribute::Strin
     return result
 end
 
-function read_scalar_integers(db::Database, collection::String, attribute::String)
+function read_scalar_relation_ids(db::Database, collection::String, attribute::String)
     out_values = Ref{Ptr{Int64}}(C_NULL)
     out_count = Ref{Csize_t}(0)
 
-    err = C.quiver_database_read_scalar_integers(db.ptr, collection, attribute, out_values, out_count)
-    if err != C.QUIVER_OK
-        throw(DatabaseException("Failed to read scalar integers from '$collection.$attribute'"))
-    end
+    err = C.quiver_database_read_scalar_relation_ids(db.ptr, collection, attribute, out_values, out_count)
+    check_error(err, "Failed to read scalar relation ids '$attribute' from '$collection'")
 
     count = out_count[]
     if count == 0 || out_values[] == C_NULL
@@ -45,23 +43,159 @@ function read_scalar_integers(db::Database, collection::String, attribute::Strin
     return result
 end
 
-function read_scalar_floats(db::Database, collection::String, attribute::String)
-    out_values = Ref{Ptr{Float64}}(C_NULL)
+# Nullable readers keep one entry per element (nothing where null), aligned with read_element_ids
+function read_scalar_integers_nullable(db::Database, collection::String, attribute::String)
+    return _read_scalar_nullable(
+        C.quiver_database_read_scalar_integers_nullable,
+        Int64,
+        db,
+        collection,
+        attribute,
+        "integers",
+    )
+end
+
+function read_scalar_floats_nullable(db::Database, collection::String, attribute::String)
+    return _read_scalar_nullable(
+        C.quiver_database_read_scalar_floats_nullable,
+        Float64,
+        db,
+        collection,
+        attribute,
+        "floats",
+    )
+end
+
+function read_scalar_strings_nullable(db::Database, collection::String, attribute::String)
+    return _read_scalar_nullable(
+        C.quiver_database_read_scalar_strings_nullable,
+        String,
+        db,
+        collection,
+        attribute,
+        "strings",
+    )
+end
+
+function _read_scalar_nullable(
+    read_fn,
+    ::Type{T},
+    db::Database,
+    collection::String,
+    attribute::String,
+    context::String,
+) where {T}
+    out_values = Ref{Ptr{T === String ? Ptr{Cchar} : T}}(C_NULL)
+    out_validity = Ref{Ptr{UInt8}}(C_NULL)
     out_count = Ref{Csize_t}(0)
 
-    err = C.quiver_database_read_scalar_floats(db.ptr, collection, attribute, out_values, out_count)
-    if err != C.QUIVER_OK
-        throw(DatabaseException("Failed to read scalar floats from '$collection.$attribute'"))
+    err = read_fn(db.ptr, collection, attribute, out_values, out_validity, out_count)
+    check_error(err, "Failed to read nullable scalar $context from '$collection.$attribute'")
+
+    return _decode_nullable(T, out_values[], out_validity[], out_count[])
+end
+
+# Copies count values plus validity bitmap into a Vector{Union{T, Nothing}} and frees the C buffers
+function _decode_nullable(::Type{T}, values_ptr, validity_ptr, count::Integer) where {T}
+    if count == 0
+        return Union{T, Nothing}[]
+    end
+
+    values = unsafe_wrap(Array, values_ptr, count)
+    validity = unsafe_wrap(Array, validity_ptr, cld(count, 8))
+    result = Vector{Union{T, Nothing}}(nothing, count)
+    for i in 1:count
+        if (validity[((i - 1) >> 3) + 1] >> ((i - 1) & 7)) & 0x01 != 0
+            result[i] = T === String ? unsafe_string(values[i]) : values[i]
+        end
+    end
+    if T === String
+        C.quiver_free_string_array(values_ptr, count)
+    elseif T === Int64
+        C.quiver_free_integer_array(values_ptr)
+    else
+        C.quiver_free_float_array(values_ptr)
     end
+    C.quiver_free_validity_bitmap(validity_ptr)
+    return result
+end
+
+# Reads several scalar attributes in one pass; columns[name][i] belongs to ids[i] (nothing where null)
+function read_scalars(db::Database, collection::String, attributes::Vector{String})
+    out_ids = Ref{Ptr{Int64}}(C_NULL)
+    out_columns = Ref{Ptr{C.quiver_scalar_column_t}}(C_NULL)
+    out_count = Ref{Csize_t}(0)
+
+    cstrings = [Base.cconvert(Cstring, s) for s in attributes]
+    ptrs = [Base.unsafe_convert(Cstring, cs) for cs in cstrings]
+    GC.@preserve cstrings begin
+        err = C.quiver_database_read_scalars(
+            db.ptr,
+            collection,
+            ptrs,
+            Csize_t(length(attributes)),
+            out_ids,
+            out_columns,
+            out_count,
+        )
+    end
+    check_error(err, "Failed to read scalars from '$collection'")
 
     count = out_count[]
-    if count == 0 || out_values[] == C_NULL
-        return Float64[]
+    ids = count == 0 ? Int64[] : unsafe_wrap(Array, out_ids[], count) |> copy
+    columns = Dict{String, Vector}()
+    for i in 1:length(attributes)
+        column = unsafe_load(out_columns[], i)
+        name = unsafe_string(column.name)
+        if count == 0
+            columns[name] = Nothing[]
+            continue
+        end
+        nulls = unsafe_wrap(Array, column.nulls, count)
+        if column.data_type == C.QUIVER_DATA_TYPE_INTEGER
+            values = unsafe_wrap(Array, column.integers, count)
+            columns[name] = Union{Int64, Nothing}[nulls[j] != 0 ? nothing : values[j] for j in 1:count]
+        elseif column.data_type == C.QUIVER_DATA_TYPE_FLOAT
+            values = unsafe_wrap(Array, column.floats, count)
+            columns[name] = Union{Float64, Nothing}[nulls[j] != 0 ? nothing : values[j] for j in 1:count]
+        else
+            values = unsafe_wrap(Array, column.strings, count)
+            columns[name] = Union{String, Nothing}[nulls[j] != 0 ? nothing : unsafe_string(values[j]) for j in 1:count]
+        end
     end
+    C.quiver_free_scalar_columns(out_ids[], out_columns[], Csize_t(length(attributes)), count)
+    return (ids = ids, columns = columns)
+end
 
-    result = unsafe_wrap(Array, out_values[], count) |> copy
-    C.quiver_free_float_array(out_values[])
-    return result
+function read_scalar_integers(db::Database, collection::String, attribute::String)
+    return _read_scalar_into(C.quiver_database_read_scalar_integers_into, Int64, db, collection, attribute, "integers")
+end
+
+function read_scalar_floats(db::Database, collection::String, attribute::String)
+    return _read_scalar_into(C.quiver_database_read_scalar_floats_into, Float64, db, collection, attribute, "floats")
+end
+
+# Reads straight into a Julia-owned buffer sized by a count query, so values are copied exactly once
+function _read_scalar_into(
+    read_fn,
+    ::Type{T},
+    db::Database,
+    collection::String,
+    attribute::String,
+    context::String,
+) where {T}
+    out_count = Ref{Csize_t}(0)
+    err = C.quiver_database_count_scalar_values(db.ptr, collection, attribute, out_count)
+    check_error(err, "Failed to read scalar $context from '$collection.$attribute'")
+
+    result = Vector{T}(undef, out_count[])
+    while true
+        err = read_fn(db.ptr, collection, attribute, result, length(result), out_count)
+        check_error(err, "Failed to read scalar $context from '$collection.$attribute'")
+        out_count[] <= length(result) && break
+        resize!(result, out_count[])
+    end
+    return resize!(result, out_count[])
 end
 
 function read_scalar_strings(db::Database, collection::String, attribute::String)
@@ -260,6 +394,112 @@ function read_set_strings(db::Database, collection::String, attribute::String)
     return result
 end
 
+function _flat_groups(values::Vector, offsets::Vector{Int}, count::Integer)
+    return [view(values, (offsets[i]+1):offsets[i+1]) for i in 1:count]
+end
+
+function _read_flat_numeric(
+    read_fn,
+    free_fn,
+    ::Type{T},
+    db::Database,
+    collection::String,
+    attribute::String,
+    context::String,
+) where {T}
+    out_values = Ref{Ptr{T}}(C_NULL)
+    out_offsets = Ref{Ptr{Csize_t}}(C_NULL)
+    out_count = Ref{Csize_t}(0)
+
+    err = read_fn(db.ptr, collection, attribute, out_values, out_offsets, out_count)
+    check_error(err, "Failed to read $context from '$collection.$attribute'")
+
+    count = out_count[]
+    offsets = Int.(unsafe_wrap(Array, out_offsets[], count + 1))
+    total = offsets[end]
+    values = total == 0 ? T[] : copy(unsafe_wrap(Array, out_values[], total))
+    free_fn(out_values[], out_offsets[])
+    return _flat_groups(values, offsets, count)
+end
+
+function _read_flat_strings(read_fn, db::Database, collection::String, attribute::String, context::String)
+    out_values = Ref{Ptr{Ptr{Cchar}}}(C_NULL)
+    out_offsets = Ref{Ptr{Csize_t}}(C_NULL)
+    out_count = Ref{Csize_t}(0)
+
+    err = read_fn(db.ptr, collection, attribute, out_values, out_offsets, out_count)
+    check_error(err, "Failed to read $context from '$collection.$attribute'")
+
+    count = out_count[]
+    offsets = Int.(unsafe_wrap(Array, out_offsets[], count + 1))
+    total = offsets[end]
+    values = total == 0 ? String[] : [unsafe_string(ptr) for ptr in unsafe_wrap(Array, out_values[], total)]
+    C.quiver_free_string_flat(out_values[], out_offsets[], count)
+    return _flat_groups(values, offsets, count)
+end
+
+"""
+    read_vector_integers_flat(db, collection, attribute) -> Vector{<:AbstractVector{Int64}}
+
+Read a vector attribute for all elements with a single contiguous copy.
+Each group is a `view` into one shared buffer instead of a separately allocated vector.
+"""
+function read_vector_integers_flat(db::Database, collection::String, attribute::String)
+    return _read_flat_numeric(
+        C.quiver_database_read_vector_integers_flat,
+        C.quiver_free_integer_flat,
+        Int64,
+        db,
+        collection,
+        attribute,
+        "vector integers",
+    )
+end
+
+function read_vector_floats_flat(db::Database, collection::String, attribute::String)
+    return _read_flat_numeric(
+        C.quiver_database_read_vector_floats_flat,
+        C.quiver_free_float_flat,
+        Float64,
+        db,
+        collection,
+        attribute,
+        "vector floats",
+    )
+end
+
+function read_vector_strings_flat(db::Database, collection::String, attribute::String)
+    return _read_flat_strings(C.quiver_database_read_vector_strings_flat, db, collection, attribute, "vector strings")
+end
+
+function read_set_integers_flat(db::Database, collection::String, attribute::String)
+    return _read_flat_numeric(
+        C.quiver_database_read_set_integers_flat,
+        C.quiver_free_integer_flat,
+        Int64,
+        db,
+        collection,
+        attribute,
+        "set integers",
+    )
+end
+
+function read_set_floats_flat(db::Database, collection::String, attribute::String)
+    return _read_flat_numeric(
+        C.quiver_database_read_set_floats_flat,
+        C.quiver_free_float_flat,
+        Float64,
+        db,
+        collection,
+        attribute,
+        "set floats",
+    )
+end
+
+function read_set_strings_flat(db::Database, collection::String, attribute::String)
+    return _read_flat_strings(C.quiver_database_read_set_strings_flat, db, collection, attribute, "set strings")
+end
+
 function read_scalar_integers_by_id(db::Database, collection::String, attribute::String, id::Int64)
     out_value = Ref{Int64}(0)
     out_has_value = Ref{Cint}(0)
@@ -435,6 +675,127 @@ function read_set_date_time_by_id(db::Database, collection::String, attribute::S
     return [string_to_date_time(s) for s in read_set_strings_by_id(db, collection, attribute, id)]
 end
 
+# Batch readers return one entry per id in input order; unknown ids read as nothing (scalars) or empty groups
+function read_scalar_integers_by_ids(db::Database, collection::String, attribute::String, ids::Vector{Int64})
+    return _read_scalar_by_ids(C.quiver_database_read_scalar_integers_by_ids, Int64, db, collection, attribute, ids)
+end
+
+function read_scalar_floats_by_ids(db::Database, collection::String, attribute::String, ids::Vector{Int64})
+    return _read_scalar_by_ids(C.quiver_database_read_scalar_floats_by_ids, Float64, db, collection, attribute, ids)
+end
+
+function read_scalar_strings_by_ids(db::Database, collection::String, attribute::String, ids::Vector{Int64})
+    return _read_scalar_by_ids(C.quiver_database_read_scalar_strings_by_ids, String, db, collection, attribute, ids)
+end
+
+function read_vector_integers_by_ids(db::Database, collection::String, attribute::String, ids::Vector{Int64})
+    return _read_groups_by_ids(C.quiver_database_read_vector_integers_by_ids, Int64, db, collection, attribute, ids)
+end
+
+function read_vector_floats_by_ids(db::Database, collection::String, attribute::String, ids::Vector{Int64})
+    return _read_groups_by_ids(C.quiver_database_read_vector_floats_by_ids, Float64, db, collection, attribute, ids)
+end
+
+function read_vector_strings_by_ids(db::Database, collection::String, attribute::String, ids::Vector{Int64})
+    return _read_groups_by_ids(C.quiver_database_read_vector_strings_by_ids, String, db, collection, attribute, ids)
+end
+
+function read_set_integers_by_ids(db::Database, collection::String, attribute::String, ids::Vector{Int64})
+    return _read_groups_by_ids(C.quiver_database_read_set_integers_by_ids, Int64, db, collection, attribute, ids)
+end
+
+function read_set_floats_by_ids(db::Database, collection::String, attribute::String, ids::Vector{Int64})
+    return _read_groups_by_ids(C.quiver_database_read_set_floats_by_ids, Float64, db, collection, attribute, ids)
+end
+
+function read_set_strings_by_ids(db::Database, collection::String, attribute::String, ids::Vector{Int64})
+    return _read_groups_by_ids(C.quiver_database_read_set_strings_by_ids, String, db, collection, attribute, ids)
+end
+
+function _read_scalar_by_ids(
+    read_fn,
+    ::Type{T},
+    db::Database,
+    collection::String,
+    attribute::String,
+    ids::Vector{Int64},
+) where {T}
+    out_values = Ref{Ptr{T === String ? Ptr{Cchar} : T}}(C_NULL)
+    out_validity = Ref{Ptr{UInt8}}(C_NULL)
+
+    err = read_fn(db.ptr, collection, attribute, ids, length(ids), out_values, out_validity)
+    check_error(err, "Failed to read scalar by ids from '$collection.$attribute'")
+
+    return _decode_nullable(T, out_values[], out_validity[], length(ids))
+end
+
+function _read_groups_by_ids(
+    read_fn,
+    ::Type{T},
+    db::Database,
+    collection::String,
+    attribute::String,
+    ids::Vector{Int64},
+) where {T}
+    out_values = Ref{Ptr{T === String ? Ptr{Cchar} : T}}(C_NULL)
+    out_offsets = Ref{Ptr{Csize_t}}(C_NULL)
+
+    err = read_fn(db.ptr, collection, attribute, ids, length(ids), out_values, out_offsets)
+    check_error(err, "Failed to read groups by ids from '$collection.$attribute'")
+
+    count = length(ids)
+    offsets = Int.(unsafe_wrap(Array, out_offsets[], count + 1))
+    total = offsets[end]
+    if T === String
+        values = total == 0 ? String[] : [unsafe_string(ptr) for ptr in unsafe_wrap(Array, out_values[], total)]
+        C.quiver_free_string_flat(out_values[], out_offsets[], count)
+    elseif T === Int64
+        values = total == 0 ? T[] : copy(unsafe_wrap(Array, out_values[], total))
+        C.quiver_free_integer_flat(out_values[], out_offsets[])
+    else
+        values = total == 0 ? T[] : copy(unsafe_wrap(Array, out_values[], total))
+        C.quiver_free_float_flat(out_values[], out_offsets[])
+    end
+    return [values[(offsets[i]+1):offsets[i+1]] for i in 1:count]
+end
+
+function read_time_series_floats(
+    db::Database,
+    collection::String,
+    attribute::String,
+    id::Int64;
+    date_time_from::Union{Nothing, String} = nothing,
+    date_time_to::Union{Nothing, String} = nothing,
+)
+    out_date_times = Ref{Ptr{Ptr{Cchar}}}(C_NULL)
+    out_values = Ref{Ptr{Float64}}(C_NULL)
+    out_count = Ref{Csize_t}(0)
+
+    err = C.quiver_database_read_time_series_floats(
+        db.ptr,
+        collection,
+        attribute,
+        id,
+        something(date_time_from, C_NULL),
+        something(date_time_to, C_NULL),
+        out_date_times,
+        out_values,
+        out_count,
+    )
+    check_error(err, "Failed to read time series floats from '$collection.$attribute' for id $id")
+
+    count = out_count[]
+    if count == 0
+        return (date_times = String[], values = Float64[])
+    end
+
+    ptrs = unsafe_wrap(Array, out_date_times[], count)
+    date_times = [unsafe_string(ptr) for ptr in ptrs]
+    values = unsafe_wrap(Array, out_values[], count) |> copy
+    C.quiver_free_time_series_floats(out_date_times[], out_values[], count)
+    return (date_times = date_times, values = values)
+end
+
 function read_element_ids(db::Database, collection::String)
     out_ids = Ref{Ptr{Int64}}(C_NULL)
     out_count = Ref{Csize_t}(0)
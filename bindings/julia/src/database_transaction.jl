@@ -0,0 +1,42 @@
+function begin_transaction!(db::Database)
+    err = C.quiver_database_begin_transaction(db.ptr)
+    check_error(err, "Failed to begin transaction")
+    return nothing
+end
+
+function commit!(db::Database)
+    err = C.quiver_database_commit(db.ptr)
+    check_error(err, "Failed to commit transaction")
+    return nothing
+end
+
+function rollback!(db::Database)
+    err = C.quiver_database_rollback(db.ptr)
+    check_error(err, "Failed to rollback transaction")
+    return nothing
+end
+
+function in_transaction(db::Database)
+    out_active = Ref{Cint}(0)
+    err = C.quiver_database_in_transaction(db.ptr, out_active)
+    check_error(err, "Failed to query transaction state")
+    return out_active[] != 0
+end
+
+"""
+    transaction(f, db::Database)
+
+Run `f()` inside a transaction, committing on return and rolling back if `f` throws.
+Nested calls use SAVEPOINTs. Supports `do`-block syntax.
+"""
+function transaction(f::Function, db::Database)
+    begin_transaction!(db)
+    try
+        result = f()
+        commit!(db)
+        return result
+    catch
+        rollback!(db)
+        rethrow()
+    end
+end
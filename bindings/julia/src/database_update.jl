@@ -37,6 +37,66 @@ function update_scalar_string!(db::Database, collection::String, attribute::Stri
     return nothing
 end
 
+# Batch scalar updates: values[i] is written to element ids[i] in a single transaction
+
+function update_scalar_integers!(
+    db::Database,
+    collection::String,
+    attribute::String,
+    ids::Vector{Int64},
+    values::Vector{<:Integer},
+)
+    _check_batch_length(attribute, ids, values)
+    integer_values = Int64[Int64(v) for v in values]
+    err = C.quiver_database_update_scalar_integers(
+        db.ptr,
+        collection,
+        attribute,
+        ids,
+        integer_values,
+        Csize_t(length(ids)),
+    )
+    check_error(err, "Failed to update scalar integers '$collection.$attribute'")
+    return nothing
+end
+
+function update_scalar_floats!(
+    db::Database,
+    collection::String,
+    attribute::String,
+    ids::Vector{Int64},
+    values::Vector{<:Real},
+)
+    _check_batch_length(attribute, ids, values)
+    float_values = Float64[Float64(v) for v in values]
+    err = C.quiver_database_update_scalar_floats(db.ptr, collection, attribute, ids, float_values, Csize_t(length(ids)))
+    check_error(err, "Failed to update scalar floats '$collection.$attribute'")
+    return nothing
+end
+
+function update_scalar_strings!(
+    db::Database,
+    collection::String,
+    attribute::String,
+    ids::Vector{Int64},
+    values::Vector{<:AbstractString},
+)
+    _check_batch_length(attribute, ids, values)
+    cstrings = [Base.cconvert(Cstring, s) for s in values]
+    ptrs = [Base.unsafe_convert(Cstring, cs) for cs in cstrings]
+    GC.@preserve cstrings begin
+        err = C.quiver_database_update_scalar_strings(db.ptr, collection, attribute, ids, ptrs, Csize_t(length(ids)))
+    end
+    check_error(err, "Failed to update scalar strings '$collection.$attribute'")
+    return nothing
+end
+
+function _check_batch_length(attribute::String, ids::Vector{Int64}, values::Vector)
+    if length(ids) != length(values)
+        throw(DatabaseException("Update of '$attribute' has $(length(ids)) ids but $(length(values)) values"))
+    end
+end
+
 # Update vector attribute functions
 
 function update_vector_integers!(
@@ -89,6 +149,113 @@ function update_vector_strings!(
     return nothing
 end
 
+# Append vector attribute functions
+
+function append_vector_integers!(
+    db::Database,
+    collection::String,
+    attribute::String,
+    id::Int64,
+    values::Vector{<:Integer},
+)
+    integer_values = Int64[Int64(v) for v in values]
+    err = C.quiver_database_append_vector_integers(
+        db.ptr,
+        collection,
+        attribute,
+        id,
+        integer_values,
+        Csize_t(length(integer_values)),
+    )
+    check_error(err, "Failed to append vector integers '$collection.$attribute' for id $id")
+    return nothing
+end
+
+function append_vector_floats!(db::Database, collection::String, attribute::String, id::Int64, values::Vector{<:Real})
+    float_values = Float64[Float64(v) for v in values]
+    err = C.quiver_database_append_vector_floats(
+        db.ptr,
+        collection,
+        attribute,
+        id,
+        float_values,
+        Csize_t(length(float_values)),
+    )
+    check_error(err, "Failed to append vector floats '$collection.$attribute' for id $id")
+    return nothing
+end
+
+function append_vector_strings!(
+    db::Database,
+    collection::String,
+    attribute::String,
+    id::Int64,
+    values::Vector{<:AbstractString},
+)
+    cstrings = [Base.cconvert(Cstring, s) for s in values]
+    ptrs = [Base.unsafe_convert(Cstring, cs) for cs in cstrings]
+    GC.@preserve cstrings begin
+        err = C.quiver_database_append_vector_strings(db.ptr, collection, attribute, id, ptrs, Csize_t(length(values)))
+    end
+    check_error(err, "Failed to append vector strings '$collection.$attribute' for id $id")
+    return nothing
+end
+
+# Update vector entry functions (index is 1-based, like Julia arrays)
+
+function update_vector_integer_entry!(
+    db::Database,
+    collection::String,
+    attribute::String,
+    id::Int64,
+    index::Integer,
+    value::Integer,
+)
+    err = C.quiver_database_update_vector_integer_entry(
+        db.ptr,
+        collection,
+        attribute,
+        id,
+        Int64(index - 1),
+        Int64(value),
+    )
+    check_error(err, "Failed to update vector entry $index of '$collection.$attribute' for id $id")
+    return nothing
+end
+
+function update_vector_float_entry!(
+    db::Database,
+    collection::String,
+    attribute::String,
+    id::Int64,
+    index::Integer,
+    value::Real,
+)
+    err = C.quiver_database_update_vector_float_entry(
+        db.ptr,
+        collection,
+        attribute,
+        id,
+        Int64(index - 1),
+        Float64(value),
+    )
+    check_error(err, "Failed to update vector entry $index of '$collection.$attribute' for id $id")
+    return nothing
+end
+
+function update_vector_string_entry!(
+    db::Database,
+    collection::String,
+    attribute::String,
+    id::Int64,
+    index::Integer,
+    value::AbstractString,
+)
+    err = C.quiver_database_update_vector_string_entry(db.ptr, collection, attribute, id, Int64(index - 1), value)
+    check_error(err, "Failed to update vector entry $index of '$collection.$attribute' for id $id")
+    return nothing
+end
+
 # Update set attribute functions
 
 function update_set_integers!(db::Database, collection::String, attribute::String, id::Int64, values::Vector{<:Integer})
@@ -134,3 +301,38 @@ function update_set_strings!(
     check_error(err, "Failed to update set strings '$collection.$attribute' for id $id")
     return nothing
 end
+
+# Update time series attribute functions
+
+function update_time_series_floats!(
+    db::Database,
+    collection::String,
+    attribute::String,
+    id::Int64,
+    date_times::Vector{<:AbstractString},
+    values::Vector{<:Real},
+)
+    float_values = Float64[Float64(v) for v in values]
+    cstrings = [Base.cconvert(Cstring, s) for s in date_times]
+    ptrs = [Base.unsafe_convert(Cstring, cs) for cs in cstrings]
+    if length(ptrs) != length(float_values)
+        throw(
+            DatabaseException(
+                "Time series '$attribute' has $(length(ptrs)) date_times but $(length(float_values)) values",
+            ),
+        )
+    end
+    GC.@preserve cstrings begin
+        err = C.quiver_database_update_time_series_floats(
+            db.ptr,
+            collection,
+            attribute,
+            id,
+            ptrs,
+            float_values,
+            Csize_t(length(float_values)),
+        )
+    end
+    check_error(err, "Failed to update time series floats '$collection.$attribute' for id $id")
+    return nothing
+end
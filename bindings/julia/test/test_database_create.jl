@@ -263,6 +263,40 @@ include("fixture.jl")
 
         Quiver.close!(db)
     end
+
+    @testset "Multiple Elements" begin
+        path_schema = joinpath(tests_path(), "schemas", "valid", "collections.sql")
+        db = Quiver.from_schema(":memory:", path_schema)
+
+        Quiver.create_element!(db, "Configuration"; label = "Test Config")
+
+        elements = [Quiver.Element() for _ in 1:3]
+        try
+            for (i, e) in enumerate(elements)
+                e["label"] = "Item $i"
+                e["value_int"] = [i, i * 10]
+            end
+            ids = Quiver.create_elements!(db, "Collection", elements)
+            @test ids == [1, 2, 3]
+        finally
+            foreach(Quiver.destroy!, elements)
+        end
+
+        @test Quiver.read_scalar_strings(db, "Collection", "label") == ["Item 1", "Item 2", "Item 3"]
+        @test Quiver.read_vector_integers_by_id(db, "Collection", "value_int", Int64(3)) == [3, 30]
+
+        # A failing element rolls back the whole batch
+        duplicate = Quiver.Element()
+        try
+            duplicate["label"] = "Item 1"
+            @test_throws Quiver.DatabaseException Quiver.create_elements!(db, "Collection", [duplicate])
+        finally
+            Quiver.destroy!(duplicate)
+        end
+        @test length(Quiver.read_scalar_strings(db, "Collection", "label")) == 3
+
+        Quiver.close!(db)
+    end
 end
 
 end
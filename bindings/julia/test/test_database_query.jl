@@ -244,6 +244,33 @@ include("fixture.jl")
 
         Quiver.close!(db)
     end
+
+    @testset "Each Row" begin
+        path_schema = joinpath(tests_path(), "schemas", "valid", "basic.sql")
+        db = Quiver.from_schema(":memory:", path_schema)
+
+        Quiver.create_element!(db, "Configuration"; label = "A", integer_attribute = 1, float_attribute = 1.5)
+        Quiver.create_element!(db, "Configuration"; label = "B", integer_attribute = 2)
+
+        rows = Vector{Any}[]
+        count = Quiver.each_row(db, "SELECT label, integer_attribute, float_attribute FROM Configuration ORDER BY id") do row
+            push!(rows, row)
+        end
+        @test count == 2
+        @test rows[1] == Any["A", 1, 1.5]
+        @test rows[2][1] == "B"
+        @test rows[2][3] === nothing
+
+        labels = String[]
+        Quiver.each_row(db, "SELECT label FROM Configuration WHERE integer_attribute > ?", Any[1]) do row
+            push!(labels, row[1])
+        end
+        @test labels == ["B"]
+
+        @test_throws DatabaseException Quiver.each_row(row -> nothing, db, "SELECT * FROM Missing")
+
+        Quiver.close!(db)
+    end
 end
 
 end
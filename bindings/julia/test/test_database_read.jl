@@ -32,6 +32,48 @@ include("fixture.jl")
         Quiver.close!(db)
     end
 
+    @testset "Multiple Scalar Attributes" begin
+        path_schema = joinpath(tests_path(), "schemas", "valid", "basic.sql")
+        db = Quiver.from_schema(":memory:", path_schema)
+
+        Quiver.create_element!(db, "Configuration"; label = "Config 1", float_attribute = 1.5)
+        Quiver.create_element!(db, "Configuration"; label = "Config 2", integer_attribute = 9, string_attribute = "x")
+
+        attributes = ["label", "integer_attribute", "float_attribute", "string_attribute"]
+        result = Quiver.read_scalars(db, "Configuration", attributes)
+        @test result.ids == Quiver.read_element_ids(db, "Configuration")
+        @test result.columns["label"] == ["Config 1", "Config 2"]
+        @test result.columns["integer_attribute"] == [6, 9]
+        @test isequal(result.columns["float_attribute"], [1.5, nothing])
+        @test isequal(result.columns["string_attribute"], [nothing, "x"])
+
+        @test_throws Quiver.DatabaseException Quiver.read_scalars(db, "Configuration", ["missing"])
+
+        Quiver.close!(db)
+    end
+
+    @testset "Scalar Reads Skip Nulls" begin
+        path_schema = joinpath(tests_path(), "schemas", "valid", "basic.sql")
+        db = Quiver.from_schema(":memory:", path_schema)
+
+        Quiver.create_element!(db, "Configuration"; label = "Config 1", float_attribute = 1.5)
+        Quiver.create_element!(db, "Configuration"; label = "Config 2")
+        Quiver.create_element!(db, "Configuration"; label = "Config 3", float_attribute = 3.5)
+
+        @test Quiver.read_scalar_floats(db, "Configuration", "float_attribute") == [1.5, 3.5]
+        @test_throws DatabaseException Quiver.read_scalar_floats(db, "Missing", "float_attribute")
+
+        # Nullable readers keep the gap so values line up with read_element_ids
+        @test isequal(Quiver.read_scalar_floats_nullable(db, "Configuration", "float_attribute"), [1.5, nothing, 3.5])
+        @test Quiver.read_scalar_integers_nullable(db, "Configuration", "integer_attribute") == [6, 6, 6]
+        @test isequal(
+            Quiver.read_scalar_strings_nullable(db, "Configuration", "string_attribute"),
+            [nothing, nothing, nothing],
+        )
+
+        Quiver.close!(db)
+    end
+
     @testset "Collections" begin
         path_schema = joinpath(tests_path(), "schemas", "valid", "collections.sql")
         db = Quiver.from_schema(":memory:", path_schema)
@@ -122,6 +164,30 @@ include("fixture.jl")
         Quiver.close!(db)
     end
 
+    @testset "Vector Flat" begin
+        path_schema = joinpath(tests_path(), "schemas", "valid", "collections.sql")
+        db = Quiver.from_schema(":memory:", path_schema)
+
+        Quiver.create_element!(db, "Configuration"; label = "Test Config")
+        Quiver.create_element!(db, "Collection"; label = "Item 1", value_int = [1, 2, 3], value_float = [1.5, 2.5, 3.5])
+        Quiver.create_element!(db, "Collection"; label = "Item 2")
+        Quiver.create_element!(db, "Collection"; label = "Item 3", value_int = [4, 5], value_float = [4.5, 5.5])
+
+        result = Quiver.read_vector_integers_flat(db, "Collection", "value_int")
+        @test length(result) == 2
+        @test result[1] == [1, 2, 3]
+        @test result[2] == [4, 5]
+        @test result == Quiver.read_vector_integers(db, "Collection", "value_int")
+
+        @test Quiver.read_vector_floats_flat(db, "Collection", "value_float") == [[1.5, 2.5, 3.5], [4.5, 5.5]]
+        @test isempty(Quiver.read_set_strings_flat(db, "Collection", "tag"))
+
+        Quiver.create_element!(db, "Collection"; label = "Item 4", tag = ["a"])
+        @test Quiver.read_set_strings_flat(db, "Collection", "tag") == [["a"]]
+
+        Quiver.close!(db)
+    end
+
     @testset "Set Attributes" begin
         path_schema = joinpath(tests_path(), "schemas", "valid", "collections.sql")
         db = Quiver.from_schema(":memory:", path_schema)
@@ -213,6 +279,28 @@ include("fixture.jl")
         Quiver.close!(db)
     end
 
+    @testset "Batch by IDs" begin
+        path_schema = joinpath(tests_path(), "schemas", "valid", "collections.sql")
+        db = Quiver.from_schema(":memory:", path_schema)
+
+        Quiver.create_element!(db, "Configuration"; label = "Test Config")
+        id1 = Quiver.create_element!(db, "Collection"; label = "Item 1", some_integer = 7, value_int = [1, 2, 3])
+        id2 = Quiver.create_element!(db, "Collection"; label = "Item 2", tag = ["a"])
+
+        ids = [id2, 999, id1]
+        @test isequal(Quiver.read_scalar_integers_by_ids(db, "Collection", "some_integer", ids), [nothing, nothing, 7])
+        @test isequal(
+            Quiver.read_scalar_strings_by_ids(db, "Collection", "label", ids),
+            ["Item 2", nothing, "Item 1"],
+        )
+        @test Quiver.read_vector_integers_by_ids(db, "Collection", "value_int", ids) == [Int64[], Int64[], [1, 2, 3]]
+        @test Quiver.read_set_strings_by_ids(db, "Collection", "tag", ids) == [["a"], String[], String[]]
+        @test isempty(Quiver.read_scalar_floats_by_ids(db, "Collection", "some_float", Int64[]))
+        @test_throws DatabaseException Quiver.read_scalar_floats_by_ids(db, "Collection", "missing", ids)
+
+        Quiver.close!(db)
+    end
+
     @testset "DateTime Attributes" begin
         path_schema = joinpath(tests_path(), "schemas", "valid", "basic.sql")
         db = Quiver.from_schema(":memory:", path_schema)
@@ -448,6 +536,31 @@ include("fixture.jl")
 
         Quiver.close!(db)
     end
+
+    @testset "Attribute Handle" begin
+        path_schema = joinpath(tests_path(), "schemas", "valid", "collections.sql")
+        db = Quiver.from_schema(":memory:", path_schema)
+
+        Quiver.create_element!(db, "Configuration"; label = "Test Config")
+        Quiver.create_element!(db, "Collection"; label = "Item 1", some_integer = 7, value_int = [1, 2, 3])
+
+        integer = Quiver.attribute_handle(db, "Collection", "some_integer")
+        @test Quiver.read_scalar_integers_by_id(db, integer, 1) == 7
+        @test Quiver.read_scalar_integers_by_id(db, integer, 2) === nothing
+        Quiver.update_scalar_integer!(db, integer, 1, 42)
+        @test Quiver.read_scalar_integers_by_id(db, "Collection", "some_integer", 1) == 42
+        @test_throws Quiver.DatabaseException Quiver.read_scalar_floats_by_id(db, integer, 1)
+
+        label = Quiver.attribute_handle(db, "Collection", "label")
+        @test Quiver.read_scalar_strings_by_id(db, label, 1) == "Item 1"
+
+        vector = Quiver.attribute_handle(db, "Collection", "value_int")
+        @test Quiver.read_vector_integers_by_id(db, vector, 1) == [1, 2, 3]
+
+        @test_throws Quiver.DatabaseException Quiver.attribute_handle(db, "Collection", "missing")
+
+        Quiver.close!(db)
+    end
 end
 
 end
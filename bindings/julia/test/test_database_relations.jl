@@ -84,6 +84,39 @@ include("fixture.jl")
 
         Quiver.close!(db)
     end
+
+    @testset "Set Scalar Relations Bulk" begin
+        path_schema = joinpath(tests_path(), "schemas", "valid", "relations.sql")
+        db = Quiver.from_schema(":memory:", path_schema)
+
+        Quiver.create_element!(db, "Parent"; label = "Parent 1")
+        Quiver.create_element!(db, "Parent"; label = "Parent 2")
+        Quiver.create_element!(db, "Child"; label = "Child 1")
+        Quiver.create_element!(db, "Child"; label = "Child 2")
+        Quiver.create_element!(db, "Child"; label = "Child 3")
+
+        Quiver.set_scalar_relations!(db, "Child", "parent_id", ["Child 1", "Child 3"], ["Parent 2", "Parent 1"])
+
+        @test Quiver.read_scalar_relation(db, "Child", "parent_id") == ["Parent 2", nothing, "Parent 1"]
+        @test Quiver.read_scalar_relation_ids(db, "Child", "parent_id") == [2, 0, 1]
+
+        @test_throws Quiver.DatabaseException Quiver.set_scalar_relations!(
+            db,
+            "Child",
+            "parent_id",
+            ["Child 2"],
+            ["Parent 9"],
+        )
+        @test_throws Quiver.DatabaseException Quiver.set_scalar_relations!(
+            db,
+            "Child",
+            "parent_id",
+            ["Child 2"],
+            String[],
+        )
+
+        Quiver.close!(db)
+    end
 end
 
 end
@@ -0,0 +1,73 @@
+module TestDatabaseTransaction
+
+using Quiver
+using Test
+
+include("fixture.jl")
+
+@testset "Transaction" begin
+    @testset "Commit and Rollback" begin
+        path_schema = joinpath(tests_path(), "schemas", "valid", "basic.sql")
+        db = Quiver.from_schema(":memory:", path_schema)
+
+        @test !Quiver.in_transaction(db)
+        Quiver.begin_transaction!(db)
+        @test Quiver.in_transaction(db)
+        Quiver.create_element!(db, "Configuration"; label = "Kept")
+        Quiver.commit!(db)
+        @test !Quiver.in_transaction(db)
+
+        Quiver.begin_transaction!(db)
+        Quiver.create_element!(db, "Configuration"; label = "Discarded")
+        Quiver.rollback!(db)
+
+        @test Quiver.read_scalar_strings(db, "Configuration", "label") == ["Kept"]
+
+        @test_throws Quiver.DatabaseException Quiver.commit!(db)
+
+        Quiver.close!(db)
+    end
+
+    @testset "Do Block" begin
+        path_schema = joinpath(tests_path(), "schemas", "valid", "basic.sql")
+        db = Quiver.from_schema(":memory:", path_schema)
+
+        Quiver.transaction(db) do
+            for i in 1:10
+                Quiver.create_element!(db, "Configuration"; label = "Config $i")
+            end
+        end
+        @test length(Quiver.read_scalar_strings(db, "Configuration", "label")) == 10
+
+        failing = () -> begin
+            Quiver.create_element!(db, "Configuration"; label = "Config 11")
+            error("abort")
+        end
+        @test_throws ErrorException Quiver.transaction(failing, db)
+        @test length(Quiver.read_scalar_strings(db, "Configuration", "label")) == 10
+        @test !Quiver.in_transaction(db)
+
+        Quiver.close!(db)
+    end
+
+    @testset "Nested" begin
+        path_schema = joinpath(tests_path(), "schemas", "valid", "basic.sql")
+        db = Quiver.from_schema(":memory:", path_schema)
+
+        Quiver.transaction(db) do
+            Quiver.create_element!(db, "Configuration"; label = "Outer")
+            try
+                Quiver.transaction(db) do
+                    Quiver.create_element!(db, "Configuration"; label = "Inner")
+                    error("abort inner")
+                end
+            catch
+            end
+        end
+        @test Quiver.read_scalar_strings(db, "Configuration", "label") == ["Outer"]
+
+        Quiver.close!(db)
+    end
+end
+
+end
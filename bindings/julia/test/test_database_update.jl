@@ -371,6 +371,38 @@ include("fixture.jl")
         Quiver.close!(db)
     end
 
+    @testset "Scalars Many" begin
+        path_schema = joinpath(tests_path(), "schemas", "valid", "basic.sql")
+        db = Quiver.from_schema(":memory:", path_schema)
+
+        ids = [Quiver.create_element!(db, "Configuration"; label = "Config $i") for i in 1:3]
+
+        Quiver.update_scalar_integers!(db, "Configuration", "integer_attribute", ids, [10, 20, 30])
+        Quiver.update_scalar_floats!(db, "Configuration", "float_attribute", ids, [1.5, 2.5, 3.5])
+        Quiver.update_scalar_strings!(db, "Configuration", "string_attribute", reverse(ids), ["c", "b", "a"])
+
+        @test Quiver.read_scalar_integers(db, "Configuration", "integer_attribute") == [10, 20, 30]
+        @test Quiver.read_scalar_floats(db, "Configuration", "float_attribute") == [1.5, 2.5, 3.5]
+        @test Quiver.read_scalar_strings(db, "Configuration", "string_attribute") == ["a", "b", "c"]
+
+        @test_throws DatabaseException Quiver.update_scalar_integers!(
+            db,
+            "Configuration",
+            "integer_attribute",
+            ids,
+            [1],
+        )
+        @test_throws DatabaseException Quiver.update_scalar_strings!(
+            db,
+            "Configuration",
+            "integer_attribute",
+            ids,
+            ["x", "y", "z"],
+        )
+
+        Quiver.close!(db)
+    end
+
     @testset "Scalar Integer Multiple Elements" begin
         path_schema = joinpath(tests_path(), "schemas", "valid", "basic.sql")
         db = Quiver.from_schema(":memory:", path_schema)
@@ -684,6 +716,71 @@ include("fixture.jl")
 
         Quiver.close!(db)
     end
+
+    @testset "Append Vector And Entry" begin
+        path_schema = joinpath(tests_path(), "schemas", "valid", "collections.sql")
+        db = Quiver.from_schema(":memory:", path_schema)
+        Quiver.create_element!(db, "Configuration"; label = "Test Config")
+        id = Quiver.create_element!(db, "Collection"; label = "Item 1")
+
+        Quiver.append_vector_integers!(db, "Collection", "value_int", id, [1, 2])
+        Quiver.append_vector_integers!(db, "Collection", "value_int", id, [3])
+        Quiver.update_vector_integer_entry!(db, "Collection", "value_int", id, 1, 10)
+        @test Quiver.read_vector_integers_by_id(db, "Collection", "value_int", id) == [10, 2, 3]
+
+        @test_throws Quiver.DatabaseException Quiver.update_vector_integer_entry!(
+            db,
+            "Collection",
+            "value_int",
+            id,
+            4,
+            1,
+        )
+
+        Quiver.close!(db)
+    end
+
+    @testset "Time Series Floats" begin
+        path_schema = joinpath(tests_path(), "schemas", "valid", "collections.sql")
+        db = Quiver.from_schema(":memory:", path_schema)
+        Quiver.create_element!(db, "Configuration"; label = "Test Config")
+        id = Quiver.create_element!(db, "Collection"; label = "Item 1")
+
+        Quiver.update_time_series_floats!(
+            db,
+            "Collection",
+            "value",
+            id,
+            ["2024-01-02 00:00:00", "2024-01-01 00:00:00", "2024-01-03 00:00:00"],
+            [2.0, 1.0, NaN],
+        )
+
+        series = Quiver.read_time_series_floats(db, "Collection", "value", id)
+        @test series.date_times == ["2024-01-01 00:00:00", "2024-01-02 00:00:00", "2024-01-03 00:00:00"]
+        @test series.values[1:2] == [1.0, 2.0]
+        @test isnan(series.values[3])
+
+        range = Quiver.read_time_series_floats(
+            db,
+            "Collection",
+            "value",
+            id;
+            date_time_from = "2024-01-02 00:00:00",
+            date_time_to = "2024-01-02 00:00:00",
+        )
+        @test range.values == [2.0]
+
+        @test_throws Quiver.DatabaseException Quiver.update_time_series_floats!(
+            db,
+            "Collection",
+            "value",
+            id,
+            ["2024-01-01 00:00:00"],
+            [1.0, 2.0],
+        )
+
+        Quiver.close!(db)
+    end
 end
 
 end
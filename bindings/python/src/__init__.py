@@ -1,2 +0,0 @@
-def hello_world():
-    print("Hello, world!")
\ No newline at end of file
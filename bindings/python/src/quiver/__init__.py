@@ -0,0 +1,4 @@
+from .database import Database
+from .exceptions import DatabaseException
+
+__all__ = ["Database", "DatabaseException"]
@@ -0,0 +1,104 @@
+"""Zero-copy NumPy views over memory owned by libquiver_c.
+
+Each view is backed by a NativeBuffer, which exposes one native buffer through the buffer protocol (PEP 688) and
+keeps the object that owns the memory alive. The memory is released once the last view is gone, so arrays returned
+by the binding stay valid after the database is closed.
+"""
+
+import ctypes
+
+import numpy as np
+
+from . import _c_api as c
+
+
+class NativeBuffer:
+    def __init__(self, owner: object, address: int, nbytes: int) -> None:
+        self._owner = owner
+        self._address = address
+        self._nbytes = nbytes
+
+    def __buffer__(self, flags: int) -> memoryview:
+        return memoryview((ctypes.c_ubyte * self._nbytes).from_address(self._address)).cast("B").toreadonly()
+
+
+def view(owner: object, address: int | None, count: int, dtype: type) -> np.ndarray:
+    if count == 0 or not address:
+        return np.empty(0, dtype=dtype)
+    dtype = np.dtype(dtype)
+    return np.frombuffer(NativeBuffer(owner, address, count * dtype.itemsize), dtype=dtype)
+
+
+class IntegerArray:
+    """An int64_t array allocated by the C API and freed with quiver_free_integer_array."""
+
+    def __init__(self) -> None:
+        self.pointer = ctypes.POINTER(ctypes.c_int64)()
+
+    def __del__(self) -> None:
+        if self.pointer:
+            c.lib.quiver_free_integer_array(self.pointer)
+
+
+class ArrowExport:
+    """An exported Arrow array and schema, released through their release callbacks."""
+
+    def __init__(self) -> None:
+        self.schema = c.ArrowSchema()
+        self.array = c.ArrowArray()
+
+    def __del__(self) -> None:
+        if self.schema.release:
+            self.schema.release(ctypes.byref(self.schema))
+        if self.array.release:
+            self.array.release(ctypes.byref(self.array))
+
+
+def _buffer(array: c.ArrowArray, index: int) -> int | None:
+    return array.buffers[index]
+
+
+def _validity(array: c.ArrowArray) -> np.ndarray | None:
+    # Copied into a bool mask: NumPy has no bit-packed masks
+    if array.null_count == 0:
+        return None
+    bitmap = np.frombuffer(ctypes.string_at(_buffer(array, 0), (array.length + 7) // 8), dtype=np.uint8)
+    return np.unpackbits(bitmap, count=array.length, bitorder="little").astype(bool)
+
+
+def _texts(array: c.ArrowArray, valid: np.ndarray | None) -> list[str | None]:
+    # Decoded into Python strings, which cannot share the exported bytes
+    bounds = list((ctypes.c_int64 * (array.length + 1)).from_address(_buffer(array, 1)))
+    data = ctypes.string_at(_buffer(array, 2), bounds[-1]) if bounds[-1] > 0 else b""
+    return [
+        data[bounds[row] : bounds[row + 1]].decode() if valid is None or valid[row] else None
+        for row in range(array.length)
+    ]
+
+
+_NUMERIC = {b"l": np.int64, b"g": np.float64}
+
+
+def column(owner: ArrowExport, schema: c.ArrowSchema, array: c.ArrowArray) -> np.ma.MaskedArray | list:
+    """Converts a primitive Arrow column: numbers to a masked array over the exported values, text to a list."""
+    valid = _validity(array)
+    if schema.format in _NUMERIC:
+        values = view(owner, _buffer(array, 1), array.length, _NUMERIC[schema.format])
+        return np.ma.MaskedArray(values, mask=np.ma.nomask if valid is None else ~valid)
+    if schema.format == b"U":
+        return _texts(array, valid)
+    if schema.format == b"n":
+        return [None] * array.length
+    raise TypeError(f"Unsupported Arrow format {schema.format!r}")
+
+
+def groups(owner: ArrowExport) -> list:
+    """Converts a large_list export: one view per group into the shared values buffer, or lists of strings."""
+    schema, array = owner.schema, owner.array
+    offsets = view(owner, _buffer(array, 1), array.length + 1, np.int64)
+    child_schema, child_array = schema.children[0].contents, array.children[0].contents
+    if child_schema.format == b"U":
+        texts = _texts(child_array, None)
+        return [texts[offsets[group] : offsets[group + 1]] for group in range(array.length)]
+    values = view(owner, _buffer(child_array, 1), child_array.length, _NUMERIC[child_schema.format])
+    return np.split(values, offsets[1:-1]) if array.length > 0 else []
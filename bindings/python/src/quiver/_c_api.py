@@ -0,0 +1,173 @@
+"""ctypes declarations for the parts of libquiver_c the Python binding uses (see include/quiver/c/)."""
+
+import ctypes
+import os
+import sys
+from ctypes import POINTER, Structure, c_char_p, c_double, c_int, c_int32, c_int64, c_size_t, c_uint8, c_void_p
+from pathlib import Path
+
+QUIVER_OK = 0
+
+QUIVER_DATA_TYPE_INTEGER = 0
+QUIVER_DATA_TYPE_FLOAT = 1
+QUIVER_DATA_TYPE_STRING = 2
+QUIVER_DATA_TYPE_DATE_TIME = 3
+QUIVER_DATA_TYPE_NULL = 4
+QUIVER_DATA_TYPE_BLOB = 5
+
+QUIVER_LOG_OFF = 4
+
+
+class DatabaseOptions(Structure):
+    _fields_ = [
+        ("read_only", c_int),
+        ("console_level", c_int),
+        ("statement_cache_size", c_int),
+        ("journal_mode", c_int),
+        ("synchronous", c_int),
+        ("temp_store", c_int),
+        ("page_size", c_int),
+        ("cache_size", c_int64),
+        ("mmap_size", c_int64),
+        ("mapped", c_int),
+        ("validate_schema", c_int),
+        ("file_level", c_int),
+        ("async_logging", c_int),
+        ("collect_stats", c_int),
+        ("slow_query_ms", c_int64),
+        ("busy_timeout_ms", c_int64),
+        ("statement_timeout_ms", c_int64),
+        ("load_into_memory", c_int),
+        ("track_changes", c_int),
+        ("cache_reads", c_int),
+        ("read_cache_limit", c_int64),
+        ("soft_heap_limit", c_int64),
+        ("hard_heap_limit", c_int64),
+    ]
+
+
+class ScalarColumn(Structure):
+    _fields_ = [
+        ("name", c_char_p),
+        ("data_type", c_int),
+        ("integers", POINTER(c_int64)),
+        ("floats", POINTER(c_double)),
+        ("strings", POINTER(c_char_p)),
+        ("nulls", POINTER(c_uint8)),
+    ]
+
+
+# Arrow C Data Interface (include/quiver/c/arrow.h)
+class ArrowSchema(Structure):
+    pass
+
+
+ArrowSchema._fields_ = [
+    ("format", c_char_p),
+    ("name", c_char_p),
+    ("metadata", c_char_p),
+    ("flags", c_int64),
+    ("n_children", c_int64),
+    ("children", POINTER(POINTER(ArrowSchema))),
+    ("dictionary", POINTER(ArrowSchema)),
+    ("release", ctypes.CFUNCTYPE(None, POINTER(ArrowSchema))),
+    ("private_data", c_void_p),
+]
+
+
+class ArrowArray(Structure):
+    pass
+
+
+ArrowArray._fields_ = [
+    ("length", c_int64),
+    ("null_count", c_int64),
+    ("offset", c_int64),
+    ("n_buffers", c_int64),
+    ("n_children", c_int64),
+    ("buffers", POINTER(c_void_p)),
+    ("children", POINTER(POINTER(ArrowArray))),
+    ("dictionary", POINTER(ArrowArray)),
+    ("release", ctypes.CFUNCTYPE(None, POINTER(ArrowArray))),
+    ("private_data", c_void_p),
+]
+
+
+def _library_names() -> tuple[str, str]:
+    if sys.platform == "win32":
+        return "quiver_c.dll", "quiver.dll"
+    if sys.platform == "darwin":
+        return "libquiver_c.dylib", "libquiver.dylib"
+    return "libquiver_c.so", "libquiver.so"
+
+
+def _load() -> ctypes.CDLL:
+    # QUIVER_LIBRARY_DIR, then the repository's build output (like the Julia binding), then the system search path
+    name, core = _library_names()
+    build = Path(__file__).resolve().parents[4] / "build" / ("bin" if sys.platform == "win32" else "lib")
+    for directory in filter(None, [os.environ.get("QUIVER_LIBRARY_DIR"), build]):
+        path = Path(directory) / name
+        if path.exists():
+            # Load the core library first so the C API library resolves it from the same directory
+            if (Path(directory) / core).exists():
+                ctypes.CDLL(str(Path(directory) / core), mode=ctypes.RTLD_GLOBAL)
+            return ctypes.CDLL(str(path))
+    return ctypes.CDLL(name)
+
+
+lib = _load()
+
+_db = c_void_p
+_status = c_int
+_ids = POINTER(c_int64)
+_arrow_outputs = [POINTER(ArrowSchema), POINTER(ArrowArray)]
+
+_SIGNATURES = {
+    "quiver_get_last_error": (c_char_p, []),
+    "quiver_database_options_default": (DatabaseOptions, []),
+    "quiver_database_open": (_db, [c_char_p, POINTER(DatabaseOptions)]),
+    "quiver_database_from_schema": (_db, [c_char_p, c_char_p, POINTER(DatabaseOptions)]),
+    "quiver_database_from_migrations": (_db, [c_char_p, c_char_p, POINTER(DatabaseOptions)]),
+    "quiver_database_close": (None, [_db]),
+    "quiver_database_path": (c_char_p, [_db]),
+    "quiver_database_current_version": (c_int64, [_db]),
+    "quiver_database_begin_transaction": (_status, [_db]),
+    "quiver_database_commit": (_status, [_db]),
+    "quiver_database_rollback": (_status, [_db]),
+    "quiver_element_create": (c_void_p, []),
+    "quiver_element_destroy": (None, [c_void_p]),
+    "quiver_element_set_integer": (_status, [c_void_p, c_char_p, c_int64]),
+    "quiver_element_set_float": (_status, [c_void_p, c_char_p, c_double]),
+    "quiver_element_set_string": (_status, [c_void_p, c_char_p, c_char_p]),
+    "quiver_element_set_null": (_status, [c_void_p, c_char_p]),
+    "quiver_element_set_array_integer": (_status, [c_void_p, c_char_p, POINTER(c_int64), c_int32]),
+    "quiver_element_set_array_float": (_status, [c_void_p, c_char_p, POINTER(c_double), c_int32]),
+    "quiver_element_set_array_string": (_status, [c_void_p, c_char_p, POINTER(c_char_p), c_int32]),
+    "quiver_database_create_element": (c_int64, [_db, c_char_p, c_void_p]),
+    "quiver_database_create_elements_columns": (
+        _status,
+        [_db, c_char_p, POINTER(ScalarColumn), c_size_t, c_size_t, _ids],
+    ),
+    "quiver_database_delete_element_by_id": (_status, [_db, c_char_p, c_int64]),
+    "quiver_database_delete_elements_by_ids": (_status, [_db, c_char_p, _ids, c_size_t, POINTER(c_size_t)]),
+    "quiver_database_update_scalar_integers": (_status, [_db, c_char_p, c_char_p, _ids, POINTER(c_int64), c_size_t]),
+    "quiver_database_update_scalar_floats": (_status, [_db, c_char_p, c_char_p, _ids, POINTER(c_double), c_size_t]),
+    "quiver_database_update_scalar_strings": (_status, [_db, c_char_p, c_char_p, _ids, POINTER(c_char_p), c_size_t]),
+    "quiver_database_read_element_ids": (_status, [_db, c_char_p, POINTER(_ids), POINTER(c_size_t)]),
+    "quiver_free_integer_array": (None, [_ids]),
+    "quiver_database_query_arrow": (
+        _status,
+        [_db, c_char_p, POINTER(c_int), POINTER(c_void_p), c_size_t, *_arrow_outputs],
+    ),
+}
+for _structure in ("scalar", "vector", "set"):
+    for _type in ("integers", "floats", "strings"):
+        _SIGNATURES[f"quiver_database_read_{_structure}_{_type}_arrow"] = (
+            _status,
+            [_db, c_char_p, c_char_p, *_arrow_outputs],
+        )
+
+for _name, (_restype, _argtypes) in _SIGNATURES.items():
+    _function = getattr(lib, _name)
+    _function.restype = _restype
+    _function.argtypes = _argtypes
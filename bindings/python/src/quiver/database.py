@@ -0,0 +1,367 @@
+import contextlib
+import ctypes
+from collections.abc import Iterator, Mapping, Sequence
+
+import numpy as np
+
+from . import _buffers, _c_api as c
+from .exceptions import DatabaseException, check, raise_last_error
+
+
+def _utf8(text: str) -> bytes:
+    return text.encode()
+
+
+def _int64(values: object) -> np.ndarray:
+    return np.ascontiguousarray(values, dtype=np.int64)
+
+
+def _float64(values: object) -> np.ndarray:
+    return np.ascontiguousarray(values, dtype=np.float64)
+
+
+def _strings(values: Sequence[str | None]) -> ctypes.Array:
+    return (ctypes.c_char_p * len(values))(*[None if value is None else _utf8(str(value)) for value in values])
+
+
+def _pointer(array: np.ndarray, ctype: type) -> object:
+    return array.ctypes.data_as(ctypes.POINTER(ctype))
+
+
+class Database:
+    """A Quiver database opened through libquiver_c.
+
+    Reads return NumPy arrays backed by buffers the library allocated (no copies of numeric data), and the bulk
+    writes take NumPy arrays and hand them to the C API in one call. Use as a context manager or call close().
+    """
+
+    def __init__(self, handle: int) -> None:
+        self._handle = handle
+
+    @staticmethod
+    def _options(console_level: int) -> c.DatabaseOptions:
+        options = c.lib.quiver_database_options_default()
+        options.console_level = console_level
+        return options
+
+    @classmethod
+    def open(cls, path: str, console_level: int = c.QUIVER_LOG_OFF) -> "Database":
+        options = cls._options(console_level)
+        handle = c.lib.quiver_database_open(_utf8(path), ctypes.byref(options))
+        if not handle:
+            raise_last_error(f"Failed to open database '{path}'")
+        return cls(handle)
+
+    @classmethod
+    def from_schema(cls, path: str, schema_path: str, console_level: int = c.QUIVER_LOG_OFF) -> "Database":
+        options = cls._options(console_level)
+        handle = c.lib.quiver_database_from_schema(_utf8(path), _utf8(schema_path), ctypes.byref(options))
+        if not handle:
+            raise_last_error("Failed to create database from schema")
+        return cls(handle)
+
+    @classmethod
+    def from_migrations(cls, path: str, migrations_path: str, console_level: int = c.QUIVER_LOG_OFF) -> "Database":
+        options = cls._options(console_level)
+        handle = c.lib.quiver_database_from_migrations(_utf8(path), _utf8(migrations_path), ctypes.byref(options))
+        if not handle:
+            raise_last_error("Failed to create database from migrations")
+        return cls(handle)
+
+    def close(self) -> None:
+        if self._handle:
+            c.lib.quiver_database_close(self._handle)
+            self._handle = None
+
+    def __enter__(self) -> "Database":
+        return self
+
+    def __exit__(self, *exc_info: object) -> None:
+        self.close()
+
+    def __del__(self) -> None:
+        self.close()
+
+    @property
+    def _db(self) -> int:
+        if not self._handle:
+            raise DatabaseException("Database is closed")
+        return self._handle
+
+    @property
+    def path(self) -> str:
+        return c.lib.quiver_database_path(self._db).decode()
+
+    def current_version(self) -> int:
+        return c.lib.quiver_database_current_version(self._db)
+
+    # Transactions
+
+    def begin_transaction(self) -> None:
+        check(c.lib.quiver_database_begin_transaction(self._db), "Failed to begin transaction")
+
+    def commit(self) -> None:
+        check(c.lib.quiver_database_commit(self._db), "Failed to commit transaction")
+
+    def rollback(self) -> None:
+        check(c.lib.quiver_database_rollback(self._db), "Failed to roll back transaction")
+
+    @contextlib.contextmanager
+    def transaction(self) -> Iterator["Database"]:
+        """Commits when the block completes, rolls back when it raises."""
+        self.begin_transaction()
+        try:
+            yield self
+        except BaseException:
+            self.rollback()
+            raise
+        self.commit()
+
+    # Create, update and delete
+
+    def create_element(self, collection: str, **values: object) -> int:
+        """Creates one element; sequences and arrays go to vector or set attributes, None sets a null."""
+        element = c.lib.quiver_element_create()
+        try:
+            for name, value in values.items():
+                key = _utf8(name)
+                if value is None:
+                    status = c.lib.quiver_element_set_null(element, key)
+                elif isinstance(value, (bool, int, np.integer)):
+                    status = c.lib.quiver_element_set_integer(element, key, int(value))
+                elif isinstance(value, (float, np.floating)):
+                    status = c.lib.quiver_element_set_float(element, key, float(value))
+                elif isinstance(value, str):
+                    status = c.lib.quiver_element_set_string(element, key, _utf8(value))
+                else:
+                    status = self._set_array(element, key, value)
+                check(status, f"Failed to set '{name}'")
+            element_id = c.lib.quiver_database_create_element(self._db, _utf8(collection), element)
+            if element_id < 0:
+                raise_last_error(f"Failed to create element in '{collection}'")
+            return element_id
+        finally:
+            c.lib.quiver_element_destroy(element)
+
+    @staticmethod
+    def _set_array(element: int, key: bytes, value: object) -> int:
+        array = np.asarray(value)
+        if array.dtype.kind in "iub":
+            values = _int64(array)
+            return c.lib.quiver_element_set_array_integer(element, key, _pointer(values, ctypes.c_int64), len(values))
+        if array.dtype.kind == "f":
+            values = _float64(array)
+            return c.lib.quiver_element_set_array_float(element, key, _pointer(values, ctypes.c_double), len(values))
+        strings = _strings(list(value))
+        return c.lib.quiver_element_set_array_string(element, key, strings, len(strings))
+
+    def create_elements(self, collection: str, **columns: object) -> np.ndarray:
+        """Creates one element per row of the given scalar columns in a single transaction and returns their ids.
+
+        Integer and float columns are passed to the library as they are (made contiguous 64-bit first if needed);
+        numpy.ma masks and None entries of string columns leave the attribute unset for that element.
+        """
+        count = None
+        keep_alive = []
+        c_columns = (c.ScalarColumn * len(columns))()
+        for c_column, (name, values) in zip(c_columns, columns.items()):
+            mask = np.ma.getmaskarray(values) if np.ma.isMaskedArray(values) else None
+            data = np.ma.getdata(values) if mask is not None else np.asarray(values)
+            if count is None:
+                count = len(data)
+            elif len(data) != count:
+                raise ValueError(f"Column '{name}' has {len(data)} rows, expected {count}")
+            c_column.name = _utf8(name)
+            if data.dtype.kind in "iub":
+                data = _int64(data)
+                c_column.data_type = c.QUIVER_DATA_TYPE_INTEGER
+                c_column.integers = _pointer(data, ctypes.c_int64)
+            elif data.dtype.kind == "f":
+                data = _float64(data)
+                c_column.data_type = c.QUIVER_DATA_TYPE_FLOAT
+                c_column.floats = _pointer(data, ctypes.c_double)
+            else:
+                data = _strings(data.tolist())
+                c_column.data_type = c.QUIVER_DATA_TYPE_STRING
+                c_column.strings = data
+            if mask is not None:
+                mask = np.ascontiguousarray(mask, dtype=np.uint8)
+                c_column.nulls = _pointer(mask, ctypes.c_uint8)
+            keep_alive += [data, mask]
+
+        ids = np.empty(count or 0, dtype=np.int64)
+        check(
+            c.lib.quiver_database_create_elements_columns(
+                self._db, _utf8(collection), c_columns, len(columns), len(ids), _pointer(ids, ctypes.c_int64)
+            ),
+            f"Failed to create elements in '{collection}'",
+        )
+        return ids
+
+    def update_scalar_integers(self, collection: str, attribute: str, ids: object, values: object) -> None:
+        """Writes values[i] to element ids[i], in one transaction."""
+        ids, values = _int64(ids), _int64(values)
+        self._check_lengths(ids, values)
+        check(
+            c.lib.quiver_database_update_scalar_integers(
+                self._db,
+                _utf8(collection),
+                _utf8(attribute),
+                _pointer(ids, ctypes.c_int64),
+                _pointer(values, ctypes.c_int64),
+                len(ids),
+            ),
+            f"Failed to update '{collection}.{attribute}'",
+        )
+
+    def update_scalar_floats(self, collection: str, attribute: str, ids: object, values: object) -> None:
+        ids, values = _int64(ids), _float64(values)
+        self._check_lengths(ids, values)
+        check(
+            c.lib.quiver_database_update_scalar_floats(
+                self._db,
+                _utf8(collection),
+                _utf8(attribute),
+                _pointer(ids, ctypes.c_int64),
+                _pointer(values, ctypes.c_double),
+                len(ids),
+            ),
+            f"Failed to update '{collection}.{attribute}'",
+        )
+
+    def update_scalar_strings(self, collection: str, attribute: str, ids: object, values: Sequence[str]) -> None:
+        ids, strings = _int64(ids), _strings(list(values))
+        self._check_lengths(ids, strings)
+        check(
+            c.lib.quiver_database_update_scalar_strings(
+                self._db, _utf8(collection), _utf8(attribute), _pointer(ids, ctypes.c_int64), strings, len(ids)
+            ),
+            f"Failed to update '{collection}.{attribute}'",
+        )
+
+    @staticmethod
+    def _check_lengths(ids: np.ndarray, values: Sequence) -> None:
+        if len(ids) != len(values):
+            raise ValueError(f"Got {len(ids)} ids and {len(values)} values")
+
+    def delete_element(self, collection: str, element_id: int) -> None:
+        check(
+            c.lib.quiver_database_delete_element_by_id(self._db, _utf8(collection), element_id),
+            f"Failed to delete element {element_id} from '{collection}'",
+        )
+
+    def delete_elements(self, collection: str, ids: object) -> int:
+        """Deletes the elements and their group rows in one transaction; returns how many existed."""
+        ids = _int64(ids)
+        deleted = ctypes.c_size_t()
+        check(
+            c.lib.quiver_database_delete_elements_by_ids(
+                self._db, _utf8(collection), _pointer(ids, ctypes.c_int64), len(ids), ctypes.byref(deleted)
+            ),
+            f"Failed to delete elements from '{collection}'",
+        )
+        return deleted.value
+
+    # Reads
+
+    def read_element_ids(self, collection: str) -> np.ndarray:
+        ids = _buffers.IntegerArray()
+        count = ctypes.c_size_t()
+        check(
+            c.lib.quiver_database_read_element_ids(
+                self._db, _utf8(collection), ctypes.byref(ids.pointer), ctypes.byref(count)
+            ),
+            f"Failed to read element ids from '{collection}'",
+        )
+        return _buffers.view(ids, ctypes.cast(ids.pointer, ctypes.c_void_p).value, count.value, np.int64)
+
+    def _export(self, function: str, collection: str, attribute: str) -> _buffers.ArrowExport:
+        export = _buffers.ArrowExport()
+        check(
+            getattr(c.lib, function)(
+                self._db,
+                _utf8(collection),
+                _utf8(attribute),
+                ctypes.byref(export.schema),
+                ctypes.byref(export.array),
+            ),
+            f"Failed to read '{collection}.{attribute}'",
+        )
+        return export
+
+    def _read_scalar(self, value_type: str, collection: str, attribute: str) -> np.ma.MaskedArray | list:
+        export = self._export(f"quiver_database_read_scalar_{value_type}_arrow", collection, attribute)
+        return _buffers.column(export, export.schema, export.array)
+
+    def read_scalar_integers(self, collection: str, attribute: str) -> np.ma.MaskedArray:
+        """One entry per element in read_element_ids order, masked where the element has no value."""
+        return self._read_scalar("integers", collection, attribute)
+
+    def read_scalar_floats(self, collection: str, attribute: str) -> np.ma.MaskedArray:
+        return self._read_scalar("floats", collection, attribute)
+
+    def read_scalar_strings(self, collection: str, attribute: str) -> list[str | None]:
+        return self._read_scalar("strings", collection, attribute)
+
+    def _read_groups(self, structure: str, value_type: str, collection: str, attribute: str) -> list:
+        export = self._export(f"quiver_database_read_{structure}_{value_type}_arrow", collection, attribute)
+        return _buffers.groups(export)
+
+    def read_vector_integers(self, collection: str, attribute: str) -> list[np.ndarray]:
+        """One array per element in read_element_ids order (empty when it has no values), all views of one buffer."""
+        return self._read_groups("vector", "integers", collection, attribute)
+
+    def read_vector_floats(self, collection: str, attribute: str) -> list[np.ndarray]:
+        return self._read_groups("vector", "floats", collection, attribute)
+
+    def read_vector_strings(self, collection: str, attribute: str) -> list[list[str]]:
+        return self._read_groups("vector", "strings", collection, attribute)
+
+    def read_set_integers(self, collection: str, attribute: str) -> list[np.ndarray]:
+        return self._read_groups("set", "integers", collection, attribute)
+
+    def read_set_floats(self, collection: str, attribute: str) -> list[np.ndarray]:
+        return self._read_groups("set", "floats", collection, attribute)
+
+    def read_set_strings(self, collection: str, attribute: str) -> list[list[str]]:
+        return self._read_groups("set", "strings", collection, attribute)
+
+    # Queries
+
+    def query(self, sql: str, params: Sequence[object] = ()) -> Mapping[str, np.ma.MaskedArray | list]:
+        """Runs a query and returns its columns by name, typed like the scalar reads."""
+        types = (ctypes.c_int * len(params))()
+        values = (ctypes.c_void_p * len(params))()
+        keep_alive = []
+        for i, param in enumerate(params):
+            if param is None:
+                types[i] = c.QUIVER_DATA_TYPE_NULL
+                continue
+            if isinstance(param, (bool, int, np.integer)):
+                types[i], value = c.QUIVER_DATA_TYPE_INTEGER, ctypes.c_int64(int(param))
+            elif isinstance(param, (float, np.floating)):
+                types[i], value = c.QUIVER_DATA_TYPE_FLOAT, ctypes.c_double(float(param))
+            else:
+                types[i], value = c.QUIVER_DATA_TYPE_STRING, ctypes.create_string_buffer(_utf8(str(param)))
+            keep_alive.append(value)
+            values[i] = ctypes.addressof(value)
+
+        export = _buffers.ArrowExport()
+        check(
+            c.lib.quiver_database_query_arrow(
+                self._db,
+                _utf8(sql),
+                types,
+                values,
+                len(params),
+                ctypes.byref(export.schema),
+                ctypes.byref(export.array),
+            ),
+            "Failed to execute query",
+        )
+        return {
+            export.schema.children[i].contents.name.decode(): _buffers.column(
+                export, export.schema.children[i].contents, export.array.children[i].contents
+            )
+            for i in range(export.schema.n_children)
+        }
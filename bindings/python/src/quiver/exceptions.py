@@ -0,0 +1,18 @@
+from typing import NoReturn
+
+from . import _c_api as c
+
+
+class DatabaseException(Exception):
+    pass
+
+
+def check(status: int, context: str) -> None:
+    """Raises DatabaseException with the C API's last error message when status is not QUIVER_OK."""
+    if status != c.QUIVER_OK:
+        raise_last_error(context)
+
+
+def raise_last_error(context: str) -> NoReturn:
+    detail = (c.lib.quiver_get_last_error() or b"").decode()
+    raise DatabaseException(f"{context}: {detail}" if detail else context)
@@ -0,0 +1,13 @@
+from pathlib import Path
+
+import pytest
+
+from quiver import Database
+
+SCHEMAS = Path(__file__).resolve().parents[3] / "tests" / "schemas" / "valid"
+
+
+@pytest.fixture
+def collections_db():
+    with Database.from_schema(":memory:", str(SCHEMAS / "collections.sql")) as db:
+        yield db
@@ -1,2 +1,88 @@
-def test_database():
-    print("Testing database...")
+import numpy as np
+import pytest
+
+from quiver import Database, DatabaseException
+
+
+def test_create_elements_from_columns(collections_db):
+    ids = collections_db.create_elements(
+        "Collection",
+        label=["Item 1", "Item 2", "Item 3"],
+        some_integer=np.ma.MaskedArray([10, 0, 30], mask=[False, True, False]),
+        some_float=np.array([0.5, 1.5, 2.5], dtype=np.float32),
+    )
+    np.testing.assert_array_equal(ids, [1, 2, 3])
+    np.testing.assert_array_equal(collections_db.read_element_ids("Collection"), ids)
+
+    integers = collections_db.read_scalar_integers("Collection", "some_integer")
+    assert integers.dtype == np.int64
+    assert integers.mask.tolist() == [False, True, False]
+    assert integers.compressed().tolist() == [10, 30]
+    assert collections_db.read_scalar_floats("Collection", "some_float").tolist() == [0.5, 1.5, 2.5]
+    assert collections_db.read_scalar_strings("Collection", "label") == ["Item 1", "Item 2", "Item 3"]
+
+
+def test_create_elements_rolls_back(collections_db):
+    with pytest.raises(DatabaseException):
+        collections_db.create_elements("Collection", label=["Item", "Item"])
+    with pytest.raises(ValueError):
+        collections_db.create_elements("Collection", label=["Item 1"], some_integer=[1, 2])
+    assert len(collections_db.read_element_ids("Collection")) == 0
+
+
+def test_update_scalars(collections_db):
+    ids = collections_db.create_elements("Collection", label=[f"Item {i}" for i in range(4)])
+    collections_db.update_scalar_integers("Collection", "some_integer", ids[::2], np.array([7, 9]))
+    collections_db.update_scalar_floats("Collection", "some_float", ids, np.arange(4) / 2)
+    collections_db.update_scalar_strings("Collection", "label", ids[:1], ["First"])
+
+    assert collections_db.read_scalar_integers("Collection", "some_integer").tolist() == [7, None, 9, None]
+    assert collections_db.read_scalar_floats("Collection", "some_float").tolist() == [0.0, 0.5, 1.0, 1.5]
+    assert collections_db.read_scalar_strings("Collection", "label")[0] == "First"
+    with pytest.raises(ValueError):
+        collections_db.update_scalar_integers("Collection", "some_integer", ids, [1])
+
+
+def test_reads_are_views_of_library_buffers(collections_db):
+    collections_db.create_element("Collection", label="Item 1", some_integer=3, value_int=[1, 2, 3], tag=["a", "b"])
+    collections_db.create_element("Collection", label="Item 2")
+
+    vectors = collections_db.read_vector_integers("Collection", "value_int")
+    assert [vector.tolist() for vector in vectors] == [[1, 2, 3], []]
+    assert vectors[0].base is not None
+    assert not vectors[0].flags.writeable
+    assert [sorted(tags) for tags in collections_db.read_set_strings("Collection", "tag")] == [["a", "b"], []]
+
+    # The buffers outlive the database
+    integers = collections_db.read_scalar_integers("Collection", "some_integer")
+    collections_db.close()
+    assert integers.tolist() == [3, None]
+    assert vectors[0].tolist() == [1, 2, 3]
+    with pytest.raises(DatabaseException):
+        collections_db.read_element_ids("Collection")
+
+
+def test_query(collections_db):
+    collections_db.create_elements("Collection", label=["Item 1", "Item 2"], some_integer=[5, 6])
+    result = collections_db.query(
+        "SELECT label, some_integer, some_float FROM Collection WHERE some_integer > ? ORDER BY id", [4]
+    )
+    assert result["label"] == ["Item 1", "Item 2"]
+    assert result["some_integer"].tolist() == [5, 6]
+    assert result["some_float"] == [None, None]
+    assert collections_db.query("SELECT COUNT(*) AS n FROM Collection WHERE label = ?", ["Item 2"])["n"][0] == 1
+
+
+def test_transaction(collections_db):
+    with pytest.raises(RuntimeError):
+        with collections_db.transaction():
+            collections_db.create_element("Collection", label="Item 1")
+            raise RuntimeError
+    with collections_db.transaction():
+        collections_db.create_element("Collection", label="Item 2")
+    assert collections_db.read_scalar_strings("Collection", "label") == ["Item 2"]
+
+
+def test_errors():
+    with pytest.raises(DatabaseException):
+        Database.from_schema(":memory:", "missing.sql")
@@ -0,0 +1,42 @@
+#ifndef QUIVER_AGGREGATES_H
+#define QUIVER_AGGREGATES_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace quiver {
+
+// Statistics computed by Database::aggregate_vector / aggregate_time_series. sum is 0 and mean/min/max are NaN for
+// groups with no (non-null) values; count is the number of non-null values.
+enum class Aggregate { sum, mean, min, max, count };
+
+// Calendar period a time series row is assigned to, by the leading characters of its date_time
+enum class TimeBucket { year, month, day, hour };
+
+// Row i is element ids[i] (and, for time series, its bucket buckets[i]: "2024", "2024-03", "2024-03-05" or
+// "2024-03-05 14"); columns[s] holds statistics[s] for every row, as one contiguous array per statistic.
+struct Aggregates {
+    std::vector<int64_t> ids;
+    std::vector<std::string> buckets;  // Empty for vector aggregates
+    std::vector<Aggregate> statistics;
+    std::vector<std::vector<double>> columns;
+
+    size_t size() const { return ids.size(); }
+    bool empty() const { return ids.empty(); }
+
+    const std::vector<double>& column(Aggregate statistic) const {
+        const auto it = std::find(statistics.begin(), statistics.end(), statistic);
+        if (it == statistics.end()) {
+            throw std::runtime_error("Statistic was not requested");
+        }
+        return columns[static_cast<size_t>(it - statistics.begin())];
+    }
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_AGGREGATES_H
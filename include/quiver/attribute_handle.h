@@ -0,0 +1,35 @@
+#ifndef QUIVER_ATTRIBUTE_HANDLE_H
+#define QUIVER_ATTRIBUTE_HANDLE_H
+
+#include "attribute_type.h"
+#include "export.h"
+
+#include <string>
+
+namespace quiver {
+
+// A scalar or vector attribute of a collection, resolved once by Database::attribute_handle.
+// The Database overloads taking a handle skip the per-call schema lookup, type validation and SQL building of
+// the name-based calls. A handle stays valid for the Database that created it until its schema changes.
+class QUIVER_API AttributeHandle {
+public:
+    const std::string& collection() const { return collection_; }
+    const std::string& attribute() const { return attribute_; }
+    DataStructure data_structure() const { return type_.data_structure; }
+    DataType data_type() const { return type_.data_type; }
+
+private:
+    friend class Database;
+    AttributeHandle() = default;
+
+    std::string collection_;
+    std::string attribute_;
+    AttributeType type_{DataStructure::Scalar, DataType::Integer};
+    std::string select_by_id_sql_;
+    std::string select_all_sql_;  // Scalars only
+    std::string update_sql_;      // Scalars only
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_ATTRIBUTE_HANDLE_H
@@ -0,0 +1,122 @@
+#ifndef QUIVER_C_ARROW_H
+#define QUIVER_C_ARROW_H
+
+#include "database.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Arrow C Data Interface (https://arrow.apache.org/docs/format/CDataInterface.html). The structs are ABI-stable
+// and guarded by the macro the specification defines, so this header can be included next to Arrow's own.
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+    void (*release)(struct ArrowSchema*);
+    void* private_data;
+};
+
+struct ArrowArray {
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+    void (*release)(struct ArrowArray*);
+    void* private_data;
+};
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+// Every function below fills *out_schema and *out_array on success; the consumer owns both and must call their
+// release callbacks (pyarrow's _import_from_c, polars, Arrow.jl and nanoarrow all do). The arrays point into
+// library-owned buffers that live until released, independent of the database: integer and float values,
+// validity bitmaps and list offsets are the read results themselves, moved rather than copied; only text is
+// repacked into Arrow's offsets + bytes layout.
+//
+// Scalars export as int64 ("l"), float64 ("g") or large_utf8 ("U") arrays named after the attribute, one entry per
+// element in quiver_database_read_element_ids order, NULL where the element has no value.
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_arrow(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      struct ArrowSchema* out_schema,
+                                                                      struct ArrowArray* out_array);
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_arrow(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const char* attribute,
+                                                                    struct ArrowSchema* out_schema,
+                                                                    struct ArrowArray* out_array);
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_arrow(quiver_database_t* db,
+                                                                     const char* collection,
+                                                                     const char* attribute,
+                                                                     struct ArrowSchema* out_schema,
+                                                                     struct ArrowArray* out_array);
+
+// Vectors and sets export as large_list ("+L") arrays with one list per element in read_element_ids order
+// (empty for elements without values); vectors keep their vector_index order
+QUIVER_C_API quiver_error_t quiver_database_read_vector_integers_arrow(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      struct ArrowSchema* out_schema,
+                                                                      struct ArrowArray* out_array);
+QUIVER_C_API quiver_error_t quiver_database_read_vector_floats_arrow(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const char* attribute,
+                                                                    struct ArrowSchema* out_schema,
+                                                                    struct ArrowArray* out_array);
+QUIVER_C_API quiver_error_t quiver_database_read_vector_strings_arrow(quiver_database_t* db,
+                                                                     const char* collection,
+                                                                     const char* attribute,
+                                                                     struct ArrowSchema* out_schema,
+                                                                     struct ArrowArray* out_array);
+QUIVER_C_API quiver_error_t quiver_database_read_set_integers_arrow(quiver_database_t* db,
+                                                                   const char* collection,
+                                                                   const char* attribute,
+                                                                   struct ArrowSchema* out_schema,
+                                                                   struct ArrowArray* out_array);
+QUIVER_C_API quiver_error_t quiver_database_read_set_floats_arrow(quiver_database_t* db,
+                                                                 const char* collection,
+                                                                 const char* attribute,
+                                                                 struct ArrowSchema* out_schema,
+                                                                 struct ArrowArray* out_array);
+QUIVER_C_API quiver_error_t quiver_database_read_set_strings_arrow(quiver_database_t* db,
+                                                                  const char* collection,
+                                                                  const char* attribute,
+                                                                  struct ArrowSchema* out_schema,
+                                                                  struct ArrowArray* out_array);
+
+// Runs a query and exports the whole result as a struct ("+s") array with one child per result column. A column's
+// type comes from its first non-NULL value: int64, float64, large_utf8 or large_binary ("Z", for BLOBs). An int64
+// column becomes float64 at its first REAL value, with the integers in it widened; any other mix of types in one
+// column fails with QUIVER_ERROR_DATABASE. A column with no values at all exports as null ("n").
+// params use the same type tags as quiver_database_query_*_params (param_count may be 0).
+QUIVER_C_API quiver_error_t quiver_database_query_arrow(quiver_database_t* db,
+                                                       const char* sql,
+                                                       const int* param_types,
+                                                       const void* const* param_values,
+                                                       size_t param_count,
+                                                       struct ArrowSchema* out_schema,
+                                                       struct ArrowArray* out_array);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // QUIVER_C_ARROW_H
@@ -0,0 +1,80 @@
+#ifndef QUIVER_C_ASYNC_H
+#define QUIVER_C_ASYNC_H
+
+#include "database.h"
+#include "result.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Opaque handle type: an operation queued on the database's worker thread.
+// Each database runs its async operations one at a time, in submission order, on a thread of its own.
+// While operations are pending, call nothing else on that database; quiver_future_* calls are safe from any thread.
+// Closing the database cancels queued operations and interrupts the running one; its futures stay valid.
+typedef struct quiver_future quiver_future_t;
+
+// Reads; the values come back as a quiver_result_t (vector reads are grouped, see quiver_result_offsets)
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_async(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* attribute,
+                                                                       quiver_future_t** out_future);
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_async(quiver_database_t* db,
+                                                                     const char* collection,
+                                                                     const char* attribute,
+                                                                     quiver_future_t** out_future);
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_async(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      quiver_future_t** out_future);
+QUIVER_C_API quiver_error_t quiver_database_read_vector_integers_async(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* attribute,
+                                                                       quiver_future_t** out_future);
+QUIVER_C_API quiver_error_t quiver_database_read_vector_floats_async(quiver_database_t* db,
+                                                                     const char* collection,
+                                                                     const char* attribute,
+                                                                     quiver_future_t** out_future);
+QUIVER_C_API quiver_error_t quiver_database_read_vector_strings_async(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      quiver_future_t** out_future);
+
+// Exports and imports; these complete without a result
+QUIVER_C_API quiver_error_t quiver_database_export_to_csv_async(quiver_database_t* db,
+                                                                const char* table,
+                                                                const char* path,
+                                                                quiver_future_t** out_future);
+QUIVER_C_API quiver_error_t quiver_database_import_from_csv_async(quiver_database_t* db,
+                                                                  const char* table,
+                                                                  const char* path,
+                                                                  quiver_future_t** out_future);
+QUIVER_C_API quiver_error_t quiver_database_export_collection_async(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const char* directory,
+                                                                    quiver_future_t** out_future);
+QUIVER_C_API quiver_error_t quiver_database_import_collection_async(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const char* directory,
+                                                                    quiver_future_t** out_future);
+
+// Waits up to timeout_ms for completion (0 polls, a negative timeout waits indefinitely); *out_done is 1 once done
+QUIVER_C_API quiver_error_t quiver_future_wait(quiver_future_t* future, int64_t timeout_ms, int* out_done);
+
+// Requests cancellation: a queued operation never runs, a running one is interrupted through sqlite3_interrupt.
+// A cancelled operation completes with QUIVER_ERROR_CANCELLED unless it had already finished.
+QUIVER_C_API quiver_error_t quiver_future_cancel(quiver_future_t* future);
+
+// Returns the outcome of a completed operation (QUIVER_ERROR_INVALID_ARGUMENT while it is still pending) and sets
+// the last error on failure. On success, *out_result receives the read's result (NULL for exports and imports),
+// which the caller frees with quiver_result_free. The result is handed over once; pass NULL to only check the status.
+QUIVER_C_API quiver_error_t quiver_future_result(quiver_future_t* future, quiver_result_t** out_result);
+
+// Frees the handle. A pending operation still runs (or is skipped if cancelled); its result is discarded.
+QUIVER_C_API void quiver_future_free(quiver_future_t* future);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // QUIVER_C_ASYNC_H
@@ -0,0 +1,78 @@
+#ifndef QUIVER_C_ATTRIBUTE_HANDLE_H
+#define QUIVER_C_ATTRIBUTE_HANDLE_H
+
+#include "database.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Opaque handle type: a collection attribute resolved once, so the *_by_handle calls below skip converting names
+// and looking them up in the schema on every call. Valid for the database that created it until its schema changes;
+// free it with quiver_attribute_handle_free.
+typedef struct quiver_attribute_handle quiver_attribute_handle_t;
+
+// Resolves a scalar or vector attribute; fails if the collection has no such attribute
+QUIVER_C_API quiver_error_t quiver_database_attribute_handle(quiver_database_t* db,
+                                                             const char* collection,
+                                                             const char* attribute,
+                                                             quiver_attribute_handle_t** out_handle);
+QUIVER_C_API void quiver_attribute_handle_free(quiver_attribute_handle_t* handle);
+
+// Structure and type the handle was resolved to
+QUIVER_C_API quiver_error_t quiver_attribute_handle_info(const quiver_attribute_handle_t* handle,
+                                                         quiver_data_structure_t* out_structure,
+                                                         quiver_data_type_t* out_type);
+
+// Scalar reads by element id; *out_has_value is 0 when the element does not exist or the value is null
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integer_by_handle(quiver_database_t* db,
+                                                                          const quiver_attribute_handle_t* handle,
+                                                                          int64_t id,
+                                                                          int64_t* out_value,
+                                                                          int* out_has_value);
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_float_by_handle(quiver_database_t* db,
+                                                                        const quiver_attribute_handle_t* handle,
+                                                                        int64_t id,
+                                                                        double* out_value,
+                                                                        int* out_has_value);
+// Caller must free *out_value with quiver_string_free
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_string_by_handle(quiver_database_t* db,
+                                                                         const quiver_attribute_handle_t* handle,
+                                                                         int64_t id,
+                                                                         char** out_value,
+                                                                         int* out_has_value);
+
+// Vector reads by element id into a caller-provided buffer, with the same truncation rule as
+// quiver_database_read_scalar_integers_into
+QUIVER_C_API quiver_error_t quiver_database_read_vector_integers_by_handle(quiver_database_t* db,
+                                                                           const quiver_attribute_handle_t* handle,
+                                                                           int64_t id,
+                                                                           int64_t* buffer,
+                                                                           size_t capacity,
+                                                                           size_t* out_count);
+QUIVER_C_API quiver_error_t quiver_database_read_vector_floats_by_handle(quiver_database_t* db,
+                                                                         const quiver_attribute_handle_t* handle,
+                                                                         int64_t id,
+                                                                         double* buffer,
+                                                                         size_t capacity,
+                                                                         size_t* out_count);
+
+// Scalar updates by element id
+QUIVER_C_API quiver_error_t quiver_database_update_scalar_integer_by_handle(quiver_database_t* db,
+                                                                            const quiver_attribute_handle_t* handle,
+                                                                            int64_t id,
+                                                                            int64_t value);
+QUIVER_C_API quiver_error_t quiver_database_update_scalar_float_by_handle(quiver_database_t* db,
+                                                                          const quiver_attribute_handle_t* handle,
+                                                                          int64_t id,
+                                                                          double value);
+QUIVER_C_API quiver_error_t quiver_database_update_scalar_string_by_handle(quiver_database_t* db,
+                                                                           const quiver_attribute_handle_t* handle,
+                                                                           int64_t id,
+                                                                           const char* value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // QUIVER_C_ATTRIBUTE_HANDLE_H
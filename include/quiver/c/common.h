@@ -28,6 +28,7 @@ typedef enum {
     QUIVER_ERROR_SCHEMA = -4,
     QUIVER_ERROR_CREATE_ELEMENT = -5,
     QUIVER_ERROR_NOT_FOUND = -6,
+    QUIVER_ERROR_CANCELLED = -7,
 } quiver_error_t;
 
 // Utility functions
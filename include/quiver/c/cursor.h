@@ -0,0 +1,71 @@
+#ifndef QUIVER_C_CURSOR_H
+#define QUIVER_C_CURSOR_H
+
+#include "database.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Opaque handle type: a forward-only cursor that steps a query on demand.
+// Must be freed with quiver_cursor_free before or after closing its database; it must not be stepped after close.
+typedef struct quiver_cursor quiver_cursor_t;
+
+// Opens a cursor; params use the same type tags as quiver_database_query_*_params (param_count may be 0)
+QUIVER_C_API quiver_error_t quiver_database_open_cursor(quiver_database_t* db,
+                                                        const char* sql,
+                                                        const int* param_types,
+                                                        const void* const* param_values,
+                                                        size_t param_count,
+                                                        quiver_cursor_t** out_cursor);
+
+// Streaming collection reads (see Database::cursor_scalars / cursor_vector for the column layout)
+QUIVER_C_API quiver_error_t quiver_database_open_scalars_cursor(quiver_database_t* db,
+                                                                const char* collection,
+                                                                const char* const* attributes,
+                                                                size_t attribute_count,
+                                                                quiver_cursor_t** out_cursor);
+QUIVER_C_API quiver_error_t quiver_database_open_vector_cursor(quiver_database_t* db,
+                                                               const char* collection,
+                                                               const char* attribute,
+                                                               quiver_cursor_t** out_cursor);
+
+QUIVER_C_API void quiver_cursor_free(quiver_cursor_t* cursor);
+
+// Advances to the next row; *out_has_row is 0 once the result is exhausted
+QUIVER_C_API quiver_error_t quiver_cursor_next(quiver_cursor_t* cursor, int* out_has_row);
+
+// Column info (name is owned by the cursor)
+QUIVER_C_API quiver_error_t quiver_cursor_column_count(quiver_cursor_t* cursor, size_t* out_count);
+QUIVER_C_API quiver_error_t quiver_cursor_column_name(quiver_cursor_t* cursor, size_t column, const char** out_name);
+
+// Current row accessors; *out_has_value is 0 for NULL or a value of another type
+QUIVER_C_API quiver_error_t quiver_cursor_column_type(quiver_cursor_t* cursor,
+                                                      size_t column,
+                                                      quiver_data_type_t* out_type);
+QUIVER_C_API quiver_error_t quiver_cursor_get_integer(quiver_cursor_t* cursor,
+                                                      size_t column,
+                                                      int64_t* out_value,
+                                                      int* out_has_value);
+QUIVER_C_API quiver_error_t quiver_cursor_get_float(quiver_cursor_t* cursor,
+                                                    size_t column,
+                                                    double* out_value,
+                                                    int* out_has_value);
+// Caller must free *out_value with quiver_string_free
+QUIVER_C_API quiver_error_t quiver_cursor_get_string(quiver_cursor_t* cursor,
+                                                     size_t column,
+                                                     char** out_value,
+                                                     int* out_has_value);
+// Caller must free *out_data with quiver_blob_free; an empty BLOB has *out_size 0 and *out_data NULL
+QUIVER_C_API quiver_error_t quiver_cursor_get_blob(quiver_cursor_t* cursor,
+                                                   size_t column,
+                                                   uint8_t** out_data,
+                                                   size_t* out_size,
+                                                   int* out_has_value);
+QUIVER_C_API void quiver_blob_free(uint8_t* data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // QUIVER_C_CURSOR_H
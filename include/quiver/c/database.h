@@ -7,7 +7,7 @@
 extern "C" {
 #endif
 
-// Log levels for console output
+// Log levels for console and file output
 typedef enum {
     QUIVER_LOG_DEBUG = 0,
     QUIVER_LOG_INFO = 1,
@@ -16,12 +16,129 @@ typedef enum {
     QUIVER_LOG_OFF = 4,
 } quiver_log_level_t;
 
+// SQLite journal modes; DEFAULT keeps the mode stored in the database file
+typedef enum {
+    QUIVER_JOURNAL_MODE_DEFAULT = 0,
+    QUIVER_JOURNAL_MODE_DELETE = 1,
+    QUIVER_JOURNAL_MODE_TRUNCATE = 2,
+    QUIVER_JOURNAL_MODE_WAL = 3,
+    QUIVER_JOURNAL_MODE_MEMORY = 4,
+    QUIVER_JOURNAL_MODE_OFF = 5,
+} quiver_journal_mode_t;
+
+// SQLite synchronous levels; DEFAULT keeps SQLite's FULL
+typedef enum {
+    QUIVER_SYNCHRONOUS_DEFAULT = 0,
+    QUIVER_SYNCHRONOUS_OFF = 1,
+    QUIVER_SYNCHRONOUS_NORMAL = 2,
+    QUIVER_SYNCHRONOUS_FULL = 3,
+    QUIVER_SYNCHRONOUS_EXTRA = 4,
+} quiver_synchronous_t;
+
+// Where SQLite keeps temporary tables and indices
+typedef enum {
+    QUIVER_TEMP_STORE_DEFAULT = 0,
+    QUIVER_TEMP_STORE_FILE = 1,
+    QUIVER_TEMP_STORE_MEMORY = 2,
+} quiver_temp_store_t;
+
 // Database options
 typedef struct {
     int read_only;
     quiver_log_level_t console_level;
+    int statement_cache_size;  // 0 disables the prepared statement cache
+    quiver_journal_mode_t journal_mode;
+    quiver_synchronous_t synchronous;
+    quiver_temp_store_t temp_store;
+    int page_size;        // 0 keeps the default; otherwise a power of two in [512, 65536]
+    int64_t cache_size;   // 0 keeps the default; positive: pages, negative: KiB
+    int64_t mmap_size;    // 0 keeps memory-mapped I/O off; otherwise bytes to map
+    int mapped;           // Nonzero: immutable read-only open with the whole file memory-mapped
+    int validate_schema;  // Nonzero (default): check Quiver schema conventions when the schema is loaded
+    quiver_log_level_t file_level;  // Level for quiver_database.log; QUIVER_LOG_OFF skips the file
+    int async_logging;              // Nonzero: write log lines on a background thread
+    int collect_stats;              // Nonzero: record per-operation and per-statement counters
+    int64_t slow_query_ms;          // Positive: log statements taking at least this many ms; 0 disables
+    int64_t busy_timeout_ms;        // Positive: wait this long for another connection's lock; 0 fails at once
+    int64_t statement_timeout_ms;   // Positive: abort operations running longer than this; 0 disables
+    int load_into_memory;           // Nonzero: work on an in-memory copy of the file, written back by flush
+    int track_changes;              // Nonzero: log changed (collection, id, attribute) for changes_since
+    int cache_reads;                // Nonzero: answer repeated attribute reads from memory until a write
+    int64_t read_cache_limit;       // Positive: bytes kept by cache_reads; 0 leaves it unbounded
+    int64_t soft_heap_limit;        // Positive: process-wide SQLite soft heap limit in bytes; 0 leaves it as is
+    int64_t hard_heap_limit;        // Positive: process-wide SQLite hard heap limit in bytes; 0 leaves it as is
 } quiver_database_options_t;
 
+// Prepared statement cache counters
+typedef struct {
+    int64_t hits;
+    int64_t misses;
+    size_t size;
+    size_t capacity;
+} quiver_statement_cache_stats_t;
+
+// Counters for one public operation (see quiver::OperationStats)
+typedef struct {
+    const char* name;
+    int64_t calls;
+    int64_t total_ns;
+    int64_t max_ns;
+    int64_t rows_read;
+    int64_t rows_written;
+} quiver_operation_stats_t;
+
+// Counters for one SQL text (see quiver::StatementStats)
+typedef struct {
+    const char* sql;
+    int64_t prepares;
+    int64_t prepare_ns;
+    int64_t executions;
+    int64_t total_ns;
+    int64_t max_ns;
+    int64_t rows_read;
+    int64_t rows_written;
+} quiver_statement_stats_t;
+
+typedef struct {
+    quiver_operation_stats_t* operations;
+    size_t operation_count;
+    quiver_statement_stats_t* statements;
+    size_t statement_count;
+    quiver_statement_cache_stats_t statement_cache;
+} quiver_database_stats_t;
+
+// Bytes held by one connection plus SQLite's process-wide heap (see quiver::MemoryUsage)
+typedef struct {
+    int64_t page_cache;
+    int64_t sqlite_schema;
+    int64_t statements;
+    int64_t schema;
+    int64_t read_cache;
+    int64_t label_cache;
+    int64_t cache_hits;
+    int64_t cache_misses;
+    int64_t cache_writes;
+    int64_t cache_spills;
+    int64_t sqlite_heap;
+    int64_t sqlite_heap_highwater;
+    int64_t soft_heap_limit;
+    int64_t total;  // Sum of the per-connection byte counts
+} quiver_memory_usage_t;
+
+// Change log entries (see quiver::Database::changes_since)
+typedef enum {
+    QUIVER_CHANGE_CREATED = 0,
+    QUIVER_CHANGE_UPDATED = 1,
+    QUIVER_CHANGE_DELETED = 2
+} quiver_change_kind_t;
+
+typedef struct {
+    const char* collection;
+    int64_t id;
+    const char* attribute;  // NULL when the element itself was created or deleted
+    quiver_change_kind_t kind;
+} quiver_change_t;
+
 // Attribute data structure
 typedef enum {
     QUIVER_DATA_STRUCTURE_SCALAR = 0,
@@ -35,7 +152,8 @@ typedef enum {
     QUIVER_DATA_TYPE_FLOAT = 1,
     QUIVER_DATA_TYPE_STRING = 2,
     QUIVER_DATA_TYPE_DATE_TIME = 3,
-    QUIVER_DATA_TYPE_NULL = 4
+    QUIVER_DATA_TYPE_NULL = 4,
+    QUIVER_DATA_TYPE_BLOB = 5  // Query and cursor columns only
 } quiver_data_type_t;
 
 // Returns default options
@@ -55,21 +173,107 @@ QUIVER_C_API void quiver_database_close(quiver_database_t* db);
 QUIVER_C_API int quiver_database_is_healthy(quiver_database_t* db);
 QUIVER_C_API const char* quiver_database_path(quiver_database_t* db);
 
+// Snapshots and online backups (see quiver::Database::from_snapshot and backup_to).
+// pages_per_step of 0 or less copies everything in one step; progress may be NULL.
+typedef void (*quiver_backup_progress_t)(int remaining, int total, void* user_data);
+QUIVER_C_API quiver_database_t* quiver_database_from_snapshot(const char* path,
+                                                              const quiver_database_options_t* options);
+QUIVER_C_API quiver_error_t quiver_database_backup_to(quiver_database_t* db,
+                                                      const char* path,
+                                                      int pages_per_step,
+                                                      quiver_backup_progress_t progress,
+                                                      void* user_data);
+// Close the clone with quiver_database_close
+QUIVER_C_API quiver_error_t quiver_database_clone_in_memory(quiver_database_t* db, quiver_database_t** out_db);
+// Writes an options.load_into_memory copy back to its file; nothing to do otherwise
+QUIVER_C_API quiver_error_t quiver_database_flush(quiver_database_t* db);
+
 // Version
 QUIVER_C_API int64_t quiver_database_current_version(quiver_database_t* db);
 
+// Change log (options.track_changes; these fail when it is off). out_token receives the token to pass next time.
+// Free the changes with quiver_free_changes.
+QUIVER_C_API quiver_error_t quiver_database_change_token(quiver_database_t* db, int64_t* out_token);
+QUIVER_C_API quiver_error_t quiver_database_changes_since(quiver_database_t* db,
+                                                          int64_t token,
+                                                          quiver_change_t** out_changes,
+                                                          size_t* out_count,
+                                                          int64_t* out_token);
+QUIVER_C_API quiver_error_t quiver_database_discard_changes(quiver_database_t* db, int64_t token);
+QUIVER_C_API void quiver_free_changes(quiver_change_t* changes, size_t count);
+
+// Execution limits (see quiver::Database::interrupt and DatabaseOptions::statement_timeout).
+// quiver_database_interrupt may be called from any thread; the aborted call fails with an "interrupted" error.
+// A timeout of 0 or less removes the limit.
+typedef int (*quiver_progress_callback_t)(void* user_data);  // Nonzero return aborts the running statement
+QUIVER_C_API quiver_error_t quiver_database_interrupt(quiver_database_t* db);
+QUIVER_C_API quiver_error_t quiver_database_set_busy_timeout(quiver_database_t* db, int64_t timeout_ms);
+QUIVER_C_API quiver_error_t quiver_database_set_statement_timeout(quiver_database_t* db, int64_t timeout_ms);
+// Called every few thousand VM instructions on the thread running the statement; NULL callback removes it
+QUIVER_C_API quiver_error_t quiver_database_set_progress_handler(quiver_database_t* db,
+                                                                 quiver_progress_callback_t callback,
+                                                                 void* user_data);
+
+// Statement cache
+QUIVER_C_API quiver_error_t quiver_database_statement_cache_stats(quiver_database_t* db,
+                                                                  quiver_statement_cache_stats_t* out_stats);
+
+// Operation and statement counters; the lists stay empty unless options.collect_stats was set.
+// Free with quiver_free_database_stats.
+QUIVER_C_API quiver_error_t quiver_database_stats(quiver_database_t* db, quiver_database_stats_t* out_stats);
+QUIVER_C_API quiver_error_t quiver_database_reset_stats(quiver_database_t* db);
+QUIVER_C_API void quiver_free_database_stats(quiver_database_stats_t* stats);
+
+// Memory accounting; shrink_memory frees caches that are rebuilt on demand. out_released may be NULL.
+QUIVER_C_API quiver_error_t quiver_database_memory_usage(quiver_database_t* db, quiver_memory_usage_t* out_usage);
+QUIVER_C_API quiver_error_t quiver_database_shrink_memory(quiver_database_t* db, int64_t* out_released);
+
+// Transactions (nested calls use SAVEPOINTs; commit/rollback close the innermost level)
+QUIVER_C_API quiver_error_t quiver_database_begin_transaction(quiver_database_t* db);
+QUIVER_C_API quiver_error_t quiver_database_commit(quiver_database_t* db);
+QUIVER_C_API quiver_error_t quiver_database_rollback(quiver_database_t* db);
+QUIVER_C_API quiver_error_t quiver_database_in_transaction(quiver_database_t* db, int* out_active);
+
 // Element operations (requires quiver_element_t from element.h)
 typedef struct quiver_element quiver_element_t;
 QUIVER_C_API int64_t quiver_database_create_element(quiver_database_t* db,
                                                     const char* collection,
                                                     quiver_element_t* element);
+// Creates count elements in one transaction; out_ids (caller-allocated, count entries) receives the new ids
+QUIVER_C_API quiver_error_t quiver_database_create_elements(quiver_database_t* db,
+                                                            const char* collection,
+                                                            quiver_element_t* const* elements,
+                                                            size_t count,
+                                                            int64_t* out_ids);
 QUIVER_C_API quiver_error_t quiver_database_update_element(quiver_database_t* db,
                                                            const char* collection,
                                                            int64_t id,
                                                            const quiver_element_t* element);
+// Creates the element or updates the one with the same label (see quiver::Database::upsert_element)
+QUIVER_C_API quiver_error_t quiver_database_upsert_element(quiver_database_t* db,
+                                                           const char* collection,
+                                                           const quiver_element_t* element,
+                                                           int64_t* out_id);
+// Upserts count elements in one transaction; out_ids (caller-allocated, count entries) receives their ids
+QUIVER_C_API quiver_error_t quiver_database_upsert_elements(quiver_database_t* db,
+                                                            const char* collection,
+                                                            quiver_element_t* const* elements,
+                                                            size_t count,
+                                                            int64_t* out_ids);
+// Reads a whole element (see quiver::Database::read_element) into a new handle; free it with quiver_element_destroy
+QUIVER_C_API quiver_error_t quiver_database_read_element(quiver_database_t* db,
+                                                         const char* collection,
+                                                         int64_t id,
+                                                         quiver_element_t** out_element);
 QUIVER_C_API quiver_error_t quiver_database_delete_element_by_id(quiver_database_t* db,
                                                                  const char* collection,
                                                                  int64_t id);
+// Deletes the elements in one transaction (see quiver::Database::delete_elements_by_ids); unknown ids are skipped
+QUIVER_C_API quiver_error_t quiver_database_delete_elements_by_ids(quiver_database_t* db,
+                                                                   const char* collection,
+                                                                   const int64_t* ids,
+                                                                   size_t count,
+                                                                   size_t* out_deleted);
 
 // Relation operations
 QUIVER_C_API quiver_error_t quiver_database_set_scalar_relation(quiver_database_t* db,
@@ -78,12 +282,27 @@ QUIVER_C_API quiver_error_t quiver_database_set_scalar_relation(quiver_database_
                                                                 const char* from_label,
                                                                 const char* to_label);
 
+// Sets from_labels[i] -> to_labels[i] for count pairs in one transaction
+QUIVER_C_API quiver_error_t quiver_database_set_scalar_relations(quiver_database_t* db,
+                                                                 const char* collection,
+                                                                 const char* attribute,
+                                                                 const char* const* from_labels,
+                                                                 const char* const* to_labels,
+                                                                 size_t count);
+
 QUIVER_C_API quiver_error_t quiver_database_read_scalar_relation(quiver_database_t* db,
                                                                  const char* collection,
                                                                  const char* attribute,
                                                                  char*** out_values,
                                                                  size_t* out_count);
 
+// Target ids, one per element; unset relations read as 0. Free with quiver_free_integer_array.
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_relation_ids(quiver_database_t* db,
+                                                                     const char* collection,
+                                                                     const char* attribute,
+                                                                     int64_t** out_values,
+                                                                     size_t* out_count);
+
 // Read scalar attributes
 QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers(quiver_database_t* db,
                                                                  const char* collection,
@@ -103,6 +322,53 @@ QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings(quiver_database_
                                                                 char*** out_values,
                                                                 size_t* out_count);
 
+// Read scalar attributes into a caller-provided buffer (no allocation by the library).
+// Writes at most capacity values and sets *out_count to the total number available, so a result
+// with *out_count > capacity was truncated. quiver_database_count_scalar_values returns that total.
+QUIVER_C_API quiver_error_t quiver_database_count_scalar_values(quiver_database_t* db,
+                                                                const char* collection,
+                                                                const char* attribute,
+                                                                size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_into(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      int64_t* buffer,
+                                                                      size_t capacity,
+                                                                      size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_into(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const char* attribute,
+                                                                    double* buffer,
+                                                                    size_t capacity,
+                                                                    size_t* out_count);
+
+// Read scalar attributes keeping nulls: one entry per element, in quiver_database_read_element_ids order.
+// out_validity is a packed bitmap of (out_count + 7) / 8 bytes, least significant bit first; bit i is set when
+// value i is present (null strings are NULL). Free values with the matching quiver_free_*_array and the bitmap
+// with quiver_free_validity_bitmap.
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_nullable(quiver_database_t* db,
+                                                                          const char* collection,
+                                                                          const char* attribute,
+                                                                          int64_t** out_values,
+                                                                          uint8_t** out_validity,
+                                                                          size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_nullable(quiver_database_t* db,
+                                                                        const char* collection,
+                                                                        const char* attribute,
+                                                                        double** out_values,
+                                                                        uint8_t** out_validity,
+                                                                        size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_nullable(quiver_database_t* db,
+                                                                         const char* collection,
+                                                                         const char* attribute,
+                                                                         char*** out_values,
+                                                                         uint8_t** out_validity,
+                                                                         size_t* out_count);
+
 // Read vector attributes
 QUIVER_C_API quiver_error_t quiver_database_read_vector_integers(quiver_database_t* db,
                                                                  const char* collection,
@@ -147,6 +413,129 @@ QUIVER_C_API quiver_error_t quiver_database_read_set_strings(quiver_database_t*
                                                              size_t** out_sizes,
                                                              size_t* out_count);
 
+// Read vector/set attributes in flat (CSR) layout: group i holds values[offsets[i], offsets[i + 1]).
+// offsets always has out_count + 1 entries; values is NULL when there are no values.
+// Free with quiver_free_integer_flat / quiver_free_float_flat / quiver_free_string_flat.
+QUIVER_C_API quiver_error_t quiver_database_read_vector_integers_flat(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      int64_t** out_values,
+                                                                      size_t** out_offsets,
+                                                                      size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_floats_flat(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const char* attribute,
+                                                                    double** out_values,
+                                                                    size_t** out_offsets,
+                                                                    size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_strings_flat(quiver_database_t* db,
+                                                                     const char* collection,
+                                                                     const char* attribute,
+                                                                     char*** out_values,
+                                                                     size_t** out_offsets,
+                                                                     size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_integers_flat(quiver_database_t* db,
+                                                                   const char* collection,
+                                                                   const char* attribute,
+                                                                   int64_t** out_values,
+                                                                   size_t** out_offsets,
+                                                                   size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_floats_flat(quiver_database_t* db,
+                                                                 const char* collection,
+                                                                 const char* attribute,
+                                                                 double** out_values,
+                                                                 size_t** out_offsets,
+                                                                 size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_strings_flat(quiver_database_t* db,
+                                                                  const char* collection,
+                                                                  const char* attribute,
+                                                                  char*** out_values,
+                                                                  size_t** out_offsets,
+                                                                  size_t* out_count);
+
+// Same layout, but one group per element in quiver_database_read_element_ids order (empty groups included),
+// so group i lines up with the nullable scalar reads. Free like the _flat readers.
+QUIVER_C_API quiver_error_t quiver_database_read_vector_integers_flat_aligned(quiver_database_t* db,
+                                                                              const char* collection,
+                                                                              const char* attribute,
+                                                                              int64_t** out_values,
+                                                                              size_t** out_offsets,
+                                                                              size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_floats_flat_aligned(quiver_database_t* db,
+                                                                            const char* collection,
+                                                                            const char* attribute,
+                                                                            double** out_values,
+                                                                            size_t** out_offsets,
+                                                                            size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_strings_flat_aligned(quiver_database_t* db,
+                                                                             const char* collection,
+                                                                             const char* attribute,
+                                                                             char*** out_values,
+                                                                             size_t** out_offsets,
+                                                                             size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_integers_flat_aligned(quiver_database_t* db,
+                                                                           const char* collection,
+                                                                           const char* attribute,
+                                                                           int64_t** out_values,
+                                                                           size_t** out_offsets,
+                                                                           size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_floats_flat_aligned(quiver_database_t* db,
+                                                                         const char* collection,
+                                                                         const char* attribute,
+                                                                         double** out_values,
+                                                                         size_t** out_offsets,
+                                                                         size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_strings_flat_aligned(quiver_database_t* db,
+                                                                          const char* collection,
+                                                                          const char* attribute,
+                                                                          char*** out_values,
+                                                                          size_t** out_offsets,
+                                                                          size_t* out_count);
+
+// String reads in one allocation: out_values is an array of out_count pointers followed by the characters they
+// point into, so the whole result is freed by a single quiver_free_string_arena (plus quiver_free_string_arena_flat
+// for the grouped readers' offsets). Same rows as the _strings/_relation and _strings_flat readers; unset
+// relations read as "". Nonzero intern stores repeated values once (equal strings share one pointer).
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_arena(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      int intern,
+                                                                      char*** out_values,
+                                                                      size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_relation_arena(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* attribute,
+                                                                       int intern,
+                                                                       char*** out_values,
+                                                                       size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_strings_arena(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      int intern,
+                                                                      char*** out_values,
+                                                                      size_t** out_offsets,
+                                                                      size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_strings_arena(quiver_database_t* db,
+                                                                   const char* collection,
+                                                                   const char* attribute,
+                                                                   int intern,
+                                                                   char*** out_values,
+                                                                   size_t** out_offsets,
+                                                                   size_t* out_count);
+
 // Read scalar attributes by element ID
 QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_by_id(quiver_database_t* db,
                                                                        const char* collection,
@@ -191,6 +580,17 @@ QUIVER_C_API quiver_error_t quiver_database_read_vector_strings_by_id(quiver_dat
                                                                       char*** out_values,
                                                                       size_t* out_count);
 
+// Entries [first, first + count) (0-based) of one element's float vector, clipped to its length; free with
+// quiver_free_float_array. Packed vector tables read only those bytes.
+QUIVER_C_API quiver_error_t quiver_database_read_vector_floats_range(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const char* attribute,
+                                                                    int64_t id,
+                                                                    int64_t first,
+                                                                    int64_t count,
+                                                                    double** out_values,
+                                                                    size_t* out_count);
+
 // Read set attributes by element ID
 QUIVER_C_API quiver_error_t quiver_database_read_set_integers_by_id(quiver_database_t* db,
                                                                     const char* collection,
@@ -213,12 +613,172 @@ QUIVER_C_API quiver_error_t quiver_database_read_set_strings_by_id(quiver_databa
                                                                    char*** out_values,
                                                                    size_t* out_count);
 
+// Read attributes for a batch of element IDs, one result per id in input order.
+// Scalars: id_count values plus a validity bitmap as in the _nullable readers (unset for unknown ids and nulls).
+// Vectors/sets: id_count groups in CSR layout (id_count + 1 offsets); free like the _flat readers.
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_by_ids(quiver_database_t* db,
+                                                                        const char* collection,
+                                                                        const char* attribute,
+                                                                        const int64_t* ids,
+                                                                        size_t id_count,
+                                                                        int64_t** out_values,
+                                                                        uint8_t** out_validity);
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_by_ids(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      const int64_t* ids,
+                                                                      size_t id_count,
+                                                                      double** out_values,
+                                                                      uint8_t** out_validity);
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_by_ids(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* attribute,
+                                                                       const int64_t* ids,
+                                                                       size_t id_count,
+                                                                       char*** out_values,
+                                                                       uint8_t** out_validity);
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_integers_by_ids(quiver_database_t* db,
+                                                                        const char* collection,
+                                                                        const char* attribute,
+                                                                        const int64_t* ids,
+                                                                        size_t id_count,
+                                                                        int64_t** out_values,
+                                                                        size_t** out_offsets);
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_floats_by_ids(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      const int64_t* ids,
+                                                                      size_t id_count,
+                                                                      double** out_values,
+                                                                      size_t** out_offsets);
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_strings_by_ids(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* attribute,
+                                                                       const int64_t* ids,
+                                                                       size_t id_count,
+                                                                       char*** out_values,
+                                                                       size_t** out_offsets);
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_integers_by_ids(quiver_database_t* db,
+                                                                     const char* collection,
+                                                                     const char* attribute,
+                                                                     const int64_t* ids,
+                                                                     size_t id_count,
+                                                                     int64_t** out_values,
+                                                                     size_t** out_offsets);
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_floats_by_ids(quiver_database_t* db,
+                                                                   const char* collection,
+                                                                   const char* attribute,
+                                                                   const int64_t* ids,
+                                                                   size_t id_count,
+                                                                   double** out_values,
+                                                                   size_t** out_offsets);
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_strings_by_ids(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const char* attribute,
+                                                                    const int64_t* ids,
+                                                                    size_t id_count,
+                                                                    char*** out_values,
+                                                                    size_t** out_offsets);
+
+// Read a float time series by element ID; date_time_from / date_time_to may be NULL for an open range.
+// out_date_times[i] pairs with out_values[i]; missing values are NaN.
+// Free with quiver_free_time_series_floats.
+QUIVER_C_API quiver_error_t quiver_database_read_time_series_floats(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const char* attribute,
+                                                                    int64_t id,
+                                                                    const char* date_time_from,
+                                                                    const char* date_time_to,
+                                                                    char*** out_date_times,
+                                                                    double** out_values,
+                                                                    size_t* out_count);
+
+// Statistics of quiver_database_aggregate_*; see quiver::Aggregate for empty groups
+typedef enum {
+    QUIVER_AGGREGATE_SUM = 0,
+    QUIVER_AGGREGATE_MEAN = 1,
+    QUIVER_AGGREGATE_MIN = 2,
+    QUIVER_AGGREGATE_MAX = 3,
+    QUIVER_AGGREGATE_COUNT = 4,
+} quiver_aggregate_t;
+
+typedef enum {
+    QUIVER_TIME_BUCKET_YEAR = 0,
+    QUIVER_TIME_BUCKET_MONTH = 1,
+    QUIVER_TIME_BUCKET_DAY = 2,
+    QUIVER_TIME_BUCKET_HOUR = 3,
+} quiver_time_bucket_t;
+
+// Per-element statistics computed in SQLite (see Database::aggregate_vector / aggregate_time_series).
+// Row i is element out_ids[i] (and bucket out_buckets[i]); out_values holds statistic_count contiguous arrays of
+// out_count doubles, statistic s of row i at out_values[s * out_count + i]. Free with quiver_free_integer_array,
+// quiver_free_string_array (buckets) and quiver_free_float_array.
+QUIVER_C_API quiver_error_t quiver_database_aggregate_vector(quiver_database_t* db,
+                                                             const char* collection,
+                                                             const char* attribute,
+                                                             const quiver_aggregate_t* statistics,
+                                                             size_t statistic_count,
+                                                             int64_t** out_ids,
+                                                             double** out_values,
+                                                             size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_aggregate_time_series(quiver_database_t* db,
+                                                                  const char* collection,
+                                                                  const char* attribute,
+                                                                  quiver_time_bucket_t bucket,
+                                                                  const quiver_aggregate_t* statistics,
+                                                                  size_t statistic_count,
+                                                                  int64_t** out_ids,
+                                                                  char*** out_buckets,
+                                                                  double** out_values,
+                                                                  size_t* out_count);
+
 // Read element IDs
 QUIVER_C_API quiver_error_t quiver_database_read_element_ids(quiver_database_t* db,
                                                              const char* collection,
                                                              int64_t** out_ids,
                                                              size_t* out_count);
 
+// One column of quiver_database_read_scalars; only the buffer matching data_type is set
+typedef struct {
+    const char* name;
+    quiver_data_type_t data_type;
+    int64_t* integers;  // QUIVER_DATA_TYPE_INTEGER
+    double* floats;     // QUIVER_DATA_TYPE_FLOAT
+    char** strings;     // QUIVER_DATA_TYPE_STRING / DATE_TIME, NULL entries where null
+    uint8_t* nulls;     // 1 where the element has no value
+} quiver_scalar_column_t;
+
+// Reads attribute_count scalar attributes in one pass: out_count rows, row i of every column belongs to out_ids[i].
+// out_columns holds attribute_count columns. Free with quiver_free_scalar_columns.
+QUIVER_C_API quiver_error_t quiver_database_read_scalars(quiver_database_t* db,
+                                                         const char* collection,
+                                                         const char* const* attributes,
+                                                         size_t attribute_count,
+                                                         int64_t** out_ids,
+                                                         quiver_scalar_column_t** out_columns,
+                                                         size_t* out_count);
+
+// Creates count elements from column_count scalar columns in one transaction, the columnar counterpart of
+// quiver_database_create_elements: row i of every column belongs to element i. Only the buffer matching data_type
+// is read; nulls may be NULL (no nulls), and elements where nulls[i] is set (or a string entry is NULL) leave that
+// attribute unset.
+// out_ids (caller-allocated, count entries) receives the new ids.
+QUIVER_C_API quiver_error_t quiver_database_create_elements_columns(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const quiver_scalar_column_t* columns,
+                                                                    size_t column_count,
+                                                                    size_t count,
+                                                                    int64_t* out_ids);
+
 // Attribute metadata types
 typedef struct {
     const char* name;
@@ -301,6 +861,29 @@ QUIVER_C_API quiver_error_t quiver_database_update_scalar_string(quiver_database
                                                                  int64_t id,
                                                                  const char* value);
 
+// Update one scalar attribute for many elements: values[i] is written to element ids[i].
+// The type is checked once and all count rows are written in a single transaction.
+QUIVER_C_API quiver_error_t quiver_database_update_scalar_integers(quiver_database_t* db,
+                                                                   const char* collection,
+                                                                   const char* attribute,
+                                                                   const int64_t* ids,
+                                                                   const int64_t* values,
+                                                                   size_t count);
+
+QUIVER_C_API quiver_error_t quiver_database_update_scalar_floats(quiver_database_t* db,
+                                                                 const char* collection,
+                                                                 const char* attribute,
+                                                                 const int64_t* ids,
+                                                                 const double* values,
+                                                                 size_t count);
+
+QUIVER_C_API quiver_error_t quiver_database_update_scalar_strings(quiver_database_t* db,
+                                                                  const char* collection,
+                                                                  const char* attribute,
+                                                                  const int64_t* ids,
+                                                                  const char* const* values,
+                                                                  size_t count);
+
 // Update vector attributes (by element ID) - replaces entire vector
 QUIVER_C_API quiver_error_t quiver_database_update_vector_integers(quiver_database_t* db,
                                                                    const char* collection,
@@ -323,6 +906,50 @@ QUIVER_C_API quiver_error_t quiver_database_update_vector_strings(quiver_databas
                                                                   const char* const* values,
                                                                   size_t count);
 
+// Append to vector attributes by element ID, after the last stored entry
+QUIVER_C_API quiver_error_t quiver_database_append_vector_integers(quiver_database_t* db,
+                                                                   const char* collection,
+                                                                   const char* attribute,
+                                                                   int64_t id,
+                                                                   const int64_t* values,
+                                                                   size_t count);
+
+QUIVER_C_API quiver_error_t quiver_database_append_vector_floats(quiver_database_t* db,
+                                                                 const char* collection,
+                                                                 const char* attribute,
+                                                                 int64_t id,
+                                                                 const double* values,
+                                                                 size_t count);
+
+QUIVER_C_API quiver_error_t quiver_database_append_vector_strings(quiver_database_t* db,
+                                                                  const char* collection,
+                                                                  const char* attribute,
+                                                                  int64_t id,
+                                                                  const char* const* values,
+                                                                  size_t count);
+
+// Update one vector entry by element ID and 0-based index; fails if the entry does not exist
+QUIVER_C_API quiver_error_t quiver_database_update_vector_integer_entry(quiver_database_t* db,
+                                                                        const char* collection,
+                                                                        const char* attribute,
+                                                                        int64_t id,
+                                                                        int64_t index,
+                                                                        int64_t value);
+
+QUIVER_C_API quiver_error_t quiver_database_update_vector_float_entry(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      int64_t id,
+                                                                      int64_t index,
+                                                                      double value);
+
+QUIVER_C_API quiver_error_t quiver_database_update_vector_string_entry(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* attribute,
+                                                                       int64_t id,
+                                                                       int64_t index,
+                                                                       const char* value);
+
 // Update set attributes (by element ID) - replaces entire set
 QUIVER_C_API quiver_error_t quiver_database_update_set_integers(quiver_database_t* db,
                                                                 const char* collection,
@@ -345,20 +972,54 @@ QUIVER_C_API quiver_error_t quiver_database_update_set_strings(quiver_database_t
                                                                const char* const* values,
                                                                size_t count);
 
+// Update time series attributes by element ID - replaces the element's rows in the group (NaN is stored as NULL)
+QUIVER_C_API quiver_error_t quiver_database_update_time_series_floats(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      int64_t id,
+                                                                      const char* const* date_times,
+                                                                      const double* values,
+                                                                      size_t count);
+
 // Memory cleanup for read results
 QUIVER_C_API void quiver_free_integer_array(int64_t* values);
 QUIVER_C_API void quiver_free_float_array(double* values);
 QUIVER_C_API void quiver_free_string_array(char** values, size_t count);
+QUIVER_C_API void quiver_free_validity_bitmap(uint8_t* validity);
 
 // Memory cleanup for vector read results
 QUIVER_C_API void quiver_free_integer_vectors(int64_t** vectors, size_t* sizes, size_t count);
 QUIVER_C_API void quiver_free_float_vectors(double** vectors, size_t* sizes, size_t count);
 QUIVER_C_API void quiver_free_string_vectors(char*** vectors, size_t* sizes, size_t count);
 
+// Memory cleanup for flat read results (count is the out_count returned by the read)
+QUIVER_C_API void quiver_free_integer_flat(int64_t* values, size_t* offsets);
+QUIVER_C_API void quiver_free_float_flat(double* values, size_t* offsets);
+QUIVER_C_API void quiver_free_string_flat(char** values, size_t* offsets, size_t count);
+
+// Memory cleanup for arena read results (one block each, whatever the count)
+QUIVER_C_API void quiver_free_string_arena(char** values);
+QUIVER_C_API void quiver_free_string_arena_flat(char** values, size_t* offsets);
+
+// Memory cleanup for time series read results
+QUIVER_C_API void quiver_free_time_series_floats(char** date_times, double* values, size_t count);
+
+// Free scalar columns (from read_scalars)
+QUIVER_C_API void
+quiver_free_scalar_columns(int64_t* ids, quiver_scalar_column_t* columns, size_t column_count, size_t count);
+
 // CSV operations
 QUIVER_C_API quiver_error_t quiver_database_export_to_csv(quiver_database_t* db, const char* table, const char* path);
 QUIVER_C_API quiver_error_t quiver_database_import_from_csv(quiver_database_t* db, const char* table, const char* path);
 
+// Columnar file operations: <directory>/<table>.arrow per table of the collection (Arrow IPC / Feather V2)
+QUIVER_C_API quiver_error_t quiver_database_export_collection(quiver_database_t* db,
+                                                              const char* collection,
+                                                              const char* directory);
+QUIVER_C_API quiver_error_t quiver_database_import_collection(quiver_database_t* db,
+                                                              const char* collection,
+                                                              const char* directory);
+
 // Query methods - execute SQL and return first row's first column
 QUIVER_C_API quiver_error_t quiver_database_query_string(quiver_database_t* db,
                                                          const char* sql,
@@ -405,6 +1066,8 @@ QUIVER_C_API quiver_error_t quiver_database_query_float_params(quiver_database_t
 
 // Schema inspection
 QUIVER_C_API quiver_error_t quiver_database_describe(quiver_database_t* db);
+// Creates the indexes quiver's lookups need but the schema lacks (see quiver::Database::create_missing_indexes)
+QUIVER_C_API quiver_error_t quiver_database_create_missing_indexes(quiver_database_t* db, size_t* out_created);
 
 #ifdef __cplusplus
 }
@@ -41,6 +41,39 @@ QUIVER_C_API int quiver_element_has_arrays(quiver_element_t* element);
 QUIVER_C_API size_t quiver_element_scalar_count(quiver_element_t* element);
 QUIVER_C_API size_t quiver_element_array_count(quiver_element_t* element);
 
+// Names, in name order; NULL past the end. Owned by the element.
+QUIVER_C_API const char* quiver_element_scalar_name(quiver_element_t* element, size_t index);
+QUIVER_C_API const char* quiver_element_array_name(quiver_element_t* element, size_t index);
+
+// Getters, e.g. for quiver_database_read_element results. QUIVER_ERROR_NOT_FOUND when name is not set and
+// QUIVER_ERROR_INVALID_ARGUMENT when it holds another type; a null scalar gives *out_has_value = 0.
+// Strings and integer/float arrays point into the element and stay valid until it is changed or destroyed;
+// string arrays are copied (free with quiver_free_string_array).
+QUIVER_C_API quiver_error_t quiver_element_get_integer(quiver_element_t* element,
+                                                       const char* name,
+                                                       int64_t* out_value,
+                                                       int* out_has_value);
+QUIVER_C_API quiver_error_t quiver_element_get_float(quiver_element_t* element,
+                                                     const char* name,
+                                                     double* out_value,
+                                                     int* out_has_value);
+QUIVER_C_API quiver_error_t quiver_element_get_string(quiver_element_t* element,
+                                                      const char* name,
+                                                      const char** out_value,
+                                                      int* out_has_value);
+QUIVER_C_API quiver_error_t quiver_element_get_array_integer(quiver_element_t* element,
+                                                             const char* name,
+                                                             const int64_t** out_values,
+                                                             size_t* out_count);
+QUIVER_C_API quiver_error_t quiver_element_get_array_float(quiver_element_t* element,
+                                                           const char* name,
+                                                           const double** out_values,
+                                                           size_t* out_count);
+QUIVER_C_API quiver_error_t quiver_element_get_array_string(quiver_element_t* element,
+                                                            const char* name,
+                                                            char*** out_values,
+                                                            size_t* out_count);
+
 // Pretty print (caller must free returned string with quiver_string_free)
 QUIVER_C_API char* quiver_element_to_string(quiver_element_t* element);
 QUIVER_C_API void quiver_string_free(char* str);
@@ -0,0 +1,131 @@
+#ifndef QUIVER_C_FILTER_H
+#define QUIVER_C_FILTER_H
+
+#include "database.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Opaque handle type: the conditions of a filtered bulk read (see quiver::Filter), all of which must hold.
+// Values are bound as statement parameters; attribute names are checked against the schema by the read.
+typedef struct quiver_filter quiver_filter_t;
+
+typedef enum {
+    QUIVER_FILTER_EQUAL = 0,
+    QUIVER_FILTER_NOT_EQUAL = 1,
+    QUIVER_FILTER_LESS = 2,
+    QUIVER_FILTER_LESS_EQUAL = 3,
+    QUIVER_FILTER_GREATER = 4,
+    QUIVER_FILTER_GREATER_EQUAL = 5,
+    QUIVER_FILTER_IS_NULL = 6,
+    QUIVER_FILTER_IS_NOT_NULL = 7,
+} quiver_filter_op_t;
+
+// Filter builder; an empty filter matches every element
+QUIVER_C_API quiver_filter_t* quiver_filter_create(void);
+QUIVER_C_API void quiver_filter_destroy(quiver_filter_t* filter);
+
+// from <= id <= to
+QUIVER_C_API quiver_error_t quiver_filter_id_range(quiver_filter_t* filter, int64_t from, int64_t to);
+// id is one of ids (count may be 0, which matches nothing); replaces an earlier list
+QUIVER_C_API quiver_error_t quiver_filter_id_in(quiver_filter_t* filter, const int64_t* ids, size_t count);
+
+// attribute op value on a scalar attribute; quiver_filter_where_null takes QUIVER_FILTER_IS_NULL / IS_NOT_NULL
+QUIVER_C_API quiver_error_t
+quiver_filter_where_integer(quiver_filter_t* filter, const char* attribute, quiver_filter_op_t op, int64_t value);
+QUIVER_C_API quiver_error_t
+quiver_filter_where_float(quiver_filter_t* filter, const char* attribute, quiver_filter_op_t op, double value);
+QUIVER_C_API quiver_error_t
+quiver_filter_where_string(quiver_filter_t* filter, const char* attribute, quiver_filter_op_t op, const char* value);
+QUIVER_C_API quiver_error_t quiver_filter_where_null(quiver_filter_t* filter,
+                                                     const char* attribute,
+                                                     quiver_filter_op_t op);
+
+// Filtered bulk reads: the unfiltered readers' layout and free functions, over the matching elements only
+QUIVER_C_API quiver_error_t quiver_database_read_element_ids_filtered(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const quiver_filter_t* filter,
+                                                                      int64_t** out_ids,
+                                                                      size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_filtered(quiver_database_t* db,
+                                                                          const char* collection,
+                                                                          const char* attribute,
+                                                                          const quiver_filter_t* filter,
+                                                                          int64_t** out_values,
+                                                                          size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_filtered(quiver_database_t* db,
+                                                                        const char* collection,
+                                                                        const char* attribute,
+                                                                        const quiver_filter_t* filter,
+                                                                        double** out_values,
+                                                                        size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_filtered(quiver_database_t* db,
+                                                                         const char* collection,
+                                                                         const char* attribute,
+                                                                         const quiver_filter_t* filter,
+                                                                         char*** out_values,
+                                                                         size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_integers_flat_filtered(quiver_database_t* db,
+                                                                               const char* collection,
+                                                                               const char* attribute,
+                                                                               const quiver_filter_t* filter,
+                                                                               int64_t** out_values,
+                                                                               size_t** out_offsets,
+                                                                               size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_floats_flat_filtered(quiver_database_t* db,
+                                                                             const char* collection,
+                                                                             const char* attribute,
+                                                                             const quiver_filter_t* filter,
+                                                                             double** out_values,
+                                                                             size_t** out_offsets,
+                                                                             size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_strings_flat_filtered(quiver_database_t* db,
+                                                                              const char* collection,
+                                                                              const char* attribute,
+                                                                              const quiver_filter_t* filter,
+                                                                              char*** out_values,
+                                                                              size_t** out_offsets,
+                                                                              size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_integers_flat_filtered(quiver_database_t* db,
+                                                                            const char* collection,
+                                                                            const char* attribute,
+                                                                            const quiver_filter_t* filter,
+                                                                            int64_t** out_values,
+                                                                            size_t** out_offsets,
+                                                                            size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_floats_flat_filtered(quiver_database_t* db,
+                                                                          const char* collection,
+                                                                          const char* attribute,
+                                                                          const quiver_filter_t* filter,
+                                                                          double** out_values,
+                                                                          size_t** out_offsets,
+                                                                          size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_strings_flat_filtered(quiver_database_t* db,
+                                                                           const char* collection,
+                                                                           const char* attribute,
+                                                                           const quiver_filter_t* filter,
+                                                                           char*** out_values,
+                                                                           size_t** out_offsets,
+                                                                           size_t* out_count);
+
+// Deletes the matching elements and their group rows in one transaction; an empty filter deletes them all
+QUIVER_C_API quiver_error_t quiver_database_delete_elements_where(quiver_database_t* db,
+                                                                  const char* collection,
+                                                                  const quiver_filter_t* filter,
+                                                                  size_t* out_deleted);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // QUIVER_C_FILTER_H
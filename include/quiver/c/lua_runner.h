@@ -22,8 +22,28 @@ QUIVER_C_API void quiver_lua_runner_free(quiver_lua_runner_t* runner);
 // If an error occurs, call quiver_lua_runner_get_error() to get the error message.
 QUIVER_C_API quiver_error_t quiver_lua_runner_run(quiver_lua_runner_t* runner, const char* script);
 
+// Compile a script once for repeated runs; name labels it in error messages.
+// *out_handle stays valid until quiver_lua_runner_release() or the runner is freed.
+QUIVER_C_API quiver_error_t quiver_lua_runner_compile(quiver_lua_runner_t* runner,
+                                                      const char* name,
+                                                      const char* script,
+                                                      size_t* out_handle);
+
+// Run a compiled script. The arguments reach the chunk as '...';
+// arg_types/arg_values follow the quiver_database_query_*_params convention (NULL type becomes nil).
+QUIVER_C_API quiver_error_t quiver_lua_runner_run_compiled(quiver_lua_runner_t* runner,
+                                                           size_t handle,
+                                                           const int* arg_types,
+                                                           const void* const* arg_values,
+                                                           size_t arg_count);
+
+// Release a compiled script; a later compile may reuse its handle.
+// Hosts that compile scripts dynamically should release them to keep the runner's memory bounded.
+QUIVER_C_API quiver_error_t quiver_lua_runner_release(quiver_lua_runner_t* runner, size_t handle);
+
 // Get the last error message (or NULL if no error).
-// The returned pointer is valid until the next call to quiver_lua_runner_run().
+// The returned pointer is valid until the next call to quiver_lua_runner_run(), _compile(), _run_compiled() or
+// _release().
 // Callers should copy the string if they need to retain it beyond that.
 QUIVER_C_API const char* quiver_lua_runner_get_error(quiver_lua_runner_t* runner);
 
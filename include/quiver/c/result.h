@@ -0,0 +1,48 @@
+#ifndef QUIVER_C_RESULT_H
+#define QUIVER_C_RESULT_H
+
+#include "database.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Opaque handle type: library-owned read result.
+// The buffers returned by the accessors stay valid until quiver_result_free, so bindings can
+// wrap them without copying. A result does not depend on its database staying open.
+typedef struct quiver_result quiver_result_t;
+
+// Read scalar attributes into a library-owned result
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_result(quiver_database_t* db,
+                                                                        const char* collection,
+                                                                        const char* attribute,
+                                                                        quiver_result_t** out_result);
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_result(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      quiver_result_t** out_result);
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_result(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* attribute,
+                                                                       quiver_result_t** out_result);
+
+QUIVER_C_API void quiver_result_free(quiver_result_t* result);
+
+// Result inspection; accessors fail with QUIVER_ERROR_INVALID_ARGUMENT when the type does not match
+QUIVER_C_API quiver_error_t quiver_result_type(quiver_result_t* result, quiver_data_type_t* out_type);
+QUIVER_C_API quiver_error_t quiver_result_count(quiver_result_t* result, size_t* out_count);
+// Grouped results (vector reads): group i holds values [offsets[i], offsets[i + 1]), *out_group_count + 1 offsets
+QUIVER_C_API quiver_error_t quiver_result_offsets(quiver_result_t* result,
+                                                 const size_t** out_offsets,
+                                                 size_t* out_group_count);
+QUIVER_C_API quiver_error_t quiver_result_integers(quiver_result_t* result, const int64_t** out_values);
+QUIVER_C_API quiver_error_t quiver_result_floats(quiver_result_t* result, const double** out_values);
+QUIVER_C_API quiver_error_t quiver_result_strings(quiver_result_t* result, const char* const** out_values);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // QUIVER_C_RESULT_H
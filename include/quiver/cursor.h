@@ -0,0 +1,61 @@
+#ifndef QUIVER_CURSOR_H
+#define QUIVER_CURSOR_H
+
+#include "export.h"
+#include "quiver/row.h"
+#include "quiver/value.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+struct sqlite3_stmt;
+
+namespace quiver {
+
+// Forward-only cursor over a live query. Rows are produced as the underlying statement is stepped,
+// so memory use does not grow with the size of the result. A cursor must not be used after its
+// Database is closed; destroying it afterwards is safe.
+class QUIVER_API Cursor {
+public:
+    ~Cursor();
+
+    // Non-copyable
+    Cursor(const Cursor&) = delete;
+    Cursor& operator=(const Cursor&) = delete;
+
+    // Movable
+    Cursor(Cursor&& other) noexcept;
+    Cursor& operator=(Cursor&& other) noexcept;
+
+    const std::vector<std::string>& columns() const;
+    size_t column_count() const;
+
+    // Advances to the next row; returns false once the result is exhausted
+    bool next();
+    bool done() const;
+
+    // Current row accessors (valid after next() returned true)
+    Value value(size_t column) const;
+    bool is_null(size_t column) const;
+    std::optional<int64_t> get_integer(size_t column) const;
+    std::optional<double> get_float(size_t column) const;
+    std::optional<std::string> get_string(size_t column) const;
+    std::optional<Blob> get_blob(size_t column) const;
+    Row row() const;
+
+    // Steps up to max_rows rows and returns them; an empty batch means the cursor is exhausted
+    std::vector<Row> fetch(size_t max_rows);
+
+private:
+    friend class Database;
+    explicit Cursor(sqlite3_stmt* stmt);
+
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_CURSOR_H
@@ -2,21 +2,214 @@
 #define QUIVER_DATABASE_H
 
 #include "export.h"
+#include "quiver/aggregates.h"
+#include "quiver/attribute_handle.h"
 #include "quiver/attribute_metadata.h"
+#include "quiver/cursor.h"
 #include "quiver/element.h"
+#include "quiver/filter.h"
+#include "quiver/flat_vectors.h"
+#include "quiver/id_index.h"
 #include "quiver/log_level.h"
+#include "quiver/nullable_column.h"
 #include "quiver/result.h"
-
+#include "quiver/scalar_columns.h"
+#include "quiver/schema_lint.h"
+#include "quiver/string_arena.h"
+#include "quiver/time_series.h"
+
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
 namespace quiver {
 
+class Schema;
+
+// Value types of the typed accessors: INTEGER, REAL and TEXT (including DATE_TIME) attributes
+template <typename T>
+concept AttributeValue = std::same_as<T, int64_t> || std::same_as<T, double> || std::same_as<T, std::string>;
+
+// PRAGMA journal_mode values; rollback is SQLite's default DELETE mode
+enum class JournalMode { rollback, truncate, wal, memory, off };
+
+// PRAGMA synchronous values; normal is durable in WAL mode and avoids an fsync per commit
+enum class SynchronousMode { off, normal, full, extra };
+
+// PRAGMA temp_store values
+enum class TempStore { file, memory };
+
 struct QUIVER_API DatabaseOptions {
     bool read_only = false;
     LogLevel console_level = LogLevel::info;
+    // quiver_database.log next to the database file; off skips creating the file
+    LogLevel file_level = LogLevel::debug;
+    // Format and write log lines on a shared background thread (bounded queue) instead of the calling thread
+    bool async_logging = false;
+    // Maximum number of prepared statements kept for reuse; 0 disables caching
+    size_t statement_cache_size = 128;
+
+    // SQLite tuning applied when the connection is opened; unset fields keep SQLite's defaults.
+    // In WAL mode readers on other connections no longer block the writer (and vice versa).
+    std::optional<JournalMode> journal_mode;
+    std::optional<SynchronousMode> synchronous;
+    std::optional<int64_t> cache_size;  // Positive: pages; negative: KiB (as PRAGMA cache_size)
+    std::optional<int64_t> mmap_size;   // Bytes of the file to memory-map; 0 disables
+    std::optional<TempStore> temp_store;
+    std::optional<int> page_size;  // Power of two in [512, 65536]; only affects a database without tables
+
+    // Read-only mode for large files shared by many processes: opens with immutable=1 and query_only, and maps
+    // the whole file (unless mmap_size is set) so pages come from the OS page cache instead of a private copy.
+    // The file must not be modified while any connection has it open this way.
+    bool mapped = false;
+
+    // Copy the file into a private in-memory database when opening, so every read and write runs at memory speed.
+    // The file stays the source of truth: changes reach it only through flush(). A missing file starts empty
+    // (unless read_only). Not combinable with mapped.
+    bool load_into_memory = false;
+
+    // Log which (collection, id, attribute) each write through this connection changes, for changes_since().
+    // Kept in TEMP triggers and a TEMP table, so other connections and the file are unaffected; costs an extra
+    // insert per changed attribute. Has no effect with read_only or mapped.
+    bool track_changes = false;
+
+    // Keep the results of read_scalar_*, read_vector_* and read_set_* (whole collection and by id) and answer
+    // repeats with a copy. A write to a table drops its entries at once; commits by other connections, DDL and
+    // rollbacks drop all of them at the next read.
+    bool cache_reads = false;
+
+    // Run SchemaValidator when the schema is loaded; turn off only for trusted, already-migrated files
+    bool validate_schema = true;
+
+    // Record call counts, latencies and rows per public operation and per SQL statement for stats()
+    bool collect_stats = false;
+
+    // Log every statement that runs at least this long as a warning, with its SQL (parameters expanded) and the
+    // public operation that ran it. Works in release builds; unset, no trace hook is installed.
+    std::optional<std::chrono::milliseconds> slow_query_threshold;
+
+    // How long a statement waits for a lock held by another connection before failing with "database is locked";
+    // unset fails immediately (SQLite's default)
+    std::optional<std::chrono::milliseconds> busy_timeout;
+
+    // Aborts a public operation (the query_* methods included) once it has run this long; its statement fails with
+    // an "interrupted" error and the operation's transaction is rolled back. Cursor steps made after the call returned
+    // are not bounded. Checked every few thousand VM instructions, so waits on locks are bounded by busy_timeout.
+    std::optional<std::chrono::milliseconds> statement_timeout;
+
+    // Bound on the bytes kept by cache_reads; a read that would pass it empties the cache first
+    std::optional<size_t> read_cache_limit;
+
+    // Process-wide limits on SQLite's heap (sqlite3_soft_heap_limit64 / sqlite3_hard_heap_limit64), set when the
+    // connection opens; they apply to every connection in the process and the last one opened wins. Past the soft
+    // limit SQLite frees cache pages before allocating; past the hard limit allocations fail with SQLITE_NOMEM.
+    std::optional<int64_t> soft_heap_limit;
+    std::optional<int64_t> hard_heap_limit;
+};
+
+struct QUIVER_API StatementCacheStats {
+    int64_t hits = 0;
+    int64_t misses = 0;
+    size_t size = 0;
+    size_t capacity = 0;
+};
+
+// Counters for one public Database method; nested calls are also counted in the caller
+struct QUIVER_API OperationStats {
+    std::string name;
+    int64_t calls = 0;
+    int64_t total_ns = 0;
+    int64_t max_ns = 0;
+    int64_t rows_read = 0;     // Result rows stepped by its statements
+    int64_t rows_written = 0;  // Rows inserted, updated or deleted
+};
+
+// Counters for one SQL text; execution time runs from the first step until the statement is done or reset
+struct QUIVER_API StatementStats {
+    std::string sql;
+    int64_t prepares = 0;
+    int64_t prepare_ns = 0;
+    int64_t executions = 0;
+    int64_t total_ns = 0;
+    int64_t max_ns = 0;
+    int64_t rows_read = 0;
+    int64_t rows_written = 0;
+};
+
+// Both lists are sorted by total time, slowest first, and stay empty unless DatabaseOptions::collect_stats is set
+struct QUIVER_API DatabaseStats {
+    std::vector<OperationStats> operations;
+    std::vector<StatementStats> statements;
+    StatementCacheStats statement_cache;
+};
+
+// Bytes held by one connection, from sqlite3_db_status and quiver's own caches (estimates), plus SQLite's
+// process-wide heap. Results handed to callers are theirs and not counted.
+struct QUIVER_API MemoryUsage {
+    int64_t page_cache = 0;     // SQLITE_DBSTATUS_CACHE_USED
+    int64_t sqlite_schema = 0;  // SQLITE_DBSTATUS_SCHEMA_USED
+    int64_t statements = 0;     // SQLITE_DBSTATUS_STMT_USED, prepared statements incl. the statement cache
+    int64_t schema = 0;         // quiver's parsed schema, shared with sibling connections
+    int64_t read_cache = 0;     // DatabaseOptions::cache_reads results
+    int64_t label_cache = 0;    // Label -> id maps used to resolve foreign key labels
+
+    int64_t cache_hits = 0;
+    int64_t cache_misses = 0;
+    int64_t cache_writes = 0;
+    int64_t cache_spills = 0;
+
+    // Process-wide: sqlite3_memory_used, its highwater mark and the soft heap limit (0 = none)
+    int64_t sqlite_heap = 0;
+    int64_t sqlite_heap_highwater = 0;
+    int64_t soft_heap_limit = 0;
+
+    // Sum of the per-connection byte counts
+    int64_t total() const { return page_cache + sqlite_schema + statements + schema + read_cache + label_cache; }
+};
+
+enum class ChangeKind { created, updated, deleted };
+
+// One entry of Database::changes_since
+struct QUIVER_API Change {
+    std::string collection;
+    int64_t id = 0;
+    std::string attribute;  // Empty when the element itself was created or deleted
+    ChangeKind kind = ChangeKind::updated;
+};
+
+struct QUIVER_API ChangeSet {
+    int64_t token = 0;  // Pass to the next changes_since call
+    std::vector<Change> changes;
+};
+
+// One migration run by Database::migrate_up
+struct QUIVER_API MigrationResult {
+    int64_t version = 0;
+    size_t statements = 0;  // Statements of its up.sql
+    int64_t elapsed_ns = 0;
+};
+
+struct QUIVER_API MigrateOptions {
+    // Run the pending migrations, then roll all of them back: checks them against this file's data and reports
+    // what they would cost, leaving the file and its version unchanged
+    bool dry_run = false;
+    // Called after each migration, for progress reporting
+    std::function<void(const MigrationResult&)> on_migration;
+};
+
+struct QUIVER_API BackupOptions {
+    // Pages copied per sqlite3_backup_step; between steps other connections may read and write the source.
+    // 0 or less copies everything in one step.
+    int pages_per_step = 256;
+    // Called after each step with the pages still to copy and the source's total
+    std::function<void(int remaining, int total)> on_progress;
 };
 
 class QUIVER_API Database {
@@ -39,28 +232,190 @@ public:
     static Database from_schema(const std::string& db_path,
                                 const std::string& schema_path,
                                 const DatabaseOptions& options = DatabaseOptions());
+
+    // Loads the database file at path into a private in-memory database, for scenarios that mutate a copy;
+    // write it back (or elsewhere) with backup_to. read_only and mapped in options are ignored.
+    static Database from_snapshot(const std::string& path, const DatabaseOptions& options = DatabaseOptions());
+
+    // Copies this database into the file at path (replacing its contents) with sqlite3_backup, without closing
+    // this connection. Changes made through this connection during the copy are included; a write from another
+    // connection restarts it.
+    void backup_to(const std::string& path, const BackupOptions& options = {}) const;
+
+    // Copies this database into a new in-memory database with the same options and schema
+    Database clone_in_memory() const;
+
+    // With DatabaseOptions::load_into_memory, writes the in-memory copy back over the file (see backup_to);
+    // otherwise changes are already in the file and this does nothing. Not allowed inside a transaction.
+    void flush();
+
+    // Change log (DatabaseOptions::track_changes; these throw when it is off). Tokens only grow and belong to this
+    // connection; rolled-back writes leave no entries. changes_since returns each (collection, id, attribute)
+    // changed after token once, with its latest kind, in order of that change; the attributes of a deleted element
+    // are reported too. discard_changes forgets the entries up to and including token.
+    int64_t change_token() const;
+    ChangeSet changes_since(int64_t token) const;
+    void discard_changes(int64_t token);
+
     bool is_healthy() const;
 
+    // Aborts the statement running on this connection (it fails with an "interrupted" error).
+    // Safe to call from any thread while the Database is open.
+    void interrupt();
+
+    // Per-connection overrides of DatabaseOptions::busy_timeout and statement_timeout for the calls that follow;
+    // nullopt removes the limit
+    void set_busy_timeout(std::optional<std::chrono::milliseconds> timeout);
+    void set_statement_timeout(std::optional<std::chrono::milliseconds> timeout);
+    std::optional<std::chrono::milliseconds> statement_timeout() const;
+
+    // Called every few thousand VM instructions while a statement runs, on the thread running it; returning false
+    // aborts the statement like interrupt(). An empty function removes the handler.
+    void set_progress_handler(std::function<bool()> handler);
+
     int64_t current_version() const;
 
+    // Applies the migrations above current_version() in one exclusive transaction, each up.sql one statement at a
+    // time with foreign key checks deferred to the commit; a failure rolls back the whole set. Per-statement times
+    // are logged at debug level (and land in stats() with collect_stats). Returns the migrations applied.
+    std::vector<MigrationResult> migrate_up(const std::string& migrations_path, const MigrateOptions& options = {});
+
+    // Prepared statement cache counters
+    StatementCacheStats statement_cache_stats() const;
+
+    // Per-operation and per-statement counters (see DatabaseOptions::collect_stats)
+    DatabaseStats stats() const;
+    void reset_stats();
+
+    MemoryUsage memory_usage() const;
+    // Frees what this connection can rebuild on demand: unused page cache, prepared statements that are not in use,
+    // cached reads and labels. Returns the bytes released by the per-connection counts of memory_usage().
+    int64_t shrink_memory();
+
+    // Explicit transactions. Calls nest: an inner begin_transaction opens a SAVEPOINT,
+    // and commit/rollback always close the innermost level.
+    void begin_transaction();
+    void commit();
+    void rollback();
+    bool in_transaction() const;
+
+    // Runs fn inside a transaction; commits on return, rolls back if fn throws
+    void transaction(const std::function<void()>& fn);
+
+    // RAII transaction scope: rolls back on destruction unless committed
+    class QUIVER_API Transaction {
+    public:
+        explicit Transaction(Database& db);
+        ~Transaction();
+
+        Transaction(const Transaction&) = delete;
+        Transaction& operator=(const Transaction&) = delete;
+
+        void commit();
+        void rollback();
+
+    private:
+        Database& db_;
+        bool active_ = true;
+    };
+
     // Element operations
     int64_t create_element(const std::string& collection, const Element& element);
+    // Creates all elements in a single transaction; returns their ids in input order
+    std::vector<int64_t> create_elements(const std::string& collection, std::span<const Element> elements);
     void update_element(const std::string& collection, int64_t id, const Element& element);
+    // Creates the element, or updates the one with the same label, in one INSERT ... ON CONFLICT(label) statement;
+    // returns its id. Scalars the element carries overwrite the stored ones and each vector/set group it carries
+    // replaces the stored rows; anything it leaves out is kept.
+    int64_t upsert_element(const std::string& collection, const Element& element);
+    // Upserts all elements in a single transaction; returns their ids in input order
+    std::vector<int64_t> upsert_elements(const std::string& collection, std::span<const Element> elements);
     void delete_element_by_id(const std::string& collection, int64_t id);
+    // Bulk deletes in a single transaction, group rows first; return the number of elements deleted (unknown ids
+    // are skipped). An empty filter deletes every element of the collection.
+    size_t delete_elements_by_ids(const std::string& collection, std::span<const int64_t> ids);
+    size_t delete_elements_where(const std::string& collection, const Filter& filter);
 
     // Relation operations
     void set_scalar_relation(const std::string& collection,
                              const std::string& attribute,
                              const std::string& from_label,
                              const std::string& to_label);
+    // Sets from_labels[i] -> to_labels[i] for every pair in one transaction; throws before writing anything
+    // if a target label does not exist
+    void set_scalar_relations(const std::string& collection,
+                              const std::string& attribute,
+                              const std::vector<std::string>& from_labels,
+                              const std::vector<std::string>& to_labels);
 
     std::vector<std::string> read_scalar_relation(const std::string& collection, const std::string& attribute);
+    // Target ids instead of labels, one per element in the same order; unset relations read as 0
+    std::vector<int64_t> read_scalar_relation_ids(const std::string& collection, const std::string& attribute);
+
+    // Typed accessors behind the *_integers/_floats/_strings families below, which forward to them.
+    // Values are copied straight from the statement into T; a stored value of another type reads as null.
+    template <AttributeValue T>
+    std::vector<T> read_scalar(const std::string& collection, const std::string& attribute);
+    template <AttributeValue T>
+    std::optional<T> read_scalar_by_id(const std::string& collection, const std::string& attribute, int64_t id);
+    template <AttributeValue T>
+    std::vector<std::vector<T>> read_vector(const std::string& collection, const std::string& attribute);
+    template <AttributeValue T>
+    std::vector<T> read_vector_by_id(const std::string& collection, const std::string& attribute, int64_t id);
+    template <AttributeValue T>
+    std::vector<std::vector<T>> read_set(const std::string& collection, const std::string& attribute);
+    template <AttributeValue T>
+    std::vector<T> read_set_by_id(const std::string& collection, const std::string& attribute, int64_t id);
+    template <AttributeValue T>
+    void update_scalar(const std::string& collection, const std::string& attribute, int64_t id, const T& value);
+    template <AttributeValue T>
+    void update_vector(const std::string& collection,
+                       const std::string& attribute,
+                       int64_t id,
+                       const std::vector<T>& values);
+    template <AttributeValue T>
+    void update_set(const std::string& collection,
+                    const std::string& attribute,
+                    int64_t id,
+                    const std::vector<T>& values);
 
     // Read scalar attributes (all elements)
     std::vector<int64_t> read_scalar_integers(const std::string& collection, const std::string& attribute);
     std::vector<double> read_scalar_floats(const std::string& collection, const std::string& attribute);
     std::vector<std::string> read_scalar_strings(const std::string& collection, const std::string& attribute);
 
+    // Same, restricted to the elements matching filter (see Filter); every bulk reader below has such an overload
+    std::vector<int64_t>
+    read_scalar_integers(const std::string& collection, const std::string& attribute, const Filter& filter);
+    std::vector<double>
+    read_scalar_floats(const std::string& collection, const std::string& attribute, const Filter& filter);
+    std::vector<std::string>
+    read_scalar_strings(const std::string& collection, const std::string& attribute, const Filter& filter);
+
+    // Read scalar attributes (all elements), keeping nulls: one entry per element in read_element_ids order
+    NullableColumn<int64_t> read_scalar_integers_nullable(const std::string& collection, const std::string& attribute);
+    NullableColumn<double> read_scalar_floats_nullable(const std::string& collection, const std::string& attribute);
+    NullableColumn<std::string> read_scalar_strings_nullable(const std::string& collection,
+                                                             const std::string& attribute);
+    // One entry per element of read_element_ids(collection, filter)
+    NullableColumn<int64_t>
+    read_scalar_integers_nullable(const std::string& collection, const std::string& attribute, const Filter& filter);
+    NullableColumn<double>
+    read_scalar_floats_nullable(const std::string& collection, const std::string& attribute, const Filter& filter);
+    NullableColumn<std::string>
+    read_scalar_strings_nullable(const std::string& collection, const std::string& attribute, const Filter& filter);
+
+    // Reads several scalar attributes with one query, aligned by element id in read_element_ids order
+    ScalarColumns read_scalars(const std::string& collection, const std::vector<std::string>& attributes);
+
+    // Read scalar attributes (all elements) into a caller-provided buffer.
+    // Writes at most out.size() values and returns the total number of values available;
+    // count_scalar_values() returns that total up front so the buffer can be sized exactly.
+    size_t count_scalar_values(const std::string& collection, const std::string& attribute);
+    size_t
+    read_scalar_integers_into(const std::string& collection, const std::string& attribute, std::span<int64_t> out);
+    size_t read_scalar_floats_into(const std::string& collection, const std::string& attribute, std::span<double> out);
+
     // Read scalar attributes (by element ID)
     std::optional<int64_t>
     read_scalar_integers_by_id(const std::string& collection, const std::string& attribute, int64_t id);
@@ -69,11 +424,49 @@ public:
     std::optional<std::string>
     read_scalar_strings_by_id(const std::string& collection, const std::string& attribute, int64_t id);
 
+    // Read scalar attributes (batch of element IDs) with one query per chunk of ids.
+    // One entry per id in input order; invalid where the id does not exist or the value is null.
+    NullableColumn<int64_t> read_scalar_integers_by_ids(const std::string& collection,
+                                                        const std::string& attribute,
+                                                        std::span<const int64_t> ids);
+    NullableColumn<double> read_scalar_floats_by_ids(const std::string& collection,
+                                                     const std::string& attribute,
+                                                     std::span<const int64_t> ids);
+    NullableColumn<std::string> read_scalar_strings_by_ids(const std::string& collection,
+                                                           const std::string& attribute,
+                                                           std::span<const int64_t> ids);
+
     // Read vector attributes (all elements)
     std::vector<std::vector<int64_t>> read_vector_integers(const std::string& collection, const std::string& attribute);
     std::vector<std::vector<double>> read_vector_floats(const std::string& collection, const std::string& attribute);
     std::vector<std::vector<std::string>> read_vector_strings(const std::string& collection,
                                                               const std::string& attribute);
+    std::vector<std::vector<int64_t>>
+    read_vector_integers(const std::string& collection, const std::string& attribute, const Filter& filter);
+    std::vector<std::vector<double>>
+    read_vector_floats(const std::string& collection, const std::string& attribute, const Filter& filter);
+    std::vector<std::vector<std::string>>
+    read_vector_strings(const std::string& collection, const std::string& attribute, const Filter& filter);
+
+    // Read vector attributes (all elements) into one contiguous buffer plus offsets
+    FlatVectors<int64_t> read_vector_integers_flat(const std::string& collection, const std::string& attribute);
+    FlatVectors<double> read_vector_floats_flat(const std::string& collection, const std::string& attribute);
+    FlatVectors<std::string> read_vector_strings_flat(const std::string& collection, const std::string& attribute);
+    FlatVectors<int64_t>
+    read_vector_integers_flat(const std::string& collection, const std::string& attribute, const Filter& filter);
+    FlatVectors<double>
+    read_vector_floats_flat(const std::string& collection, const std::string& attribute, const Filter& filter);
+    FlatVectors<std::string>
+    read_vector_strings_flat(const std::string& collection, const std::string& attribute, const Filter& filter);
+
+    // Same, but aligned with index (see read_id_index): group i belongs to index[i] and is empty when that element
+    // has no values. Elements created after the index was read are left out.
+    FlatVectors<int64_t>
+    read_vector_integers_flat(const std::string& collection, const std::string& attribute, const IdIndex& index);
+    FlatVectors<double>
+    read_vector_floats_flat(const std::string& collection, const std::string& attribute, const IdIndex& index);
+    FlatVectors<std::string>
+    read_vector_strings_flat(const std::string& collection, const std::string& attribute, const IdIndex& index);
 
     // Read vector attributes (by element ID)
     std::vector<int64_t>
@@ -83,10 +476,63 @@ public:
     std::vector<std::string>
     read_vector_strings_by_id(const std::string& collection, const std::string& attribute, int64_t id);
 
+    // Read entries [first, first + count) (0-based) of one element's float vector, clipped to its length.
+    // On a packed vector table only those bytes are read, through incremental BLOB I/O.
+    std::vector<double> read_vector_floats_range(
+        const std::string& collection, const std::string& attribute, int64_t id, int64_t first, int64_t count);
+
+    // Read vector attributes (batch of element IDs): group i belongs to ids[i], empty when it has no values
+    FlatVectors<int64_t> read_vector_integers_by_ids(const std::string& collection,
+                                                     const std::string& attribute,
+                                                     std::span<const int64_t> ids);
+    FlatVectors<double> read_vector_floats_by_ids(const std::string& collection,
+                                                  const std::string& attribute,
+                                                  std::span<const int64_t> ids);
+    FlatVectors<std::string> read_vector_strings_by_ids(const std::string& collection,
+                                                        const std::string& attribute,
+                                                        std::span<const int64_t> ids);
+
     // Read set attributes (all elements)
     std::vector<std::vector<int64_t>> read_set_integers(const std::string& collection, const std::string& attribute);
     std::vector<std::vector<double>> read_set_floats(const std::string& collection, const std::string& attribute);
     std::vector<std::vector<std::string>> read_set_strings(const std::string& collection, const std::string& attribute);
+    std::vector<std::vector<int64_t>>
+    read_set_integers(const std::string& collection, const std::string& attribute, const Filter& filter);
+    std::vector<std::vector<double>>
+    read_set_floats(const std::string& collection, const std::string& attribute, const Filter& filter);
+    std::vector<std::vector<std::string>>
+    read_set_strings(const std::string& collection, const std::string& attribute, const Filter& filter);
+
+    // Read set attributes (all elements) into one contiguous buffer plus offsets
+    FlatVectors<int64_t> read_set_integers_flat(const std::string& collection, const std::string& attribute);
+    FlatVectors<double> read_set_floats_flat(const std::string& collection, const std::string& attribute);
+    FlatVectors<std::string> read_set_strings_flat(const std::string& collection, const std::string& attribute);
+    FlatVectors<int64_t>
+    read_set_integers_flat(const std::string& collection, const std::string& attribute, const Filter& filter);
+    FlatVectors<double>
+    read_set_floats_flat(const std::string& collection, const std::string& attribute, const Filter& filter);
+    FlatVectors<std::string>
+    read_set_strings_flat(const std::string& collection, const std::string& attribute, const Filter& filter);
+
+    // Aligned with index, as the vector overloads
+    FlatVectors<int64_t>
+    read_set_integers_flat(const std::string& collection, const std::string& attribute, const IdIndex& index);
+    FlatVectors<double>
+    read_set_floats_flat(const std::string& collection, const std::string& attribute, const IdIndex& index);
+    FlatVectors<std::string>
+    read_set_strings_flat(const std::string& collection, const std::string& attribute, const IdIndex& index);
+
+    // String reads into one StringArena instead of a std::string per value, with the rows of read_scalar_strings,
+    // read_scalar_relation (unset relations as empty labels) and read_vector/set_strings_flat. intern stores each
+    // distinct value once, for repetitive columns such as set tags and relation labels.
+    StringArena
+    read_scalar_strings_arena(const std::string& collection, const std::string& attribute, bool intern = false);
+    StringArena
+    read_scalar_relation_arena(const std::string& collection, const std::string& attribute, bool intern = false);
+    FlatStrings
+    read_vector_strings_arena(const std::string& collection, const std::string& attribute, bool intern = false);
+    FlatStrings
+    read_set_strings_arena(const std::string& collection, const std::string& attribute, bool intern = false);
 
     // Read set attributes (by element ID)
     std::vector<int64_t>
@@ -95,8 +541,47 @@ public:
     std::vector<std::string>
     read_set_strings_by_id(const std::string& collection, const std::string& attribute, int64_t id);
 
+    // Read set attributes (batch of element IDs): group i belongs to ids[i], empty when it has no values
+    FlatVectors<int64_t> read_set_integers_by_ids(const std::string& collection,
+                                                  const std::string& attribute,
+                                                  std::span<const int64_t> ids);
+    FlatVectors<double> read_set_floats_by_ids(const std::string& collection,
+                                               const std::string& attribute,
+                                               std::span<const int64_t> ids);
+    FlatVectors<std::string> read_set_strings_by_ids(const std::string& collection,
+                                                     const std::string& attribute,
+                                                     std::span<const int64_t> ids);
+
+    // Read a time series value column (by element ID), optionally restricted to
+    // date_time_from <= date_time <= date_time_to; scans the (id, date_time) primary key.
+    // Compressed tables decode only the chunks overlapping the range and return "YYYY-MM-DD HH:MM:SS" date_times.
+    TimeSeries<double> read_time_series_floats(const std::string& collection,
+                                               const std::string& attribute,
+                                               int64_t id,
+                                               const std::optional<std::string>& date_time_from = std::nullopt,
+                                               const std::optional<std::string>& date_time_to = std::nullopt);
+
+    // Per-element statistics computed by SQLite with GROUP BY, without reading the rows: aggregate_vector gives one
+    // row per element in read_element_ids order, aggregate_time_series one per element and non-empty bucket, in
+    // (id, bucket) order. The attribute must hold integers or floats.
+    Aggregates aggregate_vector(const std::string& collection,
+                                const std::string& attribute,
+                                const std::vector<Aggregate>& statistics);
+    Aggregates aggregate_time_series(const std::string& collection,
+                                     const std::string& attribute,
+                                     TimeBucket bucket,
+                                     const std::vector<Aggregate>& statistics);
+
+    // Whole elements as create_element takes them: every scalar (nulls as set_null) and every non-empty vector and
+    // set column, read with one statement per table. Throws for ids not in the collection; time series are left out.
+    Element read_element(const std::string& collection, int64_t id);
+    std::vector<Element> read_elements(const std::string& collection, std::span<const int64_t> ids);
+
     // Read element IDs
     std::vector<int64_t> read_element_ids(const std::string& collection);
+    std::vector<int64_t> read_element_ids(const std::string& collection, const Filter& filter);
+    // The same ids with an id -> position lookup, for joining bulk reads (which share this order) by position
+    IdIndex read_id_index(const std::string& collection);
 
     // Attribute metadata queries
     ScalarMetadata get_scalar_metadata(const std::string& collection, const std::string& attribute) const;
@@ -108,6 +593,21 @@ public:
     std::vector<VectorMetadata> list_vector_groups(const std::string& collection) const;
     std::vector<SetMetadata> list_set_groups(const std::string& collection) const;
 
+    // Resolve a scalar or vector attribute once for repeated access; throws if it does not exist.
+    // The overloads below only check that the handle's structure and type match the call.
+    AttributeHandle attribute_handle(const std::string& collection, const std::string& attribute) const;
+    std::vector<int64_t> read_scalar_integers(const AttributeHandle& attribute);
+    std::vector<double> read_scalar_floats(const AttributeHandle& attribute);
+    std::vector<std::string> read_scalar_strings(const AttributeHandle& attribute);
+    std::optional<int64_t> read_scalar_integers_by_id(const AttributeHandle& attribute, int64_t id);
+    std::optional<double> read_scalar_floats_by_id(const AttributeHandle& attribute, int64_t id);
+    std::optional<std::string> read_scalar_strings_by_id(const AttributeHandle& attribute, int64_t id);
+    std::vector<int64_t> read_vector_integers_by_id(const AttributeHandle& attribute, int64_t id);
+    std::vector<double> read_vector_floats_by_id(const AttributeHandle& attribute, int64_t id);
+    void update_scalar_integer(const AttributeHandle& attribute, int64_t id, int64_t value);
+    void update_scalar_float(const AttributeHandle& attribute, int64_t id, double value);
+    void update_scalar_string(const AttributeHandle& attribute, int64_t id, const std::string& value);
+
     // Update scalar attributes (by element ID)
     void update_scalar_integer(const std::string& collection, const std::string& attribute, int64_t id, int64_t value);
     void update_scalar_float(const std::string& collection, const std::string& attribute, int64_t id, double value);
@@ -116,7 +616,23 @@ public:
                               int64_t id,
                               const std::string& value);
 
-    // Update vector attributes (by element ID) - replaces entire vector
+    // Update one scalar attribute for many elements: values[i] is written to element ids[i].
+    // The type is checked once and all rows are written in a single transaction.
+    void update_scalar_integers(const std::string& collection,
+                                const std::string& attribute,
+                                std::span<const int64_t> ids,
+                                std::span<const int64_t> values);
+    void update_scalar_floats(const std::string& collection,
+                              const std::string& attribute,
+                              std::span<const int64_t> ids,
+                              std::span<const double> values);
+    void update_scalar_strings(const std::string& collection,
+                               const std::string& attribute,
+                               std::span<const int64_t> ids,
+                               std::span<const std::string> values);
+
+    // Update vector attributes (by element ID) - replaces entire vector.
+    // Only entries that differ from the stored vector are written.
     void update_vector_integers(const std::string& collection,
                                 const std::string& attribute,
                                 int64_t id,
@@ -130,7 +646,33 @@ public:
                                int64_t id,
                                const std::vector<std::string>& values);
 
-    // Update set attributes (by element ID) - replaces entire set
+    // Append to vector attributes (by element ID), after the last stored entry
+    void append_vector_integers(const std::string& collection,
+                                const std::string& attribute,
+                                int64_t id,
+                                const std::vector<int64_t>& values);
+    void append_vector_floats(const std::string& collection,
+                              const std::string& attribute,
+                              int64_t id,
+                              const std::vector<double>& values);
+    void append_vector_strings(const std::string& collection,
+                               const std::string& attribute,
+                               int64_t id,
+                               const std::vector<std::string>& values);
+
+    // Update one vector entry (by element ID and 0-based index); throws if the entry does not exist
+    void update_vector_integer_entry(
+        const std::string& collection, const std::string& attribute, int64_t id, int64_t index, int64_t value);
+    void update_vector_float_entry(
+        const std::string& collection, const std::string& attribute, int64_t id, int64_t index, double value);
+    void update_vector_string_entry(const std::string& collection,
+                                    const std::string& attribute,
+                                    int64_t id,
+                                    int64_t index,
+                                    const std::string& value);
+
+    // Update set attributes (by element ID) - replaces entire set.
+    // Only values added or removed relative to the stored set are written.
     void update_set_integers(const std::string& collection,
                              const std::string& attribute,
                              int64_t id,
@@ -144,24 +686,70 @@ public:
                             int64_t id,
                             const std::vector<std::string>& values);
 
+    // Update time series attributes (by element ID) - replaces the element's rows in the group.
+    // NaN values are stored as NULL (kept as NaN in compressed chunks, whose date_times must parse as timestamps).
+    void update_time_series_floats(const std::string& collection,
+                                   const std::string& attribute,
+                                   int64_t id,
+                                   const std::vector<std::string>& date_times,
+                                   const std::vector<double>& values);
+
     const std::string& path() const;
 
     // Schema inspection
     void describe() const;
 
+    // Indexes the schema lacks for quiver's own lookups (SchemaValidator::missing_indexes); each is also logged as
+    // a warning when the schema is loaded with validate_schema on
+    std::vector<MissingIndex> missing_indexes() const;
+    // Creates them as quiver_index_<table>_<columns> in one transaction; returns how many were created
+    size_t create_missing_indexes();
+    // Diagnostic: how SQLite plans each collection's label lookup, by-id group reads and foreign key searches
+    std::vector<QueryPlanCheck> check_query_plans();
+
     // CSV operations
     void export_to_csv(const std::string& table, const std::string& path);
     void import_from_csv(const std::string& table, const std::string& path);
 
+    // Columnar file operations (Arrow IPC file format, also known as Feather V2). The collection table and each of
+    // its vector, set and time series tables go to <directory>/<table>.arrow, with INTEGER, REAL and TEXT/DATE_TIME
+    // columns as Int64, Float64 and Utf8. import_collection reads files with matching column names in one
+    // transaction; a missing group file leaves that group empty.
+    void export_collection(const std::string& collection, const std::string& directory);
+    void import_collection(const std::string& collection, const std::string& directory);
+
     // Query methods - execute SQL and return first row's first column
     std::optional<std::string> query_string(const std::string& sql, const std::vector<Value>& params = {});
     std::optional<int64_t> query_integer(const std::string& sql, const std::vector<Value>& params = {});
     std::optional<double> query_float(const std::string& sql, const std::vector<Value>& params = {});
 
+    // Streaming query: rows are stepped on demand instead of materialized up front
+    Cursor cursor(const std::string& sql, const std::vector<Value>& params = {});
+
+    // Streaming reads of one collection. Scalars yield (id, attributes...) per element in read_element_ids order;
+    // a vector yields (id, vector_index, attribute) per value, ordered by id then vector_index.
+    Cursor cursor_scalars(const std::string& collection, const std::vector<std::string>& attributes);
+    Cursor cursor_vector(const std::string& collection, const std::string& attribute);
+
 private:
     struct Impl;
     std::unique_ptr<Impl> impl_;
 
+    friend class DatabasePool;
+    friend class DatabaseSet;
+    friend class StudyGenerator;
+    explicit Database(std::unique_ptr<Impl> impl);
+
+    // The loaded schema; throws when none is loaded
+    const Schema& schema() const;
+
+    // Loads the schema from the database unless one is loaded (files with identical DDL share it via SchemaCache)
+    void load_schema_if_needed();
+
+    // Opens another connection to the same file that shares this one's schema, type validator and logger.
+    // Loads the schema from the database first if none is loaded yet.
+    Database open_sibling(const DatabaseOptions& options);
+
     // Internal helper for executing raw SQL (for migrations)
     void execute_raw(const std::string& sql);
 
@@ -170,11 +758,10 @@ private:
 
     // Internal methods
     void set_version(int64_t version);
-    void migrate_up(const std::string& migration_path);
     void apply_schema(const std::string& schema_path);
-    void begin_transaction();
-    void commit();
-    void rollback();
+    int64_t insert_element(const std::string& collection, const Element& element);
+    void insert_element_arrays(const std::string& collection, int64_t element_id, const Element& element);
+    int64_t upsert_row(const std::string& collection, const Element& element);
 };
 
 }  // namespace quiver
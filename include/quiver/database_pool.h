@@ -0,0 +1,84 @@
+#ifndef QUIVER_DATABASE_POOL_H
+#define QUIVER_DATABASE_POOL_H
+
+#include "database.h"
+#include "export.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace quiver {
+
+struct QUIVER_API DatabasePoolOptions {
+    // Number of read-only connections; must be at least 1
+    size_t readers = 4;
+    // Applied to the writer; readers get the same options with read_only set.
+    // journal_mode defaults to WAL so readers and the writer do not block each other.
+    DatabaseOptions options;
+};
+
+// One writer and N read-only connections to the same database file, for use from several threads.
+// All connections share the writer's Schema and TypeValidator, so opening a reader skips the schema load.
+// Each connection is used by one thread at a time: leases hand out a connection exclusively and
+// block while none is free. The pool must outlive every lease.
+// The schema is loaded once when the pool opens; schema changes made through the writer are not seen by readers.
+class QUIVER_API DatabasePool {
+    struct Impl;
+
+public:
+    class QUIVER_API Lease {
+    public:
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&&) = delete;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        ~Lease();
+
+        Database& operator*() const { return *database_; }
+        Database* operator->() const { return database_; }
+
+    private:
+        friend class DatabasePool;
+        Lease(Impl* pool, Database* database, size_t reader);
+
+        Impl* pool_;
+        Database* database_;
+        size_t reader_;  // Index into the readers, or npos for the writer
+    };
+
+    // Opens the writer and the readers on an existing database file that already holds a schema
+    explicit DatabasePool(const std::string& path, const DatabasePoolOptions& options = DatabasePoolOptions());
+    ~DatabasePool();
+
+    DatabasePool(const DatabasePool&) = delete;
+    DatabasePool& operator=(const DatabasePool&) = delete;
+
+    // Blocks until a reader (or the writer) is free
+    Lease reader();
+    Lease writer();
+
+    // Runs fn(Database&) on a leased connection and returns its result
+    template <typename Fn>
+    std::invoke_result_t<Fn, Database&> read(Fn&& fn) {
+        auto lease = reader();
+        return fn(*lease);
+    }
+
+    template <typename Fn>
+    std::invoke_result_t<Fn, Database&> write(Fn&& fn) {
+        auto lease = writer();
+        return fn(*lease);
+    }
+
+    size_t reader_count() const;
+    size_t idle_readers() const;
+
+private:
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_DATABASE_POOL_H
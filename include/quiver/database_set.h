@@ -0,0 +1,72 @@
+#ifndef QUIVER_DATABASE_SET_H
+#define QUIVER_DATABASE_SET_H
+
+#include "database.h"
+#include "export.h"
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace quiver {
+
+struct QUIVER_API DatabaseSetOptions {
+    // Worker threads for opening and querying the files; 0 uses one per core. Never more than the number of files.
+    size_t threads = 0;
+    // Applied to every file, with read_only always set
+    DatabaseOptions options;
+};
+
+// Read-only connections to many database files (e.g. one per study case), for running the same read against all of
+// them in parallel. Files are opened on the worker threads, and files with identical DDL share one Schema and
+// TypeValidator through the schema cache. During for_each/map each connection is used by one worker only, so fn must
+// not reach into the other files' Databases.
+class QUIVER_API DatabaseSet {
+public:
+    explicit DatabaseSet(const std::vector<std::string>& paths,
+                         const DatabaseSetOptions& options = DatabaseSetOptions());
+    ~DatabaseSet();
+
+    DatabaseSet(const DatabaseSet&) = delete;
+    DatabaseSet& operator=(const DatabaseSet&) = delete;
+    DatabaseSet(DatabaseSet&&) noexcept;
+    DatabaseSet& operator=(DatabaseSet&&) noexcept;
+
+    size_t size() const;
+    const std::vector<std::string>& paths() const;
+    Database& at(const std::string& path);
+
+    // Runs fn(path, db) for every file on the worker threads. Once a call throws, files not yet started are skipped
+    // and the first exception is rethrown after the running calls finish.
+    void for_each(const std::function<void(const std::string&, Database&)>& fn);
+
+    // Runs fn(db) for every file in parallel and returns the results keyed by path, e.g.
+    //   set.map([](Database& db) { return db.read_scalar_floats("Plant", "capacity"); })
+    template <typename Fn>
+    std::map<std::string, std::invoke_result_t<Fn, Database&>> map(Fn&& fn) {
+        using Result = std::invoke_result_t<Fn, Database&>;
+        std::vector<std::optional<Result>> results(size());
+        for_each_index([&](size_t index, Database& db) { results[index].emplace(fn(db)); });
+
+        std::map<std::string, Result> keyed;
+        for (size_t i = 0; i < results.size(); ++i) {
+            keyed.emplace(paths()[i], std::move(*results[i]));
+        }
+        return keyed;
+    }
+
+private:
+    void for_each_index(const std::function<void(size_t, Database&)>& fn);
+
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_DATABASE_SET_H
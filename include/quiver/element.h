@@ -5,6 +5,7 @@
 #include "value.h"
 
 #include <map>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -20,14 +21,18 @@ public:
     Element& set(const std::string& name, const std::string& value);
     Element& set_null(const std::string& name);
 
-    // Arrays - stored generically, Database::create_element routes to vector/set tables
-    Element& set(const std::string& name, const std::vector<int64_t>& values);
-    Element& set(const std::string& name, const std::vector<double>& values);
-    Element& set(const std::string& name, const std::vector<std::string>& values);
+    // Arrays - kept as typed vectors, Database::create_element routes to vector/set tables.
+    // Vectors are taken by value, so passing an rvalue moves the buffer in without copying.
+    Element& set(const std::string& name, std::vector<int64_t> values);
+    Element& set(const std::string& name, std::vector<double> values);
+    Element& set(const std::string& name, std::vector<std::string> values);
+    Element& set(const std::string& name, std::span<const int64_t> values);
+    Element& set(const std::string& name, std::span<const double> values);
+    Element& set(const std::string& name, std::span<const std::string> values);
 
     // Accessors
     const std::map<std::string, Value>& scalars() const;
-    const std::map<std::string, std::vector<Value>>& arrays() const;
+    const std::map<std::string, ArrayValues>& arrays() const;
 
     bool has_scalars() const;
     bool has_arrays() const;
@@ -39,7 +44,7 @@ public:
 
 private:
     std::map<std::string, Value> scalars_;
-    std::map<std::string, std::vector<Value>> arrays_;
+    std::map<std::string, ArrayValues> arrays_;
 };
 
 }  // namespace quiver
@@ -0,0 +1,52 @@
+#ifndef QUIVER_FILTER_H
+#define QUIVER_FILTER_H
+
+#include "quiver/value.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace quiver {
+
+enum class FilterOp { equal, not_equal, less, less_equal, greater, greater_equal, is_null, is_not_null };
+
+// attribute op value on a scalar attribute of the filtered collection; value is ignored by is_null / is_not_null
+struct Predicate {
+    std::string attribute;
+    FilterOp op = FilterOp::equal;
+    Value value = nullptr;
+};
+
+// Restricts a bulk read to the elements matching every condition set (all elements when none is). Compiled to a
+// parameterized WHERE clause: values are bound and attribute names are checked against the schema, never pasted.
+struct Filter {
+    std::optional<int64_t> min_id;           // Inclusive
+    std::optional<int64_t> max_id;           // Inclusive
+    std::optional<std::vector<int64_t>> ids;  // Membership only: results keep read_element_ids order
+    std::vector<Predicate> predicates;
+
+    Filter& id_range(int64_t from, int64_t to) {
+        min_id = from;
+        max_id = to;
+        return *this;
+    }
+
+    Filter& id_in(std::vector<int64_t> list) {
+        ids = std::move(list);
+        return *this;
+    }
+
+    Filter& where(std::string attribute, FilterOp op, Value value = nullptr) {
+        predicates.push_back({std::move(attribute), op, std::move(value)});
+        return *this;
+    }
+
+    bool empty() const { return !min_id && !max_id && !ids && predicates.empty(); }
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_FILTER_H
@@ -0,0 +1,28 @@
+#ifndef QUIVER_FLAT_VECTORS_H
+#define QUIVER_FLAT_VECTORS_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace quiver {
+
+// Ragged array in CSR layout: group i holds values[offsets[i], offsets[i + 1]).
+// offsets always has size() + 1 entries, starting at 0.
+template <typename T>
+struct FlatVectors {
+    std::vector<T> values;
+    std::vector<size_t> offsets{0};
+
+    size_t size() const { return offsets.size() - 1; }
+    bool empty() const { return size() == 0; }
+    size_t size(size_t group) const { return offsets[group + 1] - offsets[group]; }
+
+    std::span<const T> operator[](size_t group) const {
+        return std::span<const T>(values.data() + offsets[group], size(group));
+    }
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_FLAT_VECTORS_H
@@ -0,0 +1,37 @@
+#ifndef QUIVER_ID_INDEX_H
+#define QUIVER_ID_INDEX_H
+
+#include "export.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace quiver {
+
+// The element ids of a collection in read_element_ids order (ascending, since id is the rowid), with an id ->
+// position lookup, so bulk reads can be joined by position. Dense ids get a direct table (O(1)); a sparse set
+// falls back to binary search over ids.
+class QUIVER_API IdIndex {
+public:
+    IdIndex() = default;
+    explicit IdIndex(std::vector<int64_t> ids);  // Throws unless ids are strictly ascending
+
+    const std::vector<int64_t>& ids() const { return ids_; }
+    size_t size() const { return ids_.size(); }
+    bool empty() const { return ids_.empty(); }
+    int64_t operator[](size_t position) const { return ids_[position]; }
+
+    std::optional<size_t> position(int64_t id) const;
+    bool contains(int64_t id) const { return position(id).has_value(); }
+
+private:
+    std::vector<int64_t> ids_;
+    int64_t first_ = 0;
+    std::vector<int64_t> positions_;  // Position of id first_ + i, -1 for gaps; empty when ids are sparse
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_ID_INDEX_H
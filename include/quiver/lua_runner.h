@@ -2,9 +2,12 @@
 #define QUIVER_LUA_RUNNER_H
 
 #include "export.h"
+#include "value.h"
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace quiver {
 
@@ -24,8 +27,20 @@ public:
     LuaRunner& operator=(LuaRunner&&) noexcept;
 
     /// Runs a Lua script with access to the database as 'db'.
+    /// Compiled chunks are cached by script text, so running the same script again skips parsing.
     void run(const std::string& script);
 
+    /// Compiles a script once for repeated runs; 'name' labels it in error messages.
+    /// The returned handle stays valid until it is released or the runner is destroyed.
+    size_t compile(const std::string& name, const std::string& script);
+
+    /// Runs a compiled script. The arguments reach the chunk as '...' (nullptr becomes nil).
+    void run(size_t handle, const std::vector<Value>& args = {});
+
+    /// Drops a compiled script, so hosts that compile scripts on the fly keep memory bounded.
+    /// A later compile() may reuse the handle.
+    void release(size_t handle);
+
 private:
     struct Impl;
     std::unique_ptr<Impl> impl_;
@@ -0,0 +1,46 @@
+#ifndef QUIVER_NULLABLE_COLUMN_H
+#define QUIVER_NULLABLE_COLUMN_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace quiver {
+
+// One value per element, nulls included, so position i lines up with read_element_ids()[i].
+// validity is a packed bitmap, least significant bit first (Arrow layout): bit i is set when
+// values[i] holds a value; values[i] is default-constructed otherwise.
+template <typename T>
+struct NullableColumn {
+    std::vector<T> values;
+    std::vector<uint8_t> validity;
+
+    size_t size() const { return values.size(); }
+    bool empty() const { return values.empty(); }
+    bool is_valid(size_t row) const { return (validity[row / 8] >> (row % 8)) & 1; }
+
+    size_t null_count() const {
+        size_t nulls = 0;
+        for (size_t row = 0; row < values.size(); ++row) {
+            nulls += is_valid(row) ? 0 : 1;
+        }
+        return nulls;
+    }
+
+    // Appends one row; used by the readers
+    void push_back(T value, bool valid) {
+        const auto row = values.size();
+        if (row % 8 == 0) {
+            validity.push_back(0);
+        }
+        if (valid) {
+            validity.back() |= static_cast<uint8_t>(1u << (row % 8));
+        }
+        values.push_back(std::move(value));
+    }
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_NULLABLE_COLUMN_H
@@ -1,8 +1,18 @@
 #ifndef QUIVER_H
 #define QUIVER_H
 
+#include "aggregates.h"
+#include "attribute_handle.h"
+#include "cursor.h"
 #include "database.h"
+#include "database_pool.h"
 #include "element.h"
 #include "export.h"
+#include "filter.h"
+#include "flat_vectors.h"
+#include "id_index.h"
+#include "nullable_column.h"
+#include "scalar_columns.h"
+#include "time_series.h"
 
 #endif  // QUIVER_H
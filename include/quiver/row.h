@@ -25,6 +25,7 @@ public:
     std::optional<int64_t> get_integer(size_t index) const;
     std::optional<double> get_float(size_t index) const;
     std::optional<std::string> get_string(size_t index) const;
+    std::optional<Blob> get_blob(size_t index) const;
 
     // Iterator support
     auto begin() const { return values_.begin(); }
@@ -0,0 +1,47 @@
+#ifndef QUIVER_SCALAR_COLUMNS_H
+#define QUIVER_SCALAR_COLUMNS_H
+
+#include "data_type.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace quiver {
+
+// One scalar attribute for every element of a collection.
+// Only the buffer matching type is filled; where nulls[i] is set it holds a default value.
+struct ScalarColumn {
+    std::string name;
+    DataType type = DataType::Integer;
+    std::vector<int64_t> integers;     // Integer
+    std::vector<double> floats;        // Real
+    std::vector<std::string> strings;  // Text, DateTime
+    std::vector<uint8_t> nulls;        // 1 where the element has no value
+
+    size_t size() const { return nulls.size(); }
+    bool is_null(size_t row) const { return nulls[row] != 0; }
+};
+
+// Several scalar attributes read in one pass; row i of every column belongs to ids[i]
+struct ScalarColumns {
+    std::vector<int64_t> ids;
+    std::vector<ScalarColumn> columns;  // In requested order
+
+    size_t size() const { return ids.size(); }
+
+    const ScalarColumn& column(const std::string& name) const {
+        for (const auto& column : columns) {
+            if (column.name == name) {
+                return column;
+            }
+        }
+        throw std::runtime_error("Column '" + name + "' was not read");
+    }
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_SCALAR_COLUMNS_H
@@ -4,9 +4,12 @@
 #include "data_type.h"
 #include "export.h"
 
+#include <array>
+#include <cstddef>
 #include <map>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 struct sqlite3;
@@ -19,6 +22,7 @@ struct ColumnDefinition {
     bool not_null;
     bool primary_key;
     std::optional<std::string> default_value;
+    bool packed = false;  // BLOB column: a packed vector or a compressed time series chunk
 };
 
 struct ForeignKey {
@@ -46,8 +50,23 @@ struct TableDefinition {
     const ColumnDefinition* get_column(const std::string& column) const;
 };
 
+enum class AttributeKind { Scalar, Vector, Set, TimeSeries };
+
+// Where an attribute of a collection is stored; precomputed when the schema is loaded
+struct AttributeLocation {
+    std::string table;
+    AttributeKind kind = AttributeKind::Scalar;
+    const ColumnDefinition* column = nullptr;  // Null when matched by group (table) name only
+    const ForeignKey* foreign_key = nullptr;   // Null when the column is not a foreign key
+};
+
 class QUIVER_API Schema {
 public:
+    Schema(const Schema& other);
+    Schema& operator=(const Schema& other);
+    Schema(Schema&& other) noexcept = default;
+    Schema& operator=(Schema&& other) noexcept = default;
+
     // Factory: loads schema from database
     static Schema from_database(sqlite3* db);
 
@@ -67,24 +86,53 @@ public:
     bool is_vector_table(const std::string& table) const;
     bool is_set_table(const std::string& table) const;
     bool is_time_series_table(const std::string& table) const;
+    // Vector table without vector_index: one row per element, each value column a BLOB of packed float64s
+    bool is_packed_vector_table(const std::string& table) const;
+    // Time series table whose date_time is a BLOB: chunks of compressed samples keyed by (id, chunk_start)
+    bool is_compressed_time_series_table(const std::string& table) const;
     std::string get_parent_collection(const std::string& table) const;
 
     // Find table for attribute (throws if not found)
     std::string find_vector_table(const std::string& collection, const std::string& attribute) const;
     std::string find_set_table(const std::string& collection, const std::string& attribute) const;
 
+    // Attribute routing through the precomputed index (nullptr if not found).
+    // For vectors and sets, a group name (Collection_vector_<group>) takes precedence over column names.
+    const AttributeLocation*
+    find_attribute(const std::string& collection, const std::string& attribute, AttributeKind kind) const;
+
+    // Child tables of a collection, in name order
+    const std::vector<std::string>& vector_tables(const std::string& collection) const;
+    const std::vector<std::string>& set_tables(const std::string& collection) const;
+    const std::vector<std::string>& time_series_tables(const std::string& collection) const;
+
     // All tables/collections
     std::vector<std::string> table_names() const;
     std::vector<std::string> collection_names() const;
 
+    // Approximate heap bytes held by the table definitions and lookup indexes
+    size_t memory_usage() const;
+
 private:
+    struct TableIndex {
+        const TableDefinition* table = nullptr;
+        std::unordered_map<std::string, const ColumnDefinition*> columns;
+    };
+    struct CollectionIndex {
+        std::array<std::unordered_map<std::string, AttributeLocation>, 4> attributes;  // By AttributeKind
+        std::vector<std::string> vector_tables;
+        std::vector<std::string> set_tables;
+        std::vector<std::string> time_series_tables;
+    };
+
     Schema() = default;
     std::map<std::string, TableDefinition> tables_;
+    std::unordered_map<std::string, TableIndex> table_index_;
+    std::unordered_map<std::string, CollectionIndex> collection_index_;
 
     void load_from_database(sqlite3* db);
-    static std::vector<ColumnDefinition> query_columns(sqlite3* db, const std::string& table);
-    static std::vector<ForeignKey> query_foreign_keys(sqlite3* db, const std::string& table);
-    static std::vector<Index> query_indexes(sqlite3* db, const std::string& table);
+    void build_index();
+    const CollectionIndex* collection_index(const std::string& collection) const;
 };
 
 }  // namespace quiver
@@ -0,0 +1,30 @@
+#ifndef QUIVER_SCHEMA_LINT_H
+#define QUIVER_SCHEMA_LINT_H
+
+#include "export.h"
+
+#include <string>
+#include <vector>
+
+namespace quiver {
+
+// An index quiver's own access paths need on table: one whose leading columns are columns
+struct QUIVER_API MissingIndex {
+    std::string table;
+    std::vector<std::string> columns;
+    std::string reason;
+};
+
+// One lookup quiver runs against table, as SQLite plans it (Database::check_query_plans)
+struct QUIVER_API QueryPlanCheck {
+    std::string collection;
+    std::string table;
+    std::string sql;
+    std::vector<std::string> plan;  // EXPLAIN QUERY PLAN detail lines, outermost step first
+    bool full_scan = false;         // A step visits every row of a table or index
+    bool temp_sort = false;         // A step sorts the rows with a temporary B-tree
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_SCHEMA_LINT_H
@@ -3,6 +3,7 @@
 
 #include "export.h"
 #include "schema.h"
+#include "schema_lint.h"
 
 #include <string>
 #include <vector>
@@ -12,8 +13,9 @@ namespace quiver {
 // Validates that a schema follows QUIVER conventions:
 // - Configuration table exists
 // - Collections have id/label with proper constraints
-// - Vector tables have proper structure and FK constraints
+// - Vector tables have proper structure and FK constraints (row layout or packed BLOB layout)
 // - Set tables have proper UNIQUE constraints
+// - Compressed time series tables have a chunk_start key and BLOB columns
 // - No duplicate attributes across collection and its vector tables
 class QUIVER_API SchemaValidator {
 public:
@@ -22,6 +24,11 @@ public:
     // Throws std::runtime_error on validation failure
     void validate();
 
+    // Performance lint, never throws: indexes missing for the lookups quiver runs. Every foreign key column (the
+    // cascades and SET NULL actions of a deleted or renumbered target search it), the label of every relation
+    // target and the (element, date_time) key of every time series table.
+    std::vector<MissingIndex> missing_indexes() const;
+
 private:
     const Schema& schema_;
     std::vector<std::string> collections_;
@@ -32,8 +39,10 @@ private:
     void validate_collection(const std::string& name);
     void validate_vector_table(const std::string& name);
     void validate_set_table(const std::string& name);
+    void validate_compressed_time_series_table(const std::string& name);
     void validate_no_duplicate_attributes();
     void validate_foreign_keys();
+    void validate_packed_columns();
 
     // Helper
     void validation_error(const std::string& message);
@@ -0,0 +1,68 @@
+#ifndef QUIVER_STRING_ARENA_H
+#define QUIVER_STRING_ARENA_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace quiver {
+
+// Strings stored back to back in one buffer instead of one heap allocation each. Value i is the length(i)
+// characters at buffer().data() + start(i), followed by a '\0'. An interning reader stores a repeated value once
+// and points later copies at the same characters, so starts are not necessarily increasing.
+class StringArena {
+public:
+    size_t size() const { return starts_.size(); }
+    bool empty() const { return starts_.empty(); }
+
+    std::string_view operator[](size_t i) const { return {buffer_.data() + starts_[i], lengths_[i]}; }
+    const char* c_str(size_t i) const { return buffer_.data() + starts_[i]; }
+    size_t start(size_t i) const { return starts_[i]; }
+    size_t length(size_t i) const { return lengths_[i]; }
+
+    // Every stored character, terminators included
+    const std::string& buffer() const { return buffer_; }
+
+    void push_back(std::string_view value) {
+        starts_.push_back(buffer_.size());
+        lengths_.push_back(value.size());
+        buffer_.append(value);
+        buffer_.push_back('\0');
+    }
+
+    // Appends value i again without copying its characters
+    void push_back_shared(size_t i) {
+        starts_.push_back(starts_[i]);
+        lengths_.push_back(lengths_[i]);
+    }
+
+    std::vector<std::string> to_vector() const {
+        std::vector<std::string> values;
+        values.reserve(size());
+        for (size_t i = 0; i < size(); ++i) {
+            values.emplace_back((*this)[i]);
+        }
+        return values;
+    }
+
+private:
+    std::string buffer_;
+    std::vector<size_t> starts_;
+    std::vector<size_t> lengths_;
+};
+
+// Ragged string groups in CSR layout over one arena: group i holds values[offsets[i], offsets[i + 1]).
+// offsets always has size() + 1 entries, starting at 0.
+struct FlatStrings {
+    StringArena values;
+    std::vector<size_t> offsets{0};
+
+    size_t size() const { return offsets.size() - 1; }
+    bool empty() const { return size() == 0; }
+    size_t size(size_t group) const { return offsets[group + 1] - offsets[group]; }
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_STRING_ARENA_H
@@ -0,0 +1,69 @@
+#ifndef QUIVER_STUDY_GENERATOR_H
+#define QUIVER_STUDY_GENERATOR_H
+
+#include "database.h"
+#include "export.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace quiver {
+
+struct QUIVER_API StudyGeneratorOptions {
+    // Elements created in every collection, except Configuration, which gets one; counts overrides both per name
+    int64_t elements = 1'000;
+    std::map<std::string, int64_t> counts;
+    // Values per element in every vector group, and per element in every set group (capped by the number of
+    // distinct values available, e.g. the size of a referenced collection)
+    size_t vector_length = 10;
+    size_t set_size = 3;
+    // Consecutive elements that reference the same target element through a scalar foreign key
+    size_t fan_out = 10;
+    // Samples per element in every time series group, time_series_step seconds apart from time_series_start
+    size_t time_series_length = 24;
+    std::string time_series_start = "2024-01-01 00:00:00";
+    int64_t time_series_step = 3'600;
+    // Same seed, schema and options: same study, value for value
+    uint64_t seed = 42;
+    // Elements handed to create_elements at a time
+    size_t batch_size = 10'000;
+};
+
+struct QUIVER_API GeneratedStudy {
+    std::map<std::string, int64_t> elements;  // Per collection
+    int64_t vector_rows = 0;
+    int64_t set_rows = 0;
+    int64_t time_series_rows = 0;  // Samples, also for compressed groups
+    int64_t elapsed_ns = 0;
+};
+
+// Fills a database whose collections are all empty with synthetic data shaped by its schema, for load and scaling
+// tests: every scalar, vector, set and time series column gets a value (labels "<Collection> <n>", text from a small
+// pool per column so interning and GROUP BY see repeats). Collections are filled in foreign key order, so references
+// point at existing elements; references to the collection itself or to one filled later are written in a second
+// pass for scalars and left NULL in vector/set groups. Runs in one transaction; open the target with journal_mode
+// off and synchronous off for the fastest load.
+class QUIVER_API StudyGenerator {
+public:
+    explicit StudyGenerator(StudyGeneratorOptions options = {});
+
+    GeneratedStudy generate(Database& db) const;
+
+    // Creates path from the schema file (replacing an existing file) and fills it
+    GeneratedStudy generate(const std::string& path,
+                            const std::string& schema_path,
+                            const DatabaseOptions& options = DatabaseOptions()) const;
+
+    const StudyGeneratorOptions& options() const { return options_; }
+
+private:
+    class Generation;
+
+    StudyGeneratorOptions options_;
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_STUDY_GENERATOR_H
@@ -0,0 +1,23 @@
+#ifndef QUIVER_TIME_SERIES_H
+#define QUIVER_TIME_SERIES_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace quiver {
+
+// One value column of a time series group for one element, ordered by date_time.
+// date_times[i] pairs with values[i]; missing float values are NaN.
+template <typename T>
+struct TimeSeries {
+    std::vector<std::string> date_times;
+    std::vector<T> values;
+
+    size_t size() const { return values.size(); }
+    bool empty() const { return values.empty(); }
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_TIME_SERIES_H
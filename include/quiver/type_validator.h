@@ -20,7 +20,8 @@ public:
     void validate_scalar(const std::string& table, const std::string& column, const Value& value) const;
 
     // Validate an array value against a column in a table
-    void validate_array(const std::string& table, const std::string& column, const std::vector<Value>& values) const;
+    // Arrays hold one element type, so the type is checked once rather than per value
+    void validate_array(const std::string& table, const std::string& column, const ArrayValues& values) const;
 
     // Low-level: validate value against explicit type
     static void validate_value(const std::string& context, DataType expected_type, const Value& value);
@@ -1,13 +1,25 @@
 #ifndef QUIVER_VALUE_H
 #define QUIVER_VALUE_H
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <variant>
+#include <vector>
 
 namespace quiver {
 
-using Value = std::variant<std::nullptr_t, int64_t, double, std::string>;
+// Bytes of a BLOB column, e.g. a packed vector or a compressed time series chunk
+using Blob = std::vector<uint8_t>;
+
+using Value = std::variant<std::nullptr_t, int64_t, double, std::string, Blob>;
+
+// Values of an array attribute, kept in the element type they were set with
+using ArrayValues = std::variant<std::vector<int64_t>, std::vector<double>, std::vector<std::string>>;
+
+inline size_t array_size(const ArrayValues& values) {
+    return std::visit([](const auto& typed) { return typed.size(); }, values);
+}
 
 }  // namespace quiver
 
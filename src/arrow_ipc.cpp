@@ -0,0 +1,775 @@
+#include "arrow_ipc.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+
+// Buffers are written and read with memcpy in host byte order, and the schema declares little-endian data
+static_assert(std::endian::native == std::endian::little, "Arrow IPC export assumes a little-endian host");
+
+namespace quiver {
+
+namespace {
+
+// File magic; the leading copy is padded to 8 bytes
+constexpr char kMagic[6] = {'A', 'R', 'R', 'O', 'W', '1'};
+constexpr uint32_t kContinuation = 0xFFFFFFFF;
+
+// Enum and union values from the Arrow format's Schema.fbs and Message.fbs
+constexpr int16_t kMetadataV5 = 4;
+constexpr uint8_t kHeaderSchema = 1;
+constexpr uint8_t kHeaderRecordBatch = 3;
+constexpr uint8_t kTypeInt = 2;
+constexpr uint8_t kTypeFloatingPoint = 3;
+constexpr uint8_t kTypeBinary = 4;
+constexpr uint8_t kTypeUtf8 = 5;
+constexpr uint8_t kTypeLargeBinary = 19;
+constexpr uint8_t kTypeLargeUtf8 = 20;
+constexpr int16_t kPrecisionSingle = 1;
+constexpr int16_t kPrecisionDouble = 2;
+
+// Size of the Block struct in File.fbs: offset (long), metaDataLength (int), 4 bytes of padding, bodyLength (long)
+constexpr size_t kBlockSize = 24;
+
+// FlatBuffers are encoded from a small object tree. The encoder writes front to back, a table's inline part before
+// the objects it refers to, so every uoffset points forward as the format requires.
+struct FbObject;
+
+struct FbField {
+    uint16_t id;
+    uint8_t size;  // Inline bytes: 1, 2, 4 or 8; objects take a 4-byte offset
+    uint64_t bits = 0;
+    std::unique_ptr<FbObject> object;
+};
+
+struct FbObject {
+    enum class Kind { Table, String, TableVector, StructVector };
+    Kind kind = Kind::Table;
+    std::vector<FbField> fields;  // Table
+    std::vector<FbObject> items;  // TableVector
+    std::vector<uint8_t> bytes;   // String, or the packed elements of a StructVector
+    size_t count = 0;             // StructVector
+};
+
+template <typename T>
+FbField fb_scalar(uint16_t id, T value) {
+    FbField field{id, static_cast<uint8_t>(sizeof(T)), 0, nullptr};
+    std::memcpy(&field.bits, &value, sizeof(T));
+    return field;
+}
+
+FbField fb_field(uint16_t id, FbObject object) {
+    FbField field{id, 4, 0, nullptr};
+    field.object = std::make_unique<FbObject>(std::move(object));
+    return field;
+}
+
+template <typename... Fields>
+FbObject fb_table(Fields... fields) {
+    FbObject table;
+    (table.fields.push_back(std::move(fields)), ...);
+    return table;
+}
+
+FbObject fb_string(std::string_view text) {
+    FbObject string;
+    string.kind = FbObject::Kind::String;
+    string.bytes.assign(text.begin(), text.end());
+    return string;
+}
+
+FbObject fb_vector(std::vector<FbObject> items) {
+    FbObject vector;
+    vector.kind = FbObject::Kind::TableVector;
+    vector.items = std::move(items);
+    return vector;
+}
+
+// Vector of 8-byte aligned structs; elements holds count structs back to back
+FbObject fb_structs(std::vector<uint8_t> elements, size_t count) {
+    FbObject vector;
+    vector.kind = FbObject::Kind::StructVector;
+    vector.bytes = std::move(elements);
+    vector.count = count;
+    return vector;
+}
+
+class FbEncoder {
+public:
+    // Encodes root as a finished buffer, padded to 8 bytes
+    std::vector<uint8_t> finish(const FbObject& root) {
+        out_.assign(4, 0);
+        patch_offset(0, write(root));
+        pad(8);
+        return std::move(out_);
+    }
+
+private:
+    size_t write(const FbObject& object) {
+        switch (object.kind) {
+        case FbObject::Kind::Table:
+            return write_table(object);
+        case FbObject::Kind::String: {
+            pad(4);
+            const auto pos = out_.size();
+            put(static_cast<uint32_t>(object.bytes.size()));
+            out_.insert(out_.end(), object.bytes.begin(), object.bytes.end());
+            out_.push_back(0);
+            return pos;
+        }
+        case FbObject::Kind::TableVector: {
+            pad(4);
+            const auto pos = out_.size();
+            put(static_cast<uint32_t>(object.items.size()));
+            out_.resize(out_.size() + 4 * object.items.size(), 0);
+            for (size_t i = 0; i < object.items.size(); ++i) {
+                patch_offset(pos + 4 + 4 * i, write(object.items[i]));
+            }
+            return pos;
+        }
+        case FbObject::Kind::StructVector: {
+            // The length precedes the elements, which must start on an 8-byte boundary
+            pad(4);
+            if ((out_.size() + 4) % 8 != 0) {
+                put(uint32_t{0});
+            }
+            const auto pos = out_.size();
+            put(static_cast<uint32_t>(object.count));
+            out_.insert(out_.end(), object.bytes.begin(), object.bytes.end());
+            return pos;
+        }
+        }
+        return 0;
+    }
+
+    size_t write_table(const FbObject& table) {
+        // Inline part: the vtable offset, then fields from widest to narrowest so each is naturally aligned
+        std::vector<const FbField*> order;
+        uint16_t slots = 0;
+        for (const auto& field : table.fields) {
+            order.push_back(&field);
+            slots = std::max<uint16_t>(slots, static_cast<uint16_t>(field.id + 1));
+        }
+        std::stable_sort(
+            order.begin(), order.end(), [](const FbField* a, const FbField* b) { return a->size > b->size; });
+        std::vector<uint16_t> offsets(slots, 0);
+        size_t inline_size = !order.empty() && order.front()->size == 8 ? 8 : 4;
+        for (const auto* field : order) {
+            offsets[field->id] = static_cast<uint16_t>(inline_size);
+            inline_size += field->size;
+        }
+
+        pad(2);
+        const auto vtable = out_.size();
+        put(static_cast<uint16_t>(4 + 2 * slots));
+        put(static_cast<uint16_t>(inline_size));
+        for (const auto offset : offsets) {
+            put(offset);
+        }
+
+        pad(8);
+        const auto pos = out_.size();
+        out_.resize(pos + inline_size, 0);
+        const auto vtable_offset = static_cast<int32_t>(pos - vtable);
+        std::memcpy(out_.data() + pos, &vtable_offset, 4);
+        for (const auto& field : table.fields) {
+            if (!field.object) {
+                std::memcpy(out_.data() + pos + offsets[field.id], &field.bits, field.size);
+            }
+        }
+        for (const auto& field : table.fields) {
+            if (field.object) {
+                patch_offset(pos + offsets[field.id], write(*field.object));
+            }
+        }
+        return pos;
+    }
+
+    template <typename T>
+    void put(T value) {
+        const auto pos = out_.size();
+        out_.resize(pos + sizeof(T));
+        std::memcpy(out_.data() + pos, &value, sizeof(T));
+    }
+
+    void pad(size_t alignment) { out_.resize((out_.size() + alignment - 1) / alignment * alignment, 0); }
+
+    void patch_offset(size_t at, size_t target) {
+        const auto offset = static_cast<uint32_t>(target - at);
+        std::memcpy(out_.data() + at, &offset, 4);
+    }
+
+    std::vector<uint8_t> out_;
+};
+
+// Thrown by FbView on out-of-bounds metadata; the reader reports it with the file path
+struct MalformedMetadata : std::runtime_error {
+    MalformedMetadata() : std::runtime_error("malformed metadata") {}
+};
+
+// Bounds-checked view of one FlatBuffers table
+class FbView {
+public:
+    static FbView root(const uint8_t* data, size_t size) {
+        const FbView buffer(data, size);
+        return FbView(data, size, buffer.deref(0));
+    }
+
+    bool has(uint16_t id) const { return field_pos(id) != 0; }
+
+    template <typename T>
+    T scalar(uint16_t id, T fallback) const {
+        const auto pos = field_pos(id);
+        return pos ? load<T>(pos) : fallback;
+    }
+
+    FbView table(uint16_t id) const {
+        const auto pos = field_pos(id);
+        check(pos != 0);
+        return FbView(data_, size_, deref(pos));
+    }
+
+    std::string_view string(uint16_t id) const {
+        const auto pos = field_pos(id);
+        if (!pos) {
+            return {};
+        }
+        const auto start = deref(pos);
+        const auto length = load<uint32_t>(start);
+        check(start + 4 + length <= size_);
+        return std::string_view(reinterpret_cast<const char*>(data_ + start + 4), length);
+    }
+
+    size_t vector_size(uint16_t id) const {
+        const auto pos = field_pos(id);
+        return pos ? load<uint32_t>(deref(pos)) : 0;
+    }
+
+    FbView vector_table(uint16_t id, size_t index) const {
+        const auto slot = vector_element(id, index, 4);
+        return FbView(data_, size_, deref(slot));
+    }
+
+    // Start of struct `index` in a vector of element_size-byte structs
+    const uint8_t* vector_struct(uint16_t id, size_t index, size_t element_size) const {
+        return data_ + vector_element(id, index, element_size);
+    }
+
+    template <typename T>
+    T load(size_t pos) const {
+        check(pos + sizeof(T) <= size_);
+        T value;
+        std::memcpy(&value, data_ + pos, sizeof(T));
+        return value;
+    }
+
+private:
+    FbView(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+    FbView(const uint8_t* data, size_t size, size_t table) : data_(data), size_(size), table_(table) {
+        const auto vtable = static_cast<int64_t>(table) - load<int32_t>(table);
+        check(vtable >= 0);
+        vtable_ = static_cast<size_t>(vtable);
+        vtable_size_ = load<uint16_t>(vtable_);
+        check(vtable_size_ >= 4 && vtable_ + vtable_size_ <= size_);
+    }
+
+    static void check(bool condition) {
+        if (!condition) {
+            throw MalformedMetadata();
+        }
+    }
+
+    // Position of field id, or 0 when it is absent
+    size_t field_pos(uint16_t id) const {
+        const size_t entry = 4 + 2 * static_cast<size_t>(id);
+        if (entry + 2 > vtable_size_) {
+            return 0;
+        }
+        const auto offset = load<uint16_t>(vtable_ + entry);
+        return offset ? table_ + offset : 0;
+    }
+
+    size_t deref(size_t pos) const {
+        const auto target = pos + load<uint32_t>(pos);
+        check(target < size_);
+        return target;
+    }
+
+    size_t vector_element(uint16_t id, size_t index, size_t element_size) const {
+        const auto pos = field_pos(id);
+        check(pos != 0);
+        const auto start = deref(pos);
+        check(index < load<uint32_t>(start));
+        const auto element = start + 4 + index * element_size;
+        check(element + element_size <= size_);
+        return element;
+    }
+
+    const uint8_t* data_;
+    size_t size_;
+    size_t table_ = 0;
+    size_t vtable_ = 0;
+    uint16_t vtable_size_ = 0;
+};
+
+FbObject schema_object(const std::vector<ArrowField>& fields) {
+    std::vector<FbObject> items;
+    for (const auto& field : fields) {
+        uint8_t type_type = kTypeUtf8;
+        FbObject type;
+        switch (field.type) {
+        case DataType::Integer:
+            type_type = kTypeInt;
+            type = fb_table(fb_scalar<int32_t>(0, 64), fb_scalar<uint8_t>(1, 1));
+            break;
+        case DataType::Real:
+            type_type = kTypeFloatingPoint;
+            type = fb_table(fb_scalar<int16_t>(0, kPrecisionDouble));
+            break;
+        case DataType::Text:
+        case DataType::DateTime:
+            type_type = field.binary ? kTypeBinary : kTypeUtf8;
+            break;
+        }
+        // Readers require the children vector to be present even when empty
+        items.push_back(fb_table(fb_field(0, fb_string(field.name)),
+                                 fb_scalar<uint8_t>(1, field.nullable ? 1 : 0),
+                                 fb_scalar<uint8_t>(2, type_type),
+                                 fb_field(3, std::move(type)),
+                                 fb_field(5, fb_vector({}))));
+    }
+    return fb_table(fb_scalar<int16_t>(0, 0), fb_field(1, fb_vector(std::move(items))));
+}
+
+FbObject message_object(uint8_t header_type, FbObject header, size_t body_length) {
+    return fb_table(fb_scalar<int16_t>(0, kMetadataV5),
+                    fb_scalar<uint8_t>(1, header_type),
+                    fb_field(2, std::move(header)),
+                    fb_scalar<int64_t>(3, static_cast<int64_t>(body_length)));
+}
+
+// Packs (a, b) pairs of longs as FieldNode or Buffer structs
+std::vector<uint8_t> pack_pairs(const std::vector<int64_t>& values) {
+    std::vector<uint8_t> bytes(values.size() * sizeof(int64_t));
+    std::memcpy(bytes.data(), values.data(), bytes.size());
+    return bytes;
+}
+
+int seek(std::FILE* file, int64_t offset, int origin) {
+#ifdef _WIN32
+    return _fseeki64(file, offset, origin);
+#else
+    return fseeko(file, static_cast<off_t>(offset), origin);
+#endif
+}
+
+int64_t tell(std::FILE* file) {
+#ifdef _WIN32
+    return _ftelli64(file);
+#else
+    return static_cast<int64_t>(ftello(file));
+#endif
+}
+
+}  // namespace
+
+ArrowFileWriter::ArrowFileWriter(const std::string& path, std::vector<ArrowField> fields)
+    : path_(path), file_(std::fopen(path.c_str(), "wb")), fields_(std::move(fields)) {
+    if (!file_) {
+        throw std::runtime_error("Failed to open Arrow file for writing: " + path);
+    }
+    const char header[8] = {kMagic[0], kMagic[1], kMagic[2], kMagic[3], kMagic[4], kMagic[5], 0, 0};
+    write(header, sizeof(header));
+    write_message(FbEncoder().finish(message_object(kHeaderSchema, schema_object(fields_), 0)), {});
+}
+
+ArrowFileWriter::~ArrowFileWriter() {
+    if (file_) {
+        std::fclose(file_);
+    }
+}
+
+void ArrowFileWriter::write_batch(const std::vector<ScalarColumn>& columns) {
+    const auto rows = columns.empty() ? size_t{0} : columns.front().size();
+    std::vector<uint8_t> body;
+    std::vector<int64_t> nodes;    // (length, null_count) per column
+    std::vector<int64_t> buffers;  // (offset, length) per buffer
+    const auto add_buffer = [&](const void* data, size_t size) {
+        buffers.push_back(static_cast<int64_t>(body.size()));
+        buffers.push_back(static_cast<int64_t>(size));
+        if (size > 0) {
+            const auto* bytes = static_cast<const uint8_t*>(data);
+            body.insert(body.end(), bytes, bytes + size);
+        }
+        body.resize((body.size() + 7) / 8 * 8, 0);
+    };
+
+    for (size_t c = 0; c < columns.size(); ++c) {
+        const auto& column = columns[c];
+        const auto null_count = static_cast<size_t>(std::count(column.nulls.begin(), column.nulls.end(), 1));
+        nodes.push_back(static_cast<int64_t>(rows));
+        nodes.push_back(static_cast<int64_t>(null_count));
+
+        // Validity bitmap, least significant bit first; omitted when nothing is null
+        if (null_count > 0) {
+            std::vector<uint8_t> validity((rows + 7) / 8, 0);
+            for (size_t row = 0; row < rows; ++row) {
+                if (!column.is_null(row)) {
+                    validity[row / 8] |= static_cast<uint8_t>(1u << (row % 8));
+                }
+            }
+            add_buffer(validity.data(), validity.size());
+        } else {
+            add_buffer(nullptr, 0);
+        }
+
+        switch (fields_[c].type) {
+        case DataType::Integer:
+            add_buffer(column.integers.data(), rows * sizeof(int64_t));
+            break;
+        case DataType::Real:
+            add_buffer(column.floats.data(), rows * sizeof(double));
+            break;
+        case DataType::Text:
+        case DataType::DateTime: {
+            std::vector<int32_t> offsets;
+            offsets.reserve(rows + 1);
+            offsets.push_back(0);
+            size_t total = 0;
+            for (const auto& text : column.strings) {
+                total += text.size();
+                if (total > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+                    throw std::runtime_error("Column '" + fields_[c].name + "' has too much text for one Arrow batch");
+                }
+                offsets.push_back(static_cast<int32_t>(total));
+            }
+            add_buffer(offsets.data(), offsets.size() * sizeof(int32_t));
+            buffers.push_back(static_cast<int64_t>(body.size()));
+            buffers.push_back(static_cast<int64_t>(total));
+            for (const auto& text : column.strings) {
+                body.insert(body.end(), text.begin(), text.end());
+            }
+            body.resize((body.size() + 7) / 8 * 8, 0);
+            break;
+        }
+        }
+    }
+
+    auto batch = fb_table(fb_scalar<int64_t>(0, static_cast<int64_t>(rows)),
+                          fb_field(1, fb_structs(pack_pairs(nodes), nodes.size() / 2)),
+                          fb_field(2, fb_structs(pack_pairs(buffers), buffers.size() / 2)));
+    const auto metadata = FbEncoder().finish(message_object(kHeaderRecordBatch, std::move(batch), body.size()));
+    batches_.push_back(write_message(metadata, body));
+}
+
+void ArrowFileWriter::close() {
+    // End-of-stream marker, then the footer: the schema again plus the location of every record batch
+    const uint32_t end_of_stream[2] = {kContinuation, 0};
+    write(end_of_stream, sizeof(end_of_stream));
+
+    std::vector<uint8_t> blocks(batches_.size() * kBlockSize, 0);
+    for (size_t i = 0; i < batches_.size(); ++i) {
+        auto* block = blocks.data() + i * kBlockSize;
+        std::memcpy(block, &batches_[i].offset, 8);
+        std::memcpy(block + 8, &batches_[i].metadata_length, 4);
+        std::memcpy(block + 16, &batches_[i].body_length, 8);
+    }
+    const auto footer = FbEncoder().finish(fb_table(fb_scalar<int16_t>(0, kMetadataV5),
+                                                    fb_field(1, schema_object(fields_)),
+                                                    fb_field(2, fb_structs({}, 0)),
+                                                    fb_field(3, fb_structs(std::move(blocks), batches_.size()))));
+    write(footer.data(), footer.size());
+    const auto footer_size = static_cast<int32_t>(footer.size());
+    write(&footer_size, sizeof(footer_size));
+    write(kMagic, sizeof(kMagic));
+
+    const auto rc = std::fclose(file_);
+    file_ = nullptr;
+    if (failed_ || rc != 0) {
+        throw std::runtime_error("Failed to write Arrow file: " + path_);
+    }
+}
+
+ArrowBlock ArrowFileWriter::write_message(const std::vector<uint8_t>& metadata,
+                                                      const std::vector<uint8_t>& body) {
+    // Continuation marker and metadata size, then the 8-byte padded metadata and the body
+    const ArrowBlock block{offset_, static_cast<int32_t>(8 + metadata.size()), static_cast<int64_t>(body.size())};
+    const uint32_t prefix[2] = {kContinuation, static_cast<uint32_t>(metadata.size())};
+    write(prefix, sizeof(prefix));
+    write(metadata.data(), metadata.size());
+    write(body.data(), body.size());
+    return block;
+}
+
+void ArrowFileWriter::write(const void* data, size_t size) {
+    if (size > 0) {
+        failed_ = failed_ || std::fwrite(data, 1, size, file_) != size;
+    }
+    offset_ += static_cast<int64_t>(size);
+}
+
+ArrowFileReader::ArrowFileReader(const std::string& path) : path_(path), file_(std::fopen(path.c_str(), "rb")) {
+    if (!file_) {
+        throw std::runtime_error("Failed to open Arrow file: " + path);
+    }
+    try {
+        // Leading magic, then the trailer: footer size and magic again
+        char magic[sizeof(kMagic)];
+        if (seek(file_, 0, SEEK_END) != 0) {
+            fail("cannot seek");
+        }
+        const auto file_size = tell(file_);
+        if (file_size < static_cast<int64_t>(8 + 4 + sizeof(kMagic))) {
+            fail("file too short");
+        }
+        read_at(0, magic, sizeof(magic));
+        char trailer[4 + sizeof(kMagic)];
+        read_at(file_size - static_cast<int64_t>(sizeof(trailer)), trailer, sizeof(trailer));
+        if (std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+            std::memcmp(trailer + 4, kMagic, sizeof(kMagic)) != 0) {
+            fail("missing ARROW1 magic");
+        }
+        int32_t footer_size = 0;
+        std::memcpy(&footer_size, trailer, 4);
+        if (footer_size <= 0 || footer_size > file_size - static_cast<int64_t>(8 + sizeof(trailer))) {
+            fail("bad footer size");
+        }
+        std::vector<uint8_t> footer(static_cast<size_t>(footer_size));
+        read_at(file_size - static_cast<int64_t>(sizeof(trailer)) - footer_size, footer.data(), footer.size());
+
+        try {
+            const auto root = FbView::root(footer.data(), footer.size());
+            const auto schema = root.table(1);
+            if (schema.scalar<int16_t>(0, 0) != 0) {
+                fail("big-endian data is not supported");
+            }
+            for (size_t i = 0; i < schema.vector_size(1); ++i) {
+                const auto field = schema.vector_table(1, i);
+                ArrowField arrow_field{
+                    std::string(field.string(0)), DataType::Integer, field.scalar<uint8_t>(1, 0) != 0};
+                FieldLayout layout;
+                const auto type_type = field.scalar<uint8_t>(2, 0);
+                const auto unsupported = [&] { fail("column '" + arrow_field.name + "' has an unsupported type"); };
+                if (field.has(4)) {
+                    fail("column '" + arrow_field.name + "' is dictionary-encoded, which is not supported");
+                }
+                if (type_type == kTypeInt) {
+                    const auto type = field.table(3);
+                    layout.bit_width = type.scalar<int32_t>(0, 0);
+                    layout.is_signed = type.scalar<uint8_t>(1, 0) != 0;
+                    if ((layout.bit_width != 8 && layout.bit_width != 16 && layout.bit_width != 32 &&
+                         layout.bit_width != 64) ||
+                        (layout.bit_width == 64 && !layout.is_signed)) {
+                        unsupported();
+                    }
+                } else if (type_type == kTypeFloatingPoint) {
+                    const auto precision = field.table(3).scalar<int16_t>(0, 0);
+                    if (precision != kPrecisionSingle && precision != kPrecisionDouble) {
+                        unsupported();
+                    }
+                    arrow_field.type = DataType::Real;
+                    layout.bit_width = precision == kPrecisionSingle ? 32 : 64;
+                } else if (type_type == kTypeUtf8 || type_type == kTypeLargeUtf8 || type_type == kTypeBinary ||
+                           type_type == kTypeLargeBinary) {
+                    arrow_field.type = DataType::Text;
+                    arrow_field.binary = type_type == kTypeBinary || type_type == kTypeLargeBinary;
+                    layout.bit_width = type_type == kTypeUtf8 || type_type == kTypeBinary ? 32 : 64;
+                } else {
+                    unsupported();
+                }
+                fields_.push_back(std::move(arrow_field));
+                layouts_.push_back(layout);
+            }
+            for (size_t i = 0; i < root.vector_size(3); ++i) {
+                const auto* block = root.vector_struct(3, i, kBlockSize);
+                ArrowBlock entry{};
+                std::memcpy(&entry.offset, block, 8);
+                std::memcpy(&entry.metadata_length, block + 8, 4);
+                std::memcpy(&entry.body_length, block + 16, 8);
+                if (entry.offset < 8 || entry.metadata_length < 8 || entry.body_length < 0 ||
+                    entry.offset + entry.metadata_length + entry.body_length > file_size) {
+                    fail("record batch out of bounds");
+                }
+                batches_.push_back(entry);
+            }
+        } catch (const MalformedMetadata& e) {
+            fail(e.what());
+        }
+    } catch (...) {
+        std::fclose(file_);
+        throw;
+    }
+}
+
+ArrowFileReader::~ArrowFileReader() {
+    std::fclose(file_);
+}
+
+size_t ArrowFileReader::read_batch(size_t index, std::vector<ScalarColumn>& columns) {
+    const auto& block = batches_.at(index);
+    const auto metadata_length = static_cast<size_t>(block.metadata_length);
+    const auto body_length = static_cast<size_t>(block.body_length);
+    buffer_.resize(metadata_length + body_length);
+    read_at(block.offset, buffer_.data(), buffer_.size());
+    const auto* body = buffer_.data() + metadata_length;
+
+    try {
+        // Files written before the continuation marker was introduced start with the size directly
+        uint32_t prefix[2] = {0, 0};
+        std::memcpy(prefix, buffer_.data(), 8);
+        const auto continued = prefix[0] == kContinuation;
+        const auto flatbuffer = size_t{continued ? 8u : 4u};
+        const auto size = static_cast<size_t>(continued ? prefix[1] : prefix[0]);
+        if (size > metadata_length - flatbuffer) {
+            fail("bad message size");
+        }
+        const auto message = FbView::root(buffer_.data() + flatbuffer, size);
+        if (message.scalar<uint8_t>(1, 0) != kHeaderRecordBatch) {
+            fail("expected a record batch message");
+        }
+        const auto batch = message.table(2);
+        if (batch.has(3)) {
+            fail("compressed record batches are not supported");
+        }
+        const auto rows = batch.scalar<int64_t>(0, 0);
+        if (rows < 0 || batch.vector_size(1) != fields_.size()) {
+            fail("record batch does not match the schema");
+        }
+
+        size_t next_buffer = 0;
+        const auto buffer = [&](size_t& length) -> const uint8_t* {
+            const auto* entry = batch.vector_struct(2, next_buffer++, 16);
+            int64_t offset = 0;
+            int64_t size = 0;
+            std::memcpy(&offset, entry, 8);
+            std::memcpy(&size, entry + 8, 8);
+            if (offset < 0 || size < 0 || static_cast<size_t>(offset + size) > body_length) {
+                fail("buffer out of bounds");
+            }
+            length = static_cast<size_t>(size);
+            return body + offset;
+        };
+
+        const auto row_count = static_cast<size_t>(rows);
+        columns.resize(fields_.size());
+        for (size_t c = 0; c < fields_.size(); ++c) {
+            const auto& field = fields_[c];
+            const auto& layout = layouts_[c];
+            auto& column = columns[c];
+            column.name = field.name;
+            column.type = field.type;
+            column.integers.clear();
+            column.floats.clear();
+            column.strings.clear();
+            column.nulls.assign(row_count, 0);
+
+            const auto* node = batch.vector_struct(1, c, 16);
+            int64_t length = 0;
+            int64_t null_count = 0;
+            std::memcpy(&length, node, 8);
+            std::memcpy(&null_count, node + 8, 8);
+            if (length != rows) {
+                fail("column '" + field.name + "' length does not match the record batch");
+            }
+
+            size_t validity_size = 0;
+            const auto* validity = buffer(validity_size);
+            if (null_count > 0 && validity_size > 0) {
+                if (validity_size < (row_count + 7) / 8) {
+                    fail("validity bitmap of column '" + field.name + "' is too short");
+                }
+                for (size_t row = 0; row < row_count; ++row) {
+                    column.nulls[row] = ((validity[row / 8] >> (row % 8)) & 1) ? 0 : 1;
+                }
+            }
+
+            size_t data_size = 0;
+            const auto* data = buffer(data_size);
+            const auto width = static_cast<size_t>(layout.bit_width / 8);
+            if (field.type == DataType::Text) {
+                // Offsets, then the concatenated UTF-8 bytes they index into
+                if (data_size < (row_count + 1) * width) {
+                    fail("offsets of column '" + field.name + "' are too short");
+                }
+                size_t chars_size = 0;
+                const auto* chars = buffer(chars_size);
+                const auto offset_at = [&](size_t row) -> int64_t {
+                    if (width == 4) {
+                        int32_t offset = 0;
+                        std::memcpy(&offset, data + row * 4, 4);
+                        return offset;
+                    }
+                    int64_t offset = 0;
+                    std::memcpy(&offset, data + row * 8, 8);
+                    return offset;
+                };
+                column.strings.resize(row_count);
+                for (size_t row = 0; row < row_count; ++row) {
+                    const auto begin = offset_at(row);
+                    const auto end = offset_at(row + 1);
+                    if (begin < 0 || end < begin || static_cast<size_t>(end) > chars_size) {
+                        fail("offsets of column '" + field.name + "' are out of bounds");
+                    }
+                    if (!column.nulls[row]) {
+                        column.strings[row].assign(reinterpret_cast<const char*>(chars + begin),
+                                                   static_cast<size_t>(end - begin));
+                    }
+                }
+                continue;
+            }
+
+            if (data_size < row_count * width) {
+                fail("data of column '" + field.name + "' is too short");
+            }
+            if (field.type == DataType::Real) {
+                column.floats.resize(row_count);
+                if (width == 8) {
+                    std::memcpy(column.floats.data(), data, row_count * 8);
+                } else {
+                    for (size_t row = 0; row < row_count; ++row) {
+                        float value = 0;
+                        std::memcpy(&value, data + row * 4, 4);
+                        column.floats[row] = value;
+                    }
+                }
+                continue;
+            }
+            column.integers.resize(row_count);
+            if (width == 8) {
+                std::memcpy(column.integers.data(), data, row_count * 8);
+                continue;
+            }
+            for (size_t row = 0; row < row_count; ++row) {
+                uint64_t bits = 0;
+                std::memcpy(&bits, data + row * width, width);
+                if (layout.is_signed) {
+                    // Sign-extend from the stored width
+                    const auto shift = 64 - layout.bit_width;
+                    column.integers[row] = static_cast<int64_t>(bits << shift) >> shift;
+                } else {
+                    column.integers[row] = static_cast<int64_t>(bits);
+                }
+            }
+        }
+        return row_count;
+    } catch (const MalformedMetadata& e) {
+        fail(e.what());
+    }
+}
+
+void ArrowFileReader::read_at(int64_t offset, void* data, size_t size) {
+    if (seek(file_, offset, SEEK_SET) != 0 || std::fread(data, 1, size, file_) != size) {
+        fail("unexpected end of file");
+    }
+}
+
+void ArrowFileReader::fail(const std::string& message) const {
+    throw std::runtime_error("Invalid Arrow file '" + path_ + "': " + message);
+}
+
+}  // namespace quiver
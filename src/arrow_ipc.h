@@ -0,0 +1,102 @@
+#ifndef QUIVER_ARROW_IPC_H
+#define QUIVER_ARROW_IPC_H
+
+#include "quiver/data_type.h"
+#include "quiver/scalar_columns.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Arrow IPC file format (Feather V2) writer and reader behind Database::export_collection / import_collection.
+// Only the types a quiver column maps to are handled: 64-bit signed integers, doubles, UTF-8 strings and binary
+// (the BLOB columns of packed vectors and compressed time series), each with an optional validity bitmap. The
+// FlatBuffers metadata is encoded and decoded here directly, so no Arrow or FlatBuffers library is needed; the
+// output reads with pyarrow.feather, Arrow.jl or any other Arrow implementation, and buffers are 8-byte aligned so
+// they can be memory-mapped in place.
+
+namespace quiver {
+
+struct ArrowField {
+    std::string name;
+    DataType type;  // Integer -> Int64, Real -> Float64, Text and DateTime -> Utf8
+    bool nullable = true;
+    bool binary = false;  // Text only: Binary instead of Utf8; the bytes are kept in ScalarColumn::strings
+};
+
+// Location of one record batch message in the file (the Block struct of the footer)
+struct ArrowBlock {
+    int64_t offset;
+    int32_t metadata_length;  // Including the continuation marker and size prefix
+    int64_t body_length;
+};
+
+// Writes one schema and any number of record batches; the footer is written by close()
+class ArrowFileWriter {
+public:
+    // Throws std::runtime_error if path cannot be opened for writing
+    ArrowFileWriter(const std::string& path, std::vector<ArrowField> fields);
+    ~ArrowFileWriter();
+
+    ArrowFileWriter(const ArrowFileWriter&) = delete;
+    ArrowFileWriter& operator=(const ArrowFileWriter&) = delete;
+
+    // Writes columns (one per field, in field order, all the same length) as one record batch.
+    // Text is written as Utf8, so a batch holds at most 2 GiB of string data per column.
+    void write_batch(const std::vector<ScalarColumn>& columns);
+
+    // Writes the footer and closes the file; throws std::runtime_error if any write failed
+    void close();
+
+private:
+    // Writes one encapsulated message and returns its block
+    ArrowBlock write_message(const std::vector<uint8_t>& metadata, const std::vector<uint8_t>& body);
+    void write(const void* data, size_t size);
+
+    std::string path_;
+    std::FILE* file_;
+    std::vector<ArrowField> fields_;
+    std::vector<ArrowBlock> batches_;
+    int64_t offset_ = 0;
+    bool failed_ = false;
+};
+
+// Reads the footer and schema up front, then decodes record batches one at a time on request
+class ArrowFileReader {
+public:
+    // Throws std::runtime_error if path cannot be opened or is not an Arrow IPC file with supported column types
+    explicit ArrowFileReader(const std::string& path);
+    ~ArrowFileReader();
+
+    ArrowFileReader(const ArrowFileReader&) = delete;
+    ArrowFileReader& operator=(const ArrowFileReader&) = delete;
+
+    // Integer columns of any width read as Integer, 32- and 64-bit floats as Real, Utf8 and LargeUtf8 as Text,
+    // Binary and LargeBinary as binary Text
+    const std::vector<ArrowField>& fields() const { return fields_; }
+    size_t batch_count() const { return batches_.size(); }
+
+    // Decodes record batch `index` into columns, one per field; returns its row count
+    size_t read_batch(size_t index, std::vector<ScalarColumn>& columns);
+
+private:
+    struct FieldLayout {
+        int bit_width = 64;  // Int: 8, 16, 32 or 64; FloatingPoint: 32 or 64; (Large)Utf8/Binary: 32/64 (offsets)
+        bool is_signed = true;
+    };
+
+    void read_at(int64_t offset, void* data, size_t size);
+    [[noreturn]] void fail(const std::string& message) const;
+
+    std::string path_;
+    std::FILE* file_;
+    std::vector<ArrowField> fields_;
+    std::vector<FieldLayout> layouts_;
+    std::vector<ArrowBlock> batches_;
+    std::vector<uint8_t> buffer_;  // Metadata and body of the batch being decoded
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_ARROW_IPC_H
@@ -0,0 +1,28 @@
+#include "attribute_cache.h"
+
+#include <algorithm>
+
+namespace quiver {
+
+void AttributeCache::invalidate(const std::string& table) {
+    const auto it = tables_.find(normalize(table));
+    if (it != tables_.end()) {
+        bytes_ -= it->second.bytes;
+        tables_.erase(it);
+    }
+}
+
+void AttributeCache::clear() {
+    tables_.clear();
+    bytes_ = 0;
+}
+
+std::string AttributeCache::normalize(const std::string& table) {
+    std::string name = table;
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) {
+        return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : static_cast<char>(c);
+    });
+    return name;
+}
+
+}  // namespace quiver
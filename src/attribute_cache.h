@@ -0,0 +1,89 @@
+#ifndef QUIVER_ATTRIBUTE_CACHE_H
+#define QUIVER_ATTRIBUTE_CACHE_H
+
+#include "memory_size.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace quiver {
+
+// Read results kept for DatabaseOptions::cache_reads, grouped by the table they were read from.
+// A key names one read (operation, SQL and parameters) and always maps to the same Value type.
+// The update hook drops a table's entries as soon as any of its rows is written; the owner clears
+// everything when it cannot tell which tables changed (rollbacks, schema changes, other connections).
+// With a byte limit, an insert that would pass it empties the cache first; a single result larger than the limit
+// is not kept.
+class AttributeCache {
+public:
+    explicit AttributeCache(std::optional<size_t> limit = std::nullopt) : limit_(limit) {}
+
+    template <typename Value>
+    std::shared_ptr<const Value> find(const std::string& table, const std::string& key) const {
+        auto table_it = tables_.find(normalize(table));
+        if (table_it != tables_.end()) {
+            auto it = table_it->second.entries.find(key);
+            if (it != table_it->second.entries.end()) {
+                ++hits_;
+                return std::static_pointer_cast<const Value>(it->second.value);
+            }
+        }
+        ++misses_;
+        return nullptr;
+    }
+
+    template <typename Value>
+    void insert(const std::string& table, const std::string& key, std::shared_ptr<const Value> value) {
+        const auto size = sizeof(Value) + heap_bytes(*value) + heap_bytes(key) + kEntryOverhead;
+        if (limit_ && size > *limit_) {
+            return;
+        }
+        if (limit_ && bytes_ + size > *limit_) {
+            clear();
+        }
+        auto& entries = tables_[normalize(table)];
+        auto& entry = entries.entries[key];
+        entries.bytes += size - entry.bytes;
+        bytes_ += size - entry.bytes;
+        entry = {std::move(value), size};
+    }
+
+    // Drops the entries read from one table
+    void invalidate(const std::string& table);
+    void clear();
+
+    bool empty() const { return tables_.empty(); }
+    int64_t hits() const { return hits_; }
+    int64_t misses() const { return misses_; }
+    // Estimated bytes held by the cached results and their keys
+    size_t bytes() const { return bytes_; }
+
+private:
+    static constexpr size_t kEntryOverhead = 64;  // Map node, shared_ptr control block
+
+    struct Entry {
+        std::shared_ptr<const void> value;
+        size_t bytes = 0;
+    };
+    struct Table {
+        std::unordered_map<std::string, Entry> entries;
+        size_t bytes = 0;
+    };
+
+    // SQLite table names are case-insensitive, and the update hook reports the declared spelling
+    static std::string normalize(const std::string& table);
+
+    std::unordered_map<std::string, Table> tables_;
+    std::optional<size_t> limit_;
+    size_t bytes_ = 0;
+    mutable int64_t hits_ = 0;
+    mutable int64_t misses_ = 0;
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_ATTRIBUTE_CACHE_H
@@ -0,0 +1,531 @@
+#include "c_api_internal.h"
+#include "quiver/c/arrow.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace {
+
+// FlatVectors offsets are exported as large_list offsets without a copy
+static_assert(sizeof(size_t) == sizeof(int64_t), "Arrow export requires 64-bit size_t");
+
+// Stands in for the data pointer of empty vectors; consumers may dereference buffer pointers even at length 0
+alignas(64) constexpr int64_t kEmptyBuffer[1] = {0};
+
+const void* buffer_pointer(const void* data) {
+    return data ? data : kEmptyBuffer;
+}
+
+void append_validity(std::vector<uint8_t>& validity, size_t row, bool valid) {
+    if (row % 8 == 0) {
+        validity.push_back(0);
+    }
+    if (valid) {
+        validity.back() |= static_cast<uint8_t>(1u << (row % 8));
+    }
+}
+
+// Text in Arrow's large_utf8 layout: int64 offsets into one byte buffer
+struct TextBuffers {
+    std::vector<uint8_t> validity;
+    std::vector<int64_t> offsets{0};
+    std::string data;
+    size_t null_count = 0;
+
+    size_t size() const { return offsets.size() - 1; }
+
+    void push_back(std::string_view value, bool valid) {
+        append_validity(validity, size(), valid);
+        null_count += valid ? 0 : 1;
+        data.append(value);
+        offsets.push_back(static_cast<int64_t>(data.size()));
+    }
+};
+
+struct SchemaHolder {
+    std::string format;
+    std::string name;
+    std::vector<std::unique_ptr<ArrowSchema>> children;
+    std::vector<ArrowSchema*> child_pointers;
+};
+
+// owner keeps the read result the buffers point into alive; children share it or hold their own
+struct ArrayHolder {
+    std::shared_ptr<const void> owner;
+    std::vector<const void*> buffers;
+    std::vector<std::unique_ptr<ArrowArray>> children;
+    std::vector<ArrowArray*> child_pointers;
+};
+
+// Children a consumer moved out have release == nullptr and are left alone, as the specification requires
+void release_schema(ArrowSchema* schema) {
+    auto* holder = static_cast<SchemaHolder*>(schema->private_data);
+    for (auto* child : holder->child_pointers) {
+        if (child->release) {
+            child->release(child);
+        }
+    }
+    delete holder;
+    schema->release = nullptr;
+}
+
+void release_array(ArrowArray* array) {
+    auto* holder = static_cast<ArrayHolder*>(array->private_data);
+    for (auto* child : holder->child_pointers) {
+        if (child->release) {
+            child->release(child);
+        }
+    }
+    delete holder;
+    array->release = nullptr;
+}
+
+void set_schema(ArrowSchema* out, std::string format, std::string name, int64_t flags) {
+    auto holder = std::make_unique<SchemaHolder>();
+    holder->format = std::move(format);
+    holder->name = std::move(name);
+    *out = ArrowSchema{};
+    out->format = holder->format.c_str();
+    out->name = holder->name.c_str();
+    out->flags = flags;
+    out->release = release_schema;
+    out->private_data = holder.release();
+}
+
+// Appends an unset child to a schema set_schema has filled; the caller fills it next
+ArrowSchema* add_child(ArrowSchema* parent) {
+    auto* holder = static_cast<SchemaHolder*>(parent->private_data);
+    auto* child = holder->children.emplace_back(std::make_unique<ArrowSchema>()).get();
+    holder->child_pointers.push_back(child);
+    parent->n_children = static_cast<int64_t>(holder->child_pointers.size());
+    parent->children = holder->child_pointers.data();
+    return child;
+}
+
+void set_array(ArrowArray* out,
+               size_t length,
+               size_t null_count,
+               std::shared_ptr<const void> owner,
+               std::vector<const void*> buffers) {
+    auto holder = std::make_unique<ArrayHolder>();
+    holder->owner = std::move(owner);
+    holder->buffers = std::move(buffers);
+    *out = ArrowArray{};
+    out->length = static_cast<int64_t>(length);
+    out->null_count = static_cast<int64_t>(null_count);
+    out->n_buffers = static_cast<int64_t>(holder->buffers.size());
+    out->buffers = holder->buffers.empty() ? nullptr : holder->buffers.data();
+    out->release = release_array;
+    out->private_data = holder.release();
+}
+
+ArrowArray* add_child(ArrowArray* parent) {
+    auto* holder = static_cast<ArrayHolder*>(parent->private_data);
+    auto* child = holder->children.emplace_back(std::make_unique<ArrowArray>()).get();
+    holder->child_pointers.push_back(child);
+    parent->n_children = static_cast<int64_t>(holder->child_pointers.size());
+    parent->children = holder->child_pointers.data();
+    return child;
+}
+
+// Builds the export locally and only hands it to the caller once complete, so a failure part way through releases
+// whatever was already built instead of leaking it or leaving the caller's structs half filled
+struct ArrowExport {
+    ArrowSchema schema{};
+    ArrowArray array{};
+
+    ~ArrowExport() {
+        if (schema.release) {
+            schema.release(&schema);
+        }
+        if (array.release) {
+            array.release(&array);
+        }
+    }
+
+    void hand_over(ArrowSchema* out_schema, ArrowArray* out_array) {
+        *out_schema = schema;
+        *out_array = array;
+        schema.release = nullptr;
+        array.release = nullptr;
+    }
+};
+
+template <typename T>
+constexpr const char* numeric_format() {
+    return std::is_same_v<T, int64_t> ? "l" : "g";
+}
+
+template <typename T>
+void export_column(std::shared_ptr<quiver::NullableColumn<T>> column,
+                   const std::string& name,
+                   ArrowSchema* schema,
+                   ArrowArray* array) {
+    set_schema(schema, numeric_format<T>(), name, ARROW_FLAG_NULLABLE);
+    const auto null_count = column->null_count();
+    const void* validity = null_count > 0 ? column->validity.data() : nullptr;
+    const void* values = buffer_pointer(column->values.data());
+    const auto length = column->size();
+    set_array(array, length, null_count, std::move(column), {validity, values});
+}
+
+// As large_utf8, or large_binary ("Z") for BLOB bytes
+void export_column(std::shared_ptr<TextBuffers> column,
+                   const std::string& name,
+                   ArrowSchema* schema,
+                   ArrowArray* array,
+                   const char* format = "U") {
+    set_schema(schema, format, name, ARROW_FLAG_NULLABLE);
+    const void* validity = column->null_count > 0 ? column->validity.data() : nullptr;
+    const void* offsets = column->offsets.data();
+    const void* data = column->data.data();
+    const auto length = column->size();
+    const auto null_count = column->null_count;
+    set_array(array, length, null_count, std::move(column), {validity, offsets, data});
+}
+
+std::shared_ptr<TextBuffers> to_text_buffers(const quiver::NullableColumn<std::string>& column) {
+    auto text = std::make_shared<TextBuffers>();
+    text->offsets.reserve(column.size() + 1);
+    for (size_t row = 0; row < column.size(); ++row) {
+        text->push_back(column.values[row], column.is_valid(row));
+    }
+    return text;
+}
+
+// One list per group; the child array of values shares ownership of the groups with the list array
+template <typename T>
+void export_groups(std::shared_ptr<quiver::FlatVectors<T>> groups,
+                   const std::string& name,
+                   ArrowSchema* schema,
+                   ArrowArray* array) {
+    set_schema(schema, "+L", name, ARROW_FLAG_NULLABLE);
+    const auto length = groups->size();
+    const void* offsets = groups->offsets.data();
+
+    if constexpr (std::is_same_v<T, std::string>) {
+        auto text = std::make_shared<TextBuffers>();
+        text->offsets.reserve(groups->values.size() + 1);
+        for (const auto& value : groups->values) {
+            text->push_back(value, true);
+        }
+        set_array(array, length, 0, groups, {nullptr, offsets});
+        export_column(std::move(text), "item", add_child(schema), add_child(array));
+    } else {
+        const void* values = buffer_pointer(groups->values.data());
+        const auto value_count = groups->values.size();
+        set_array(array, length, 0, groups, {nullptr, offsets});
+        set_schema(add_child(schema), numeric_format<T>(), "item", ARROW_FLAG_NULLABLE);
+        set_array(add_child(array), value_count, 0, std::move(groups), {nullptr, values});
+    }
+}
+
+template <typename T>
+void export_groups(quiver::FlatVectors<T>&& groups,
+                   const std::string& name,
+                   ArrowSchema* out_schema,
+                   ArrowArray* out_array) {
+    ArrowExport result;
+    export_groups(std::make_shared<quiver::FlatVectors<T>>(std::move(groups)), name, &result.schema, &result.array);
+    result.hand_over(out_schema, out_array);
+}
+
+// Accumulates one query result column; its type is set by the first non-NULL value, and the NULLs seen before
+// that are filled in once it is known. An integer column becomes float64 at its first REAL value (the integers
+// already read are widened); any other mix of storage classes is an error rather than a silent NULL.
+class QueryColumn {
+public:
+    explicit QueryColumn(std::string name) : name_(std::move(name)) {}
+
+    void push_back(const quiver::Value& value) {
+        if (std::holds_alternative<std::nullptr_t>(value)) {
+            push_null();
+            return;
+        }
+        if (kind_ == Kind::null) {
+            start(value);
+        }
+        if (kind_ == Kind::integer && std::holds_alternative<double>(value)) {
+            widen_to_real();
+        }
+        switch (kind_) {
+        case Kind::integer:
+            if (const auto* integer = std::get_if<int64_t>(&value)) {
+                integers_->push_back(*integer, true);
+                return;
+            }
+            break;
+        case Kind::real:
+            if (const auto* real = std::get_if<double>(&value)) {
+                floats_->push_back(*real, true);
+                return;
+            }
+            if (const auto* integer = std::get_if<int64_t>(&value)) {
+                floats_->push_back(static_cast<double>(*integer), true);
+                return;
+            }
+            break;
+        case Kind::text:
+            if (const auto* text = std::get_if<std::string>(&value)) {
+                texts_->push_back(*text, true);
+                return;
+            }
+            break;
+        case Kind::binary:
+            if (const auto* blob = std::get_if<quiver::Blob>(&value)) {
+                texts_->push_back(std::string_view(reinterpret_cast<const char*>(blob->data()), blob->size()), true);
+                return;
+            }
+            break;
+        case Kind::null:
+            return;
+        }
+        throw std::runtime_error("Query column '" + name_ + "' mixes " + kind_name(kind_) + " and " +
+                                 value_kind_name(value) + " values");
+    }
+
+    void export_to(ArrowSchema* schema, ArrowArray* array) {
+        switch (kind_) {
+        case Kind::integer:
+            export_column(std::move(integers_), name_, schema, array);
+            break;
+        case Kind::real:
+            export_column(std::move(floats_), name_, schema, array);
+            break;
+        case Kind::text:
+            export_column(std::move(texts_), name_, schema, array);
+            break;
+        case Kind::binary:
+            export_column(std::move(texts_), name_, schema, array, "Z");
+            break;
+        case Kind::null:
+            set_schema(schema, "n", name_, ARROW_FLAG_NULLABLE);
+            set_array(array, leading_nulls_, leading_nulls_, nullptr, {});
+            break;
+        }
+    }
+
+private:
+    enum class Kind { null, integer, real, text, binary };
+
+    void push_null() {
+        switch (kind_) {
+        case Kind::integer:
+            integers_->push_back(0, false);
+            break;
+        case Kind::real:
+            floats_->push_back(0.0, false);
+            break;
+        case Kind::text:
+        case Kind::binary:
+            texts_->push_back({}, false);
+            break;
+        case Kind::null:
+            ++leading_nulls_;
+            break;
+        }
+    }
+
+    void widen_to_real() {
+        floats_ = std::make_shared<quiver::NullableColumn<double>>();
+        for (size_t row = 0; row < integers_->size(); ++row) {
+            const auto valid = integers_->is_valid(row);
+            floats_->push_back(valid ? static_cast<double>(integers_->values[row]) : 0.0, valid);
+        }
+        integers_.reset();
+        kind_ = Kind::real;
+    }
+
+    static const char* kind_name(Kind kind) {
+        switch (kind) {
+        case Kind::integer:
+        case Kind::real:
+            return "numeric";
+        case Kind::text:
+            return "text";
+        case Kind::binary:
+            return "BLOB";
+        case Kind::null:
+            break;
+        }
+        return "NULL";
+    }
+
+    static const char* value_kind_name(const quiver::Value& value) {
+        if (std::holds_alternative<std::string>(value)) {
+            return "text";
+        }
+        if (std::holds_alternative<quiver::Blob>(value)) {
+            return "BLOB";
+        }
+        return "numeric";
+    }
+
+    void start(const quiver::Value& value) {
+        if (std::holds_alternative<int64_t>(value)) {
+            kind_ = Kind::integer;
+            integers_ = std::make_shared<quiver::NullableColumn<int64_t>>();
+        } else if (std::holds_alternative<double>(value)) {
+            kind_ = Kind::real;
+            floats_ = std::make_shared<quiver::NullableColumn<double>>();
+        } else {
+            kind_ = std::holds_alternative<quiver::Blob>(value) ? Kind::binary : Kind::text;
+            texts_ = std::make_shared<TextBuffers>();
+        }
+        for (size_t row = 0; row < leading_nulls_; ++row) {
+            push_null();
+        }
+    }
+
+    std::string name_;
+    Kind kind_ = Kind::null;
+    size_t leading_nulls_ = 0;
+    std::shared_ptr<quiver::NullableColumn<int64_t>> integers_;
+    std::shared_ptr<quiver::NullableColumn<double>> floats_;
+    std::shared_ptr<TextBuffers> texts_;
+};
+
+}  // namespace
+
+extern "C" {
+
+#define QUIVER_ARROW_ARGUMENTS_VALID(db, collection, attribute, out_schema, out_array)                                 \
+    ((db) && (collection) && (attribute) && (out_schema) && (out_array))
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_arrow(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      ArrowSchema* out_schema,
+                                                                      ArrowArray* out_array) {
+    if (!QUIVER_ARROW_ARGUMENTS_VALID(db, collection, attribute, out_schema, out_array)) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto column = std::make_shared<quiver::NullableColumn<int64_t>>(
+            db->db.read_scalar_integers_nullable(collection, attribute));
+        ArrowExport result;
+        export_column(std::move(column), attribute, &result.schema, &result.array);
+        result.hand_over(out_schema, out_array);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_arrow(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const char* attribute,
+                                                                    ArrowSchema* out_schema,
+                                                                    ArrowArray* out_array) {
+    if (!QUIVER_ARROW_ARGUMENTS_VALID(db, collection, attribute, out_schema, out_array)) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto column =
+            std::make_shared<quiver::NullableColumn<double>>(db->db.read_scalar_floats_nullable(collection, attribute));
+        ArrowExport result;
+        export_column(std::move(column), attribute, &result.schema, &result.array);
+        result.hand_over(out_schema, out_array);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_arrow(quiver_database_t* db,
+                                                                     const char* collection,
+                                                                     const char* attribute,
+                                                                     ArrowSchema* out_schema,
+                                                                     ArrowArray* out_array) {
+    if (!QUIVER_ARROW_ARGUMENTS_VALID(db, collection, attribute, out_schema, out_array)) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto column = to_text_buffers(db->db.read_scalar_strings_nullable(collection, attribute));
+        ArrowExport result;
+        export_column(std::move(column), attribute, &result.schema, &result.array);
+        result.hand_over(out_schema, out_array);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+// Vector and set exports differ only in the read they wrap
+#define QUIVER_GROUP_ARROW_EXPORT(function, reader)                                                                    \
+    QUIVER_C_API quiver_error_t function(quiver_database_t* db,                                                        \
+                                         const char* collection,                                                       \
+                                         const char* attribute,                                                        \
+                                         ArrowSchema* out_schema,                                                      \
+                                         ArrowArray* out_array) {                                                      \
+        if (!QUIVER_ARROW_ARGUMENTS_VALID(db, collection, attribute, out_schema, out_array)) {                         \
+            return QUIVER_ERROR_INVALID_ARGUMENT;                                                                      \
+        }                                                                                                              \
+        try {                                                                                                          \
+            const auto ids = db->db.read_element_ids(collection);                                                      \
+            export_groups(db->db.reader(collection, attribute, ids), attribute, out_schema, out_array);                \
+            return QUIVER_OK;                                                                                          \
+        } catch (const std::exception& e) {                                                                            \
+            quiver_set_last_error(e.what());                                                                           \
+            return QUIVER_ERROR_DATABASE;                                                                              \
+        }                                                                                                              \
+    }
+
+QUIVER_GROUP_ARROW_EXPORT(quiver_database_read_vector_integers_arrow, read_vector_integers_by_ids)
+QUIVER_GROUP_ARROW_EXPORT(quiver_database_read_vector_floats_arrow, read_vector_floats_by_ids)
+QUIVER_GROUP_ARROW_EXPORT(quiver_database_read_vector_strings_arrow, read_vector_strings_by_ids)
+QUIVER_GROUP_ARROW_EXPORT(quiver_database_read_set_integers_arrow, read_set_integers_by_ids)
+QUIVER_GROUP_ARROW_EXPORT(quiver_database_read_set_floats_arrow, read_set_floats_by_ids)
+QUIVER_GROUP_ARROW_EXPORT(quiver_database_read_set_strings_arrow, read_set_strings_by_ids)
+
+#undef QUIVER_GROUP_ARROW_EXPORT
+#undef QUIVER_ARROW_ARGUMENTS_VALID
+
+QUIVER_C_API quiver_error_t quiver_database_query_arrow(quiver_database_t* db,
+                                                       const char* sql,
+                                                       const int* param_types,
+                                                       const void* const* param_values,
+                                                       size_t param_count,
+                                                       ArrowSchema* out_schema,
+                                                       ArrowArray* out_array) {
+    if (!db || !sql || !out_schema || !out_array || (param_count > 0 && (!param_types || !param_values))) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto cursor = db->db.cursor(sql, convert_params(param_types, param_values, param_count));
+        std::vector<QueryColumn> columns;
+        columns.reserve(cursor.column_count());
+        for (const auto& name : cursor.columns()) {
+            columns.emplace_back(name);
+        }
+        size_t rows = 0;
+        while (cursor.next()) {
+            for (size_t column = 0; column < columns.size(); ++column) {
+                columns[column].push_back(cursor.value(column));
+            }
+            ++rows;
+        }
+
+        ArrowExport result;
+        set_schema(&result.schema, "+s", "", 0);
+        set_array(&result.array, rows, 0, nullptr, {nullptr});
+        for (auto& column : columns) {
+            column.export_to(add_child(&result.schema), add_child(&result.array));
+        }
+        result.hand_over(out_schema, out_array);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+}  // extern "C"
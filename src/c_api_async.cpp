@@ -0,0 +1,358 @@
+#include "c_api_internal.h"
+#include "quiver/c/async.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+
+namespace {
+
+// Runs on the worker; returns the read's result, or nullptr for operations without one
+using Operation = std::function<quiver_result*(quiver::Database&)>;
+
+struct FutureState {
+    Operation operation;
+    std::atomic<bool> cancel_requested{false};
+
+    std::mutex mutex;
+    std::condition_variable completed;
+    bool done = false;
+    quiver_error_t status = QUIVER_OK;
+    std::string error;
+    std::unique_ptr<quiver_result> result;
+
+    void finish(quiver_error_t code, std::string message, std::unique_ptr<quiver_result> value) {
+        {
+            std::lock_guard lock(mutex);
+            done = true;
+            status = code;
+            error = std::move(message);
+            result = std::move(value);
+        }
+        completed.notify_all();
+    }
+};
+
+// Shared by a worker and its futures, so cancelling after the database closed never touches the connection
+struct WorkerControl {
+    std::mutex mutex;
+    quiver::Database* db = nullptr;
+    const FutureState* running = nullptr;
+};
+
+}  // namespace
+
+struct quiver_future {
+    std::shared_ptr<FutureState> state;
+    std::shared_ptr<WorkerControl> control;
+};
+
+struct AsyncWorker {
+    std::shared_ptr<WorkerControl> control = std::make_shared<WorkerControl>();
+    std::mutex queue_mutex;
+    std::condition_variable queue_changed;
+    std::deque<std::shared_ptr<FutureState>> queue;
+    bool stopping = false;
+    std::thread thread;
+
+    explicit AsyncWorker(quiver::Database& db) {
+        control->db = &db;
+        thread = std::thread([this] { run(); });
+    }
+
+    void submit(std::shared_ptr<FutureState> state) {
+        {
+            std::lock_guard lock(queue_mutex);
+            queue.push_back(std::move(state));
+        }
+        queue_changed.notify_one();
+    }
+
+    void run() {
+        for (;;) {
+            std::shared_ptr<FutureState> state;
+            {
+                std::unique_lock lock(queue_mutex);
+                queue_changed.wait(lock, [this] { return stopping || !queue.empty(); });
+                if (queue.empty()) {
+                    return;
+                }
+                state = std::move(queue.front());
+                queue.pop_front();
+            }
+            if (state->cancel_requested) {
+                state->finish(QUIVER_ERROR_CANCELLED, "Operation cancelled", nullptr);
+                continue;
+            }
+
+            {
+                std::lock_guard lock(control->mutex);
+                control->running = state.get();
+            }
+            quiver_error_t status = QUIVER_OK;
+            std::string error;
+            std::unique_ptr<quiver_result> result;
+            try {
+                result.reset(state->operation(*control->db));
+            } catch (const std::bad_alloc&) {
+                status = QUIVER_ERROR_DATABASE;
+                error = "Out of memory";
+            } catch (const std::exception& e) {
+                status = QUIVER_ERROR_DATABASE;
+                error = e.what();
+            }
+            {
+                std::lock_guard lock(control->mutex);
+                control->running = nullptr;
+            }
+            if (status != QUIVER_OK && state->cancel_requested) {
+                status = QUIVER_ERROR_CANCELLED;
+            }
+            state->operation = nullptr;
+            state->finish(status, std::move(error), std::move(result));
+        }
+    }
+
+    void stop() {
+        {
+            std::lock_guard lock(queue_mutex);
+            stopping = true;
+            for (const auto& state : queue) {
+                state->cancel_requested = true;
+            }
+        }
+        queue_changed.notify_one();
+        {
+            std::lock_guard lock(control->mutex);
+            if (control->running) {
+                control->db->interrupt();
+            }
+        }
+        thread.join();
+        std::lock_guard lock(control->mutex);
+        control->db = nullptr;
+    }
+};
+
+void AsyncWorkerDeleter::operator()(AsyncWorker* worker) const {
+    worker->stop();
+    delete worker;
+}
+
+namespace {
+
+quiver_error_t submit(quiver_database_t* db, Operation operation, quiver_future_t** out_future) {
+    try {
+        if (!db->worker) {
+            db->worker.reset(new AsyncWorker(db->db));
+        }
+        auto state = std::make_shared<FutureState>();
+        state->operation = std::move(operation);
+        *out_future = new quiver_future{state, db->worker->control};
+        db->worker->submit(std::move(state));
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        *out_future = nullptr;
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+template <typename T>
+quiver_result* make_grouped_result(quiver::FlatVectors<T>&& groups) {
+    auto* result = make_result(std::move(groups.values));
+    result->offsets = std::move(groups.offsets);
+    return result;
+}
+
+// Collection and attribute are copied: the caller's strings only have to live until the call returns
+template <typename Read>
+quiver_error_t submit_read(quiver_database_t* db,
+                           const char* collection,
+                           const char* attribute,
+                           quiver_future_t** out_future,
+                           Read read) {
+    if (!db || !collection || !attribute || !out_future) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    return submit(
+        db,
+        [read, collection = std::string(collection), attribute = std::string(attribute)](quiver::Database& d) {
+            return read(d, collection, attribute);
+        },
+        out_future);
+}
+
+template <typename Transfer>
+quiver_error_t submit_transfer(quiver_database_t* db,
+                               const char* name,
+                               const char* path,
+                               quiver_future_t** out_future,
+                               Transfer run) {
+    if (!db || !name || !path || !out_future) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    return submit(
+        db,
+        [run, name = std::string(name), path = std::string(path)](quiver::Database& d) -> quiver_result* {
+            run(d, name, path);
+            return nullptr;
+        },
+        out_future);
+}
+
+}  // namespace
+
+extern "C" {
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_async(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* attribute,
+                                                                       quiver_future_t** out_future) {
+    return submit_read(db, collection, attribute, out_future, [](quiver::Database& d, const auto& c, const auto& a) {
+        return make_result(d.read_scalar_integers(c, a));
+    });
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_async(quiver_database_t* db,
+                                                                     const char* collection,
+                                                                     const char* attribute,
+                                                                     quiver_future_t** out_future) {
+    return submit_read(db, collection, attribute, out_future, [](quiver::Database& d, const auto& c, const auto& a) {
+        return make_result(d.read_scalar_floats(c, a));
+    });
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_async(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      quiver_future_t** out_future) {
+    return submit_read(db, collection, attribute, out_future, [](quiver::Database& d, const auto& c, const auto& a) {
+        return make_result(d.read_scalar_strings(c, a));
+    });
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_integers_async(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* attribute,
+                                                                       quiver_future_t** out_future) {
+    return submit_read(db, collection, attribute, out_future, [](quiver::Database& d, const auto& c, const auto& a) {
+        return make_grouped_result(d.read_vector_integers_flat(c, a));
+    });
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_floats_async(quiver_database_t* db,
+                                                                     const char* collection,
+                                                                     const char* attribute,
+                                                                     quiver_future_t** out_future) {
+    return submit_read(db, collection, attribute, out_future, [](quiver::Database& d, const auto& c, const auto& a) {
+        return make_grouped_result(d.read_vector_floats_flat(c, a));
+    });
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_strings_async(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      quiver_future_t** out_future) {
+    return submit_read(db, collection, attribute, out_future, [](quiver::Database& d, const auto& c, const auto& a) {
+        return make_grouped_result(d.read_vector_strings_flat(c, a));
+    });
+}
+
+QUIVER_C_API quiver_error_t quiver_database_export_to_csv_async(quiver_database_t* db,
+                                                                const char* table,
+                                                                const char* path,
+                                                                quiver_future_t** out_future) {
+    return submit_transfer(db, table, path, out_future, [](quiver::Database& d, const auto& t, const auto& p) {
+        d.export_to_csv(t, p);
+    });
+}
+
+QUIVER_C_API quiver_error_t quiver_database_import_from_csv_async(quiver_database_t* db,
+                                                                  const char* table,
+                                                                  const char* path,
+                                                                  quiver_future_t** out_future) {
+    return submit_transfer(db, table, path, out_future, [](quiver::Database& d, const auto& t, const auto& p) {
+        d.import_from_csv(t, p);
+    });
+}
+
+QUIVER_C_API quiver_error_t quiver_database_export_collection_async(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const char* directory,
+                                                                    quiver_future_t** out_future) {
+    return submit_transfer(
+        db, collection, directory, out_future, [](quiver::Database& d, const auto& c, const auto& p) {
+            d.export_collection(c, p);
+        });
+}
+
+QUIVER_C_API quiver_error_t quiver_database_import_collection_async(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const char* directory,
+                                                                    quiver_future_t** out_future) {
+    return submit_transfer(
+        db, collection, directory, out_future, [](quiver::Database& d, const auto& c, const auto& p) {
+            d.import_collection(c, p);
+        });
+}
+
+QUIVER_C_API quiver_error_t quiver_future_wait(quiver_future_t* future, int64_t timeout_ms, int* out_done) {
+    if (!future || !out_done) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    auto& state = *future->state;
+    std::unique_lock lock(state.mutex);
+    if (timeout_ms < 0) {
+        state.completed.wait(lock, [&state] { return state.done; });
+    } else {
+        state.completed.wait_for(lock, std::chrono::milliseconds(timeout_ms), [&state] { return state.done; });
+    }
+    *out_done = state.done ? 1 : 0;
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_future_cancel(quiver_future_t* future) {
+    if (!future) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    future->state->cancel_requested = true;
+    // Only interrupt while this operation is the one running, so a later operation is never hit
+    std::lock_guard lock(future->control->mutex);
+    if (future->control->running == future->state.get()) {
+        future->control->db->interrupt();
+    }
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_future_result(quiver_future_t* future, quiver_result_t** out_result) {
+    if (!future) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    auto& state = *future->state;
+    std::lock_guard lock(state.mutex);
+    if (!state.done) {
+        quiver_set_last_error("Operation has not completed");
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    if (state.status != QUIVER_OK) {
+        quiver_set_last_error(state.error);
+        return state.status;
+    }
+    if (out_result) {
+        *out_result = state.result.release();
+    }
+    return QUIVER_OK;
+}
+
+QUIVER_C_API void quiver_future_free(quiver_future_t* future) {
+    delete future;
+}
+
+}  // extern "C"
@@ -0,0 +1,202 @@
+#include "c_api_internal.h"
+#include "quiver/c/attribute_handle.h"
+
+#include <algorithm>
+#include <new>
+#include <string>
+
+namespace {
+
+// Copies values into buffer (at most capacity) and reports the full count
+template <typename T>
+void copy_into(const std::vector<T>& values, T* buffer, size_t capacity, size_t* out_count) {
+    std::copy_n(values.begin(), std::min(values.size(), capacity), buffer);
+    *out_count = values.size();
+}
+
+}  // namespace
+
+extern "C" {
+
+QUIVER_C_API quiver_error_t quiver_database_attribute_handle(quiver_database_t* db,
+                                                             const char* collection,
+                                                             const char* attribute,
+                                                             quiver_attribute_handle_t** out_handle) {
+    if (!db || !collection || !attribute || !out_handle) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        *out_handle = new quiver_attribute_handle{db->db.attribute_handle(collection, attribute)};
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        *out_handle = nullptr;
+        return QUIVER_ERROR_DATABASE;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        *out_handle = nullptr;
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API void quiver_attribute_handle_free(quiver_attribute_handle_t* handle) {
+    delete handle;
+}
+
+QUIVER_C_API quiver_error_t quiver_attribute_handle_info(const quiver_attribute_handle_t* handle,
+                                                         quiver_data_structure_t* out_structure,
+                                                         quiver_data_type_t* out_type) {
+    if (!handle || !out_structure || !out_type) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    *out_structure = handle->handle.data_structure() == quiver::DataStructure::Scalar ? QUIVER_DATA_STRUCTURE_SCALAR
+                                                                                       : QUIVER_DATA_STRUCTURE_VECTOR;
+    *out_type = to_c_data_type(handle->handle.data_type());
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integer_by_handle(quiver_database_t* db,
+                                                                          const quiver_attribute_handle_t* handle,
+                                                                          int64_t id,
+                                                                          int64_t* out_value,
+                                                                          int* out_has_value) {
+    if (!db || !handle || !out_value || !out_has_value) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto result = db->db.read_scalar_integers_by_id(handle->handle, id);
+        *out_has_value = result.has_value() ? 1 : 0;
+        if (result) {
+            *out_value = *result;
+        }
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_float_by_handle(quiver_database_t* db,
+                                                                        const quiver_attribute_handle_t* handle,
+                                                                        int64_t id,
+                                                                        double* out_value,
+                                                                        int* out_has_value) {
+    if (!db || !handle || !out_value || !out_has_value) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto result = db->db.read_scalar_floats_by_id(handle->handle, id);
+        *out_has_value = result.has_value() ? 1 : 0;
+        if (result) {
+            *out_value = *result;
+        }
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_string_by_handle(quiver_database_t* db,
+                                                                         const quiver_attribute_handle_t* handle,
+                                                                         int64_t id,
+                                                                         char** out_value,
+                                                                         int* out_has_value) {
+    if (!db || !handle || !out_value || !out_has_value) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto result = db->db.read_scalar_strings_by_id(handle->handle, id);
+        *out_has_value = result.has_value() ? 1 : 0;
+        *out_value = result ? strdup_safe(*result) : nullptr;
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_integers_by_handle(quiver_database_t* db,
+                                                                           const quiver_attribute_handle_t* handle,
+                                                                           int64_t id,
+                                                                           int64_t* buffer,
+                                                                           size_t capacity,
+                                                                           size_t* out_count) {
+    if (!db || !handle || !out_count || (!buffer && capacity > 0)) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        copy_into(db->db.read_vector_integers_by_id(handle->handle, id), buffer, capacity, out_count);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_floats_by_handle(quiver_database_t* db,
+                                                                         const quiver_attribute_handle_t* handle,
+                                                                         int64_t id,
+                                                                         double* buffer,
+                                                                         size_t capacity,
+                                                                         size_t* out_count) {
+    if (!db || !handle || !out_count || (!buffer && capacity > 0)) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        copy_into(db->db.read_vector_floats_by_id(handle->handle, id), buffer, capacity, out_count);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_update_scalar_integer_by_handle(quiver_database_t* db,
+                                                                            const quiver_attribute_handle_t* handle,
+                                                                            int64_t id,
+                                                                            int64_t value) {
+    if (!db || !handle) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        db->db.update_scalar_integer(handle->handle, id, value);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_update_scalar_float_by_handle(quiver_database_t* db,
+                                                                          const quiver_attribute_handle_t* handle,
+                                                                          int64_t id,
+                                                                          double value) {
+    if (!db || !handle) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        db->db.update_scalar_float(handle->handle, id, value);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_update_scalar_string_by_handle(quiver_database_t* db,
+                                                                           const quiver_attribute_handle_t* handle,
+                                                                           int64_t id,
+                                                                           const char* value) {
+    if (!db || !handle || !value) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        db->db.update_scalar_string(handle->handle, id, value);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+}  // extern "C"
@@ -1,6 +1,9 @@
 #include "c_api_internal.h"
 #include "quiver/c/common.h"
+#include "quiver/c/database.h"
 
+#include <algorithm>
+#include <stdexcept>
 #include <string>
 
 // Thread-local storage for error messages
@@ -14,6 +17,52 @@ void quiver_set_last_error(const char* message) {
     g_last_error = message ? message : "";
 }
 
+char* strdup_safe(const std::string& str) {
+    char* result = new char[str.size() + 1];
+    std::copy(str.begin(), str.end(), result);
+    result[str.size()] = '\0';
+    return result;
+}
+
+quiver_data_type_t to_c_data_type(quiver::DataType type) {
+    switch (type) {
+    case quiver::DataType::Integer:
+        return QUIVER_DATA_TYPE_INTEGER;
+    case quiver::DataType::Real:
+        return QUIVER_DATA_TYPE_FLOAT;
+    case quiver::DataType::Text:
+        return QUIVER_DATA_TYPE_STRING;
+    case quiver::DataType::DateTime:
+        return QUIVER_DATA_TYPE_DATE_TIME;
+    }
+    return QUIVER_DATA_TYPE_INTEGER;
+}
+
+std::vector<quiver::Value>
+convert_params(const int* param_types, const void* const* param_values, size_t param_count) {
+    std::vector<quiver::Value> params;
+    params.reserve(param_count);
+    for (size_t i = 0; i < param_count; ++i) {
+        switch (param_types[i]) {
+        case QUIVER_DATA_TYPE_INTEGER:
+            params.emplace_back(*static_cast<const int64_t*>(param_values[i]));
+            break;
+        case QUIVER_DATA_TYPE_FLOAT:
+            params.emplace_back(*static_cast<const double*>(param_values[i]));
+            break;
+        case QUIVER_DATA_TYPE_STRING:
+            params.emplace_back(std::string(static_cast<const char*>(param_values[i])));
+            break;
+        case QUIVER_DATA_TYPE_NULL:
+            params.emplace_back(nullptr);
+            break;
+        default:
+            throw std::runtime_error("Unknown parameter type: " + std::to_string(param_types[i]));
+        }
+    }
+    return params;
+}
+
 extern "C" {
 
 QUIVER_C_API const char* quiver_get_last_error(void) {
@@ -40,6 +89,8 @@ QUIVER_C_API const char* quiver_error_string(quiver_error_t error) {
         return "Failed to create element";
     case QUIVER_ERROR_NOT_FOUND:
         return "Not found";
+    case QUIVER_ERROR_CANCELLED:
+        return "Operation cancelled";
     default:
         return "Unknown error";
     }
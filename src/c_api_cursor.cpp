@@ -0,0 +1,230 @@
+#include "c_api_internal.h"
+#include "quiver/c/cursor.h"
+
+#include <algorithm>
+#include <new>
+#include <string>
+#include <variant>
+#include <vector>
+
+extern "C" {
+
+QUIVER_C_API quiver_error_t quiver_database_open_cursor(quiver_database_t* db,
+                                                        const char* sql,
+                                                        const int* param_types,
+                                                        const void* const* param_values,
+                                                        size_t param_count,
+                                                        quiver_cursor_t** out_cursor) {
+    if (!db || !sql || !out_cursor || (param_count > 0 && (!param_types || !param_values))) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto params = convert_params(param_types, param_values, param_count);
+        *out_cursor = new quiver_cursor(db->db.cursor(sql, params));
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        *out_cursor = nullptr;
+        return QUIVER_ERROR_DATABASE;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        *out_cursor = nullptr;
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_open_scalars_cursor(quiver_database_t* db,
+                                                                const char* collection,
+                                                                const char* const* attributes,
+                                                                size_t attribute_count,
+                                                                quiver_cursor_t** out_cursor) {
+    if (!db || !collection || !out_cursor || (attribute_count > 0 && !attributes)) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        std::vector<std::string> names(attributes, attributes + attribute_count);
+        *out_cursor = new quiver_cursor(db->db.cursor_scalars(collection, names));
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        *out_cursor = nullptr;
+        return QUIVER_ERROR_DATABASE;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        *out_cursor = nullptr;
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_open_vector_cursor(quiver_database_t* db,
+                                                               const char* collection,
+                                                               const char* attribute,
+                                                               quiver_cursor_t** out_cursor) {
+    if (!db || !collection || !attribute || !out_cursor) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        *out_cursor = new quiver_cursor(db->db.cursor_vector(collection, attribute));
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        *out_cursor = nullptr;
+        return QUIVER_ERROR_DATABASE;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        *out_cursor = nullptr;
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API void quiver_cursor_free(quiver_cursor_t* cursor) {
+    delete cursor;
+}
+
+QUIVER_C_API quiver_error_t quiver_cursor_next(quiver_cursor_t* cursor, int* out_has_row) {
+    if (!cursor || !out_has_row) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        *out_has_row = cursor->cursor.next() ? 1 : 0;
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        *out_has_row = 0;
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_cursor_column_count(quiver_cursor_t* cursor, size_t* out_count) {
+    if (!cursor || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    *out_count = cursor->cursor.column_count();
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_cursor_column_name(quiver_cursor_t* cursor, size_t column, const char** out_name) {
+    if (!cursor || !out_name) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    const auto& columns = cursor->cursor.columns();
+    if (column >= columns.size()) {
+        quiver_set_last_error("Column index out of range: " + std::to_string(column));
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    *out_name = columns[column].c_str();
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_cursor_column_type(quiver_cursor_t* cursor,
+                                                      size_t column,
+                                                      quiver_data_type_t* out_type) {
+    if (!cursor || !out_type) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        const auto value = cursor->cursor.value(column);
+        if (std::holds_alternative<int64_t>(value)) {
+            *out_type = QUIVER_DATA_TYPE_INTEGER;
+        } else if (std::holds_alternative<double>(value)) {
+            *out_type = QUIVER_DATA_TYPE_FLOAT;
+        } else if (std::holds_alternative<std::string>(value)) {
+            *out_type = QUIVER_DATA_TYPE_STRING;
+        } else if (std::holds_alternative<quiver::Blob>(value)) {
+            *out_type = QUIVER_DATA_TYPE_BLOB;
+        } else {
+            *out_type = QUIVER_DATA_TYPE_NULL;
+        }
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_cursor_get_integer(quiver_cursor_t* cursor,
+                                                      size_t column,
+                                                      int64_t* out_value,
+                                                      int* out_has_value) {
+    if (!cursor || !out_value || !out_has_value) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        const auto value = cursor->cursor.get_integer(column);
+        *out_has_value = value.has_value() ? 1 : 0;
+        *out_value = value.value_or(0);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_cursor_get_float(quiver_cursor_t* cursor,
+                                                    size_t column,
+                                                    double* out_value,
+                                                    int* out_has_value) {
+    if (!cursor || !out_value || !out_has_value) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        const auto value = cursor->cursor.get_float(column);
+        *out_has_value = value.has_value() ? 1 : 0;
+        *out_value = value.value_or(0.0);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_cursor_get_string(quiver_cursor_t* cursor,
+                                                     size_t column,
+                                                     char** out_value,
+                                                     int* out_has_value) {
+    if (!cursor || !out_value || !out_has_value) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        const auto value = cursor->cursor.get_string(column);
+        if (value.has_value()) {
+            *out_value = strdup_safe(*value);
+            *out_has_value = 1;
+        } else {
+            *out_value = nullptr;
+            *out_has_value = 0;
+        }
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_cursor_get_blob(quiver_cursor_t* cursor,
+                                                   size_t column,
+                                                   uint8_t** out_data,
+                                                   size_t* out_size,
+                                                   int* out_has_value) {
+    if (!cursor || !out_data || !out_size || !out_has_value) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        const auto value = cursor->cursor.get_blob(column);
+        *out_data = nullptr;
+        *out_size = 0;
+        *out_has_value = value.has_value() ? 1 : 0;
+        if (value && !value->empty()) {
+            *out_data = new uint8_t[value->size()];
+            std::copy(value->begin(), value->end(), *out_data);
+            *out_size = value->size();
+        }
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API void quiver_blob_free(uint8_t* data) {
+    delete[] data;
+}
+
+}  // extern "C"
@@ -1,8 +1,12 @@
 #include "c_api_internal.h"
 #include "quiver/c/database.h"
 #include "quiver/c/element.h"
+#include "quiver/c/filter.h"
 
+#include <chrono>
 #include <new>
+#include <optional>
+#include <span>
 #include <string>
 
 namespace {
@@ -24,11 +28,101 @@ quiver::LogLevel to_cpp_log_level(quiver_log_level_t level) {
     }
 }
 
+std::optional<quiver::JournalMode> to_cpp_journal_mode(quiver_journal_mode_t mode) {
+    switch (mode) {
+    case QUIVER_JOURNAL_MODE_DELETE:
+        return quiver::JournalMode::rollback;
+    case QUIVER_JOURNAL_MODE_TRUNCATE:
+        return quiver::JournalMode::truncate;
+    case QUIVER_JOURNAL_MODE_WAL:
+        return quiver::JournalMode::wal;
+    case QUIVER_JOURNAL_MODE_MEMORY:
+        return quiver::JournalMode::memory;
+    case QUIVER_JOURNAL_MODE_OFF:
+        return quiver::JournalMode::off;
+    default:
+        return std::nullopt;
+    }
+}
+
+std::optional<quiver::SynchronousMode> to_cpp_synchronous(quiver_synchronous_t level) {
+    switch (level) {
+    case QUIVER_SYNCHRONOUS_OFF:
+        return quiver::SynchronousMode::off;
+    case QUIVER_SYNCHRONOUS_NORMAL:
+        return quiver::SynchronousMode::normal;
+    case QUIVER_SYNCHRONOUS_FULL:
+        return quiver::SynchronousMode::full;
+    case QUIVER_SYNCHRONOUS_EXTRA:
+        return quiver::SynchronousMode::extra;
+    default:
+        return std::nullopt;
+    }
+}
+
+std::optional<quiver::TempStore> to_cpp_temp_store(quiver_temp_store_t store) {
+    switch (store) {
+    case QUIVER_TEMP_STORE_FILE:
+        return quiver::TempStore::file;
+    case QUIVER_TEMP_STORE_MEMORY:
+        return quiver::TempStore::memory;
+    default:
+        return std::nullopt;
+    }
+}
+
+std::optional<std::chrono::milliseconds> to_cpp_timeout(int64_t timeout_ms) {
+    if (timeout_ms <= 0) {
+        return std::nullopt;
+    }
+    return std::chrono::milliseconds(timeout_ms);
+}
+
 quiver::DatabaseOptions to_cpp_options(const quiver_database_options_t* options) {
     quiver::DatabaseOptions cpp_options;
     if (options) {
         cpp_options.read_only = options->read_only != 0;
         cpp_options.console_level = to_cpp_log_level(options->console_level);
+        cpp_options.statement_cache_size =
+            options->statement_cache_size > 0 ? static_cast<size_t>(options->statement_cache_size) : 0;
+        cpp_options.journal_mode = to_cpp_journal_mode(options->journal_mode);
+        cpp_options.synchronous = to_cpp_synchronous(options->synchronous);
+        cpp_options.temp_store = to_cpp_temp_store(options->temp_store);
+        if (options->page_size != 0) {
+            cpp_options.page_size = options->page_size;
+        }
+        if (options->cache_size != 0) {
+            cpp_options.cache_size = options->cache_size;
+        }
+        if (options->mmap_size != 0) {
+            cpp_options.mmap_size = options->mmap_size;
+        }
+        cpp_options.mapped = options->mapped != 0;
+        cpp_options.validate_schema = options->validate_schema != 0;
+        cpp_options.file_level = to_cpp_log_level(options->file_level);
+        cpp_options.async_logging = options->async_logging != 0;
+        cpp_options.collect_stats = options->collect_stats != 0;
+        if (options->slow_query_ms > 0) {
+            cpp_options.slow_query_threshold = std::chrono::milliseconds(options->slow_query_ms);
+        }
+        if (options->busy_timeout_ms > 0) {
+            cpp_options.busy_timeout = std::chrono::milliseconds(options->busy_timeout_ms);
+        }
+        if (options->statement_timeout_ms > 0) {
+            cpp_options.statement_timeout = std::chrono::milliseconds(options->statement_timeout_ms);
+        }
+        cpp_options.load_into_memory = options->load_into_memory != 0;
+        cpp_options.track_changes = options->track_changes != 0;
+        cpp_options.cache_reads = options->cache_reads != 0;
+        if (options->read_cache_limit > 0) {
+            cpp_options.read_cache_limit = static_cast<size_t>(options->read_cache_limit);
+        }
+        if (options->soft_heap_limit > 0) {
+            cpp_options.soft_heap_limit = options->soft_heap_limit;
+        }
+        if (options->hard_heap_limit > 0) {
+            cpp_options.hard_heap_limit = options->hard_heap_limit;
+        }
     }
     return cpp_options;
 }
@@ -83,6 +177,73 @@ void free_vectors_impl(T** vectors, size_t* sizes, size_t count) {
     delete[] sizes;
 }
 
+// Helper template for copying a flat (CSR) read result to C arrays
+template <typename T>
+quiver_error_t
+read_flat_impl(const quiver::FlatVectors<T>& flat, T** out_values, size_t** out_offsets, size_t* out_count) {
+    *out_count = flat.size();
+    *out_offsets = new size_t[flat.offsets.size()];
+    std::copy(flat.offsets.begin(), flat.offsets.end(), *out_offsets);
+    if (flat.values.empty()) {
+        *out_values = nullptr;
+        return QUIVER_OK;
+    }
+    *out_values = new T[flat.values.size()];
+    std::copy(flat.values.begin(), flat.values.end(), *out_values);
+    return QUIVER_OK;
+}
+
+quiver_error_t read_flat_strings_impl(const quiver::FlatVectors<std::string>& flat,
+                                      char*** out_values,
+                                      size_t** out_offsets,
+                                      size_t* out_count) {
+    *out_count = flat.size();
+    *out_offsets = new size_t[flat.offsets.size()];
+    std::copy(flat.offsets.begin(), flat.offsets.end(), *out_offsets);
+    if (flat.values.empty()) {
+        *out_values = nullptr;
+        return QUIVER_OK;
+    }
+    *out_values = new char*[flat.values.size()];
+    for (size_t i = 0; i < flat.values.size(); ++i) {
+        (*out_values)[i] = strdup_safe(flat.values[i]);
+    }
+    return QUIVER_OK;
+}
+
+// Copies an arena into one block: the pointer array, then the characters it points into (NULL when empty)
+char** copy_arena_to_c(const quiver::StringArena& arena) {
+    if (arena.empty()) {
+        return nullptr;
+    }
+    const auto table_bytes = arena.size() * sizeof(char*);
+    auto* block = new char[table_bytes + arena.buffer().size()];
+    auto* characters = block + table_bytes;
+    std::copy(arena.buffer().begin(), arena.buffer().end(), characters);
+    auto** values = reinterpret_cast<char**>(block);
+    for (size_t i = 0; i < arena.size(); ++i) {
+        values[i] = characters + arena.start(i);
+    }
+    return values;
+}
+
+quiver_error_t read_arena_impl(const quiver::StringArena& arena, char*** out_values, size_t* out_count) {
+    *out_count = arena.size();
+    *out_values = copy_arena_to_c(arena);
+    return QUIVER_OK;
+}
+
+quiver_error_t read_flat_arena_impl(const quiver::FlatStrings& flat,
+                                    char*** out_values,
+                                    size_t** out_offsets,
+                                    size_t* out_count) {
+    *out_count = flat.size();
+    *out_offsets = new size_t[flat.offsets.size()];
+    std::copy(flat.offsets.begin(), flat.offsets.end(), *out_offsets);
+    *out_values = copy_arena_to_c(flat.values);
+    return QUIVER_OK;
+}
+
 // Helper to copy a vector of strings to C-style array
 quiver_error_t copy_strings_to_c(const std::vector<std::string>& values, char*** out_values, size_t* out_count) {
     *out_count = values.size();
@@ -99,6 +260,53 @@ quiver_error_t copy_strings_to_c(const std::vector<std::string>& values, char***
     return QUIVER_OK;
 }
 
+// Helper for the nullable readers: values as read_scalars_impl, plus a copy of the validity bitmap
+template <typename T>
+quiver_error_t
+read_nullable_impl(const quiver::NullableColumn<T>& column, T** out_values, uint8_t** out_validity, size_t* out_count) {
+    read_scalars_impl(column.values, out_values, out_count);
+    *out_validity = column.validity.empty() ? nullptr : new uint8_t[column.validity.size()];
+    std::copy(column.validity.begin(), column.validity.end(), *out_validity);
+    return QUIVER_OK;
+}
+
+quiver_error_t read_nullable_strings_impl(const quiver::NullableColumn<std::string>& column,
+                                          char*** out_values,
+                                          uint8_t** out_validity,
+                                          size_t* out_count) {
+    *out_count = column.size();
+    *out_values = column.empty() ? nullptr : new char*[column.size()];
+    for (size_t i = 0; i < column.size(); ++i) {
+        (*out_values)[i] = column.is_valid(i) ? strdup_safe(column.values[i]) : nullptr;
+    }
+    *out_validity = column.validity.empty() ? nullptr : new uint8_t[column.validity.size()];
+    std::copy(column.validity.begin(), column.validity.end(), *out_validity);
+    return QUIVER_OK;
+}
+
+// Statistics as the C++ enum, or false for an unknown one
+bool to_aggregates(const quiver_aggregate_t* statistics, size_t count, std::vector<quiver::Aggregate>& out) {
+    for (size_t i = 0; i < count; ++i) {
+        if (statistics[i] < QUIVER_AGGREGATE_SUM || statistics[i] > QUIVER_AGGREGATE_COUNT) {
+            quiver_set_last_error("Unknown aggregate statistic");
+            return false;
+        }
+        out.push_back(static_cast<quiver::Aggregate>(statistics[i]));
+    }
+    return true;
+}
+
+// Copies ids and the statistic columns, back to back, into new[] arrays
+quiver_error_t copy_aggregates(const quiver::Aggregates& aggregates, int64_t** out_ids, double** out_values) {
+    size_t count = 0;
+    read_scalars_impl(aggregates.ids, out_ids, &count);
+    *out_values = count == 0 ? nullptr : new double[count * aggregates.columns.size()];
+    for (size_t s = 0; s < aggregates.columns.size(); ++s) {
+        std::copy(aggregates.columns[s].begin(), aggregates.columns[s].end(), *out_values + s * count);
+    }
+    return QUIVER_OK;
+}
+
 }  // namespace
 
 extern "C" {
@@ -107,6 +315,27 @@ QUIVER_C_API quiver_database_options_t quiver_database_options_default(void) {
     quiver_database_options_t options;
     options.read_only = 0;
     options.console_level = QUIVER_LOG_INFO;
+    options.statement_cache_size = static_cast<int>(quiver::DatabaseOptions{}.statement_cache_size);
+    options.journal_mode = QUIVER_JOURNAL_MODE_DEFAULT;
+    options.synchronous = QUIVER_SYNCHRONOUS_DEFAULT;
+    options.temp_store = QUIVER_TEMP_STORE_DEFAULT;
+    options.page_size = 0;
+    options.cache_size = 0;
+    options.mmap_size = 0;
+    options.mapped = 0;
+    options.validate_schema = 1;
+    options.file_level = QUIVER_LOG_DEBUG;
+    options.async_logging = 0;
+    options.collect_stats = 0;
+    options.slow_query_ms = 0;
+    options.busy_timeout_ms = 0;
+    options.statement_timeout_ms = 0;
+    options.load_into_memory = 0;
+    options.track_changes = 0;
+    options.cache_reads = 0;
+    options.read_cache_limit = 0;
+    options.soft_heap_limit = 0;
+    options.hard_heap_limit = 0;
     return options;
 }
 
@@ -144,17 +373,14 @@ QUIVER_C_API const char* quiver_database_path(quiver_database_t* db) {
     return db->db.path().c_str();
 }
 
-QUIVER_C_API quiver_database_t* quiver_database_from_migrations(const char* db_path,
-                                                                const char* migrations_path,
-                                                                const quiver_database_options_t* options) {
-    if (!db_path || !migrations_path) {
+QUIVER_C_API quiver_database_t* quiver_database_from_snapshot(const char* path,
+                                                              const quiver_database_options_t* options) {
+    if (!path) {
         return nullptr;
     }
 
     try {
-        auto cpp_options = to_cpp_options(options);
-        auto db = quiver::Database::from_migrations(db_path, migrations_path, cpp_options);
-        return new quiver_database(std::move(db));
+        return new quiver_database(quiver::Database::from_snapshot(path, to_cpp_options(options)));
     } catch (const std::bad_alloc&) {
         return nullptr;
     } catch (const std::exception& e) {
@@ -163,41 +389,53 @@ QUIVER_C_API quiver_database_t* quiver_database_from_migrations(const char* db_p
     }
 }
 
-QUIVER_C_API int64_t quiver_database_current_version(quiver_database_t* db) {
-    if (!db) {
-        return -1;
+QUIVER_C_API quiver_error_t quiver_database_backup_to(quiver_database_t* db,
+                                                      const char* path,
+                                                      int pages_per_step,
+                                                      quiver_backup_progress_t progress,
+                                                      void* user_data) {
+    if (!db || !path) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
     }
+
     try {
-        return db->db.current_version();
+        quiver::BackupOptions options;
+        options.pages_per_step = pages_per_step;
+        if (progress) {
+            options.on_progress = [progress, user_data](int remaining, int total) {
+                progress(remaining, total, user_data);
+            };
+        }
+        db->db.backup_to(path, options);
+        return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
-        return -1;
+        return QUIVER_ERROR_DATABASE;
     }
 }
 
-QUIVER_C_API int64_t quiver_database_create_element(quiver_database_t* db,
-                                                    const char* collection,
-                                                    quiver_element_t* element) {
-    if (!db || !collection || !element) {
-        return -1;
+QUIVER_C_API quiver_error_t quiver_database_clone_in_memory(quiver_database_t* db, quiver_database_t** out_db) {
+    if (!db || !out_db) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
     }
+
     try {
-        return db->db.create_element(collection, element->element);
+        *out_db = new quiver_database(db->db.clone_in_memory());
+        return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
-        return -1;
+        *out_db = nullptr;
+        return QUIVER_ERROR_DATABASE;
     }
 }
 
-QUIVER_C_API quiver_error_t quiver_database_update_element(quiver_database_t* db,
-                                                           const char* collection,
-                                                           int64_t id,
-                                                           const quiver_element_t* element) {
-    if (!db || !collection || !element) {
+QUIVER_C_API quiver_error_t quiver_database_flush(quiver_database_t* db) {
+    if (!db) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
+
     try {
-        db->db.update_element(collection, id, element->element);
+        db->db.flush();
         return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
@@ -205,14 +443,13 @@ QUIVER_C_API quiver_error_t quiver_database_update_element(quiver_database_t* db
     }
 }
 
-QUIVER_C_API quiver_error_t quiver_database_delete_element_by_id(quiver_database_t* db,
-                                                                 const char* collection,
-                                                                 int64_t id) {
-    if (!db || !collection) {
+QUIVER_C_API quiver_error_t quiver_database_change_token(quiver_database_t* db, int64_t* out_token) {
+    if (!db || !out_token) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
+
     try {
-        db->db.delete_element_by_id(collection, id);
+        *out_token = db->db.change_token();
         return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
@@ -220,16 +457,27 @@ QUIVER_C_API quiver_error_t quiver_database_delete_element_by_id(quiver_database
     }
 }
 
-QUIVER_C_API quiver_error_t quiver_database_set_scalar_relation(quiver_database_t* db,
-                                                                const char* collection,
-                                                                const char* attribute,
-                                                                const char* from_label,
-                                                                const char* to_label) {
-    if (!db || !collection || !attribute || !from_label || !to_label) {
+QUIVER_C_API quiver_error_t quiver_database_changes_since(quiver_database_t* db,
+                                                          int64_t token,
+                                                          quiver_change_t** out_changes,
+                                                          size_t* out_count,
+                                                          int64_t* out_token) {
+    if (!db || !out_changes || !out_count || !out_token) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
+
     try {
-        db->db.set_scalar_relation(collection, attribute, from_label, to_label);
+        const auto set = db->db.changes_since(token);
+        *out_token = set.token;
+        *out_count = set.changes.size();
+        *out_changes = set.changes.empty() ? nullptr : new quiver_change_t[set.changes.size()];
+        for (size_t i = 0; i < set.changes.size(); ++i) {
+            const auto& change = set.changes[i];
+            (*out_changes)[i] = {strdup_safe(change.collection),
+                                 change.id,
+                                 change.attribute.empty() ? nullptr : strdup_safe(change.attribute),
+                                 static_cast<quiver_change_kind_t>(change.kind)};
+        }
         return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
@@ -237,31 +485,40 @@ QUIVER_C_API quiver_error_t quiver_database_set_scalar_relation(quiver_database_
     }
 }
 
-QUIVER_C_API quiver_error_t quiver_database_read_scalar_relation(quiver_database_t* db,
-                                                                 const char* collection,
-                                                                 const char* attribute,
-                                                                 char*** out_values,
-                                                                 size_t* out_count) {
-    if (!db || !collection || !attribute || !out_values || !out_count) {
+QUIVER_C_API quiver_error_t quiver_database_discard_changes(quiver_database_t* db, int64_t token) {
+    if (!db) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
+
     try {
-        return copy_strings_to_c(db->db.read_scalar_relation(collection, attribute), out_values, out_count);
+        db->db.discard_changes(token);
+        return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
         return QUIVER_ERROR_DATABASE;
     }
 }
 
-QUIVER_C_API quiver_database_t*
-quiver_database_from_schema(const char* db_path, const char* schema_path, const quiver_database_options_t* options) {
-    if (!db_path || !schema_path) {
+QUIVER_C_API void quiver_free_changes(quiver_change_t* changes, size_t count) {
+    if (!changes)
+        return;
+    for (size_t i = 0; i < count; ++i) {
+        delete[] changes[i].collection;
+        delete[] changes[i].attribute;
+    }
+    delete[] changes;
+}
+
+QUIVER_C_API quiver_database_t* quiver_database_from_migrations(const char* db_path,
+                                                                const char* migrations_path,
+                                                                const quiver_database_options_t* options) {
+    if (!db_path || !migrations_path) {
         return nullptr;
     }
 
     try {
         auto cpp_options = to_cpp_options(options);
-        auto db = quiver::Database::from_schema(db_path, schema_path, cpp_options);
+        auto db = quiver::Database::from_migrations(db_path, migrations_path, cpp_options);
         return new quiver_database(std::move(db));
     } catch (const std::bad_alloc&) {
         return nullptr;
@@ -271,138 +528,195 @@ quiver_database_from_schema(const char* db_path, const char* schema_path, const
     }
 }
 
-QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers(quiver_database_t* db,
-                                                                 const char* collection,
-                                                                 const char* attribute,
-                                                                 int64_t** out_values,
-                                                                 size_t* out_count) {
-    if (!db || !collection || !attribute || !out_values || !out_count) {
-        return QUIVER_ERROR_INVALID_ARGUMENT;
+QUIVER_C_API int64_t quiver_database_current_version(quiver_database_t* db) {
+    if (!db) {
+        return -1;
     }
     try {
-        return read_scalars_impl(db->db.read_scalar_integers(collection, attribute), out_values, out_count);
+        return db->db.current_version();
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
-        return QUIVER_ERROR_DATABASE;
+        return -1;
     }
 }
 
-QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats(quiver_database_t* db,
-                                                               const char* collection,
-                                                               const char* attribute,
-                                                               double** out_values,
-                                                               size_t* out_count) {
-    if (!db || !collection || !attribute || !out_values || !out_count) {
+QUIVER_C_API quiver_error_t quiver_database_interrupt(quiver_database_t* db) {
+    if (!db) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    db->db.interrupt();
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_database_set_busy_timeout(quiver_database_t* db, int64_t timeout_ms) {
+    if (!db) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    db->db.set_busy_timeout(to_cpp_timeout(timeout_ms));
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_database_set_statement_timeout(quiver_database_t* db, int64_t timeout_ms) {
+    if (!db) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    db->db.set_statement_timeout(to_cpp_timeout(timeout_ms));
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_database_set_progress_handler(quiver_database_t* db,
+                                                                 quiver_progress_callback_t callback,
+                                                                 void* user_data) {
+    if (!db) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
     try {
-        return read_scalars_impl(db->db.read_scalar_floats(collection, attribute), out_values, out_count);
+        if (callback) {
+            db->db.set_progress_handler([callback, user_data] { return callback(user_data) == 0; });
+        } else {
+            db->db.set_progress_handler(nullptr);
+        }
+        return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
         return QUIVER_ERROR_DATABASE;
     }
 }
 
-QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings(quiver_database_t* db,
-                                                                const char* collection,
-                                                                const char* attribute,
-                                                                char*** out_values,
-                                                                size_t* out_count) {
-    if (!db || !collection || !attribute || !out_values || !out_count) {
+QUIVER_C_API quiver_error_t quiver_database_statement_cache_stats(quiver_database_t* db,
+                                                                  quiver_statement_cache_stats_t* out_stats) {
+    if (!db || !out_stats) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
     try {
-        return copy_strings_to_c(db->db.read_scalar_strings(collection, attribute), out_values, out_count);
+        const auto stats = db->db.statement_cache_stats();
+        out_stats->hits = stats.hits;
+        out_stats->misses = stats.misses;
+        out_stats->size = stats.size;
+        out_stats->capacity = stats.capacity;
+        return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
         return QUIVER_ERROR_DATABASE;
     }
 }
 
-QUIVER_C_API void quiver_free_integer_array(int64_t* values) {
-    delete[] values;
+QUIVER_C_API quiver_error_t quiver_database_stats(quiver_database_t* db, quiver_database_stats_t* out_stats) {
+    if (!db || !out_stats) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        const auto stats = db->db.stats();
+        *out_stats = {};
+        out_stats->operation_count = stats.operations.size();
+        if (!stats.operations.empty()) {
+            out_stats->operations = new quiver_operation_stats_t[stats.operations.size()];
+            for (size_t i = 0; i < stats.operations.size(); ++i) {
+                const auto& op = stats.operations[i];
+                out_stats->operations[i] = {
+                    strdup_safe(op.name), op.calls, op.total_ns, op.max_ns, op.rows_read, op.rows_written};
+            }
+        }
+        out_stats->statement_count = stats.statements.size();
+        if (!stats.statements.empty()) {
+            out_stats->statements = new quiver_statement_stats_t[stats.statements.size()];
+            for (size_t i = 0; i < stats.statements.size(); ++i) {
+                const auto& statement = stats.statements[i];
+                out_stats->statements[i] = {strdup_safe(statement.sql),
+                                            statement.prepares,
+                                            statement.prepare_ns,
+                                            statement.executions,
+                                            statement.total_ns,
+                                            statement.max_ns,
+                                            statement.rows_read,
+                                            statement.rows_written};
+            }
+        }
+        out_stats->statement_cache = {stats.statement_cache.hits,
+                                      stats.statement_cache.misses,
+                                      stats.statement_cache.size,
+                                      stats.statement_cache.capacity};
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
 }
 
-QUIVER_C_API void quiver_free_float_array(double* values) {
-    delete[] values;
+QUIVER_C_API quiver_error_t quiver_database_reset_stats(quiver_database_t* db) {
+    if (!db) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    db->db.reset_stats();
+    return QUIVER_OK;
 }
 
-QUIVER_C_API void quiver_free_string_array(char** values, size_t count) {
-    if (!values) {
+QUIVER_C_API void quiver_free_database_stats(quiver_database_stats_t* stats) {
+    if (!stats)
         return;
+    for (size_t i = 0; i < stats->operation_count; ++i) {
+        delete[] stats->operations[i].name;
     }
-    for (size_t i = 0; i < count; ++i) {
-        delete[] values[i];
+    delete[] stats->operations;
+    for (size_t i = 0; i < stats->statement_count; ++i) {
+        delete[] stats->statements[i].sql;
     }
-    delete[] values;
+    delete[] stats->statements;
+    stats->operations = nullptr;
+    stats->operation_count = 0;
+    stats->statements = nullptr;
+    stats->statement_count = 0;
 }
 
-QUIVER_C_API quiver_error_t quiver_database_read_vector_integers(quiver_database_t* db,
-                                                                 const char* collection,
-                                                                 const char* attribute,
-                                                                 int64_t*** out_vectors,
-                                                                 size_t** out_sizes,
-                                                                 size_t* out_count) {
-    if (!db || !collection || !attribute || !out_vectors || !out_sizes || !out_count) {
+QUIVER_C_API quiver_error_t quiver_database_memory_usage(quiver_database_t* db, quiver_memory_usage_t* out_usage) {
+    if (!db || !out_usage) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
     try {
-        return read_vectors_impl(db->db.read_vector_integers(collection, attribute), out_vectors, out_sizes, out_count);
+        const auto usage = db->db.memory_usage();
+        out_usage->page_cache = usage.page_cache;
+        out_usage->sqlite_schema = usage.sqlite_schema;
+        out_usage->statements = usage.statements;
+        out_usage->schema = usage.schema;
+        out_usage->read_cache = usage.read_cache;
+        out_usage->label_cache = usage.label_cache;
+        out_usage->cache_hits = usage.cache_hits;
+        out_usage->cache_misses = usage.cache_misses;
+        out_usage->cache_writes = usage.cache_writes;
+        out_usage->cache_spills = usage.cache_spills;
+        out_usage->sqlite_heap = usage.sqlite_heap;
+        out_usage->sqlite_heap_highwater = usage.sqlite_heap_highwater;
+        out_usage->soft_heap_limit = usage.soft_heap_limit;
+        out_usage->total = usage.total();
+        return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
         return QUIVER_ERROR_DATABASE;
     }
 }
 
-QUIVER_C_API quiver_error_t quiver_database_read_vector_floats(quiver_database_t* db,
-                                                               const char* collection,
-                                                               const char* attribute,
-                                                               double*** out_vectors,
-                                                               size_t** out_sizes,
-                                                               size_t* out_count) {
-    if (!db || !collection || !attribute || !out_vectors || !out_sizes || !out_count) {
+QUIVER_C_API quiver_error_t quiver_database_shrink_memory(quiver_database_t* db, int64_t* out_released) {
+    if (!db) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
     try {
-        return read_vectors_impl(db->db.read_vector_floats(collection, attribute), out_vectors, out_sizes, out_count);
+        const auto released = db->db.shrink_memory();
+        if (out_released) {
+            *out_released = released;
+        }
+        return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
         return QUIVER_ERROR_DATABASE;
     }
 }
 
-QUIVER_C_API quiver_error_t quiver_database_read_vector_strings(quiver_database_t* db,
-                                                                const char* collection,
-                                                                const char* attribute,
-                                                                char**** out_vectors,
-                                                                size_t** out_sizes,
-                                                                size_t* out_count) {
-    if (!db || !collection || !attribute || !out_vectors || !out_sizes || !out_count) {
+QUIVER_C_API quiver_error_t quiver_database_begin_transaction(quiver_database_t* db) {
+    if (!db) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
     try {
-        auto vectors = db->db.read_vector_strings(collection, attribute);
-        *out_count = vectors.size();
-        if (vectors.empty()) {
-            *out_vectors = nullptr;
-            *out_sizes = nullptr;
-            return QUIVER_OK;
-        }
-        *out_vectors = new char**[vectors.size()];
-        *out_sizes = new size_t[vectors.size()];
-        for (size_t i = 0; i < vectors.size(); ++i) {
-            (*out_sizes)[i] = vectors[i].size();
-            if (vectors[i].empty()) {
-                (*out_vectors)[i] = nullptr;
-            } else {
-                (*out_vectors)[i] = new char*[vectors[i].size()];
-                for (size_t j = 0; j < vectors[i].size(); ++j) {
-                    (*out_vectors)[i][j] = new char[vectors[i][j].size() + 1];
-                    std::copy(vectors[i][j].begin(), vectors[i][j].end(), (*out_vectors)[i][j]);
-                    (*out_vectors)[i][j][vectors[i][j].size()] = '\0';
-                }
-            }
-        }
+        db->db.begin_transaction();
         return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
@@ -410,98 +724,107 @@ QUIVER_C_API quiver_error_t quiver_database_read_vector_strings(quiver_database_
     }
 }
 
-QUIVER_C_API void quiver_free_integer_vectors(int64_t** vectors, size_t* sizes, size_t count) {
-    free_vectors_impl(vectors, sizes, count);
+QUIVER_C_API quiver_error_t quiver_database_commit(quiver_database_t* db) {
+    if (!db) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        db->db.commit();
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
 }
 
-QUIVER_C_API void quiver_free_float_vectors(double** vectors, size_t* sizes, size_t count) {
-    free_vectors_impl(vectors, sizes, count);
+QUIVER_C_API quiver_error_t quiver_database_rollback(quiver_database_t* db) {
+    if (!db) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        db->db.rollback();
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
 }
 
-QUIVER_C_API void quiver_free_string_vectors(char*** vectors, size_t* sizes, size_t count) {
-    if (!vectors) {
-        return;
-    }
-    for (size_t i = 0; i < count; ++i) {
-        if (vectors[i]) {
-            for (size_t j = 0; j < sizes[i]; ++j) {
-                delete[] vectors[i][j];
-            }
-            delete[] vectors[i];
-        }
+QUIVER_C_API quiver_error_t quiver_database_in_transaction(quiver_database_t* db, int* out_active) {
+    if (!db || !out_active) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
     }
-    delete[] vectors;
-    delete[] sizes;
+    *out_active = db->db.in_transaction() ? 1 : 0;
+    return QUIVER_OK;
 }
 
-// Set read functions (reuse vector helpers since sets have same return structure)
+QUIVER_C_API int64_t quiver_database_create_element(quiver_database_t* db,
+                                                    const char* collection,
+                                                    quiver_element_t* element) {
+    if (!db || !collection || !element) {
+        return -1;
+    }
+    try {
+        return db->db.create_element(collection, element->element);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return -1;
+    }
+}
 
-QUIVER_C_API quiver_error_t quiver_database_read_set_integers(quiver_database_t* db,
-                                                              const char* collection,
-                                                              const char* attribute,
-                                                              int64_t*** out_sets,
-                                                              size_t** out_sizes,
-                                                              size_t* out_count) {
-    if (!db || !collection || !attribute || !out_sets || !out_sizes || !out_count) {
+QUIVER_C_API quiver_error_t quiver_database_read_element(quiver_database_t* db,
+                                                         const char* collection,
+                                                         int64_t id,
+                                                         quiver_element_t** out_element) {
+    if (!db || !collection || !out_element) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
     try {
-        return read_vectors_impl(db->db.read_set_integers(collection, attribute), out_sets, out_sizes, out_count);
+        *out_element = new quiver_element{db->db.read_element(collection, id)};
+        return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
+        *out_element = nullptr;
         return QUIVER_ERROR_DATABASE;
     }
 }
 
-QUIVER_C_API quiver_error_t quiver_database_read_set_floats(quiver_database_t* db,
+QUIVER_C_API quiver_error_t quiver_database_create_elements(quiver_database_t* db,
                                                             const char* collection,
-                                                            const char* attribute,
-                                                            double*** out_sets,
-                                                            size_t** out_sizes,
-                                                            size_t* out_count) {
-    if (!db || !collection || !attribute || !out_sets || !out_sizes || !out_count) {
+                                                            quiver_element_t* const* elements,
+                                                            size_t count,
+                                                            int64_t* out_ids) {
+    if (!db || !collection || (count > 0 && (!elements || !out_ids))) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
     try {
-        return read_vectors_impl(db->db.read_set_floats(collection, attribute), out_sets, out_sizes, out_count);
+        std::vector<quiver::Element> cpp_elements;
+        cpp_elements.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            if (!elements[i]) {
+                quiver_set_last_error("Null element at index " + std::to_string(i));
+                return QUIVER_ERROR_INVALID_ARGUMENT;
+            }
+            cpp_elements.push_back(elements[i]->element);
+        }
+        const auto ids = db->db.create_elements(collection, cpp_elements);
+        std::copy(ids.begin(), ids.end(), out_ids);
+        return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
         return QUIVER_ERROR_DATABASE;
     }
 }
 
-QUIVER_C_API quiver_error_t quiver_database_read_set_strings(quiver_database_t* db,
-                                                             const char* collection,
-                                                             const char* attribute,
-                                                             char**** out_sets,
-                                                             size_t** out_sizes,
-                                                             size_t* out_count) {
-    if (!db || !collection || !attribute || !out_sets || !out_sizes || !out_count) {
+QUIVER_C_API quiver_error_t quiver_database_update_element(quiver_database_t* db,
+                                                           const char* collection,
+                                                           int64_t id,
+                                                           const quiver_element_t* element) {
+    if (!db || !collection || !element) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
     try {
-        auto sets = db->db.read_set_strings(collection, attribute);
-        *out_count = sets.size();
-        if (sets.empty()) {
-            *out_sets = nullptr;
-            *out_sizes = nullptr;
-            return QUIVER_OK;
-        }
-        *out_sets = new char**[sets.size()];
-        *out_sizes = new size_t[sets.size()];
-        for (size_t i = 0; i < sets.size(); ++i) {
-            (*out_sizes)[i] = sets[i].size();
-            if (sets[i].empty()) {
-                (*out_sets)[i] = nullptr;
-            } else {
-                (*out_sets)[i] = new char*[sets[i].size()];
-                for (size_t j = 0; j < sets[i].size(); ++j) {
-                    (*out_sets)[i][j] = new char[sets[i][j].size() + 1];
-                    std::copy(sets[i][j].begin(), sets[i][j].end(), (*out_sets)[i][j]);
-                    (*out_sets)[i][j][sets[i][j].size()] = '\0';
-                }
-            }
-        }
+        db->db.update_element(collection, id, element->element);
         return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
@@ -509,25 +832,15 @@ QUIVER_C_API quiver_error_t quiver_database_read_set_strings(quiver_database_t*
     }
 }
 
-// Read scalar by ID functions
-
-QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_by_id(quiver_database_t* db,
-                                                                       const char* collection,
-                                                                       const char* attribute,
-                                                                       int64_t id,
-                                                                       int64_t* out_value,
-                                                                       int* out_has_value) {
-    if (!db || !collection || !attribute || !out_value || !out_has_value) {
+QUIVER_C_API quiver_error_t quiver_database_upsert_element(quiver_database_t* db,
+                                                           const char* collection,
+                                                           const quiver_element_t* element,
+                                                           int64_t* out_id) {
+    if (!db || !collection || !element || !out_id) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
     try {
-        auto result = db->db.read_scalar_integers_by_id(collection, attribute, id);
-        if (result.has_value()) {
-            *out_value = *result;
-            *out_has_value = 1;
-        } else {
-            *out_has_value = 0;
-        }
+        *out_id = db->db.upsert_element(collection, element->element);
         return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
@@ -535,23 +848,26 @@ QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_by_id(quiver_da
     }
 }
 
-QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_by_id(quiver_database_t* db,
-                                                                     const char* collection,
-                                                                     const char* attribute,
-                                                                     int64_t id,
-                                                                     double* out_value,
-                                                                     int* out_has_value) {
-    if (!db || !collection || !attribute || !out_value || !out_has_value) {
+QUIVER_C_API quiver_error_t quiver_database_upsert_elements(quiver_database_t* db,
+                                                            const char* collection,
+                                                            quiver_element_t* const* elements,
+                                                            size_t count,
+                                                            int64_t* out_ids) {
+    if (!db || !collection || (count > 0 && (!elements || !out_ids))) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
     try {
-        auto result = db->db.read_scalar_floats_by_id(collection, attribute, id);
-        if (result.has_value()) {
-            *out_value = *result;
-            *out_has_value = 1;
-        } else {
-            *out_has_value = 0;
+        std::vector<quiver::Element> cpp_elements;
+        cpp_elements.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            if (!elements[i]) {
+                quiver_set_last_error("Null element at index " + std::to_string(i));
+                return QUIVER_ERROR_INVALID_ARGUMENT;
+            }
+            cpp_elements.push_back(elements[i]->element);
         }
+        const auto ids = db->db.upsert_elements(collection, cpp_elements);
+        std::copy(ids.begin(), ids.end(), out_ids);
         return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
@@ -559,26 +875,14 @@ QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_by_id(quiver_data
     }
 }
 
-QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_by_id(quiver_database_t* db,
-                                                                      const char* collection,
-                                                                      const char* attribute,
-                                                                      int64_t id,
-                                                                      char** out_value,
-                                                                      int* out_has_value) {
-    if (!db || !collection || !attribute || !out_value || !out_has_value) {
+QUIVER_C_API quiver_error_t quiver_database_delete_element_by_id(quiver_database_t* db,
+                                                                 const char* collection,
+                                                                 int64_t id) {
+    if (!db || !collection) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
     try {
-        auto result = db->db.read_scalar_strings_by_id(collection, attribute, id);
-        if (result.has_value()) {
-            *out_value = new char[result->size() + 1];
-            std::copy(result->begin(), result->end(), *out_value);
-            (*out_value)[result->size()] = '\0';
-            *out_has_value = 1;
-        } else {
-            *out_value = nullptr;
-            *out_has_value = 0;
-        }
+        db->db.delete_element_by_id(collection, id);
         return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
@@ -586,125 +890,1496 @@ QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_by_id(quiver_dat
     }
 }
 
-// Read vector by ID functions
-
-QUIVER_C_API quiver_error_t quiver_database_read_vector_integers_by_id(quiver_database_t* db,
-                                                                       const char* collection,
-                                                                       const char* attribute,
-                                                                       int64_t id,
-                                                                       int64_t** out_values,
-                                                                       size_t* out_count) {
-    if (!db || !collection || !attribute || !out_values || !out_count) {
+QUIVER_C_API quiver_error_t quiver_database_delete_elements_by_ids(quiver_database_t* db,
+                                                                   const char* collection,
+                                                                   const int64_t* ids,
+                                                                   size_t count,
+                                                                   size_t* out_deleted) {
+    if (!db || !collection || (count > 0 && !ids) || !out_deleted) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
     try {
-        auto values = db->db.read_vector_integers_by_id(collection, attribute, id);
-        return read_scalars_impl(values, out_values, out_count);
+        *out_deleted = db->db.delete_elements_by_ids(collection, std::span<const int64_t>(ids, count));
+        return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
         return QUIVER_ERROR_DATABASE;
     }
 }
 
-QUIVER_C_API quiver_error_t quiver_database_read_vector_floats_by_id(quiver_database_t* db,
-                                                                     const char* collection,
-                                                                     const char* attribute,
-                                                                     int64_t id,
-                                                                     double** out_values,
-                                                                     size_t* out_count) {
-    if (!db || !collection || !attribute || !out_values || !out_count) {
+QUIVER_C_API quiver_error_t quiver_database_set_scalar_relation(quiver_database_t* db,
+                                                                const char* collection,
+                                                                const char* attribute,
+                                                                const char* from_label,
+                                                                const char* to_label) {
+    if (!db || !collection || !attribute || !from_label || !to_label) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
     try {
-        auto values = db->db.read_vector_floats_by_id(collection, attribute, id);
-        return read_scalars_impl(values, out_values, out_count);
+        db->db.set_scalar_relation(collection, attribute, from_label, to_label);
+        return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
         return QUIVER_ERROR_DATABASE;
     }
 }
 
-QUIVER_C_API quiver_error_t quiver_database_read_vector_strings_by_id(quiver_database_t* db,
-                                                                      const char* collection,
-                                                                      const char* attribute,
-                                                                      int64_t id,
-                                                                      char*** out_values,
-                                                                      size_t* out_count) {
-    if (!db || !collection || !attribute || !out_values || !out_count) {
+QUIVER_C_API quiver_error_t quiver_database_set_scalar_relations(quiver_database_t* db,
+                                                                 const char* collection,
+                                                                 const char* attribute,
+                                                                 const char* const* from_labels,
+                                                                 const char* const* to_labels,
+                                                                 size_t count) {
+    if (!db || !collection || !attribute || (count > 0 && (!from_labels || !to_labels))) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
     try {
-        return copy_strings_to_c(db->db.read_vector_strings_by_id(collection, attribute, id), out_values, out_count);
+        std::vector<std::string> from;
+        std::vector<std::string> to;
+        from.reserve(count);
+        to.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            if (!from_labels[i] || !to_labels[i]) {
+                return QUIVER_ERROR_INVALID_ARGUMENT;
+            }
+            from.emplace_back(from_labels[i]);
+            to.emplace_back(to_labels[i]);
+        }
+        db->db.set_scalar_relations(collection, attribute, from, to);
+        return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
         return QUIVER_ERROR_DATABASE;
     }
 }
 
-// Read set by ID functions
-
-QUIVER_C_API quiver_error_t quiver_database_read_set_integers_by_id(quiver_database_t* db,
-                                                                    const char* collection,
-                                                                    const char* attribute,
-                                                                    int64_t id,
-                                                                    int64_t** out_values,
-                                                                    size_t* out_count) {
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_relation(quiver_database_t* db,
+                                                                 const char* collection,
+                                                                 const char* attribute,
+                                                                 char*** out_values,
+                                                                 size_t* out_count) {
     if (!db || !collection || !attribute || !out_values || !out_count) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
     try {
-        auto values = db->db.read_set_integers_by_id(collection, attribute, id);
-        return read_scalars_impl(values, out_values, out_count);
+        return copy_strings_to_c(db->db.read_scalar_relation(collection, attribute), out_values, out_count);
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
         return QUIVER_ERROR_DATABASE;
     }
 }
 
-QUIVER_C_API quiver_error_t quiver_database_read_set_floats_by_id(quiver_database_t* db,
-                                                                  const char* collection,
-                                                                  const char* attribute,
-                                                                  int64_t id,
-                                                                  double** out_values,
-                                                                  size_t* out_count) {
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_relation_ids(quiver_database_t* db,
+                                                                     const char* collection,
+                                                                     const char* attribute,
+                                                                     int64_t** out_values,
+                                                                     size_t* out_count) {
     if (!db || !collection || !attribute || !out_values || !out_count) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
     try {
-        auto values = db->db.read_set_floats_by_id(collection, attribute, id);
-        return read_scalars_impl(values, out_values, out_count);
+        return read_scalars_impl(db->db.read_scalar_relation_ids(collection, attribute), out_values, out_count);
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
         return QUIVER_ERROR_DATABASE;
     }
 }
 
-QUIVER_C_API quiver_error_t quiver_database_read_set_strings_by_id(quiver_database_t* db,
-                                                                   const char* collection,
-                                                                   const char* attribute,
-                                                                   int64_t id,
-                                                                   char*** out_values,
-                                                                   size_t* out_count) {
-    if (!db || !collection || !attribute || !out_values || !out_count) {
+QUIVER_C_API quiver_database_t*
+quiver_database_from_schema(const char* db_path, const char* schema_path, const quiver_database_options_t* options) {
+    if (!db_path || !schema_path) {
+        return nullptr;
+    }
+
+    try {
+        auto cpp_options = to_cpp_options(options);
+        auto db = quiver::Database::from_schema(db_path, schema_path, cpp_options);
+        return new quiver_database(std::move(db));
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return nullptr;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers(quiver_database_t* db,
+                                                                 const char* collection,
+                                                                 const char* attribute,
+                                                                 int64_t** out_values,
+                                                                 size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_scalars_impl(db->db.read_scalar_integers(collection, attribute), out_values, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats(quiver_database_t* db,
+                                                               const char* collection,
+                                                               const char* attribute,
+                                                               double** out_values,
+                                                               size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_scalars_impl(db->db.read_scalar_floats(collection, attribute), out_values, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings(quiver_database_t* db,
+                                                                const char* collection,
+                                                                const char* attribute,
+                                                                char*** out_values,
+                                                                size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return copy_strings_to_c(db->db.read_scalar_strings(collection, attribute), out_values, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_count_scalar_values(quiver_database_t* db,
+                                                                const char* collection,
+                                                                const char* attribute,
+                                                                size_t* out_count) {
+    if (!db || !collection || !attribute || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        *out_count = db->db.count_scalar_values(collection, attribute);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_into(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      int64_t* buffer,
+                                                                      size_t capacity,
+                                                                      size_t* out_count) {
+    if (!db || !collection || !attribute || !out_count || (!buffer && capacity > 0)) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        *out_count = db->db.read_scalar_integers_into(collection, attribute, std::span<int64_t>(buffer, capacity));
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_into(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const char* attribute,
+                                                                    double* buffer,
+                                                                    size_t capacity,
+                                                                    size_t* out_count) {
+    if (!db || !collection || !attribute || !out_count || (!buffer && capacity > 0)) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        *out_count = db->db.read_scalar_floats_into(collection, attribute, std::span<double>(buffer, capacity));
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_nullable(quiver_database_t* db,
+                                                                          const char* collection,
+                                                                          const char* attribute,
+                                                                          int64_t** out_values,
+                                                                          uint8_t** out_validity,
+                                                                          size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_validity || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_nullable_impl(
+            db->db.read_scalar_integers_nullable(collection, attribute), out_values, out_validity, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_nullable(quiver_database_t* db,
+                                                                        const char* collection,
+                                                                        const char* attribute,
+                                                                        double** out_values,
+                                                                        uint8_t** out_validity,
+                                                                        size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_validity || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_nullable_impl(
+            db->db.read_scalar_floats_nullable(collection, attribute), out_values, out_validity, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_nullable(quiver_database_t* db,
+                                                                         const char* collection,
+                                                                         const char* attribute,
+                                                                         char*** out_values,
+                                                                         uint8_t** out_validity,
+                                                                         size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_validity || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_nullable_strings_impl(
+            db->db.read_scalar_strings_nullable(collection, attribute), out_values, out_validity, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API void quiver_free_integer_array(int64_t* values) {
+    delete[] values;
+}
+
+QUIVER_C_API void quiver_free_float_array(double* values) {
+    delete[] values;
+}
+
+QUIVER_C_API void quiver_free_string_array(char** values, size_t count) {
+    if (!values) {
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        delete[] values[i];
+    }
+    delete[] values;
+}
+
+QUIVER_C_API void quiver_free_validity_bitmap(uint8_t* validity) {
+    delete[] validity;
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_integers(quiver_database_t* db,
+                                                                 const char* collection,
+                                                                 const char* attribute,
+                                                                 int64_t*** out_vectors,
+                                                                 size_t** out_sizes,
+                                                                 size_t* out_count) {
+    if (!db || !collection || !attribute || !out_vectors || !out_sizes || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_vectors_impl(db->db.read_vector_integers(collection, attribute), out_vectors, out_sizes, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_floats(quiver_database_t* db,
+                                                               const char* collection,
+                                                               const char* attribute,
+                                                               double*** out_vectors,
+                                                               size_t** out_sizes,
+                                                               size_t* out_count) {
+    if (!db || !collection || !attribute || !out_vectors || !out_sizes || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_vectors_impl(db->db.read_vector_floats(collection, attribute), out_vectors, out_sizes, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_strings(quiver_database_t* db,
+                                                                const char* collection,
+                                                                const char* attribute,
+                                                                char**** out_vectors,
+                                                                size_t** out_sizes,
+                                                                size_t* out_count) {
+    if (!db || !collection || !attribute || !out_vectors || !out_sizes || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto vectors = db->db.read_vector_strings(collection, attribute);
+        *out_count = vectors.size();
+        if (vectors.empty()) {
+            *out_vectors = nullptr;
+            *out_sizes = nullptr;
+            return QUIVER_OK;
+        }
+        *out_vectors = new char**[vectors.size()];
+        *out_sizes = new size_t[vectors.size()];
+        for (size_t i = 0; i < vectors.size(); ++i) {
+            (*out_sizes)[i] = vectors[i].size();
+            if (vectors[i].empty()) {
+                (*out_vectors)[i] = nullptr;
+            } else {
+                (*out_vectors)[i] = new char*[vectors[i].size()];
+                for (size_t j = 0; j < vectors[i].size(); ++j) {
+                    (*out_vectors)[i][j] = new char[vectors[i][j].size() + 1];
+                    std::copy(vectors[i][j].begin(), vectors[i][j].end(), (*out_vectors)[i][j]);
+                    (*out_vectors)[i][j][vectors[i][j].size()] = '\0';
+                }
+            }
+        }
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API void quiver_free_integer_vectors(int64_t** vectors, size_t* sizes, size_t count) {
+    free_vectors_impl(vectors, sizes, count);
+}
+
+QUIVER_C_API void quiver_free_float_vectors(double** vectors, size_t* sizes, size_t count) {
+    free_vectors_impl(vectors, sizes, count);
+}
+
+QUIVER_C_API void quiver_free_string_vectors(char*** vectors, size_t* sizes, size_t count) {
+    if (!vectors) {
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (vectors[i]) {
+            for (size_t j = 0; j < sizes[i]; ++j) {
+                delete[] vectors[i][j];
+            }
+            delete[] vectors[i];
+        }
+    }
+    delete[] vectors;
+    delete[] sizes;
+}
+
+// Flat (CSR) read functions
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_integers_flat(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      int64_t** out_values,
+                                                                      size_t** out_offsets,
+                                                                      size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_offsets || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_flat_impl(
+            db->db.read_vector_integers_flat(collection, attribute), out_values, out_offsets, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_floats_flat(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const char* attribute,
+                                                                    double** out_values,
+                                                                    size_t** out_offsets,
+                                                                    size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_offsets || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_flat_impl(
+            db->db.read_vector_floats_flat(collection, attribute), out_values, out_offsets, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_strings_flat(quiver_database_t* db,
+                                                                     const char* collection,
+                                                                     const char* attribute,
+                                                                     char*** out_values,
+                                                                     size_t** out_offsets,
+                                                                     size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_offsets || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_flat_strings_impl(
+            db->db.read_vector_strings_flat(collection, attribute), out_values, out_offsets, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_integers_flat(quiver_database_t* db,
+                                                                   const char* collection,
+                                                                   const char* attribute,
+                                                                   int64_t** out_values,
+                                                                   size_t** out_offsets,
+                                                                   size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_offsets || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_flat_impl(db->db.read_set_integers_flat(collection, attribute), out_values, out_offsets, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_floats_flat(quiver_database_t* db,
+                                                                 const char* collection,
+                                                                 const char* attribute,
+                                                                 double** out_values,
+                                                                 size_t** out_offsets,
+                                                                 size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_offsets || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_flat_impl(db->db.read_set_floats_flat(collection, attribute), out_values, out_offsets, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_strings_flat(quiver_database_t* db,
+                                                                  const char* collection,
+                                                                  const char* attribute,
+                                                                  char*** out_values,
+                                                                  size_t** out_offsets,
+                                                                  size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_offsets || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_flat_strings_impl(
+            db->db.read_set_strings_flat(collection, attribute), out_values, out_offsets, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_integers_flat_aligned(quiver_database_t* db,
+                                                                              const char* collection,
+                                                                              const char* attribute,
+                                                                              int64_t** out_values,
+                                                                              size_t** out_offsets,
+                                                                              size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_offsets || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        const auto index = db->db.read_id_index(collection);
+        return read_flat_impl(
+            db->db.read_vector_integers_flat(collection, attribute, index), out_values, out_offsets, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_floats_flat_aligned(quiver_database_t* db,
+                                                                            const char* collection,
+                                                                            const char* attribute,
+                                                                            double** out_values,
+                                                                            size_t** out_offsets,
+                                                                            size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_offsets || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        const auto index = db->db.read_id_index(collection);
+        return read_flat_impl(
+            db->db.read_vector_floats_flat(collection, attribute, index), out_values, out_offsets, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_strings_flat_aligned(quiver_database_t* db,
+                                                                             const char* collection,
+                                                                             const char* attribute,
+                                                                             char*** out_values,
+                                                                             size_t** out_offsets,
+                                                                             size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_offsets || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        const auto index = db->db.read_id_index(collection);
+        return read_flat_strings_impl(
+            db->db.read_vector_strings_flat(collection, attribute, index), out_values, out_offsets, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_integers_flat_aligned(quiver_database_t* db,
+                                                                           const char* collection,
+                                                                           const char* attribute,
+                                                                           int64_t** out_values,
+                                                                           size_t** out_offsets,
+                                                                           size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_offsets || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        const auto index = db->db.read_id_index(collection);
+        return read_flat_impl(
+            db->db.read_set_integers_flat(collection, attribute, index), out_values, out_offsets, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_floats_flat_aligned(quiver_database_t* db,
+                                                                         const char* collection,
+                                                                         const char* attribute,
+                                                                         double** out_values,
+                                                                         size_t** out_offsets,
+                                                                         size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_offsets || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        const auto index = db->db.read_id_index(collection);
+        return read_flat_impl(
+            db->db.read_set_floats_flat(collection, attribute, index), out_values, out_offsets, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_strings_flat_aligned(quiver_database_t* db,
+                                                                          const char* collection,
+                                                                          const char* attribute,
+                                                                          char*** out_values,
+                                                                          size_t** out_offsets,
+                                                                          size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_offsets || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        const auto index = db->db.read_id_index(collection);
+        return read_flat_strings_impl(
+            db->db.read_set_strings_flat(collection, attribute, index), out_values, out_offsets, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_arena(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      int intern,
+                                                                      char*** out_values,
+                                                                      size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_arena_impl(
+            db->db.read_scalar_strings_arena(collection, attribute, intern != 0), out_values, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_relation_arena(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* attribute,
+                                                                       int intern,
+                                                                       char*** out_values,
+                                                                       size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_arena_impl(
+            db->db.read_scalar_relation_arena(collection, attribute, intern != 0), out_values, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_strings_arena(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      int intern,
+                                                                      char*** out_values,
+                                                                      size_t** out_offsets,
+                                                                      size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_offsets || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_flat_arena_impl(db->db.read_vector_strings_arena(collection, attribute, intern != 0),
+                                    out_values,
+                                    out_offsets,
+                                    out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_strings_arena(quiver_database_t* db,
+                                                                   const char* collection,
+                                                                   const char* attribute,
+                                                                   int intern,
+                                                                   char*** out_values,
+                                                                   size_t** out_offsets,
+                                                                   size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_offsets || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_flat_arena_impl(
+            db->db.read_set_strings_arena(collection, attribute, intern != 0), out_values, out_offsets, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API void quiver_free_integer_flat(int64_t* values, size_t* offsets) {
+    delete[] values;
+    delete[] offsets;
+}
+
+QUIVER_C_API void quiver_free_float_flat(double* values, size_t* offsets) {
+    delete[] values;
+    delete[] offsets;
+}
+
+QUIVER_C_API void quiver_free_string_flat(char** values, size_t* offsets, size_t count) {
+    if (values && offsets) {
+        for (size_t i = 0; i < offsets[count]; ++i) {
+            delete[] values[i];
+        }
+    }
+    delete[] values;
+    delete[] offsets;
+}
+
+QUIVER_C_API void quiver_free_string_arena(char** values) {
+    delete[] reinterpret_cast<char*>(values);
+}
+
+QUIVER_C_API void quiver_free_string_arena_flat(char** values, size_t* offsets) {
+    quiver_free_string_arena(values);
+    delete[] offsets;
+}
+
+QUIVER_C_API void quiver_free_time_series_floats(char** date_times, double* values, size_t count) {
+    quiver_free_string_array(date_times, count);
+    delete[] values;
+}
+
+QUIVER_C_API void
+quiver_free_scalar_columns(int64_t* ids, quiver_scalar_column_t* columns, size_t column_count, size_t count) {
+    delete[] ids;
+    if (!columns) {
+        return;
+    }
+    for (size_t c = 0; c < column_count; ++c) {
+        delete[] columns[c].name;
+        delete[] columns[c].integers;
+        delete[] columns[c].floats;
+        quiver_free_string_array(columns[c].strings, count);
+        delete[] columns[c].nulls;
+    }
+    delete[] columns;
+}
+
+// Set read functions (reuse vector helpers since sets have same return structure)
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_integers(quiver_database_t* db,
+                                                              const char* collection,
+                                                              const char* attribute,
+                                                              int64_t*** out_sets,
+                                                              size_t** out_sizes,
+                                                              size_t* out_count) {
+    if (!db || !collection || !attribute || !out_sets || !out_sizes || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_vectors_impl(db->db.read_set_integers(collection, attribute), out_sets, out_sizes, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_floats(quiver_database_t* db,
+                                                            const char* collection,
+                                                            const char* attribute,
+                                                            double*** out_sets,
+                                                            size_t** out_sizes,
+                                                            size_t* out_count) {
+    if (!db || !collection || !attribute || !out_sets || !out_sizes || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_vectors_impl(db->db.read_set_floats(collection, attribute), out_sets, out_sizes, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_strings(quiver_database_t* db,
+                                                             const char* collection,
+                                                             const char* attribute,
+                                                             char**** out_sets,
+                                                             size_t** out_sizes,
+                                                             size_t* out_count) {
+    if (!db || !collection || !attribute || !out_sets || !out_sizes || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto sets = db->db.read_set_strings(collection, attribute);
+        *out_count = sets.size();
+        if (sets.empty()) {
+            *out_sets = nullptr;
+            *out_sizes = nullptr;
+            return QUIVER_OK;
+        }
+        *out_sets = new char**[sets.size()];
+        *out_sizes = new size_t[sets.size()];
+        for (size_t i = 0; i < sets.size(); ++i) {
+            (*out_sizes)[i] = sets[i].size();
+            if (sets[i].empty()) {
+                (*out_sets)[i] = nullptr;
+            } else {
+                (*out_sets)[i] = new char*[sets[i].size()];
+                for (size_t j = 0; j < sets[i].size(); ++j) {
+                    (*out_sets)[i][j] = new char[sets[i][j].size() + 1];
+                    std::copy(sets[i][j].begin(), sets[i][j].end(), (*out_sets)[i][j]);
+                    (*out_sets)[i][j][sets[i][j].size()] = '\0';
+                }
+            }
+        }
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+// Read scalar by ID functions
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_by_id(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* attribute,
+                                                                       int64_t id,
+                                                                       int64_t* out_value,
+                                                                       int* out_has_value) {
+    if (!db || !collection || !attribute || !out_value || !out_has_value) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto result = db->db.read_scalar_integers_by_id(collection, attribute, id);
+        if (result.has_value()) {
+            *out_value = *result;
+            *out_has_value = 1;
+        } else {
+            *out_has_value = 0;
+        }
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_by_id(quiver_database_t* db,
+                                                                     const char* collection,
+                                                                     const char* attribute,
+                                                                     int64_t id,
+                                                                     double* out_value,
+                                                                     int* out_has_value) {
+    if (!db || !collection || !attribute || !out_value || !out_has_value) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto result = db->db.read_scalar_floats_by_id(collection, attribute, id);
+        if (result.has_value()) {
+            *out_value = *result;
+            *out_has_value = 1;
+        } else {
+            *out_has_value = 0;
+        }
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_by_id(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      int64_t id,
+                                                                      char** out_value,
+                                                                      int* out_has_value) {
+    if (!db || !collection || !attribute || !out_value || !out_has_value) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto result = db->db.read_scalar_strings_by_id(collection, attribute, id);
+        if (result.has_value()) {
+            *out_value = new char[result->size() + 1];
+            std::copy(result->begin(), result->end(), *out_value);
+            (*out_value)[result->size()] = '\0';
+            *out_has_value = 1;
+        } else {
+            *out_value = nullptr;
+            *out_has_value = 0;
+        }
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+// Read vector by ID functions
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_integers_by_id(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* attribute,
+                                                                       int64_t id,
+                                                                       int64_t** out_values,
+                                                                       size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto values = db->db.read_vector_integers_by_id(collection, attribute, id);
+        return read_scalars_impl(values, out_values, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_floats_by_id(quiver_database_t* db,
+                                                                     const char* collection,
+                                                                     const char* attribute,
+                                                                     int64_t id,
+                                                                     double** out_values,
+                                                                     size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto values = db->db.read_vector_floats_by_id(collection, attribute, id);
+        return read_scalars_impl(values, out_values, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_strings_by_id(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      int64_t id,
+                                                                      char*** out_values,
+                                                                      size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return copy_strings_to_c(db->db.read_vector_strings_by_id(collection, attribute, id), out_values, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_floats_range(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const char* attribute,
+                                                                    int64_t id,
+                                                                    int64_t first,
+                                                                    int64_t count,
+                                                                    double** out_values,
+                                                                    size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto values = db->db.read_vector_floats_range(collection, attribute, id, first, count);
+        return read_scalars_impl(values, out_values, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+// Read set by ID functions
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_integers_by_id(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const char* attribute,
+                                                                    int64_t id,
+                                                                    int64_t** out_values,
+                                                                    size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto values = db->db.read_set_integers_by_id(collection, attribute, id);
+        return read_scalars_impl(values, out_values, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_floats_by_id(quiver_database_t* db,
+                                                                  const char* collection,
+                                                                  const char* attribute,
+                                                                  int64_t id,
+                                                                  double** out_values,
+                                                                  size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto values = db->db.read_set_floats_by_id(collection, attribute, id);
+        return read_scalars_impl(values, out_values, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_strings_by_id(quiver_database_t* db,
+                                                                   const char* collection,
+                                                                   const char* attribute,
+                                                                   int64_t id,
+                                                                   char*** out_values,
+                                                                   size_t* out_count) {
+    if (!db || !collection || !attribute || !out_values || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return copy_strings_to_c(db->db.read_set_strings_by_id(collection, attribute, id), out_values, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_by_ids(quiver_database_t* db,
+                                                                        const char* collection,
+                                                                        const char* attribute,
+                                                                        const int64_t* ids,
+                                                                        size_t id_count,
+                                                                        int64_t** out_values,
+                                                                        uint8_t** out_validity) {
+    if (!db || !collection || !attribute || (id_count > 0 && !ids) || !out_values || !out_validity) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        size_t count = 0;
+        auto result =
+            db->db.read_scalar_integers_by_ids(collection, attribute, std::span<const int64_t>(ids, id_count));
+        return read_nullable_impl(result, out_values, out_validity, &count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_by_ids(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      const int64_t* ids,
+                                                                      size_t id_count,
+                                                                      double** out_values,
+                                                                      uint8_t** out_validity) {
+    if (!db || !collection || !attribute || (id_count > 0 && !ids) || !out_values || !out_validity) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        size_t count = 0;
+        auto result = db->db.read_scalar_floats_by_ids(collection, attribute, std::span<const int64_t>(ids, id_count));
+        return read_nullable_impl(result, out_values, out_validity, &count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_by_ids(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* attribute,
+                                                                       const int64_t* ids,
+                                                                       size_t id_count,
+                                                                       char*** out_values,
+                                                                       uint8_t** out_validity) {
+    if (!db || !collection || !attribute || (id_count > 0 && !ids) || !out_values || !out_validity) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        size_t count = 0;
+        auto result = db->db.read_scalar_strings_by_ids(collection, attribute, std::span<const int64_t>(ids, id_count));
+        return read_nullable_strings_impl(result, out_values, out_validity, &count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_integers_by_ids(quiver_database_t* db,
+                                                                        const char* collection,
+                                                                        const char* attribute,
+                                                                        const int64_t* ids,
+                                                                        size_t id_count,
+                                                                        int64_t** out_values,
+                                                                        size_t** out_offsets) {
+    if (!db || !collection || !attribute || (id_count > 0 && !ids) || !out_values || !out_offsets) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        size_t count = 0;
+        auto result =
+            db->db.read_vector_integers_by_ids(collection, attribute, std::span<const int64_t>(ids, id_count));
+        return read_flat_impl(result, out_values, out_offsets, &count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_floats_by_ids(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      const int64_t* ids,
+                                                                      size_t id_count,
+                                                                      double** out_values,
+                                                                      size_t** out_offsets) {
+    if (!db || !collection || !attribute || (id_count > 0 && !ids) || !out_values || !out_offsets) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        size_t count = 0;
+        auto result = db->db.read_vector_floats_by_ids(collection, attribute, std::span<const int64_t>(ids, id_count));
+        return read_flat_impl(result, out_values, out_offsets, &count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_strings_by_ids(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* attribute,
+                                                                       const int64_t* ids,
+                                                                       size_t id_count,
+                                                                       char*** out_values,
+                                                                       size_t** out_offsets) {
+    if (!db || !collection || !attribute || (id_count > 0 && !ids) || !out_values || !out_offsets) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        size_t count = 0;
+        auto result = db->db.read_vector_strings_by_ids(collection, attribute, std::span<const int64_t>(ids, id_count));
+        return read_flat_strings_impl(result, out_values, out_offsets, &count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_integers_by_ids(quiver_database_t* db,
+                                                                     const char* collection,
+                                                                     const char* attribute,
+                                                                     const int64_t* ids,
+                                                                     size_t id_count,
+                                                                     int64_t** out_values,
+                                                                     size_t** out_offsets) {
+    if (!db || !collection || !attribute || (id_count > 0 && !ids) || !out_values || !out_offsets) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        size_t count = 0;
+        auto result = db->db.read_set_integers_by_ids(collection, attribute, std::span<const int64_t>(ids, id_count));
+        return read_flat_impl(result, out_values, out_offsets, &count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_floats_by_ids(quiver_database_t* db,
+                                                                   const char* collection,
+                                                                   const char* attribute,
+                                                                   const int64_t* ids,
+                                                                   size_t id_count,
+                                                                   double** out_values,
+                                                                   size_t** out_offsets) {
+    if (!db || !collection || !attribute || (id_count > 0 && !ids) || !out_values || !out_offsets) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        size_t count = 0;
+        auto result = db->db.read_set_floats_by_ids(collection, attribute, std::span<const int64_t>(ids, id_count));
+        return read_flat_impl(result, out_values, out_offsets, &count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_strings_by_ids(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const char* attribute,
+                                                                    const int64_t* ids,
+                                                                    size_t id_count,
+                                                                    char*** out_values,
+                                                                    size_t** out_offsets) {
+    if (!db || !collection || !attribute || (id_count > 0 && !ids) || !out_values || !out_offsets) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        size_t count = 0;
+        auto result = db->db.read_set_strings_by_ids(collection, attribute, std::span<const int64_t>(ids, id_count));
+        return read_flat_strings_impl(result, out_values, out_offsets, &count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_time_series_floats(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const char* attribute,
+                                                                    int64_t id,
+                                                                    const char* date_time_from,
+                                                                    const char* date_time_to,
+                                                                    char*** out_date_times,
+                                                                    double** out_values,
+                                                                    size_t* out_count) {
+    if (!db || !collection || !attribute || !out_date_times || !out_values || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto from = date_time_from ? std::optional<std::string>(date_time_from) : std::nullopt;
+        auto to = date_time_to ? std::optional<std::string>(date_time_to) : std::nullopt;
+        auto series = db->db.read_time_series_floats(collection, attribute, id, from, to);
+        size_t date_count = 0;
+        copy_strings_to_c(series.date_times, out_date_times, &date_count);
+        return read_scalars_impl(series.values, out_values, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_aggregate_vector(quiver_database_t* db,
+                                                             const char* collection,
+                                                             const char* attribute,
+                                                             const quiver_aggregate_t* statistics,
+                                                             size_t statistic_count,
+                                                             int64_t** out_ids,
+                                                             double** out_values,
+                                                             size_t* out_count) {
+    std::vector<quiver::Aggregate> cpp_statistics;
+    if (!db || !collection || !attribute || (statistic_count > 0 && !statistics) || !out_ids || !out_values ||
+        !out_count || !to_aggregates(statistics, statistic_count, cpp_statistics)) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto aggregates = db->db.aggregate_vector(collection, attribute, cpp_statistics);
+        *out_count = aggregates.size();
+        return copy_aggregates(aggregates, out_ids, out_values);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_aggregate_time_series(quiver_database_t* db,
+                                                                  const char* collection,
+                                                                  const char* attribute,
+                                                                  quiver_time_bucket_t bucket,
+                                                                  const quiver_aggregate_t* statistics,
+                                                                  size_t statistic_count,
+                                                                  int64_t** out_ids,
+                                                                  char*** out_buckets,
+                                                                  double** out_values,
+                                                                  size_t* out_count) {
+    std::vector<quiver::Aggregate> cpp_statistics;
+    if (!db || !collection || !attribute || (statistic_count > 0 && !statistics) || !out_ids || !out_buckets ||
+        !out_values || !out_count || !to_aggregates(statistics, statistic_count, cpp_statistics)) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    if (bucket < QUIVER_TIME_BUCKET_YEAR || bucket > QUIVER_TIME_BUCKET_HOUR) {
+        quiver_set_last_error("Unknown time bucket");
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        auto aggregates = db->db.aggregate_time_series(
+            collection, attribute, static_cast<quiver::TimeBucket>(bucket), cpp_statistics);
+        copy_strings_to_c(aggregates.buckets, out_buckets, out_count);
+        return copy_aggregates(aggregates, out_ids, out_values);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_element_ids(quiver_database_t* db,
+                                                             const char* collection,
+                                                             int64_t** out_ids,
+                                                             size_t* out_count) {
+    if (!db || !collection || !out_ids || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_scalars_impl(db->db.read_element_ids(collection), out_ids, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+// Filtered bulk reads (quiver/c/filter.h)
+
+QUIVER_C_API quiver_error_t quiver_database_read_element_ids_filtered(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const quiver_filter_t* filter,
+                                                                      int64_t** out_ids,
+                                                                      size_t* out_count) {
+    if (!db || !collection || !filter || !out_ids || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_scalars_impl(db->db.read_element_ids(collection, filter->filter), out_ids, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_delete_elements_where(quiver_database_t* db,
+                                                                  const char* collection,
+                                                                  const quiver_filter_t* filter,
+                                                                  size_t* out_deleted) {
+    if (!db || !collection || !filter || !out_deleted) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        *out_deleted = db->db.delete_elements_where(collection, filter->filter);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_filtered(quiver_database_t* db,
+                                                                          const char* collection,
+                                                                          const char* attribute,
+                                                                          const quiver_filter_t* filter,
+                                                                          int64_t** out_values,
+                                                                          size_t* out_count) {
+    if (!db || !collection || !attribute || !filter || !out_values || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_scalars_impl(
+            db->db.read_scalar_integers(collection, attribute, filter->filter), out_values, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_filtered(quiver_database_t* db,
+                                                                        const char* collection,
+                                                                        const char* attribute,
+                                                                        const quiver_filter_t* filter,
+                                                                        double** out_values,
+                                                                        size_t* out_count) {
+    if (!db || !collection || !attribute || !filter || !out_values || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_scalars_impl(
+            db->db.read_scalar_floats(collection, attribute, filter->filter), out_values, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_filtered(quiver_database_t* db,
+                                                                         const char* collection,
+                                                                         const char* attribute,
+                                                                         const quiver_filter_t* filter,
+                                                                         char*** out_values,
+                                                                         size_t* out_count) {
+    if (!db || !collection || !attribute || !filter || !out_values || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return copy_strings_to_c(
+            db->db.read_scalar_strings(collection, attribute, filter->filter), out_values, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_integers_flat_filtered(quiver_database_t* db,
+                                                                               const char* collection,
+                                                                               const char* attribute,
+                                                                               const quiver_filter_t* filter,
+                                                                               int64_t** out_values,
+                                                                               size_t** out_offsets,
+                                                                               size_t* out_count) {
+    if (!db || !collection || !attribute || !filter || !out_values || !out_offsets || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_flat_impl(
+            db->db.read_vector_integers_flat(collection, attribute, filter->filter),
+            out_values,
+            out_offsets,
+            out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_floats_flat_filtered(quiver_database_t* db,
+                                                                             const char* collection,
+                                                                             const char* attribute,
+                                                                             const quiver_filter_t* filter,
+                                                                             double** out_values,
+                                                                             size_t** out_offsets,
+                                                                             size_t* out_count) {
+    if (!db || !collection || !attribute || !filter || !out_values || !out_offsets || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_flat_impl(
+            db->db.read_vector_floats_flat(collection, attribute, filter->filter), out_values, out_offsets, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_vector_strings_flat_filtered(quiver_database_t* db,
+                                                                              const char* collection,
+                                                                              const char* attribute,
+                                                                              const quiver_filter_t* filter,
+                                                                              char*** out_values,
+                                                                              size_t** out_offsets,
+                                                                              size_t* out_count) {
+    if (!db || !collection || !attribute || !filter || !out_values || !out_offsets || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_flat_strings_impl(
+            db->db.read_vector_strings_flat(collection, attribute, filter->filter), out_values, out_offsets, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_integers_flat_filtered(quiver_database_t* db,
+                                                                            const char* collection,
+                                                                            const char* attribute,
+                                                                            const quiver_filter_t* filter,
+                                                                            int64_t** out_values,
+                                                                            size_t** out_offsets,
+                                                                            size_t* out_count) {
+    if (!db || !collection || !attribute || !filter || !out_values || !out_offsets || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return read_flat_impl(
+            db->db.read_set_integers_flat(collection, attribute, filter->filter), out_values, out_offsets, out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_set_floats_flat_filtered(quiver_database_t* db,
+                                                                          const char* collection,
+                                                                          const char* attribute,
+                                                                          const quiver_filter_t* filter,
+                                                                          double** out_values,
+                                                                          size_t** out_offsets,
+                                                                          size_t* out_count) {
+    if (!db || !collection || !attribute || !filter || !out_values || !out_offsets || !out_count) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
     try {
-        return copy_strings_to_c(db->db.read_set_strings_by_id(collection, attribute, id), out_values, out_count);
+        return read_flat_impl(
+            db->db.read_set_floats_flat(collection, attribute, filter->filter), out_values, out_offsets, out_count);
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
         return QUIVER_ERROR_DATABASE;
     }
 }
 
-QUIVER_C_API quiver_error_t quiver_database_read_element_ids(quiver_database_t* db,
-                                                             const char* collection,
-                                                             int64_t** out_ids,
-                                                             size_t* out_count) {
-    if (!db || !collection || !out_ids || !out_count) {
+QUIVER_C_API quiver_error_t quiver_database_read_set_strings_flat_filtered(quiver_database_t* db,
+                                                                           const char* collection,
+                                                                           const char* attribute,
+                                                                           const quiver_filter_t* filter,
+                                                                           char*** out_values,
+                                                                           size_t** out_offsets,
+                                                                           size_t* out_count) {
+    if (!db || !collection || !attribute || !filter || !out_values || !out_offsets || !out_count) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
     try {
-        return read_scalars_impl(db->db.read_element_ids(collection), out_ids, out_count);
+        return read_flat_strings_impl(
+            db->db.read_set_strings_flat(collection, attribute, filter->filter), out_values, out_offsets, out_count);
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
         return QUIVER_ERROR_DATABASE;
@@ -764,6 +2439,70 @@ QUIVER_C_API quiver_error_t quiver_database_update_scalar_string(quiver_database
     }
 }
 
+QUIVER_C_API quiver_error_t quiver_database_update_scalar_integers(quiver_database_t* db,
+                                                                   const char* collection,
+                                                                   const char* attribute,
+                                                                   const int64_t* ids,
+                                                                   const int64_t* values,
+                                                                   size_t count) {
+    if (!db || !collection || !attribute || (count > 0 && (!ids || !values))) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        db->db.update_scalar_integers(
+            collection, attribute, std::span<const int64_t>(ids, count), std::span<const int64_t>(values, count));
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_update_scalar_floats(quiver_database_t* db,
+                                                                 const char* collection,
+                                                                 const char* attribute,
+                                                                 const int64_t* ids,
+                                                                 const double* values,
+                                                                 size_t count) {
+    if (!db || !collection || !attribute || (count > 0 && (!ids || !values))) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        db->db.update_scalar_floats(
+            collection, attribute, std::span<const int64_t>(ids, count), std::span<const double>(values, count));
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_update_scalar_strings(quiver_database_t* db,
+                                                                  const char* collection,
+                                                                  const char* attribute,
+                                                                  const int64_t* ids,
+                                                                  const char* const* values,
+                                                                  size_t count) {
+    if (!db || !collection || !attribute || (count > 0 && (!ids || !values))) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        std::vector<std::string> strings;
+        strings.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            if (!values[i]) {
+                return QUIVER_ERROR_INVALID_ARGUMENT;
+            }
+            strings.emplace_back(values[i]);
+        }
+        db->db.update_scalar_strings(collection, attribute, std::span<const int64_t>(ids, count), strings);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
 // Update vector functions
 
 QUIVER_C_API quiver_error_t quiver_database_update_vector_integers(quiver_database_t* db,
@@ -827,6 +2566,125 @@ QUIVER_C_API quiver_error_t quiver_database_update_vector_strings(quiver_databas
     }
 }
 
+// Append vector functions
+
+QUIVER_C_API quiver_error_t quiver_database_append_vector_integers(quiver_database_t* db,
+                                                                   const char* collection,
+                                                                   const char* attribute,
+                                                                   int64_t id,
+                                                                   const int64_t* values,
+                                                                   size_t count) {
+    if (!db || !collection || !attribute || (count > 0 && !values)) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        std::vector<int64_t> vec(values, values + count);
+        db->db.append_vector_integers(collection, attribute, id, vec);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_append_vector_floats(quiver_database_t* db,
+                                                                 const char* collection,
+                                                                 const char* attribute,
+                                                                 int64_t id,
+                                                                 const double* values,
+                                                                 size_t count) {
+    if (!db || !collection || !attribute || (count > 0 && !values)) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        std::vector<double> vec(values, values + count);
+        db->db.append_vector_floats(collection, attribute, id, vec);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_append_vector_strings(quiver_database_t* db,
+                                                                  const char* collection,
+                                                                  const char* attribute,
+                                                                  int64_t id,
+                                                                  const char* const* values,
+                                                                  size_t count) {
+    if (!db || !collection || !attribute || (count > 0 && !values)) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        std::vector<std::string> vec;
+        vec.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            vec.emplace_back(values[i]);
+        }
+        db->db.append_vector_strings(collection, attribute, id, vec);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+// Update vector entry functions
+
+QUIVER_C_API quiver_error_t quiver_database_update_vector_integer_entry(quiver_database_t* db,
+                                                                        const char* collection,
+                                                                        const char* attribute,
+                                                                        int64_t id,
+                                                                        int64_t index,
+                                                                        int64_t value) {
+    if (!db || !collection || !attribute) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        db->db.update_vector_integer_entry(collection, attribute, id, index, value);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_update_vector_float_entry(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      int64_t id,
+                                                                      int64_t index,
+                                                                      double value) {
+    if (!db || !collection || !attribute) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        db->db.update_vector_float_entry(collection, attribute, id, index, value);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_update_vector_string_entry(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* attribute,
+                                                                       int64_t id,
+                                                                       int64_t index,
+                                                                       const char* value) {
+    if (!db || !collection || !attribute || !value) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        db->db.update_vector_string_entry(collection, attribute, id, index, value);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
 // Update set functions
 
 QUIVER_C_API quiver_error_t quiver_database_update_set_integers(quiver_database_t* db,
@@ -890,29 +2748,156 @@ QUIVER_C_API quiver_error_t quiver_database_update_set_strings(quiver_database_t
     }
 }
 
-// Helper to convert C++ DataType to C quiver_data_type_t
-namespace {
-quiver_data_type_t to_c_data_type(quiver::DataType type) {
-    switch (type) {
-    case quiver::DataType::Integer:
-        return QUIVER_DATA_TYPE_INTEGER;
-    case quiver::DataType::Real:
-        return QUIVER_DATA_TYPE_FLOAT;
-    case quiver::DataType::Text:
-        return QUIVER_DATA_TYPE_STRING;
-    case quiver::DataType::DateTime:
-        return QUIVER_DATA_TYPE_DATE_TIME;
-    }
-    return QUIVER_DATA_TYPE_INTEGER;
-}
-
-char* strdup_safe(const std::string& str) {
-    char* result = new char[str.size() + 1];
-    std::copy(str.begin(), str.end(), result);
-    result[str.size()] = '\0';
-    return result;
+QUIVER_C_API quiver_error_t quiver_database_update_time_series_floats(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      int64_t id,
+                                                                      const char* const* date_times,
+                                                                      const double* values,
+                                                                      size_t count) {
+    if (!db || !collection || !attribute || (count > 0 && (!date_times || !values))) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        std::vector<std::string> dates;
+        dates.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            if (!date_times[i]) {
+                return QUIVER_ERROR_INVALID_ARGUMENT;
+            }
+            dates.emplace_back(date_times[i]);
+        }
+        std::vector<double> vec(values, values + count);
+        db->db.update_time_series_floats(collection, attribute, id, dates, vec);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalars(quiver_database_t* db,
+                                                         const char* collection,
+                                                         const char* const* attributes,
+                                                         size_t attribute_count,
+                                                         int64_t** out_ids,
+                                                         quiver_scalar_column_t** out_columns,
+                                                         size_t* out_count) {
+    if (!db || !collection || (attribute_count > 0 && !attributes) || !out_ids || !out_columns || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        std::vector<std::string> names;
+        names.reserve(attribute_count);
+        for (size_t i = 0; i < attribute_count; ++i) {
+            if (!attributes[i]) {
+                return QUIVER_ERROR_INVALID_ARGUMENT;
+            }
+            names.emplace_back(attributes[i]);
+        }
+        auto result = db->db.read_scalars(collection, names);
+
+        const auto count = result.size();
+        read_scalars_impl(result.ids, out_ids, out_count);
+        *out_columns = attribute_count > 0 ? new quiver_scalar_column_t[attribute_count]() : nullptr;
+        for (size_t c = 0; c < attribute_count; ++c) {
+            const auto& column = result.columns[c];
+            auto& out = (*out_columns)[c];
+            out.name = strdup_safe(column.name);
+            out.data_type = to_c_data_type(column.type);
+            if (count == 0) {
+                continue;
+            }
+            out.nulls = new uint8_t[count];
+            std::copy(column.nulls.begin(), column.nulls.end(), out.nulls);
+            switch (column.type) {
+            case quiver::DataType::Integer:
+                out.integers = new int64_t[count];
+                std::copy(column.integers.begin(), column.integers.end(), out.integers);
+                break;
+            case quiver::DataType::Real:
+                out.floats = new double[count];
+                std::copy(column.floats.begin(), column.floats.end(), out.floats);
+                break;
+            case quiver::DataType::Text:
+            case quiver::DataType::DateTime:
+                out.strings = new char*[count];
+                for (size_t i = 0; i < count; ++i) {
+                    out.strings[i] = column.is_null(i) ? nullptr : strdup_safe(column.strings[i]);
+                }
+                break;
+            }
+        }
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_create_elements_columns(quiver_database_t* db,
+                                                                    const char* collection,
+                                                                    const quiver_scalar_column_t* columns,
+                                                                    size_t column_count,
+                                                                    size_t count,
+                                                                    int64_t* out_ids) {
+    if (!db || !collection || (column_count > 0 && !columns) || (count > 0 && !out_ids)) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    for (size_t c = 0; c < column_count; ++c) {
+        const auto& column = columns[c];
+        const void* values = nullptr;
+        switch (column.data_type) {
+        case QUIVER_DATA_TYPE_INTEGER:
+            values = column.integers;
+            break;
+        case QUIVER_DATA_TYPE_FLOAT:
+            values = column.floats;
+            break;
+        case QUIVER_DATA_TYPE_STRING:
+        case QUIVER_DATA_TYPE_DATE_TIME:
+            values = column.strings;
+            break;
+        default:
+            break;
+        }
+        if (!column.name || (count > 0 && !values)) {
+            quiver_set_last_error("Invalid column at index " + std::to_string(c));
+            return QUIVER_ERROR_INVALID_ARGUMENT;
+        }
+    }
+    try {
+        std::vector<quiver::Element> elements(count);
+        for (size_t c = 0; c < column_count; ++c) {
+            const auto& column = columns[c];
+            const std::string name = column.name;
+            for (size_t i = 0; i < count; ++i) {
+                if (column.nulls && column.nulls[i]) {
+                    continue;
+                }
+                switch (column.data_type) {
+                case QUIVER_DATA_TYPE_INTEGER:
+                    elements[i].set(name, column.integers[i]);
+                    break;
+                case QUIVER_DATA_TYPE_FLOAT:
+                    elements[i].set(name, column.floats[i]);
+                    break;
+                default:
+                    if (column.strings[i]) {
+                        elements[i].set(name, std::string(column.strings[i]));
+                    }
+                    break;
+                }
+            }
+        }
+        const auto ids = db->db.create_elements(collection, elements);
+        std::copy(ids.begin(), ids.end(), out_ids);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
 }
-}  // namespace
 
 QUIVER_C_API quiver_error_t quiver_database_get_scalar_metadata(quiver_database_t* db,
                                                                 const char* collection,
@@ -1247,6 +3232,36 @@ QUIVER_C_API quiver_error_t quiver_database_import_from_csv(quiver_database_t* d
     }
 }
 
+QUIVER_C_API quiver_error_t quiver_database_export_collection(quiver_database_t* db,
+                                                              const char* collection,
+                                                              const char* directory) {
+    if (!db || !collection || !directory) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        db->db.export_collection(collection, directory);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_import_collection(quiver_database_t* db,
+                                                              const char* collection,
+                                                              const char* directory) {
+    if (!db || !collection || !directory) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        db->db.import_collection(collection, directory);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
 QUIVER_C_API quiver_error_t quiver_database_query_string(quiver_database_t* db,
                                                          const char* sql,
                                                          char** out_value,
@@ -1314,32 +3329,6 @@ QUIVER_C_API quiver_error_t quiver_database_query_float(quiver_database_t* db,
     }
 }
 
-// Helper to convert C param arrays to std::vector<Value>
-static std::vector<quiver::Value>
-convert_params(const int* param_types, const void* const* param_values, size_t param_count) {
-    std::vector<quiver::Value> params;
-    params.reserve(param_count);
-    for (size_t i = 0; i < param_count; ++i) {
-        switch (param_types[i]) {
-        case QUIVER_DATA_TYPE_INTEGER:
-            params.emplace_back(*static_cast<const int64_t*>(param_values[i]));
-            break;
-        case QUIVER_DATA_TYPE_FLOAT:
-            params.emplace_back(*static_cast<const double*>(param_values[i]));
-            break;
-        case QUIVER_DATA_TYPE_STRING:
-            params.emplace_back(std::string(static_cast<const char*>(param_values[i])));
-            break;
-        case QUIVER_DATA_TYPE_NULL:
-            params.emplace_back(nullptr);
-            break;
-        default:
-            throw std::runtime_error("Unknown parameter type: " + std::to_string(param_types[i]));
-        }
-    }
-    return params;
-}
-
 QUIVER_C_API quiver_error_t quiver_database_query_string_params(quiver_database_t* db,
                                                                 const char* sql,
                                                                 const int* param_types,
@@ -1432,4 +3421,17 @@ QUIVER_C_API quiver_error_t quiver_database_describe(quiver_database_t* db) {
     }
 }
 
+QUIVER_C_API quiver_error_t quiver_database_create_missing_indexes(quiver_database_t* db, size_t* out_created) {
+    if (!db || !out_created) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        *out_created = db->db.create_missing_indexes();
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
 }  // extern "C"
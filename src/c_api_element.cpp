@@ -2,8 +2,87 @@
 #include "quiver/c/element.h"
 
 #include <cstring>
+#include <iterator>
 #include <new>
+#include <span>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace {
+
+template <typename Map>
+const char* name_at(const Map& map, size_t index) {
+    if (index >= map.size()) {
+        return nullptr;
+    }
+    return std::next(map.begin(), static_cast<std::ptrdiff_t>(index))->first.c_str();
+}
+
+// Scalar getters: NOT_FOUND for a missing name, INVALID_ARGUMENT for another type
+template <typename T, typename Out>
+quiver_error_t get_scalar(quiver_element_t* element, const char* name, Out* out_value, int* out_has_value) {
+    if (!element || !name || !out_value || !out_has_value) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    const auto& scalars = element->element.scalars();
+    auto it = scalars.find(name);
+    if (it == scalars.end()) {
+        quiver_set_last_error(std::string("Element has no scalar '") + name + "'");
+        return QUIVER_ERROR_NOT_FOUND;
+    }
+    if (std::holds_alternative<std::nullptr_t>(it->second)) {
+        *out_has_value = 0;
+        return QUIVER_OK;
+    }
+    const auto* value = std::get_if<T>(&it->second);
+    if (!value) {
+        quiver_set_last_error(std::string("Scalar '") + name + "' holds another type");
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    if constexpr (std::is_same_v<T, std::string>) {
+        *out_value = value->c_str();
+    } else {
+        *out_value = *value;
+    }
+    *out_has_value = 1;
+    return QUIVER_OK;
+}
+
+template <typename T>
+const std::vector<T>* find_array(quiver_element_t* element, const char* name, quiver_error_t& status) {
+    const auto& arrays = element->element.arrays();
+    auto it = arrays.find(name);
+    if (it == arrays.end()) {
+        quiver_set_last_error(std::string("Element has no array '") + name + "'");
+        status = QUIVER_ERROR_NOT_FOUND;
+        return nullptr;
+    }
+    const auto* values = std::get_if<std::vector<T>>(&it->second);
+    if (!values) {
+        quiver_set_last_error(std::string("Array '") + name + "' holds another type");
+        status = QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    return values;
+}
+
+template <typename T>
+quiver_error_t get_array(quiver_element_t* element, const char* name, const T** out_values, size_t* out_count) {
+    if (!element || !name || !out_values || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    quiver_error_t status = QUIVER_OK;
+    const auto* values = find_array<T>(element, name, status);
+    if (values) {
+        *out_values = values->data();
+        *out_count = values->size();
+    }
+    return status;
+}
+
+}  // namespace
 
 extern "C" {
 
@@ -64,8 +143,7 @@ QUIVER_C_API quiver_error_t quiver_element_set_array_integer(quiver_element_t* e
     if (!element || !name || (!values && count > 0) || count < 0) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
-    std::vector<int64_t> arr(values, values + count);
-    element->element.set(name, arr);
+    element->element.set(name, std::span<const int64_t>(values, static_cast<size_t>(count)));
     return QUIVER_OK;
 }
 
@@ -76,8 +154,7 @@ QUIVER_C_API quiver_error_t quiver_element_set_array_float(quiver_element_t* ele
     if (!element || !name || (!values && count > 0) || count < 0) {
         return QUIVER_ERROR_INVALID_ARGUMENT;
     }
-    std::vector<double> arr(values, values + count);
-    element->element.set(name, arr);
+    element->element.set(name, std::span<const double>(values, static_cast<size_t>(count)));
     return QUIVER_OK;
 }
 
@@ -93,7 +170,7 @@ QUIVER_C_API quiver_error_t quiver_element_set_array_string(quiver_element_t* el
     for (int32_t i = 0; i < count; ++i) {
         arr.emplace_back(values[i] ? values[i] : "");
     }
-    element->element.set(name, arr);
+    element->element.set(name, std::move(arr));
     return QUIVER_OK;
 }
 
@@ -125,6 +202,74 @@ QUIVER_C_API size_t quiver_element_array_count(quiver_element_t* element) {
     return element->element.arrays().size();
 }
 
+QUIVER_C_API const char* quiver_element_scalar_name(quiver_element_t* element, size_t index) {
+    return element ? name_at(element->element.scalars(), index) : nullptr;
+}
+
+QUIVER_C_API const char* quiver_element_array_name(quiver_element_t* element, size_t index) {
+    return element ? name_at(element->element.arrays(), index) : nullptr;
+}
+
+QUIVER_C_API quiver_error_t quiver_element_get_integer(quiver_element_t* element,
+                                                       const char* name,
+                                                       int64_t* out_value,
+                                                       int* out_has_value) {
+    return get_scalar<int64_t>(element, name, out_value, out_has_value);
+}
+
+QUIVER_C_API quiver_error_t quiver_element_get_float(quiver_element_t* element,
+                                                     const char* name,
+                                                     double* out_value,
+                                                     int* out_has_value) {
+    return get_scalar<double>(element, name, out_value, out_has_value);
+}
+
+QUIVER_C_API quiver_error_t quiver_element_get_string(quiver_element_t* element,
+                                                      const char* name,
+                                                      const char** out_value,
+                                                      int* out_has_value) {
+    return get_scalar<std::string>(element, name, out_value, out_has_value);
+}
+
+QUIVER_C_API quiver_error_t quiver_element_get_array_integer(quiver_element_t* element,
+                                                             const char* name,
+                                                             const int64_t** out_values,
+                                                             size_t* out_count) {
+    return get_array(element, name, out_values, out_count);
+}
+
+QUIVER_C_API quiver_error_t quiver_element_get_array_float(quiver_element_t* element,
+                                                           const char* name,
+                                                           const double** out_values,
+                                                           size_t* out_count) {
+    return get_array(element, name, out_values, out_count);
+}
+
+QUIVER_C_API quiver_error_t quiver_element_get_array_string(quiver_element_t* element,
+                                                            const char* name,
+                                                            char*** out_values,
+                                                            size_t* out_count) {
+    if (!element || !name || !out_values || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    quiver_error_t status = QUIVER_OK;
+    const auto* values = find_array<std::string>(element, name, status);
+    if (!values) {
+        return status;
+    }
+    try {
+        *out_count = values->size();
+        *out_values = values->empty() ? nullptr : new char*[values->size()];
+        for (size_t i = 0; i < values->size(); ++i) {
+            (*out_values)[i] = strdup_safe((*values)[i]);
+        }
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        quiver_set_last_error("Out of memory");
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
 QUIVER_C_API char* quiver_element_to_string(quiver_element_t* element) {
     if (!element) {
         return nullptr;
@@ -0,0 +1,97 @@
+#include "c_api_internal.h"
+#include "quiver/c/filter.h"
+
+#include <new>
+#include <string>
+#include <utility>
+
+namespace {
+
+bool to_filter_op(quiver_filter_op_t op, quiver::FilterOp& out) {
+    if (op < QUIVER_FILTER_EQUAL || op > QUIVER_FILTER_IS_NOT_NULL) {
+        quiver_set_last_error("Unknown filter operator");
+        return false;
+    }
+    out = static_cast<quiver::FilterOp>(op);
+    return true;
+}
+
+quiver_error_t
+add_predicate(quiver_filter_t* filter, const char* attribute, quiver_filter_op_t op, quiver::Value value) {
+    quiver::FilterOp cpp_op;
+    if (!filter || !attribute || !to_filter_op(op, cpp_op)) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        filter->filter.where(attribute, cpp_op, std::move(value));
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+}  // namespace
+
+extern "C" {
+
+QUIVER_C_API quiver_filter_t* quiver_filter_create(void) {
+    try {
+        return new quiver_filter();
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+QUIVER_C_API void quiver_filter_destroy(quiver_filter_t* filter) {
+    delete filter;
+}
+
+QUIVER_C_API quiver_error_t quiver_filter_id_range(quiver_filter_t* filter, int64_t from, int64_t to) {
+    if (!filter) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    filter->filter.id_range(from, to);
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_filter_id_in(quiver_filter_t* filter, const int64_t* ids, size_t count) {
+    if (!filter || (count > 0 && !ids)) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        filter->filter.id_in(std::vector<int64_t>(ids, ids + count));
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+QUIVER_C_API quiver_error_t
+quiver_filter_where_integer(quiver_filter_t* filter, const char* attribute, quiver_filter_op_t op, int64_t value) {
+    return add_predicate(filter, attribute, op, value);
+}
+
+QUIVER_C_API quiver_error_t
+quiver_filter_where_float(quiver_filter_t* filter, const char* attribute, quiver_filter_op_t op, double value) {
+    return add_predicate(filter, attribute, op, value);
+}
+
+QUIVER_C_API quiver_error_t
+quiver_filter_where_string(quiver_filter_t* filter, const char* attribute, quiver_filter_op_t op, const char* value) {
+    if (!value) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    return add_predicate(filter, attribute, op, std::string(value));
+}
+
+QUIVER_C_API quiver_error_t quiver_filter_where_null(quiver_filter_t* filter,
+                                                     const char* attribute,
+                                                     quiver_filter_op_t op) {
+    if (op != QUIVER_FILTER_IS_NULL && op != QUIVER_FILTER_IS_NOT_NULL) {
+        quiver_set_last_error("quiver_filter_where_null takes QUIVER_FILTER_IS_NULL or QUIVER_FILTER_IS_NOT_NULL");
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    return add_predicate(filter, attribute, op, nullptr);
+}
+
+}  // extern "C"
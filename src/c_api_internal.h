@@ -1,19 +1,41 @@
 #ifndef QUIVER_C_API_INTERNAL_H
 #define QUIVER_C_API_INTERNAL_H
 
+#include "quiver/c/database.h"
+#include "quiver/cursor.h"
 #include "quiver/database.h"
 #include "quiver/element.h"
 
+#include <memory>
 #include <string>
+#include <vector>
 
 // Thread-local error message storage
 void quiver_set_last_error(const std::string& message);
 void quiver_set_last_error(const char* message);
 
+// Copy a std::string into a new[]-allocated C string
+char* strdup_safe(const std::string& str);
+
+// Convert a C++ DataType to its C tag
+quiver_data_type_t to_c_data_type(quiver::DataType type);
+
+// Convert C parameter arrays (QUIVER_DATA_TYPE_* tags + value pointers) to std::vector<Value>
+std::vector<quiver::Value> convert_params(const int* param_types, const void* const* param_values, size_t param_count);
+
 // Internal structs shared between C API implementation files
 
+// Worker thread running a database's async operations (c_api_async.cpp), started by the first one.
+// The deleter cancels queued operations, interrupts the running one and joins the thread.
+struct AsyncWorker;
+struct AsyncWorkerDeleter {
+    void operator()(AsyncWorker* worker) const;
+};
+
 struct quiver_database {
     quiver::Database db;
+    // Declared after db, so the worker is stopped before the connection closes
+    std::unique_ptr<AsyncWorker, AsyncWorkerDeleter> worker;
     quiver_database(const std::string& path, const quiver::DatabaseOptions& options) : db(path, options) {}
     quiver_database(quiver::Database&& database) : db(std::move(database)) {}
 };
@@ -22,4 +44,32 @@ struct quiver_element {
     quiver::Element element;
 };
 
+struct quiver_filter {
+    quiver::Filter filter;
+};
+
+struct quiver_attribute_handle {
+    quiver::AttributeHandle handle;
+};
+
+struct quiver_cursor {
+    quiver::Cursor cursor;
+    explicit quiver_cursor(quiver::Cursor&& c) : cursor(std::move(c)) {}
+};
+
+// Library-owned read result; only the vector matching `type` is populated
+struct quiver_result {
+    quiver_data_type_t type = QUIVER_DATA_TYPE_NULL;
+    std::vector<int64_t> integers;
+    std::vector<double> floats;
+    std::vector<std::string> strings;
+    std::vector<const char*> string_ptrs;  // Points into `strings`
+    std::vector<size_t> offsets;           // Group boundaries (group count + 1 entries) for grouped reads, else empty
+};
+
+// new-allocated results that take over the values (c_api_result.cpp)
+quiver_result* make_result(std::vector<int64_t>&& values);
+quiver_result* make_result(std::vector<double>&& values);
+quiver_result* make_result(std::vector<std::string>&& values);
+
 #endif  // QUIVER_C_API_INTERNAL_H
@@ -44,6 +44,64 @@ quiver_error_t quiver_lua_runner_run(quiver_lua_runner_t* runner, const char* sc
     }
 }
 
+quiver_error_t quiver_lua_runner_compile(quiver_lua_runner_t* runner,
+                                        const char* name,
+                                        const char* script,
+                                        size_t* out_handle) {
+    if (!runner || !name || !script || !out_handle) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        runner->last_error.clear();
+        *out_handle = runner->runner.compile(name, script);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        runner->last_error = e.what();
+        return QUIVER_ERROR_DATABASE;
+    } catch (...) {
+        runner->last_error = "Unknown error";
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+quiver_error_t quiver_lua_runner_run_compiled(quiver_lua_runner_t* runner,
+                                              size_t handle,
+                                              const int* arg_types,
+                                              const void* const* arg_values,
+                                              size_t arg_count) {
+    if (!runner || (arg_count > 0 && (!arg_types || !arg_values))) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        runner->last_error.clear();
+        runner->runner.run(handle, convert_params(arg_types, arg_values, arg_count));
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        runner->last_error = e.what();
+        return QUIVER_ERROR_DATABASE;
+    } catch (...) {
+        runner->last_error = "Unknown error";
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+quiver_error_t quiver_lua_runner_release(quiver_lua_runner_t* runner, size_t handle) {
+    if (!runner) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        runner->last_error.clear();
+        runner->runner.release(handle);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        runner->last_error = e.what();
+        return QUIVER_ERROR_DATABASE;
+    } catch (...) {
+        runner->last_error = "Unknown error";
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
 const char* quiver_lua_runner_get_error(quiver_lua_runner_t* runner) {
     if (!runner || runner->last_error.empty()) {
         return nullptr;
@@ -0,0 +1,176 @@
+#include "c_api_internal.h"
+#include "quiver/c/result.h"
+
+#include <new>
+#include <string>
+
+quiver_result* make_result(std::vector<int64_t>&& values) {
+    auto* result = new quiver_result();
+    result->type = QUIVER_DATA_TYPE_INTEGER;
+    result->integers = std::move(values);
+    return result;
+}
+
+quiver_result* make_result(std::vector<double>&& values) {
+    auto* result = new quiver_result();
+    result->type = QUIVER_DATA_TYPE_FLOAT;
+    result->floats = std::move(values);
+    return result;
+}
+
+quiver_result* make_result(std::vector<std::string>&& values) {
+    auto* result = new quiver_result();
+    result->type = QUIVER_DATA_TYPE_STRING;
+    result->strings = std::move(values);
+    result->string_ptrs.reserve(result->strings.size());
+    for (const auto& str : result->strings) {
+        result->string_ptrs.push_back(str.c_str());
+    }
+    return result;
+}
+
+namespace {
+
+template <typename Read>
+quiver_error_t read_result(quiver_database_t* db,
+                           const char* collection,
+                           const char* attribute,
+                           quiver_result_t** out_result,
+                           Read read) {
+    if (!db || !collection || !attribute || !out_result) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        *out_result = make_result(read(db->db, collection, attribute));
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        *out_result = nullptr;
+        return QUIVER_ERROR_DATABASE;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        *out_result = nullptr;
+        return QUIVER_ERROR_DATABASE;
+    }
+}
+
+quiver_error_t check_result_type(quiver_result_t* result, quiver_data_type_t expected) {
+    if (result->type != expected) {
+        quiver_set_last_error("Result does not hold values of the requested type");
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    return QUIVER_OK;
+}
+
+}  // namespace
+
+extern "C" {
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_result(quiver_database_t* db,
+                                                                        const char* collection,
+                                                                        const char* attribute,
+                                                                        quiver_result_t** out_result) {
+    return read_result(db, collection, attribute, out_result, [](quiver::Database& d, const char* c, const char* a) {
+        return d.read_scalar_integers(c, a);
+    });
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_result(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      quiver_result_t** out_result) {
+    return read_result(db, collection, attribute, out_result, [](quiver::Database& d, const char* c, const char* a) {
+        return d.read_scalar_floats(c, a);
+    });
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_result(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* attribute,
+                                                                       quiver_result_t** out_result) {
+    return read_result(db, collection, attribute, out_result, [](quiver::Database& d, const char* c, const char* a) {
+        return d.read_scalar_strings(c, a);
+    });
+}
+
+QUIVER_C_API void quiver_result_free(quiver_result_t* result) {
+    delete result;
+}
+
+QUIVER_C_API quiver_error_t quiver_result_type(quiver_result_t* result, quiver_data_type_t* out_type) {
+    if (!result || !out_type) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    *out_type = result->type;
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_result_count(quiver_result_t* result, size_t* out_count) {
+    if (!result || !out_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    switch (result->type) {
+    case QUIVER_DATA_TYPE_INTEGER:
+        *out_count = result->integers.size();
+        break;
+    case QUIVER_DATA_TYPE_FLOAT:
+        *out_count = result->floats.size();
+        break;
+    case QUIVER_DATA_TYPE_STRING:
+        *out_count = result->strings.size();
+        break;
+    default:
+        *out_count = 0;
+        break;
+    }
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_result_offsets(quiver_result_t* result,
+                                                 const size_t** out_offsets,
+                                                 size_t* out_group_count) {
+    if (!result || !out_offsets || !out_group_count) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    if (result->offsets.empty()) {
+        quiver_set_last_error("Result is not grouped");
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    *out_offsets = result->offsets.data();
+    *out_group_count = result->offsets.size() - 1;
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_result_integers(quiver_result_t* result, const int64_t** out_values) {
+    if (!result || !out_values) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    if (auto err = check_result_type(result, QUIVER_DATA_TYPE_INTEGER); err != QUIVER_OK) {
+        return err;
+    }
+    *out_values = result->integers.empty() ? nullptr : result->integers.data();
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_result_floats(quiver_result_t* result, const double** out_values) {
+    if (!result || !out_values) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    if (auto err = check_result_type(result, QUIVER_DATA_TYPE_FLOAT); err != QUIVER_OK) {
+        return err;
+    }
+    *out_values = result->floats.empty() ? nullptr : result->floats.data();
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_result_strings(quiver_result_t* result, const char* const** out_values) {
+    if (!result || !out_values) {
+        return QUIVER_ERROR_INVALID_ARGUMENT;
+    }
+    if (auto err = check_result_type(result, QUIVER_DATA_TYPE_STRING); err != QUIVER_OK) {
+        return err;
+    }
+    *out_values = result->string_ptrs.empty() ? nullptr : result->string_ptrs.data();
+    return QUIVER_OK;
+}
+
+}  // extern "C"
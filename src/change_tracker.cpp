@@ -0,0 +1,190 @@
+#include "change_tracker.h"
+
+#include "quiver/schema.h"
+
+#include <sqlite3.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace quiver::change_tracker {
+
+namespace {
+
+constexpr const char* kTriggerPrefix = "quiver_changes_";
+
+std::string quote_literal(const std::string& text) {
+    std::string quoted = "'";
+    for (const auto c : text) {
+        quoted += c;
+        if (c == '\'') {
+            quoted += '\'';
+        }
+    }
+    return quoted + "'";
+}
+
+std::string quote_identifier(const std::string& name) {
+    std::string quoted = "\"";
+    for (const auto c : name) {
+        quoted += c;
+        if (c == '"') {
+            quoted += '"';
+        }
+    }
+    return quoted + "\"";
+}
+
+void exec(sqlite3* db, const std::string& sql) {
+    char* err_msg = nullptr;
+    if (sqlite3_exec(db, sql.c_str(), nullptr, nullptr, &err_msg) != SQLITE_OK) {
+        std::string error = err_msg ? err_msg : "Unknown error";
+        sqlite3_free(err_msg);
+        throw std::runtime_error("Failed to set up change tracking: " + error);
+    }
+}
+
+// The column holding the element id: id, or the foreign key to the collection (time series use <collection>_id)
+std::string element_column(const TableDefinition& table, const std::string& collection) {
+    if (table.has_column("id")) {
+        return "id";
+    }
+    for (const auto& foreign_key : table.foreign_keys) {
+        if (foreign_key.to_table == collection) {
+            return foreign_key.from_column;
+        }
+    }
+    return {};
+}
+
+// The columns a table's changes are reported under; the element and position columns (vector_index, and
+// chunk_start when the date_time BLOBs of a compressed time series make it one) only locate them
+std::vector<std::string> attribute_columns(const TableDefinition& table, const std::string& element) {
+    const auto* date_time = table.get_column("date_time");
+    const auto chunked = date_time && date_time->packed;
+    std::vector<std::string> columns;
+    for (const auto& [name, column] : table.columns) {
+        if (name != element && name != "vector_index" && !(chunked && name == "chunk_start")) {
+            columns.push_back(name);
+        }
+    }
+    return columns;
+}
+
+struct Target {
+    std::string collection;
+    std::string element;  // Column with the element id
+};
+
+std::string log_row(const Target& target, const char* row, const std::string& attribute, int kind) {
+    return "INSERT INTO quiver_changes (collection, element_id, attribute, kind) SELECT " +
+           quote_literal(target.collection) + ", " + row + "." + quote_identifier(target.element) + ", " + attribute +
+           ", " + std::to_string(kind);
+}
+
+std::string trigger(const std::string& table, const char* event, const std::string& body) {
+    return "CREATE TEMP TRIGGER " + quote_identifier(kTriggerPrefix + table + "_" + event) + " AFTER " + event +
+           " ON main." + quote_identifier(table) + " BEGIN " + body + "END;\n";
+}
+
+// One log row per attribute whose value differs between OLD and NEW
+std::string changed_columns(const Target& target, const std::vector<std::string>& columns) {
+    std::string body;
+    for (const auto& column : columns) {
+        body += log_row(target, "NEW", quote_literal(column), kUpdated) + " WHERE OLD." +
+                quote_identifier(column) + " IS NOT NEW." + quote_identifier(column) + ";";
+    }
+    return body;
+}
+
+std::string collection_triggers(const std::string& collection, const TableDefinition& table) {
+    const Target target{collection, "id"};
+    std::string sql = trigger(collection, "INSERT", log_row(target, "NEW", "NULL", kCreated) + ";");
+    sql += trigger(collection, "DELETE", log_row(target, "OLD", "NULL", kDeleted) + ";");
+    const auto columns = attribute_columns(table, target.element);
+    if (!columns.empty()) {
+        sql += trigger(collection, "UPDATE", changed_columns(target, columns));
+    }
+    return sql;
+}
+
+// Adding or removing a vector, set or time series row changes those attributes of its element
+std::string child_triggers(const std::string& collection, const TableDefinition& table) {
+    const Target target{collection, element_column(table, collection)};
+    const auto columns = attribute_columns(table, target.element);
+    if (target.element.empty() || columns.empty()) {
+        return {};
+    }
+    std::string inserted;
+    std::string deleted;
+    for (const auto& column : columns) {
+        inserted += log_row(target, "NEW", quote_literal(column), kUpdated) + ";";
+        deleted += log_row(target, "OLD", quote_literal(column), kUpdated) + ";";
+    }
+    return trigger(table.name, "INSERT", inserted) + trigger(table.name, "DELETE", deleted) +
+           trigger(table.name, "UPDATE", changed_columns(target, columns));
+}
+
+}  // namespace
+
+void create_log(sqlite3* db) {
+    // AUTOINCREMENT so tokens keep growing after the log is trimmed
+    exec(db,
+         "CREATE TEMP TABLE IF NOT EXISTS quiver_changes (seq INTEGER PRIMARY KEY AUTOINCREMENT, "
+         "collection TEXT NOT NULL, element_id INTEGER NOT NULL, attribute TEXT, kind INTEGER NOT NULL);");
+}
+
+void install(sqlite3* db, const Schema& schema) {
+    create_log(db);
+    std::string sql;
+    for (const auto& collection : schema.collection_names()) {
+        const auto* table = schema.get_table(collection);
+        sql += collection_triggers(collection, *table);
+        const auto& vectors = schema.vector_tables(collection);
+        const auto& sets = schema.set_tables(collection);
+        const auto& time_series = schema.time_series_tables(collection);
+        for (const auto* children : {&vectors, &sets, &time_series}) {
+            for (const auto& child : *children) {
+                sql += child_triggers(collection, *schema.get_table(child));
+            }
+        }
+    }
+    drop_triggers(db);
+    exec(db, "SAVEPOINT quiver_change_triggers;\n" + sql + "RELEASE quiver_change_triggers;");
+}
+
+void drop_triggers(sqlite3* db) {
+    std::vector<std::string> names;
+    sqlite3_stmt* stmt = nullptr;
+    const auto sql = std::string("SELECT name FROM sqlite_temp_master WHERE type = 'trigger' AND name LIKE '") +
+                     kTriggerPrefix + "%'";
+    if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+        throw std::runtime_error("Failed to list change triggers: " + std::string(sqlite3_errmsg(db)));
+    }
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        names.emplace_back(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0)));
+    }
+    sqlite3_finalize(stmt);
+
+    std::string drops;
+    for (const auto& name : names) {
+        drops += "DROP TRIGGER temp." + quote_identifier(name) + ";";
+    }
+    if (!drops.empty()) {
+        exec(db, drops);
+    }
+}
+
+int64_t current_token(sqlite3* db) {
+    sqlite3_stmt* stmt = nullptr;
+    int64_t token = 0;
+    // The sequence row only appears with the first logged change
+    const char* sql = "SELECT seq FROM temp.sqlite_sequence WHERE name = 'quiver_changes'";
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) == SQLITE_OK && sqlite3_step(stmt) == SQLITE_ROW) {
+        token = sqlite3_column_int64(stmt, 0);
+    }
+    sqlite3_finalize(stmt);
+    return token;
+}
+
+}  // namespace quiver::change_tracker
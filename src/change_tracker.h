@@ -0,0 +1,39 @@
+#ifndef QUIVER_CHANGE_TRACKER_H
+#define QUIVER_CHANGE_TRACKER_H
+
+#include <cstdint>
+
+struct sqlite3;
+
+namespace quiver {
+
+class Schema;
+
+// Change log for DatabaseOptions::track_changes: TEMP triggers on every collection and child table append
+// (collection, element_id, attribute, kind) rows to temp.quiver_changes, whose AUTOINCREMENT seq is the token.
+// Being TEMP, the triggers and log belong to one connection and never touch the file or its schema; being rows,
+// they roll back with the transaction that wrote them, and they cover every write path including raw SQL.
+namespace change_tracker {
+
+// kind column values, as quiver::ChangeKind
+constexpr int kCreated = 0;
+constexpr int kUpdated = 1;
+constexpr int kDeleted = 2;
+
+// Creates the (empty) log table unless it exists
+void create_log(sqlite3* db);
+
+// Creates the log table if needed and (re)creates the triggers for the tables of schema
+void install(sqlite3* db, const Schema& schema);
+
+// Drops the triggers (not the log), e.g. before migrations alter the tables they reference
+void drop_triggers(sqlite3* db);
+
+// Last token handed out (0 before the first change); unaffected by trimming the log
+int64_t current_token(sqlite3* db);
+
+}  // namespace change_tracker
+
+}  // namespace quiver
+
+#endif  // QUIVER_CHANGE_TRACKER_H
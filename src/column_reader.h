@@ -0,0 +1,373 @@
+#ifndef QUIVER_COLUMN_READER_H
+#define QUIVER_COLUMN_READER_H
+
+#include "quiver/flat_vectors.h"
+#include "quiver/id_index.h"
+#include "quiver/nullable_column.h"
+#include "quiver/string_arena.h"
+#include "quiver/time_series.h"
+#include "quiver/value.h"
+
+#include <cstdint>
+#include <optional>
+#include <sqlite3.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Typed readers that step a prepared statement and copy values straight out of
+// sqlite3_column_* into contiguous buffers, without materializing Row/Value objects.
+// A value whose storage class does not match T is treated like NULL, as Row::get_* does.
+
+namespace quiver {
+
+// One result column: a contiguous typed buffer plus a null bitmap (default value stored where null)
+template <typename T>
+struct TypedColumn {
+    std::vector<T> values;
+    std::vector<bool> nulls;
+
+    size_t size() const { return values.size(); }
+    bool is_null(size_t row) const { return nulls[row]; }
+};
+
+template <typename T>
+inline bool column_value(sqlite3_stmt* stmt, int col, T& out);
+
+template <>
+inline bool column_value<int64_t>(sqlite3_stmt* stmt, int col, int64_t& out) {
+    if (sqlite3_column_type(stmt, col) != SQLITE_INTEGER) {
+        return false;
+    }
+    out = sqlite3_column_int64(stmt, col);
+    return true;
+}
+
+template <>
+inline bool column_value<double>(sqlite3_stmt* stmt, int col, double& out) {
+    if (sqlite3_column_type(stmt, col) != SQLITE_FLOAT) {
+        return false;
+    }
+    out = sqlite3_column_double(stmt, col);
+    return true;
+}
+
+template <>
+inline bool column_value<std::string>(sqlite3_stmt* stmt, int col, std::string& out) {
+    if (sqlite3_column_type(stmt, col) != SQLITE_TEXT) {
+        return false;
+    }
+    const auto* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt, col));
+    out.assign(text ? text : "", static_cast<size_t>(sqlite3_column_bytes(stmt, col)));
+    return true;
+}
+
+template <>
+inline bool column_value<Blob>(sqlite3_stmt* stmt, int col, Blob& out) {
+    if (sqlite3_column_type(stmt, col) != SQLITE_BLOB) {
+        return false;
+    }
+    // An empty BLOB has a null pointer
+    const auto* data = static_cast<const uint8_t*>(sqlite3_column_blob(stmt, col));
+    out.assign(data, data + (data ? sqlite3_column_bytes(stmt, col) : 0));
+    return true;
+}
+
+// Converts one column of the current row to a Value
+inline Value column_as_value(sqlite3_stmt* stmt, int col) {
+    switch (sqlite3_column_type(stmt, col)) {
+    case SQLITE_INTEGER:
+        return static_cast<int64_t>(sqlite3_column_int64(stmt, col));
+    case SQLITE_FLOAT:
+        return sqlite3_column_double(stmt, col);
+    case SQLITE_TEXT: {
+        const auto* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt, col));
+        return std::string(text ? text : "", static_cast<size_t>(sqlite3_column_bytes(stmt, col)));
+    }
+    case SQLITE_NULL:
+        return nullptr;
+    case SQLITE_BLOB: {
+        Blob bytes;
+        column_value(stmt, col, bytes);
+        return bytes;
+    }
+    default:
+        throw std::runtime_error("Type not implemented");
+    }
+}
+
+inline void check_step_done(sqlite3_stmt* stmt, int rc) {
+    if (rc != SQLITE_DONE) {
+        throw std::runtime_error("Failed to execute statement: " +
+                                 std::string(sqlite3_errmsg(sqlite3_db_handle(stmt))));
+    }
+}
+
+// Reads column `col` of every row, keeping nulls in the bitmap
+template <typename T>
+TypedColumn<T> read_typed_column(sqlite3_stmt* stmt, int col = 0) {
+    TypedColumn<T> column;
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        T value{};
+        const auto present = column_value(stmt, col, value);
+        column.values.push_back(std::move(value));
+        column.nulls.push_back(!present);
+    }
+    check_step_done(stmt, rc);
+    return column;
+}
+
+// Reads column `col` of every row into values plus a packed validity bitmap
+template <typename T>
+NullableColumn<T> read_nullable_column(sqlite3_stmt* stmt, int col = 0) {
+    NullableColumn<T> column;
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        T value{};
+        const auto present = column_value(stmt, col, value);
+        column.push_back(std::move(value), present);
+    }
+    check_step_done(stmt, rc);
+    return column;
+}
+
+// Reads column `col` of every row, skipping nulls
+template <typename T>
+std::vector<T> read_non_null_column(sqlite3_stmt* stmt, int col = 0) {
+    std::vector<T> values;
+    int rc;
+    T value{};
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        if (column_value(stmt, col, value)) {
+            values.push_back(std::move(value));
+        }
+    }
+    check_step_done(stmt, rc);
+    return values;
+}
+
+// Reads column `col` of every row into out, skipping nulls; values past capacity are counted but not stored
+template <typename T>
+size_t read_non_null_column_into(sqlite3_stmt* stmt, T* out, size_t capacity, int col = 0) {
+    size_t count = 0;
+    int rc;
+    T value{};
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        if (column_value(stmt, col, value)) {
+            if (count < capacity) {
+                out[count] = std::move(value);
+            }
+            ++count;
+        }
+    }
+    check_step_done(stmt, rc);
+    return count;
+}
+
+// Reads column `col` of the first row only; nullopt if there is no row or the value is null
+template <typename T>
+std::optional<T> read_first_value(sqlite3_stmt* stmt, int col = 0) {
+    const auto rc = sqlite3_step(stmt);
+    if (rc == SQLITE_ROW) {
+        T value{};
+        if (column_value(stmt, col, value)) {
+            return value;
+        }
+        return std::nullopt;
+    }
+    check_step_done(stmt, rc);
+    return std::nullopt;
+}
+
+// Reads (id, value) rows ordered by id into one group per id; null values leave the group without that entry
+template <typename T>
+std::vector<std::vector<T>> read_grouped_column(sqlite3_stmt* stmt) {
+    std::vector<std::vector<T>> groups;
+    int64_t current_id = -1;
+    int rc;
+    int64_t id = 0;
+    T value{};
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        if (!column_value(stmt, 0, id)) {
+            continue;
+        }
+        if (id != current_id || groups.empty()) {
+            groups.emplace_back();
+            current_id = id;
+        }
+        if (column_value(stmt, 1, value)) {
+            groups.back().push_back(std::move(value));
+        }
+    }
+    check_step_done(stmt, rc);
+    return groups;
+}
+
+// Same grouping as read_grouped_column, but into one contiguous values buffer plus offsets
+template <typename T>
+FlatVectors<T> read_flat_grouped_column(sqlite3_stmt* stmt) {
+    FlatVectors<T> flat;
+    bool group_open = false;
+    int64_t current_id = 0;
+    int rc;
+    int64_t id = 0;
+    T value{};
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        if (!column_value(stmt, 0, id)) {
+            continue;
+        }
+        if (!group_open || id != current_id) {
+            if (group_open) {
+                flat.offsets.push_back(flat.values.size());
+            }
+            group_open = true;
+            current_id = id;
+        }
+        if (column_value(stmt, 1, value)) {
+            flat.values.push_back(std::move(value));
+        }
+    }
+    check_step_done(stmt, rc);
+    if (group_open) {
+        flat.offsets.push_back(flat.values.size());
+    }
+    return flat;
+}
+
+// Same rows as read_flat_grouped_column, but one group per id of index (empty when it has no rows), in index
+// order. Rows must be ordered by id; rows of ids missing from index are skipped. A merge walk, no hashing.
+template <typename T>
+FlatVectors<T> read_aligned_grouped_column(sqlite3_stmt* stmt, const IdIndex& index) {
+    FlatVectors<T> flat;
+    flat.offsets.reserve(index.size() + 1);
+    size_t open_group = 0;  // Groups before this one are complete
+    int rc;
+    int64_t id = 0;
+    T value{};
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        if (!column_value(stmt, 0, id)) {
+            continue;
+        }
+        const auto position = index.position(id);
+        if (!position) {
+            continue;
+        }
+        for (; open_group < *position; ++open_group) {
+            flat.offsets.push_back(flat.values.size());
+        }
+        if (column_value(stmt, 1, value)) {
+            flat.values.push_back(std::move(value));
+        }
+    }
+    check_step_done(stmt, rc);
+    for (; open_group < index.size(); ++open_group) {
+        flat.offsets.push_back(flat.values.size());
+    }
+    return flat;
+}
+
+// Appends TEXT values to an arena. With intern, a value equal to an earlier one shares its characters; the
+// lookup is keyed by hash, so interning allocates per distinct value only.
+class StringArenaWriter {
+public:
+    StringArenaWriter(StringArena& arena, bool intern) : arena_(arena), intern_(intern) {}
+
+    // Appends column col of the current row; false, appending nothing, when it is not TEXT
+    bool append(sqlite3_stmt* stmt, int col) {
+        if (sqlite3_column_type(stmt, col) != SQLITE_TEXT) {
+            return false;
+        }
+        const auto* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt, col));
+        append(std::string_view(text ? text : "", static_cast<size_t>(sqlite3_column_bytes(stmt, col))));
+        return true;
+    }
+
+    void append(std::string_view value) {
+        if (!intern_) {
+            arena_.push_back(value);
+            return;
+        }
+        const auto hash = std::hash<std::string_view>{}(value);
+        const auto [first, last] = seen_.equal_range(hash);
+        for (auto it = first; it != last; ++it) {
+            if (arena_[it->second] == value) {
+                arena_.push_back_shared(it->second);
+                return;
+            }
+        }
+        seen_.emplace(hash, arena_.size());
+        arena_.push_back(value);
+    }
+
+private:
+    StringArena& arena_;
+    bool intern_;
+    std::unordered_multimap<size_t, size_t> seen_;  // Hash -> index of the first value with those characters
+};
+
+// Reads column `col` of every row into an arena, skipping nulls (or storing them as empty strings with keep_nulls)
+inline StringArena read_string_arena(sqlite3_stmt* stmt, bool intern, bool keep_nulls, int col = 0) {
+    StringArena arena;
+    StringArenaWriter writer(arena, intern);
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        if (!writer.append(stmt, col) && keep_nulls) {
+            writer.append(std::string_view());
+        }
+    }
+    check_step_done(stmt, rc);
+    return arena;
+}
+
+// Same grouping as read_flat_grouped_column<std::string>, with the values in one arena
+inline FlatStrings read_flat_grouped_strings(sqlite3_stmt* stmt, bool intern) {
+    FlatStrings flat;
+    StringArenaWriter writer(flat.values, intern);
+    bool group_open = false;
+    int64_t current_id = 0;
+    int rc;
+    int64_t id = 0;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        if (!column_value(stmt, 0, id)) {
+            continue;
+        }
+        if (!group_open || id != current_id) {
+            if (group_open) {
+                flat.offsets.push_back(flat.values.size());
+            }
+            group_open = true;
+            current_id = id;
+        }
+        writer.append(stmt, 1);
+    }
+    check_step_done(stmt, rc);
+    if (group_open) {
+        flat.offsets.push_back(flat.values.size());
+    }
+    return flat;
+}
+
+// Reads (date_time, value) rows in order; a null value is stored as `missing` so both arrays stay aligned
+template <typename T>
+TimeSeries<T> read_time_series_column(sqlite3_stmt* stmt, const T& missing) {
+    TimeSeries<T> series;
+    int rc;
+    std::string date_time;
+    T value{};
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        if (!column_value(stmt, 0, date_time)) {
+            continue;
+        }
+        series.date_times.push_back(date_time);
+        series.values.push_back(column_value(stmt, 1, value) ? value : missing);
+    }
+    check_step_done(stmt, rc);
+    return series;
+}
+
+}  // namespace quiver
+
+#endif  // QUIVER_COLUMN_READER_H
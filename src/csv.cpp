@@ -0,0 +1,548 @@
+#include "csv.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+
+namespace quiver {
+
+namespace {
+
+// Initial buffer size for both directions; the reader grows its buffer for records that do not fit
+constexpr size_t kBufferSize = 1 << 20;
+
+// Bytes of records per pipeline chunk: large enough to amortize the hand-offs between threads, small enough that
+// a few per worker keep them all busy
+constexpr size_t kChunkSize = 1 << 20;
+
+// Parses the record data[begin, end) in place, end being its terminating '\n' or the end of the data, and appends
+// its fields. Returns the syntax error, or nullptr.
+const char* parse_csv_record(char* data, size_t begin, size_t end, std::vector<CsvField>& fields) {
+    if (end > begin && data[end - 1] == '\r') {
+        --end;
+    }
+
+    auto i = begin;
+    while (true) {
+        CsvField field;
+        if (i < end && data[i] == '"') {
+            // Unescape in place, writing over the opening quote; "" collapses to ", so output never overtakes input
+            field.quoted = true;
+            const auto start = i;
+            auto out = i;
+            ++i;
+            while (true) {
+                if (i >= end) {
+                    return "unterminated quoted field";
+                }
+                if (data[i] == '"') {
+                    if (i + 1 < end && data[i + 1] == '"') {
+                        data[out++] = '"';
+                        i += 2;
+                        continue;
+                    }
+                    ++i;
+                    break;
+                }
+                data[out++] = data[i++];
+            }
+            field.text = std::string_view(data + start, out - start);
+            if (i < end && data[i] != ',') {
+                return "unexpected character after closing quote";
+            }
+        } else {
+            const auto start = i;
+            while (i < end && data[i] != ',') {
+                ++i;
+            }
+            field.text = std::string_view(data + start, i - start);
+        }
+        fields.push_back(field);
+        if (i >= end) {
+            return nullptr;
+        }
+        ++i;  // Separator
+    }
+}
+
+bool is_blank_record(const std::vector<CsvField>& fields, size_t first) {
+    return fields.size() == first + 1 && fields.back().text.empty() && !fields.back().quoted;
+}
+
+std::string width_error(size_t width, size_t fields) {
+    return "expected " + std::to_string(width) + " fields, got " + std::to_string(fields);
+}
+
+// Appends field to values as the column's type; returns false if it does not parse as that type
+bool append_field(CsvColumnValues& values, const CsvField& field, DataType type) {
+    const auto is_null = field.text.empty() && !field.quoted;
+    values.nulls.push_back(is_null ? 1 : 0);
+    const auto* first = field.text.data();
+    const auto* last = first + field.text.size();
+    switch (type) {
+    case DataType::Integer: {
+        int64_t value = 0;
+        if (!is_null) {
+            const auto result = std::from_chars(first, last, value);
+            if (result.ec != std::errc() || result.ptr != last) {
+                return false;
+            }
+        }
+        values.integers.push_back(value);
+        break;
+    }
+    case DataType::Real: {
+        double value = 0;
+        if (!is_null) {
+            const auto result = std::from_chars(first, last, value);
+            if (result.ec != std::errc() || result.ptr != last) {
+                return false;
+            }
+        }
+        values.floats.push_back(value);
+        break;
+    }
+    case DataType::Text:
+    case DataType::DateTime:
+        values.texts.push_back(field.text);
+        break;
+    }
+    return true;
+}
+
+std::string line_error(const std::string& path, size_t line, const std::string& message) {
+    return "CSV file '" + path + "' line " + std::to_string(line) + ": " + message;
+}
+
+}  // namespace
+
+CsvWriter::CsvWriter(const std::string& path)
+    : path_(path), file_(std::fopen(path.c_str(), "wb")), buffer_(kBufferSize) {
+    if (!file_) {
+        throw std::runtime_error("Failed to open CSV file for writing: " + path);
+    }
+}
+
+CsvWriter::~CsvWriter() {
+    if (file_) {
+        flush();
+        std::fclose(file_);
+    }
+}
+
+void CsvWriter::write_integer(int64_t value) {
+    begin_field();
+    char digits[24];
+    const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    append(digits, static_cast<size_t>(result.ptr - digits));
+}
+
+void CsvWriter::write_float(double value) {
+    begin_field();
+    char digits[32];
+    const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    append(digits, static_cast<size_t>(result.ptr - digits));
+}
+
+void CsvWriter::write_text(std::string_view value) {
+    begin_field();
+    if (!value.empty() && value.find_first_of(",\"\r\n") == std::string_view::npos) {
+        append(value.data(), value.size());
+        return;
+    }
+    put('"');
+    size_t start = 0;
+    for (size_t i = 0; i < value.size(); ++i) {
+        if (value[i] == '"') {
+            append(value.data() + start, i - start + 1);
+            put('"');
+            start = i + 1;
+        }
+    }
+    append(value.data() + start, value.size() - start);
+    put('"');
+}
+
+void CsvWriter::write_null() {
+    begin_field();
+}
+
+void CsvWriter::end_record() {
+    put('\n');
+    record_started_ = false;
+}
+
+void CsvWriter::close() {
+    flush();
+    const auto rc = std::fclose(file_);
+    file_ = nullptr;
+    if (failed_ || rc != 0) {
+        throw std::runtime_error("Failed to write CSV file: " + path_);
+    }
+}
+
+void CsvWriter::begin_field() {
+    if (record_started_) {
+        put(',');
+    }
+    record_started_ = true;
+}
+
+void CsvWriter::put(char c) {
+    if (used_ == buffer_.size()) {
+        flush();
+    }
+    buffer_[used_++] = c;
+}
+
+void CsvWriter::append(const char* data, size_t size) {
+    if (size > buffer_.size() - used_) {
+        flush();
+        if (size > buffer_.size()) {
+            failed_ = failed_ || std::fwrite(data, 1, size, file_) != size;
+            return;
+        }
+    }
+    std::memcpy(buffer_.data() + used_, data, size);
+    used_ += size;
+}
+
+void CsvWriter::flush() {
+    if (used_ > 0) {
+        failed_ = failed_ || std::fwrite(buffer_.data(), 1, used_, file_) != used_;
+        used_ = 0;
+    }
+}
+
+CsvReader::CsvReader(const std::string& path)
+    : path_(path), file_(std::fopen(path.c_str(), "rb")), buffer_(kBufferSize) {
+    if (!file_) {
+        throw std::runtime_error("Failed to open CSV file: " + path);
+    }
+    try {
+        fill();
+    } catch (...) {
+        std::fclose(file_);
+        throw;
+    }
+    if (end_ >= 3 && std::memcmp(buffer_.data(), "\xEF\xBB\xBF", 3) == 0) {
+        pos_ = 3;
+    }
+}
+
+CsvReader::~CsvReader() {
+    std::fclose(file_);
+}
+
+size_t CsvReader::read_records(std::vector<CsvField>& fields, size_t width, size_t max_records) {
+    fields.clear();
+    // The views handed out by the previous call are released, so the unparsed tail can move to the front
+    compact();
+
+    size_t records = 0;
+    while (records < max_records) {
+        const auto end = find_record_end();
+        if (end == std::string::npos) {
+            if (eof_) {
+                break;
+            }
+            if (end_ == buffer_.size()) {
+                // Growing moves the buffer, which would invalidate the records already parsed
+                if (records > 0) {
+                    break;
+                }
+                buffer_.resize(buffer_.size() * 2);
+            }
+            fill();
+            continue;
+        }
+
+        const auto first = fields.size();
+        const auto line = line_;
+        parse_record(end, fields);
+        if (is_blank_record(fields, first)) {
+            fields.pop_back();
+            continue;
+        }
+        if (width != 0 && fields.size() - first != width) {
+            throw std::runtime_error(line_error(path_, line, width_error(width, fields.size() - first)));
+        }
+        ++records;
+    }
+    return records;
+}
+
+size_t CsvReader::find_record_end() const {
+    const char* data = buffer_.data();
+    auto in_quotes = false;
+    for (size_t i = pos_; i < end_; ++i) {
+        if (data[i] == '"') {
+            in_quotes = !in_quotes;
+        } else if (data[i] == '\n' && !in_quotes) {
+            return i;
+        }
+    }
+    if (eof_ && pos_ < end_) {
+        return end_;
+    }
+    return std::string::npos;
+}
+
+bool CsvReader::read_chunk(std::string& chunk, size_t& first_line, size_t target_size) {
+    compact();
+    if (buffer_.size() < 2 * target_size) {
+        buffer_.resize(2 * target_size);
+    }
+
+    // Scan for the last record boundary (a newline outside quotes) at or past target_size, reading more as needed
+    auto scanned = pos_;
+    auto in_quotes = false;
+    auto boundary = std::string::npos;  // One past the newline ending the chunk
+    size_t newlines = 0;
+    size_t chunk_newlines = 0;
+    while (true) {
+        const char* data = buffer_.data();
+        for (; scanned < end_; ++scanned) {
+            if (data[scanned] == '"') {
+                in_quotes = !in_quotes;
+            } else if (data[scanned] == '\n') {
+                ++newlines;
+                if (!in_quotes) {
+                    boundary = scanned + 1;
+                    chunk_newlines = newlines;
+                    if (boundary - pos_ >= target_size) {
+                        break;
+                    }
+                }
+            }
+        }
+        if (boundary != std::string::npos && boundary - pos_ >= target_size) {
+            break;
+        }
+        if (eof_) {
+            // The last record may lack its newline; an unterminated quote is left for the parser to report
+            if (end_ > pos_) {
+                boundary = end_;
+                chunk_newlines = newlines;
+            }
+            break;
+        }
+        if (end_ == buffer_.size()) {
+            if (boundary != std::string::npos) {
+                break;
+            }
+            buffer_.resize(buffer_.size() * 2);  // One record longer than the buffer
+        }
+        fill();
+    }
+    if (boundary == std::string::npos) {
+        return false;
+    }
+
+    chunk.assign(buffer_.data() + pos_, boundary - pos_);
+    first_line = line_;
+    line_ += chunk_newlines;
+    pos_ = boundary;
+    return true;
+}
+
+void CsvReader::parse_record(size_t end, std::vector<CsvField>& fields) {
+    char* data = buffer_.data();
+    // Counted before unescaping rewrites the record
+    const auto newlines = static_cast<size_t>(std::count(data + pos_, data + end, '\n'));
+    if (const auto* error = parse_csv_record(data, pos_, end, fields)) {
+        fail(error);
+    }
+    line_ += newlines + 1;
+    pos_ = end < end_ ? end + 1 : end;
+}
+
+void CsvReader::compact() {
+    if (pos_ > 0) {
+        std::memmove(buffer_.data(), buffer_.data() + pos_, end_ - pos_);
+        end_ -= pos_;
+        pos_ = 0;
+    }
+}
+
+void CsvReader::fill() {
+    const auto requested = buffer_.size() - end_;
+    const auto read = std::fread(buffer_.data() + end_, 1, requested, file_);
+    end_ += read;
+    if (read < requested) {
+        if (std::ferror(file_)) {
+            throw std::runtime_error("Failed to read CSV file: " + path_);
+        }
+        eof_ = true;
+    }
+}
+
+void CsvReader::fail(const std::string& message) const {
+    throw std::runtime_error(line_error(path_, line_, message));
+}
+
+CsvParsePipeline::CsvParsePipeline(CsvReader& reader, std::vector<CsvColumn> columns, size_t workers)
+    : reader_(reader), columns_(std::move(columns)), max_in_flight_(2 * workers) {
+    if (workers == 0) {
+        return;
+    }
+    try {
+        threads_.emplace_back(&CsvParsePipeline::read_loop, this);
+        for (size_t i = 0; i < workers; ++i) {
+            threads_.emplace_back(&CsvParsePipeline::work_loop, this);
+        }
+    } catch (...) {
+        stop();
+        throw;
+    }
+}
+
+CsvParsePipeline::~CsvParsePipeline() {
+    stop();
+}
+
+std::unique_ptr<ParsedCsvChunk> CsvParsePipeline::next() {
+    if (threads_.empty()) {
+        std::string text;
+        size_t first_line = 0;
+        if (!reader_.read_chunk(text, first_line, kChunkSize)) {
+            return nullptr;
+        }
+        return parse(std::move(text), first_line);
+    }
+
+    std::future<std::unique_ptr<ParsedCsvChunk>> result;
+    {
+        std::unique_lock lock(mutex_);
+        result_ready_.wait(lock, [this] { return !results_.empty() || reading_done_; });
+        if (results_.empty()) {
+            return nullptr;
+        }
+        result = std::move(results_.front());
+        results_.pop_front();
+    }
+    slot_free_.notify_one();
+    return result.get();
+}
+
+void CsvParsePipeline::read_loop() {
+    try {
+        while (true) {
+            {
+                std::unique_lock lock(mutex_);
+                slot_free_.wait(lock, [this] { return stopping_ || results_.size() < max_in_flight_; });
+                if (stopping_) {
+                    break;
+                }
+            }
+            Task task;
+            if (!reader_.read_chunk(task.text, task.first_line, kChunkSize)) {
+                break;
+            }
+            std::lock_guard lock(mutex_);
+            results_.push_back(task.result.get_future());
+            tasks_.push_back(std::move(task));
+            task_ready_.notify_one();
+            result_ready_.notify_one();
+        }
+    } catch (...) {
+        // A read error takes the place of the chunk that failed, after every chunk before it
+        std::promise<std::unique_ptr<ParsedCsvChunk>> failed;
+        failed.set_exception(std::current_exception());
+        std::lock_guard lock(mutex_);
+        results_.push_back(failed.get_future());
+    }
+    std::lock_guard lock(mutex_);
+    reading_done_ = true;
+    task_ready_.notify_all();
+    result_ready_.notify_all();
+}
+
+void CsvParsePipeline::work_loop() {
+    while (true) {
+        Task task;
+        {
+            std::unique_lock lock(mutex_);
+            task_ready_.wait(lock, [this] { return stopping_ || !tasks_.empty() || reading_done_; });
+            if (stopping_ || tasks_.empty()) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        try {
+            task.result.set_value(parse(std::move(task.text), task.first_line));
+        } catch (...) {
+            task.result.set_exception(std::current_exception());
+        }
+    }
+}
+
+void CsvParsePipeline::stop() {
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    task_ready_.notify_all();
+    result_ready_.notify_all();
+    slot_free_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+    threads_.clear();
+}
+
+std::unique_ptr<ParsedCsvChunk> CsvParsePipeline::parse(std::string text, size_t first_line) const {
+    auto chunk = std::make_unique<ParsedCsvChunk>();
+    chunk->text = std::move(text);  // Moved before parsing, so the views below point into the chunk's own text
+    chunk->columns.resize(columns_.size());
+    char* data = chunk->text.data();
+    const auto size = chunk->text.size();
+    const auto width = columns_.size();
+
+    std::vector<CsvField> fields;
+    auto line = first_line;
+    size_t begin = 0;
+    while (begin < size) {
+        auto end = begin;
+        auto in_quotes = false;
+        size_t newlines = 0;
+        for (; end < size; ++end) {
+            if (data[end] == '"') {
+                in_quotes = !in_quotes;
+            } else if (data[end] == '\n') {
+                if (!in_quotes) {
+                    break;
+                }
+                ++newlines;
+            }
+        }
+        const auto record_line = line;
+        line += newlines + 1;
+
+        fields.clear();
+        if (const auto* error = parse_csv_record(data, begin, end, fields)) {
+            throw std::runtime_error(line_error(reader_.path(), record_line, error));
+        }
+        begin = end + 1;
+        if (is_blank_record(fields, 0)) {
+            continue;
+        }
+        if (fields.size() != width) {
+            throw std::runtime_error(line_error(reader_.path(), record_line, width_error(width, fields.size())));
+        }
+        for (size_t c = 0; c < width; ++c) {
+            if (!append_field(chunk->columns[c], fields[c], columns_[c].type)) {
+                const auto message = "invalid " + std::string(data_type_to_string(columns_[c].type)) + " value '" +
+                                     std::string(fields[c].text) + "' for column '" + columns_[c].name + "'";
+                throw std::runtime_error(line_error(reader_.path(), record_line, message));
+            }
+        }
+        ++chunk->rows;
+    }
+    return chunk;
+}
+
+}  // namespace quiver
@@ -0,0 +1,173 @@
+#ifndef QUIVER_CSV_H
+#define QUIVER_CSV_H
+
+#include "quiver/data_type.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Streaming CSV (RFC 4180) writer and reader behind Database::export_to_csv / import_from_csv, and the
+// parallel parsing pipeline import_from_csv feeds its inserts from. None of them holds the whole file in memory.
+
+namespace quiver {
+
+// Buffered record writer; numbers are formatted with std::to_chars (shortest round-trip form for doubles).
+// Text is quoted only when needed; an empty string is written as "" so it reads back apart from NULL.
+class CsvWriter {
+public:
+    // Throws std::runtime_error if path cannot be opened for writing
+    explicit CsvWriter(const std::string& path);
+    ~CsvWriter();
+
+    CsvWriter(const CsvWriter&) = delete;
+    CsvWriter& operator=(const CsvWriter&) = delete;
+
+    void write_integer(int64_t value);
+    void write_float(double value);
+    void write_text(std::string_view value);
+    void write_null();
+    void end_record();
+
+    // Flushes and closes the file; throws std::runtime_error if any write failed
+    void close();
+
+private:
+    void begin_field();
+    void put(char c);
+    void append(const char* data, size_t size);
+    void flush();
+
+    std::string path_;
+    std::FILE* file_;
+    std::vector<char> buffer_;
+    size_t used_ = 0;
+    bool record_started_ = false;
+    bool failed_ = false;
+};
+
+// One parsed field. An unquoted empty field is NULL; a quoted one ("") is an empty string.
+struct CsvField {
+    std::string_view text;
+    bool quoted = false;
+};
+
+// Chunked record reader. Records are parsed in place (quoted fields are unescaped inside the buffer),
+// so fields point into the reader's buffer instead of owning their text. Blank lines are skipped and
+// a leading UTF-8 byte order mark is ignored.
+class CsvReader {
+public:
+    // Throws std::runtime_error if path cannot be opened
+    explicit CsvReader(const std::string& path);
+    ~CsvReader();
+
+    CsvReader(const CsvReader&) = delete;
+    CsvReader& operator=(const CsvReader&) = delete;
+
+    // Replaces fields with the fields of up to max_records records, record after record, and returns how many
+    // were read (0 at end of file). Every record must have `width` fields; 0 accepts any width, for a header.
+    // The views stay valid until the next call. Throws std::runtime_error on malformed input.
+    size_t read_records(std::vector<CsvField>& fields, size_t width, size_t max_records);
+
+    // Replaces chunk with the unparsed bytes of whole records that follow, about target_size of them (more when a
+    // single record is longer), and returns false at end of file. first_line is set to the line the chunk starts
+    // on. A newline inside a quoted field never ends a chunk.
+    bool read_chunk(std::string& chunk, size_t& first_line, size_t target_size);
+
+    const std::string& path() const { return path_; }
+
+private:
+    // End of the record starting at pos_ (its terminating '\n', or end_ at end of file), or npos if incomplete
+    size_t find_record_end() const;
+    void parse_record(size_t end, std::vector<CsvField>& fields);
+    void compact();
+    void fill();
+    [[noreturn]] void fail(const std::string& message) const;
+
+    std::string path_;
+    std::FILE* file_;
+    std::vector<char> buffer_;
+    size_t pos_ = 0;  // Start of the first unparsed record
+    size_t end_ = 0;  // End of the valid bytes in buffer_
+    bool eof_ = false;
+    size_t line_ = 1;  // Line where the record at pos_ starts
+};
+
+// Target column of an import; fields are converted to its schema type
+struct CsvColumn {
+    std::string name;
+    DataType type;
+};
+
+// Values of one column of a parsed chunk, in record order. Only the vector matching the column type is filled,
+// with a placeholder where the field is NULL.
+struct CsvColumnValues {
+    std::vector<int64_t> integers;
+    std::vector<double> floats;
+    std::vector<std::string_view> texts;  // Point into the owning ParsedCsvChunk's text
+    std::vector<uint8_t> nulls;
+};
+
+// A chunk of records converted to column-typed values; owns the (unescaped) text its string views point into
+struct ParsedCsvChunk {
+    std::string text;
+    size_t rows = 0;
+    std::vector<CsvColumnValues> columns;
+};
+
+// Splits the rest of a CsvReader's file into chunks on a reader thread, parses and type-converts them on a pool
+// of workers, and hands them back in file order. next() is called from a single consumer, which stays the only
+// thread touching the database. At most a bounded number of chunks are in flight, so memory stays flat however
+// far the workers get ahead of the consumer. With no workers, next() reads and parses on the calling thread.
+// Destroying the pipeline stops and joins all of its threads.
+class CsvParsePipeline {
+public:
+    CsvParsePipeline(CsvReader& reader, std::vector<CsvColumn> columns, size_t workers);
+    ~CsvParsePipeline();
+
+    CsvParsePipeline(const CsvParsePipeline&) = delete;
+    CsvParsePipeline& operator=(const CsvParsePipeline&) = delete;
+
+    // The next chunk in file order, or nullptr after the last one. Rethrows read and parse errors
+    // (std::runtime_error) in the order they occur in the file.
+    std::unique_ptr<ParsedCsvChunk> next();
+
+private:
+    struct Task {
+        std::string text;
+        size_t first_line = 0;
+        std::promise<std::unique_ptr<ParsedCsvChunk>> result;
+    };
+
+    void read_loop();
+    void work_loop();
+    void stop();
+    std::unique_ptr<ParsedCsvChunk> parse(std::string text, size_t first_line) const;
+
+    CsvReader& reader_;
+    std::vector<CsvColumn> columns_;
+    size_t max_in_flight_;
+
+    std::mutex mutex_;
+    std::condition_variable task_ready_;
+    std::condition_variable result_ready_;
+    std::condition_variable slot_free_;
+    std::deque<Task> tasks_;
+    std::deque<std::future<std::unique_ptr<ParsedCsvChunk>>> results_;  // One per chunk read, in file order
+    bool reading_done_ = false;
+    bool stopping_ = false;
+
+    std::vector<std::thread> threads_;
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_CSV_H
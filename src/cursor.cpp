@@ -0,0 +1,141 @@
+#include "quiver/cursor.h"
+
+#include "column_reader.h"
+
+#include <sqlite3.h>
+#include <stdexcept>
+
+namespace quiver {
+
+struct Cursor::Impl {
+    sqlite3_stmt* stmt = nullptr;
+    std::vector<std::string> columns;
+    bool has_row = false;
+    bool done = false;
+
+    ~Impl() {
+        if (stmt) {
+            sqlite3_finalize(stmt);
+        }
+    }
+
+    void require_row(size_t column) const {
+        if (!has_row) {
+            throw std::runtime_error("Cursor is not positioned on a row");
+        }
+        if (column >= columns.size()) {
+            throw std::runtime_error("Column index out of range: " + std::to_string(column));
+        }
+    }
+};
+
+Cursor::Cursor(sqlite3_stmt* stmt) : impl_(std::make_unique<Impl>()) {
+    impl_->stmt = stmt;
+    const auto col_count = sqlite3_column_count(stmt);
+    impl_->columns.reserve(col_count);
+    for (int i = 0; i < col_count; ++i) {
+        const char* name = sqlite3_column_name(stmt, i);
+        impl_->columns.emplace_back(name ? name : "");
+    }
+}
+
+Cursor::~Cursor() = default;
+
+Cursor::Cursor(Cursor&& other) noexcept = default;
+Cursor& Cursor::operator=(Cursor&& other) noexcept = default;
+
+const std::vector<std::string>& Cursor::columns() const {
+    return impl_->columns;
+}
+
+size_t Cursor::column_count() const {
+    return impl_->columns.size();
+}
+
+bool Cursor::next() {
+    if (impl_->done) {
+        return false;
+    }
+    const auto rc = sqlite3_step(impl_->stmt);
+    if (rc == SQLITE_ROW) {
+        impl_->has_row = true;
+        return true;
+    }
+    impl_->has_row = false;
+    impl_->done = true;
+    check_step_done(impl_->stmt, rc);
+    return false;
+}
+
+bool Cursor::done() const {
+    return impl_->done;
+}
+
+Value Cursor::value(size_t column) const {
+    impl_->require_row(column);
+    return column_as_value(impl_->stmt, static_cast<int>(column));
+}
+
+bool Cursor::is_null(size_t column) const {
+    impl_->require_row(column);
+    return sqlite3_column_type(impl_->stmt, static_cast<int>(column)) == SQLITE_NULL;
+}
+
+std::optional<int64_t> Cursor::get_integer(size_t column) const {
+    impl_->require_row(column);
+    int64_t value = 0;
+    if (column_value(impl_->stmt, static_cast<int>(column), value)) {
+        return value;
+    }
+    return std::nullopt;
+}
+
+std::optional<double> Cursor::get_float(size_t column) const {
+    impl_->require_row(column);
+    double value = 0.0;
+    if (column_value(impl_->stmt, static_cast<int>(column), value)) {
+        return value;
+    }
+    return std::nullopt;
+}
+
+std::optional<std::string> Cursor::get_string(size_t column) const {
+    impl_->require_row(column);
+    std::string value;
+    if (column_value(impl_->stmt, static_cast<int>(column), value)) {
+        return value;
+    }
+    return std::nullopt;
+}
+
+std::optional<Blob> Cursor::get_blob(size_t column) const {
+    impl_->require_row(column);
+    Blob value;
+    if (column_value(impl_->stmt, static_cast<int>(column), value)) {
+        return value;
+    }
+    return std::nullopt;
+}
+
+Row Cursor::row() const {
+    if (!impl_->has_row) {
+        throw std::runtime_error("Cursor is not positioned on a row");
+    }
+    std::vector<Value> values;
+    values.reserve(impl_->columns.size());
+    for (size_t i = 0; i < impl_->columns.size(); ++i) {
+        values.push_back(column_as_value(impl_->stmt, static_cast<int>(i)));
+    }
+    return Row(std::move(values));
+}
+
+std::vector<Row> Cursor::fetch(size_t max_rows) {
+    std::vector<Row> rows;
+    rows.reserve(max_rows);
+    while (rows.size() < max_rows && next()) {
+        rows.push_back(row());
+    }
+    return rows;
+}
+
+}  // namespace quiver
@@ -5,74 +5,328 @@
 #include "quiver/schema.h"
 #include "quiver/schema_validator.h"
 #include "quiver/type_validator.h"
-
+#include "arrow_ipc.h"
+#include "attribute_cache.h"
+#include "change_tracker.h"
+#include "column_reader.h"
+#include "csv.h"
+#include "label_cache.h"
+#include "packed_vector.h"
+#include "schema_cache.h"
+#include "statement_cache.h"
+#include "stats_collector.h"
+#include "time_series_codec.h"
+
+#include <algorithm>
 #include <atomic>
+#include <bit>
+#include <cmath>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <mutex>
+#include <optional>
+#include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 #include <sqlite3.h>
+#include <set>
 #include <sstream>
 #include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace {
 
 std::atomic<uint64_t> g_logger_counter{0};
 std::once_flag sqlite3_init_flag;
 
-// Type-specific Row value extractors for template implementations
-inline std::optional<int64_t> get_row_value(const quiver::Row& row, size_t index, int64_t*) {
-    return row.get_integer(index);
+// Messages queued for the async logging thread before callers block
+constexpr size_t kAsyncLogQueueSize = 8192;
+
+// Maximum rows per multi-row INSERT statement (also bounded by SQLITE_LIMIT_VARIABLE_NUMBER)
+constexpr size_t kMaxInsertChunkRows = 500;
+
+// First line of a statement that is not blank or a comment, shortened for log output
+std::string statement_summary(std::string_view sql) {
+    constexpr size_t kMaxLength = 80;
+    while (!sql.empty()) {
+        const auto start = sql.find_first_not_of(" \t\r\n");
+        if (start == std::string_view::npos) {
+            return {};
+        }
+        sql.remove_prefix(start);
+        const auto line = sql.substr(0, sql.find('\n'));
+        if (!line.starts_with("--")) {
+            return line.size() > kMaxLength ? std::string(line.substr(0, kMaxLength)) + "..." : std::string(line);
+        }
+        sql.remove_prefix(line.size());
+    }
+    return {};
 }
 
-inline std::optional<double> get_row_value(const quiver::Row& row, size_t index, double*) {
-    return row.get_float(index);
+// Wait before retrying a backup step while the source or target is locked
+constexpr int kBackupRetryMs = 10;
+
+// VM instructions between progress handler calls: frequent enough for millisecond deadlines, cheap otherwise
+constexpr int kProgressInterval = 1000;
+
+void bind_value(sqlite3_stmt* stmt, int idx, int64_t value) {
+    sqlite3_bind_int64(stmt, idx, value);
 }
 
-inline std::optional<std::string> get_row_value(const quiver::Row& row, size_t index, std::string*) {
-    return row.get_string(index);
+void bind_value(sqlite3_stmt* stmt, int idx, double value) {
+    sqlite3_bind_double(stmt, idx, value);
 }
 
-// Template for reading grouped values (vectors or sets) for all elements
-template <typename T>
-std::vector<std::vector<T>> read_grouped_values_all(const quiver::Result& result) {
-    std::vector<std::vector<T>> groups;
-    int64_t current_id = -1;
+void bind_value(sqlite3_stmt* stmt, int idx, const std::string& value) {
+    sqlite3_bind_text(stmt, idx, value.c_str(), static_cast<int>(value.size()), SQLITE_TRANSIENT);
+}
 
-    for (size_t i = 0; i < result.row_count(); ++i) {
-        auto id = result[i].get_integer(0);
-        auto val = get_row_value(result[i], 1, static_cast<T*>(nullptr));
+// An empty BLOB is bound as a zero-length BLOB: a null data pointer would bind NULL
+void bind_value(sqlite3_stmt* stmt, int idx, const quiver::Blob& value) {
+    if (value.empty()) {
+        sqlite3_bind_zeroblob(stmt, idx, 0);
+        return;
+    }
+    sqlite3_bind_blob64(stmt, idx, value.data(), value.size(), SQLITE_TRANSIENT);
+}
 
-        if (!id)
-            continue;
+void bind_value(sqlite3_stmt* stmt, int idx, const quiver::Value& value) {
+    std::visit(
+        [&](auto&& arg) {
+            using T = std::decay_t<decltype(arg)>;
+            if constexpr (std::is_same_v<T, std::nullptr_t>) {
+                sqlite3_bind_null(stmt, idx);
+            } else {
+                bind_value(stmt, idx, arg);
+            }
+        },
+        value);
+}
 
-        if (*id != current_id) {
-            groups.emplace_back();
-            current_id = *id;
+// Parse workers for import_from_csv: the reader and the inserting thread each take a core of their own. On a single
+// core the threads would only take turns, so the import parses inline instead.
+size_t csv_parse_workers() {
+    const auto cores = static_cast<size_t>(std::thread::hardware_concurrency());
+    if (cores <= 1) {
+        return 0;
+    }
+    return std::clamp<size_t>(cores - 2, 1, 16);
+}
+
+// Binds one parsed CSV value as its column's schema type. Text is bound without a copy, so the chunk must outlive
+// the step.
+void bind_csv_value(sqlite3_stmt* stmt,
+                    int idx,
+                    const quiver::CsvColumnValues& values,
+                    quiver::DataType type,
+                    size_t row) {
+    if (values.nulls[row]) {
+        sqlite3_bind_null(stmt, idx);
+        return;
+    }
+    switch (type) {
+    case quiver::DataType::Integer:
+        sqlite3_bind_int64(stmt, idx, values.integers[row]);
+        break;
+    case quiver::DataType::Real:
+        sqlite3_bind_double(stmt, idx, values.floats[row]);
+        break;
+    case quiver::DataType::Text:
+    case quiver::DataType::DateTime:
+        sqlite3_bind_text(
+            stmt, idx, values.texts[row].data(), static_cast<int>(values.texts[row].size()), SQLITE_STATIC);
+        break;
+    }
+}
+
+// BLOB columns (packed vectors, compressed time series chunks) go through CSV as lowercase hex, as SQLite's hex()
+// writes them
+std::string blob_to_hex(const uint8_t* data, size_t size) {
+    static constexpr char kDigits[] = "0123456789abcdef";
+    std::string hex(size * 2, '0');
+    for (size_t i = 0; i < size; ++i) {
+        hex[2 * i] = kDigits[data[i] >> 4];
+        hex[2 * i + 1] = kDigits[data[i] & 0x0f];
+    }
+    return hex;
+}
+
+quiver::Blob hex_to_blob(std::string_view hex) {
+    const auto digit = [&](char c) -> uint8_t {
+        if (c >= '0' && c <= '9') {
+            return static_cast<uint8_t>(c - '0');
+        }
+        if (c >= 'a' && c <= 'f') {
+            return static_cast<uint8_t>(c - 'a' + 10);
         }
+        if (c >= 'A' && c <= 'F') {
+            return static_cast<uint8_t>(c - 'A' + 10);
+        }
+        throw std::runtime_error("Invalid hex BLOB in CSV: '" + std::string(hex) + "'");
+    };
+    if (hex.size() % 2 != 0) {
+        throw std::runtime_error("Invalid hex BLOB in CSV: '" + std::string(hex) + "'");
+    }
+    quiver::Blob blob(hex.size() / 2);
+    for (size_t i = 0; i < blob.size(); ++i) {
+        blob[i] = static_cast<uint8_t>(digit(hex[2 * i]) << 4 | digit(hex[2 * i + 1]));
+    }
+    return blob;
+}
 
-        if (val) {
-            groups.back().push_back(*val);
+// Record batch limits for export_collection: rows per batch, and string bytes per batch, which keeps every Utf8
+// column under its 2 GiB offset limit
+constexpr size_t kArrowBatchRows = 65536;
+constexpr size_t kArrowBatchTextBytes = size_t{1} << 30;
+
+// Appends column `col` of the current row to column as its type; a placeholder is stored where it is null.
+// A binary column takes BLOB bytes into strings. Returns the bytes of text appended.
+size_t append_scalar_value(sqlite3_stmt* stmt, int col, quiver::ScalarColumn& column, bool binary) {
+    bool present = false;
+    size_t text_bytes = 0;
+    if (binary) {
+        auto& bytes = column.strings.emplace_back();
+        present = sqlite3_column_type(stmt, col) == SQLITE_BLOB;
+        if (present) {
+            const auto* data = static_cast<const char*>(sqlite3_column_blob(stmt, col));
+            bytes.assign(data ? data : "", static_cast<size_t>(sqlite3_column_bytes(stmt, col)));
         }
+        column.nulls.push_back(present ? 0 : 1);
+        return bytes.size();
+    }
+    switch (column.type) {
+    case quiver::DataType::Integer:
+        present = quiver::column_value(stmt, col, column.integers.emplace_back());
+        break;
+    case quiver::DataType::Real:
+        present = quiver::column_value(stmt, col, column.floats.emplace_back());
+        break;
+    case quiver::DataType::Text:
+    case quiver::DataType::DateTime:
+        present = quiver::column_value(stmt, col, column.strings.emplace_back());
+        text_bytes = column.strings.back().size();
+        break;
+    }
+    column.nulls.push_back(present ? 0 : 1);
+    return text_bytes;
+}
+
+// Binds row `row` of column as its type, or the strings as BLOBs when binary. Text is bound without a copy, so
+// column must outlive the step.
+void bind_scalar_value(sqlite3_stmt* stmt, int idx, const quiver::ScalarColumn& column, size_t row, bool binary) {
+    if (column.is_null(row)) {
+        sqlite3_bind_null(stmt, idx);
+        return;
+    }
+    if (binary) {
+        const auto& bytes = column.strings[row];
+        sqlite3_bind_blob64(stmt, idx, bytes.data(), bytes.size(), SQLITE_STATIC);
+        return;
+    }
+    switch (column.type) {
+    case quiver::DataType::Integer:
+        sqlite3_bind_int64(stmt, idx, column.integers[row]);
+        break;
+    case quiver::DataType::Real:
+        sqlite3_bind_double(stmt, idx, column.floats[row]);
+        break;
+    case quiver::DataType::Text:
+    case quiver::DataType::DateTime: {
+        const auto& text = column.strings[row];
+        sqlite3_bind_text(stmt, idx, text.data(), static_cast<int>(text.size()), SQLITE_STATIC);
+        break;
+    }
+    }
+}
+
+// Throws unless handle was resolved to the structure and type a handle overload reads or writes.
+// Text calls also accept DATE_TIME columns, which are stored as text.
+void check_handle(const quiver::AttributeHandle& handle, quiver::DataStructure structure, quiver::DataType type) {
+    const bool date_time_as_text = type == quiver::DataType::Text && handle.data_type() == quiver::DataType::DateTime;
+    const bool type_matches = handle.data_type() == type || date_time_as_text;
+    if (handle.data_structure() != structure || !type_matches) {
+        const auto describe = [](quiver::DataStructure s, quiver::DataType t) {
+            return std::string(s == quiver::DataStructure::Scalar ? "scalar " : "vector ") +
+                   quiver::data_type_to_string(t);
+        };
+        throw std::runtime_error("Attribute handle '" + handle.collection() + "." + handle.attribute() + "' is a " +
+                                 describe(handle.data_structure(), handle.data_type()) + ", not a " +
+                                 describe(structure, type));
     }
-    return groups;
 }
 
-// Template for reading grouped values (vectors or sets) for a single element by ID
+// Operation name of the *_integers/_floats/_strings function a typed accessor backs, so stats stay per name
 template <typename T>
-std::vector<T> read_grouped_values_by_id(const quiver::Result& result) {
-    std::vector<T> values;
-    values.reserve(result.row_count());
-    for (size_t i = 0; i < result.row_count(); ++i) {
-        auto val = get_row_value(result[i], 0, static_cast<T*>(nullptr));
-        if (val) {
-            values.push_back(*val);
+constexpr const char* typed_operation(const char* integer_name, const char* float_name, const char* string_name) {
+    if constexpr (std::is_same_v<T, int64_t>) {
+        return integer_name;
+    } else if constexpr (std::is_same_v<T, double>) {
+        return float_name;
+    } else {
+        return string_name;
+    }
+}
+
+void bind_params(sqlite3_stmt* stmt, const std::vector<quiver::Value>& params) {
+    for (size_t i = 0; i < params.size(); ++i) {
+        bind_value(stmt, static_cast<int>(i + 1), params[i]);
+    }
+}
+
+const char* journal_mode_name(quiver::JournalMode mode) {
+    switch (mode) {
+    case quiver::JournalMode::rollback:
+        return "delete";
+    case quiver::JournalMode::truncate:
+        return "truncate";
+    case quiver::JournalMode::wal:
+        return "wal";
+    case quiver::JournalMode::memory:
+        return "memory";
+    case quiver::JournalMode::off:
+        return "off";
+    }
+    return "delete";
+}
+
+// URI for sqlite3_open_v2 with SQLITE_OPEN_URI; immutable=1 skips locking and change detection
+std::string immutable_file_uri(const std::string& path) {
+    std::string uri = "file:";
+    auto absolute = std::filesystem::absolute(path).generic_string();
+    if (!absolute.empty() && absolute.front() != '/') {
+        uri += '/';  // Windows drive letter
+    }
+    for (const auto c : absolute) {
+        if (c == '%' || c == '?' || c == '#') {
+            constexpr char hex[] = "0123456789ABCDEF";
+            uri += '%';
+            uri += hex[(static_cast<unsigned char>(c) >> 4) & 0xF];
+            uri += hex[static_cast<unsigned char>(c) & 0xF];
+        } else {
+            uri += c;
         }
     }
-    return values;
+    return uri + "?immutable=1";
+}
+
+const char* synchronous_name(quiver::SynchronousMode mode) {
+    switch (mode) {
+    case quiver::SynchronousMode::off:
+        return "OFF";
+    case quiver::SynchronousMode::normal:
+        return "NORMAL";
+    case quiver::SynchronousMode::full:
+        return "FULL";
+    case quiver::SynchronousMode::extra:
+        return "EXTRA";
+    }
+    return "FULL";
 }
 
 void ensure_sqlite3_initialized() {
@@ -96,7 +350,25 @@ spdlog::level::level_enum to_spdlog_level(quiver::LogLevel level) {
     }
 }
 
-std::shared_ptr<spdlog::logger> create_database_logger(const std::string& db_path, quiver::LogLevel console_level) {
+// One background thread and bounded queue shared by every async database logger; it lives while any Database
+// holding it is open and drains its queue before joining
+std::shared_ptr<spdlog::details::thread_pool> shared_logging_thread_pool() {
+    static std::mutex mutex;
+    static std::weak_ptr<spdlog::details::thread_pool> shared;
+    std::lock_guard lock(mutex);
+    auto pool = shared.lock();
+    if (!pool) {
+        pool = std::make_shared<spdlog::details::thread_pool>(kAsyncLogQueueSize, 1);
+        shared = pool;
+    }
+    return pool;
+}
+
+// A null thread_pool makes a synchronous logger
+std::shared_ptr<spdlog::logger>
+create_database_logger(const std::string& db_path,
+                       const quiver::DatabaseOptions& options,
+                       const std::shared_ptr<spdlog::details::thread_pool>& thread_pool) {
     namespace fs = std::filesystem;
 
     // Generate unique logger name for multiple Database instances
@@ -105,15 +377,13 @@ std::shared_ptr<spdlog::logger> create_database_logger(const std::string& db_pat
 
     // Create console sink (thread-safe)
     auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
-    console_sink->set_level(to_spdlog_level(console_level));
+    console_sink->set_level(to_spdlog_level(options.console_level));
+    std::vector<spdlog::sink_ptr> sinks{console_sink};
 
+    std::string warning;
     if (db_path == ":memory:") {
-        // In-memory database: no file logging
-        const auto logger = std::make_shared<spdlog::logger>(logger_name, console_sink);
-        logger->set_level(spdlog::level::debug);
-        logger->warn("Database is in-memory only; no file logging will be performed.");
-        return logger;
-    } else {
+        warning = "Database is in-memory only; no file logging will be performed.";
+    } else if (options.file_level != quiver::LogLevel::off) {
         // File-based database: use database directory
         auto db_dir = fs::path(db_path).parent_path();
         if (db_dir.empty()) {
@@ -121,26 +391,95 @@ std::shared_ptr<spdlog::logger> create_database_logger(const std::string& db_pat
             db_dir = fs::current_path();
         }
 
-        // Create file sink (thread-safe)
-        std::shared_ptr<spdlog::sinks::basic_file_sink_mt> file_sink = nullptr;
+        // Create file sink (thread-safe); if that fails, continue with console-only logging
         try {
             const auto log_file_path = (db_dir / "quiver_database.log").string();
-            file_sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(log_file_path, true);
-            file_sink->set_level(spdlog::level::debug);
+            auto file_sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(log_file_path, true);
+            file_sink->set_level(to_spdlog_level(options.file_level));
+            sinks.push_back(file_sink);
+        } catch (const spdlog::spdlog_ex& ex) {
+            warning = std::string("Failed to create file sink: ") + ex.what() + ". Logging to console only.";
+        }
+    }
 
-            std::vector<spdlog::sink_ptr> sinks{console_sink, file_sink};
-            auto logger = std::make_shared<spdlog::logger>(logger_name, sinks.begin(), sinks.end());
-            logger->set_level(spdlog::level::debug);
+    std::shared_ptr<spdlog::logger> logger;
+    if (thread_pool) {
+        logger = std::make_shared<spdlog::async_logger>(
+            logger_name, sinks.begin(), sinks.end(), thread_pool, spdlog::async_overflow_policy::block);
+    } else {
+        logger = std::make_shared<spdlog::logger>(logger_name, sinks.begin(), sinks.end());
+    }
 
-            return logger;
-        } catch (const spdlog::spdlog_ex& ex) {
-            // If file sink creation fails, continue with console-only logging
-            const auto logger = std::make_shared<spdlog::logger>(logger_name, console_sink);
-            logger->set_level(spdlog::level::debug);
-            logger->warn("Failed to create file sink: {}. Logging to console only.", ex.what());
-            return logger;
+    // The logger level is the most verbose sink level, so calls below it return before formatting anything
+    auto level = spdlog::level::off;
+    for (const auto& sink : sinks) {
+        level = std::min(level, sink->level());
+    }
+    logger->set_level(level);
+
+    if (!warning.empty()) {
+        logger->warn(warning);
+    }
+    return logger;
+}
+
+// SQL after the column name for op; false when it takes no value
+bool filter_operator(quiver::FilterOp op, std::string& sql) {
+    switch (op) {
+    case quiver::FilterOp::equal:
+        sql = " = ?";
+        return true;
+    case quiver::FilterOp::not_equal:
+        sql = " <> ?";
+        return true;
+    case quiver::FilterOp::less:
+        sql = " < ?";
+        return true;
+    case quiver::FilterOp::less_equal:
+        sql = " <= ?";
+        return true;
+    case quiver::FilterOp::greater:
+        sql = " > ?";
+        return true;
+    case quiver::FilterOp::greater_equal:
+        sql = " >= ?";
+        return true;
+    case quiver::FilterOp::is_null:
+        sql = " IS NULL";
+        return false;
+    case quiver::FilterOp::is_not_null:
+        sql = " IS NOT NULL";
+        return false;
+    }
+    throw std::runtime_error("Unknown filter operator");
+}
+
+// Aggregate columns of the statistics over column, e.g. ", TOTAL(value), AVG(value)"
+std::string aggregate_columns(const std::vector<quiver::Aggregate>& statistics, const std::string& column) {
+    if (statistics.empty()) {
+        throw std::runtime_error("Cannot aggregate: no statistics requested");
+    }
+    std::string sql;
+    for (auto statistic : statistics) {
+        switch (statistic) {
+        case quiver::Aggregate::sum:
+            sql += ", TOTAL(" + column + ")";  // 0.0 rather than NULL for empty groups
+            break;
+        case quiver::Aggregate::mean:
+            sql += ", AVG(" + column + ")";
+            break;
+        case quiver::Aggregate::min:
+            sql += ", MIN(" + column + ")";
+            break;
+        case quiver::Aggregate::max:
+            sql += ", MAX(" + column + ")";
+            break;
+        case quiver::Aggregate::count:
+            sql += ", COUNT(" + column + ")";
+            break;
         }
     }
+    return sql;
 }
 
 }  // anonymous namespace
@@ -150,9 +489,60 @@ namespace quiver {
 struct Database::Impl {
     sqlite3* db = nullptr;
     std::string path;
+    std::shared_ptr<spdlog::details::thread_pool> log_thread_pool;  // Only for async logging; outlives logger
     std::shared_ptr<spdlog::logger> logger;
-    std::unique_ptr<Schema> schema;
-    std::unique_ptr<TypeValidator> type_validator;
+    // Shared with sibling connections and the SchemaCache; never mutated, only replaced on reload
+    std::shared_ptr<const Schema> schema;
+    std::shared_ptr<const TypeValidator> type_validator;
+    std::unique_ptr<StatementCache> statements;
+    LabelCache labels;
+    std::unique_ptr<AttributeCache> read_cache;  // Only when DatabaseOptions::cache_reads is set
+    int64_t hooked_changes = 0;                  // Rows the update hook has reported, see check_read_cache
+    int64_t seen_changes = 0;                    // sqlite3_total_changes64 at the last check
+    int64_t seen_data_version = -1;
+    int64_t seen_schema_version = -1;
+    bool validate_schema = true;
+    DatabaseOptions open_options;  // As passed to open, for connections cloned from this one
+    bool track_changes = false;    // DatabaseOptions::track_changes on a writable connection
+    std::unique_ptr<StatsCollector> stats;  // Only when DatabaseOptions::collect_stats is set
+    std::optional<int64_t> slow_query_ns;   // DatabaseOptions::slow_query_threshold
+    const char* current_operation = nullptr;  // Outermost public method running, for trace output
+    std::optional<std::chrono::steady_clock::duration> statement_timeout;
+    std::chrono::steady_clock::time_point deadline;  // Of the outermost operation, when statement_timeout is set
+    std::function<bool()> progress_handler;
+
+    // Scope guard timing one public operation; the outermost one also starts the statement_timeout clock
+    OperationTimer time_operation(const char* name) {
+        if (!current_operation && statement_timeout) {
+            deadline = std::chrono::steady_clock::now() + *statement_timeout;
+        }
+        return OperationTimer(stats.get(), name, current_operation);
+    }
+
+    // SQLite keeps one progress handler per connection, so the deadline and the user's handler share it
+    void install_progress_handler() {
+        if (statement_timeout || progress_handler) {
+            sqlite3_progress_handler(db, kProgressInterval, &Impl::on_progress, this);
+        } else {
+            sqlite3_progress_handler(db, 0, nullptr, nullptr);
+        }
+    }
+
+    static int on_progress(void* context) {
+        auto* impl = static_cast<Impl*>(context);
+        // Outside a public operation (a Cursor being stepped) no deadline is running
+        if (impl->statement_timeout && impl->current_operation && std::chrono::steady_clock::now() >= impl->deadline) {
+            return 1;
+        }
+        return impl->progress_handler && !impl->progress_handler() ? 1 : 0;
+    }
+
+    // Leases a cached statement for sql with params bound
+    StatementCache::Handle prepare(const std::string& sql, const std::vector<Value>& params = {}) {
+        auto handle = statements->acquire(sql);
+        bind_params(handle.get(), params);
+        return handle;
+    }
 
     void require_schema(const char* operation) const {
         if (!schema) {
@@ -167,197 +557,1987 @@ struct Database::Impl {
         }
     }
 
-    void load_schema_metadata() {
-        schema = std::make_unique<Schema>(Schema::from_database(db));
-        SchemaValidator validator(*schema);
-        validator.validate();
-        type_validator = std::make_unique<TypeValidator>(*schema);
-    }
+    // Runs prefix + "(?, ...)" + suffix over distinct keys in chunks, calling on_row for each result row.
+    // Chunk sizes are powers of two (at most kMaxInsertChunkRows) and a short chunk repeats its first key,
+    // so a handful of cached statements serve every batch size.
+    template <typename Key, typename RowFn>
+    void select_in_chunks(const std::string& prefix,
+                          const std::string& suffix,
+                          const std::vector<Key>& keys,
+                          RowFn&& on_row) {
+        if (keys.empty()) {
+            return;
+        }
+        const auto max_variables = static_cast<size_t>(sqlite3_limit(db, SQLITE_LIMIT_VARIABLE_NUMBER, -1));
+        const auto chunk = std::min({kMaxInsertChunkRows, max_variables, std::bit_ceil(keys.size())});
+        auto sql = prefix + "(";
+        for (size_t i = 0; i < chunk; ++i) {
+            sql += i == 0 ? "?" : ", ?";
+        }
+        sql += ")" + suffix;
 
-    ~Impl() {
-        if (db) {
-            logger->debug("Closing database: {}", path);
-            sqlite3_close_v2(db);
-            db = nullptr;
-            logger->info("Database closed");
+        auto handle = statements->acquire(sql);
+        auto* stmt = handle.get();
+        for (size_t begin = 0; begin < keys.size(); begin += chunk) {
+            for (size_t i = 0; i < chunk; ++i) {
+                bind_value(stmt, static_cast<int>(i + 1), keys[begin + i < keys.size() ? begin + i : begin]);
+            }
+            int rc;
+            while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+                on_row(stmt);
+            }
+            check_step_done(stmt, rc);
+            sqlite3_reset(stmt);
         }
     }
 
-    void begin_transaction() {
-        char* err_msg = nullptr;
-        const auto rc = sqlite3_exec(db, "BEGIN TRANSACTION;", nullptr, nullptr, &err_msg);
-        if (rc != SQLITE_OK) {
-            std::string error = err_msg ? err_msg : "Unknown error";
-            sqlite3_free(err_msg);
-            throw std::runtime_error("Failed to begin transaction: " + error);
+    // Distinct ids, in first-seen order
+    static std::vector<int64_t> distinct_ids(std::span<const int64_t> ids) {
+        std::unordered_set<int64_t> seen;
+        std::vector<int64_t> distinct;
+        for (auto id : ids) {
+            if (seen.insert(id).second) {
+                distinct.push_back(id);
+            }
         }
-        logger->debug("Transaction started");
+        return distinct;
     }
 
-    void commit() {
-        char* err_msg = nullptr;
-        const auto rc = sqlite3_exec(db, "COMMIT;", nullptr, nullptr, &err_msg);
-        if (rc != SQLITE_OK) {
-            std::string error = err_msg ? err_msg : "Unknown error";
-            sqlite3_free(err_msg);
-            throw std::runtime_error("Failed to commit transaction: " + error);
+    // WHERE clause selecting the rows of collection that match filter (empty when it matches all), with its values
+    // appended to params. The id list is bound as one JSON array, so any number of ids shares one statement.
+    std::string filter_clause(const std::string& collection, const Filter& filter, std::vector<Value>& params) const {
+        require_collection(collection, "filter");
+        const auto* table = schema->get_table(collection);
+        std::vector<std::string> terms;
+        if (filter.min_id) {
+            terms.emplace_back("id >= ?");
+            params.emplace_back(*filter.min_id);
+        }
+        if (filter.max_id) {
+            terms.emplace_back("id <= ?");
+            params.emplace_back(*filter.max_id);
+        }
+        if (filter.ids) {
+            std::string list = "[";
+            for (auto id : *filter.ids) {
+                list += (list.size() > 1 ? "," : "") + std::to_string(id);
+            }
+            terms.emplace_back("id IN (SELECT value FROM json_each(?))");
+            params.emplace_back(list + "]");
+        }
+        for (const auto& predicate : filter.predicates) {
+            if (!table->has_column(predicate.attribute)) {
+                throw std::runtime_error("Cannot filter on '" + predicate.attribute +
+                                         "': not a scalar attribute of collection '" + collection + "'");
+            }
+            std::string op;
+            if (filter_operator(predicate.op, op)) {
+                if (std::holds_alternative<std::nullptr_t>(predicate.value)) {
+                    throw std::runtime_error("Cannot filter on '" + predicate.attribute +
+                                             "': comparison with null (use is_null or is_not_null)");
+                }
+                params.push_back(predicate.value);
+            }
+            terms.push_back(predicate.attribute + op);
         }
-        logger->debug("Transaction committed");
-    }
 
-    void rollback() {
-        char* err_msg = nullptr;
-        const auto rc = sqlite3_exec(db, "ROLLBACK;", nullptr, nullptr, &err_msg);
-        if (rc != SQLITE_OK) {
-            std::string error = err_msg ? err_msg : "Unknown error";
-            sqlite3_free(err_msg);
-            logger->error("Failed to rollback transaction: {}", error);
-            // Don't throw - rollback is often called in error recovery
-        } else {
-            logger->debug("Transaction rolled back");
+        std::string clause;
+        for (const auto& term : terms) {
+            clause += (clause.empty() ? " WHERE " : " AND ") + term;
         }
+        return clause;
     }
 
-    class TransactionGuard {
-        Impl& impl_;
-        bool committed_ = false;
-
-    public:
-        explicit TransactionGuard(Impl& impl) : impl_(impl) { impl_.begin_transaction(); }
-
-        void commit() {
-            impl_.commit();
-            committed_ = true;
+    // Prepares "SELECT columns FROM table" over the rows of the elements of collection matching filter: those of
+    // collection itself, or of one of its vector/set tables (keyed by id)
+    StatementCache::Handle prepare_filtered(const std::string& columns,
+                                            const std::string& table,
+                                            const std::string& collection,
+                                            const Filter& filter,
+                                            const std::string& order_by) {
+        std::vector<Value> params;
+        auto clause = filter_clause(collection, filter, params);
+        if (!clause.empty() && table != collection) {
+            clause = " WHERE id IN (SELECT id FROM " + collection + clause + ")";
         }
+        return prepare("SELECT " + columns + " FROM " + table + clause + " ORDER BY " + order_by, params);
+    }
 
-        ~TransactionGuard() {
-            if (!committed_) {
-                impl_.rollback();
+    // Runs an aggregation whose rows are the element id, the bucket (when bucketed) and then one value per statistic
+    Aggregates read_aggregates(const std::string& sql, const std::vector<Aggregate>& statistics, bool bucketed) {
+        Aggregates result;
+        result.statistics = statistics;
+        result.columns.resize(statistics.size());
+        const int first = bucketed ? 2 : 1;
+        auto stmt = prepare(sql);
+        int rc;
+        while ((rc = sqlite3_step(stmt.get())) == SQLITE_ROW) {
+            result.ids.push_back(sqlite3_column_int64(stmt.get(), 0));
+            if (bucketed) {
+                result.buckets.emplace_back(reinterpret_cast<const char*>(sqlite3_column_text(stmt.get(), 1)));
+            }
+            for (size_t s = 0; s < statistics.size(); ++s) {
+                const auto col = first + static_cast<int>(s);
+                result.columns[s].push_back(sqlite3_column_type(stmt.get(), col) == SQLITE_NULL
+                                                ? std::numeric_limits<double>::quiet_NaN()
+                                                : sqlite3_column_double(stmt.get(), col));
             }
         }
+        check_step_done(stmt.get(), rc);
+        return result;
+    }
 
-        TransactionGuard(const TransactionGuard&) = delete;
-        TransactionGuard& operator=(const TransactionGuard&) = delete;
-    };
-};
-
-Database::Database(const std::string& path, const DatabaseOptions& options) : impl_(std::make_unique<Impl>()) {
-    impl_->path = path;
-    impl_->logger = create_database_logger(path, options.console_level);
+    // One value per requested id, in input order; unknown ids and null values are invalid
+    template <typename T>
+    NullableColumn<T>
+    read_scalar_by_ids(const std::string& collection, const std::string& attribute, std::span<const int64_t> ids) {
+        std::unordered_map<int64_t, T> found;
+        select_in_chunks("SELECT id, " + attribute + " FROM " + collection + " WHERE id IN ",
+                         "",
+                         distinct_ids(ids),
+                         [&](sqlite3_stmt* stmt) {
+                             int64_t id = 0;
+                             T value{};
+                             if (column_value(stmt, 0, id) && column_value(stmt, 1, value)) {
+                                 found.emplace(id, std::move(value));
+                             }
+                         });
+
+        NullableColumn<T> column;
+        column.values.reserve(ids.size());
+        for (auto id : ids) {
+            auto it = found.find(id);
+            column.push_back(it != found.end() ? it->second : T{}, it != found.end());
+        }
+        return column;
+    }
 
-    impl_->logger->debug("Opening database: {}", path);
+    // One group per requested id, in input order; ids without rows get an empty group.
+    // order_by sorts the rows of a group (e.g. ", vector_index").
+    template <typename T>
+    FlatVectors<T> read_groups_by_ids(const std::string& table,
+                                      const std::string& attribute,
+                                      std::span<const int64_t> ids,
+                                      const std::string& order_by) {
+        std::unordered_map<int64_t, std::vector<T>> groups;
+        select_in_chunks("SELECT id, " + attribute + " FROM " + table + " WHERE id IN ",
+                         " ORDER BY id" + order_by,
+                         distinct_ids(ids),
+                         [&](sqlite3_stmt* stmt) {
+                             int64_t id = 0;
+                             T value{};
+                             if (column_value(stmt, 0, id) && column_value(stmt, 1, value)) {
+                                 groups[id].push_back(std::move(value));
+                             }
+                         });
+
+        FlatVectors<T> flat;
+        flat.offsets.reserve(ids.size() + 1);
+        for (auto id : ids) {
+            auto it = groups.find(id);
+            if (it != groups.end()) {
+                flat.values.insert(flat.values.end(), it->second.begin(), it->second.end());
+            }
+            flat.offsets.push_back(flat.values.size());
+        }
+        return flat;
+    }
 
-    ensure_sqlite3_initialized();
+    // Elements of collection in input order (throws for unknown ids): one chunked SELECT for the scalars, then one
+    // per vector and set table, which fills every array column of that table. ids are bound, not interpolated.
+    std::vector<Element> read_elements(const std::string& collection, std::span<const int64_t> ids) {
+        require_collection(collection, "read elements");
+        const auto keys = distinct_ids(ids);
+        std::unordered_map<int64_t, Element> found;
+
+        std::vector<std::string> scalars;
+        std::string sql = "SELECT id";
+        for (const auto& [name, column] : schema->get_table(collection)->columns) {
+            if (name != "id") {
+                scalars.push_back(name);
+                sql += ", " + name;
+            }
+        }
+        select_in_chunks(sql + " FROM " + collection + " WHERE id IN ", "", keys, [&](sqlite3_stmt* stmt) {
+            auto& element = found[sqlite3_column_int64(stmt, 0)];
+            for (size_t c = 0; c < scalars.size(); ++c) {
+                const auto index = static_cast<int>(c + 1);
+                switch (sqlite3_column_type(stmt, index)) {
+                case SQLITE_INTEGER:
+                    element.set(scalars[c], static_cast<int64_t>(sqlite3_column_int64(stmt, index)));
+                    break;
+                case SQLITE_FLOAT:
+                    element.set(scalars[c], sqlite3_column_double(stmt, index));
+                    break;
+                case SQLITE_TEXT: {
+                    const auto* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt, index));
+                    element.set(scalars[c], std::string(text, sqlite3_column_bytes(stmt, index)));
+                    break;
+                }
+                default:
+                    element.set_null(scalars[c]);
+                    break;
+                }
+            }
+        });
+        for (auto id : keys) {
+            if (!found.contains(id)) {
+                throw std::runtime_error("Element " + std::to_string(id) + " not found in collection '" + collection +
+                                         "'");
+            }
+        }
 
-    auto flags = options.read_only ? SQLITE_OPEN_READONLY : (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
-    const auto rc = sqlite3_open_v2(path.c_str(), &impl_->db, flags, nullptr);
+        for (const auto& table : schema->vector_tables(collection)) {
+            read_element_arrays(*schema->get_table(table), " ORDER BY id, vector_index", keys, found);
+        }
+        for (const auto& table : schema->set_tables(collection)) {
+            read_element_arrays(*schema->get_table(table), " ORDER BY id", keys, found);
+        }
 
-    if (rc != SQLITE_OK) {
-        std::string error_msg = impl_->db ? sqlite3_errmsg(impl_->db) : "Unknown error";
-        impl_->logger->error("Failed to open database: {}", error_msg);
-        if (impl_->db) {
-            sqlite3_close(impl_->db);
-            impl_->db = nullptr;
+        std::vector<Element> elements;
+        elements.reserve(ids.size());
+        for (auto id : ids) {
+            elements.push_back(found.at(id));
         }
-        throw std::runtime_error("Failed to open database: " + error_msg);
+        return elements;
     }
 
-    // Enable foreign keys
-    sqlite3_exec(impl_->db, "PRAGMA foreign_keys = ON;", nullptr, nullptr, nullptr);
-    impl_->logger->debug("Database opened successfully, foreign keys enabled");
-
-    impl_->logger->info("Database opened successfully: {}", path);
-}
+    // Adds the value columns of one vector or set table to the elements; nulls are skipped, as in the array readers
+    void read_element_arrays(const TableDefinition& table,
+                             const std::string& order_by,
+                             const std::vector<int64_t>& keys,
+                             std::unordered_map<int64_t, Element>& elements) {
+        std::vector<std::pair<std::string, DataType>> columns;
+        for (const auto& [name, column] : table.columns) {
+            if (name != "id" && name != "vector_index") {
+                columns.emplace_back(name, column.type);
+            }
+        }
+        if (!schema->is_packed_vector_table(table.name)) {
+            read_element_columns(table.name, columns, order_by, keys, elements);
+            return;
+        }
+        // Each packed column is unpacked by its own subquery
+        for (const auto& column : columns) {
+            read_element_columns(vector_source(table.name, column.first), {column}, order_by, keys, elements);
+        }
+    }
 
-Database::~Database() = default;
+    void read_element_columns(const std::string& source,
+                              const std::vector<std::pair<std::string, DataType>>& columns,
+                              const std::string& order_by,
+                              const std::vector<int64_t>& keys,
+                              std::unordered_map<int64_t, Element>& elements) {
+        std::string sql = "SELECT id";
+        for (const auto& column : columns) {
+            sql += ", " + column.first;
+        }
+        std::unordered_map<int64_t, std::vector<ArrayValues>> arrays;
+        select_in_chunks(sql + " FROM " + source + " WHERE id IN ", order_by, keys, [&](sqlite3_stmt* stmt) {
+            auto [it, inserted] = arrays.try_emplace(sqlite3_column_int64(stmt, 0));
+            if (inserted) {
+                for (const auto& [name, type] : columns) {
+                    if (type == DataType::Integer) {
+                        it->second.emplace_back(std::vector<int64_t>{});
+                    } else if (type == DataType::Real) {
+                        it->second.emplace_back(std::vector<double>{});
+                    } else {
+                        it->second.emplace_back(std::vector<std::string>{});
+                    }
+                }
+            }
+            for (size_t c = 0; c < columns.size(); ++c) {
+                std::visit(
+                    [&](auto& values) {
+                        typename std::decay_t<decltype(values)>::value_type value{};
+                        if (column_value(stmt, static_cast<int>(c + 1), value)) {
+                            values.push_back(std::move(value));
+                        }
+                    },
+                    it->second[c]);
+            }
+        });
+        for (auto& [id, values] : arrays) {
+            auto& element = elements.at(id);
+            for (size_t c = 0; c < columns.size(); ++c) {
+                std::visit(
+                    [&](auto& typed) {
+                        if (!typed.empty()) {
+                            element.set(columns[c].first, std::move(typed));
+                        }
+                    },
+                    values[c]);
+            }
+        }
+    }
 
-Database::Database(Database&& other) noexcept = default;
-Database& Database::operator=(Database&& other) noexcept = default;
+    // Resolves labels of collection to ids: cached labels first, then chunked IN (...) queries for
+    // the rest. Unknown labels resolve to nullopt.
+    std::vector<std::optional<int64_t>> resolve_labels(const std::string& collection,
+                                                       const std::vector<std::string>& label_list) {
+        std::vector<std::optional<int64_t>> ids(label_list.size());
+        std::unordered_map<std::string, std::vector<size_t>> pending;
+        for (size_t i = 0; i < label_list.size(); ++i) {
+            ids[i] = labels.find(collection, label_list[i]);
+            if (!ids[i]) {
+                pending[label_list[i]].push_back(i);
+            }
+        }
+        if (pending.empty()) {
+            return ids;
+        }
 
-bool Database::is_healthy() const {
-    return impl_ && impl_->db != nullptr;
-}
+        std::vector<std::string> missing;
+        missing.reserve(pending.size());
+        for (const auto& [label, positions] : pending) {
+            missing.push_back(label);
+        }
 
-Result Database::execute(const std::string& sql, const std::vector<Value>& params) {
-    sqlite3_stmt* stmt = nullptr;
-    auto rc = sqlite3_prepare_v2(impl_->db, sql.c_str(), -1, &stmt, nullptr);
-    if (rc != SQLITE_OK) {
-        throw std::runtime_error("Failed to prepare statement: " + std::string(sqlite3_errmsg(impl_->db)));
+        auto on_row = [&](sqlite3_stmt* stmt) {
+            std::string label;
+            int64_t id = 0;
+            if (!column_value(stmt, 0, label) || !column_value(stmt, 1, id)) {
+                return;
+            }
+            labels.insert(collection, label, id);
+            for (auto position : pending[label]) {
+                ids[position] = id;
+            }
+        };
+        select_in_chunks("SELECT label, id FROM " + collection + " WHERE label IN ", "", missing, on_row);
+        return ids;
     }
 
-    // Bind parameters
-    for (size_t i = 0; i < params.size(); ++i) {
-        const auto idx = static_cast<int>(i + 1);
-        const auto& param = params[i];
-
-        std::visit(
-            [&](auto&& arg) {
-                using T = std::decay_t<decltype(arg)>;
-                if constexpr (std::is_same_v<T, std::nullptr_t>) {
-                    sqlite3_bind_null(stmt, idx);
-                } else if constexpr (std::is_same_v<T, int64_t>) {
-                    sqlite3_bind_int64(stmt, idx, arg);
-                } else if constexpr (std::is_same_v<T, double>) {
-                    sqlite3_bind_double(stmt, idx, arg);
-                } else if constexpr (std::is_same_v<T, std::string>) {
-                    sqlite3_bind_text(stmt, idx, arg.c_str(), static_cast<int>(arg.size()), SQLITE_TRANSIENT);
-                }
-            },
-            param);
+    // Target collection of the foreign key attribute of collection; op names the operation in errors
+    const std::string& relation_target(const std::string& collection, const std::string& attribute, const char* op) {
+        if (!schema) {
+            throw std::runtime_error(std::string("Cannot ") + op + " relation: no schema loaded");
+        }
+        if (!schema->get_table(collection)) {
+            throw std::runtime_error("Collection not found in schema: " + collection);
+        }
+        const auto* fk = find_foreign_key(collection, attribute);
+        if (!fk) {
+            throw std::runtime_error("Attribute '" + attribute + "' is not a foreign key in collection '" + collection +
+                                     "'");
+        }
+        return fk->to_table;
     }
 
-    // Get column info
-    std::vector<std::string> columns;
-    const auto col_count = sqlite3_column_count(stmt);
-    columns.reserve(col_count);
-    for (int i = 0; i < col_count; ++i) {
-        const char* name = sqlite3_column_name(stmt, i);
-        columns.emplace_back(name ? name : "");
+    // Foreign key of table whose source column is column, or nullptr
+    const ForeignKey* find_foreign_key(const std::string& table, const std::string& column) const {
+        const auto* table_def = schema->get_table(table);
+        if (!table_def) {
+            return nullptr;
+        }
+        for (const auto& fk : table_def->foreign_keys) {
+            if (fk.from_column == column) {
+                return &fk;
+            }
+        }
+        return nullptr;
     }
 
-    // Execute and fetch results
-    std::vector<Row> rows;
-    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
-        std::vector<Value> values;
-        values.reserve(col_count);
-
-        for (int i = 0; i < col_count; ++i) {
-            auto type = sqlite3_column_type(stmt, i);
-            switch (type) {
-            case SQLITE_INTEGER:
-                values.emplace_back(sqlite3_column_int64(stmt, i));
-                break;
-            case SQLITE_FLOAT:
-                values.emplace_back(sqlite3_column_double(stmt, i));
-                break;
-            case SQLITE_TEXT: {
-                const char* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt, i));
-                values.emplace_back(std::string(text ? text : ""));
-                break;
-            }
-            case SQLITE_NULL:
-                values.emplace_back(nullptr);
-                break;
-            case SQLITE_BLOB:
-                throw std::runtime_error("Blob not implemented");
-            default:
-                throw std::runtime_error("Type not implemented");
-                break;
+    // Ids referenced by the labels of a foreign key column, in order; throws if a label does not exist
+    std::vector<int64_t> resolve_fk_labels(const ForeignKey& fk, const std::vector<std::string>& label_list) {
+        auto ids = resolve_labels(fk.to_table, label_list);
+        std::vector<int64_t> resolved;
+        resolved.reserve(ids.size());
+        for (size_t i = 0; i < ids.size(); ++i) {
+            if (!ids[i]) {
+                throw std::runtime_error("Failed to resolve label '" + label_list[i] + "' to ID in table '" +
+                                         fk.to_table + "'");
             }
+            resolved.push_back(*ids[i]);
         }
-        rows.emplace_back(std::move(values));
+        return resolved;
     }
 
-    sqlite3_finalize(stmt);
-
-    if (rc != SQLITE_DONE) {
-        throw std::runtime_error("Failed to execute statement: " + std::string(sqlite3_errmsg(impl_->db)));
+    // Array values as they are written to table.column: string labels in a foreign key column are resolved
+    // into resolved and returned from there, anything else is returned as is
+    const ArrayValues& resolve_array(const std::string& table,
+                                     const std::string& column,
+                                     const ArrayValues& values,
+                                     std::optional<ArrayValues>& resolved) {
+        const auto* labels = std::get_if<std::vector<std::string>>(&values);
+        const auto* fk = labels ? find_foreign_key(table, column) : nullptr;
+        if (!fk) {
+            return values;
+        }
+        return resolved.emplace(resolve_fk_labels(*fk, *labels));
     }
 
-    return Result(std::move(columns), std::move(rows));
-}
+    // Inserts row_count rows into table. bind_row(stmt, row, first) binds the values of `row`
+    // to parameters first .. first + columns.size() - 1.
+    // Full chunks step one cached multi-row INSERT; the remainder steps a cached single-row INSERT.
+    template <typename BindRow>
+    void insert_rows(const std::string& table,
+                     const std::vector<std::string>& columns,
+                     size_t row_count,
+                     BindRow&& bind_row) {
+        if (row_count == 0) {
+            return;
+        }
+
+        const auto width = columns.size();
+        const auto max_variables = static_cast<size_t>(sqlite3_limit(db, SQLITE_LIMIT_VARIABLE_NUMBER, -1));
+        const auto chunk_rows = std::max<size_t>(1, std::min(kMaxInsertChunkRows, max_variables / width));
+
+        auto prefix = "INSERT INTO " + table + " (";
+        std::string row_placeholders = "(";
+        for (size_t c = 0; c < width; ++c) {
+            prefix += (c == 0 ? "" : ", ") + columns[c];
+            row_placeholders += c == 0 ? "?" : ", ?";
+        }
+        prefix += ") VALUES ";
+        row_placeholders += ")";
+
+        auto step_chunks = [&](size_t rows_per_statement, size_t begin, size_t end) {
+            auto sql = prefix;
+            for (size_t r = 0; r < rows_per_statement; ++r) {
+                sql += (r == 0 ? "" : ", ") + row_placeholders;
+            }
+            auto handle = statements->acquire(sql);
+            auto* stmt = handle.get();
+            for (size_t row = begin; row < end; row += rows_per_statement) {
+                for (size_t r = 0; r < rows_per_statement; ++r) {
+                    bind_row(stmt, row + r, static_cast<int>(r * width + 1));
+                }
+                check_step_done(stmt, sqlite3_step(stmt));
+                sqlite3_reset(stmt);
+            }
+        };
+
+        const auto chunked = row_count / chunk_rows * chunk_rows;
+        if (chunked > 0) {
+            step_chunks(chunk_rows, 0, chunked);
+        }
+        if (chunked < row_count) {
+            step_chunks(1, chunked, row_count);
+        }
+    }
+
+    // The collection table followed by its vector, set and time series tables
+    std::vector<std::string> collection_tables(const std::string& collection) const {
+        std::vector<std::string> tables{collection};
+        for (const auto* group : {&schema->vector_tables(collection),
+                                  &schema->set_tables(collection),
+                                  &schema->time_series_tables(collection)}) {
+            tables.insert(tables.end(), group->begin(), group->end());
+        }
+        return tables;
+    }
+
+    // Column of a group table referencing its parent element: id by convention, else its foreign key to collection
+    std::string parent_column(const std::string& table, const std::string& collection) const {
+        const auto& foreign_keys = schema->get_table(table)->foreign_keys;
+        std::string column = "id";
+        for (const auto& fk : foreign_keys) {
+            if (fk.to_table == collection && fk.from_column == "id") {
+                return column;
+            }
+        }
+        for (const auto& fk : foreign_keys) {
+            if (fk.to_table == collection) {
+                column = fk.from_column;
+                break;
+            }
+        }
+        return column;
+    }
+
+    // Deletes the elements of collection selected by clause (a WHERE clause over the collection table, bound with
+    // params) in one transaction. Each group table is emptied of their rows by one set-based DELETE first, so the
+    // ON DELETE CASCADE of the parent DELETE has nothing left to look up row by row. Returns the elements deleted.
+    size_t delete_elements(const std::string& collection, const std::string& clause, const std::vector<Value>& params) {
+        TransactionGuard txn(*this);
+        const auto selection = " IN (SELECT id FROM " + collection + clause + ")";
+        for (const auto& table : collection_tables(collection)) {
+            if (table != collection) {
+                auto handle = prepare("DELETE FROM " + table + " WHERE " + parent_column(table, collection) +
+                                      selection, params);
+                check_step_done(handle.get(), sqlite3_step(handle.get()));
+            }
+        }
+        auto handle = prepare("DELETE FROM " + collection + clause, params);
+        check_step_done(handle.get(), sqlite3_step(handle.get()));
+        const auto deleted = static_cast<size_t>(sqlite3_changes(db));
+        txn.commit();
+        return deleted;
+    }
+
+    // Writes every row of table to an Arrow file, in record batches of at most kArrowBatchRows rows. BLOB columns
+    // (packed vectors, compressed time series chunks) are copied unchanged as Binary. Returns the number of rows
+    // written.
+    size_t export_arrow_table(const std::string& table, const std::string& path) {
+        const auto* table_def = schema->get_table(table);
+        auto handle = prepare("SELECT * FROM " + table);
+        auto* stmt = handle.get();
+
+        std::vector<ArrowField> fields;
+        std::vector<ScalarColumn> columns;
+        for (int i = 0; i < sqlite3_column_count(stmt); ++i) {
+            const auto* column = table_def->get_column(sqlite3_column_name(stmt, i));
+            const auto type = column->packed ? DataType::Text : column->type;
+            fields.push_back({column->name, type, !column->not_null && !column->primary_key, column->packed});
+            auto& batch_column = columns.emplace_back();
+            batch_column.name = column->name;
+            batch_column.type = type;
+        }
+
+        ArrowFileWriter writer(path, fields);
+        size_t rows = 0;
+        size_t batch_rows = 0;
+        size_t text_bytes = 0;
+        const auto flush = [&] {
+            writer.write_batch(columns);
+            for (auto& column : columns) {
+                column.integers.clear();
+                column.floats.clear();
+                column.strings.clear();
+                column.nulls.clear();
+            }
+            batch_rows = 0;
+            text_bytes = 0;
+        };
+        int rc;
+        while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+            for (size_t c = 0; c < columns.size(); ++c) {
+                text_bytes += append_scalar_value(stmt, static_cast<int>(c), columns[c], fields[c].binary);
+            }
+            ++rows;
+            if (++batch_rows == kArrowBatchRows || text_bytes >= kArrowBatchTextBytes) {
+                flush();
+            }
+        }
+        check_step_done(stmt, rc);
+        if (batch_rows > 0) {
+            flush();
+        }
+        writer.close();
+        return rows;
+    }
+
+    // Inserts every record batch of an Arrow file into table, matching fields to columns by name.
+    // Returns the number of rows inserted.
+    size_t import_arrow_table(const std::string& table, const std::string& path) {
+        const auto* table_def = schema->get_table(table);
+        ArrowFileReader reader(path);
+        if (reader.fields().empty()) {
+            throw std::runtime_error("Arrow file has no columns: " + path);
+        }
+        std::vector<std::string> names;
+        for (const auto& field : reader.fields()) {
+            const auto* column = table_def->get_column(field.name);
+            if (!column) {
+                throw std::runtime_error("Column '" + field.name + "' from Arrow file not found in table '" + table +
+                                         "'");
+            }
+            // Text also fills DATE_TIME columns, and integers REAL ones; BLOB columns take Binary only
+            const auto types_match = field.type == column->type ||
+                                     (field.type == DataType::Text && column->type == DataType::DateTime) ||
+                                     (field.type == DataType::Integer && column->type == DataType::Real);
+            const auto matches = column->packed ? field.binary : !field.binary && types_match;
+            if (!matches) {
+                const auto describe = [](const char* type, bool binary) { return binary ? "BINARY" : type; };
+                throw std::runtime_error(
+                    "Arrow column '" + field.name + "' of type " +
+                    describe(data_type_to_string(field.type), field.binary) + " does not match column of type " +
+                    describe(data_type_to_string(column->type), column->packed) + " in table '" + table + "'");
+            }
+            names.push_back(field.name);
+        }
+
+        std::vector<ScalarColumn> columns;
+        size_t rows = 0;
+        for (size_t b = 0; b < reader.batch_count(); ++b) {
+            const auto batch_rows = reader.read_batch(b, columns);
+            insert_rows(table, names, batch_rows, [&](sqlite3_stmt* stmt, size_t row, int first) {
+                for (size_t c = 0; c < columns.size(); ++c) {
+                    bind_scalar_value(stmt, first + static_cast<int>(c), columns[c], row, reader.fields()[c].binary);
+                }
+            });
+            rows += batch_rows;
+        }
+        return rows;
+    }
+
+    // FROM source of a vector attribute stored in table: the table, or for a packed table its unpacked rows
+    std::string vector_source(const std::string& table, const std::string& attribute) const {
+        return schema->is_packed_vector_table(table) ? packed_vector::rows(table, attribute) : table;
+    }
+
+    std::string vector_rows(const std::string& collection, const std::string& attribute) const {
+        return vector_source(schema->find_vector_table(collection, attribute), attribute);
+    }
+
+    // Packed columns hold float64s only
+    template <typename T>
+    static const std::vector<double>&
+    packed_values(const std::string& table, const std::string& attribute, const std::vector<T>& values) {
+        if constexpr (std::is_same_v<T, double>) {
+            return values;
+        } else {
+            throw std::runtime_error("Packed vector '" + table + "." + attribute + "' only holds floats");
+        }
+    }
+
+    // Stores values as the packed vector of element id (NULL when empty), inserting the element's row if missing
+    void write_packed_vector(const std::string& table,
+                             const std::string& attribute,
+                             int64_t id,
+                             const std::vector<double>& values) {
+        auto upsert = prepare("INSERT INTO " + table + " (id, " + attribute + ") VALUES (?, ?) ON CONFLICT(id) DO "
+                              "UPDATE SET " + attribute + " = excluded." + attribute);
+        auto* stmt = upsert.get();
+        sqlite3_bind_int64(stmt, 1, id);
+        const auto bytes = packed_vector::encode(values);
+        if (values.empty()) {
+            sqlite3_bind_null(stmt, 2);
+        } else {
+            sqlite3_bind_blob(stmt, 2, bytes.data(), static_cast<int>(bytes.size()), SQLITE_STATIC);
+        }
+        check_step_done(stmt, sqlite3_step(stmt));
+    }
+
+    std::vector<double> read_packed_vector(const std::string& table, const std::string& attribute, int64_t id) {
+        auto select = prepare("SELECT " + attribute + " FROM " + table + " WHERE id = ?", {id});
+        auto* stmt = select.get();
+        const auto rc = sqlite3_step(stmt);
+        if (rc != SQLITE_ROW) {
+            check_step_done(stmt, rc);
+            return {};
+        }
+        return packed_vector::decode(sqlite3_column_blob(stmt, 0), static_cast<size_t>(sqlite3_column_bytes(stmt, 0)));
+    }
+
+    // Overwrites one value in place through incremental BLOB I/O, without reading or rewriting the rest of the
+    // vector. Blob writes skip the update hook and triggers, so the read cache and change log are updated here.
+    void update_packed_entry(const std::string& collection,
+                             const std::string& table,
+                             const std::string& attribute,
+                             int64_t id,
+                             int64_t index,
+                             double value) {
+        TransactionGuard txn(*this);
+        auto length = prepare("SELECT length(" + attribute + ") FROM " + table + " WHERE id = ?", {id});
+        const auto size = read_first_value<int64_t>(length.get()).value_or(0);
+        if (index < 0 || index >= size / static_cast<int64_t>(packed_vector::kValueSize)) {
+            throw std::runtime_error("Vector index " + std::to_string(index) + " out of range for '" + collection +
+                                     "." + attribute + "' of id " + std::to_string(id));
+        }
+
+        sqlite3_blob* blob = nullptr;
+        unsigned char bytes[packed_vector::kValueSize];
+        packed_vector::encode_value(value, bytes);
+        auto rc = sqlite3_blob_open(db, "main", table.c_str(), attribute.c_str(), id, 1, &blob);
+        if (rc == SQLITE_OK) {
+            rc = sqlite3_blob_write(
+                blob, bytes, sizeof(bytes), static_cast<int>(index * static_cast<int64_t>(sizeof(bytes))));
+        }
+        if (sqlite3_blob_close(blob) != SQLITE_OK || rc != SQLITE_OK) {
+            throw std::runtime_error("Failed to update packed vector: " + std::string(sqlite3_errmsg(db)));
+        }
+
+        if (read_cache) {
+            read_cache->invalidate(table);
+        }
+        if (track_changes) {
+            auto log = prepare("INSERT INTO quiver_changes (collection, element_id, attribute, kind) "
+                               "VALUES (?, ?, ?, ?)",
+                               {collection, id, attribute, static_cast<int64_t>(change_tracker::kUpdated)});
+            check_step_done(log.get(), sqlite3_step(log.get()));
+        }
+        txn.commit();
+    }
+
+    // Inserts values[begin..] as vector entries of element id, numbered from vector_index first_index
+    template <typename T>
+    void insert_vector_rows(const std::string& table,
+                            const std::string& attribute,
+                            int64_t id,
+                            const std::vector<T>& values,
+                            size_t begin,
+                            int64_t first_index) {
+        insert_rows(table,
+                    {"id", "vector_index", attribute},
+                    values.size() - begin,
+                    [&](sqlite3_stmt* stmt, size_t row, int first) {
+                        sqlite3_bind_int64(stmt, first, id);
+                        sqlite3_bind_int64(stmt, first + 1, first_index + static_cast<int64_t>(row));
+                        bind_value(stmt, first + 2, values[begin + row]);
+                    });
+    }
+
+    // Replaces the rows of element id in a vector table with one row per value, indexed from 1
+    template <typename T>
+    void replace_vector_rows(const std::string& table,
+                             const std::string& attribute,
+                             int64_t id,
+                             const std::vector<T>& values) {
+        if (schema->is_packed_vector_table(table)) {
+            write_packed_vector(table, attribute, id, packed_values(table, attribute, values));
+            return;
+        }
+        auto handle = prepare("DELETE FROM " + table + " WHERE id = ?", {id});
+        check_step_done(handle.get(), sqlite3_step(handle.get()));
+        insert_vector_rows(table, attribute, id, values, 0, 1);
+    }
+
+    // Replaces the rows of element id in a set table with one row per value
+    template <typename T>
+    void
+    replace_set_rows(const std::string& table, const std::string& attribute, int64_t id, const std::vector<T>& values) {
+        auto handle = prepare("DELETE FROM " + table + " WHERE id = ?", {id});
+        check_step_done(handle.get(), sqlite3_step(handle.get()));
+
+        insert_rows(table, {"id", attribute}, values.size(), [&](sqlite3_stmt* stmt, size_t row, int first) {
+            sqlite3_bind_int64(stmt, first, id);
+            bind_value(stmt, first + 1, values[row]);
+        });
+    }
+
+    // Rewrites only the vector entries of element id that differ from values: changed indices are
+    // updated in place, extra stored entries deleted and new ones inserted.
+    // Falls back to replace_vector_rows when the stored vector_index is not 1..n, and always for a packed table,
+    // whose single row per element is rewritten whole.
+    template <typename T>
+    void diff_vector_rows(const std::string& table,
+                          const std::string& attribute,
+                          int64_t id,
+                          const std::vector<T>& values) {
+        if (schema->is_packed_vector_table(table)) {
+            replace_vector_rows(table, attribute, id, values);
+            return;
+        }
+        std::vector<std::optional<T>> stored;
+        auto contiguous = true;
+        {
+            auto select = prepare(
+                "SELECT vector_index, " + attribute + " FROM " + table + " WHERE id = ? ORDER BY vector_index", {id});
+            auto* stmt = select.get();
+            int rc;
+            int64_t index = 0;
+            T value{};
+            while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+                if (!column_value(stmt, 0, index) || index != static_cast<int64_t>(stored.size() + 1)) {
+                    contiguous = false;
+                    break;
+                }
+                stored.push_back(column_value(stmt, 1, value) ? std::optional<T>(value) : std::nullopt);
+            }
+            if (contiguous) {
+                check_step_done(stmt, rc);
+            }
+        }
+        if (!contiguous) {
+            replace_vector_rows(table, attribute, id, values);
+            return;
+        }
+
+        const auto common = std::min(stored.size(), values.size());
+        std::optional<StatementCache::Handle> update;
+        for (size_t i = 0; i < common; ++i) {
+            if (stored[i] && *stored[i] == values[i]) {
+                continue;
+            }
+            if (!update) {
+                update.emplace(statements->acquire("UPDATE " + table + " SET " + attribute +
+                                                   " = ? WHERE id = ? AND vector_index = ?"));
+            }
+            auto* stmt = update->get();
+            bind_value(stmt, 1, values[i]);
+            sqlite3_bind_int64(stmt, 2, id);
+            sqlite3_bind_int64(stmt, 3, static_cast<int64_t>(i + 1));
+            check_step_done(stmt, sqlite3_step(stmt));
+            sqlite3_reset(stmt);
+        }
+
+        if (stored.size() > values.size()) {
+            auto remove = prepare("DELETE FROM " + table + " WHERE id = ? AND vector_index > ?",
+                                  {id, static_cast<int64_t>(values.size())});
+            check_step_done(remove.get(), sqlite3_step(remove.get()));
+        } else if (values.size() > stored.size()) {
+            insert_vector_rows(table, attribute, id, values, stored.size(), static_cast<int64_t>(stored.size() + 1));
+        }
+    }
+
+    // Rewrites only the set entries of element id that differ from values: stored values missing
+    // from values are deleted and new ones inserted. Falls back to replace_set_rows when a stored
+    // entry is null.
+    template <typename T>
+    void
+    diff_set_rows(const std::string& table, const std::string& attribute, int64_t id, const std::vector<T>& values) {
+        std::set<T> stored;
+        auto has_null = false;
+        {
+            auto select = prepare("SELECT " + attribute + " FROM " + table + " WHERE id = ?", {id});
+            auto* stmt = select.get();
+            int rc;
+            T value{};
+            while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+                if (!column_value(stmt, 0, value)) {
+                    has_null = true;
+                    break;
+                }
+                stored.insert(value);
+            }
+            if (!has_null) {
+                check_step_done(stmt, rc);
+            }
+        }
+        if (has_null) {
+            replace_set_rows(table, attribute, id, values);
+            return;
+        }
+
+        const std::set<T> wanted(values.begin(), values.end());
+        std::optional<StatementCache::Handle> remove;
+        for (const auto& value : stored) {
+            if (wanted.count(value)) {
+                continue;
+            }
+            if (!remove) {
+                remove.emplace(statements->acquire("DELETE FROM " + table + " WHERE id = ? AND " + attribute + " = ?"));
+            }
+            auto* stmt = remove->get();
+            sqlite3_bind_int64(stmt, 1, id);
+            bind_value(stmt, 2, value);
+            check_step_done(stmt, sqlite3_step(stmt));
+            sqlite3_reset(stmt);
+        }
+
+        std::vector<T> added;
+        for (const auto& value : values) {
+            if (!stored.count(value)) {
+                added.push_back(value);
+            }
+        }
+        insert_rows(table, {"id", attribute}, added.size(), [&](sqlite3_stmt* stmt, size_t row, int first) {
+            sqlite3_bind_int64(stmt, first, id);
+            bind_value(stmt, first + 1, added[row]);
+        });
+    }
+
+    // Appends values after the last stored vector_index of element id
+    template <typename T>
+    void append_vector(const std::string& collection,
+                       const std::string& attribute,
+                       int64_t id,
+                       const std::vector<T>& values) {
+        logger->debug("Appending {} values to vector {}.{} for id {}", values.size(), collection, attribute, id);
+        require_schema("append vector");
+        auto vector_table = schema->find_vector_table(collection, attribute);
+
+        TransactionGuard txn(*this);
+        if (schema->is_packed_vector_table(vector_table)) {
+            auto packed = read_packed_vector(vector_table, attribute, id);
+            const auto& appended = packed_values(vector_table, attribute, values);
+            packed.insert(packed.end(), appended.begin(), appended.end());
+            write_packed_vector(vector_table, attribute, id, packed);
+        } else {
+            auto last = prepare("SELECT MAX(vector_index) FROM " + vector_table + " WHERE id = ?", {id});
+            const auto last_index = read_first_value<int64_t>(last.get()).value_or(0);
+            insert_vector_rows(vector_table, attribute, id, values, 0, last_index + 1);
+        }
+        txn.commit();
+
+        logger->info("Appended {} values to vector {}.{} for id {}", values.size(), collection, attribute, id);
+    }
+
+    // Updates the entry at 0-based position index of element id's vector
+    template <typename T>
+    void update_vector_entry(const std::string& collection,
+                             const std::string& attribute,
+                             int64_t id,
+                             int64_t index,
+                             const T& value) {
+        logger->debug("Updating vector {}.{} entry {} for id {}", collection, attribute, index, id);
+        require_schema("update vector entry");
+        auto vector_table = schema->find_vector_table(collection, attribute);
+        if (schema->is_packed_vector_table(vector_table)) {
+            if constexpr (std::is_same_v<T, double>) {
+                update_packed_entry(collection, vector_table, attribute, id, index, value);
+                return;
+            } else {
+                throw std::runtime_error("Packed vector '" + vector_table + "." + attribute + "' only holds floats");
+            }
+        }
+
+        auto update =
+            prepare("UPDATE " + vector_table + " SET " + attribute + " = ? WHERE id = ? AND vector_index = ?");
+        auto* stmt = update.get();
+        bind_value(stmt, 1, value);
+        sqlite3_bind_int64(stmt, 2, id);
+        sqlite3_bind_int64(stmt, 3, index + 1);
+        check_step_done(stmt, sqlite3_step(stmt));
+        if (sqlite3_changes(db) == 0) {
+            throw std::runtime_error("Vector index " + std::to_string(index) + " out of range for '" + collection +
+                                     "." + attribute + "' of id " + std::to_string(id));
+        }
+    }
+
+    // Writes values[i] to attribute of element ids[i]: one type check, one prepared statement, one transaction
+    template <typename T>
+    void update_scalar_rows(const std::string& collection,
+                            const std::string& attribute,
+                            std::span<const int64_t> ids,
+                            std::span<const T> values) {
+        logger->debug("Updating {}.{} for {} ids", collection, attribute, ids.size());
+        require_collection(collection, "update scalars");
+        if (ids.size() != values.size()) {
+            throw std::runtime_error("Failed to update scalars: got " + std::to_string(ids.size()) + " ids and " +
+                                     std::to_string(values.size()) + " values");
+        }
+        if (ids.empty()) {
+            return;
+        }
+        type_validator->validate_scalar(collection, attribute, values.front());
+
+        TransactionGuard txn(*this);
+        auto update = statements->acquire("UPDATE " + collection + " SET " + attribute + " = ? WHERE id = ?");
+        auto* stmt = update.get();
+        for (size_t i = 0; i < ids.size(); ++i) {
+            bind_value(stmt, 1, values[i]);
+            sqlite3_bind_int64(stmt, 2, ids[i]);
+            check_step_done(stmt, sqlite3_step(stmt));
+            sqlite3_reset(stmt);
+        }
+        txn.commit();
+
+        logger->info("Updated {}.{} for {} ids", collection, attribute, ids.size());
+    }
+
+    struct TimeSeriesRoute {
+        const AttributeLocation* location;
+        std::string id_column;  // Column referencing the parent element (id by convention)
+    };
+
+    // Value column of a time series group
+    TimeSeriesRoute route_time_series(const std::string& collection, const std::string& attribute) const {
+        require_schema("access time series");
+        const auto* location = schema->find_attribute(collection, attribute, AttributeKind::TimeSeries);
+        if (!location || !location->column || attribute == "date_time") {
+            throw std::runtime_error("Time series attribute '" + attribute + "' not found for collection '" +
+                                     collection + "'");
+        }
+        TimeSeriesRoute route{location, parent_column(location->table, collection)};
+        const auto chunk_key = attribute == time_series_codec::kChunkColumn &&
+                               schema->is_compressed_time_series_table(location->table);
+        if (attribute == route.id_column || chunk_key) {
+            throw std::runtime_error("Time series attribute '" + attribute + "' not found for collection '" +
+                                     collection + "'");
+        }
+        return route;
+    }
+
+    // FROM source of a time series value column: the table, or for a compressed table its decoded samples
+    std::string time_series_source(const TimeSeriesRoute& route, const std::string& attribute) const {
+        const auto& table = route.location->table;
+        return schema->is_compressed_time_series_table(table)
+                   ? time_series_codec::rows(table, route.id_column, attribute)
+                   : table;
+    }
+
+    // Decodes the chunks of element id that can hold samples in [from, to] and keeps the samples inside it. The
+    // chunk_start key bounds the scan: from the last chunk starting at or before from to the last at or before to.
+    TimeSeries<double> read_compressed_time_series(const TimeSeriesRoute& route,
+                                                   const std::string& attribute,
+                                                   int64_t id,
+                                                   const std::optional<std::string>& from,
+                                                   const std::optional<std::string>& to) {
+        const auto& table = route.location->table;
+        const auto first = from ? time_series_codec::parse_date_time(*from) : std::numeric_limits<int64_t>::min();
+        const auto last = to ? time_series_codec::parse_date_time(*to) : std::numeric_limits<int64_t>::max();
+        auto sql = "SELECT date_time, " + attribute + " FROM " + table + " WHERE " + route.id_column + " = ?";
+        std::vector<Value> params{id};
+        if (from) {
+            sql += " AND chunk_start >= COALESCE((SELECT MAX(chunk_start) FROM " + table + " WHERE " +
+                   route.id_column + " = ? AND chunk_start <= ?), chunk_start)";
+            params.insert(params.end(), {id, first});
+        }
+        if (to) {
+            sql += " AND chunk_start <= ?";
+            params.emplace_back(last);
+        }
+        auto stmt = prepare(sql + " ORDER BY chunk_start", params);
+
+        TimeSeries<double> series;
+        std::vector<int64_t> times;
+        std::vector<double> values;
+        int rc;
+        while ((rc = sqlite3_step(stmt.get())) == SQLITE_ROW) {
+            // Chunks written for another column of the group
+            if (sqlite3_column_type(stmt.get(), 1) == SQLITE_NULL) {
+                continue;
+            }
+            times.clear();
+            values.clear();
+            time_series_codec::decode_times(
+                sqlite3_column_blob(stmt.get(), 0), static_cast<size_t>(sqlite3_column_bytes(stmt.get(), 0)), times);
+            time_series_codec::decode_values(
+                sqlite3_column_blob(stmt.get(), 1), static_cast<size_t>(sqlite3_column_bytes(stmt.get(), 1)), values);
+            if (times.size() != values.size()) {
+                throw std::runtime_error("Corrupt compressed time series chunk in '" + table + "'");
+            }
+            for (size_t i = 0; i < times.size(); ++i) {
+                if (times[i] >= first && times[i] <= last) {
+                    series.date_times.push_back(time_series_codec::format_date_time(times[i]));
+                    series.values.push_back(values[i]);
+                }
+            }
+        }
+        check_step_done(stmt.get(), rc);
+        return series;
+    }
+
+    // Writes the samples of element id (whose chunks the caller deleted) sorted by timestamp, kChunkSize per row
+    void write_compressed_time_series(const TimeSeriesRoute& route,
+                                      const std::string& attribute,
+                                      int64_t id,
+                                      const std::vector<std::string>& date_times,
+                                      const std::vector<double>& values) {
+        std::vector<std::pair<int64_t, double>> samples;
+        samples.reserve(values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            samples.emplace_back(time_series_codec::parse_date_time(date_times[i]), values[i]);
+        }
+        std::stable_sort(
+            samples.begin(), samples.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        const auto duplicate = std::adjacent_find(
+            samples.begin(), samples.end(), [](const auto& a, const auto& b) { return a.first == b.first; });
+        if (duplicate != samples.end()) {
+            throw std::runtime_error("Time series '" + attribute + "' has date_time '" +
+                                     time_series_codec::format_date_time(duplicate->first) + "' more than once");
+        }
+
+        const auto chunk_size = time_series_codec::kChunkSize;
+        std::vector<int64_t> chunk_starts;
+        std::vector<std::pair<std::string, std::string>> chunks;  // Encoded (date_time, value) BLOBs
+        std::vector<int64_t> times;
+        std::vector<double> chunk_values;
+        for (size_t begin = 0; begin < samples.size(); begin += chunk_size) {
+            const auto end = std::min(samples.size(), begin + chunk_size);
+            times.clear();
+            chunk_values.clear();
+            for (auto i = begin; i < end; ++i) {
+                times.push_back(samples[i].first);
+                chunk_values.push_back(samples[i].second);
+            }
+            chunk_starts.push_back(times.front());
+            chunks.emplace_back(time_series_codec::encode_times(times), time_series_codec::encode_values(chunk_values));
+        }
+
+        const auto bind_blob = [](sqlite3_stmt* stmt, int index, const std::string& bytes) {
+            sqlite3_bind_blob(stmt, index, bytes.data(), static_cast<int>(bytes.size()), SQLITE_STATIC);
+        };
+        insert_rows(route.location->table,
+                    {route.id_column, time_series_codec::kChunkColumn, "date_time", attribute},
+                    chunks.size(),
+                    [&](sqlite3_stmt* stmt, size_t row, int first) {
+                        sqlite3_bind_int64(stmt, first, id);
+                        sqlite3_bind_int64(stmt, first + 1, chunk_starts[row]);
+                        bind_blob(stmt, first + 2, chunks[row].first);
+                        bind_blob(stmt, first + 3, chunks[row].second);
+                    });
+    }
+
+    // Drops cached reads that writes the update hook cannot see may have made stale: commits by other connections
+    // (data_version), DDL (schema_version) and DELETEs without WHERE, which SQLite runs as a truncate that counts
+    // its rows but skips the hook. Trigger and cascade rows are hooked but not counted, so only a shortfall clears.
+    void check_read_cache() {
+        auto stmt = prepare("SELECT data_version, schema_version FROM pragma_data_version, pragma_schema_version");
+        int64_t data_version = -1;
+        int64_t schema_version = -1;
+        if (sqlite3_step(stmt.get()) == SQLITE_ROW) {
+            data_version = sqlite3_column_int64(stmt.get(), 0);
+            schema_version = sqlite3_column_int64(stmt.get(), 1);
+        }
+        const auto total_changes = sqlite3_total_changes64(db);
+        if (data_version != seen_data_version || schema_version != seen_schema_version ||
+            total_changes - seen_changes > hooked_changes) {
+            read_cache->clear();
+        }
+        seen_data_version = data_version;
+        seen_schema_version = schema_version;
+        seen_changes = total_changes;
+        hooked_changes = 0;
+    }
+
+    // With cache_reads, returns a copy of the cached result of key (read from table) or stores what read returns
+    template <typename Value, typename Read>
+    Value read_through(const std::string& table, const std::string& key, Read read) {
+        if (!read_cache) {
+            return read();
+        }
+        check_read_cache();
+        if (const auto cached = read_cache->find<Value>(table, key)) {
+            return *cached;
+        }
+        auto value = read();
+        read_cache->insert(table, key, std::make_shared<const Value>(value));
+        return value;
+    }
+
+    // Table that stores an array attribute of a collection: a vector group or column first, then a set column
+    const AttributeLocation& route_array(const std::string& collection, const std::string& array_name) const {
+        if (const auto* location = schema->find_attribute(collection, array_name, AttributeKind::Vector)) {
+            return *location;
+        }
+        const auto* location = schema->find_attribute(collection, array_name, AttributeKind::Set);
+        if (location && location->column) {
+            return *location;
+        }
+        throw std::runtime_error("Array '" + array_name + "' does not match any vector or set table for collection '" +
+                                 collection + "'");
+    }
+
+    void load_schema_metadata() {
+        // Both point into one cached LoadedSchema; a file with unchanged DDL skips introspection and validation
+        const auto loaded = SchemaCache::load(db, validate_schema);
+        schema = std::shared_ptr<const Schema>(loaded, &loaded->schema);
+        type_validator = std::shared_ptr<const TypeValidator>(loaded, &loaded->type_validator);
+        if (read_cache) {
+            read_cache->clear();
+        }
+        install_change_triggers();
+        if (validate_schema) {
+            for (const auto& missing : SchemaValidator(*schema).missing_indexes()) {
+                logger->warn(
+                    "No index on {}({}): {}", missing.table, join_columns(missing.columns, ", "), missing.reason);
+            }
+        }
+    }
+
+    static std::string join_columns(const std::vector<std::string>& columns, const char* separator) {
+        std::string joined;
+        for (const auto& column : columns) {
+            joined += (joined.empty() ? "" : separator) + column;
+        }
+        return joined;
+    }
+
+    // Rebuilds the change_tracker triggers for the current schema
+    void install_change_triggers() {
+        if (track_changes && schema) {
+            change_tracker::install(db, *schema);
+        }
+    }
+
+    ~Impl() {
+        if (db) {
+            logger->debug("Closing database: {}", path);
+            if (statements) {
+                logger->debug("Statement cache: {} hits, {} misses", statements->hits(), statements->misses());
+                statements.reset();
+            }
+            if (read_cache) {
+                logger->debug("Read cache: {} hits, {} misses", read_cache->hits(), read_cache->misses());
+            }
+            // After the statements, whose finalization still reports to the trace hook
+            sqlite3_trace_v2(db, 0, nullptr, nullptr);
+            stats.reset();
+            sqlite3_close_v2(db);
+            db = nullptr;
+            logger->info("Database closed");
+        }
+    }
+
+    // Runs "PRAGMA name = value" and returns the first value it reports, if any
+    std::string set_pragma(const std::string& name, const std::string& value) {
+        std::string reported;
+        char* err_msg = nullptr;
+        const auto sql = "PRAGMA " + name + " = " + value + ";";
+        const auto rc = sqlite3_exec(
+            db,
+            sql.c_str(),
+            [](void* out, int count, char** values, char**) {
+                if (count > 0 && values[0]) {
+                    *static_cast<std::string*>(out) = values[0];
+                }
+                return 0;
+            },
+            &reported,
+            &err_msg);
+        if (rc != SQLITE_OK) {
+            std::string error = err_msg ? err_msg : "Unknown error";
+            sqlite3_free(err_msg);
+            throw std::runtime_error("Failed to set PRAGMA " + name + ": " + error);
+        }
+        logger->debug("PRAGMA {} = {}", name, value);
+        return reported;
+    }
+
+    void apply_pragmas(const DatabaseOptions& options) {
+        // page_size must be set before the first table is created and before switching to WAL
+        if (options.page_size) {
+            const auto size = *options.page_size;
+            if (size < 512 || size > 65536 || !std::has_single_bit(static_cast<unsigned>(size))) {
+                throw std::runtime_error("Invalid page_size " + std::to_string(size) +
+                                         ": must be a power of two between 512 and 65536");
+            }
+            set_pragma("page_size", std::to_string(size));
+        }
+        if (options.journal_mode) {
+            // SQLite answers with the mode in effect, which differs for in-memory or read-only databases
+            const std::string requested = journal_mode_name(*options.journal_mode);
+            const auto actual = set_pragma("journal_mode", requested);
+            if (actual != requested) {
+                logger->warn("Requested journal_mode {} but the database uses {}", requested, actual);
+            }
+        }
+        if (options.synchronous) {
+            set_pragma("synchronous", synchronous_name(*options.synchronous));
+        }
+        if (options.cache_size) {
+            set_pragma("cache_size", std::to_string(*options.cache_size));
+        }
+        auto mmap_size = options.mmap_size;
+        if (options.mapped) {
+            set_pragma("query_only", "ON");
+            if (!mmap_size) {
+                // SQLite clamps this to SQLITE_MAX_MMAP_SIZE (about 2 GiB unless raised at build time)
+                std::error_code ec;
+                const auto file_size = std::filesystem::file_size(path, ec);
+                mmap_size = ec ? 0 : static_cast<int64_t>(file_size);
+            }
+        }
+        if (mmap_size) {
+            if (*mmap_size < 0) {
+                throw std::runtime_error("Invalid mmap_size " + std::to_string(*mmap_size) + ": must not be negative");
+            }
+            set_pragma("mmap_size", std::to_string(*mmap_size));
+        }
+        if (options.temp_store) {
+            set_pragma("temp_store", *options.temp_store == TempStore::memory ? "MEMORY" : "FILE");
+        }
+    }
+
+    // Exclusive also keeps readers on other connections out until the commit (in WAL mode only writers)
+    void begin_transaction(bool exclusive = false) {
+        char* err_msg = nullptr;
+        const auto* sql = exclusive ? "BEGIN EXCLUSIVE TRANSACTION;" : "BEGIN TRANSACTION;";
+        const auto rc = sqlite3_exec(db, sql, nullptr, nullptr, &err_msg);
+        if (rc != SQLITE_OK) {
+            std::string error = err_msg ? err_msg : "Unknown error";
+            sqlite3_free(err_msg);
+            throw std::runtime_error("Failed to begin transaction: " + error);
+        }
+        logger->debug("Transaction started");
+    }
+
+    void commit() {
+        char* err_msg = nullptr;
+        const auto rc = sqlite3_exec(db, "COMMIT;", nullptr, nullptr, &err_msg);
+        if (rc != SQLITE_OK) {
+            std::string error = err_msg ? err_msg : "Unknown error";
+            sqlite3_free(err_msg);
+            throw std::runtime_error("Failed to commit transaction: " + error);
+        }
+        logger->debug("Transaction committed");
+    }
+
+    void rollback() {
+        char* err_msg = nullptr;
+        const auto rc = sqlite3_exec(db, "ROLLBACK;", nullptr, nullptr, &err_msg);
+        if (rc != SQLITE_OK) {
+            std::string error = err_msg ? err_msg : "Unknown error";
+            sqlite3_free(err_msg);
+            logger->error("Failed to rollback transaction: {}", error);
+            // Don't throw - rollback is often called in error recovery
+        } else {
+            logger->debug("Transaction rolled back");
+        }
+    }
+
+    // Savepoints nest inside an already open transaction
+    int64_t savepoint_counter = 0;
+    // Levels opened through the public transaction API; empty name marks the outer BEGIN
+    std::vector<std::string> transaction_stack;
+
+    std::string savepoint() {
+        auto name = "quiver_sp_" + std::to_string(++savepoint_counter);
+        char* err_msg = nullptr;
+        const auto rc = sqlite3_exec(db, ("SAVEPOINT " + name + ";").c_str(), nullptr, nullptr, &err_msg);
+        if (rc != SQLITE_OK) {
+            std::string error = err_msg ? err_msg : "Unknown error";
+            sqlite3_free(err_msg);
+            throw std::runtime_error("Failed to create savepoint: " + error);
+        }
+        logger->debug("Savepoint {} created", name);
+        return name;
+    }
+
+    void release_savepoint(const std::string& name) {
+        char* err_msg = nullptr;
+        const auto rc = sqlite3_exec(db, ("RELEASE SAVEPOINT " + name + ";").c_str(), nullptr, nullptr, &err_msg);
+        if (rc != SQLITE_OK) {
+            std::string error = err_msg ? err_msg : "Unknown error";
+            sqlite3_free(err_msg);
+            throw std::runtime_error("Failed to release savepoint: " + error);
+        }
+        logger->debug("Savepoint {} released", name);
+    }
+
+    void rollback_to_savepoint(const std::string& name) {
+        // ROLLBACK TO keeps the savepoint on the stack; RELEASE removes it
+        const auto sql = "ROLLBACK TO SAVEPOINT " + name + "; RELEASE SAVEPOINT " + name + ";";
+        char* err_msg = nullptr;
+        const auto rc = sqlite3_exec(db, sql.c_str(), nullptr, nullptr, &err_msg);
+        if (rc != SQLITE_OK) {
+            std::string error = err_msg ? err_msg : "Unknown error";
+            sqlite3_free(err_msg);
+            logger->error("Failed to rollback to savepoint {}: {}", name, error);
+            // Don't throw - rollback is often called in error recovery
+        } else {
+            // Rows touched inside the savepoint may have been undone; the rollback hook only covers full rollbacks
+            labels.clear();
+            if (read_cache) {
+                read_cache->clear();
+            }
+            logger->debug("Rolled back to savepoint {}", name);
+        }
+    }
+
+    // Opens the connection at path and installs pragmas, the statement cache and hooks; path and logger must be set
+    void open(const DatabaseOptions& options) {
+        logger->debug("Opening database: {}", path);
+        validate_schema = options.validate_schema;
+        open_options = options;
+
+        ensure_sqlite3_initialized();
+        if (options.soft_heap_limit) {
+            sqlite3_soft_heap_limit64(*options.soft_heap_limit);
+        }
+        if (options.hard_heap_limit) {
+            sqlite3_hard_heap_limit64(*options.hard_heap_limit);
+        }
+
+        auto flags = options.read_only ? SQLITE_OPEN_READONLY : (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
+        auto open_path = path;
+        if (options.mapped) {
+            if (path.empty() || path == ":memory:") {
+                throw std::runtime_error("Failed to open database: mapped mode requires a database file");
+            }
+            flags = SQLITE_OPEN_READONLY | SQLITE_OPEN_URI;
+            open_path = immutable_file_uri(path);
+        }
+        if (options.load_into_memory) {
+            if (path.empty() || path == ":memory:" || options.mapped) {
+                throw std::runtime_error(
+                    "Failed to open database: load_into_memory requires a database file and excludes mapped");
+            }
+            // Writable even for read_only, since the copy is written into it; query_only guards it afterwards
+            flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
+            open_path = ":memory:";
+        }
+        const auto rc = sqlite3_open_v2(open_path.c_str(), &db, flags, nullptr);
+
+        if (rc != SQLITE_OK) {
+            std::string error_msg = db ? sqlite3_errmsg(db) : "Unknown error";
+            logger->error("Failed to open database: {}", error_msg);
+            if (db) {
+                sqlite3_close(db);
+                db = nullptr;
+            }
+            throw std::runtime_error("Failed to open database: " + error_msg);
+        }
+
+        if (options.load_into_memory) {
+            load_working_copy(options.read_only);
+        }
+        track_changes = options.track_changes && !options.read_only && !options.mapped;
+        if (track_changes) {
+            change_tracker::create_log(db);
+        }
+
+        // Enable foreign keys
+        sqlite3_exec(db, "PRAGMA foreign_keys = ON;", nullptr, nullptr, nullptr);
+        logger->debug("Database opened successfully, foreign keys enabled");
+        packed_vector::register_functions(db);
+        time_series_codec::register_functions(db);
+        if (sqlite3_create_function(db, "quiver_vector", 3, SQLITE_UTF8, this, &Impl::on_vector, nullptr, nullptr) !=
+            SQLITE_OK) {
+            throw std::runtime_error("Failed to register quiver_vector: " + std::string(sqlite3_errmsg(db)));
+        }
+
+        apply_pragmas(options);
+
+        statements = std::make_unique<StatementCache>(db, options.statement_cache_size);
+        if (options.collect_stats) {
+            stats = std::make_unique<StatsCollector>(db);
+            statements->set_prepare_listener(
+                [collector = stats.get()](const std::string& sql, int64_t nanoseconds) {
+                    collector->record_prepare(sql, nanoseconds);
+                });
+        }
+        if (options.slow_query_threshold) {
+            slow_query_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(*options.slow_query_threshold).count();
+        }
+        // SQLite allows one trace callback per connection, so stats and slow-query logging share this one
+        if (stats || slow_query_ns) {
+            const unsigned events = stats ? SQLITE_TRACE_PROFILE | SQLITE_TRACE_ROW : SQLITE_TRACE_PROFILE;
+            sqlite3_trace_v2(db, events, &Impl::on_trace, this);
+        }
+
+        if (options.busy_timeout) {
+            sqlite3_busy_timeout(db, static_cast<int>(options.busy_timeout->count()));
+        }
+        statement_timeout = options.statement_timeout;
+        install_progress_handler();
+
+        if (options.cache_reads) {
+            read_cache = std::make_unique<AttributeCache>(options.read_cache_limit);
+        }
+
+        // Any UPDATE or DELETE may change a label, so it drops that collection's cached labels.
+        // Inserts never make a cached label stale. Any write makes the table's cached reads stale.
+        sqlite3_update_hook(
+            db,
+            [](void* user_data, int op, const char*, const char* table, sqlite3_int64) {
+                auto* impl = static_cast<Impl*>(user_data);
+                if (op != SQLITE_INSERT && !impl->labels.empty()) {
+                    impl->labels.invalidate(table);
+                }
+                if (impl->read_cache) {
+                    ++impl->hooked_changes;
+                    impl->read_cache->invalidate(table);
+                }
+            },
+            this);
+        sqlite3_rollback_hook(
+            db,
+            [](void* user_data) {
+                auto* impl = static_cast<Impl*>(user_data);
+                impl->labels.clear();
+                if (impl->read_cache) {
+                    impl->read_cache->clear();
+                }
+            },
+            this);
+
+        logger->info("Database opened successfully: {}", path);
+    }
+
+    static int on_trace(unsigned type, void* context, void* p, void* x) {
+        auto* impl = static_cast<Impl*>(context);
+        auto* stmt = static_cast<sqlite3_stmt*>(p);
+        if (type == SQLITE_TRACE_ROW) {
+            if (impl->stats) {
+                impl->stats->record_row(stmt);
+            }
+        } else if (type == SQLITE_TRACE_PROFILE) {
+            const auto nanoseconds = static_cast<int64_t>(*static_cast<sqlite3_int64*>(x));
+            if (impl->stats) {
+                impl->stats->record_execution(stmt, nanoseconds);
+            }
+            if (impl->slow_query_ns && nanoseconds >= *impl->slow_query_ns) {
+                impl->log_slow_query(stmt, nanoseconds);
+            }
+        }
+        return 0;
+    }
+
+    // quiver_vector(collection, attribute, id): the element's numeric vector as a packed BLOB (NULL when empty, NaN
+    // for NULL entries), so SQL can hand it to quiver_vector_dot or quiver_vector_sum instead of joining the table
+    static void on_vector(sqlite3_context* context, int, sqlite3_value** argv) {
+        auto* impl = static_cast<Impl*>(sqlite3_user_data(context));
+        try {
+            impl->require_schema("run quiver_vector");
+            const auto* collection = reinterpret_cast<const char*>(sqlite3_value_text(argv[0]));
+            const auto* attribute = reinterpret_cast<const char*>(sqlite3_value_text(argv[1]));
+            if (!collection || !attribute || sqlite3_value_type(argv[2]) != SQLITE_INTEGER) {
+                throw std::runtime_error("quiver_vector takes (collection, attribute, id)");
+            }
+            const auto table = impl->schema->find_vector_table(collection, attribute);
+            const auto id = static_cast<int64_t>(sqlite3_value_int64(argv[2]));
+            if (impl->schema->is_packed_vector_table(table)) {
+                auto stmt =
+                    impl->prepare("SELECT " + std::string(attribute) + " FROM " + table + " WHERE id = ?", {id});
+                const auto rc = sqlite3_step(stmt.get());
+                if (rc != SQLITE_ROW) {
+                    check_step_done(stmt.get(), rc);
+                    sqlite3_result_null(context);
+                    return;
+                }
+                sqlite3_result_value(context, sqlite3_column_value(stmt.get(), 0));
+                return;
+            }
+
+            auto stmt = impl->prepare(
+                "SELECT " + std::string(attribute) + " FROM " + table + " WHERE id = ? ORDER BY vector_index", {id});
+            std::vector<double> values;
+            int rc;
+            while ((rc = sqlite3_step(stmt.get())) == SQLITE_ROW) {
+                const auto type = sqlite3_column_type(stmt.get(), 0);
+                if (type == SQLITE_TEXT || type == SQLITE_BLOB) {
+                    throw std::runtime_error("quiver_vector: '" + table + "." + attribute + "' is not numeric");
+                }
+                // A NULL entry keeps its position as NaN, as packed and compressed vectors store it
+                values.push_back(type == SQLITE_NULL ? std::numeric_limits<double>::quiet_NaN()
+                                                     : sqlite3_column_double(stmt.get(), 0));
+            }
+            check_step_done(stmt.get(), rc);
+            if (values.empty()) {
+                sqlite3_result_null(context);
+                return;
+            }
+            const auto bytes = packed_vector::encode(values);
+            sqlite3_result_blob64(context, bytes.data(), bytes.size(), SQLITE_TRANSIENT);
+        } catch (const std::exception& e) {
+            sqlite3_result_error(context, e.what(), -1);
+        }
+    }
+
+    void log_slow_query(sqlite3_stmt* stmt, int64_t nanoseconds) {
+        // Still bound here: the profile callback runs before the statement cache clears the bindings
+        char* expanded = sqlite3_expanded_sql(stmt);
+        const char* sql = expanded ? expanded : sqlite3_sql(stmt);
+        logger->warn("Slow query ({:.3f} ms) in {}: {}",
+                     static_cast<double>(nanoseconds) / 1e6,
+                     current_operation ? current_operation : "direct SQL",
+                     sql ? sql : "");
+        sqlite3_free(expanded);
+    }
+
+    // Copies the main database of source into target in steps of options.pages_per_step, retrying while either is
+    // locked. Errors are reported from target, where sqlite3_backup records them.
+    static void copy_database(sqlite3* source, sqlite3* target, const BackupOptions& options) {
+        // An in-memory target only accepts pages of its own size, which it can still change while empty
+        sqlite3_stmt* stmt = nullptr;
+        if (sqlite3_prepare_v2(source, "PRAGMA main.page_size;", -1, &stmt, nullptr) == SQLITE_OK &&
+            sqlite3_step(stmt) == SQLITE_ROW) {
+            const auto sql = "PRAGMA main.page_size = " + std::to_string(sqlite3_column_int(stmt, 0)) + ";";
+            sqlite3_exec(target, sql.c_str(), nullptr, nullptr, nullptr);
+        }
+        sqlite3_finalize(stmt);
+
+        auto* backup = sqlite3_backup_init(target, "main", source, "main");
+        if (!backup) {
+            throw std::runtime_error("Failed to start backup: " + std::string(sqlite3_errmsg(target)));
+        }
+        const int pages = options.pages_per_step > 0 ? options.pages_per_step : -1;
+        int rc;
+        do {
+            rc = sqlite3_backup_step(backup, pages);
+            if (options.on_progress && (rc == SQLITE_OK || rc == SQLITE_DONE)) {
+                options.on_progress(sqlite3_backup_remaining(backup), sqlite3_backup_pagecount(backup));
+            }
+            if (rc == SQLITE_BUSY || rc == SQLITE_LOCKED) {
+                sqlite3_sleep(kBackupRetryMs);
+            }
+        } while (rc == SQLITE_OK || rc == SQLITE_BUSY || rc == SQLITE_LOCKED);
+        sqlite3_backup_finish(backup);
+        if (rc != SQLITE_DONE) {
+            throw std::runtime_error("Failed to copy database: " + std::string(sqlite3_errstr(rc)));
+        }
+    }
+
+    // Fills the in-memory connection from the file at path (DatabaseOptions::load_into_memory). Uses the backup API
+    // rather than reading the file, so a WAL database includes its uncheckpointed frames.
+    void load_working_copy(bool read_only) {
+        if (!std::filesystem::exists(path)) {
+            if (read_only) {
+                throw std::runtime_error("Failed to open database: file not found: " + path);
+            }
+            logger->debug("{} does not exist yet; starting an empty in-memory copy", path);
+            return;
+        }
+        sqlite3* file = nullptr;
+        if (sqlite3_open_v2(path.c_str(), &file, SQLITE_OPEN_READONLY, nullptr) != SQLITE_OK) {
+            const std::string error = file ? sqlite3_errmsg(file) : "Unknown error";
+            sqlite3_close(file);
+            throw std::runtime_error("Failed to open database: " + error);
+        }
+        try {
+            BackupOptions all_at_once;
+            all_at_once.pages_per_step = 0;
+            copy_database(file, db, all_at_once);
+        } catch (...) {
+            sqlite3_close(file);
+            throw;
+        }
+        sqlite3_close(file);
+        if (read_only) {
+            set_pragma("query_only", "ON");
+        }
+        logger->debug("Loaded {} into memory", path);
+    }
+
+    // Runs the statements of sql one at a time, logging each one's time at debug level; returns how many ran
+    size_t run_script(const std::string& sql, int64_t version) {
+        size_t count = 0;
+        const char* tail = sql.c_str();
+        while (*tail) {
+            sqlite3_stmt* stmt = nullptr;
+            const char* next = nullptr;
+            if (sqlite3_prepare_v2(db, tail, -1, &stmt, &next) != SQLITE_OK) {
+                throw std::runtime_error("Failed to prepare statement: " + std::string(sqlite3_errmsg(db)));
+            }
+            const std::string_view text(tail, static_cast<size_t>(next - tail));
+            tail = next;
+            if (!stmt) {
+                continue;  // Only whitespace or comments
+            }
+            const auto start = std::chrono::steady_clock::now();
+            int rc;
+            while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+            }
+            if (rc != SQLITE_DONE) {
+                const std::string error = sqlite3_errmsg(db);
+                sqlite3_finalize(stmt);
+                throw std::runtime_error("Failed to execute statement: " + error);
+            }
+            sqlite3_finalize(stmt);
+            ++count;
+            const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+            logger->debug(
+                "Migration {} statement {} ({:.3f} ms): {}", version, count, elapsed.count(), statement_summary(text));
+        }
+        return count;
+    }
+
+    // Opens a transaction, or a savepoint when a transaction is already active
+    class TransactionGuard {
+        Impl& impl_;
+        std::string savepoint_;
+        bool committed_ = false;
+
+    public:
+        explicit TransactionGuard(Impl& impl, bool exclusive = false) : impl_(impl) {
+            if (sqlite3_get_autocommit(impl_.db)) {
+                impl_.begin_transaction(exclusive);
+            } else {
+                savepoint_ = impl_.savepoint();
+            }
+        }
+
+        void commit() {
+            if (savepoint_.empty()) {
+                impl_.commit();
+            } else {
+                impl_.release_savepoint(savepoint_);
+            }
+            committed_ = true;
+        }
+
+        ~TransactionGuard() {
+            if (committed_) {
+                return;
+            }
+            if (savepoint_.empty()) {
+                impl_.rollback();
+            } else {
+                impl_.rollback_to_savepoint(savepoint_);
+            }
+        }
+
+        TransactionGuard(const TransactionGuard&) = delete;
+        TransactionGuard& operator=(const TransactionGuard&) = delete;
+    };
+};
+
+Database::Database(const std::string& path, const DatabaseOptions& options) : impl_(std::make_unique<Impl>()) {
+    impl_->path = path;
+    if (options.async_logging) {
+        impl_->log_thread_pool = shared_logging_thread_pool();
+    }
+    impl_->logger = create_database_logger(path, options, impl_->log_thread_pool);
+    impl_->open(options);
+}
+
+Database::Database(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+void Database::load_schema_if_needed() {
+    if (!impl_->schema) {
+        impl_->load_schema_metadata();
+    }
+}
+
+const Schema& Database::schema() const {
+    impl_->require_schema("access schema");
+    return *impl_->schema;
+}
+
+Database Database::open_sibling(const DatabaseOptions& options) {
+    load_schema_if_needed();
+    auto impl = std::make_unique<Impl>();
+    impl->path = impl_->path;
+    impl->log_thread_pool = impl_->log_thread_pool;
+    impl->logger = impl_->logger;
+    impl->open(options);
+    impl->schema = impl_->schema;
+    impl->type_validator = impl_->type_validator;
+    impl->install_change_triggers();
+    return Database(std::move(impl));
+}
+
+Database Database::from_snapshot(const std::string& path, const DatabaseOptions& options) {
+    auto source_options = options;
+    source_options.read_only = true;
+    source_options.mapped = false;
+    source_options.load_into_memory = false;
+    const Database source(path, source_options);
+    auto snapshot = source.clone_in_memory();
+    snapshot.load_schema_if_needed();
+    return snapshot;
+}
+
+void Database::backup_to(const std::string& path, const BackupOptions& options) const {
+    const auto timer = impl_->time_operation("backup_to");
+    sqlite3* target = nullptr;
+    if (sqlite3_open_v2(path.c_str(), &target, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr) != SQLITE_OK) {
+        const std::string error = target ? sqlite3_errmsg(target) : "Unknown error";
+        sqlite3_close(target);
+        throw std::runtime_error("Failed to open backup target: " + error);
+    }
+    try {
+        Impl::copy_database(impl_->db, target, options);
+    } catch (...) {
+        sqlite3_close(target);
+        throw;
+    }
+    sqlite3_close(target);
+    impl_->logger->info("Backed up {} to {}", impl_->path, path);
+}
+
+void Database::flush() {
+    const auto timer = impl_->time_operation("flush");
+    if (!impl_->open_options.load_into_memory) {
+        return;
+    }
+    if (impl_->open_options.read_only) {
+        throw std::runtime_error("Cannot flush: database was opened read-only");
+    }
+    if (!sqlite3_get_autocommit(impl_->db)) {
+        throw std::runtime_error("Cannot flush inside a transaction");
+    }
+    backup_to(impl_->path);
+}
+
+int64_t Database::change_token() const {
+    if (!impl_->open_options.track_changes) {
+        throw std::runtime_error("Cannot read change token: change tracking is not enabled");
+    }
+    return impl_->track_changes ? change_tracker::current_token(impl_->db) : 0;
+}
+
+ChangeSet Database::changes_since(int64_t token) const {
+    const auto timer = impl_->time_operation("changes_since");
+    if (!impl_->open_options.track_changes) {
+        throw std::runtime_error("Cannot read changes: change tracking is not enabled");
+    }
+    ChangeSet result;
+    result.token = token;
+    if (!impl_->track_changes) {
+        return result;
+    }
+    // The bare columns come from the row holding max(seq), i.e. each attribute's latest change
+    auto stmt = impl_->prepare(
+        "SELECT collection, element_id, attribute, kind, max(seq) FROM temp.quiver_changes WHERE seq > ? "
+        "GROUP BY collection, element_id, attribute ORDER BY max(seq)",
+        {token});
+    auto* row = stmt.get();
+    int rc;
+    while ((rc = sqlite3_step(row)) == SQLITE_ROW) {
+        Change change;
+        change.collection = reinterpret_cast<const char*>(sqlite3_column_text(row, 0));
+        change.id = sqlite3_column_int64(row, 1);
+        if (const auto* attribute = sqlite3_column_text(row, 2)) {
+            change.attribute = reinterpret_cast<const char*>(attribute);
+        }
+        switch (sqlite3_column_int(row, 3)) {
+        case change_tracker::kCreated:
+            change.kind = ChangeKind::created;
+            break;
+        case change_tracker::kDeleted:
+            change.kind = ChangeKind::deleted;
+            break;
+        default:
+            change.kind = ChangeKind::updated;
+            break;
+        }
+        result.token = std::max<int64_t>(result.token, sqlite3_column_int64(row, 4));
+        result.changes.push_back(std::move(change));
+    }
+    check_step_done(row, rc);
+    return result;
+}
+
+void Database::discard_changes(int64_t token) {
+    const auto timer = impl_->time_operation("discard_changes");
+    if (!impl_->open_options.track_changes) {
+        throw std::runtime_error("Cannot discard changes: change tracking is not enabled");
+    }
+    if (impl_->track_changes) {
+        auto stmt = impl_->prepare("DELETE FROM temp.quiver_changes WHERE seq <= ?", {token});
+        check_step_done(stmt.get(), sqlite3_step(stmt.get()));
+    }
+}
+
+Database Database::clone_in_memory() const {
+    const auto timer = impl_->time_operation("clone_in_memory");
+    auto options = impl_->open_options;
+    options.read_only = false;
+    options.mapped = false;
+    options.load_into_memory = false;
+    auto impl = std::make_unique<Impl>();
+    impl->path = ":memory:";
+    impl->log_thread_pool = impl_->log_thread_pool;
+    impl->logger = impl_->logger;
+    impl->open(options);
+    BackupOptions all_at_once;
+    all_at_once.pages_per_step = 0;
+    Impl::copy_database(impl_->db, impl->db, all_at_once);
+    // Same DDL, so a loaded schema also describes the copy
+    impl->schema = impl_->schema;
+    impl->type_validator = impl_->type_validator;
+    impl->install_change_triggers();
+    return Database(std::move(impl));
+}
+
+Database::~Database() = default;
+
+Database::Database(Database&& other) noexcept = default;
+Database& Database::operator=(Database&& other) noexcept = default;
+
+bool Database::is_healthy() const {
+    return impl_ && impl_->db != nullptr;
+}
+
+void Database::interrupt() {
+    sqlite3_interrupt(impl_->db);
+}
+
+void Database::set_busy_timeout(std::optional<std::chrono::milliseconds> timeout) {
+    // A non-positive value removes the busy handler
+    sqlite3_busy_timeout(impl_->db, timeout ? static_cast<int>(timeout->count()) : 0);
+}
+
+void Database::set_statement_timeout(std::optional<std::chrono::milliseconds> timeout) {
+    impl_->statement_timeout = timeout;
+    impl_->install_progress_handler();
+}
+
+std::optional<std::chrono::milliseconds> Database::statement_timeout() const {
+    if (!impl_->statement_timeout) {
+        return std::nullopt;
+    }
+    return std::chrono::duration_cast<std::chrono::milliseconds>(*impl_->statement_timeout);
+}
+
+void Database::set_progress_handler(std::function<bool()> handler) {
+    impl_->progress_handler = std::move(handler);
+    impl_->install_progress_handler();
+}
+
+StatementCacheStats Database::statement_cache_stats() const {
+    StatementCacheStats stats;
+    stats.hits = impl_->statements->hits();
+    stats.misses = impl_->statements->misses();
+    stats.size = impl_->statements->size();
+    stats.capacity = impl_->statements->capacity();
+    return stats;
+}
+
+DatabaseStats Database::stats() const {
+    DatabaseStats stats;
+    if (impl_->stats) {
+        stats.operations = impl_->stats->operations();
+        stats.statements = impl_->stats->statements();
+    }
+    stats.statement_cache = statement_cache_stats();
+    return stats;
+}
+
+void Database::reset_stats() {
+    if (impl_->stats) {
+        impl_->stats->reset();
+    }
+}
+
+MemoryUsage Database::memory_usage() const {
+    auto status = [this](int op) {
+        int current = 0;
+        int highwater = 0;
+        sqlite3_db_status(impl_->db, op, &current, &highwater, 0);
+        return static_cast<int64_t>(current);
+    };
+
+    MemoryUsage usage;
+    usage.page_cache = status(SQLITE_DBSTATUS_CACHE_USED);
+    usage.sqlite_schema = status(SQLITE_DBSTATUS_SCHEMA_USED);
+    usage.statements = status(SQLITE_DBSTATUS_STMT_USED);
+    if (impl_->schema) {
+        usage.schema = static_cast<int64_t>(impl_->schema->memory_usage());
+    }
+    if (impl_->read_cache) {
+        usage.read_cache = static_cast<int64_t>(impl_->read_cache->bytes());
+    }
+    usage.label_cache = static_cast<int64_t>(impl_->labels.bytes());
+
+    usage.cache_hits = status(SQLITE_DBSTATUS_CACHE_HIT);
+    usage.cache_misses = status(SQLITE_DBSTATUS_CACHE_MISS);
+    usage.cache_writes = status(SQLITE_DBSTATUS_CACHE_WRITE);
+    usage.cache_spills = status(SQLITE_DBSTATUS_CACHE_SPILL);
+
+    usage.sqlite_heap = sqlite3_memory_used();
+    usage.sqlite_heap_highwater = sqlite3_memory_highwater(0);
+    usage.soft_heap_limit = sqlite3_soft_heap_limit64(-1);
+    return usage;
+}
+
+int64_t Database::shrink_memory() {
+    const auto timer = impl_->time_operation("shrink_memory");
+    const auto before = memory_usage().total();
+    sqlite3_db_release_memory(impl_->db);
+    impl_->statements->clear();
+    if (impl_->read_cache) {
+        impl_->read_cache->clear();
+    }
+    impl_->labels.clear();
+    const auto released = before - memory_usage().total();
+    impl_->logger->debug("Released {} bytes", released);
+    return std::max<int64_t>(released, 0);
+}
+
+Result Database::execute(const std::string& sql, const std::vector<Value>& params) {
+    auto handle = impl_->statements->acquire(sql);
+    auto* stmt = handle.get();
+    int rc = SQLITE_OK;
+
+    bind_params(stmt, params);
+
+    // Get column info
+    std::vector<std::string> columns;
+    const auto col_count = sqlite3_column_count(stmt);
+    columns.reserve(col_count);
+    for (int i = 0; i < col_count; ++i) {
+        const char* name = sqlite3_column_name(stmt, i);
+        columns.emplace_back(name ? name : "");
+    }
+
+    // Execute and fetch results
+    std::vector<Row> rows;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        std::vector<Value> values;
+        values.reserve(col_count);
+
+        for (int i = 0; i < col_count; ++i) {
+            values.push_back(column_as_value(stmt, i));
+        }
+        rows.emplace_back(std::move(values));
+    }
+
+    if (rc != SQLITE_DONE) {
+        throw std::runtime_error("Failed to execute statement: " + std::string(sqlite3_errmsg(impl_->db)));
+    }
+
+    return Result(std::move(columns), std::move(rows));
+}
 
 int64_t Database::current_version() const {
+    const auto timer = impl_->time_operation("current_version");
     sqlite3_stmt* stmt = nullptr;
     const char* sql = "PRAGMA user_version;";
     auto rc = sqlite3_prepare_v2(impl_->db, sql, -1, &stmt, nullptr);
@@ -421,13 +2601,82 @@ void Database::set_version(int64_t version) {
 }
 
 void Database::begin_transaction() {
-    impl_->begin_transaction();
+    const auto timer = impl_->time_operation("begin_transaction");
+    if (sqlite3_get_autocommit(impl_->db)) {
+        impl_->begin_transaction();
+        impl_->transaction_stack.emplace_back();
+    } else {
+        impl_->transaction_stack.push_back(impl_->savepoint());
+    }
 }
+
 void Database::commit() {
-    impl_->commit();
+    const auto timer = impl_->time_operation("commit");
+    if (impl_->transaction_stack.empty()) {
+        throw std::runtime_error("Cannot commit: no transaction is active");
+    }
+    // Pop only after success so a failed commit can still be rolled back
+    const auto& savepoint = impl_->transaction_stack.back();
+    if (savepoint.empty()) {
+        impl_->commit();
+    } else {
+        impl_->release_savepoint(savepoint);
+    }
+    impl_->transaction_stack.pop_back();
 }
+
 void Database::rollback() {
-    impl_->rollback();
+    const auto timer = impl_->time_operation("rollback");
+    if (impl_->transaction_stack.empty()) {
+        throw std::runtime_error("Cannot rollback: no transaction is active");
+    }
+    const auto savepoint = std::move(impl_->transaction_stack.back());
+    impl_->transaction_stack.pop_back();
+    if (savepoint.empty()) {
+        impl_->rollback();
+    } else {
+        impl_->rollback_to_savepoint(savepoint);
+    }
+}
+
+bool Database::in_transaction() const {
+    return sqlite3_get_autocommit(impl_->db) == 0;
+}
+
+void Database::transaction(const std::function<void()>& fn) {
+    Transaction txn(*this);
+    fn();
+    txn.commit();
+}
+
+Database::Transaction::Transaction(Database& db) : db_(db) {
+    db_.begin_transaction();
+}
+
+Database::Transaction::~Transaction() {
+    if (active_) {
+        try {
+            db_.rollback();
+        } catch (const std::exception&) {
+            // Destructors must not throw
+        }
+    }
+}
+
+void Database::Transaction::commit() {
+    if (!active_) {
+        throw std::runtime_error("Cannot commit: transaction is no longer active");
+    }
+    db_.commit();
+    active_ = false;
+}
+
+void Database::Transaction::rollback() {
+    if (!active_) {
+        throw std::runtime_error("Cannot rollback: transaction is no longer active");
+    }
+    active_ = false;
+    db_.rollback();
 }
 
 void Database::execute_raw(const std::string& sql) {
@@ -440,11 +2689,13 @@ void Database::execute_raw(const std::string& sql) {
     }
 }
 
-void Database::migrate_up(const std::string& migrations_path) {
+std::vector<MigrationResult> Database::migrate_up(const std::string& migrations_path, const MigrateOptions& options) {
+    const auto timer = impl_->time_operation("migrate_up");
+    std::vector<MigrationResult> results;
     const auto migrations = Migrations(migrations_path);
     if (migrations.empty()) {
         impl_->logger->debug("No migrations found in {}", migrations_path);
-        return;
+        return results;
     }
 
     const auto current = current_version();
@@ -452,41 +2703,78 @@ void Database::migrate_up(const std::string& migrations_path) {
 
     if (pending.empty()) {
         impl_->logger->debug("Database is up to date at version {}", current);
-        if (!impl_->schema) {
-            impl_->load_schema_metadata();
-        }
-        return;
+        load_schema_if_needed();
+        return results;
     }
 
-    impl_->logger->info(
-        "Applying {} pending migration(s) from version {} to {}", pending.size(), current, migrations.latest_version());
+    impl_->logger->info("{} {} pending migration(s) from version {} to {}",
+                        options.dry_run ? "Rehearsing" : "Applying",
+                        pending.size(),
+                        current,
+                        migrations.latest_version());
 
-    for (const auto& migration : pending) {
-        impl_->logger->info("Applying migration {}", migration.version());
+    // Change triggers name columns the migrations may drop or rename; they come back with the new schema
+    if (impl_->track_changes) {
+        change_tracker::drop_triggers(impl_->db);
+    }
 
-        const auto up_sql = migration.up_sql();
-        if (up_sql.empty()) {
-            throw std::runtime_error("Migration " + std::to_string(migration.version()) + " has no up.sql file");
-        }
+    // One transaction for the whole set: a table rebuild re-checks foreign keys once at the commit, and no other
+    // connection sees a partly migrated file (defer_foreign_keys resets when the transaction ends)
+    try {
+        Impl::TransactionGuard txn(*impl_, true);
+        execute_raw("PRAGMA defer_foreign_keys = ON;");
+        for (const auto& migration : pending) {
+            const auto up_sql = migration.up_sql();
+            if (up_sql.empty()) {
+                throw std::runtime_error("Migration " + std::to_string(migration.version()) + " has no up.sql file");
+            }
 
-        begin_transaction();
-        try {
-            execute_raw(up_sql);
-            set_version(migration.version());
-            commit();
-            impl_->logger->info("Migration {} applied successfully", migration.version());
-        } catch (const std::exception& e) {
-            rollback();
-            impl_->logger->error("Migration {} failed: {}", migration.version(), e.what());
-            throw std::runtime_error("Migration " + std::to_string(migration.version()) + " failed: " + e.what());
+            impl_->logger->info("Applying migration {}", migration.version());
+            const auto start = std::chrono::steady_clock::now();
+            MigrationResult result;
+            result.version = migration.version();
+            try {
+                result.statements = impl_->run_script(up_sql, migration.version());
+                set_version(migration.version());
+            } catch (const std::exception& e) {
+                impl_->logger->error("Migration {} failed, rolling back all pending migrations: {}",
+                                     migration.version(),
+                                     e.what());
+                throw std::runtime_error("Migration " + std::to_string(migration.version()) + " failed: " + e.what());
+            }
+            result.elapsed_ns =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            impl_->logger->info("Migration {} ran {} statement(s) in {:.3f} ms",
+                                result.version,
+                                result.statements,
+                                static_cast<double>(result.elapsed_ns) / 1e6);
+            results.push_back(result);
+            if (options.on_migration) {
+                options.on_migration(result);
+            }
+        }
+        if (options.dry_run) {
+            impl_->logger->info("Dry run complete; rolling back to version {}", current);
+        } else {
+            txn.commit();
         }
+    } catch (...) {
+        impl_->install_change_triggers();
+        throw;
+    }
+    if (options.dry_run) {
+        // Rolled back, so the file and any loaded schema are as before
+        impl_->install_change_triggers();
+        return results;
     }
 
     impl_->load_schema_metadata();
     impl_->logger->info("All migrations applied successfully. Database now at version {}", current_version());
+    return results;
 }
 
 void Database::apply_schema(const std::string& schema_path) {
+    const auto timer = impl_->time_operation("apply_schema");
     std::ifstream file(schema_path);
     if (!file.is_open()) {
         throw std::runtime_error("Failed to open schema file: " + schema_path);
@@ -517,9 +2805,40 @@ void Database::apply_schema(const std::string& schema_path) {
 }
 
 int64_t Database::create_element(const std::string& collection, const Element& element) {
+    const auto timer = impl_->time_operation("create_element");
     impl_->logger->debug("Creating element in collection: {}", collection);
     impl_->require_collection(collection, "create element");
 
+    Impl::TransactionGuard txn(*impl_);
+    const auto element_id = insert_element(collection, element);
+    txn.commit();
+
+    impl_->logger->info("Created element {} in {}", element_id, collection);
+    return element_id;
+}
+
+std::vector<int64_t> Database::create_elements(const std::string& collection, std::span<const Element> elements) {
+    const auto timer = impl_->time_operation("create_elements");
+    impl_->logger->debug("Creating {} elements in collection: {}", elements.size(), collection);
+    impl_->require_collection(collection, "create elements");
+
+    std::vector<int64_t> ids;
+    ids.reserve(elements.size());
+    if (elements.empty()) {
+        return ids;
+    }
+
+    Impl::TransactionGuard txn(*impl_);
+    for (const auto& element : elements) {
+        ids.push_back(insert_element(collection, element));
+    }
+    txn.commit();
+
+    impl_->logger->info("Created {} elements in {}", ids.size(), collection);
+    return ids;
+}
+
+int64_t Database::insert_element(const std::string& collection, const Element& element) {
     const auto& scalars = element.scalars();
     if (scalars.empty()) {
         throw std::runtime_error("Element must have at least one scalar attribute");
@@ -533,7 +2852,6 @@ int64_t Database::create_element(const std::string& collection, const Element& e
     // Build INSERT SQL for main collection table
     auto sql = "INSERT INTO " + collection + " (";
     std::string placeholders;
-    std::vector<Value> params;
 
     auto first = true;
     for (const auto& [name, value] : scalars) {
@@ -543,74 +2861,44 @@ int64_t Database::create_element(const std::string& collection, const Element& e
         }
         sql += name;
         placeholders += "?";
-        params.push_back(value);
         first = false;
     }
     sql += ") VALUES (" + placeholders + ")";
 
-    execute(sql, params);
+    {
+        auto stmt = impl_->prepare(sql);
+        auto index = 1;
+        for (const auto& [name, value] : scalars) {
+            bind_value(stmt.get(), index++, value);
+        }
+        check_step_done(stmt.get(), sqlite3_step(stmt.get()));
+    }
     const auto element_id = sqlite3_last_insert_rowid(impl_->db);
     impl_->logger->debug("Inserted element with id: {}", element_id);
 
+    insert_element_arrays(collection, element_id, element);
+    return element_id;
+}
+
+void Database::insert_element_arrays(const std::string& collection, int64_t element_id, const Element& element) {
     // Process arrays - route to vector or set tables based on schema
     const auto& arrays = element.arrays();
 
     // Build a map of set table -> (column_name -> array values)
-    std::map<std::string, std::map<std::string, const std::vector<Value>*>> set_table_columns;
+    std::map<std::string, std::map<std::string, const ArrayValues*>> set_table_columns;
     // Build a map of vector table -> (column_name -> array values)
-    std::map<std::string, std::map<std::string, const std::vector<Value>*>> vector_table_columns;
+    std::map<std::string, std::map<std::string, const ArrayValues*>> vector_table_columns;
 
     for (const auto& [array_name, values] : arrays) {
-        if (values.empty()) {
+        if (array_size(values) == 0) {
             throw std::runtime_error("Empty array not allowed for '" + array_name + "'");
         }
 
-        // Check if this is a single-column vector table (Collection_vector_arrayname)
-        auto vector_table = Schema::vector_table_name(collection, array_name);
-        if (impl_->schema->has_table(vector_table)) {
-            vector_table_columns[vector_table][array_name] = &values;
-            continue;
-        }
-
-        // Check if this array_name is a column in any vector table for the collection
-        bool found_vector_table = false;
-        for (const auto& table_name : impl_->schema->table_names()) {
-            if (!impl_->schema->is_vector_table(table_name))
-                continue;
-            if (impl_->schema->get_parent_collection(table_name) != collection)
-                continue;
-
-            const auto* table_def = impl_->schema->get_table(table_name);
-            if (table_def && table_def->has_column(array_name)) {
-                vector_table_columns[table_name][array_name] = &values;
-                found_vector_table = true;
-                break;
-            }
-        }
-
-        if (found_vector_table) {
-            continue;
-        }
-
-        // Check if this array_name is a column in any set table
-        bool found_set_table = false;
-        for (const auto& table_name : impl_->schema->table_names()) {
-            if (!impl_->schema->is_set_table(table_name))
-                continue;
-            if (impl_->schema->get_parent_collection(table_name) != collection)
-                continue;
-
-            const auto* table_def = impl_->schema->get_table(table_name);
-            if (table_def && table_def->has_column(array_name)) {
-                set_table_columns[table_name][array_name] = &values;
-                found_set_table = true;
-                break;
-            }
-        }
-
-        if (!found_set_table) {
-            throw std::runtime_error("Array '" + array_name +
-                                     "' does not match any vector or set table for collection '" + collection + "'");
+        const auto& route = impl_->route_array(collection, array_name);
+        if (route.kind == AttributeKind::Vector) {
+            vector_table_columns[route.table][array_name] = &values;
+        } else {
+            set_table_columns[route.table][array_name] = &values;
         }
     }
 
@@ -626,29 +2914,43 @@ int64_t Database::create_element(const std::string& collection, const Element& e
         for (const auto& [col_name, values_ptr] : columns) {
             impl_->type_validator->validate_array(vector_table, col_name, *values_ptr);
             if (num_rows == 0) {
-                num_rows = values_ptr->size();
-            } else if (values_ptr->size() != num_rows) {
+                num_rows = array_size(*values_ptr);
+            } else if (array_size(*values_ptr) != num_rows) {
                 throw std::runtime_error("Vector columns in table '" + vector_table +
                                          "' must have the same length, but got different lengths for columns");
             }
         }
 
-        // Insert each row with vector_index
-        for (size_t row_idx = 0; row_idx < num_rows; ++row_idx) {
-            int64_t vector_index = static_cast<int64_t>(row_idx + 1);
-            auto vec_sql = "INSERT INTO " + vector_table + " (id, vector_index";
-            std::string vec_placeholders = "?, ?";
-            std::vector<Value> vec_params = {element_id, vector_index};
-
+        // A packed table gets one row holding every column's vector
+        if (impl_->schema->is_packed_vector_table(vector_table)) {
             for (const auto& [col_name, values_ptr] : columns) {
-                vec_sql += ", " + col_name;
-                vec_placeholders += ", ?";
-                vec_params.push_back((*values_ptr)[row_idx]);
+                std::visit(
+                    [&](const auto& typed) {
+                        impl_->write_packed_vector(
+                            vector_table, col_name, element_id, Impl::packed_values(vector_table, col_name, typed));
+                    },
+                    *values_ptr);
             }
+            continue;
+        }
 
-            vec_sql += ") VALUES (" + vec_placeholders + ")";
-            execute(vec_sql, vec_params);
+        // Resolve FK label strings to ids, then insert all rows with vector_index
+        std::vector<std::string> column_names = {"id", "vector_index"};
+        std::vector<std::optional<ArrayValues>> resolved_columns(columns.size());  // column_values points into it
+        std::vector<const ArrayValues*> column_values;
+        for (const auto& [col_name, values_ptr] : columns) {
+            column_names.push_back(col_name);
+            column_values.push_back(
+                &impl_->resolve_array(vector_table, col_name, *values_ptr, resolved_columns[column_values.size()]));
         }
+        impl_->insert_rows(vector_table, column_names, num_rows, [&](sqlite3_stmt* stmt, size_t row, int first) {
+            sqlite3_bind_int64(stmt, first, element_id);
+            sqlite3_bind_int64(stmt, first + 1, static_cast<int64_t>(row + 1));
+            for (size_t c = 0; c < column_values.size(); ++c) {
+                const auto index = first + 2 + static_cast<int>(c);
+                std::visit([&](const auto& typed) { bind_value(stmt, index, typed[row]); }, *column_values[c]);
+            }
+        });
         impl_->logger->debug("Inserted {} vector rows into {}", num_rows, vector_table);
     }
 
@@ -663,54 +2965,123 @@ int64_t Database::create_element(const std::string& collection, const Element& e
         size_t num_rows = 0;
         for (const auto& [col_name, values_ptr] : columns) {
             if (num_rows == 0) {
-                num_rows = values_ptr->size();
-            } else if (values_ptr->size() != num_rows) {
+                num_rows = array_size(*values_ptr);
+            } else if (array_size(*values_ptr) != num_rows) {
                 throw std::runtime_error("Set columns in table '" + set_table +
                                          "' must have the same length, but got different lengths for columns");
             }
         }
 
-        // Insert each row
-        for (size_t row_idx = 0; row_idx < num_rows; ++row_idx) {
-            auto set_sql = "INSERT INTO " + set_table + " (id";
-            std::string set_placeholders = "?";
-            std::vector<Value> set_params = {element_id};
+        // Resolve FK label strings to ids, then insert all rows
+        std::vector<std::string> column_names = {"id"};
+        std::vector<std::optional<ArrayValues>> resolved_columns(columns.size());  // column_values points into it
+        std::vector<const ArrayValues*> column_values;
+        for (const auto& [col_name, values_ptr] : columns) {
+            column_names.push_back(col_name);
+            column_values.push_back(
+                &impl_->resolve_array(set_table, col_name, *values_ptr, resolved_columns[column_values.size()]));
+        }
+        impl_->insert_rows(set_table, column_names, num_rows, [&](sqlite3_stmt* stmt, size_t row, int first) {
+            sqlite3_bind_int64(stmt, first, element_id);
+            for (size_t c = 0; c < column_values.size(); ++c) {
+                const auto index = first + 1 + static_cast<int>(c);
+                std::visit([&](const auto& typed) { bind_value(stmt, index, typed[row]); }, *column_values[c]);
+            }
+        });
+        impl_->logger->debug("Inserted {} set rows for table {}", num_rows, set_table);
+    }
+}
 
-            for (const auto& [col_name, values_ptr] : columns) {
-                set_sql += ", " + col_name;
-                set_placeholders += ", ?";
-
-                Value val = (*values_ptr)[row_idx];
-
-                // Check if this column is a FK and value is a string (label) that needs resolution
-                for (const auto& fk : table_def->foreign_keys) {
-                    if (fk.from_column == col_name && std::holds_alternative<std::string>(val)) {
-                        const std::string& label = std::get<std::string>(val);
-                        // Look up the ID by label using direct SQL query
-                        auto lookup_sql = "SELECT id FROM " + fk.to_table + " WHERE label = ?";
-                        auto lookup_result = execute(lookup_sql, {label});
-                        if (lookup_result.empty() || !lookup_result[0].get_integer(0)) {
-                            throw std::runtime_error("Failed to resolve label '" + label + "' to ID in table '" +
-                                                     fk.to_table + "'");
-                        }
-                        val = lookup_result[0].get_integer(0).value();
-                        break;
-                    }
-                }
+int64_t Database::upsert_row(const std::string& collection, const Element& element) {
+    const auto& scalars = element.scalars();
+    const auto label = scalars.find("label");
+    if (label == scalars.end() || !std::holds_alternative<std::string>(label->second)) {
+        throw std::runtime_error("Upsert requires a string 'label' attribute");
+    }
+    for (const auto& [name, value] : scalars) {
+        impl_->type_validator->validate_scalar(collection, name, value);
+    }
 
-                set_params.push_back(val);
-            }
-            set_sql += ") VALUES (" + set_placeholders + ")";
-            execute(set_sql, set_params);
+    // One statement either inserts the element or rewrites the scalars it carries; RETURNING gives the id both ways
+    // (an element with only a label still needs a SET clause for RETURNING to report the existing row)
+    std::vector<std::string> names;
+    std::vector<std::string> assignments;
+    std::vector<Value> params;
+    for (const auto& [name, value] : scalars) {
+        names.push_back(name);
+        params.push_back(value);
+        if (name != "label") {
+            assignments.push_back(name + " = excluded." + name);
         }
-        impl_->logger->debug("Inserted {} set rows for table {}", num_rows, set_table);
+    }
+    if (assignments.empty()) {
+        assignments.push_back("label = excluded.label");
+    }
+    const auto sql = "INSERT INTO " + collection + " (" + Impl::join_columns(names, ", ") + ") VALUES (" +
+                     Impl::join_columns(std::vector<std::string>(names.size(), "?"), ", ") +
+                     ") ON CONFLICT(label) DO UPDATE SET " + Impl::join_columns(assignments, ", ") + " RETURNING id";
+
+    int64_t element_id = 0;
+    {
+        auto stmt = impl_->prepare(sql, params);
+        const auto rc = sqlite3_step(stmt.get());
+        if (rc != SQLITE_ROW) {
+            check_step_done(stmt.get(), rc);
+            throw std::runtime_error("Upsert into '" + collection + "' returned no id");
+        }
+        element_id = sqlite3_column_int64(stmt.get(), 0);
+        check_step_done(stmt.get(), sqlite3_step(stmt.get()));
     }
 
-    impl_->logger->info("Created element {} in {}", element_id, collection);
+    // The element's groups replace whatever it had stored; groups it does not carry are left alone
+    std::set<std::string> tables;
+    for (const auto& [array_name, values] : element.arrays()) {
+        tables.insert(impl_->route_array(collection, array_name).table);
+    }
+    for (const auto& table : tables) {
+        auto handle = impl_->prepare("DELETE FROM " + table + " WHERE id = ?", {element_id});
+        check_step_done(handle.get(), sqlite3_step(handle.get()));
+    }
+    insert_element_arrays(collection, element_id, element);
+    return element_id;
+}
+
+int64_t Database::upsert_element(const std::string& collection, const Element& element) {
+    const auto timer = impl_->time_operation("upsert_element");
+    impl_->logger->debug("Upserting element in collection: {}", collection);
+    impl_->require_collection(collection, "upsert element");
+
+    Impl::TransactionGuard txn(*impl_);
+    const auto element_id = upsert_row(collection, element);
+    txn.commit();
+
+    impl_->logger->info("Upserted element {} in {}", element_id, collection);
     return element_id;
 }
 
+std::vector<int64_t> Database::upsert_elements(const std::string& collection, std::span<const Element> elements) {
+    const auto timer = impl_->time_operation("upsert_elements");
+    impl_->logger->debug("Upserting {} elements in collection: {}", elements.size(), collection);
+    impl_->require_collection(collection, "upsert elements");
+
+    std::vector<int64_t> ids;
+    ids.reserve(elements.size());
+    if (elements.empty()) {
+        return ids;
+    }
+
+    Impl::TransactionGuard txn(*impl_);
+    for (const auto& element : elements) {
+        ids.push_back(upsert_row(collection, element));
+    }
+    txn.commit();
+
+    impl_->logger->info("Upserted {} elements in {}", ids.size(), collection);
+    return ids;
+}
+
 void Database::update_element(const std::string& collection, int64_t id, const Element& element) {
+    const auto timer = impl_->time_operation("update_element");
     impl_->logger->debug("Updating element {} in collection: {}", id, collection);
     impl_->require_collection(collection, "update element");
 
@@ -761,20 +3132,12 @@ void Database::update_element(const std::string& collection, int64_t id, const E
             // Not a vector table, try set
         }
 
+        std::optional<ArrayValues> resolved;
         if (found_vector) {
-            // Delete existing vector data
-            auto delete_sql = "DELETE FROM " + vector_table + " WHERE id = ?";
-            execute(delete_sql, {id});
-
-            // Insert new vector data
-            for (size_t i = 0; i < values.size(); ++i) {
-                auto insert_sql =
-                    "INSERT INTO " + vector_table + " (id, vector_index, " + attr_name + ") VALUES (?, ?, ?)";
-                int64_t vector_index = static_cast<int64_t>(i + 1);
-                execute(insert_sql, {id, vector_index, values[i]});
-            }
+            std::visit([&](const auto& typed) { impl_->replace_vector_rows(vector_table, attr_name, id, typed); },
+                       impl_->resolve_array(vector_table, attr_name, values, resolved));
             impl_->logger->debug(
-                "Updated vector {}.{} for id {} with {} values", collection, attr_name, id, values.size());
+                "Updated vector {}.{} for id {} with {} values", collection, attr_name, id, array_size(values));
             continue;
         }
 
@@ -787,16 +3150,11 @@ void Database::update_element(const std::string& collection, int64_t id, const E
                                      collection + "'");
         }
 
-        // Delete existing set data
-        auto delete_sql = "DELETE FROM " + set_table + " WHERE id = ?";
-        execute(delete_sql, {id});
-
-        // Insert new set data
-        for (const auto& value : values) {
-            auto insert_sql = "INSERT INTO " + set_table + " (id, " + attr_name + ") VALUES (?, ?)";
-            execute(insert_sql, {id, value});
-        }
-        impl_->logger->debug("Updated set {}.{} for id {} with {} values", collection, attr_name, id, values.size());
+        // Foreign key columns take labels, resolved the same way create_element does
+        std::visit([&](const auto& typed) { impl_->replace_set_rows(set_table, attr_name, id, typed); },
+                   impl_->resolve_array(set_table, attr_name, values, resolved));
+        impl_->logger->debug(
+            "Updated set {}.{} for id {} with {} values", collection, attr_name, id, array_size(values));
     }
 
     txn.commit();
@@ -804,51 +3162,60 @@ void Database::update_element(const std::string& collection, int64_t id, const E
 }
 
 void Database::delete_element_by_id(const std::string& collection, int64_t id) {
+    const auto timer = impl_->time_operation("delete_element_by_id");
     impl_->logger->debug("Deleting element {} from collection: {}", id, collection);
     impl_->require_collection(collection, "delete element");
 
     auto sql = "DELETE FROM " + collection + " WHERE id = ?";
     execute(sql, {id});
 
-    impl_->logger->info("Deleted element {} from {}", id, collection);
+    impl_->logger->info("Deleted element {} from {}", id, collection);
+}
+
+size_t Database::delete_elements_by_ids(const std::string& collection, std::span<const int64_t> ids) {
+    const auto timer = impl_->time_operation("delete_elements_by_ids");
+    impl_->logger->debug("Deleting {} elements from collection: {}", ids.size(), collection);
+    impl_->require_collection(collection, "delete elements");
+    if (ids.empty()) {
+        return 0;
+    }
+
+    std::vector<Value> params;
+    const auto clause = impl_->filter_clause(collection, Filter{}.id_in({ids.begin(), ids.end()}), params);
+    const auto deleted = impl_->delete_elements(collection, clause, params);
+
+    impl_->logger->info("Deleted {} elements from {}", deleted, collection);
+    return deleted;
+}
+
+size_t Database::delete_elements_where(const std::string& collection, const Filter& filter) {
+    const auto timer = impl_->time_operation("delete_elements_where");
+    impl_->logger->debug("Deleting filtered elements from collection: {}", collection);
+    impl_->require_collection(collection, "delete elements");
+
+    std::vector<Value> params;
+    const auto clause = impl_->filter_clause(collection, filter, params);
+    const auto deleted = impl_->delete_elements(collection, clause, params);
+
+    impl_->logger->info("Deleted {} elements from {}", deleted, collection);
+    return deleted;
 }
 
 void Database::set_scalar_relation(const std::string& collection,
                                    const std::string& attribute,
                                    const std::string& from_label,
                                    const std::string& to_label) {
+    const auto timer = impl_->time_operation("set_scalar_relation");
     impl_->logger->debug("Setting relation {}.{} from '{}' to '{}'", collection, attribute, from_label, to_label);
 
-    if (!impl_->schema) {
-        throw std::runtime_error("Cannot set relation: no schema loaded");
-    }
-
-    const auto* table_def = impl_->schema->get_table(collection);
-    if (!table_def) {
-        throw std::runtime_error("Collection not found in schema: " + collection);
-    }
-
-    // Find the foreign key with the given attribute name
-    std::string to_table;
-    for (const auto& fk : table_def->foreign_keys) {
-        if (fk.from_column == attribute) {
-            to_table = fk.to_table;
-            break;
-        }
-    }
-
-    if (to_table.empty()) {
-        throw std::runtime_error("Attribute '" + attribute + "' is not a foreign key in collection '" + collection +
-                                 "'");
-    }
+    const auto& to_table = impl_->relation_target(collection, attribute, "set");
 
     // Look up the target ID by label
-    auto lookup_sql = "SELECT id FROM " + to_table + " WHERE label = ?";
-    auto lookup_result = execute(lookup_sql, {to_label});
-    if (lookup_result.empty() || !lookup_result[0].get_integer(0)) {
+    auto resolved = impl_->resolve_labels(to_table, {to_label}).front();
+    if (!resolved) {
         throw std::runtime_error("Target element with label '" + to_label + "' not found in '" + to_table + "'");
     }
-    auto to_id = lookup_result[0].get_integer(0).value();
+    auto to_id = *resolved;
 
     // Update the source element
     auto update_sql = "UPDATE " + collection + " SET " + attribute + " = ? WHERE label = ?";
@@ -858,256 +3225,900 @@ void Database::set_scalar_relation(const std::string& collection,
         "Set relation {}.{} for '{}' to '{}' (id: {})", collection, attribute, from_label, to_label, to_id);
 }
 
-std::vector<std::string> Database::read_scalar_relation(const std::string& collection, const std::string& attribute) {
-    if (!impl_->schema) {
-        throw std::runtime_error("Cannot read relation: no schema loaded");
+void Database::set_scalar_relations(const std::string& collection,
+                                    const std::string& attribute,
+                                    const std::vector<std::string>& from_labels,
+                                    const std::vector<std::string>& to_labels) {
+    const auto timer = impl_->time_operation("set_scalar_relations");
+    impl_->logger->debug("Setting {} relations {}.{}", from_labels.size(), collection, attribute);
+    const auto& to_table = impl_->relation_target(collection, attribute, "set");
+    if (from_labels.size() != to_labels.size()) {
+        throw std::runtime_error("Relation label lists must have the same length: got " +
+                                 std::to_string(from_labels.size()) + " source and " +
+                                 std::to_string(to_labels.size()) + " target labels");
     }
-
-    const auto* table_def = impl_->schema->get_table(collection);
-    if (!table_def) {
-        throw std::runtime_error("Collection not found in schema: " + collection);
+    if (from_labels.empty()) {
+        return;
     }
 
-    // Find the foreign key with the given attribute name
-    std::string to_table;
-    for (const auto& fk : table_def->foreign_keys) {
-        if (fk.from_column == attribute) {
-            to_table = fk.to_table;
-            break;
-        }
-    }
+    Impl::TransactionGuard txn(*impl_);
 
-    if (to_table.empty()) {
-        throw std::runtime_error("Attribute '" + attribute + "' is not a foreign key in collection '" + collection +
-                                 "'");
+    // Stage the pairs in a temp table so lookup and update are each one set-based statement
+    execute("CREATE TEMP TABLE IF NOT EXISTS quiver_relation_pairs (from_label TEXT NOT NULL, to_label TEXT NOT NULL)");
+    execute("CREATE INDEX IF NOT EXISTS temp.quiver_relation_pairs_from ON quiver_relation_pairs (from_label)");
+    execute("DELETE FROM temp.quiver_relation_pairs");
+    impl_->insert_rows("temp.quiver_relation_pairs",
+                       {"from_label", "to_label"},
+                       from_labels.size(),
+                       [&](sqlite3_stmt* stmt, size_t row, int first) {
+                           bind_value(stmt, first, from_labels[row]);
+                           bind_value(stmt, first + 1, to_labels[row]);
+                       });
+
+    auto missing = impl_->prepare("SELECT p.to_label FROM temp.quiver_relation_pairs p LEFT JOIN " + to_table +
+                                  " t ON t.label = p.to_label WHERE t.id IS NULL LIMIT 1");
+    if (auto to_label = read_first_value<std::string>(missing.get())) {
+        throw std::runtime_error("Target element with label '" + *to_label + "' not found in '" + to_table + "'");
     }
 
+    // A source label listed twice takes its last target, as repeated set_scalar_relation calls would
+    execute("UPDATE " + collection + " SET " + attribute + " = (SELECT t.id FROM temp.quiver_relation_pairs p JOIN " +
+            to_table + " t ON t.label = p.to_label WHERE p.from_label = " + collection +
+            ".label ORDER BY p.rowid DESC LIMIT 1) WHERE label IN (SELECT from_label FROM temp.quiver_relation_pairs)");
+    execute("DELETE FROM temp.quiver_relation_pairs");
+
+    txn.commit();
+    impl_->logger->info("Set {} relations {}.{}", from_labels.size(), collection, attribute);
+}
+
+std::vector<std::string> Database::read_scalar_relation(const std::string& collection, const std::string& attribute) {
+    const auto timer = impl_->time_operation("read_scalar_relation");
+    const auto& to_table = impl_->relation_target(collection, attribute, "read");
+
     // LEFT JOIN to get target labels (NULL for unset relations)
     auto sql = "SELECT t.label FROM " + collection + " c LEFT JOIN " + to_table + " t ON c." + attribute + " = t.id";
-    auto result = execute(sql);
+    auto stmt = impl_->prepare(sql);
 
-    std::vector<std::string> labels;
-    labels.reserve(result.row_count());
-    for (size_t i = 0; i < result.row_count(); ++i) {
-        auto val = result[i].get_string(0);
-        labels.push_back(val.value_or(""));
-    }
-    return labels;
+    // Unset relations read as NULL and map to empty labels
+    return read_typed_column<std::string>(stmt.get()).values;
 }
 
-std::vector<int64_t> Database::read_scalar_integers(const std::string& collection, const std::string& attribute) {
-    auto sql = "SELECT " + attribute + " FROM " + collection;
-    auto result = execute(sql);
+std::vector<int64_t> Database::read_scalar_relation_ids(const std::string& collection, const std::string& attribute) {
+    const auto timer = impl_->time_operation("read_scalar_relation_ids");
+    impl_->relation_target(collection, attribute, "read");
+
+    // Same rows as read_scalar_relation, without the join; unset relations read as 0
+    auto stmt = impl_->prepare("SELECT " + attribute + " FROM " + collection);
+    return read_typed_column<int64_t>(stmt.get()).values;
+}
+
+NullableColumn<int64_t> Database::read_scalar_integers_nullable(const std::string& collection,
+                                                                const std::string& attribute) {
+    const auto timer = impl_->time_operation("read_scalar_integers_nullable");
+    // Same row order as read_element_ids
+    auto stmt = impl_->prepare("SELECT " + attribute + " FROM " + collection + " ORDER BY rowid");
+    return read_nullable_column<int64_t>(stmt.get());
+}
+
+NullableColumn<double> Database::read_scalar_floats_nullable(const std::string& collection,
+                                                             const std::string& attribute) {
+    const auto timer = impl_->time_operation("read_scalar_floats_nullable");
+    auto stmt = impl_->prepare("SELECT " + attribute + " FROM " + collection + " ORDER BY rowid");
+    return read_nullable_column<double>(stmt.get());
+}
+
+NullableColumn<std::string> Database::read_scalar_strings_nullable(const std::string& collection,
+                                                                   const std::string& attribute) {
+    const auto timer = impl_->time_operation("read_scalar_strings_nullable");
+    auto stmt = impl_->prepare("SELECT " + attribute + " FROM " + collection + " ORDER BY rowid");
+    return read_nullable_column<std::string>(stmt.get());
+}
+
+NullableColumn<int64_t> Database::read_scalar_integers_nullable(const std::string& collection,
+                                                                const std::string& attribute,
+                                                                const Filter& filter) {
+    const auto timer = impl_->time_operation("read_scalar_integers_nullable");
+    auto stmt = impl_->prepare_filtered(attribute, collection, collection, filter, "rowid");
+    return read_nullable_column<int64_t>(stmt.get());
+}
+
+NullableColumn<double> Database::read_scalar_floats_nullable(const std::string& collection,
+                                                             const std::string& attribute,
+                                                             const Filter& filter) {
+    const auto timer = impl_->time_operation("read_scalar_floats_nullable");
+    auto stmt = impl_->prepare_filtered(attribute, collection, collection, filter, "rowid");
+    return read_nullable_column<double>(stmt.get());
+}
+
+NullableColumn<std::string> Database::read_scalar_strings_nullable(const std::string& collection,
+                                                                   const std::string& attribute,
+                                                                   const Filter& filter) {
+    const auto timer = impl_->time_operation("read_scalar_strings_nullable");
+    auto stmt = impl_->prepare_filtered(attribute, collection, collection, filter, "rowid");
+    return read_nullable_column<std::string>(stmt.get());
+}
+
+ScalarColumns Database::read_scalars(const std::string& collection, const std::vector<std::string>& attributes) {
+    const auto timer = impl_->time_operation("read_scalars");
+    impl_->require_collection(collection, "read scalars");
+    const auto* table_def = impl_->schema->get_table(collection);
+
+    ScalarColumns result;
+    result.columns.reserve(attributes.size());
+    auto sql = std::string("SELECT id");
+    for (const auto& attribute : attributes) {
+        const auto* col = table_def->get_column(attribute);
+        if (!col) {
+            throw std::runtime_error("Scalar attribute '" + attribute + "' not found in collection '" + collection +
+                                     "'");
+        }
+        auto& column = result.columns.emplace_back();
+        column.name = attribute;
+        column.type = col->type;
+        sql += ", " + attribute;
+    }
+    sql += " FROM " + collection + " ORDER BY rowid";
 
-    std::vector<int64_t> values;
-    values.reserve(result.row_count());
-    for (size_t i = 0; i < result.row_count(); ++i) {
-        auto val = result[i].get_integer(0);
-        if (val) {
-            values.push_back(*val);
+    auto handle = impl_->prepare(sql);
+    auto* stmt = handle.get();
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        result.ids.push_back(sqlite3_column_int64(stmt, 0));
+        for (size_t c = 0; c < result.columns.size(); ++c) {
+            append_scalar_value(stmt, static_cast<int>(c + 1), result.columns[c], false);
         }
     }
-    return values;
+    check_step_done(stmt, rc);
+    return result;
 }
 
-std::vector<double> Database::read_scalar_floats(const std::string& collection, const std::string& attribute) {
+template <AttributeValue T>
+std::vector<T> Database::read_scalar(const std::string& collection, const std::string& attribute) {
+    const auto* operation = typed_operation<T>("read_scalar_integers", "read_scalar_floats", "read_scalar_strings");
+    const auto timer = impl_->time_operation(operation);
     auto sql = "SELECT " + attribute + " FROM " + collection;
-    auto result = execute(sql);
+    return impl_->read_through<std::vector<T>>(collection, std::string(operation) + "|" + sql, [&] {
+        auto stmt = impl_->prepare(sql);
+        return read_non_null_column<T>(stmt.get());
+    });
+}
 
-    std::vector<double> values;
-    values.reserve(result.row_count());
-    for (size_t i = 0; i < result.row_count(); ++i) {
-        auto val = result[i].get_float(0);
-        if (val) {
-            values.push_back(*val);
-        }
-    }
-    return values;
+std::vector<int64_t> Database::read_scalar_integers(const std::string& collection, const std::string& attribute) {
+    return read_scalar<int64_t>(collection, attribute);
+}
+
+std::vector<double> Database::read_scalar_floats(const std::string& collection, const std::string& attribute) {
+    return read_scalar<double>(collection, attribute);
 }
 
 std::vector<std::string> Database::read_scalar_strings(const std::string& collection, const std::string& attribute) {
+    return read_scalar<std::string>(collection, attribute);
+}
+
+std::vector<int64_t> Database::read_scalar_integers(const std::string& collection,
+                                                    const std::string& attribute,
+                                                    const Filter& filter) {
+    const auto timer = impl_->time_operation("read_scalar_integers");
+    auto stmt = impl_->prepare_filtered(attribute, collection, collection, filter, "rowid");
+    return read_non_null_column<int64_t>(stmt.get());
+}
+
+std::vector<double> Database::read_scalar_floats(const std::string& collection,
+                                                 const std::string& attribute,
+                                                 const Filter& filter) {
+    const auto timer = impl_->time_operation("read_scalar_floats");
+    auto stmt = impl_->prepare_filtered(attribute, collection, collection, filter, "rowid");
+    return read_non_null_column<double>(stmt.get());
+}
+
+std::vector<std::string> Database::read_scalar_strings(const std::string& collection,
+                                                       const std::string& attribute,
+                                                       const Filter& filter) {
+    const auto timer = impl_->time_operation("read_scalar_strings");
+    auto stmt = impl_->prepare_filtered(attribute, collection, collection, filter, "rowid");
+    return read_non_null_column<std::string>(stmt.get());
+}
+
+size_t Database::count_scalar_values(const std::string& collection, const std::string& attribute) {
+    const auto timer = impl_->time_operation("count_scalar_values");
+    auto sql = "SELECT COUNT(" + attribute + ") FROM " + collection;
+    auto stmt = impl_->prepare(sql);
+    return static_cast<size_t>(read_first_value<int64_t>(stmt.get()).value_or(0));
+}
+
+size_t Database::read_scalar_integers_into(const std::string& collection,
+                                           const std::string& attribute,
+                                           std::span<int64_t> out) {
+    const auto timer = impl_->time_operation("read_scalar_integers_into");
     auto sql = "SELECT " + attribute + " FROM " + collection;
-    auto result = execute(sql);
+    auto stmt = impl_->prepare(sql);
+    return read_non_null_column_into(stmt.get(), out.data(), out.size());
+}
 
-    std::vector<std::string> values;
-    values.reserve(result.row_count());
-    for (size_t i = 0; i < result.row_count(); ++i) {
-        auto val = result[i].get_string(0);
-        if (val) {
-            values.push_back(*val);
-        }
-    }
-    return values;
+size_t
+Database::read_scalar_floats_into(const std::string& collection, const std::string& attribute, std::span<double> out) {
+    const auto timer = impl_->time_operation("read_scalar_floats_into");
+    auto sql = "SELECT " + attribute + " FROM " + collection;
+    auto stmt = impl_->prepare(sql);
+    return read_non_null_column_into(stmt.get(), out.data(), out.size());
 }
 
-std::optional<int64_t>
-Database::read_scalar_integers_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
+template <AttributeValue T>
+std::optional<T> Database::read_scalar_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
+    const auto* operation =
+        typed_operation<T>("read_scalar_integers_by_id", "read_scalar_floats_by_id", "read_scalar_strings_by_id");
+    const auto timer = impl_->time_operation(operation);
     auto sql = "SELECT " + attribute + " FROM " + collection + " WHERE id = ?";
-    auto result = execute(sql, {id});
+    const auto key = std::string(operation) + "|" + sql + "|" + std::to_string(id);
+    return impl_->read_through<std::optional<T>>(collection, key, [&] {
+        auto stmt = impl_->prepare(sql, {id});
+        return read_first_value<T>(stmt.get());
+    });
+}
 
-    if (result.empty()) {
-        return std::nullopt;
-    }
-    return result[0].get_integer(0);
+std::optional<int64_t>
+Database::read_scalar_integers_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
+    return read_scalar_by_id<int64_t>(collection, attribute, id);
 }
 
 std::optional<double>
 Database::read_scalar_floats_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
-    auto sql = "SELECT " + attribute + " FROM " + collection + " WHERE id = ?";
-    auto result = execute(sql, {id});
-
-    if (result.empty()) {
-        return std::nullopt;
-    }
-    return result[0].get_float(0);
+    return read_scalar_by_id<double>(collection, attribute, id);
 }
 
 std::optional<std::string>
 Database::read_scalar_strings_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
-    auto sql = "SELECT " + attribute + " FROM " + collection + " WHERE id = ?";
-    auto result = execute(sql, {id});
+    return read_scalar_by_id<std::string>(collection, attribute, id);
+}
 
-    if (result.empty()) {
-        return std::nullopt;
-    }
-    return result[0].get_string(0);
+NullableColumn<int64_t> Database::read_scalar_integers_by_ids(const std::string& collection,
+                                                              const std::string& attribute,
+                                                              std::span<const int64_t> ids) {
+    const auto timer = impl_->time_operation("read_scalar_integers_by_ids");
+    return impl_->read_scalar_by_ids<int64_t>(collection, attribute, ids);
+}
+
+NullableColumn<double> Database::read_scalar_floats_by_ids(const std::string& collection,
+                                                           const std::string& attribute,
+                                                           std::span<const int64_t> ids) {
+    const auto timer = impl_->time_operation("read_scalar_floats_by_ids");
+    return impl_->read_scalar_by_ids<double>(collection, attribute, ids);
+}
+
+NullableColumn<std::string> Database::read_scalar_strings_by_ids(const std::string& collection,
+                                                                 const std::string& attribute,
+                                                                 std::span<const int64_t> ids) {
+    const auto timer = impl_->time_operation("read_scalar_strings_by_ids");
+    return impl_->read_scalar_by_ids<std::string>(collection, attribute, ids);
+}
+
+template <AttributeValue T>
+std::vector<std::vector<T>> Database::read_vector(const std::string& collection, const std::string& attribute) {
+    const auto* operation = typed_operation<T>("read_vector_integers", "read_vector_floats", "read_vector_strings");
+    const auto timer = impl_->time_operation(operation);
+    auto vector_table = impl_->schema->find_vector_table(collection, attribute);
+    auto sql = "SELECT id, " + attribute + " FROM " + impl_->vector_source(vector_table, attribute) +
+               " ORDER BY id, vector_index";
+    return impl_->read_through<std::vector<std::vector<T>>>(vector_table, std::string(operation) + "|" + sql, [&] {
+        auto stmt = impl_->prepare(sql);
+        return read_grouped_column<T>(stmt.get());
+    });
 }
 
 std::vector<std::vector<int64_t>> Database::read_vector_integers(const std::string& collection,
                                                                  const std::string& attribute) {
-    auto vector_table = impl_->schema->find_vector_table(collection, attribute);
-    auto sql = "SELECT id, " + attribute + " FROM " + vector_table + " ORDER BY id, vector_index";
-    return read_grouped_values_all<int64_t>(execute(sql));
+    return read_vector<int64_t>(collection, attribute);
 }
 
 std::vector<std::vector<double>> Database::read_vector_floats(const std::string& collection,
                                                               const std::string& attribute) {
-    auto vector_table = impl_->schema->find_vector_table(collection, attribute);
-    auto sql = "SELECT id, " + attribute + " FROM " + vector_table + " ORDER BY id, vector_index";
-    return read_grouped_values_all<double>(execute(sql));
+    return read_vector<double>(collection, attribute);
 }
 
 std::vector<std::vector<std::string>> Database::read_vector_strings(const std::string& collection,
                                                                     const std::string& attribute) {
+    return read_vector<std::string>(collection, attribute);
+}
+
+std::vector<std::vector<int64_t>> Database::read_vector_integers(const std::string& collection,
+                                                                 const std::string& attribute,
+                                                                 const Filter& filter) {
+    const auto timer = impl_->time_operation("read_vector_integers");
+    auto source = impl_->vector_rows(collection, attribute);
+    auto stmt = impl_->prepare_filtered("id, " + attribute, source, collection, filter, "id, vector_index");
+    return read_grouped_column<int64_t>(stmt.get());
+}
+
+std::vector<std::vector<double>> Database::read_vector_floats(const std::string& collection,
+                                                              const std::string& attribute,
+                                                              const Filter& filter) {
+    const auto timer = impl_->time_operation("read_vector_floats");
+    auto source = impl_->vector_rows(collection, attribute);
+    auto stmt = impl_->prepare_filtered("id, " + attribute, source, collection, filter, "id, vector_index");
+    return read_grouped_column<double>(stmt.get());
+}
+
+std::vector<std::vector<std::string>> Database::read_vector_strings(const std::string& collection,
+                                                                    const std::string& attribute,
+                                                                    const Filter& filter) {
+    const auto timer = impl_->time_operation("read_vector_strings");
+    auto source = impl_->vector_rows(collection, attribute);
+    auto stmt = impl_->prepare_filtered("id, " + attribute, source, collection, filter, "id, vector_index");
+    return read_grouped_column<std::string>(stmt.get());
+}
+
+FlatVectors<int64_t> Database::read_vector_integers_flat(const std::string& collection, const std::string& attribute) {
+    const auto timer = impl_->time_operation("read_vector_integers_flat");
+    auto source = impl_->vector_rows(collection, attribute);
+    auto sql = "SELECT id, " + attribute + " FROM " + source + " ORDER BY id, vector_index";
+    auto stmt = impl_->prepare(sql);
+    return read_flat_grouped_column<int64_t>(stmt.get());
+}
+
+FlatVectors<double> Database::read_vector_floats_flat(const std::string& collection, const std::string& attribute) {
+    const auto timer = impl_->time_operation("read_vector_floats_flat");
+    auto source = impl_->vector_rows(collection, attribute);
+    auto sql = "SELECT id, " + attribute + " FROM " + source + " ORDER BY id, vector_index";
+    auto stmt = impl_->prepare(sql);
+    return read_flat_grouped_column<double>(stmt.get());
+}
+
+FlatVectors<std::string> Database::read_vector_strings_flat(const std::string& collection,
+                                                            const std::string& attribute) {
+    const auto timer = impl_->time_operation("read_vector_strings_flat");
+    auto source = impl_->vector_rows(collection, attribute);
+    auto sql = "SELECT id, " + attribute + " FROM " + source + " ORDER BY id, vector_index";
+    auto stmt = impl_->prepare(sql);
+    return read_flat_grouped_column<std::string>(stmt.get());
+}
+
+FlatVectors<int64_t> Database::read_vector_integers_flat(const std::string& collection,
+                                                         const std::string& attribute,
+                                                         const Filter& filter) {
+    const auto timer = impl_->time_operation("read_vector_integers_flat");
+    auto source = impl_->vector_rows(collection, attribute);
+    auto stmt = impl_->prepare_filtered("id, " + attribute, source, collection, filter, "id, vector_index");
+    return read_flat_grouped_column<int64_t>(stmt.get());
+}
+
+FlatVectors<double> Database::read_vector_floats_flat(const std::string& collection,
+                                                      const std::string& attribute,
+                                                      const Filter& filter) {
+    const auto timer = impl_->time_operation("read_vector_floats_flat");
+    auto source = impl_->vector_rows(collection, attribute);
+    auto stmt = impl_->prepare_filtered("id, " + attribute, source, collection, filter, "id, vector_index");
+    return read_flat_grouped_column<double>(stmt.get());
+}
+
+FlatVectors<std::string> Database::read_vector_strings_flat(const std::string& collection,
+                                                            const std::string& attribute,
+                                                            const Filter& filter) {
+    const auto timer = impl_->time_operation("read_vector_strings_flat");
+    auto source = impl_->vector_rows(collection, attribute);
+    auto stmt = impl_->prepare_filtered("id, " + attribute, source, collection, filter, "id, vector_index");
+    return read_flat_grouped_column<std::string>(stmt.get());
+}
+
+FlatVectors<int64_t> Database::read_vector_integers_flat(const std::string& collection,
+                                                         const std::string& attribute,
+                                                         const IdIndex& index) {
+    const auto timer = impl_->time_operation("read_vector_integers_flat");
+    auto source = impl_->vector_rows(collection, attribute);
+    auto stmt = impl_->prepare("SELECT id, " + attribute + " FROM " + source + " ORDER BY id, vector_index");
+    return read_aligned_grouped_column<int64_t>(stmt.get(), index);
+}
+
+FlatVectors<double> Database::read_vector_floats_flat(const std::string& collection,
+                                                      const std::string& attribute,
+                                                      const IdIndex& index) {
+    const auto timer = impl_->time_operation("read_vector_floats_flat");
+    auto source = impl_->vector_rows(collection, attribute);
+    auto stmt = impl_->prepare("SELECT id, " + attribute + " FROM " + source + " ORDER BY id, vector_index");
+    return read_aligned_grouped_column<double>(stmt.get(), index);
+}
+
+FlatVectors<std::string> Database::read_vector_strings_flat(const std::string& collection,
+                                                            const std::string& attribute,
+                                                            const IdIndex& index) {
+    const auto timer = impl_->time_operation("read_vector_strings_flat");
+    auto source = impl_->vector_rows(collection, attribute);
+    auto stmt = impl_->prepare("SELECT id, " + attribute + " FROM " + source + " ORDER BY id, vector_index");
+    return read_aligned_grouped_column<std::string>(stmt.get(), index);
+}
+
+template <AttributeValue T>
+std::vector<T> Database::read_vector_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
+    const auto* operation =
+        typed_operation<T>("read_vector_integers_by_id", "read_vector_floats_by_id", "read_vector_strings_by_id");
+    const auto timer = impl_->time_operation(operation);
     auto vector_table = impl_->schema->find_vector_table(collection, attribute);
-    auto sql = "SELECT id, " + attribute + " FROM " + vector_table + " ORDER BY id, vector_index";
-    return read_grouped_values_all<std::string>(execute(sql));
+    auto sql = "SELECT " + attribute + " FROM " + impl_->vector_source(vector_table, attribute) +
+               " WHERE id = ? ORDER BY vector_index";
+    const auto key = std::string(operation) + "|" + sql + "|" + std::to_string(id);
+    return impl_->read_through<std::vector<T>>(vector_table, key, [&] {
+        auto stmt = impl_->prepare(sql, {id});
+        return read_non_null_column<T>(stmt.get());
+    });
 }
 
 std::vector<int64_t>
 Database::read_vector_integers_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
-    auto vector_table = impl_->schema->find_vector_table(collection, attribute);
-    auto sql = "SELECT " + attribute + " FROM " + vector_table + " WHERE id = ? ORDER BY vector_index";
-    return read_grouped_values_by_id<int64_t>(execute(sql, {id}));
+    return read_vector_by_id<int64_t>(collection, attribute, id);
 }
 
 std::vector<double>
 Database::read_vector_floats_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
-    auto vector_table = impl_->schema->find_vector_table(collection, attribute);
-    auto sql = "SELECT " + attribute + " FROM " + vector_table + " WHERE id = ? ORDER BY vector_index";
-    return read_grouped_values_by_id<double>(execute(sql, {id}));
+    return read_vector_by_id<double>(collection, attribute, id);
 }
 
 std::vector<std::string>
 Database::read_vector_strings_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
+    return read_vector_by_id<std::string>(collection, attribute, id);
+}
+
+std::vector<double> Database::read_vector_floats_range(
+    const std::string& collection, const std::string& attribute, int64_t id, int64_t first, int64_t count) {
+    const auto timer = impl_->time_operation("read_vector_floats_range");
+    if (first < 0 || count < 0) {
+        throw std::runtime_error("Vector range must have non-negative first and count");
+    }
     auto vector_table = impl_->schema->find_vector_table(collection, attribute);
-    auto sql = "SELECT " + attribute + " FROM " + vector_table + " WHERE id = ? ORDER BY vector_index";
-    return read_grouped_values_by_id<std::string>(execute(sql, {id}));
+    if (!impl_->schema->is_packed_vector_table(vector_table)) {
+        auto stmt = impl_->prepare("SELECT " + attribute + " FROM " + vector_table +
+                                       " WHERE id = ? AND vector_index > ? AND vector_index <= ? ORDER BY vector_index",
+                                   {id, first, first + count});
+        return read_non_null_column<double>(stmt.get());
+    }
+
+    // A missing row or NULL vector cannot be opened; both read as empty
+    sqlite3_blob* blob = nullptr;
+    if (sqlite3_blob_open(impl_->db, "main", vector_table.c_str(), attribute.c_str(), id, 0, &blob) != SQLITE_OK) {
+        sqlite3_blob_close(blob);
+        return {};
+    }
+    const auto size = static_cast<int64_t>(packed_vector::kValueSize);
+    const auto stored = sqlite3_blob_bytes(blob) / size;
+    const auto length = std::max<int64_t>(0, std::min(count, stored - first));
+    std::vector<unsigned char> bytes(static_cast<size_t>(length * size));
+    const auto rc = length > 0 ? sqlite3_blob_read(blob, bytes.data(), static_cast<int>(bytes.size()),
+                                                   static_cast<int>(first * size))
+                               : SQLITE_OK;
+    sqlite3_blob_close(blob);
+    if (rc != SQLITE_OK) {
+        throw std::runtime_error("Failed to read packed vector: " + std::string(sqlite3_errmsg(impl_->db)));
+    }
+    return packed_vector::decode(bytes.data(), bytes.size());
 }
 
-std::vector<std::vector<int64_t>> Database::read_set_integers(const std::string& collection,
-                                                              const std::string& attribute) {
+FlatVectors<int64_t> Database::read_vector_integers_by_ids(const std::string& collection,
+                                                           const std::string& attribute,
+                                                           std::span<const int64_t> ids) {
+    const auto timer = impl_->time_operation("read_vector_integers_by_ids");
+    auto source = impl_->vector_rows(collection, attribute);
+    return impl_->read_groups_by_ids<int64_t>(source, attribute, ids, ", vector_index");
+}
+
+FlatVectors<double> Database::read_vector_floats_by_ids(const std::string& collection,
+                                                        const std::string& attribute,
+                                                        std::span<const int64_t> ids) {
+    const auto timer = impl_->time_operation("read_vector_floats_by_ids");
+    auto source = impl_->vector_rows(collection, attribute);
+    return impl_->read_groups_by_ids<double>(source, attribute, ids, ", vector_index");
+}
+
+FlatVectors<std::string> Database::read_vector_strings_by_ids(const std::string& collection,
+                                                              const std::string& attribute,
+                                                              std::span<const int64_t> ids) {
+    const auto timer = impl_->time_operation("read_vector_strings_by_ids");
+    auto source = impl_->vector_rows(collection, attribute);
+    return impl_->read_groups_by_ids<std::string>(source, attribute, ids, ", vector_index");
+}
+
+template <AttributeValue T>
+std::vector<std::vector<T>> Database::read_set(const std::string& collection, const std::string& attribute) {
+    const auto* operation = typed_operation<T>("read_set_integers", "read_set_floats", "read_set_strings");
+    const auto timer = impl_->time_operation(operation);
     auto set_table = impl_->schema->find_set_table(collection, attribute);
     auto sql = "SELECT id, " + attribute + " FROM " + set_table + " ORDER BY id";
-    return read_grouped_values_all<int64_t>(execute(sql));
+    return impl_->read_through<std::vector<std::vector<T>>>(set_table, std::string(operation) + "|" + sql, [&] {
+        auto stmt = impl_->prepare(sql);
+        return read_grouped_column<T>(stmt.get());
+    });
+}
+
+std::vector<std::vector<int64_t>> Database::read_set_integers(const std::string& collection,
+                                                              const std::string& attribute) {
+    return read_set<int64_t>(collection, attribute);
 }
 
 std::vector<std::vector<double>> Database::read_set_floats(const std::string& collection,
                                                            const std::string& attribute) {
+    return read_set<double>(collection, attribute);
+}
+
+std::vector<std::vector<std::string>> Database::read_set_strings(const std::string& collection,
+                                                                 const std::string& attribute) {
+    return read_set<std::string>(collection, attribute);
+}
+
+std::vector<std::vector<int64_t>> Database::read_set_integers(const std::string& collection,
+                                                              const std::string& attribute,
+                                                              const Filter& filter) {
+    const auto timer = impl_->time_operation("read_set_integers");
+    auto set_table = impl_->schema->find_set_table(collection, attribute);
+    auto stmt = impl_->prepare_filtered("id, " + attribute, set_table, collection, filter, "id");
+    return read_grouped_column<int64_t>(stmt.get());
+}
+
+std::vector<std::vector<double>> Database::read_set_floats(const std::string& collection,
+                                                           const std::string& attribute,
+                                                           const Filter& filter) {
+    const auto timer = impl_->time_operation("read_set_floats");
+    auto set_table = impl_->schema->find_set_table(collection, attribute);
+    auto stmt = impl_->prepare_filtered("id, " + attribute, set_table, collection, filter, "id");
+    return read_grouped_column<double>(stmt.get());
+}
+
+std::vector<std::vector<std::string>> Database::read_set_strings(const std::string& collection,
+                                                                 const std::string& attribute,
+                                                                 const Filter& filter) {
+    const auto timer = impl_->time_operation("read_set_strings");
+    auto set_table = impl_->schema->find_set_table(collection, attribute);
+    auto stmt = impl_->prepare_filtered("id, " + attribute, set_table, collection, filter, "id");
+    return read_grouped_column<std::string>(stmt.get());
+}
+
+FlatVectors<int64_t> Database::read_set_integers_flat(const std::string& collection, const std::string& attribute) {
+    const auto timer = impl_->time_operation("read_set_integers_flat");
+    auto set_table = impl_->schema->find_set_table(collection, attribute);
+    auto sql = "SELECT id, " + attribute + " FROM " + set_table + " ORDER BY id";
+    auto stmt = impl_->prepare(sql);
+    return read_flat_grouped_column<int64_t>(stmt.get());
+}
+
+FlatVectors<double> Database::read_set_floats_flat(const std::string& collection, const std::string& attribute) {
+    const auto timer = impl_->time_operation("read_set_floats_flat");
+    auto set_table = impl_->schema->find_set_table(collection, attribute);
+    auto sql = "SELECT id, " + attribute + " FROM " + set_table + " ORDER BY id";
+    auto stmt = impl_->prepare(sql);
+    return read_flat_grouped_column<double>(stmt.get());
+}
+
+FlatVectors<std::string> Database::read_set_strings_flat(const std::string& collection, const std::string& attribute) {
+    const auto timer = impl_->time_operation("read_set_strings_flat");
     auto set_table = impl_->schema->find_set_table(collection, attribute);
     auto sql = "SELECT id, " + attribute + " FROM " + set_table + " ORDER BY id";
-    return read_grouped_values_all<double>(execute(sql));
+    auto stmt = impl_->prepare(sql);
+    return read_flat_grouped_column<std::string>(stmt.get());
+}
+
+StringArena
+Database::read_scalar_strings_arena(const std::string& collection, const std::string& attribute, bool intern) {
+    const auto timer = impl_->time_operation("read_scalar_strings_arena");
+    auto stmt = impl_->prepare("SELECT " + attribute + " FROM " + collection);
+    return read_string_arena(stmt.get(), intern, false);
+}
+
+StringArena
+Database::read_scalar_relation_arena(const std::string& collection, const std::string& attribute, bool intern) {
+    const auto timer = impl_->time_operation("read_scalar_relation_arena");
+    const auto& to_table = impl_->relation_target(collection, attribute, "read");
+    auto sql = "SELECT t.label FROM " + collection + " c LEFT JOIN " + to_table + " t ON c." + attribute + " = t.id";
+    auto stmt = impl_->prepare(sql);
+    return read_string_arena(stmt.get(), intern, true);
+}
+
+FlatStrings
+Database::read_vector_strings_arena(const std::string& collection, const std::string& attribute, bool intern) {
+    const auto timer = impl_->time_operation("read_vector_strings_arena");
+    auto source = impl_->vector_rows(collection, attribute);
+    auto stmt = impl_->prepare("SELECT id, " + attribute + " FROM " + source + " ORDER BY id, vector_index");
+    return read_flat_grouped_strings(stmt.get(), intern);
+}
+
+FlatStrings
+Database::read_set_strings_arena(const std::string& collection, const std::string& attribute, bool intern) {
+    const auto timer = impl_->time_operation("read_set_strings_arena");
+    auto set_table = impl_->schema->find_set_table(collection, attribute);
+    auto stmt = impl_->prepare("SELECT id, " + attribute + " FROM " + set_table + " ORDER BY id");
+    return read_flat_grouped_strings(stmt.get(), intern);
+}
+
+FlatVectors<int64_t> Database::read_set_integers_flat(const std::string& collection,
+                                                      const std::string& attribute,
+                                                      const Filter& filter) {
+    const auto timer = impl_->time_operation("read_set_integers_flat");
+    auto set_table = impl_->schema->find_set_table(collection, attribute);
+    auto stmt = impl_->prepare_filtered("id, " + attribute, set_table, collection, filter, "id");
+    return read_flat_grouped_column<int64_t>(stmt.get());
+}
+
+FlatVectors<double> Database::read_set_floats_flat(const std::string& collection,
+                                                   const std::string& attribute,
+                                                   const Filter& filter) {
+    const auto timer = impl_->time_operation("read_set_floats_flat");
+    auto set_table = impl_->schema->find_set_table(collection, attribute);
+    auto stmt = impl_->prepare_filtered("id, " + attribute, set_table, collection, filter, "id");
+    return read_flat_grouped_column<double>(stmt.get());
+}
+
+FlatVectors<std::string> Database::read_set_strings_flat(const std::string& collection,
+                                                         const std::string& attribute,
+                                                         const Filter& filter) {
+    const auto timer = impl_->time_operation("read_set_strings_flat");
+    auto set_table = impl_->schema->find_set_table(collection, attribute);
+    auto stmt = impl_->prepare_filtered("id, " + attribute, set_table, collection, filter, "id");
+    return read_flat_grouped_column<std::string>(stmt.get());
+}
+
+FlatVectors<int64_t> Database::read_set_integers_flat(const std::string& collection,
+                                                      const std::string& attribute,
+                                                      const IdIndex& index) {
+    const auto timer = impl_->time_operation("read_set_integers_flat");
+    auto set_table = impl_->schema->find_set_table(collection, attribute);
+    auto stmt = impl_->prepare("SELECT id, " + attribute + " FROM " + set_table + " ORDER BY id");
+    return read_aligned_grouped_column<int64_t>(stmt.get(), index);
+}
+
+FlatVectors<double> Database::read_set_floats_flat(const std::string& collection,
+                                                   const std::string& attribute,
+                                                   const IdIndex& index) {
+    const auto timer = impl_->time_operation("read_set_floats_flat");
+    auto set_table = impl_->schema->find_set_table(collection, attribute);
+    auto stmt = impl_->prepare("SELECT id, " + attribute + " FROM " + set_table + " ORDER BY id");
+    return read_aligned_grouped_column<double>(stmt.get(), index);
+}
+
+FlatVectors<std::string> Database::read_set_strings_flat(const std::string& collection,
+                                                         const std::string& attribute,
+                                                         const IdIndex& index) {
+    const auto timer = impl_->time_operation("read_set_strings_flat");
+    auto set_table = impl_->schema->find_set_table(collection, attribute);
+    auto stmt = impl_->prepare("SELECT id, " + attribute + " FROM " + set_table + " ORDER BY id");
+    return read_aligned_grouped_column<std::string>(stmt.get(), index);
+}
+
+template <AttributeValue T>
+std::vector<T> Database::read_set_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
+    const auto* operation =
+        typed_operation<T>("read_set_integers_by_id", "read_set_floats_by_id", "read_set_strings_by_id");
+    const auto timer = impl_->time_operation(operation);
+    auto set_table = impl_->schema->find_set_table(collection, attribute);
+    auto sql = "SELECT " + attribute + " FROM " + set_table + " WHERE id = ?";
+    const auto key = std::string(operation) + "|" + sql + "|" + std::to_string(id);
+    return impl_->read_through<std::vector<T>>(set_table, key, [&] {
+        auto stmt = impl_->prepare(sql, {id});
+        return read_non_null_column<T>(stmt.get());
+    });
+}
+
+std::vector<int64_t>
+Database::read_set_integers_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
+    return read_set_by_id<int64_t>(collection, attribute, id);
+}
+
+std::vector<double>
+Database::read_set_floats_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
+    return read_set_by_id<double>(collection, attribute, id);
+}
+
+std::vector<std::string>
+Database::read_set_strings_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
+    return read_set_by_id<std::string>(collection, attribute, id);
+}
+
+FlatVectors<int64_t> Database::read_set_integers_by_ids(const std::string& collection,
+                                                        const std::string& attribute,
+                                                        std::span<const int64_t> ids) {
+    const auto timer = impl_->time_operation("read_set_integers_by_ids");
+    auto set_table = impl_->schema->find_set_table(collection, attribute);
+    return impl_->read_groups_by_ids<int64_t>(set_table, attribute, ids, "");
+}
+
+FlatVectors<double> Database::read_set_floats_by_ids(const std::string& collection,
+                                                     const std::string& attribute,
+                                                     std::span<const int64_t> ids) {
+    const auto timer = impl_->time_operation("read_set_floats_by_ids");
+    auto set_table = impl_->schema->find_set_table(collection, attribute);
+    return impl_->read_groups_by_ids<double>(set_table, attribute, ids, "");
+}
+
+FlatVectors<std::string> Database::read_set_strings_by_ids(const std::string& collection,
+                                                           const std::string& attribute,
+                                                           std::span<const int64_t> ids) {
+    const auto timer = impl_->time_operation("read_set_strings_by_ids");
+    auto set_table = impl_->schema->find_set_table(collection, attribute);
+    return impl_->read_groups_by_ids<std::string>(set_table, attribute, ids, "");
+}
+
+TimeSeries<double> Database::read_time_series_floats(const std::string& collection,
+                                                     const std::string& attribute,
+                                                     int64_t id,
+                                                     const std::optional<std::string>& date_time_from,
+                                                     const std::optional<std::string>& date_time_to) {
+    const auto timer = impl_->time_operation("read_time_series_floats");
+    auto route = impl_->route_time_series(collection, attribute);
+    if (route.location->column->type != DataType::Real) {
+        throw std::runtime_error("Time series attribute '" + attribute + "' is not a float column");
+    }
+
+    if (impl_->schema->is_compressed_time_series_table(route.location->table)) {
+        return impl_->read_compressed_time_series(route, attribute, id, date_time_from, date_time_to);
+    }
+
+    auto sql = "SELECT date_time, " + attribute + " FROM " + route.location->table + " WHERE " + route.id_column +
+               " = ?";
+    std::vector<Value> params{id};
+    if (date_time_from) {
+        sql += " AND date_time >= ?";
+        params.emplace_back(*date_time_from);
+    }
+    if (date_time_to) {
+        sql += " AND date_time <= ?";
+        params.emplace_back(*date_time_to);
+    }
+    sql += " ORDER BY date_time";
+
+    auto stmt = impl_->prepare(sql, params);
+    return read_time_series_column<double>(stmt.get(), std::numeric_limits<double>::quiet_NaN());
+}
+
+Aggregates Database::aggregate_vector(const std::string& collection,
+                                      const std::string& attribute,
+                                      const std::vector<Aggregate>& statistics) {
+    const auto timer = impl_->time_operation("aggregate_vector");
+    auto vector_table = impl_->schema->find_vector_table(collection, attribute);
+    const auto type = impl_->schema->get_table(vector_table)->columns.at(attribute).type;
+    if (type != DataType::Integer && type != DataType::Real) {
+        throw std::runtime_error("Vector attribute '" + attribute + "' is not numeric");
+    }
+
+    // LEFT JOIN so elements without values get a row too; grouping walks the (id, vector_index) key in order
+    auto sql = "SELECT c.id" + aggregate_columns(statistics, "v." + attribute) + " FROM " + collection +
+               " c LEFT JOIN " + impl_->vector_source(vector_table, attribute) +
+               " v ON v.id = c.id GROUP BY c.id ORDER BY c.id";
+    return impl_->read_aggregates(sql, statistics, false);
+}
+
+Aggregates Database::aggregate_time_series(const std::string& collection,
+                                           const std::string& attribute,
+                                           TimeBucket bucket,
+                                           const std::vector<Aggregate>& statistics) {
+    const auto timer = impl_->time_operation("aggregate_time_series");
+    auto route = impl_->route_time_series(collection, attribute);
+    const auto type = route.location->column->type;
+    if (type != DataType::Integer && type != DataType::Real) {
+        throw std::runtime_error("Time series attribute '" + attribute + "' is not numeric");
+    }
+
+    // Buckets are date_time prefixes ("YYYY-MM-DD HH..."), so they sort and group like the timestamps
+    int length = 4;
+    switch (bucket) {
+    case TimeBucket::year:
+        length = 4;
+        break;
+    case TimeBucket::month:
+        length = 7;
+        break;
+    case TimeBucket::day:
+        length = 10;
+        break;
+    case TimeBucket::hour:
+        length = 13;
+        break;
+    }
+    auto sql = "SELECT " + route.id_column + ", substr(date_time, 1, " + std::to_string(length) + ")" +
+               aggregate_columns(statistics, attribute) + " FROM " + impl_->time_series_source(route, attribute) +
+               " GROUP BY 1, 2 ORDER BY 1, 2";
+    return impl_->read_aggregates(sql, statistics, true);
+}
+
+std::vector<int64_t> Database::read_element_ids(const std::string& collection) {
+    const auto timer = impl_->time_operation("read_element_ids");
+    auto sql = "SELECT id FROM " + collection + " ORDER BY rowid";
+    auto stmt = impl_->prepare(sql);
+    return read_non_null_column<int64_t>(stmt.get());
 }
 
-std::vector<std::vector<std::string>> Database::read_set_strings(const std::string& collection,
-                                                                 const std::string& attribute) {
-    auto set_table = impl_->schema->find_set_table(collection, attribute);
-    auto sql = "SELECT id, " + attribute + " FROM " + set_table + " ORDER BY id";
-    return read_grouped_values_all<std::string>(execute(sql));
+std::vector<int64_t> Database::read_element_ids(const std::string& collection, const Filter& filter) {
+    const auto timer = impl_->time_operation("read_element_ids");
+    auto stmt = impl_->prepare_filtered("id", collection, collection, filter, "rowid");
+    return read_non_null_column<int64_t>(stmt.get());
 }
 
-std::vector<int64_t>
-Database::read_set_integers_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
-    auto set_table = impl_->schema->find_set_table(collection, attribute);
-    auto sql = "SELECT " + attribute + " FROM " + set_table + " WHERE id = ?";
-    return read_grouped_values_by_id<int64_t>(execute(sql, {id}));
+Element Database::read_element(const std::string& collection, int64_t id) {
+    const auto timer = impl_->time_operation("read_element");
+    return std::move(impl_->read_elements(collection, std::span<const int64_t>(&id, 1)).front());
 }
 
-std::vector<double>
-Database::read_set_floats_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
-    auto set_table = impl_->schema->find_set_table(collection, attribute);
-    auto sql = "SELECT " + attribute + " FROM " + set_table + " WHERE id = ?";
-    return read_grouped_values_by_id<double>(execute(sql, {id}));
+std::vector<Element> Database::read_elements(const std::string& collection, std::span<const int64_t> ids) {
+    const auto timer = impl_->time_operation("read_elements");
+    return impl_->read_elements(collection, ids);
 }
 
-std::vector<std::string>
-Database::read_set_strings_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
-    auto set_table = impl_->schema->find_set_table(collection, attribute);
-    auto sql = "SELECT " + attribute + " FROM " + set_table + " WHERE id = ?";
-    return read_grouped_values_by_id<std::string>(execute(sql, {id}));
+IdIndex Database::read_id_index(const std::string& collection) {
+    const auto timer = impl_->time_operation("read_id_index");
+    auto stmt = impl_->prepare("SELECT id FROM " + collection + " ORDER BY rowid");
+    return IdIndex(read_non_null_column<int64_t>(stmt.get()));
 }
 
-std::vector<int64_t> Database::read_element_ids(const std::string& collection) {
-    auto sql = "SELECT id FROM " + collection + " ORDER BY rowid";
-    return read_grouped_values_by_id<int64_t>(execute(sql));
+template <AttributeValue T>
+void Database::update_scalar(const std::string& collection, const std::string& attribute, int64_t id, const T& value) {
+    const auto timer = impl_->time_operation(
+        typed_operation<T>("update_scalar_integer", "update_scalar_float", "update_scalar_string"));
+    if constexpr (std::is_same_v<T, std::string>) {
+        impl_->logger->debug("Updating {}.{} for id {} to '{}'", collection, attribute, id, value);
+    } else {
+        impl_->logger->debug("Updating {}.{} for id {} to {}", collection, attribute, id, value);
+    }
+    impl_->require_collection(collection, "update scalar");
+    impl_->type_validator->validate_scalar(collection, attribute, value);
+
+    auto sql = "UPDATE " + collection + " SET " + attribute + " = ? WHERE id = ?";
+    auto stmt = impl_->prepare(sql);
+    bind_value(stmt.get(), 1, value);
+    sqlite3_bind_int64(stmt.get(), 2, id);
+    check_step_done(stmt.get(), sqlite3_step(stmt.get()));
+
+    if constexpr (std::is_same_v<T, std::string>) {
+        impl_->logger->info("Updated {}.{} for id {} to '{}'", collection, attribute, id, value);
+    } else {
+        impl_->logger->info("Updated {}.{} for id {} to {}", collection, attribute, id, value);
+    }
 }
 
 void Database::update_scalar_integer(const std::string& collection,
                                      const std::string& attribute,
                                      int64_t id,
                                      int64_t value) {
-    impl_->logger->debug("Updating {}.{} for id {} to {}", collection, attribute, id, value);
-    impl_->require_collection(collection, "update scalar");
-    impl_->type_validator->validate_scalar(collection, attribute, value);
-
-    auto sql = "UPDATE " + collection + " SET " + attribute + " = ? WHERE id = ?";
-    execute(sql, {value, id});
-
-    impl_->logger->info("Updated {}.{} for id {} to {}", collection, attribute, id, value);
+    update_scalar<int64_t>(collection, attribute, id, value);
 }
 
 void Database::update_scalar_float(const std::string& collection,
                                    const std::string& attribute,
                                    int64_t id,
                                    double value) {
-    impl_->logger->debug("Updating {}.{} for id {} to {}", collection, attribute, id, value);
-    impl_->require_collection(collection, "update scalar");
-    impl_->type_validator->validate_scalar(collection, attribute, value);
-
-    auto sql = "UPDATE " + collection + " SET " + attribute + " = ? WHERE id = ?";
-    execute(sql, {value, id});
-
-    impl_->logger->info("Updated {}.{} for id {} to {}", collection, attribute, id, value);
+    update_scalar<double>(collection, attribute, id, value);
 }
 
 void Database::update_scalar_string(const std::string& collection,
                                     const std::string& attribute,
                                     int64_t id,
                                     const std::string& value) {
-    impl_->logger->debug("Updating {}.{} for id {} to '{}'", collection, attribute, id, value);
-    impl_->require_collection(collection, "update scalar");
-    impl_->type_validator->validate_scalar(collection, attribute, value);
+    update_scalar<std::string>(collection, attribute, id, value);
+}
 
-    auto sql = "UPDATE " + collection + " SET " + attribute + " = ? WHERE id = ?";
-    execute(sql, {value, id});
+void Database::update_scalar_integers(const std::string& collection,
+                                      const std::string& attribute,
+                                      std::span<const int64_t> ids,
+                                      std::span<const int64_t> values) {
+    const auto timer = impl_->time_operation("update_scalar_integers");
+    impl_->update_scalar_rows(collection, attribute, ids, values);
+}
 
-    impl_->logger->info("Updated {}.{} for id {} to '{}'", collection, attribute, id, value);
+void Database::update_scalar_floats(const std::string& collection,
+                                    const std::string& attribute,
+                                    std::span<const int64_t> ids,
+                                    std::span<const double> values) {
+    const auto timer = impl_->time_operation("update_scalar_floats");
+    impl_->update_scalar_rows(collection, attribute, ids, values);
 }
 
-void Database::update_vector_integers(const std::string& collection,
-                                      const std::string& attribute,
-                                      int64_t id,
-                                      const std::vector<int64_t>& values) {
+void Database::update_scalar_strings(const std::string& collection,
+                                     const std::string& attribute,
+                                     std::span<const int64_t> ids,
+                                     std::span<const std::string> values) {
+    const auto timer = impl_->time_operation("update_scalar_strings");
+    impl_->update_scalar_rows(collection, attribute, ids, values);
+}
+
+template <AttributeValue T>
+void Database::update_vector(const std::string& collection,
+                             const std::string& attribute,
+                             int64_t id,
+                             const std::vector<T>& values) {
+    const auto timer = impl_->time_operation(
+        typed_operation<T>("update_vector_integers", "update_vector_floats", "update_vector_strings"));
     impl_->logger->debug("Updating vector {}.{} for id {} with {} values", collection, attribute, id, values.size());
     impl_->require_schema("update vector");
 
@@ -1115,71 +4126,91 @@ void Database::update_vector_integers(const std::string& collection,
 
     Impl::TransactionGuard txn(*impl_);
 
-    auto delete_sql = "DELETE FROM " + vector_table + " WHERE id = ?";
-    execute(delete_sql, {id});
-
-    for (size_t i = 0; i < values.size(); ++i) {
-        auto insert_sql = "INSERT INTO " + vector_table + " (id, vector_index, " + attribute + ") VALUES (?, ?, ?)";
-        int64_t vector_index = static_cast<int64_t>(i + 1);
-        execute(insert_sql, {id, vector_index, values[i]});
-    }
+    impl_->diff_vector_rows(vector_table, attribute, id, values);
 
     txn.commit();
     impl_->logger->info("Updated vector {}.{} for id {} with {} values", collection, attribute, id, values.size());
 }
 
+void Database::update_vector_integers(const std::string& collection,
+                                      const std::string& attribute,
+                                      int64_t id,
+                                      const std::vector<int64_t>& values) {
+    update_vector<int64_t>(collection, attribute, id, values);
+}
+
 void Database::update_vector_floats(const std::string& collection,
                                     const std::string& attribute,
                                     int64_t id,
                                     const std::vector<double>& values) {
-    impl_->logger->debug("Updating vector {}.{} for id {} with {} values", collection, attribute, id, values.size());
-    impl_->require_schema("update vector");
-
-    auto vector_table = impl_->schema->find_vector_table(collection, attribute);
-
-    Impl::TransactionGuard txn(*impl_);
-
-    auto delete_sql = "DELETE FROM " + vector_table + " WHERE id = ?";
-    execute(delete_sql, {id});
-
-    for (size_t i = 0; i < values.size(); ++i) {
-        auto insert_sql = "INSERT INTO " + vector_table + " (id, vector_index, " + attribute + ") VALUES (?, ?, ?)";
-        int64_t vector_index = static_cast<int64_t>(i + 1);
-        execute(insert_sql, {id, vector_index, values[i]});
-    }
-
-    txn.commit();
-    impl_->logger->info("Updated vector {}.{} for id {} with {} values", collection, attribute, id, values.size());
+    update_vector<double>(collection, attribute, id, values);
 }
 
 void Database::update_vector_strings(const std::string& collection,
                                      const std::string& attribute,
                                      int64_t id,
                                      const std::vector<std::string>& values) {
-    impl_->logger->debug("Updating vector {}.{} for id {} with {} values", collection, attribute, id, values.size());
-    impl_->require_schema("update vector");
+    update_vector<std::string>(collection, attribute, id, values);
+}
 
-    auto vector_table = impl_->schema->find_vector_table(collection, attribute);
+void Database::append_vector_integers(const std::string& collection,
+                                      const std::string& attribute,
+                                      int64_t id,
+                                      const std::vector<int64_t>& values) {
+    const auto timer = impl_->time_operation("append_vector_integers");
+    impl_->append_vector(collection, attribute, id, values);
+}
 
-    Impl::TransactionGuard txn(*impl_);
+void Database::append_vector_floats(const std::string& collection,
+                                    const std::string& attribute,
+                                    int64_t id,
+                                    const std::vector<double>& values) {
+    const auto timer = impl_->time_operation("append_vector_floats");
+    impl_->append_vector(collection, attribute, id, values);
+}
 
-    auto delete_sql = "DELETE FROM " + vector_table + " WHERE id = ?";
-    execute(delete_sql, {id});
+void Database::append_vector_strings(const std::string& collection,
+                                     const std::string& attribute,
+                                     int64_t id,
+                                     const std::vector<std::string>& values) {
+    const auto timer = impl_->time_operation("append_vector_strings");
+    impl_->append_vector(collection, attribute, id, values);
+}
 
-    for (size_t i = 0; i < values.size(); ++i) {
-        auto insert_sql = "INSERT INTO " + vector_table + " (id, vector_index, " + attribute + ") VALUES (?, ?, ?)";
-        int64_t vector_index = static_cast<int64_t>(i + 1);
-        execute(insert_sql, {id, vector_index, values[i]});
-    }
+void Database::update_vector_integer_entry(const std::string& collection,
+                                           const std::string& attribute,
+                                           int64_t id,
+                                           int64_t index,
+                                           int64_t value) {
+    const auto timer = impl_->time_operation("update_vector_integer_entry");
+    impl_->update_vector_entry(collection, attribute, id, index, value);
+}
 
-    txn.commit();
-    impl_->logger->info("Updated vector {}.{} for id {} with {} values", collection, attribute, id, values.size());
+void Database::update_vector_float_entry(const std::string& collection,
+                                         const std::string& attribute,
+                                         int64_t id,
+                                         int64_t index,
+                                         double value) {
+    const auto timer = impl_->time_operation("update_vector_float_entry");
+    impl_->update_vector_entry(collection, attribute, id, index, value);
 }
 
-void Database::update_set_integers(const std::string& collection,
-                                   const std::string& attribute,
-                                   int64_t id,
-                                   const std::vector<int64_t>& values) {
+void Database::update_vector_string_entry(const std::string& collection,
+                                          const std::string& attribute,
+                                          int64_t id,
+                                          int64_t index,
+                                          const std::string& value) {
+    const auto timer = impl_->time_operation("update_vector_string_entry");
+    impl_->update_vector_entry(collection, attribute, id, index, value);
+}
+
+template <AttributeValue T>
+void Database::update_set(const std::string& collection,
+                          const std::string& attribute,
+                          int64_t id,
+                          const std::vector<T>& values) {
+    const auto timer = impl_->time_operation(
+        typed_operation<T>("update_set_integers", "update_set_floats", "update_set_strings"));
     impl_->logger->debug("Updating set {}.{} for id {} with {} values", collection, attribute, id, values.size());
     impl_->require_schema("update set");
 
@@ -1187,65 +4218,77 @@ void Database::update_set_integers(const std::string& collection,
 
     Impl::TransactionGuard txn(*impl_);
 
-    auto delete_sql = "DELETE FROM " + set_table + " WHERE id = ?";
-    execute(delete_sql, {id});
-
-    for (const auto& value : values) {
-        auto insert_sql = "INSERT INTO " + set_table + " (id, " + attribute + ") VALUES (?, ?)";
-        execute(insert_sql, {id, value});
-    }
+    impl_->diff_set_rows(set_table, attribute, id, values);
 
     txn.commit();
     impl_->logger->info("Updated set {}.{} for id {} with {} values", collection, attribute, id, values.size());
 }
 
+void Database::update_set_integers(const std::string& collection,
+                                   const std::string& attribute,
+                                   int64_t id,
+                                   const std::vector<int64_t>& values) {
+    update_set<int64_t>(collection, attribute, id, values);
+}
+
 void Database::update_set_floats(const std::string& collection,
                                  const std::string& attribute,
                                  int64_t id,
                                  const std::vector<double>& values) {
-    impl_->logger->debug("Updating set {}.{} for id {} with {} values", collection, attribute, id, values.size());
-    impl_->require_schema("update set");
-
-    auto set_table = impl_->schema->find_set_table(collection, attribute);
-
-    Impl::TransactionGuard txn(*impl_);
-
-    auto delete_sql = "DELETE FROM " + set_table + " WHERE id = ?";
-    execute(delete_sql, {id});
-
-    for (const auto& value : values) {
-        auto insert_sql = "INSERT INTO " + set_table + " (id, " + attribute + ") VALUES (?, ?)";
-        execute(insert_sql, {id, value});
-    }
-
-    txn.commit();
-    impl_->logger->info("Updated set {}.{} for id {} with {} values", collection, attribute, id, values.size());
+    update_set<double>(collection, attribute, id, values);
 }
 
 void Database::update_set_strings(const std::string& collection,
                                   const std::string& attribute,
                                   int64_t id,
                                   const std::vector<std::string>& values) {
-    impl_->logger->debug("Updating set {}.{} for id {} with {} values", collection, attribute, id, values.size());
-    impl_->require_schema("update set");
+    update_set<std::string>(collection, attribute, id, values);
+}
 
-    auto set_table = impl_->schema->find_set_table(collection, attribute);
+void Database::update_time_series_floats(const std::string& collection,
+                                         const std::string& attribute,
+                                         int64_t id,
+                                         const std::vector<std::string>& date_times,
+                                         const std::vector<double>& values) {
+    const auto timer = impl_->time_operation("update_time_series_floats");
+    impl_->logger->debug(
+        "Updating time series {}.{} for id {} with {} values", collection, attribute, id, values.size());
+
+    auto route = impl_->route_time_series(collection, attribute);
+    if (date_times.size() != values.size()) {
+        throw std::runtime_error("Time series '" + attribute + "' has " + std::to_string(date_times.size()) +
+                                 " date_times but " + std::to_string(values.size()) + " values");
+    }
+    const auto& table = route.location->table;
 
     Impl::TransactionGuard txn(*impl_);
 
-    auto delete_sql = "DELETE FROM " + set_table + " WHERE id = ?";
-    execute(delete_sql, {id});
+    execute("DELETE FROM " + table + " WHERE " + route.id_column + " = ?", {id});
 
-    for (const auto& value : values) {
-        auto insert_sql = "INSERT INTO " + set_table + " (id, " + attribute + ") VALUES (?, ?)";
-        execute(insert_sql, {id, value});
+    if (impl_->schema->is_compressed_time_series_table(table)) {
+        impl_->write_compressed_time_series(route, attribute, id, date_times, values);
+    } else {
+        impl_->insert_rows(table,
+                           {route.id_column, "date_time", attribute},
+                           values.size(),
+                           [&](sqlite3_stmt* stmt, size_t row, int first) {
+                               sqlite3_bind_int64(stmt, first, id);
+                               bind_value(stmt, first + 1, date_times[row]);
+                               if (std::isnan(values[row])) {
+                                   sqlite3_bind_null(stmt, first + 2);
+                               } else {
+                                   sqlite3_bind_double(stmt, first + 2, values[row]);
+                               }
+                           });
     }
 
     txn.commit();
-    impl_->logger->info("Updated set {}.{} for id {} with {} values", collection, attribute, id, values.size());
+    impl_->logger->info(
+        "Updated time series {}.{} for id {} with {} values", collection, attribute, id, values.size());
 }
 
 ScalarMetadata Database::get_scalar_metadata(const std::string& collection, const std::string& attribute) const {
+    const auto timer = impl_->time_operation("get_scalar_metadata");
     if (!impl_->schema) {
         throw std::runtime_error("Cannot get scalar metadata: no schema loaded");
     }
@@ -1271,6 +4314,7 @@ ScalarMetadata Database::get_scalar_metadata(const std::string& collection, cons
 }
 
 VectorMetadata Database::get_vector_metadata(const std::string& collection, const std::string& group_name) const {
+    const auto timer = impl_->time_operation("get_vector_metadata");
     if (!impl_->schema) {
         throw std::runtime_error("Cannot get vector metadata: no schema loaded");
     }
@@ -1305,6 +4349,7 @@ VectorMetadata Database::get_vector_metadata(const std::string& collection, cons
 }
 
 SetMetadata Database::get_set_metadata(const std::string& collection, const std::string& group_name) const {
+    const auto timer = impl_->time_operation("get_set_metadata");
     if (!impl_->schema) {
         throw std::runtime_error("Cannot get set metadata: no schema loaded");
     }
@@ -1339,6 +4384,7 @@ SetMetadata Database::get_set_metadata(const std::string& collection, const std:
 }
 
 std::vector<ScalarMetadata> Database::list_scalar_attributes(const std::string& collection) const {
+    const auto timer = impl_->time_operation("list_scalar_attributes");
     if (!impl_->schema) {
         throw std::runtime_error("Cannot list scalar attributes: no schema loaded");
     }
@@ -1362,6 +4408,7 @@ std::vector<ScalarMetadata> Database::list_scalar_attributes(const std::string&
 }
 
 std::vector<VectorMetadata> Database::list_vector_groups(const std::string& collection) const {
+    const auto timer = impl_->time_operation("list_vector_groups");
     if (!impl_->schema) {
         throw std::runtime_error("Cannot list vector groups: no schema loaded");
     }
@@ -1369,12 +4416,7 @@ std::vector<VectorMetadata> Database::list_vector_groups(const std::string& coll
     std::vector<VectorMetadata> result;
     auto prefix = collection + "_vector_";
 
-    for (const auto& table_name : impl_->schema->table_names()) {
-        if (!impl_->schema->is_vector_table(table_name))
-            continue;
-        if (impl_->schema->get_parent_collection(table_name) != collection)
-            continue;
-
+    for (const auto& table_name : impl_->schema->vector_tables(collection)) {
         // Extract group name from table name
         if (table_name.size() > prefix.size() && table_name.substr(0, prefix.size()) == prefix) {
             auto group_name = table_name.substr(prefix.size());
@@ -1385,6 +4427,7 @@ std::vector<VectorMetadata> Database::list_vector_groups(const std::string& coll
 }
 
 std::vector<SetMetadata> Database::list_set_groups(const std::string& collection) const {
+    const auto timer = impl_->time_operation("list_set_groups");
     if (!impl_->schema) {
         throw std::runtime_error("Cannot list set groups: no schema loaded");
     }
@@ -1392,12 +4435,7 @@ std::vector<SetMetadata> Database::list_set_groups(const std::string& collection
     std::vector<SetMetadata> result;
     auto prefix = collection + "_set_";
 
-    for (const auto& table_name : impl_->schema->table_names()) {
-        if (!impl_->schema->is_set_table(table_name))
-            continue;
-        if (impl_->schema->get_parent_collection(table_name) != collection)
-            continue;
-
+    for (const auto& table_name : impl_->schema->set_tables(collection)) {
         // Extract group name from table name
         if (table_name.size() > prefix.size() && table_name.substr(0, prefix.size()) == prefix) {
             auto group_name = table_name.substr(prefix.size());
@@ -1407,36 +4445,404 @@ std::vector<SetMetadata> Database::list_set_groups(const std::string& collection
     return result;
 }
 
+AttributeHandle Database::attribute_handle(const std::string& collection, const std::string& attribute) const {
+    const auto timer = impl_->time_operation("attribute_handle");
+    impl_->require_collection(collection, "resolve attribute");
+
+    AttributeHandle handle;
+    handle.collection_ = collection;
+    handle.attribute_ = attribute;
+    const auto* scalar = impl_->schema->find_attribute(collection, attribute, AttributeKind::Scalar);
+    const auto* vector = impl_->schema->find_attribute(collection, attribute, AttributeKind::Vector);
+    if (scalar && scalar->column) {
+        handle.type_ = {DataStructure::Scalar, scalar->column->type};
+        handle.select_by_id_sql_ = "SELECT " + attribute + " FROM " + collection + " WHERE id = ?";
+        handle.select_all_sql_ = "SELECT " + attribute + " FROM " + collection;
+        handle.update_sql_ = "UPDATE " + collection + " SET " + attribute + " = ? WHERE id = ?";
+    } else if (vector && vector->column) {
+        handle.type_ = {DataStructure::Vector, vector->column->type};
+        handle.select_by_id_sql_ =
+            "SELECT " + attribute + " FROM " + impl_->vector_source(vector->table, attribute) +
+            " WHERE id = ? ORDER BY vector_index";
+    } else {
+        throw std::runtime_error("Scalar or vector attribute '" + attribute + "' not found for collection '" +
+                                 collection + "'");
+    }
+    return handle;
+}
+
+std::vector<int64_t> Database::read_scalar_integers(const AttributeHandle& attribute) {
+    const auto timer = impl_->time_operation("read_scalar_integers");
+    check_handle(attribute, DataStructure::Scalar, DataType::Integer);
+    auto stmt = impl_->prepare(attribute.select_all_sql_);
+    return read_non_null_column<int64_t>(stmt.get());
+}
+
+std::vector<double> Database::read_scalar_floats(const AttributeHandle& attribute) {
+    const auto timer = impl_->time_operation("read_scalar_floats");
+    check_handle(attribute, DataStructure::Scalar, DataType::Real);
+    auto stmt = impl_->prepare(attribute.select_all_sql_);
+    return read_non_null_column<double>(stmt.get());
+}
+
+std::vector<std::string> Database::read_scalar_strings(const AttributeHandle& attribute) {
+    const auto timer = impl_->time_operation("read_scalar_strings");
+    check_handle(attribute, DataStructure::Scalar, DataType::Text);
+    auto stmt = impl_->prepare(attribute.select_all_sql_);
+    return read_non_null_column<std::string>(stmt.get());
+}
+
+std::optional<int64_t> Database::read_scalar_integers_by_id(const AttributeHandle& attribute, int64_t id) {
+    const auto timer = impl_->time_operation("read_scalar_integers_by_id");
+    check_handle(attribute, DataStructure::Scalar, DataType::Integer);
+    auto stmt = impl_->prepare(attribute.select_by_id_sql_);
+    sqlite3_bind_int64(stmt.get(), 1, id);
+    return read_first_value<int64_t>(stmt.get());
+}
+
+std::optional<double> Database::read_scalar_floats_by_id(const AttributeHandle& attribute, int64_t id) {
+    const auto timer = impl_->time_operation("read_scalar_floats_by_id");
+    check_handle(attribute, DataStructure::Scalar, DataType::Real);
+    auto stmt = impl_->prepare(attribute.select_by_id_sql_);
+    sqlite3_bind_int64(stmt.get(), 1, id);
+    return read_first_value<double>(stmt.get());
+}
+
+std::optional<std::string> Database::read_scalar_strings_by_id(const AttributeHandle& attribute, int64_t id) {
+    const auto timer = impl_->time_operation("read_scalar_strings_by_id");
+    check_handle(attribute, DataStructure::Scalar, DataType::Text);
+    auto stmt = impl_->prepare(attribute.select_by_id_sql_);
+    sqlite3_bind_int64(stmt.get(), 1, id);
+    return read_first_value<std::string>(stmt.get());
+}
+
+std::vector<int64_t> Database::read_vector_integers_by_id(const AttributeHandle& attribute, int64_t id) {
+    const auto timer = impl_->time_operation("read_vector_integers_by_id");
+    check_handle(attribute, DataStructure::Vector, DataType::Integer);
+    auto stmt = impl_->prepare(attribute.select_by_id_sql_);
+    sqlite3_bind_int64(stmt.get(), 1, id);
+    return read_non_null_column<int64_t>(stmt.get());
+}
+
+std::vector<double> Database::read_vector_floats_by_id(const AttributeHandle& attribute, int64_t id) {
+    const auto timer = impl_->time_operation("read_vector_floats_by_id");
+    check_handle(attribute, DataStructure::Vector, DataType::Real);
+    auto stmt = impl_->prepare(attribute.select_by_id_sql_);
+    sqlite3_bind_int64(stmt.get(), 1, id);
+    return read_non_null_column<double>(stmt.get());
+}
+
+void Database::update_scalar_integer(const AttributeHandle& attribute, int64_t id, int64_t value) {
+    const auto timer = impl_->time_operation("update_scalar_integer");
+    check_handle(attribute, DataStructure::Scalar, DataType::Integer);
+    auto stmt = impl_->prepare(attribute.update_sql_);
+    bind_value(stmt.get(), 1, value);
+    sqlite3_bind_int64(stmt.get(), 2, id);
+    check_step_done(stmt.get(), sqlite3_step(stmt.get()));
+    impl_->logger->debug("Updated {}.{} for id {} to {}", attribute.collection(), attribute.attribute(), id, value);
+}
+
+void Database::update_scalar_float(const AttributeHandle& attribute, int64_t id, double value) {
+    const auto timer = impl_->time_operation("update_scalar_float");
+    check_handle(attribute, DataStructure::Scalar, DataType::Real);
+    auto stmt = impl_->prepare(attribute.update_sql_);
+    bind_value(stmt.get(), 1, value);
+    sqlite3_bind_int64(stmt.get(), 2, id);
+    check_step_done(stmt.get(), sqlite3_step(stmt.get()));
+    impl_->logger->debug("Updated {}.{} for id {} to {}", attribute.collection(), attribute.attribute(), id, value);
+}
+
+void Database::update_scalar_string(const AttributeHandle& attribute, int64_t id, const std::string& value) {
+    const auto timer = impl_->time_operation("update_scalar_string");
+    check_handle(attribute, DataStructure::Scalar, DataType::Text);
+    auto stmt = impl_->prepare(attribute.update_sql_);
+    bind_value(stmt.get(), 1, value);
+    sqlite3_bind_int64(stmt.get(), 2, id);
+    check_step_done(stmt.get(), sqlite3_step(stmt.get()));
+    impl_->logger->debug("Updated {}.{} for id {} to {}", attribute.collection(), attribute.attribute(), id, value);
+}
+
 void Database::export_to_csv(const std::string& table, const std::string& path) {
-    return;
+    const auto timer = impl_->time_operation("export_to_csv");
+    impl_->logger->debug("Exporting table {} to CSV file {}", table, path);
+
+    // Rows are written as they are stepped, so memory use does not grow with the table
+    auto stmt = impl_->prepare("SELECT * FROM " + table);
+    auto* raw = stmt.get();
+    CsvWriter writer(path);
+    const auto column_count = sqlite3_column_count(raw);
+    for (int i = 0; i < column_count; ++i) {
+        const char* name = sqlite3_column_name(raw, i);
+        writer.write_text(name ? name : "");
+    }
+    writer.end_record();
+
+    size_t rows = 0;
+    int rc;
+    while ((rc = sqlite3_step(raw)) == SQLITE_ROW) {
+        for (int i = 0; i < column_count; ++i) {
+            switch (sqlite3_column_type(raw, i)) {
+            case SQLITE_INTEGER:
+                writer.write_integer(sqlite3_column_int64(raw, i));
+                break;
+            case SQLITE_FLOAT:
+                writer.write_float(sqlite3_column_double(raw, i));
+                break;
+            case SQLITE_TEXT: {
+                const auto* text = reinterpret_cast<const char*>(sqlite3_column_text(raw, i));
+                const auto size = static_cast<size_t>(sqlite3_column_bytes(raw, i));
+                writer.write_text(std::string_view(text ? text : "", size));
+                break;
+            }
+            case SQLITE_NULL:
+                writer.write_null();
+                break;
+            default: {
+                const auto* data = static_cast<const uint8_t*>(sqlite3_column_blob(raw, i));
+                const auto size = static_cast<size_t>(sqlite3_column_bytes(raw, i));
+                writer.write_text(blob_to_hex(data, size));
+                break;
+            }
+            }
+        }
+        writer.end_record();
+        ++rows;
+    }
+    check_step_done(raw, rc);
+    writer.close();
+
+    impl_->logger->info("Exported {} rows from {} to {}", rows, table, path);
 }
 
 void Database::import_from_csv(const std::string& table, const std::string& path) {
-    return;
+    const auto timer = impl_->time_operation("import_from_csv");
+    impl_->logger->debug("Importing CSV file {} into table {}", path, table);
+    impl_->require_schema("import from csv");
+    const auto* table_def = impl_->schema->get_table(table);
+    if (!table_def) {
+        throw std::runtime_error("Table not found in schema: " + table);
+    }
+
+    // The header names the columns; fields are parsed with the column's schema type
+    CsvReader reader(path);
+    std::vector<CsvField> fields;
+    if (reader.read_records(fields, 0, 1) == 0) {
+        throw std::runtime_error("CSV file has no header: " + path);
+    }
+    std::vector<std::string> names;
+    std::vector<CsvColumn> columns;
+    std::vector<bool> blobs;
+    for (const auto& field : fields) {
+        std::string name(field.text);
+        const auto* column = table_def->get_column(name);
+        if (!column) {
+            throw std::runtime_error("Column '" + name + "' from CSV file not found in table '" + table + "'");
+        }
+        names.push_back(name);
+        // BLOB columns are read as their hex text and decoded when bound
+        blobs.push_back(column->packed);
+        columns.push_back({std::move(name), column->packed ? DataType::Text : column->type});
+    }
+
+    // Chunks are parsed and converted on worker threads; this thread only binds them, in file order, through the
+    // cached multi-row INSERT, all in one transaction. The pipeline is declared after the guard, so on error its
+    // threads are joined before the rollback.
+    Impl::TransactionGuard txn(*impl_);
+    CsvParsePipeline pipeline(reader, columns, csv_parse_workers());
+    size_t rows = 0;
+    while (const auto chunk = pipeline.next()) {
+        impl_->insert_rows(table, names, chunk->rows, [&](sqlite3_stmt* stmt, size_t row, int first) {
+            for (size_t c = 0; c < columns.size(); ++c) {
+                const auto idx = first + static_cast<int>(c);
+                if (blobs[c] && !chunk->columns[c].nulls[row]) {
+                    bind_value(stmt, idx, hex_to_blob(chunk->columns[c].texts[row]));
+                } else {
+                    bind_csv_value(stmt, idx, chunk->columns[c], columns[c].type, row);
+                }
+            }
+        });
+        rows += chunk->rows;
+    }
+    txn.commit();
+
+    impl_->logger->info("Imported {} rows from {} into {}", rows, path, table);
 }
 
-std::optional<std::string> Database::query_string(const std::string& sql, const std::vector<Value>& params) {
-    auto result = execute(sql, params);
-    if (result.empty()) {
-        return std::nullopt;
+void Database::export_collection(const std::string& collection, const std::string& directory) {
+    const auto timer = impl_->time_operation("export_collection");
+    impl_->logger->debug("Exporting collection {} to {}", collection, directory);
+    impl_->require_collection(collection, "export collection");
+
+    std::filesystem::create_directories(directory);
+    size_t rows = 0;
+    const auto tables = impl_->collection_tables(collection);
+    for (const auto& table : tables) {
+        rows += impl_->export_arrow_table(table, (std::filesystem::path(directory) / (table + ".arrow")).string());
+    }
+
+    impl_->logger->info("Exported {} rows from {} tables of {} to {}", rows, tables.size(), collection, directory);
+}
+
+void Database::import_collection(const std::string& collection, const std::string& directory) {
+    const auto timer = impl_->time_operation("import_collection");
+    impl_->logger->debug("Importing collection {} from {}", collection, directory);
+    impl_->require_collection(collection, "import collection");
+
+    // One transaction for all tables; the collection file is required, group files are optional
+    Impl::TransactionGuard txn(*impl_);
+    size_t rows = 0;
+    for (const auto& table : impl_->collection_tables(collection)) {
+        const auto path = std::filesystem::path(directory) / (table + ".arrow");
+        if (table != collection && !std::filesystem::exists(path)) {
+            continue;
+        }
+        rows += impl_->import_arrow_table(table, path.string());
     }
-    return result[0].get_string(0);
+    txn.commit();
+
+    impl_->logger->info("Imported {} rows from {} into {}", rows, directory, collection);
+}
+
+std::optional<std::string> Database::query_string(const std::string& sql, const std::vector<Value>& params) {
+    const auto timer = impl_->time_operation("query_string");
+    auto stmt = impl_->prepare(sql, params);
+    return read_first_value<std::string>(stmt.get());
 }
 
 std::optional<int64_t> Database::query_integer(const std::string& sql, const std::vector<Value>& params) {
-    auto result = execute(sql, params);
-    if (result.empty()) {
-        return std::nullopt;
-    }
-    return result[0].get_integer(0);
+    const auto timer = impl_->time_operation("query_integer");
+    auto stmt = impl_->prepare(sql, params);
+    return read_first_value<int64_t>(stmt.get());
 }
 
 std::optional<double> Database::query_float(const std::string& sql, const std::vector<Value>& params) {
-    auto result = execute(sql, params);
-    if (result.empty()) {
-        return std::nullopt;
+    const auto timer = impl_->time_operation("query_float");
+    auto stmt = impl_->prepare(sql, params);
+    return read_first_value<double>(stmt.get());
+}
+
+Cursor Database::cursor(const std::string& sql, const std::vector<Value>& params) {
+    const auto timer = impl_->time_operation("cursor");
+    // Cursors own a private statement so they never pin an entry of the statement cache
+    sqlite3_stmt* stmt = nullptr;
+    const auto rc = sqlite3_prepare_v2(impl_->db, sql.c_str(), static_cast<int>(sql.size()), &stmt, nullptr);
+    if (rc != SQLITE_OK) {
+        throw std::runtime_error("Failed to prepare statement: " + std::string(sqlite3_errmsg(impl_->db)));
+    }
+    if (!stmt) {
+        throw std::runtime_error("Failed to prepare statement: no SQL statement in input");
+    }
+    bind_params(stmt, params);
+    return Cursor(stmt);
+}
+
+Cursor Database::cursor_scalars(const std::string& collection, const std::vector<std::string>& attributes) {
+    const auto timer = impl_->time_operation("cursor_scalars");
+    impl_->require_collection(collection, "read scalars");
+    const auto* table_def = impl_->schema->get_table(collection);
+
+    std::string sql = "SELECT id";
+    for (const auto& attribute : attributes) {
+        if (!table_def->get_column(attribute)) {
+            throw std::runtime_error("Scalar attribute '" + attribute + "' not found in collection '" + collection +
+                                     "'");
+        }
+        sql += ", " + attribute;
+    }
+    return cursor(sql + " FROM " + collection + " ORDER BY rowid");
+}
+
+Cursor Database::cursor_vector(const std::string& collection, const std::string& attribute) {
+    const auto timer = impl_->time_operation("cursor_vector");
+    impl_->require_collection(collection, "read vector");
+    auto source = impl_->vector_rows(collection, attribute);
+    return cursor("SELECT id, vector_index, " + attribute + " FROM " + source + " ORDER BY id, vector_index");
+}
+
+std::vector<MissingIndex> Database::missing_indexes() const {
+    impl_->require_schema("check indexes");
+    return SchemaValidator(*impl_->schema).missing_indexes();
+}
+
+size_t Database::create_missing_indexes() {
+    const auto timer = impl_->time_operation("create_missing_indexes");
+    const auto missing = missing_indexes();
+    if (missing.empty()) {
+        return 0;
+    }
+
+    Impl::TransactionGuard txn(*impl_);
+    for (const auto& index : missing) {
+        const auto name = "quiver_index_" + index.table + "_" + Impl::join_columns(index.columns, "_");
+        execute("CREATE INDEX IF NOT EXISTS " + name + " ON " + index.table + " (" +
+                Impl::join_columns(index.columns, ", ") + ")");
+        impl_->logger->debug("Created index {} ({})", name, index.reason);
+    }
+    impl_->load_schema_metadata();
+    txn.commit();
+
+    impl_->logger->info("Created {} missing indexes", missing.size());
+    return missing.size();
+}
+
+std::vector<QueryPlanCheck> Database::check_query_plans() {
+    const auto timer = impl_->time_operation("check_query_plans");
+    impl_->require_schema("check query plans");
+    const auto& schema = *impl_->schema;
+
+    std::vector<QueryPlanCheck> checks;
+    const auto check = [&](const std::string& collection, const std::string& table, std::string sql) {
+        for (const auto& existing : checks) {
+            if (existing.sql == sql) {
+                return;
+            }
+        }
+        auto& result = checks.emplace_back();
+        result.collection = collection;
+        result.table = table;
+        result.sql = std::move(sql);
+
+        auto handle = impl_->prepare("EXPLAIN QUERY PLAN " + result.sql);
+        auto* stmt = handle.get();
+        int rc;
+        while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+            std::string detail = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
+            result.full_scan = result.full_scan || detail.starts_with("SCAN ");
+            result.temp_sort = result.temp_sort || detail.starts_with("USE TEMP B-TREE");
+            result.plan.push_back(std::move(detail));
+        }
+        check_step_done(stmt, rc);
+    };
+
+    // The lookups behind label resolution, by-id group reads and the foreign key actions of a delete
+    const auto table_names = schema.table_names();
+    for (const auto& collection : schema.collection_names()) {
+        if (schema.get_table(collection)->has_column("label")) {
+            check(collection, collection, "SELECT id FROM " + collection + " WHERE label = ?");
+        }
+        for (const auto& table : impl_->collection_tables(collection)) {
+            if (table == collection) {
+                continue;
+            }
+            auto sql = "SELECT * FROM " + table + " WHERE " + impl_->parent_column(table, collection) + " = ?";
+            if (schema.is_compressed_time_series_table(table)) {
+                sql += " ORDER BY chunk_start";
+            } else if (schema.is_time_series_table(table)) {
+                sql += " ORDER BY date_time";
+            } else if (schema.is_vector_table(table) && !schema.is_packed_vector_table(table)) {
+                sql += " ORDER BY vector_index";
+            }
+            check(collection, table, std::move(sql));
+        }
+        for (const auto& table : table_names) {
+            for (const auto& fk : schema.get_table(table)->foreign_keys) {
+                if (fk.to_table == collection) {
+                    check(collection, table, "SELECT 1 FROM " + table + " WHERE " + fk.from_column + " = ?");
+                }
+            }
+        }
     }
-    return result[0].get_float(0);
+    return checks;
 }
 
 void Database::describe() const {
@@ -1469,12 +4875,7 @@ void Database::describe() const {
 
         // Vectors
         auto prefix_vec = collection + "_vector_";
-        for (const auto& table_name : impl_->schema->table_names()) {
-            if (!impl_->schema->is_vector_table(table_name))
-                continue;
-            if (impl_->schema->get_parent_collection(table_name) != collection)
-                continue;
-
+        for (const auto& table_name : impl_->schema->vector_tables(collection)) {
             auto group_name = table_name.substr(prefix_vec.size());
             const auto* vec_table = impl_->schema->get_table(table_name);
             if (!vec_table)
@@ -1496,12 +4897,7 @@ void Database::describe() const {
 
         // Sets
         auto prefix_set = collection + "_set_";
-        for (const auto& table_name : impl_->schema->table_names()) {
-            if (!impl_->schema->is_set_table(table_name))
-                continue;
-            if (impl_->schema->get_parent_collection(table_name) != collection)
-                continue;
-
+        for (const auto& table_name : impl_->schema->set_tables(collection)) {
             auto group_name = table_name.substr(prefix_set.size());
             const auto* set_table = impl_->schema->get_table(table_name);
             if (!set_table)
@@ -1523,4 +4919,22 @@ void Database::describe() const {
     }
 }
 
+// Typed accessors are defined in this file, so each AttributeValue type is instantiated here
+#define QUIVER_INSTANTIATE_TYPED_ACCESSORS(T)                                                                         \
+    template std::vector<T> Database::read_scalar<T>(const std::string&, const std::string&);                         \
+    template std::optional<T> Database::read_scalar_by_id<T>(const std::string&, const std::string&, int64_t);        \
+    template std::vector<std::vector<T>> Database::read_vector<T>(const std::string&, const std::string&);            \
+    template std::vector<T> Database::read_vector_by_id<T>(const std::string&, const std::string&, int64_t);          \
+    template std::vector<std::vector<T>> Database::read_set<T>(const std::string&, const std::string&);               \
+    template std::vector<T> Database::read_set_by_id<T>(const std::string&, const std::string&, int64_t);             \
+    template void Database::update_scalar<T>(const std::string&, const std::string&, int64_t, const T&);              \
+    template void Database::update_vector<T>(const std::string&, const std::string&, int64_t, const std::vector<T>&); \
+    template void Database::update_set<T>(const std::string&, const std::string&, int64_t, const std::vector<T>&);
+
+QUIVER_INSTANTIATE_TYPED_ACCESSORS(int64_t)
+QUIVER_INSTANTIATE_TYPED_ACCESSORS(double)
+QUIVER_INSTANTIATE_TYPED_ACCESSORS(std::string)
+
+#undef QUIVER_INSTANTIATE_TYPED_ACCESSORS
+
 }  // namespace quiver
@@ -0,0 +1,115 @@
+#include "quiver/database_pool.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace quiver {
+
+namespace {
+
+constexpr size_t kWriterIndex = static_cast<size_t>(-1);
+
+}  // namespace
+
+struct DatabasePool::Impl {
+    Database writer;
+    std::vector<Database> readers;
+    std::vector<size_t> idle;  // Indices of readers not currently leased
+    bool writer_busy = false;
+    mutable std::mutex mutex;
+    std::condition_variable readers_available;
+    std::condition_variable writer_available;
+
+    explicit Impl(Database&& writer_db) : writer(std::move(writer_db)) {}
+
+    void release(size_t reader) {
+        {
+            std::lock_guard lock(mutex);
+            if (reader == kWriterIndex) {
+                writer_busy = false;
+            } else {
+                idle.push_back(reader);
+            }
+        }
+        if (reader == kWriterIndex) {
+            writer_available.notify_one();
+        } else {
+            readers_available.notify_one();
+        }
+    }
+};
+
+DatabasePool::Lease::Lease(Impl* pool, Database* database, size_t reader)
+    : pool_(pool), database_(database), reader_(reader) {}
+
+DatabasePool::Lease::Lease(Lease&& other) noexcept
+    : pool_(other.pool_), database_(other.database_), reader_(other.reader_) {
+    other.pool_ = nullptr;
+}
+
+DatabasePool::Lease::~Lease() {
+    if (pool_) {
+        pool_->release(reader_);
+    }
+}
+
+DatabasePool::DatabasePool(const std::string& path, const DatabasePoolOptions& options) {
+    if (path.empty() || path == ":memory:") {
+        throw std::runtime_error("Failed to open database pool: a database file is required");
+    }
+    if (options.readers == 0) {
+        throw std::runtime_error("Failed to open database pool: at least one reader is required");
+    }
+    if (options.options.read_only || options.options.mapped) {
+        throw std::runtime_error("Failed to open database pool: the writer cannot be read-only or mapped");
+    }
+
+    auto writer_options = options.options;
+    if (!writer_options.journal_mode) {
+        writer_options.journal_mode = JournalMode::wal;
+    }
+    impl_ = std::make_unique<Impl>(Database(path, writer_options));
+
+    // Journal mode and page size belong to the file and were settled by the writer
+    auto reader_options = options.options;
+    reader_options.read_only = true;
+    reader_options.journal_mode.reset();
+    reader_options.page_size.reset();
+
+    impl_->readers.reserve(options.readers);
+    impl_->idle.reserve(options.readers);
+    for (size_t i = 0; i < options.readers; ++i) {
+        impl_->readers.push_back(impl_->writer.open_sibling(reader_options));
+        impl_->idle.push_back(options.readers - 1 - i);
+    }
+}
+
+DatabasePool::~DatabasePool() = default;
+
+DatabasePool::Lease DatabasePool::reader() {
+    std::unique_lock lock(impl_->mutex);
+    impl_->readers_available.wait(lock, [this] { return !impl_->idle.empty(); });
+    const auto index = impl_->idle.back();
+    impl_->idle.pop_back();
+    return Lease(impl_.get(), &impl_->readers[index], index);
+}
+
+DatabasePool::Lease DatabasePool::writer() {
+    std::unique_lock lock(impl_->mutex);
+    impl_->writer_available.wait(lock, [this] { return !impl_->writer_busy; });
+    impl_->writer_busy = true;
+    return Lease(impl_.get(), &impl_->writer, kWriterIndex);
+}
+
+size_t DatabasePool::reader_count() const {
+    return impl_->readers.size();
+}
+
+size_t DatabasePool::idle_readers() const {
+    std::lock_guard lock(impl_->mutex);
+    return impl_->idle.size();
+}
+
+}  // namespace quiver
@@ -0,0 +1,118 @@
+#include "quiver/database_set.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+namespace quiver {
+
+namespace {
+
+// Runs task(i) for every i in [0, count) on up to `threads` threads, the calling thread included. Once a task throws,
+// unstarted tasks are skipped and the first exception is rethrown after every thread has joined.
+void run_parallel(size_t count, size_t threads, const std::function<void(size_t)>& task) {
+    std::atomic<size_t> next{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    auto worker = [&] {
+        for (size_t i = next++; i < count && !failed; i = next++) {
+            try {
+                task(i);
+            } catch (...) {
+                std::lock_guard lock(error_mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                failed = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    const auto extra = std::min(threads, count);
+    workers.reserve(extra > 0 ? extra - 1 : 0);
+    for (size_t i = 1; i < extra; ++i) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : workers) {
+        thread.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+}  // namespace
+
+struct DatabaseSet::Impl {
+    std::vector<std::string> paths;
+    std::vector<Database> databases;
+    std::unordered_map<std::string, size_t> index;
+    size_t threads = 1;
+};
+
+DatabaseSet::DatabaseSet(const std::vector<std::string>& paths, const DatabaseSetOptions& options)
+    : impl_(std::make_unique<Impl>()) {
+    impl_->paths = paths;
+    for (size_t i = 0; i < paths.size(); ++i) {
+        if (!impl_->index.emplace(paths[i], i).second) {
+            throw std::runtime_error("Failed to open database set: duplicate path " + paths[i]);
+        }
+    }
+
+    const auto cores = static_cast<size_t>(std::thread::hardware_concurrency());
+    impl_->threads = std::max<size_t>(options.threads > 0 ? options.threads : cores, 1);
+
+    auto file_options = options.options;
+    file_options.read_only = true;
+
+    std::vector<std::optional<Database>> opened(paths.size());
+    run_parallel(paths.size(), impl_->threads, [&](size_t i) {
+        Database db(paths[i], file_options);
+        db.load_schema_if_needed();
+        opened[i].emplace(std::move(db));
+    });
+
+    impl_->databases.reserve(paths.size());
+    for (auto& db : opened) {
+        impl_->databases.push_back(std::move(*db));
+    }
+}
+
+DatabaseSet::~DatabaseSet() = default;
+
+DatabaseSet::DatabaseSet(DatabaseSet&&) noexcept = default;
+DatabaseSet& DatabaseSet::operator=(DatabaseSet&&) noexcept = default;
+
+size_t DatabaseSet::size() const {
+    return impl_->paths.size();
+}
+
+const std::vector<std::string>& DatabaseSet::paths() const {
+    return impl_->paths;
+}
+
+Database& DatabaseSet::at(const std::string& path) {
+    const auto it = impl_->index.find(path);
+    if (it == impl_->index.end()) {
+        throw std::runtime_error("Database not found in set: " + path);
+    }
+    return impl_->databases[it->second];
+}
+
+void DatabaseSet::for_each(const std::function<void(const std::string&, Database&)>& fn) {
+    for_each_index([&](size_t index, Database& db) { fn(impl_->paths[index], db); });
+}
+
+void DatabaseSet::for_each_index(const std::function<void(size_t, Database&)>& fn) {
+    run_parallel(size(), impl_->threads, [&](size_t index) { fn(index, impl_->databases[index]); });
+}
+
+}  // namespace quiver
@@ -1,6 +1,7 @@
 #include "quiver/element.h"
 
 #include <sstream>
+#include <utility>
 
 namespace quiver {
 
@@ -18,6 +19,8 @@ std::string value_to_string(const Value& value) {
                 return std::to_string(arg);
             } else if constexpr (std::is_same_v<T, std::string>) {
                 return "\"" + arg + "\"";
+            } else if constexpr (std::is_same_v<T, Blob>) {
+                return "<" + std::to_string(arg.size()) + " bytes>";
             } else {
                 return "<unknown>";
             }
@@ -47,18 +50,33 @@ Element& Element::set_null(const std::string& name) {
     return *this;
 }
 
-Element& Element::set(const std::string& name, const std::vector<int64_t>& values) {
-    arrays_[name] = std::vector<Value>(values.begin(), values.end());
+Element& Element::set(const std::string& name, std::vector<int64_t> values) {
+    arrays_[name] = std::move(values);
     return *this;
 }
 
-Element& Element::set(const std::string& name, const std::vector<double>& values) {
-    arrays_[name] = std::vector<Value>(values.begin(), values.end());
+Element& Element::set(const std::string& name, std::vector<double> values) {
+    arrays_[name] = std::move(values);
     return *this;
 }
 
-Element& Element::set(const std::string& name, const std::vector<std::string>& values) {
-    arrays_[name] = std::vector<Value>(values.begin(), values.end());
+Element& Element::set(const std::string& name, std::vector<std::string> values) {
+    arrays_[name] = std::move(values);
+    return *this;
+}
+
+Element& Element::set(const std::string& name, std::span<const int64_t> values) {
+    arrays_[name] = std::vector<int64_t>(values.begin(), values.end());
+    return *this;
+}
+
+Element& Element::set(const std::string& name, std::span<const double> values) {
+    arrays_[name] = std::vector<double>(values.begin(), values.end());
+    return *this;
+}
+
+Element& Element::set(const std::string& name, std::span<const std::string> values) {
+    arrays_[name] = std::vector<std::string>(values.begin(), values.end());
     return *this;
 }
 
@@ -66,7 +84,7 @@ const std::map<std::string, Value>& Element::scalars() const {
     return scalars_;
 }
 
-const std::map<std::string, std::vector<Value>>& Element::arrays() const {
+const std::map<std::string, ArrayValues>& Element::arrays() const {
     return arrays_;
 }
 
@@ -98,11 +116,15 @@ std::string Element::to_string() const {
         oss << "  arrays:\n";
         for (const auto& [name, values] : arrays_) {
             oss << "    " << name << ": [";
-            for (size_t i = 0; i < values.size(); ++i) {
-                if (i > 0)
-                    oss << ", ";
-                oss << value_to_string(values[i]);
-            }
+            std::visit(
+                [&](const auto& typed) {
+                    for (size_t i = 0; i < typed.size(); ++i) {
+                        if (i > 0)
+                            oss << ", ";
+                        oss << value_to_string(typed[i]);
+                    }
+                },
+                values);
             oss << "]\n";
         }
     }
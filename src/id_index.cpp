@@ -0,0 +1,50 @@
+#include "quiver/id_index.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace quiver {
+
+namespace {
+
+// Largest range of ids, relative to their count, that still gets a direct table
+constexpr uint64_t kMaxGapFactor = 4;
+
+}  // namespace
+
+IdIndex::IdIndex(std::vector<int64_t> ids) : ids_(std::move(ids)) {
+    for (size_t i = 1; i < ids_.size(); ++i) {
+        if (ids_[i] <= ids_[i - 1]) {
+            throw std::runtime_error("Cannot build id index: ids are not strictly ascending");
+        }
+    }
+    if (ids_.empty()) {
+        return;
+    }
+    first_ = ids_.front();
+    // Unsigned, so ids spanning most of int64_t cannot overflow
+    const auto range = static_cast<uint64_t>(ids_.back()) - static_cast<uint64_t>(first_) + 1;
+    if (range <= kMaxGapFactor * ids_.size()) {
+        positions_.assign(static_cast<size_t>(range), -1);
+        for (size_t i = 0; i < ids_.size(); ++i) {
+            positions_[static_cast<size_t>(ids_[i] - first_)] = static_cast<int64_t>(i);
+        }
+    }
+}
+
+std::optional<size_t> IdIndex::position(int64_t id) const {
+    if (!positions_.empty()) {
+        if (id < first_ || id - first_ >= static_cast<int64_t>(positions_.size())) {
+            return std::nullopt;
+        }
+        const auto found = positions_[static_cast<size_t>(id - first_)];
+        return found < 0 ? std::nullopt : std::optional<size_t>(static_cast<size_t>(found));
+    }
+    const auto it = std::lower_bound(ids_.begin(), ids_.end(), id);
+    if (it == ids_.end() || *it != id) {
+        return std::nullopt;
+    }
+    return static_cast<size_t>(it - ids_.begin());
+}
+
+}  // namespace quiver
@@ -0,0 +1,36 @@
+#include "label_cache.h"
+
+#include "memory_size.h"
+
+namespace quiver {
+
+std::optional<int64_t> LabelCache::find(const std::string& collection, const std::string& label) const {
+    auto collection_it = collections_.find(collection);
+    if (collection_it != collections_.end()) {
+        auto it = collection_it->second.find(label);
+        if (it != collection_it->second.end()) {
+            ++hits_;
+            return it->second;
+        }
+    }
+    ++misses_;
+    return std::nullopt;
+}
+
+void LabelCache::insert(const std::string& collection, const std::string& label, int64_t id) {
+    collections_[collection][label] = id;
+}
+
+void LabelCache::invalidate(const std::string& collection) {
+    collections_.erase(collection);
+}
+
+void LabelCache::clear() {
+    collections_.clear();
+}
+
+size_t LabelCache::bytes() const {
+    return heap_bytes(collections_);
+}
+
+}  // namespace quiver
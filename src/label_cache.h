@@ -0,0 +1,38 @@
+#ifndef QUIVER_LABEL_CACHE_H
+#define QUIVER_LABEL_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace quiver {
+
+// Label -> id maps per collection, used to resolve foreign key labels on writes.
+// Entries are only added for rows that were found; a collection's map is dropped as soon as
+// any of its rows is updated or deleted, and everything is dropped on rollback.
+class LabelCache {
+public:
+    std::optional<int64_t> find(const std::string& collection, const std::string& label) const;
+    void insert(const std::string& collection, const std::string& label, int64_t id);
+
+    // Drops the cached labels of one collection
+    void invalidate(const std::string& collection);
+    void clear();
+
+    bool empty() const { return collections_.empty(); }
+    int64_t hits() const { return hits_; }
+    int64_t misses() const { return misses_; }
+    // Estimated bytes held by the maps
+    size_t bytes() const;
+
+private:
+    std::unordered_map<std::string, std::unordered_map<std::string, int64_t>> collections_;
+    mutable int64_t hits_ = 0;
+    mutable int64_t misses_ = 0;
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_LABEL_CACHE_H
@@ -1,16 +1,33 @@
 #include "quiver/lua_runner.h"
 
+#include "quiver/cursor.h"
 #include "quiver/database.h"
 #include "quiver/element.h"
 
 #include <sol/sol.hpp>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
 
 namespace quiver {
 
 struct LuaRunner::Impl {
+    // Compiled chunks kept per script text; the cache is dropped once it grows past this many entries
+    static constexpr size_t max_cached_chunks = 64;
+
     Database& db;
     sol::state lua;
+    std::unordered_map<std::string, sol::protected_function> chunks;
+    // Scripts from compile(), indexed by handle; released slots are empty and reused by later compiles
+    std::vector<sol::protected_function> compiled;
+    std::vector<size_t> released;
 
     explicit Impl(Database& database) : db(database) {
         lua.open_libraries(sol::lib::base, sol::lib::string, sol::lib::table);
@@ -18,6 +35,83 @@ struct LuaRunner::Impl {
         lua["db"] = &db;
     }
 
+    sol::protected_function& load(const std::string& script) {
+        if (auto it = chunks.find(script); it != chunks.end()) {
+            return it->second;
+        }
+        if (chunks.size() >= max_cached_chunks) {
+            chunks.clear();
+        }
+        return chunks.emplace(script, compile_chunk(lua.load(script))).first->second;
+    }
+
+    // The compiled function stays in this state, so runs never go back through the parser
+    size_t compile(const std::string& name, const std::string& script) {
+        auto chunk = compile_chunk(lua.load(script, "=" + name));
+        if (released.empty()) {
+            compiled.push_back(std::move(chunk));
+            return compiled.size() - 1;
+        }
+        const auto handle = released.back();
+        released.pop_back();
+        compiled[handle] = std::move(chunk);
+        return handle;
+    }
+
+    sol::protected_function& find_compiled(size_t handle) {
+        if (handle >= compiled.size() || !compiled[handle].valid()) {
+            throw std::runtime_error("Lua script handle not found: " + std::to_string(handle));
+        }
+        return compiled[handle];
+    }
+
+    void run(size_t handle, const std::vector<Value>& args) {
+        auto& chunk = find_compiled(handle);
+        std::vector<sol::object> objects;
+        objects.reserve(args.size());
+        for (const auto& arg : args) {
+            objects.push_back(value_to_lua(lua, arg));
+        }
+        check(chunk(sol::as_args(objects)));
+    }
+
+    // Unreferences the chunk so the Lua collector can free it
+    void release(size_t handle) {
+        find_compiled(handle) = sol::protected_function();
+        released.push_back(handle);
+    }
+
+    static sol::protected_function compile_chunk(sol::load_result loaded) {
+        if (!loaded.valid()) {
+            sol::error err = loaded;
+            throw std::runtime_error(std::string("Lua error: ") + err.what());
+        }
+        return loaded.get<sol::protected_function>();
+    }
+
+    static sol::object value_to_lua(const sol::state_view& lua, const Value& value) {
+        return std::visit(
+            [&lua](const auto& v) {
+                using T = std::decay_t<decltype(v)>;
+                if constexpr (std::is_same_v<T, std::nullptr_t>) {
+                    return sol::make_object(lua, sol::lua_nil);
+                } else if constexpr (std::is_same_v<T, Blob>) {
+                    // Lua strings hold arbitrary bytes
+                    return sol::make_object(lua, std::string(v.begin(), v.end()));
+                } else {
+                    return sol::make_object(lua, v);
+                }
+            },
+            value);
+    }
+
+    static void check(const sol::protected_function_result& result) {
+        if (!result.valid()) {
+            sol::error err = result;
+            throw std::runtime_error(std::string("Lua error: ") + err.what());
+        }
+    }
+
     void bind_database() {
         lua.new_usertype<Database>(
             "Database",
@@ -103,6 +197,91 @@ struct LuaRunner::Impl {
                const std::string& attribute,
                int64_t id,
                sol::this_state s) { return read_set_strings_by_id_to_lua(self, collection, attribute, id, s); },
+            "read_scalar_integers_by_ids",
+            [](Database& self,
+               const std::string& collection,
+               const std::string& attribute,
+               sol::table ids,
+               sol::this_state s) {
+                return nullable_column_to_lua(
+                    s, self.read_scalar_integers_by_ids(collection, attribute, table_to_ids(ids)));
+            },
+            "read_scalar_floats_by_ids",
+            [](Database& self,
+               const std::string& collection,
+               const std::string& attribute,
+               sol::table ids,
+               sol::this_state s) {
+                return nullable_column_to_lua(
+                    s, self.read_scalar_floats_by_ids(collection, attribute, table_to_ids(ids)));
+            },
+            "read_scalar_strings_by_ids",
+            [](Database& self,
+               const std::string& collection,
+               const std::string& attribute,
+               sol::table ids,
+               sol::this_state s) {
+                return nullable_column_to_lua(
+                    s, self.read_scalar_strings_by_ids(collection, attribute, table_to_ids(ids)));
+            },
+            "read_vector_integers_by_ids",
+            [](Database& self,
+               const std::string& collection,
+               const std::string& attribute,
+               sol::table ids,
+               sol::this_state s) {
+                return flat_vectors_to_lua(
+                    s, self.read_vector_integers_by_ids(collection, attribute, table_to_ids(ids)));
+            },
+            "read_vector_floats_by_ids",
+            [](Database& self,
+               const std::string& collection,
+               const std::string& attribute,
+               sol::table ids,
+               sol::this_state s) {
+                return flat_vectors_to_lua(s, self.read_vector_floats_by_ids(collection, attribute, table_to_ids(ids)));
+            },
+            "read_vector_strings_by_ids",
+            [](Database& self,
+               const std::string& collection,
+               const std::string& attribute,
+               sol::table ids,
+               sol::this_state s) {
+                return flat_vectors_to_lua(
+                    s, self.read_vector_strings_by_ids(collection, attribute, table_to_ids(ids)));
+            },
+            "read_set_integers_by_ids",
+            [](Database& self,
+               const std::string& collection,
+               const std::string& attribute,
+               sol::table ids,
+               sol::this_state s) {
+                return flat_vectors_to_lua(s, self.read_set_integers_by_ids(collection, attribute, table_to_ids(ids)));
+            },
+            "read_set_floats_by_ids",
+            [](Database& self,
+               const std::string& collection,
+               const std::string& attribute,
+               sol::table ids,
+               sol::this_state s) {
+                return flat_vectors_to_lua(s, self.read_set_floats_by_ids(collection, attribute, table_to_ids(ids)));
+            },
+            "read_set_strings_by_ids",
+            [](Database& self,
+               const std::string& collection,
+               const std::string& attribute,
+               sol::table ids,
+               sol::this_state s) {
+                return flat_vectors_to_lua(s, self.read_set_strings_by_ids(collection, attribute, table_to_ids(ids)));
+            },
+            "iter_scalars",
+            [](Database& self, const std::string& collection, sol::table attributes, sol::this_state s) {
+                return iter_scalars_to_lua(self, collection, attributes, s);
+            },
+            "iter_vector",
+            [](Database& self, const std::string& collection, const std::string& attribute, sol::this_state s) {
+                return iter_vector_to_lua(self, collection, attribute, s);
+            },
             "read_element_ids",
             [](Database& self, const std::string& collection, sol::this_state s) {
                 return read_element_ids_to_lua(self, collection, s);
@@ -111,6 +290,47 @@ struct LuaRunner::Impl {
             [](Database& self, const std::string& collection, int64_t id) {
                 self.delete_element_by_id(collection, id);
             },
+            "delete_elements_by_ids",
+            [](Database& self, const std::string& collection, sol::table ids) {
+                return static_cast<int64_t>(self.delete_elements_by_ids(collection, table_to_ids(ids)));
+            },
+            "create_elements",
+            [](Database& self, const std::string& collection, sol::table rows, sol::this_state s) {
+                return create_elements_from_lua(self, collection, rows, s);
+            },
+            "upsert_element",
+            [](Database& self, const std::string& collection, sol::table values) {
+                return self.upsert_element(collection, table_to_element(values));
+            },
+            "upsert_elements",
+            [](Database& self, const std::string& collection, sol::table rows, sol::this_state s) {
+                return upsert_elements_from_lua(self, collection, rows, s);
+            },
+            "update_scalar_integers",
+            [](Database& self,
+               const std::string& collection,
+               const std::string& attribute,
+               sol::table ids,
+               sol::table values) {
+                self.update_scalar_integers(collection, attribute, table_to_ids(ids), table_to_vector<int64_t>(values));
+            },
+            "update_scalar_floats",
+            [](Database& self,
+               const std::string& collection,
+               const std::string& attribute,
+               sol::table ids,
+               sol::table values) {
+                self.update_scalar_floats(collection, attribute, table_to_ids(ids), table_to_vector<double>(values));
+            },
+            "update_scalar_strings",
+            [](Database& self,
+               const std::string& collection,
+               const std::string& attribute,
+               sol::table ids,
+               sol::table values) {
+                self.update_scalar_strings(
+                    collection, attribute, table_to_ids(ids), table_to_vector<std::string>(values));
+            },
             "update_element",
             [](Database& self, const std::string& collection, int64_t id, sol::table values) {
                 update_element_from_lua(self, collection, id, values);
@@ -164,7 +384,27 @@ struct LuaRunner::Impl {
                 return query_float_to_lua(self, sql, params, s);
             },
             "describe",
-            [](Database& self) { self.describe(); });
+            [](Database& self) { self.describe(); },
+            "begin_transaction",
+            [](Database& self) { self.begin_transaction(); },
+            "commit",
+            [](Database& self) { self.commit(); },
+            "rollback",
+            [](Database& self) { self.rollback(); },
+            "in_transaction",
+            [](Database& self) { return self.in_transaction(); },
+            "transaction",
+            [](Database& self, sol::protected_function fn) { run_in_transaction(self, fn); });
+    }
+
+    static void run_in_transaction(Database& db, sol::protected_function fn) {
+        Database::Transaction txn(db);
+        auto result = fn();
+        if (!result.valid()) {
+            sol::error err = result;
+            throw std::runtime_error(err.what());
+        }
+        txn.commit();
     }
 
     static Element table_to_element(sol::table values) {
@@ -179,23 +419,11 @@ struct LuaRunner::Impl {
                 if (arr.size() > 0) {
                     sol::object first = arr[1];
                     if (first.is<int64_t>()) {
-                        std::vector<int64_t> vec;
-                        for (size_t i = 1; i <= arr.size(); ++i) {
-                            vec.push_back(arr.get<int64_t>(i));
-                        }
-                        element.set(k, vec);
+                        element.set(k, table_to_vector<int64_t>(arr));
                     } else if (first.is<double>()) {
-                        std::vector<double> vec;
-                        for (size_t i = 1; i <= arr.size(); ++i) {
-                            vec.push_back(arr.get<double>(i));
-                        }
-                        element.set(k, vec);
+                        element.set(k, table_to_vector<double>(arr));
                     } else if (first.is<std::string>()) {
-                        std::vector<std::string> vec;
-                        for (size_t i = 1; i <= arr.size(); ++i) {
-                            vec.push_back(arr.get<std::string>(i));
-                        }
-                        element.set(k, vec);
+                        element.set(k, table_to_vector<std::string>(arr));
                     }
                 }
             } else if (val.is<int64_t>()) {
@@ -215,6 +443,31 @@ struct LuaRunner::Impl {
         return db.create_element(collection, element);
     }
 
+    // Elements are converted up front and inserted together, so the whole batch shares one transaction
+    static sol::table
+    create_elements_from_lua(Database& db, const std::string& collection, sol::table rows, sol::this_state s) {
+        sol::state_view lua(s);
+        const size_t size = rows.size();
+        std::vector<Element> elements;
+        elements.reserve(size);
+        for (size_t i = 1; i <= size; ++i) {
+            elements.push_back(table_to_element(rows.raw_get<sol::table>(i)));
+        }
+        return sequence_to_lua(lua, db.create_elements(collection, elements));
+    }
+
+    static sol::table
+    upsert_elements_from_lua(Database& db, const std::string& collection, sol::table rows, sol::this_state s) {
+        sol::state_view lua(s);
+        const size_t size = rows.size();
+        std::vector<Element> elements;
+        elements.reserve(size);
+        for (size_t i = 1; i <= size; ++i) {
+            elements.push_back(table_to_element(rows.raw_get<sol::table>(i)));
+        }
+        return sequence_to_lua(lua, db.upsert_elements(collection, elements));
+    }
+
     static void update_element_from_lua(Database& db, const std::string& collection, int64_t id, sol::table values) {
         Element element = table_to_element(values);
         db.update_element(collection, id, element);
@@ -226,11 +479,7 @@ struct LuaRunner::Impl {
                                                  sol::this_state s) {
         sol::state_view lua(s);
         auto result = db.read_scalar_strings(collection, attribute);
-        sol::table t = lua.create_table();
-        for (size_t i = 0; i < result.size(); ++i) {
-            t[i + 1] = result[i];
-        }
-        return t;
+        return sequence_to_lua(lua, result);
     }
 
     static sol::table read_scalar_integers_to_lua(Database& db,
@@ -239,11 +488,7 @@ struct LuaRunner::Impl {
                                                   sol::this_state s) {
         sol::state_view lua(s);
         auto result = db.read_scalar_integers(collection, attribute);
-        sol::table t = lua.create_table();
-        for (size_t i = 0; i < result.size(); ++i) {
-            t[i + 1] = result[i];
-        }
-        return t;
+        return sequence_to_lua(lua, result);
     }
 
     static sol::table read_scalar_floats_to_lua(Database& db,
@@ -252,11 +497,7 @@ struct LuaRunner::Impl {
                                                 sol::this_state s) {
         sol::state_view lua(s);
         auto result = db.read_scalar_floats(collection, attribute);
-        sol::table t = lua.create_table();
-        for (size_t i = 0; i < result.size(); ++i) {
-            t[i + 1] = result[i];
-        }
-        return t;
+        return sequence_to_lua(lua, result);
     }
 
     static sol::table read_vector_integers_to_lua(Database& db,
@@ -265,13 +506,9 @@ struct LuaRunner::Impl {
                                                   sol::this_state s) {
         sol::state_view lua(s);
         auto result = db.read_vector_integers(collection, attribute);
-        sol::table outer = lua.create_table();
+        sol::table outer = lua.create_table(static_cast<int>(result.size()), 0);
         for (size_t i = 0; i < result.size(); ++i) {
-            sol::table inner = lua.create_table();
-            for (size_t j = 0; j < result[i].size(); ++j) {
-                inner[j + 1] = result[i][j];
-            }
-            outer[i + 1] = inner;
+            outer.raw_set(i + 1, sequence_to_lua(lua, result[i]));
         }
         return outer;
     }
@@ -282,13 +519,9 @@ struct LuaRunner::Impl {
                                                 sol::this_state s) {
         sol::state_view lua(s);
         auto result = db.read_vector_floats(collection, attribute);
-        sol::table outer = lua.create_table();
+        sol::table outer = lua.create_table(static_cast<int>(result.size()), 0);
         for (size_t i = 0; i < result.size(); ++i) {
-            sol::table inner = lua.create_table();
-            for (size_t j = 0; j < result[i].size(); ++j) {
-                inner[j + 1] = result[i][j];
-            }
-            outer[i + 1] = inner;
+            outer.raw_set(i + 1, sequence_to_lua(lua, result[i]));
         }
         return outer;
     }
@@ -299,13 +532,9 @@ struct LuaRunner::Impl {
                                                  sol::this_state s) {
         sol::state_view lua(s);
         auto result = db.read_vector_strings(collection, attribute);
-        sol::table outer = lua.create_table();
+        sol::table outer = lua.create_table(static_cast<int>(result.size()), 0);
         for (size_t i = 0; i < result.size(); ++i) {
-            sol::table inner = lua.create_table();
-            for (size_t j = 0; j < result[i].size(); ++j) {
-                inner[j + 1] = result[i][j];
-            }
-            outer[i + 1] = inner;
+            outer.raw_set(i + 1, sequence_to_lua(lua, result[i]));
         }
         return outer;
     }
@@ -358,11 +587,7 @@ struct LuaRunner::Impl {
                                                         sol::this_state s) {
         sol::state_view lua(s);
         auto result = db.read_vector_integers_by_id(collection, attribute, id);
-        sol::table t = lua.create_table();
-        for (size_t i = 0; i < result.size(); ++i) {
-            t[i + 1] = result[i];
-        }
-        return t;
+        return sequence_to_lua(lua, result);
     }
 
     static sol::table read_vector_floats_by_id_to_lua(Database& db,
@@ -372,11 +597,7 @@ struct LuaRunner::Impl {
                                                       sol::this_state s) {
         sol::state_view lua(s);
         auto result = db.read_vector_floats_by_id(collection, attribute, id);
-        sol::table t = lua.create_table();
-        for (size_t i = 0; i < result.size(); ++i) {
-            t[i + 1] = result[i];
-        }
-        return t;
+        return sequence_to_lua(lua, result);
     }
 
     static sol::table read_vector_strings_by_id_to_lua(Database& db,
@@ -386,11 +607,7 @@ struct LuaRunner::Impl {
                                                        sol::this_state s) {
         sol::state_view lua(s);
         auto result = db.read_vector_strings_by_id(collection, attribute, id);
-        sol::table t = lua.create_table();
-        for (size_t i = 0; i < result.size(); ++i) {
-            t[i + 1] = result[i];
-        }
-        return t;
+        return sequence_to_lua(lua, result);
     }
 
     // Read set by ID helpers - return table
@@ -401,11 +618,7 @@ struct LuaRunner::Impl {
                                                      sol::this_state s) {
         sol::state_view lua(s);
         auto result = db.read_set_integers_by_id(collection, attribute, id);
-        sol::table t = lua.create_table();
-        for (size_t i = 0; i < result.size(); ++i) {
-            t[i + 1] = result[i];
-        }
-        return t;
+        return sequence_to_lua(lua, result);
     }
 
     static sol::table read_set_floats_by_id_to_lua(Database& db,
@@ -415,11 +628,7 @@ struct LuaRunner::Impl {
                                                    sol::this_state s) {
         sol::state_view lua(s);
         auto result = db.read_set_floats_by_id(collection, attribute, id);
-        sol::table t = lua.create_table();
-        for (size_t i = 0; i < result.size(); ++i) {
-            t[i + 1] = result[i];
-        }
-        return t;
+        return sequence_to_lua(lua, result);
     }
 
     static sol::table read_set_strings_by_id_to_lua(Database& db,
@@ -429,23 +638,118 @@ struct LuaRunner::Impl {
                                                     sol::this_state s) {
         sol::state_view lua(s);
         auto result = db.read_set_strings_by_id(collection, attribute, id);
-        sol::table t = lua.create_table();
-        for (size_t i = 0; i < result.size(); ++i) {
-            t[i + 1] = result[i];
+        return sequence_to_lua(lua, result);
+    }
+
+    // Read by IDs (batch) helpers - one entry per id in input order
+    static std::vector<int64_t> table_to_ids(sol::table ids) { return table_to_vector<int64_t>(ids); }
+
+    template <typename T>
+    static std::vector<T> table_to_vector(sol::table values) {
+        const size_t size = values.size();
+        std::vector<T> result;
+        result.reserve(size);
+        for (size_t i = 1; i <= size; ++i) {
+            result.push_back(values.raw_get<T>(i));
+        }
+        return result;
+    }
+
+    // Tables are pre-sized for the array part and filled with raw sets (no __newindex lookup)
+    template <typename Range>
+    static sol::table sequence_to_lua(sol::state_view& lua, const Range& values) {
+        sol::table t = lua.create_table(static_cast<int>(std::size(values)), 0);
+        size_t index = 1;
+        for (const auto& value : values) {
+            t.raw_set(index++, value);
         }
         return t;
     }
 
-    static sol::table read_element_ids_to_lua(Database& db, const std::string& collection, sol::this_state s) {
+    // Null entries are left as nil, so the table may have holes
+    template <typename T>
+    static sol::table nullable_column_to_lua(sol::this_state s, const NullableColumn<T>& column) {
         sol::state_view lua(s);
-        auto result = db.read_element_ids(collection);
-        sol::table t = lua.create_table();
-        for (size_t i = 0; i < result.size(); ++i) {
-            t[i + 1] = result[i];
+        sol::table t = lua.create_table(static_cast<int>(column.size()), 0);
+        for (size_t i = 0; i < column.size(); ++i) {
+            if (column.is_valid(i)) {
+                t.raw_set(i + 1, column.values[i]);
+            }
         }
         return t;
     }
 
+    template <typename T>
+    static sol::table flat_vectors_to_lua(sol::this_state s, const FlatVectors<T>& groups) {
+        sol::state_view lua(s);
+        sol::table outer = lua.create_table(static_cast<int>(groups.size()), 0);
+        for (size_t i = 0; i < groups.size(); ++i) {
+            outer.raw_set(i + 1, sequence_to_lua(lua, groups[i]));
+        }
+        return outer;
+    }
+
+    // Iterators step a Cursor on demand, so only the current element is materialized in Lua.
+    // The cursor is owned by the iterator closure and finalized when the closure is collected.
+    using IteratorStep = std::tuple<sol::object, sol::object>;
+
+    static sol::object iter_scalars_to_lua(Database& db,
+                                           const std::string& collection,
+                                           sol::table attributes,
+                                           sol::this_state s) {
+        sol::state_view lua(s);
+        auto names = table_to_vector<std::string>(attributes);
+        auto cursor = std::make_shared<Cursor>(db.cursor_scalars(collection, names));
+        return sol::make_object(lua, [cursor, names](sol::variadic_args, sol::this_state state) -> IteratorStep {
+            sol::state_view lua(state);
+            if (!cursor->next()) {
+                return {sol::make_object(lua, sol::lua_nil), sol::make_object(lua, sol::lua_nil)};
+            }
+            sol::table row = lua.create_table(0, static_cast<int>(names.size()));
+            for (size_t i = 0; i < names.size(); ++i) {
+                row.raw_set(names[i], value_to_lua(lua, cursor->value(i + 1)));
+            }
+            return {value_to_lua(lua, cursor->value(0)), row};
+        });
+    }
+
+    // The cursor stays one row ahead: pending means it already sits on the next element's first value
+    struct VectorIteration {
+        Cursor cursor;
+        bool pending = false;
+    };
+
+    // Yields (id, values) per element; elements with an empty vector are skipped
+    static sol::object iter_vector_to_lua(Database& db,
+                                          const std::string& collection,
+                                          const std::string& attribute,
+                                          sol::this_state s) {
+        sol::state_view lua(s);
+        auto iteration = std::make_shared<VectorIteration>(VectorIteration{db.cursor_vector(collection, attribute)});
+        iteration->pending = iteration->cursor.next();
+        return sol::make_object(lua, [iteration](sol::variadic_args, sol::this_state state) -> IteratorStep {
+            sol::state_view lua(state);
+            auto& cursor = iteration->cursor;
+            if (!iteration->pending) {
+                return {sol::make_object(lua, sol::lua_nil), sol::make_object(lua, sol::lua_nil)};
+            }
+            const auto id = cursor.get_integer(0);
+            sol::table values = lua.create_table();
+            size_t index = 1;
+            do {
+                values.raw_set(index++, value_to_lua(lua, cursor.value(2)));
+                iteration->pending = cursor.next();
+            } while (iteration->pending && cursor.get_integer(0) == id);
+            return {sol::make_object(lua, *id), values};
+        });
+    }
+
+    static sol::table read_element_ids_to_lua(Database& db, const std::string& collection, sol::this_state s) {
+        sol::state_view lua(s);
+        auto result = db.read_element_ids(collection);
+        return sequence_to_lua(lua, result);
+    }
+
     static sol::table list_scalar_metadata_to_lua(Database& db, const std::string& collection, sol::this_state s) {
         sol::state_view lua(s);
         auto metadata_list = db.list_scalar_attributes(collection);
@@ -664,29 +968,23 @@ struct LuaRunner::Impl {
         sol::table result = lua.create_table();
 
         for (const auto& group : db.list_vector_groups(collection)) {
-            sol::table vec = lua.create_table();
+            sol::table vec;
             DataType data_type = get_value_data_type(group.value_columns);
             switch (data_type) {
             case DataType::Integer: {
                 auto values = db.read_vector_integers_by_id(collection, group.group_name, id);
-                for (size_t i = 0; i < values.size(); ++i) {
-                    vec[i + 1] = values[i];
-                }
+                vec = sequence_to_lua(lua, values);
                 break;
             }
             case DataType::Real: {
                 auto values = db.read_vector_floats_by_id(collection, group.group_name, id);
-                for (size_t i = 0; i < values.size(); ++i) {
-                    vec[i + 1] = values[i];
-                }
+                vec = sequence_to_lua(lua, values);
                 break;
             }
             case DataType::Text:
             case DataType::DateTime: {
                 auto values = db.read_vector_strings_by_id(collection, group.group_name, id);
-                for (size_t i = 0; i < values.size(); ++i) {
-                    vec[i + 1] = values[i];
-                }
+                vec = sequence_to_lua(lua, values);
                 break;
             }
             }
@@ -701,29 +999,23 @@ struct LuaRunner::Impl {
         sol::table result = lua.create_table();
 
         for (const auto& group : db.list_set_groups(collection)) {
-            sol::table set = lua.create_table();
+            sol::table set;
             DataType data_type = get_value_data_type(group.value_columns);
             switch (data_type) {
             case DataType::Integer: {
                 auto values = db.read_set_integers_by_id(collection, group.group_name, id);
-                for (size_t i = 0; i < values.size(); ++i) {
-                    set[i + 1] = values[i];
-                }
+                set = sequence_to_lua(lua, values);
                 break;
             }
             case DataType::Real: {
                 auto values = db.read_set_floats_by_id(collection, group.group_name, id);
-                for (size_t i = 0; i < values.size(); ++i) {
-                    set[i + 1] = values[i];
-                }
+                set = sequence_to_lua(lua, values);
                 break;
             }
             case DataType::Text:
             case DataType::DateTime: {
                 auto values = db.read_set_strings_by_id(collection, group.group_name, id);
-                for (size_t i = 0; i < values.size(); ++i) {
-                    set[i + 1] = values[i];
-                }
+                set = sequence_to_lua(lua, values);
                 break;
             }
             }
@@ -742,11 +1034,19 @@ LuaRunner::LuaRunner(LuaRunner&&) noexcept = default;
 LuaRunner& LuaRunner::operator=(LuaRunner&&) noexcept = default;
 
 void LuaRunner::run(const std::string& script) {
-    auto result = impl_->lua.safe_script(script, sol::script_pass_on_error);
-    if (!result.valid()) {
-        sol::error err = result;
-        throw std::runtime_error(std::string("Lua error: ") + err.what());
-    }
+    Impl::check(impl_->load(script)());
+}
+
+size_t LuaRunner::compile(const std::string& name, const std::string& script) {
+    return impl_->compile(name, script);
+}
+
+void LuaRunner::run(size_t handle, const std::vector<Value>& args) {
+    impl_->run(handle, args);
+}
+
+void LuaRunner::release(size_t handle) {
+    impl_->release(handle);
 }
 
 }  // namespace quiver
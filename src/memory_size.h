@@ -0,0 +1,72 @@
+#ifndef QUIVER_MEMORY_SIZE_H
+#define QUIVER_MEMORY_SIZE_H
+
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace quiver {
+
+// Heap bytes a value holds beyond sizeof(value), for Database::memory_usage. Estimates: container nodes are counted
+// as their payload plus the usual two or three pointers, allocator overhead is ignored. Overloads for other types
+// live next to them in namespace quiver, so the container overloads find them by ADL.
+template <typename T>
+    requires std::is_arithmetic_v<T> || std::is_pointer_v<T>
+size_t heap_bytes(const T&) {
+    return 0;
+}
+
+inline size_t heap_bytes(const std::string& value) {
+    // Short strings live in the object itself
+    return value.capacity() > std::string().capacity() ? value.capacity() + 1 : 0;
+}
+
+template <typename T>
+size_t heap_bytes(const std::optional<T>& value);
+template <typename T>
+size_t heap_bytes(const std::vector<T>& values);
+template <typename K, typename V>
+size_t heap_bytes(const std::map<K, V>& values);
+template <typename K, typename V>
+size_t heap_bytes(const std::unordered_map<K, V>& values);
+
+template <typename T>
+size_t heap_bytes(const std::optional<T>& value) {
+    return value ? heap_bytes(*value) : 0;
+}
+
+template <typename T>
+size_t heap_bytes(const std::vector<T>& values) {
+    auto bytes = values.capacity() * sizeof(T);
+    for (const auto& value : values) {
+        bytes += heap_bytes(value);
+    }
+    return bytes;
+}
+
+template <typename K, typename V>
+size_t heap_bytes(const std::map<K, V>& values) {
+    auto bytes = values.size() * (sizeof(std::pair<const K, V>) + 4 * sizeof(void*));
+    for (const auto& [key, value] : values) {
+        bytes += heap_bytes(key) + heap_bytes(value);
+    }
+    return bytes;
+}
+
+template <typename K, typename V>
+size_t heap_bytes(const std::unordered_map<K, V>& values) {
+    auto bytes = values.bucket_count() * sizeof(void*) +
+                 values.size() * (sizeof(std::pair<const K, V>) + 2 * sizeof(void*));
+    for (const auto& [key, value] : values) {
+        bytes += heap_bytes(key) + heap_bytes(value);
+    }
+    return bytes;
+}
+
+}  // namespace quiver
+
+#endif  // QUIVER_MEMORY_SIZE_H
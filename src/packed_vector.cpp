@@ -0,0 +1,342 @@
+#include "packed_vector.h"
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <sqlite3.h>
+#include <stdexcept>
+
+namespace quiver::packed_vector {
+
+namespace {
+
+// Columns of quiver_unpack; data is the hidden argument
+constexpr int kIndexColumn = 0;
+constexpr int kValueColumn = 1;
+constexpr int kDataColumn = 2;
+
+struct UnpackCursor {
+    sqlite3_vtab_cursor base{};
+    std::vector<double> values;
+    size_t position = 0;
+};
+
+int unpack_connect(sqlite3* db, void*, int, const char* const*, sqlite3_vtab** out, char**) {
+    const auto rc = sqlite3_declare_vtab(db, "CREATE TABLE x(vector_index INTEGER, value REAL, data HIDDEN)");
+    if (rc != SQLITE_OK) {
+        return rc;
+    }
+    sqlite3_vtab_config(db, SQLITE_VTAB_INNOCUOUS);
+    *out = static_cast<sqlite3_vtab*>(sqlite3_malloc(sizeof(sqlite3_vtab)));
+    if (!*out) {
+        return SQLITE_NOMEM;
+    }
+    std::memset(*out, 0, sizeof(sqlite3_vtab));
+    return SQLITE_OK;
+}
+
+int unpack_disconnect(sqlite3_vtab* vtab) {
+    sqlite3_free(vtab);
+    return SQLITE_OK;
+}
+
+// The BLOB argument must be bound: without it there is nothing to expand
+int unpack_best_index(sqlite3_vtab*, sqlite3_index_info* info) {
+    for (int i = 0; i < info->nConstraint; ++i) {
+        const auto& constraint = info->aConstraint[i];
+        if (constraint.iColumn != kDataColumn || constraint.op != SQLITE_INDEX_CONSTRAINT_EQ) {
+            continue;
+        }
+        if (!constraint.usable) {
+            return SQLITE_CONSTRAINT;
+        }
+        info->aConstraintUsage[i].argvIndex = 1;
+        info->aConstraintUsage[i].omit = 1;
+        info->idxNum = 1;
+        info->estimatedCost = 10;
+        info->estimatedRows = 100;
+        // Rows come out in vector_index order
+        if (info->nOrderBy == 1 && info->aOrderBy[0].iColumn == kIndexColumn && !info->aOrderBy[0].desc) {
+            info->orderByConsumed = 1;
+        }
+        return SQLITE_OK;
+    }
+    info->idxNum = 0;
+    info->estimatedCost = 1e12;
+    return SQLITE_OK;
+}
+
+int unpack_open(sqlite3_vtab*, sqlite3_vtab_cursor** out) {
+    auto* cursor = new (std::nothrow) UnpackCursor();
+    if (!cursor) {
+        return SQLITE_NOMEM;
+    }
+    *out = &cursor->base;
+    return SQLITE_OK;
+}
+
+int unpack_close(sqlite3_vtab_cursor* base) {
+    delete reinterpret_cast<UnpackCursor*>(base);
+    return SQLITE_OK;
+}
+
+int unpack_filter(sqlite3_vtab_cursor* base, int idx_num, const char*, int, sqlite3_value** argv) {
+    auto* cursor = reinterpret_cast<UnpackCursor*>(base);
+    cursor->values.clear();
+    cursor->position = 0;
+    // NULL (an empty vector) and a missing argument expand to no rows
+    if (idx_num != 1 || sqlite3_value_type(argv[0]) == SQLITE_NULL) {
+        return SQLITE_OK;
+    }
+    if (sqlite3_value_type(argv[0]) != SQLITE_BLOB) {
+        base->pVtab->zErrMsg = sqlite3_mprintf("quiver_unpack: argument is not a BLOB");
+        return SQLITE_ERROR;
+    }
+    const auto* data = sqlite3_value_blob(argv[0]);
+    const auto size = static_cast<size_t>(sqlite3_value_bytes(argv[0]));
+    if (size % kValueSize != 0) {
+        base->pVtab->zErrMsg = sqlite3_mprintf("quiver_unpack: BLOB size is not a multiple of 8");
+        return SQLITE_ERROR;
+    }
+    cursor->values = decode(data, size);
+    return SQLITE_OK;
+}
+
+int unpack_next(sqlite3_vtab_cursor* base) {
+    ++reinterpret_cast<UnpackCursor*>(base)->position;
+    return SQLITE_OK;
+}
+
+int unpack_eof(sqlite3_vtab_cursor* base) {
+    const auto* cursor = reinterpret_cast<UnpackCursor*>(base);
+    return cursor->position >= cursor->values.size();
+}
+
+int unpack_column(sqlite3_vtab_cursor* base, sqlite3_context* context, int column) {
+    const auto* cursor = reinterpret_cast<UnpackCursor*>(base);
+    if (column == kIndexColumn) {
+        sqlite3_result_int64(context, static_cast<sqlite3_int64>(cursor->position + 1));
+    } else if (column == kValueColumn) {
+        sqlite3_result_double(context, cursor->values[cursor->position]);
+    } else {
+        sqlite3_result_null(context);
+    }
+    return SQLITE_OK;
+}
+
+int unpack_rowid(sqlite3_vtab_cursor* base, sqlite3_int64* rowid) {
+    *rowid = static_cast<sqlite3_int64>(reinterpret_cast<UnpackCursor*>(base)->position + 1);
+    return SQLITE_OK;
+}
+
+sqlite3_module make_unpack_module() {
+    // Eponymous-only (no xCreate): used as quiver_unpack(blob) without CREATE VIRTUAL TABLE
+    sqlite3_module module{};
+    module.xConnect = unpack_connect;
+    module.xBestIndex = unpack_best_index;
+    module.xDisconnect = unpack_disconnect;
+    module.xOpen = unpack_open;
+    module.xClose = unpack_close;
+    module.xFilter = unpack_filter;
+    module.xNext = unpack_next;
+    module.xEof = unpack_eof;
+    module.xColumn = unpack_column;
+    module.xRowid = unpack_rowid;
+    return module;
+}
+
+const sqlite3_module unpack_module = make_unpack_module();
+
+// Decodes a packed vector argument into values; false (with the error set) unless it is a BLOB of float64s or NULL
+bool vector_argument(sqlite3_context* context, sqlite3_value* value, const char* function, std::vector<double>& out) {
+    out.clear();
+    const auto type = sqlite3_value_type(value);
+    if (type == SQLITE_NULL) {
+        return true;
+    }
+    const auto size = static_cast<size_t>(sqlite3_value_bytes(value));
+    if (type != SQLITE_BLOB || size % kValueSize != 0) {
+        const auto message = std::string(function) + ": argument is not a packed vector";
+        sqlite3_result_error(context, message.c_str(), -1);
+        return false;
+    }
+    out = decode(sqlite3_value_blob(value), size);
+    return true;
+}
+
+// An empty vector is stored and returned as NULL
+void result_vector(sqlite3_context* context, const std::vector<double>& values) {
+    if (values.empty()) {
+        sqlite3_result_null(context);
+        return;
+    }
+    const auto bytes = encode(values);
+    sqlite3_result_blob64(context, bytes.data(), bytes.size(), SQLITE_TRANSIENT);
+}
+
+void length_function(sqlite3_context* context, int, sqlite3_value** argv) {
+    const auto type = sqlite3_value_type(argv[0]);
+    const auto size = type == SQLITE_BLOB ? static_cast<size_t>(sqlite3_value_bytes(argv[0])) : 0;
+    if ((type != SQLITE_NULL && type != SQLITE_BLOB) || size % kValueSize != 0) {
+        sqlite3_result_error(context, "quiver_vector_length: argument is not a packed vector", -1);
+        return;
+    }
+    sqlite3_result_int64(context, static_cast<sqlite3_int64>(size / kValueSize));
+}
+
+void dot_function(sqlite3_context* context, int, sqlite3_value** argv) {
+    if (sqlite3_value_type(argv[0]) == SQLITE_NULL || sqlite3_value_type(argv[1]) == SQLITE_NULL) {
+        sqlite3_result_null(context);
+        return;
+    }
+    std::vector<double> a;
+    std::vector<double> b;
+    if (!vector_argument(context, argv[0], "quiver_vector_dot", a) ||
+        !vector_argument(context, argv[1], "quiver_vector_dot", b)) {
+        return;
+    }
+    if (a.size() != b.size()) {
+        sqlite3_result_error(context, "quiver_vector_dot: vectors differ in length", -1);
+        return;
+    }
+    double dot = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        dot += a[i] * b[i];
+    }
+    sqlite3_result_double(context, dot);
+}
+
+// Aggregate state lives in SQLite's zeroed context memory; the vector is created on the first row
+struct AggregateState {
+    std::vector<double>* values;
+};
+
+std::vector<double>* aggregate_values(sqlite3_context* context) {
+    auto* state = static_cast<AggregateState*>(sqlite3_aggregate_context(context, sizeof(AggregateState)));
+    if (state && !state->values) {
+        state->values = new (std::nothrow) std::vector<double>();
+    }
+    if (!state || !state->values) {
+        sqlite3_result_error_nomem(context);
+        return nullptr;
+    }
+    return state->values;
+}
+
+// Returns the accumulated vector (NULL for no rows) and frees it
+void aggregate_final(sqlite3_context* context) {
+    auto* state = static_cast<AggregateState*>(sqlite3_aggregate_context(context, 0));
+    auto* values = state ? state->values : nullptr;
+    result_vector(context, values ? *values : std::vector<double>{});
+    delete values;
+}
+
+// quiver_pack(value): the values of the group, in the order the rows arrive, with NaN for NULL
+void pack_step(sqlite3_context* context, int, sqlite3_value** argv) {
+    const auto type = sqlite3_value_type(argv[0]);
+    if (type != SQLITE_NULL && type != SQLITE_INTEGER && type != SQLITE_FLOAT) {
+        sqlite3_result_error(context, "quiver_pack: value is not a number", -1);
+        return;
+    }
+    if (auto* values = aggregate_values(context)) {
+        values->push_back(type == SQLITE_NULL ? std::numeric_limits<double>::quiet_NaN()
+                                              : sqlite3_value_double(argv[0]));
+    }
+}
+
+// quiver_vector_sum(vector): element-wise sum of the group's packed vectors, which must have one length
+void sum_step(sqlite3_context* context, int, sqlite3_value** argv) {
+    std::vector<double> row;
+    if (!vector_argument(context, argv[0], "quiver_vector_sum", row) || row.empty()) {
+        return;
+    }
+    auto* values = aggregate_values(context);
+    if (!values) {
+        return;
+    }
+    if (values->empty()) {
+        *values = std::move(row);
+        return;
+    }
+    if (values->size() != row.size()) {
+        sqlite3_result_error(context, "quiver_vector_sum: vectors differ in length", -1);
+        return;
+    }
+    for (size_t i = 0; i < row.size(); ++i) {
+        (*values)[i] += row[i];
+    }
+}
+
+}  // namespace
+
+double decode_value(const unsigned char* bytes) {
+    uint64_t bits = 0;
+    for (size_t b = 0; b < kValueSize; ++b) {
+        bits |= static_cast<uint64_t>(bytes[b]) << (8 * b);
+    }
+    return std::bit_cast<double>(bits);
+}
+
+void encode_value(double value, unsigned char* bytes) {
+    const auto bits = std::bit_cast<uint64_t>(value);
+    for (size_t b = 0; b < kValueSize; ++b) {
+        bytes[b] = static_cast<unsigned char>(bits >> (8 * b));
+    }
+}
+
+std::string encode(const std::vector<double>& values) {
+    std::string bytes(values.size() * kValueSize, '\0');
+    if constexpr (std::endian::native == std::endian::little) {
+        if (!values.empty()) {
+            std::memcpy(bytes.data(), values.data(), bytes.size());
+        }
+    } else {
+        for (size_t i = 0; i < values.size(); ++i) {
+            encode_value(values[i], reinterpret_cast<unsigned char*>(bytes.data() + i * kValueSize));
+        }
+    }
+    return bytes;
+}
+
+std::vector<double> decode(const void* data, size_t size) {
+    if (size % kValueSize != 0) {
+        throw std::runtime_error("Packed vector size " + std::to_string(size) + " is not a multiple of " +
+                                 std::to_string(kValueSize));
+    }
+    std::vector<double> values(size / kValueSize);
+    if constexpr (std::endian::native == std::endian::little) {
+        if (size > 0) {
+            std::memcpy(values.data(), data, size);
+        }
+    } else {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i] = decode_value(bytes + i * kValueSize);
+        }
+    }
+    return values;
+}
+
+void register_functions(sqlite3* db) {
+    constexpr int flags = SQLITE_UTF8 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS;
+    if (sqlite3_create_module(db, "quiver_unpack", &unpack_module, nullptr) != SQLITE_OK ||
+        sqlite3_create_function(db, "quiver_vector_length", 1, flags, nullptr, length_function, nullptr, nullptr) !=
+            SQLITE_OK ||
+        sqlite3_create_function(db, "quiver_vector_dot", 2, flags, nullptr, dot_function, nullptr, nullptr) !=
+            SQLITE_OK ||
+        sqlite3_create_function(db, "quiver_pack", 1, flags, nullptr, nullptr, pack_step, aggregate_final) !=
+            SQLITE_OK ||
+        sqlite3_create_function(db, "quiver_vector_sum", 1, flags, nullptr, nullptr, sum_step, aggregate_final) !=
+            SQLITE_OK) {
+        throw std::runtime_error("Failed to register packed vector functions: " + std::string(sqlite3_errmsg(db)));
+    }
+}
+
+std::string rows(const std::string& table, const std::string& column) {
+    return "(SELECT t.id AS id, u.vector_index AS vector_index, u.value AS " + column + " FROM " + table +
+           " AS t, quiver_unpack(t." + column + ") AS u)";
+}
+
+}  // namespace quiver::packed_vector
@@ -0,0 +1,40 @@
+#ifndef QUIVER_PACKED_VECTOR_H
+#define QUIVER_PACKED_VECTOR_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+struct sqlite3;
+
+namespace quiver {
+
+// Packed vector tables (Schema::is_packed_vector_table) keep one row per element and a whole vector per BLOB column,
+// as little-endian float64s, instead of one (id, vector_index) row per entry. The quiver_unpack table-valued
+// function expands a BLOB back into (vector_index, value) rows, so SQL written against the row layout keeps working
+// with rows() as its FROM source.
+namespace packed_vector {
+
+constexpr size_t kValueSize = sizeof(double);
+
+std::string encode(const std::vector<double>& values);
+// Throws unless size is a multiple of kValueSize; data may be null when size is 0
+std::vector<double> decode(const void* data, size_t size);
+double decode_value(const unsigned char* bytes);
+void encode_value(double value, unsigned char* bytes);
+
+// Registers on the connection, with NULL standing for an empty vector:
+//   quiver_unpack(blob) -> (vector_index INTEGER from 1, value REAL) rows
+//   quiver_vector_length(blob) -> INTEGER and quiver_vector_dot(blob, blob) -> REAL
+//   quiver_pack(value) aggregate -> BLOB of the group's numbers in row order, NULL values as NaN
+//   quiver_vector_sum(blob) aggregate -> BLOB, the element-wise sum of equally long vectors
+void register_functions(sqlite3* db);
+
+// Subquery with the (id, vector_index, column) rows of a packed table, one per stored value (unordered)
+std::string rows(const std::string& table, const std::string& column);
+
+}  // namespace packed_vector
+
+}  // namespace quiver
+
+#endif  // QUIVER_PACKED_VECTOR_H
@@ -47,4 +47,11 @@ std::optional<std::string> Row::get_string(size_t index) const {
     return std::nullopt;
 }
 
+std::optional<Blob> Row::get_blob(size_t index) const {
+    if (const auto* val = std::get_if<Blob>(&values_[index])) {
+        return *val;
+    }
+    return std::nullopt;
+}
+
 }  // namespace quiver
\ No newline at end of file
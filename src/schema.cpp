@@ -1,10 +1,72 @@
 #include "quiver/schema.h"
 
+#include "memory_size.h"
+
 #include <sqlite3.h>
 #include <stdexcept>
 
 namespace quiver {
 
+size_t heap_bytes(const ColumnDefinition& column) {
+    return heap_bytes(column.name) + heap_bytes(column.default_value);
+}
+
+size_t heap_bytes(const ForeignKey& fk) {
+    return heap_bytes(fk.from_column) + heap_bytes(fk.to_table) + heap_bytes(fk.to_column) + heap_bytes(fk.on_update) +
+           heap_bytes(fk.on_delete);
+}
+
+size_t heap_bytes(const Index& index) {
+    return heap_bytes(index.name) + heap_bytes(index.columns);
+}
+
+size_t heap_bytes(const TableDefinition& table) {
+    return heap_bytes(table.name) + heap_bytes(table.columns) + heap_bytes(table.foreign_keys) +
+           heap_bytes(table.indexes);
+}
+
+size_t heap_bytes(const AttributeLocation& location) {
+    return heap_bytes(location.table);
+}
+
+namespace {
+
+AttributeLocation make_location(const TableDefinition& table, AttributeKind kind, const ColumnDefinition* column) {
+    AttributeLocation location{table.name, kind, column, nullptr};
+    if (column) {
+        for (const auto& fk : table.foreign_keys) {
+            if (fk.from_column == column->name) {
+                location.foreign_key = &fk;
+                break;
+            }
+        }
+    }
+    return location;
+}
+
+std::string column_text(sqlite3_stmt* stmt, int col) {
+    const auto* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt, col));
+    return text ? std::string(text, static_cast<size_t>(sqlite3_column_bytes(stmt, col))) : std::string();
+}
+
+template <typename RowFn>
+void for_each_row(sqlite3* db, const std::string& sql, const char* what, RowFn&& on_row) {
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+        throw std::runtime_error(std::string("Failed to query schema ") + what + ": " + sqlite3_errmsg(db));
+    }
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        on_row(stmt);
+    }
+    sqlite3_finalize(stmt);
+    if (rc != SQLITE_DONE) {
+        throw std::runtime_error(std::string("Failed to query schema ") + what + ": " + sqlite3_errmsg(db));
+    }
+}
+
+}  // namespace
+
 // TableDefinition methods
 
 std::optional<DataType> TableDefinition::get_data_type(const std::string& column) const {
@@ -27,6 +89,20 @@ const ColumnDefinition* TableDefinition::get_column(const std::string& column) c
     return nullptr;
 }
 
+// Schema copy (the index points into tables_, so it is rebuilt rather than copied)
+
+Schema::Schema(const Schema& other) : tables_(other.tables_) {
+    build_index();
+}
+
+Schema& Schema::operator=(const Schema& other) {
+    if (this != &other) {
+        tables_ = other.tables_;
+        build_index();
+    }
+    return *this;
+}
+
 // Schema factory
 
 Schema Schema::from_database(sqlite3* db) {
@@ -38,27 +114,27 @@ Schema Schema::from_database(sqlite3* db) {
 // Schema public methods
 
 const TableDefinition* Schema::get_table(const std::string& name) const {
-    auto it = tables_.find(name);
-    if (it != tables_.end()) {
-        return &it->second;
+    auto it = table_index_.find(name);
+    if (it != table_index_.end()) {
+        return it->second.table;
     }
     return nullptr;
 }
 
 bool Schema::has_table(const std::string& name) const {
-    return tables_.find(name) != tables_.end();
+    return table_index_.find(name) != table_index_.end();
 }
 
 DataType Schema::get_data_type(const std::string& table, const std::string& column) const {
-    const auto* tbl = get_table(table);
-    if (!tbl) {
+    auto table_it = table_index_.find(table);
+    if (table_it == table_index_.end()) {
         throw std::runtime_error("Table not found in schema: " + table);
     }
-    auto type = tbl->get_data_type(column);
-    if (!type) {
+    auto column_it = table_it->second.columns.find(column);
+    if (column_it == table_it->second.columns.end()) {
         throw std::runtime_error("Column '" + column + "' not found in table '" + table + "'");
     }
-    return *type;
+    return column_it->second->type;
 }
 
 std::string Schema::vector_table_name(const std::string& collection, const std::string& group) {
@@ -80,6 +156,17 @@ bool Schema::is_vector_table(const std::string& table) const {
     return table.find("_vector_") != std::string::npos;
 }
 
+bool Schema::is_packed_vector_table(const std::string& table) const {
+    const auto* definition = is_vector_table(table) ? get_table(table) : nullptr;
+    return definition && !definition->has_column("vector_index");
+}
+
+bool Schema::is_compressed_time_series_table(const std::string& table) const {
+    const auto* definition = is_time_series_table(table) ? get_table(table) : nullptr;
+    const auto* date_time = definition ? definition->get_column("date_time") : nullptr;
+    return date_time && date_time->packed;
+}
+
 bool Schema::is_set_table(const std::string& table) const {
     return table.find("_set_") != std::string::npos;
 }
@@ -97,49 +184,46 @@ std::string Schema::get_parent_collection(const std::string& table) const {
 }
 
 std::string Schema::find_vector_table(const std::string& collection, const std::string& attribute) const {
-    // First try: Collection_vector_attribute
-    auto vt = vector_table_name(collection, attribute);
-    if (has_table(vt)) {
-        return vt;
-    }
-
-    // Second try: search all vector tables for the collection
-    for (const auto& table_name : table_names()) {
-        if (!is_vector_table(table_name))
-            continue;
-        if (get_parent_collection(table_name) != collection)
-            continue;
-
-        const auto* table_def = get_table(table_name);
-        if (table_def && table_def->has_column(attribute)) {
-            return table_name;
-        }
+    if (const auto* location = find_attribute(collection, attribute, AttributeKind::Vector)) {
+        return location->table;
     }
-
     throw std::runtime_error("Vector attribute '" + attribute + "' not found for collection '" + collection + "'");
 }
 
 std::string Schema::find_set_table(const std::string& collection, const std::string& attribute) const {
-    // First try: Collection_set_attribute
-    auto st = set_table_name(collection, attribute);
-    if (has_table(st)) {
-        return st;
+    if (const auto* location = find_attribute(collection, attribute, AttributeKind::Set)) {
+        return location->table;
     }
+    throw std::runtime_error("Set attribute '" + attribute + "' not found for collection '" + collection + "'");
+}
 
-    // Second try: search all set tables for the collection
-    for (const auto& table_name : table_names()) {
-        if (!is_set_table(table_name))
-            continue;
-        if (get_parent_collection(table_name) != collection)
-            continue;
-
-        const auto* table_def = get_table(table_name);
-        if (table_def && table_def->has_column(attribute)) {
-            return table_name;
-        }
+const AttributeLocation*
+Schema::find_attribute(const std::string& collection, const std::string& attribute, AttributeKind kind) const {
+    const auto* index = collection_index(collection);
+    if (!index) {
+        return nullptr;
     }
+    const auto& attributes = index->attributes[static_cast<size_t>(kind)];
+    auto it = attributes.find(attribute);
+    return it != attributes.end() ? &it->second : nullptr;
+}
 
-    throw std::runtime_error("Set attribute '" + attribute + "' not found for collection '" + collection + "'");
+const std::vector<std::string>& Schema::vector_tables(const std::string& collection) const {
+    static const std::vector<std::string> empty;
+    const auto* index = collection_index(collection);
+    return index ? index->vector_tables : empty;
+}
+
+const std::vector<std::string>& Schema::set_tables(const std::string& collection) const {
+    static const std::vector<std::string> empty;
+    const auto* index = collection_index(collection);
+    return index ? index->set_tables : empty;
+}
+
+const std::vector<std::string>& Schema::time_series_tables(const std::string& collection) const {
+    static const std::vector<std::string> empty;
+    const auto* index = collection_index(collection);
+    return index ? index->time_series_tables : empty;
 }
 
 std::vector<std::string> Schema::table_names() const {
@@ -151,6 +235,21 @@ std::vector<std::string> Schema::table_names() const {
     return names;
 }
 
+size_t Schema::memory_usage() const {
+    auto bytes = heap_bytes(tables_);
+    for (const auto& [name, index] : table_index_) {
+        bytes += heap_bytes(name) + heap_bytes(index.columns) + sizeof(index) + 2 * sizeof(void*);
+    }
+    for (const auto& [name, index] : collection_index_) {
+        bytes += heap_bytes(name) + heap_bytes(index.vector_tables) + heap_bytes(index.set_tables) +
+                 heap_bytes(index.time_series_tables) + sizeof(index) + 2 * sizeof(void*);
+        for (const auto& attributes : index.attributes) {
+            bytes += heap_bytes(attributes);
+        }
+    }
+    return bytes;
+}
+
 std::vector<std::string> Schema::collection_names() const {
     std::vector<std::string> names;
     for (const auto& [name, _] : tables_) {
@@ -164,135 +263,140 @@ std::vector<std::string> Schema::collection_names() const {
 // Schema private methods
 
 void Schema::load_from_database(sqlite3* db) {
-    // Get all table names
-    const char* sql = "SELECT name FROM sqlite_master WHERE type='table' AND name NOT LIKE 'sqlite_%'";
-
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        throw std::runtime_error("Failed to query table names");
-    }
-
-    std::vector<std::string> names;
-    while (sqlite3_step(stmt) == SQLITE_ROW) {
-        const char* name = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
-        if (name) {
-            names.emplace_back(name);
-        }
-    }
-    sqlite3_finalize(stmt);
-
-    // Load each table's metadata
-    for (const auto& name : names) {
-        TableDefinition table;
-        table.name = name;
-
-        auto columns = query_columns(db, name);
-        for (auto& col : columns) {
-            table.columns[col.name] = std::move(col);
-        }
-
-        table.foreign_keys = query_foreign_keys(db, name);
-        table.indexes = query_indexes(db, name);
-
-        tables_[name] = std::move(table);
-    }
-}
-
-std::vector<ColumnDefinition> Schema::query_columns(sqlite3* db, const std::string& table) {
-    std::vector<ColumnDefinition> columns;
-    std::string sql = "PRAGMA table_info(" + table + ")";
+    // One statement per kind of metadata covering every table, through the table-valued pragma functions
+    const std::string tables = " FROM sqlite_master AS m, ";
+    const std::string user_tables = " WHERE m.type = 'table' AND m.name NOT LIKE 'sqlite_%'";
+    const auto columns_sql = "SELECT m.name, c.name, c.type, c.\"notnull\", c.dflt_value, c.pk" + tables +
+                             "pragma_table_info(m.name) AS c" + user_tables;
+    const auto foreign_keys_sql = "SELECT m.name, f.\"table\", f.\"from\", f.\"to\", f.on_update, f.on_delete" +
+                                  tables + "pragma_foreign_key_list(m.name) AS f" + user_tables;
+    const auto indexes_sql = "SELECT m.name, i.name, i.\"unique\", ii.name" + tables +
+                             "pragma_index_list(m.name) AS i LEFT JOIN pragma_index_info(i.name) AS ii" + user_tables;
+
+    for_each_row(db, columns_sql, "columns", [&](sqlite3_stmt* stmt) {
+        const auto table_name = column_text(stmt, 0);
+        auto& table = tables_[table_name];
+        table.name = table_name;
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
-        throw std::runtime_error("Failed to query columns for table: " + table);
-    }
-
-    while (sqlite3_step(stmt) == SQLITE_ROW) {
         ColumnDefinition col;
-        const char* name = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
-        const char* type = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2));
-        const char* dflt_value = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 4));
-
-        col.name = name ? name : "";
-        std::string type_str = type ? type : "";
-        col.type = data_type_from_string(type_str);
+        col.name = column_text(stmt, 1);
+        const auto declared_type = column_text(stmt, 2);
+        col.packed = declared_type == "BLOB";
+        col.type = col.packed ? DataType::Real : data_type_from_string(declared_type);
         col.not_null = sqlite3_column_int(stmt, 3) != 0;
         col.primary_key = sqlite3_column_int(stmt, 5) != 0;
-        if (dflt_value) {
-            col.default_value = std::string(dflt_value);
+        if (sqlite3_column_type(stmt, 4) != SQLITE_NULL) {
+            col.default_value = column_text(stmt, 4);
         }
 
-        // Infer DATE_TIME type from column name for TEXT columns
-        if (col.type == DataType::Text && is_date_time_column(col.name)) {
+        // Infer DATE_TIME type from column name for TEXT columns (and the BLOB timestamps of compressed series)
+        const auto packed_date_time = col.packed && is_time_series_table(table_name);
+        if ((col.type == DataType::Text || packed_date_time) && is_date_time_column(col.name)) {
             col.type = DataType::DateTime;
         }
+        auto name = col.name;
+        table.columns[std::move(name)] = std::move(col);
+    });
 
-        columns.push_back(std::move(col));
-    }
-    sqlite3_finalize(stmt);
-    return columns;
+    for_each_row(db, foreign_keys_sql, "foreign keys", [&](sqlite3_stmt* stmt) {
+        ForeignKey fk;
+        fk.to_table = column_text(stmt, 1);
+        fk.from_column = column_text(stmt, 2);
+        fk.to_column = column_text(stmt, 3);
+        fk.on_update = column_text(stmt, 4);
+        fk.on_delete = column_text(stmt, 5);
+        tables_[column_text(stmt, 0)].foreign_keys.push_back(std::move(fk));
+    });
+
+    // Rows arrive grouped by table and index; expression columns have a null name and are skipped
+    for_each_row(db, indexes_sql, "indexes", [&](sqlite3_stmt* stmt) {
+        auto& indexes = tables_[column_text(stmt, 0)].indexes;
+        auto index_name = column_text(stmt, 1);
+        if (indexes.empty() || indexes.back().name != index_name) {
+            indexes.push_back(Index{std::move(index_name), sqlite3_column_int(stmt, 2) != 0, {}});
+        }
+        if (sqlite3_column_type(stmt, 3) != SQLITE_NULL) {
+            indexes.back().columns.push_back(column_text(stmt, 3));
+        }
+    });
+
+    build_index();
 }
 
-std::vector<ForeignKey> Schema::query_foreign_keys(sqlite3* db, const std::string& table) {
-    std::vector<ForeignKey> fks;
-    std::string sql = "PRAGMA foreign_key_list(" + table + ")";
+void Schema::build_index() {
+    table_index_.clear();
+    collection_index_.clear();
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
-        throw std::runtime_error("Failed to query foreign keys for table: " + table);
+    for (const auto& [name, table] : tables_) {
+        auto& entry = table_index_[name];
+        entry.table = &table;
+        entry.columns.reserve(table.columns.size());
+        for (const auto& [column_name, column] : table.columns) {
+            entry.columns.emplace(column_name, &column);
+        }
     }
 
-    while (sqlite3_step(stmt) == SQLITE_ROW) {
-        ForeignKey fk;
-        const char* to_table = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2));
-        const char* from_col = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
-        const char* to_col = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 4));
-        const char* on_update = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 5));
-        const char* on_delete = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 6));
-
-        fk.to_table = to_table ? to_table : "";
-        fk.from_column = from_col ? from_col : "";
-        fk.to_column = to_col ? to_col : "";
-        fk.on_update = on_update ? on_update : "";
-        fk.on_delete = on_delete ? on_delete : "";
-
-        fks.push_back(std::move(fk));
-    }
-    sqlite3_finalize(stmt);
-    return fks;
-}
+    auto add_columns = [](std::unordered_map<std::string, AttributeLocation>& attributes,
+                          const TableDefinition& table,
+                          AttributeKind kind) {
+        for (const auto& [column_name, column] : table.columns) {
+            // First table in name order wins
+            attributes.emplace(column_name, make_location(table, kind, &column));
+        }
+    };
 
-std::vector<Index> Schema::query_indexes(sqlite3* db, const std::string& table) {
-    std::vector<Index> indexes;
-    std::string sql = "PRAGMA index_list(" + table + ")";
+    for (const auto& [name, table] : tables_) {
+        if (is_collection(name)) {
+            add_columns(collection_index_[name].attributes[static_cast<size_t>(AttributeKind::Scalar)],
+                        table,
+                        AttributeKind::Scalar);
+            continue;
+        }
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
-        return indexes;
+        auto parent = get_parent_collection(name);
+        if (parent.empty()) {
+            continue;
+        }
+        auto& index = collection_index_[parent];
+        if (is_vector_table(name)) {
+            index.vector_tables.push_back(name);
+            add_columns(index.attributes[static_cast<size_t>(AttributeKind::Vector)], table, AttributeKind::Vector);
+        } else if (is_set_table(name)) {
+            index.set_tables.push_back(name);
+            add_columns(index.attributes[static_cast<size_t>(AttributeKind::Set)], table, AttributeKind::Set);
+        } else if (is_time_series_table(name)) {
+            index.time_series_tables.push_back(name);
+            add_columns(
+                index.attributes[static_cast<size_t>(AttributeKind::TimeSeries)], table, AttributeKind::TimeSeries);
+        }
     }
 
-    while (sqlite3_step(stmt) == SQLITE_ROW) {
-        Index idx;
-        const char* name = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
-        idx.name = name ? name : "";
-        idx.unique = sqlite3_column_int(stmt, 2) != 0;
-
-        // Get columns for this index
-        std::string idx_sql = "PRAGMA index_info(" + idx.name + ")";
-        sqlite3_stmt* idx_stmt = nullptr;
-        if (sqlite3_prepare_v2(db, idx_sql.c_str(), -1, &idx_stmt, nullptr) == SQLITE_OK) {
-            while (sqlite3_step(idx_stmt) == SQLITE_ROW) {
-                const char* col_name = reinterpret_cast<const char*>(sqlite3_column_text(idx_stmt, 2));
-                if (col_name) {
-                    idx.columns.emplace_back(col_name);
+    // Group names (Collection_vector_<group>) take precedence over column names
+    for (auto& [collection, index] : collection_index_) {
+        auto add_groups = [&](const std::vector<std::string>& tables, const std::string& prefix, AttributeKind kind) {
+            auto& attributes = index.attributes[static_cast<size_t>(kind)];
+            for (const auto& table_name : tables) {
+                if (table_name.size() <= prefix.size() || table_name.compare(0, prefix.size(), prefix) != 0) {
+                    continue;
+                }
+                auto group = table_name.substr(prefix.size());
+                auto it = attributes.find(group);
+                if (it != attributes.end() && it->second.table == table_name) {
+                    continue;
                 }
+                const auto& table = tables_.at(table_name);
+                attributes.insert_or_assign(group, make_location(table, kind, table.get_column(group)));
             }
-            sqlite3_finalize(idx_stmt);
-        }
-        indexes.push_back(std::move(idx));
+        };
+        add_groups(index.vector_tables, collection + "_vector_", AttributeKind::Vector);
+        add_groups(index.set_tables, collection + "_set_", AttributeKind::Set);
+        add_groups(index.time_series_tables, collection + "_time_series_", AttributeKind::TimeSeries);
     }
-    sqlite3_finalize(stmt);
-    return indexes;
+}
+
+const Schema::CollectionIndex* Schema::collection_index(const std::string& collection) const {
+    auto it = collection_index_.find(collection);
+    return it != collection_index_.end() ? &it->second : nullptr;
 }
 
 }  // namespace quiver
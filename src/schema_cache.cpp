@@ -0,0 +1,81 @@
+#include "schema_cache.h"
+
+#include "quiver/schema_validator.h"
+
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace quiver {
+
+namespace {
+
+// Beyond this many distinct schemas, entries no Database is using are dropped
+constexpr size_t kMaxIdleEntries = 16;
+
+std::mutex g_mutex;
+std::unordered_map<std::string, std::shared_ptr<const LoadedSchema>> g_entries;
+
+// Everything Schema::load_from_database derives its tables, columns, foreign keys and indexes from
+std::string schema_fingerprint(sqlite3* db) {
+    const char* sql = "SELECT type, name, tbl_name, sql FROM sqlite_master ORDER BY type, name";
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
+        throw std::runtime_error("Failed to read schema: " + std::string(sqlite3_errmsg(db)));
+    }
+    std::string fingerprint;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        for (int col = 0; col < 4; ++col) {
+            const auto* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt, col));
+            if (text) {
+                fingerprint.append(text, static_cast<size_t>(sqlite3_column_bytes(stmt, col)));
+            }
+            fingerprint.push_back('\0');
+        }
+    }
+    sqlite3_finalize(stmt);
+    return fingerprint;
+}
+
+void ensure_validated(const LoadedSchema& loaded) {
+    if (!loaded.validated) {
+        SchemaValidator validator(loaded.schema);
+        validator.validate();
+        loaded.validated = true;
+    }
+}
+
+}  // namespace
+
+std::shared_ptr<const LoadedSchema> SchemaCache::load(sqlite3* db, bool validate) {
+    auto fingerprint = schema_fingerprint(db);
+    std::shared_ptr<const LoadedSchema> cached;
+    {
+        std::lock_guard lock(g_mutex);
+        auto it = g_entries.find(fingerprint);
+        if (it != g_entries.end()) {
+            cached = it->second;
+        }
+    }
+    if (cached) {
+        if (validate) {
+            ensure_validated(*cached);
+        }
+        return cached;
+    }
+
+    // Loaded outside the lock; two threads racing on the same DDL both load, and the last one is kept
+    auto loaded = std::make_shared<const LoadedSchema>(Schema::from_database(db));
+    if (validate) {
+        ensure_validated(*loaded);
+    }
+
+    std::lock_guard lock(g_mutex);
+    if (g_entries.size() >= kMaxIdleEntries) {
+        std::erase_if(g_entries, [](const auto& entry) { return entry.second.use_count() == 1; });
+    }
+    g_entries[std::move(fingerprint)] = loaded;
+    return loaded;
+}
+
+}  // namespace quiver
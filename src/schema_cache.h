@@ -0,0 +1,40 @@
+#ifndef QUIVER_SCHEMA_CACHE_H
+#define QUIVER_SCHEMA_CACHE_H
+
+#include "quiver/schema.h"
+#include "quiver/type_validator.h"
+
+#include <atomic>
+#include <memory>
+#include <sqlite3.h>
+#include <string>
+
+namespace quiver {
+
+// A parsed and validated schema together with the TypeValidator that refers to it
+struct LoadedSchema {
+    explicit LoadedSchema(Schema loaded) : schema(std::move(loaded)), type_validator(schema) {}
+
+    LoadedSchema(const LoadedSchema&) = delete;
+    LoadedSchema& operator=(const LoadedSchema&) = delete;
+
+    Schema schema;
+    TypeValidator type_validator;
+    // Set once SchemaValidator has passed; an entry loaded with validation off is validated by the next caller
+    // that asks for it
+    mutable std::atomic<bool> validated{false};
+};
+
+// Process-wide cache of loaded schemas keyed by the full DDL in sqlite_master, so connections to files with
+// identical schemas (the same file opened again, or copies of one study) skip introspection and validation.
+// Entries stay cached after the last Database closes, so sequential opens in one process also hit. Thread-safe.
+class SchemaCache {
+public:
+    // Returns the cached schema for db's DDL, or loads it. With validate, the schema is checked by SchemaValidator
+    // (once per entry) and std::runtime_error is thrown if it is invalid.
+    static std::shared_ptr<const LoadedSchema> load(sqlite3* db, bool validate);
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_SCHEMA_CACHE_H
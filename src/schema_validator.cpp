@@ -6,6 +6,30 @@
 
 namespace quiver {
 
+namespace {
+
+// Whether a lookup on columns can use an index of table: one starting with them, or the rowid for its INTEGER key
+bool is_indexed(const TableDefinition& table, const std::vector<std::string>& columns) {
+    for (const auto& index : table.indexes) {
+        if (index.columns.size() >= columns.size() &&
+            std::equal(columns.begin(), columns.end(), index.columns.begin())) {
+            return true;
+        }
+    }
+    if (columns.size() != 1) {
+        return false;
+    }
+    const auto* column = table.get_column(columns.front());
+    if (!column || !column->primary_key || column->type != DataType::Integer) {
+        return false;
+    }
+    return std::count_if(table.columns.begin(), table.columns.end(), [](const auto& entry) {
+               return entry.second.primary_key;
+           }) == 1;
+}
+
+}  // namespace
+
 SchemaValidator::SchemaValidator(const Schema& schema) : schema_(schema) {}
 
 void SchemaValidator::validation_error(const std::string& message) {
@@ -32,12 +56,57 @@ void SchemaValidator::validate() {
             validate_vector_table(name);
         } else if (schema_.is_set_table(name)) {
             validate_set_table(name);
+        } else if (schema_.is_compressed_time_series_table(name)) {
+            validate_compressed_time_series_table(name);
         }
-        // Time series tables have minimal validation (just file paths)
+        // Other time series tables have minimal validation (just file paths)
     }
 
     validate_no_duplicate_attributes();
     validate_foreign_keys();
+    validate_packed_columns();
+}
+
+std::vector<MissingIndex> SchemaValidator::missing_indexes() const {
+    std::vector<MissingIndex> missing;
+    // An index suggested earlier on the same leading columns covers a shorter request
+    const auto require = [&](const std::string& name, std::vector<std::string> columns, std::string reason) {
+        const auto* table = schema_.get_table(name);
+        if (!table || is_indexed(*table, columns)) {
+            return;
+        }
+        for (const auto& index : missing) {
+            if (index.table == name && index.columns.size() >= columns.size() &&
+                std::equal(columns.begin(), columns.end(), index.columns.begin())) {
+                return;
+            }
+        }
+        missing.push_back({name, std::move(columns), std::move(reason)});
+    };
+
+    for (const auto& name : schema_.table_names()) {
+        const auto* table = schema_.get_table(name);
+        if (schema_.is_time_series_table(name) && table->has_column("date_time")) {
+            const auto parent = schema_.get_parent_collection(name);
+            std::string id_column = "id";
+            for (const auto& fk : table->foreign_keys) {
+                if (fk.to_table == parent) {
+                    id_column = fk.from_column;
+                    break;
+                }
+            }
+            const std::string key = schema_.is_compressed_time_series_table(name) ? "chunk_start" : "date_time";
+            require(name, {id_column, key}, "time series reads select one element's rows in " + key + " order");
+        }
+        for (const auto& fk : table->foreign_keys) {
+            require(name, {fk.from_column}, "deleting or renumbering a " + fk.to_table + " element searches it");
+            const auto* target = schema_.get_table(fk.to_table);
+            if (target && target->has_column("label")) {
+                require(fk.to_table, {"label"}, "relations to " + fk.to_table + " are resolved by label");
+            }
+        }
+    }
+    return missing;
 }
 
 void SchemaValidator::validate_configuration_exists() {
@@ -115,8 +184,19 @@ void SchemaValidator::validate_vector_table(const std::string& name) {
         validation_error("Vector table '" + name + "' must have 'id' column");
     }
 
-    // id should NOT be primary key alone (composite PK required)
-    if (id_col && id_col->primary_key) {
+    if (schema_.is_packed_vector_table(name)) {
+        // Packed layout (no vector_index): id alone is the key and every value column holds a whole vector
+        if (id_col && !id_col->primary_key) {
+            validation_error("Packed vector table '" + name + "' must have 'id' as primary key");
+        }
+        for (const auto& [col_name, col] : table->columns) {
+            if (col_name != "id" && !col.packed) {
+                validation_error("Vector table '" + name + "' must have 'vector_index' column, or only BLOB column '" +
+                                 col_name + "' to be packed");
+            }
+        }
+    } else if (id_col && id_col->primary_key) {
+        // id should NOT be primary key alone (composite PK required)
         int pk_count = 0;
         for (const auto& [_, col] : table->columns) {
             if (col.primary_key) {
@@ -129,11 +209,6 @@ void SchemaValidator::validate_vector_table(const std::string& name) {
         }
     }
 
-    // Must have 'vector_index' column
-    if (!table->has_column("vector_index")) {
-        validation_error("Vector table '" + name + "' must have 'vector_index' column");
-    }
-
     // Must have FK to parent with ON DELETE CASCADE ON UPDATE CASCADE
     auto has_parent_fk = false;
     for (const auto& fk : table->foreign_keys) {
@@ -197,6 +272,25 @@ void SchemaValidator::validate_set_table(const std::string& name) {
     }
 }
 
+void SchemaValidator::validate_compressed_time_series_table(const std::string& name) {
+    const auto* table = schema_.get_table(name);
+    const auto* chunk = table->get_column("chunk_start");
+    if (!chunk || chunk->type != DataType::Integer || !chunk->primary_key) {
+        validation_error("Compressed time series table '" + name +
+                         "' must have an INTEGER 'chunk_start' column in its primary key");
+    }
+
+    std::set<std::string> fk_columns;
+    for (const auto& fk : table->foreign_keys) {
+        fk_columns.insert(fk.from_column);
+    }
+    for (const auto& [col_name, col] : table->columns) {
+        if (col_name != "chunk_start" && fk_columns.count(col_name) == 0 && !col.packed) {
+            validation_error("Compressed time series table '" + name + "' column '" + col_name + "' must be BLOB");
+        }
+    }
+}
+
 void SchemaValidator::validate_no_duplicate_attributes() {
     // For each collection, gather all attribute names from collection + vector tables
     for (const auto& collection : collections_) {
@@ -254,6 +348,20 @@ void SchemaValidator::validate_no_duplicate_attributes() {
     }
 }
 
+void SchemaValidator::validate_packed_columns() {
+    for (const auto& table_name : schema_.table_names()) {
+        if (schema_.is_packed_vector_table(table_name) || schema_.is_compressed_time_series_table(table_name)) {
+            continue;
+        }
+        for (const auto& [col_name, col] : schema_.get_table(table_name)->columns) {
+            if (col.packed) {
+                validation_error("Column '" + col_name + "' in table '" + table_name +
+                                 "' is BLOB, which only packed vector and compressed time series tables use");
+            }
+        }
+    }
+}
+
 void SchemaValidator::validate_foreign_keys() {
     for (const auto& table_name : schema_.table_names()) {
         const auto* table = schema_.get_table(table_name);
@@ -0,0 +1,106 @@
+#include "statement_cache.h"
+
+#include <chrono>
+#include <stdexcept>
+
+namespace quiver {
+
+StatementCache::Handle::Handle(sqlite3_stmt* stmt, EntryList::iterator entry, bool cached)
+    : stmt_(stmt), entry_(entry), cached_(cached) {}
+
+StatementCache::Handle::Handle(Handle&& other) noexcept
+    : stmt_(other.stmt_), entry_(other.entry_), cached_(other.cached_) {
+    other.stmt_ = nullptr;
+}
+
+StatementCache::Handle::~Handle() {
+    if (!stmt_) {
+        return;
+    }
+    if (cached_) {
+        sqlite3_reset(stmt_);
+        sqlite3_clear_bindings(stmt_);
+        entry_->in_use = false;
+    } else {
+        sqlite3_finalize(stmt_);
+    }
+}
+
+StatementCache::StatementCache(sqlite3* db, size_t capacity) : db_(db), capacity_(capacity) {}
+
+StatementCache::~StatementCache() {
+    for (auto& entry : entries_) {
+        sqlite3_finalize(entry.stmt);
+    }
+}
+
+StatementCache::Handle StatementCache::acquire(const std::string& sql) {
+    auto it = index_.find(sql);
+    if (it != index_.end()) {
+        auto entry = it->second;
+        if (!entry->in_use) {
+            ++hits_;
+            entries_.splice(entries_.begin(), entries_, entry);
+            entry->in_use = true;
+            return Handle(entry->stmt, entry, true);
+        }
+        // Same SQL is already leased (e.g. nested use); hand out a private statement
+        ++misses_;
+        return Handle(prepare(sql), entries_.end(), false);
+    }
+
+    ++misses_;
+    auto* stmt = prepare(sql);
+    if (capacity_ == 0 || (entries_.size() >= capacity_ && !evict_one())) {
+        return Handle(stmt, entries_.end(), false);
+    }
+
+    entries_.push_front(Entry{sql, stmt, true});
+    index_.emplace(sql, entries_.begin());
+    return Handle(stmt, entries_.begin(), true);
+}
+
+void StatementCache::clear() {
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->in_use) {
+            ++it;
+            continue;
+        }
+        sqlite3_finalize(it->stmt);
+        index_.erase(it->sql);
+        it = entries_.erase(it);
+    }
+}
+
+sqlite3_stmt* StatementCache::prepare(const std::string& sql) const {
+    sqlite3_stmt* stmt = nullptr;
+    const auto start = prepare_listener_ ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+    const auto rc = sqlite3_prepare_v2(db_, sql.c_str(), static_cast<int>(sql.size()), &stmt, nullptr);
+    if (prepare_listener_) {
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        prepare_listener_(sql, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+    if (rc != SQLITE_OK) {
+        throw std::runtime_error("Failed to prepare statement: " + std::string(sqlite3_errmsg(db_)));
+    }
+    if (!stmt) {
+        throw std::runtime_error("Failed to prepare statement: no SQL statement in input");
+    }
+    return stmt;
+}
+
+bool StatementCache::evict_one() {
+    // Walk from the least recently used end, skipping statements that are still leased
+    for (auto it = entries_.rbegin(); it != entries_.rend(); ++it) {
+        if (!it->in_use) {
+            auto victim = std::next(it).base();
+            sqlite3_finalize(victim->stmt);
+            index_.erase(victim->sql);
+            entries_.erase(victim);
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace quiver
@@ -0,0 +1,81 @@
+#ifndef QUIVER_STATEMENT_CACHE_H
+#define QUIVER_STATEMENT_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <sqlite3.h>
+#include <string>
+#include <unordered_map>
+
+namespace quiver {
+
+// Bounded LRU cache of prepared statements keyed by SQL text.
+// Statements are leased through Handle and returned to the cache (reset, bindings cleared) on release.
+// A statement that is already leased is never handed out twice; a fresh uncached statement is prepared instead.
+class StatementCache {
+    struct Entry {
+        std::string sql;
+        sqlite3_stmt* stmt = nullptr;
+        bool in_use = false;
+    };
+    using EntryList = std::list<Entry>;
+
+public:
+    class Handle {
+    public:
+        Handle(Handle&& other) noexcept;
+        Handle& operator=(Handle&&) = delete;
+        Handle(const Handle&) = delete;
+        Handle& operator=(const Handle&) = delete;
+        ~Handle();
+
+        sqlite3_stmt* get() const { return stmt_; }
+
+    private:
+        friend class StatementCache;
+        Handle(sqlite3_stmt* stmt, EntryList::iterator entry, bool cached);
+
+        sqlite3_stmt* stmt_;
+        EntryList::iterator entry_;
+        bool cached_;
+    };
+
+    StatementCache(sqlite3* db, size_t capacity);
+    ~StatementCache();
+
+    StatementCache(const StatementCache&) = delete;
+    StatementCache& operator=(const StatementCache&) = delete;
+
+    // Returns a prepared statement for sql; throws std::runtime_error if preparation fails
+    Handle acquire(const std::string& sql);
+
+    // Finalizes all cached statements that are not currently leased
+    void clear();
+
+    // Called with the SQL and elapsed nanoseconds after every sqlite3_prepare_v2
+    using PrepareListener = std::function<void(const std::string& sql, int64_t nanoseconds)>;
+    void set_prepare_listener(PrepareListener listener) { prepare_listener_ = std::move(listener); }
+
+    int64_t hits() const { return hits_; }
+    int64_t misses() const { return misses_; }
+    size_t size() const { return entries_.size(); }
+    size_t capacity() const { return capacity_; }
+
+private:
+    sqlite3_stmt* prepare(const std::string& sql) const;
+    bool evict_one();
+
+    sqlite3* db_;
+    size_t capacity_;
+    EntryList entries_;  // Most recently used first
+    std::unordered_map<std::string, EntryList::iterator> index_;
+    int64_t hits_ = 0;
+    int64_t misses_ = 0;
+    PrepareListener prepare_listener_;
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_STATEMENT_CACHE_H
@@ -0,0 +1,84 @@
+#include "stats_collector.h"
+
+#include <algorithm>
+
+namespace quiver {
+
+namespace {
+
+template <typename Stats>
+std::vector<Stats> sorted_by_total_time(const std::unordered_map<std::string, Stats>& entries) {
+    std::vector<Stats> result;
+    result.reserve(entries.size());
+    for (const auto& [_, stats] : entries) {
+        result.push_back(stats);
+    }
+    std::sort(result.begin(), result.end(), [](const Stats& a, const Stats& b) { return a.total_ns > b.total_ns; });
+    return result;
+}
+
+}  // namespace
+
+StatsCollector::StatsCollector(sqlite3* db) : db_(db), total_changes_(sqlite3_total_changes(db)) {}
+
+void StatsCollector::record_prepare(const std::string& sql, int64_t nanoseconds) {
+    auto& stats = statements_[sql];
+    stats.sql = sql;
+    ++stats.prepares;
+    stats.prepare_ns += nanoseconds;
+}
+
+void StatsCollector::record_operation(const char* name,
+                                      int64_t nanoseconds,
+                                      int64_t rows_read,
+                                      int64_t rows_written) {
+    auto& stats = operations_[name];
+    stats.name = name;
+    ++stats.calls;
+    stats.total_ns += nanoseconds;
+    stats.max_ns = std::max(stats.max_ns, nanoseconds);
+    stats.rows_read += rows_read;
+    stats.rows_written += rows_written;
+}
+
+std::vector<OperationStats> StatsCollector::operations() const {
+    return sorted_by_total_time(operations_);
+}
+
+std::vector<StatementStats> StatsCollector::statements() const {
+    return sorted_by_total_time(statements_);
+}
+
+void StatsCollector::reset() {
+    operations_.clear();
+    statements_.clear();
+    pending_rows_.clear();
+}
+
+void StatsCollector::record_row(sqlite3_stmt* stmt) {
+    ++pending_rows_[stmt];
+    ++rows_read_;
+}
+
+void StatsCollector::record_execution(sqlite3_stmt* stmt, int64_t nanoseconds) {
+    const char* sql = sqlite3_sql(stmt);
+    auto& stats = statements_[sql ? sql : ""];
+    if (stats.sql.empty() && sql) {
+        stats.sql = sql;
+    }
+    ++stats.executions;
+    stats.total_ns += nanoseconds;
+    stats.max_ns = std::max(stats.max_ns, nanoseconds);
+
+    if (auto it = pending_rows_.find(stmt); it != pending_rows_.end()) {
+        stats.rows_read += it->second;
+        pending_rows_.erase(it);
+    }
+    // sqlite3_changes keeps its old value across DDL, so rows written come from the total change counter instead
+    const auto total_changes = static_cast<int64_t>(sqlite3_total_changes(db_));
+    stats.rows_written += total_changes - total_changes_;
+    rows_written_ += total_changes - total_changes_;
+    total_changes_ = total_changes;
+}
+
+}  // namespace quiver
@@ -0,0 +1,94 @@
+#ifndef QUIVER_STATS_COLLECTOR_H
+#define QUIVER_STATS_COLLECTOR_H
+
+#include "quiver/database.h"
+
+#include <chrono>
+#include <cstdint>
+#include <sqlite3.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace quiver {
+
+// Per-operation and per-statement counters behind Database::stats(), only created when
+// DatabaseOptions::collect_stats is set. Statement execution is fed from Impl's sqlite3_trace_v2 hook
+// (SQLITE_TRACE_PROFILE for time and changes, SQLITE_TRACE_ROW for rows), prepares from the StatementCache.
+class StatsCollector {
+public:
+    explicit StatsCollector(sqlite3* db);
+
+    StatsCollector(const StatsCollector&) = delete;
+    StatsCollector& operator=(const StatsCollector&) = delete;
+
+    void record_prepare(const std::string& sql, int64_t nanoseconds);
+    void record_operation(const char* name, int64_t nanoseconds, int64_t rows_read, int64_t rows_written);
+    void record_row(sqlite3_stmt* stmt);
+    void record_execution(sqlite3_stmt* stmt, int64_t nanoseconds);
+
+    // Running totals, used to attribute rows to the enclosing operation
+    int64_t rows_read() const { return rows_read_; }
+    int64_t rows_written() const { return rows_written_; }
+
+    // Sorted by total time, slowest first
+    std::vector<OperationStats> operations() const;
+    std::vector<StatementStats> statements() const;
+
+    void reset();
+
+private:
+    sqlite3* db_;
+    std::unordered_map<std::string, OperationStats> operations_;
+    std::unordered_map<std::string, StatementStats> statements_;
+    std::unordered_map<sqlite3_stmt*, int64_t> pending_rows_;  // Rows of statements that have not finished yet
+    int64_t rows_read_ = 0;
+    int64_t rows_written_ = 0;
+    int64_t total_changes_;  // sqlite3_total_changes at the last profiled statement
+};
+
+// Times one public Database call and names it in current_operation while the outermost call runs, so trace
+// output can say which API issued a statement. Timing is skipped when stats collection is off.
+class OperationTimer {
+public:
+    OperationTimer(StatsCollector* stats, const char* name, const char*& current_operation)
+        : stats_(stats), name_(name) {
+        if (!current_operation) {
+            current_operation = name;
+            current_operation_ = &current_operation;
+        }
+        if (stats_) {
+            start_ = std::chrono::steady_clock::now();
+            rows_read_ = stats_->rows_read();
+            rows_written_ = stats_->rows_written();
+        }
+    }
+
+    ~OperationTimer() {
+        if (stats_) {
+            const auto elapsed = std::chrono::steady_clock::now() - start_;
+            stats_->record_operation(name_,
+                                     std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                                     stats_->rows_read() - rows_read_,
+                                     stats_->rows_written() - rows_written_);
+        }
+        if (current_operation_) {
+            *current_operation_ = nullptr;
+        }
+    }
+
+    OperationTimer(const OperationTimer&) = delete;
+    OperationTimer& operator=(const OperationTimer&) = delete;
+
+private:
+    StatsCollector* stats_;
+    const char* name_;
+    const char** current_operation_ = nullptr;  // Set when this is the outermost operation
+    std::chrono::steady_clock::time_point start_;
+    int64_t rows_read_ = 0;
+    int64_t rows_written_ = 0;
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_STATS_COLLECTOR_H
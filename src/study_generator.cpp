@@ -0,0 +1,504 @@
+#include "quiver/study_generator.h"
+
+#include "quiver/element.h"
+#include "quiver/schema.h"
+#include "time_series_codec.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace quiver {
+
+namespace {
+
+constexpr int64_t kTextPool = 100;
+constexpr int64_t kDateRangeDays = 3'650;
+constexpr const char* kConfiguration = "Configuration";
+
+// splitmix64: seedable and the same on every platform, unlike the std distributions
+class Random {
+public:
+    explicit Random(uint64_t seed) : state_(seed) {}
+
+    uint64_t next() {
+        auto z = (state_ += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+    int64_t integer(int64_t bound) { return static_cast<int64_t>(next() % static_cast<uint64_t>(bound)); }
+    double real() { return static_cast<double>(next() >> 11) * 0x1.0p-53 * 1'000.0; }
+
+private:
+    uint64_t state_;
+};
+
+// FNV-1a, so each table's stream depends on the seed and its name only, not on the other tables or options
+uint64_t stream_seed(uint64_t seed, const std::string& name) {
+    auto hash = 0xcbf29ce484222325ULL ^ seed;
+    for (const auto c : name) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::string text_value(const std::string& column, int64_t n) {
+    return column + " " + std::to_string(n);
+}
+
+std::string date_time_value(Random& random) {
+    static const auto base = time_series_codec::parse_date_time("2020-01-01");
+    return time_series_codec::format_date_time(base + random.integer(kDateRangeDays * 86'400));
+}
+
+const ForeignKey* foreign_key(const TableDefinition& table, const std::string& column) {
+    for (const auto& fk : table.foreign_keys) {
+        if (fk.from_column == column) {
+            return &fk;
+        }
+    }
+    return nullptr;
+}
+
+// The column of a group table holding the owning element's id
+std::string parent_column(const TableDefinition& table, const std::string& collection) {
+    if (table.has_column("id")) {
+        return "id";
+    }
+    for (const auto& fk : table.foreign_keys) {
+        if (fk.to_table == collection) {
+            return fk.from_column;
+        }
+    }
+    throw std::runtime_error("Table '" + table.name + "' has no column referencing '" + collection + "'");
+}
+
+// Collections ordered so every referenced collection comes first (ties and cycles by name)
+std::vector<std::string> fill_order(const Schema& schema) {
+    const auto names = schema.collection_names();
+    std::map<std::string, std::set<std::string>> depends;
+    for (const auto& name : names) {
+        auto tables = schema.vector_tables(name);
+        tables.insert(tables.end(), schema.set_tables(name).begin(), schema.set_tables(name).end());
+        tables.push_back(name);
+        auto& targets = depends[name];
+        for (const auto& table : tables) {
+            for (const auto& fk : schema.get_table(table)->foreign_keys) {
+                if (fk.to_table != name && schema.is_collection(fk.to_table)) {
+                    targets.insert(fk.to_table);
+                }
+            }
+        }
+    }
+
+    std::vector<std::string> order;
+    std::set<std::string> done;
+    while (order.size() < names.size()) {
+        auto progressed = false;
+        for (const auto& name : names) {
+            if (done.contains(name)) {
+                continue;
+            }
+            const auto& targets = depends[name];
+            if (std::all_of(targets.begin(), targets.end(), [&](const auto& t) { return done.contains(t); })) {
+                order.push_back(name);
+                done.insert(name);
+                progressed = true;
+            }
+        }
+        if (!progressed) {
+            // A reference cycle: take the first remaining collection; its forward references are deferred
+            const auto next =
+                std::find_if(names.begin(), names.end(), [&](const auto& n) { return !done.contains(n); });
+            order.push_back(*next);
+            done.insert(*next);
+        }
+    }
+    return order;
+}
+
+}  // namespace
+
+// Nested, so it shares StudyGenerator's access to the schema and raw statements
+class StudyGenerator::Generation {
+public:
+    Generation(Database& db, const Schema& schema, const StudyGeneratorOptions& options)
+        : db_(db), schema_(schema), options_(options) {}
+
+    GeneratedStudy run() {
+        for (const auto& name : schema_.collection_names()) {
+            if (!db_.read_element_ids(name).empty()) {
+                throw std::runtime_error("Cannot generate study: collection '" + name + "' already has elements");
+            }
+        }
+
+        Database::Transaction txn(db_);
+        for (const auto& name : fill_order(schema_)) {
+            fill_collection(name);
+        }
+        for (const auto& [collection, column, target] : deferred_) {
+            write_deferred(collection, column, target);
+        }
+        for (const auto& name : schema_.collection_names()) {
+            for (const auto& table : schema_.time_series_tables(name)) {
+                fill_time_series(name, *schema_.get_table(table));
+            }
+        }
+        txn.commit();
+        return std::move(result_);
+    }
+
+private:
+    struct Deferred {
+        std::string collection;
+        std::string column;
+        std::string target;
+    };
+
+    int64_t element_count(const std::string& collection) const {
+        const auto it = options_.counts.find(collection);
+        if (it != options_.counts.end()) {
+            return it->second;
+        }
+        return collection == kConfiguration ? 1 : options_.elements;
+    }
+
+    // Ids of a collection already filled, or null for one still to come (including the one being filled)
+    const std::vector<int64_t>* filled(const std::string& collection) const {
+        const auto it = ids_.find(collection);
+        return it == ids_.end() ? nullptr : &it->second;
+    }
+
+    int64_t fan_out_target(const std::vector<int64_t>& targets, int64_t index) const {
+        const auto fan_out = static_cast<int64_t>(std::max<size_t>(options_.fan_out, 1));
+        return targets[static_cast<size_t>((index / fan_out) % static_cast<int64_t>(targets.size()))];
+    }
+
+    void fill_collection(const std::string& name) {
+        const auto& table = *schema_.get_table(name);
+        const auto count = element_count(name);
+        Random random(stream_seed(options_.seed, name));
+
+        std::vector<const ColumnDefinition*> scalars;
+        for (const auto& [column_name, column] : table.columns) {
+            if (column.primary_key || column_name == "label") {
+                continue;
+            }
+            const auto* fk = foreign_key(table, column_name);
+            if (fk && schema_.is_collection(fk->to_table) && (!filled(fk->to_table) || filled(fk->to_table)->empty())) {
+                if (column.not_null) {
+                    throw std::runtime_error("Cannot generate '" + name + "." + column_name +
+                                             "': NOT NULL reference to '" + fk->to_table + "', which is filled later");
+                }
+                deferred_.push_back({name, column_name, fk->to_table});
+                continue;
+            }
+            scalars.push_back(&column);
+        }
+
+        std::vector<int64_t> ids;
+        ids.reserve(static_cast<size_t>(count));
+        std::vector<Element> batch;
+        const auto batch_size = static_cast<int64_t>(std::max<size_t>(options_.batch_size, 1));
+        for (int64_t begin = 0; begin < count; begin += batch_size) {
+            batch.clear();
+            for (auto i = begin; i < std::min(count, begin + batch_size); ++i) {
+                Element element;
+                element.set("label", name + " " + std::to_string(i + 1));
+                for (const auto* column : scalars) {
+                    set_scalar(element, table, *column, i, random);
+                }
+                for (const auto& vector_table : schema_.vector_tables(name)) {
+                    set_vector_group(element, *schema_.get_table(vector_table), random);
+                }
+                for (const auto& set_table : schema_.set_tables(name)) {
+                    set_set_group(element, *schema_.get_table(set_table), random);
+                }
+                batch.push_back(std::move(element));
+            }
+            const auto created = db_.create_elements(name, batch);
+            ids.insert(ids.end(), created.begin(), created.end());
+        }
+        result_.elements[name] = count;
+        ids_[name] = std::move(ids);
+    }
+
+    void set_scalar(Element& element,
+                    const TableDefinition& table,
+                    const ColumnDefinition& column,
+                    int64_t index,
+                    Random& random) const {
+        if (const auto* fk = foreign_key(table, column.name); fk && schema_.is_collection(fk->to_table)) {
+            element.set(column.name, fan_out_target(*filled(fk->to_table), index));
+            return;
+        }
+        switch (column.type) {
+        case DataType::Integer:
+            element.set(column.name, random.integer(1'000'000));
+            break;
+        case DataType::Real:
+            element.set(column.name, random.real());
+            break;
+        case DataType::Text:
+            element.set(column.name, text_value(column.name, random.integer(kTextPool)));
+            break;
+        case DataType::DateTime:
+            element.set(column.name, date_time_value(random));
+            break;
+        }
+    }
+
+    void set_vector_group(Element& element, const TableDefinition& table, Random& random) {
+        const auto packed = schema_.is_packed_vector_table(table.name);
+        const auto length = options_.vector_length;
+        if (length == 0) {
+            return;
+        }
+        auto written = false;
+        for (const auto& [column_name, column] : table.columns) {
+            if (column_name == "id" || column_name == "vector_index") {
+                continue;
+            }
+            const auto* fk = foreign_key(table, column_name);
+            if (fk && schema_.is_collection(fk->to_table)) {
+                const auto* targets = filled(fk->to_table);
+                if (!targets || targets->empty()) {
+                    continue;
+                }
+                std::vector<int64_t> values(length);
+                for (auto& value : values) {
+                    value = (*targets)[static_cast<size_t>(random.integer(static_cast<int64_t>(targets->size())))];
+                }
+                element.set(column_name, std::move(values));
+            } else if (packed || column.type == DataType::Real) {
+                std::vector<double> values(length);
+                for (auto& value : values) {
+                    value = random.real();
+                }
+                element.set(column_name, std::move(values));
+            } else if (column.type == DataType::Integer) {
+                std::vector<int64_t> values(length);
+                for (auto& value : values) {
+                    value = random.integer(1'000'000);
+                }
+                element.set(column_name, std::move(values));
+            } else {
+                std::vector<std::string> values(length);
+                for (auto& value : values) {
+                    value = column.type == DataType::DateTime ? date_time_value(random)
+                                                              : text_value(column_name, random.integer(kTextPool));
+                }
+                element.set(column_name, std::move(values));
+            }
+            written = true;
+        }
+        if (written) {
+            result_.vector_rows += packed ? 1 : static_cast<int64_t>(length);
+        }
+    }
+
+    // Row j takes the (start + j)-th value of every column's pool, so rows never repeat within an element
+    void set_set_group(Element& element, const TableDefinition& table, Random& random) {
+        std::vector<std::pair<const ColumnDefinition*, const std::vector<int64_t>*>> columns;
+        auto size = static_cast<int64_t>(options_.set_size);
+        for (const auto& [column_name, column] : table.columns) {
+            if (column_name == "id") {
+                continue;
+            }
+            const std::vector<int64_t>* targets = nullptr;
+            if (const auto* fk = foreign_key(table, column_name); fk && schema_.is_collection(fk->to_table)) {
+                targets = filled(fk->to_table);
+                if (!targets || targets->empty()) {
+                    continue;
+                }
+                size = std::min(size, static_cast<int64_t>(targets->size()));
+            } else if (column.type == DataType::Integer || column.type == DataType::Text) {
+                size = std::min(size, kTextPool);
+            }
+            columns.emplace_back(&column, targets);
+        }
+        if (columns.empty() || size == 0) {
+            return;
+        }
+
+        const auto start = random.integer(kTextPool);
+        for (const auto& [column, targets] : columns) {
+            if (targets) {
+                const auto pool = static_cast<int64_t>(targets->size());
+                std::vector<int64_t> values(static_cast<size_t>(size));
+                for (int64_t j = 0; j < size; ++j) {
+                    values[static_cast<size_t>(j)] = (*targets)[static_cast<size_t>((start + j) % pool)];
+                }
+                element.set(column->name, std::move(values));
+            } else if (column->type == DataType::Integer) {
+                std::vector<int64_t> values(static_cast<size_t>(size));
+                for (int64_t j = 0; j < size; ++j) {
+                    values[static_cast<size_t>(j)] = (start + j) % kTextPool;
+                }
+                element.set(column->name, std::move(values));
+            } else if (column->type == DataType::Real) {
+                std::vector<double> values(static_cast<size_t>(size));
+                for (int64_t j = 0; j < size; ++j) {
+                    values[static_cast<size_t>(j)] = static_cast<double>(start + j) / 4.0;
+                }
+                element.set(column->name, std::move(values));
+            } else {
+                std::vector<std::string> values(static_cast<size_t>(size));
+                for (int64_t j = 0; j < size; ++j) {
+                    values[static_cast<size_t>(j)] = text_value(column->name, (start + j) % kTextPool);
+                }
+                element.set(column->name, std::move(values));
+            }
+        }
+        result_.set_rows += size;
+    }
+
+    // Scalar references to a collection filled after (or as) the referencing one, now that its ids exist
+    void write_deferred(const std::string& collection, const std::string& column, const std::string& target) {
+        const auto& ids = ids_.at(collection);
+        const auto& targets = ids_.at(target);
+        if (ids.empty() || targets.empty()) {
+            return;
+        }
+        std::vector<int64_t> values(ids.size());
+        for (size_t i = 0; i < ids.size(); ++i) {
+            // Offset by one so a self reference points at the next element rather than itself
+            values[i] = fan_out_target(targets, static_cast<int64_t>(i) + (collection == target ? 1 : 0));
+        }
+        db_.update_scalar_integers(collection, column, ids, values);
+    }
+
+    void fill_time_series(const std::string& collection, const TableDefinition& table) {
+        const auto length = options_.time_series_length;
+        const auto& ids = ids_.at(collection);
+        if (length == 0 || ids.empty()) {
+            return;
+        }
+        const auto id_column = parent_column(table, collection);
+        const auto compressed = schema_.is_compressed_time_series_table(table.name);
+
+        std::vector<std::string> columns;
+        for (const auto& [column_name, column] : table.columns) {
+            if (column_name != id_column && column_name != "date_time" &&
+                column_name != time_series_codec::kChunkColumn && !foreign_key(table, column_name)) {
+                columns.push_back(column_name);
+            }
+        }
+        if (columns.empty()) {
+            return;
+        }
+
+        if (compressed) {
+            fill_compressed_time_series(collection, table, id_column, columns);
+            return;
+        }
+
+        // Set-based: one INSERT ... SELECT over (elements x steps) instead of a statement per element. Values come
+        // from a hash of (seed, column, id, step), so they are as reproducible as the generated elements.
+        std::string sql = "WITH RECURSIVE steps(n) AS (SELECT 0 UNION ALL SELECT n + 1 FROM steps WHERE n + 1 < ?) "
+                          "INSERT INTO " +
+                          table.name + " (" + id_column + ", date_time";
+        std::string select = "SELECT e.id, strftime('%Y-%m-%d %H:%M:%S', ?, '+' || (n * ?) || ' seconds')";
+        for (const auto& column_name : columns) {
+            const auto salt = std::to_string(stream_seed(options_.seed, table.name + "." + column_name) % 1'000'003);
+            const auto hash = "((e.id * 104729 + n * 7919 + " + salt + ") % 1000003)";
+            sql += ", " + column_name;
+            switch (table.get_column(column_name)->type) {
+            case DataType::Integer:
+                select += ", " + hash;
+                break;
+            case DataType::Real:
+                select += ", " + hash + " / 1000.0";
+                break;
+            case DataType::Text:
+            case DataType::DateTime:
+                select += ", '" + column_name + " ' || (" + hash + " % " + std::to_string(kTextPool) + ")";
+                break;
+            }
+        }
+        sql += ") " + select + " FROM " + collection + " e CROSS JOIN steps ORDER BY e.id, n";
+        db_.execute(sql, {static_cast<int64_t>(length), options_.time_series_start, options_.time_series_step});
+        result_.time_series_rows += static_cast<int64_t>(ids.size() * length);
+    }
+
+    // Chunks are encoded in C++: one INSERT per element and chunk, carrying a BLOB for every value column
+    void fill_compressed_time_series(const std::string& collection,
+                                     const TableDefinition& table,
+                                     const std::string& id_column,
+                                     const std::vector<std::string>& columns) {
+        const auto length = options_.time_series_length;
+        const auto start = time_series_codec::parse_date_time(options_.time_series_start);
+
+        std::string sql = "INSERT INTO " + table.name + " (" + id_column + ", " + time_series_codec::kChunkColumn +
+                          ", date_time";
+        std::string placeholders = "?, ?, ?";
+        std::vector<Random> randoms;
+        randoms.reserve(columns.size());
+        for (const auto& column : columns) {
+            sql += ", " + column;
+            placeholders += ", ?";
+            randoms.emplace_back(stream_seed(options_.seed, table.name + "." + column));
+        }
+        sql += ") VALUES (" + placeholders + ")";
+
+        const auto blob = [](const std::string& bytes) { return Value(Blob(bytes.begin(), bytes.end())); };
+        std::vector<int64_t> times;
+        std::vector<double> values;
+        std::vector<Value> params;
+        for (const auto id : ids_.at(collection)) {
+            for (size_t begin = 0; begin < length; begin += time_series_codec::kChunkSize) {
+                const auto end = std::min(length, begin + time_series_codec::kChunkSize);
+                times.clear();
+                for (auto n = begin; n < end; ++n) {
+                    times.push_back(start + static_cast<int64_t>(n) * options_.time_series_step);
+                }
+
+                params.clear();
+                params.push_back(id);
+                params.push_back(times.front());
+                params.push_back(blob(time_series_codec::encode_times(times)));
+                for (auto& random : randoms) {
+                    values.resize(times.size());
+                    for (auto& value : values) {
+                        value = random.real();
+                    }
+                    params.push_back(blob(time_series_codec::encode_values(values)));
+                }
+                db_.execute(sql, params);
+            }
+            result_.time_series_rows += static_cast<int64_t>(length);
+        }
+    }
+
+    Database& db_;
+    const Schema& schema_;
+    const StudyGeneratorOptions& options_;
+    std::map<std::string, std::vector<int64_t>> ids_;
+    std::vector<Deferred> deferred_;
+    GeneratedStudy result_;
+};
+
+StudyGenerator::StudyGenerator(StudyGeneratorOptions options) : options_(std::move(options)) {}
+
+GeneratedStudy StudyGenerator::generate(Database& db) const {
+    const auto start = std::chrono::steady_clock::now();
+    auto result = Generation(db, db.schema(), options_).run();
+    result.elapsed_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+GeneratedStudy StudyGenerator::generate(const std::string& path,
+                                        const std::string& schema_path,
+                                        const DatabaseOptions& options) const {
+    std::filesystem::remove(path);
+    auto db = Database::from_schema(path, schema_path, options);
+    return generate(db);
+}
+
+}  // namespace quiver
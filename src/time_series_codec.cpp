@@ -0,0 +1,493 @@
+#include "time_series_codec.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <new>
+#include <sqlite3.h>
+#include <stdexcept>
+
+namespace quiver::time_series_codec {
+
+namespace {
+
+constexpr int64_t kSecondsPerDay = 86400;
+
+// Days since 1970-01-01 of a proleptic Gregorian date (H. Hinnant's days_from_civil)
+int64_t days_from_civil(int64_t year, int64_t month, int64_t day) {
+    year -= month <= 2 ? 1 : 0;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const int64_t year_of_era = year - era * 400;
+    const int64_t day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int64_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + day_of_era - 719468;
+}
+
+void civil_from_days(int64_t days, int64_t& year, int64_t& month, int64_t& day) {
+    days += 719468;
+    const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const int64_t day_of_era = days - era * 146097;
+    const int64_t year_of_era =
+        (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    const int64_t day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    const int64_t shifted_month = (5 * day_of_year + 2) / 153;
+    day = day_of_year - (153 * shifted_month + 2) / 5 + 1;
+    month = shifted_month < 10 ? shifted_month + 3 : shifted_month - 9;
+    year = year_of_era + era * 400 + (month <= 2 ? 1 : 0);
+}
+
+bool read_digits(std::string_view text, size_t at, size_t count, int64_t& value) {
+    if (at + count > text.size()) {
+        return false;
+    }
+    value = 0;
+    for (size_t i = at; i < at + count; ++i) {
+        if (text[i] < '0' || text[i] > '9') {
+            return false;
+        }
+        value = value * 10 + (text[i] - '0');
+    }
+    return true;
+}
+
+uint64_t zigzag(uint64_t value) {
+    return (value << 1) ^ (0 - (value >> 63));
+}
+
+uint64_t unzigzag(uint64_t value) {
+    return (value >> 1) ^ (0 - (value & 1));
+}
+
+void write_varint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out += static_cast<char>((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+    out += static_cast<char>(value);
+}
+
+[[noreturn]] void corrupt() {
+    throw std::runtime_error("Corrupt compressed time series chunk");
+}
+
+class ByteReader {
+public:
+    ByteReader(const void* data, size_t size) : bytes_(static_cast<const unsigned char*>(data)), size_(size) {}
+
+    uint64_t varint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (position_ >= size_) {
+                corrupt();
+            }
+            const auto byte = bytes_[position_++];
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        corrupt();
+    }
+
+    const unsigned char* rest(size_t& size) const {
+        size = size_ - position_;
+        return bytes_ + position_;
+    }
+
+private:
+    const unsigned char* bytes_;
+    size_t size_;
+    size_t position_ = 0;
+};
+
+// Most significant bit first
+class BitWriter {
+public:
+    explicit BitWriter(std::string& out) : out_(out) {}
+
+    void write(uint64_t bits, int count) {
+        while (count > 0) {
+            const int take = std::min(count, 8 - used_);
+            const auto chunk = static_cast<unsigned>((bits >> (count - take)) & ((1u << take) - 1));
+            current_ = static_cast<unsigned char>(current_ | (chunk << (8 - used_ - take)));
+            used_ += take;
+            count -= take;
+            if (used_ == 8) {
+                flush();
+            }
+        }
+    }
+
+    void finish() {
+        if (used_ > 0) {
+            flush();
+        }
+    }
+
+private:
+    void flush() {
+        out_ += static_cast<char>(current_);
+        current_ = 0;
+        used_ = 0;
+    }
+
+    std::string& out_;
+    unsigned char current_ = 0;
+    int used_ = 0;
+};
+
+class BitReader {
+public:
+    BitReader(const unsigned char* bytes, size_t size) : bytes_(bytes), bits_(size * 8) {}
+
+    uint64_t read(int count) {
+        if (position_ + static_cast<size_t>(count) > bits_) {
+            corrupt();
+        }
+        uint64_t value = 0;
+        while (count > 0) {
+            const auto byte = bytes_[position_ / 8];
+            const int offset = static_cast<int>(position_ % 8);
+            const int take = std::min(count, 8 - offset);
+            value = (value << take) | ((byte >> (8 - offset - take)) & ((1u << take) - 1));
+            position_ += static_cast<size_t>(take);
+            count -= take;
+        }
+        return value;
+    }
+
+private:
+    const unsigned char* bytes_;
+    size_t bits_;
+    size_t position_ = 0;
+};
+
+// quiver_unpack_time_series: columns date_time and value, then the two hidden BLOB arguments
+constexpr int kDateTimeColumn = 0;
+constexpr int kValueColumn = 1;
+constexpr int kTimesArgument = 2;
+constexpr int kValuesArgument = 3;
+
+struct UnpackCursor {
+    sqlite3_vtab_cursor base{};
+    std::vector<int64_t> times;
+    std::vector<double> values;
+    size_t position = 0;
+};
+
+int unpack_connect(sqlite3* db, void*, int, const char* const*, sqlite3_vtab** out, char**) {
+    const auto rc =
+        sqlite3_declare_vtab(db, "CREATE TABLE x(date_time TEXT, value REAL, times HIDDEN, samples HIDDEN)");
+    if (rc != SQLITE_OK) {
+        return rc;
+    }
+    sqlite3_vtab_config(db, SQLITE_VTAB_INNOCUOUS);
+    *out = static_cast<sqlite3_vtab*>(sqlite3_malloc(sizeof(sqlite3_vtab)));
+    if (!*out) {
+        return SQLITE_NOMEM;
+    }
+    std::memset(*out, 0, sizeof(sqlite3_vtab));
+    return SQLITE_OK;
+}
+
+int unpack_disconnect(sqlite3_vtab* vtab) {
+    sqlite3_free(vtab);
+    return SQLITE_OK;
+}
+
+// Both BLOB arguments must be bound
+int unpack_best_index(sqlite3_vtab*, sqlite3_index_info* info) {
+    int found = 0;
+    for (int i = 0; i < info->nConstraint; ++i) {
+        const auto& constraint = info->aConstraint[i];
+        const int argument = constraint.iColumn == kTimesArgument ? 1 : constraint.iColumn == kValuesArgument ? 2 : 0;
+        if (argument == 0 || constraint.op != SQLITE_INDEX_CONSTRAINT_EQ) {
+            continue;
+        }
+        if (!constraint.usable) {
+            return SQLITE_CONSTRAINT;
+        }
+        info->aConstraintUsage[i].argvIndex = argument;
+        info->aConstraintUsage[i].omit = 1;
+        found |= argument;
+    }
+    if (found != 3) {
+        // argvIndex values must be contiguous, so a lone argument is not passed either
+        for (int i = 0; i < info->nConstraint; ++i) {
+            info->aConstraintUsage[i].argvIndex = 0;
+            info->aConstraintUsage[i].omit = 0;
+        }
+    }
+    info->idxNum = found;
+    info->estimatedCost = found == 3 ? 10 : 1e12;
+    info->estimatedRows = found == 3 ? static_cast<sqlite3_int64>(kChunkSize) : 1;
+    return SQLITE_OK;
+}
+
+int unpack_open(sqlite3_vtab*, sqlite3_vtab_cursor** out) {
+    auto* cursor = new (std::nothrow) UnpackCursor();
+    if (!cursor) {
+        return SQLITE_NOMEM;
+    }
+    *out = &cursor->base;
+    return SQLITE_OK;
+}
+
+int unpack_close(sqlite3_vtab_cursor* base) {
+    delete reinterpret_cast<UnpackCursor*>(base);
+    return SQLITE_OK;
+}
+
+int unpack_filter(sqlite3_vtab_cursor* base, int idx_num, const char*, int, sqlite3_value** argv) {
+    auto* cursor = reinterpret_cast<UnpackCursor*>(base);
+    cursor->times.clear();
+    cursor->values.clear();
+    cursor->position = 0;
+    // A chunk without this column (NULL) has no samples for it
+    if (idx_num != 3 || sqlite3_value_type(argv[0]) == SQLITE_NULL || sqlite3_value_type(argv[1]) == SQLITE_NULL) {
+        return SQLITE_OK;
+    }
+    try {
+        decode_times(sqlite3_value_blob(argv[0]), static_cast<size_t>(sqlite3_value_bytes(argv[0])), cursor->times);
+        decode_values(sqlite3_value_blob(argv[1]), static_cast<size_t>(sqlite3_value_bytes(argv[1])), cursor->values);
+    } catch (const std::exception& e) {
+        base->pVtab->zErrMsg = sqlite3_mprintf("quiver_unpack_time_series: %s", e.what());
+        return SQLITE_ERROR;
+    }
+    if (cursor->times.size() != cursor->values.size()) {
+        base->pVtab->zErrMsg = sqlite3_mprintf("quiver_unpack_time_series: date_time and value counts differ");
+        return SQLITE_ERROR;
+    }
+    return SQLITE_OK;
+}
+
+int unpack_next(sqlite3_vtab_cursor* base) {
+    ++reinterpret_cast<UnpackCursor*>(base)->position;
+    return SQLITE_OK;
+}
+
+int unpack_eof(sqlite3_vtab_cursor* base) {
+    const auto* cursor = reinterpret_cast<UnpackCursor*>(base);
+    return cursor->position >= cursor->values.size();
+}
+
+int unpack_column(sqlite3_vtab_cursor* base, sqlite3_context* context, int column) {
+    const auto* cursor = reinterpret_cast<UnpackCursor*>(base);
+    if (column == kDateTimeColumn) {
+        const auto text = format_date_time(cursor->times[cursor->position]);
+        sqlite3_result_text(context, text.data(), static_cast<int>(text.size()), SQLITE_TRANSIENT);
+    } else if (column == kValueColumn && !std::isnan(cursor->values[cursor->position])) {
+        sqlite3_result_double(context, cursor->values[cursor->position]);
+    } else {
+        sqlite3_result_null(context);
+    }
+    return SQLITE_OK;
+}
+
+int unpack_rowid(sqlite3_vtab_cursor* base, sqlite3_int64* rowid) {
+    *rowid = static_cast<sqlite3_int64>(reinterpret_cast<UnpackCursor*>(base)->position + 1);
+    return SQLITE_OK;
+}
+
+sqlite3_module make_unpack_module() {
+    // Eponymous-only, like quiver_unpack
+    sqlite3_module module{};
+    module.xConnect = unpack_connect;
+    module.xBestIndex = unpack_best_index;
+    module.xDisconnect = unpack_disconnect;
+    module.xOpen = unpack_open;
+    module.xClose = unpack_close;
+    module.xFilter = unpack_filter;
+    module.xNext = unpack_next;
+    module.xEof = unpack_eof;
+    module.xColumn = unpack_column;
+    module.xRowid = unpack_rowid;
+    return module;
+}
+
+const sqlite3_module unpack_module = make_unpack_module();
+
+}  // namespace
+
+int64_t parse_date_time(std::string_view text) {
+    int64_t year = 0;
+    int64_t month = 0;
+    int64_t day = 0;
+    int64_t hour = 0;
+    int64_t minute = 0;
+    int64_t second = 0;
+    auto valid = read_digits(text, 0, 4, year) && text.size() >= 10 && text[4] == '-' &&
+                 read_digits(text, 5, 2, month) && text[7] == '-' && read_digits(text, 8, 2, day);
+    if (valid && text.size() > 10) {
+        valid = (text[10] == ' ' || text[10] == 'T') && read_digits(text, 11, 2, hour) && text.size() >= 16 &&
+                text[13] == ':' && read_digits(text, 14, 2, minute);
+        if (valid && text.size() > 16) {
+            valid = text.size() == 19 && text[16] == ':' && read_digits(text, 17, 2, second);
+        }
+    }
+    const auto days = valid ? days_from_civil(year, month, day) : 0;
+    if (valid) {
+        // Rejects days past the end of the month, which days_from_civil would roll over
+        int64_t check_year = 0;
+        int64_t check_month = 0;
+        int64_t check_day = 0;
+        civil_from_days(days, check_year, check_month, check_day);
+        valid = check_year == year && check_month == month && check_day == day;
+    }
+    if (!valid || hour > 23 || minute > 59 || second > 59) {
+        throw std::runtime_error("Invalid date_time '" + std::string(text) + "': expected YYYY-MM-DD HH:MM:SS");
+    }
+    return days * kSecondsPerDay + hour * 3600 + minute * 60 + second;
+}
+
+std::string format_date_time(int64_t epoch) {
+    auto days = epoch / kSecondsPerDay;
+    auto seconds = epoch % kSecondsPerDay;
+    if (seconds < 0) {
+        seconds += kSecondsPerDay;
+        --days;
+    }
+    int64_t year = 0;
+    int64_t month = 0;
+    int64_t day = 0;
+    civil_from_days(days, year, month, day);
+
+    std::string text = "0000-00-00 00:00:00";
+    const auto put = [&](size_t at, int64_t value, size_t digits) {
+        for (size_t i = digits; i > 0; --i) {
+            text[at + i - 1] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+    };
+    put(0, year, 4);
+    put(5, month, 2);
+    put(8, day, 2);
+    put(11, seconds / 3600, 2);
+    put(14, seconds / 60 % 60, 2);
+    put(17, seconds % 60, 2);
+    return text;
+}
+
+std::string encode_times(std::span<const int64_t> times) {
+    std::string out;
+    out.reserve(times.size() + 10);
+    write_varint(out, times.size());
+    // Wrapping arithmetic on uint64_t, so any pair of timestamps round-trips
+    uint64_t previous = 0;
+    uint64_t previous_delta = 0;
+    for (size_t i = 0; i < times.size(); ++i) {
+        const auto time = static_cast<uint64_t>(times[i]);
+        const auto delta = time - previous;
+        write_varint(out, zigzag(i < 2 ? delta : delta - previous_delta));
+        previous = time;
+        previous_delta = delta;
+    }
+    return out;
+}
+
+void decode_times(const void* data, size_t size, std::vector<int64_t>& out) {
+    ByteReader reader(data, size);
+    const auto count = reader.varint();
+    if (count > size) {
+        corrupt();
+    }
+    out.reserve(out.size() + count);
+    uint64_t previous = 0;
+    uint64_t previous_delta = 0;
+    for (uint64_t i = 0; i < count; ++i) {
+        const auto encoded = unzigzag(reader.varint());
+        const auto delta = i < 2 ? encoded : encoded + previous_delta;
+        previous += delta;
+        previous_delta = delta;
+        out.push_back(static_cast<int64_t>(previous));
+    }
+}
+
+// Gorilla: the first value verbatim, then per value the XOR with its predecessor: '0' when equal, '10' plus the
+// meaningful bits when they fit the previous leading/trailing-zero window, else '11', 5 bits of leading zeros,
+// 6 bits of length (0 meaning 64) and the meaningful bits.
+std::string encode_values(std::span<const double> values) {
+    std::string out;
+    write_varint(out, values.size());
+    if (values.empty()) {
+        return out;
+    }
+    BitWriter writer(out);
+    auto previous = std::bit_cast<uint64_t>(values[0]);
+    writer.write(previous, 64);
+    int previous_leading = -1;
+    int previous_trailing = 0;
+    for (size_t i = 1; i < values.size(); ++i) {
+        const auto current = std::bit_cast<uint64_t>(values[i]);
+        const auto x = current ^ previous;
+        previous = current;
+        if (x == 0) {
+            writer.write(0, 1);
+            continue;
+        }
+        const int leading = std::min(std::countl_zero(x), 31);
+        const int trailing = std::countr_zero(x);
+        if (previous_leading >= 0 && leading >= previous_leading && trailing >= previous_trailing) {
+            writer.write(0b10, 2);
+            writer.write(x >> previous_trailing, 64 - previous_leading - previous_trailing);
+        } else {
+            const int length = 64 - leading - trailing;
+            writer.write(0b11, 2);
+            writer.write(static_cast<uint64_t>(leading), 5);
+            writer.write(static_cast<uint64_t>(length == 64 ? 0 : length), 6);
+            writer.write(x >> trailing, length);
+            previous_leading = leading;
+            previous_trailing = trailing;
+        }
+    }
+    writer.finish();
+    return out;
+}
+
+void decode_values(const void* data, size_t size, std::vector<double>& out) {
+    ByteReader header(data, size);
+    const auto count = header.varint();
+    if (count == 0) {
+        return;
+    }
+    size_t rest = 0;
+    const auto* bytes = header.rest(rest);
+    // At least one bit per value after the first
+    if (rest < 8 || count - 1 > (rest - 8) * 8) {
+        corrupt();
+    }
+    BitReader reader(bytes, rest);
+    out.reserve(out.size() + count);
+    auto previous = reader.read(64);
+    out.push_back(std::bit_cast<double>(previous));
+    int leading = 0;
+    int trailing = 0;
+    for (uint64_t i = 1; i < count; ++i) {
+        if (reader.read(1) != 0) {
+            if (reader.read(1) != 0) {
+                leading = static_cast<int>(reader.read(5));
+                const auto length = static_cast<int>(reader.read(6));
+                trailing = 64 - leading - (length == 0 ? 64 : length);
+                if (trailing < 0) {
+                    corrupt();
+                }
+            }
+            previous ^= reader.read(64 - leading - trailing) << trailing;
+        }
+        out.push_back(std::bit_cast<double>(previous));
+    }
+}
+
+void register_functions(sqlite3* db) {
+    if (sqlite3_create_module(db, "quiver_unpack_time_series", &unpack_module, nullptr) != SQLITE_OK) {
+        throw std::runtime_error("Failed to register time series functions: " + std::string(sqlite3_errmsg(db)));
+    }
+}
+
+std::string rows(const std::string& table, const std::string& id_column, const std::string& column) {
+    return "(SELECT t." + id_column + " AS " + id_column + ", u.date_time AS date_time, u.value AS " + column +
+           " FROM " + table + " AS t, quiver_unpack_time_series(t.date_time, t." + column + ") AS u)";
+}
+
+}  // namespace quiver::time_series_codec
@@ -0,0 +1,46 @@
+#ifndef QUIVER_TIME_SERIES_CODEC_H
+#define QUIVER_TIME_SERIES_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct sqlite3;
+
+namespace quiver {
+
+// Compressed time series tables (Schema::is_compressed_time_series_table) store each element's series in chunks
+// of up to kChunkSize samples, one row per chunk keyed by (<collection>_id, chunk_start): chunk_start is the
+// chunk's first timestamp, date_time a BLOB of int64 epoch seconds (first value, first delta, then
+// delta-of-deltas, as zigzag varints) and every value column a BLOB of Gorilla XOR-compressed float64s.
+// Regular series compress to a byte or two per timestamp and a few bits per repeated value.
+namespace time_series_codec {
+
+constexpr size_t kChunkSize = 1024;
+constexpr const char* kChunkColumn = "chunk_start";
+
+// Seconds since 1970-01-01 00:00:00 of "YYYY-MM-DD[( |T)HH:MM[:SS]]"; throws for anything else
+int64_t parse_date_time(std::string_view text);
+// "YYYY-MM-DD HH:MM:SS"
+std::string format_date_time(int64_t epoch);
+
+std::string encode_times(std::span<const int64_t> times);
+std::string encode_values(std::span<const double> values);
+// Append the decoded samples to out; throw on a truncated or malformed BLOB
+void decode_times(const void* data, size_t size, std::vector<int64_t>& out);
+void decode_values(const void* data, size_t size, std::vector<double>& out);
+
+// Registers quiver_unpack_time_series(date_time_blob, value_blob) -> (date_time TEXT, value REAL, NULL for NaN)
+void register_functions(sqlite3* db);
+
+// Subquery with the (id_column, date_time, column) rows of a compressed table, one per sample (unordered)
+std::string rows(const std::string& table, const std::string& id_column, const std::string& column);
+
+}  // namespace time_series_codec
+
+}  // namespace quiver
+
+#endif  // QUIVER_TIME_SERIES_CODEC_H
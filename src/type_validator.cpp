@@ -13,11 +13,15 @@ void TypeValidator::validate_scalar(const std::string& table, const std::string&
 
 void TypeValidator::validate_array(const std::string& table,
                                    const std::string& column,
-                                   const std::vector<Value>& values) const {
+                                   const ArrayValues& values) const {
     auto expected = schema_.get_data_type(table, column);
-    for (size_t i = 0; i < values.size(); ++i) {
-        validate_value("array '" + column + "' index " + std::to_string(i), expected, values[i]);
-    }
+    std::visit(
+        [&](const auto& typed) {
+            if (!typed.empty()) {
+                validate_value("array '" + column + "' index 0", expected, typed.front());
+            }
+        },
+        values);
 }
 
 void TypeValidator::validate_value(const std::string& context, DataType expected_type, const Value& value) {
@@ -46,6 +50,10 @@ void TypeValidator::validate_value(const std::string& context, DataType expected
                     throw std::runtime_error("Type mismatch for " + context + ": expected " +
                                              data_type_to_string(expected_type) + ", got TEXT");
                 }
+            } else if constexpr (std::is_same_v<T, Blob>) {
+                // BLOB columns are only written through the packed vector and time series paths
+                throw std::runtime_error("Type mismatch for " + context + ": expected " +
+                                         data_type_to_string(expected_type) + ", got BLOB");
             }
         },
         value);
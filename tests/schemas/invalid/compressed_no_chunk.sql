@@ -0,0 +1,20 @@
+-- Invalid: Compressed time series table (BLOB date_time) without a chunk_start key
+PRAGMA foreign_keys = ON;
+
+CREATE TABLE Configuration (
+    id INTEGER PRIMARY KEY,
+    label TEXT UNIQUE NOT NULL
+) STRICT;
+
+CREATE TABLE Plant (
+    id INTEGER PRIMARY KEY AUTOINCREMENT,
+    label TEXT UNIQUE NOT NULL
+) STRICT;
+
+CREATE TABLE Plant_time_series_generation (
+    plant_id INTEGER,
+    date_time BLOB,
+    power BLOB,
+    FOREIGN KEY (plant_id) REFERENCES Plant(id) ON DELETE CASCADE ON UPDATE CASCADE,
+    PRIMARY KEY (plant_id, date_time)
+) STRICT;
@@ -0,0 +1,19 @@
+-- Invalid: Packed vector table (no vector_index) with a non-BLOB value column
+PRAGMA foreign_keys = ON;
+
+CREATE TABLE Configuration (
+    id INTEGER PRIMARY KEY,
+    label TEXT UNIQUE NOT NULL
+) STRICT;
+
+CREATE TABLE Collection (
+    id INTEGER PRIMARY KEY AUTOINCREMENT,
+    label TEXT UNIQUE NOT NULL
+) STRICT;
+
+CREATE TABLE Collection_vector_values (
+    id INTEGER PRIMARY KEY,
+    packed BLOB,
+    value REAL,
+    FOREIGN KEY (id) REFERENCES Collection(id) ON DELETE CASCADE ON UPDATE CASCADE
+) STRICT;
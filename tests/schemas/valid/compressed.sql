@@ -0,0 +1,23 @@
+-- Schema: Compressed time series group
+-- Tests: Chunks of delta-encoded epoch timestamps and XOR-compressed float64s, one row per chunk
+PRAGMA foreign_keys = ON;
+
+CREATE TABLE Configuration (
+    id INTEGER PRIMARY KEY,
+    label TEXT UNIQUE NOT NULL
+) STRICT;
+
+CREATE TABLE Plant (
+    id INTEGER PRIMARY KEY AUTOINCREMENT,
+    label TEXT UNIQUE NOT NULL
+) STRICT;
+
+CREATE TABLE Plant_time_series_generation (
+    plant_id INTEGER,
+    chunk_start INTEGER,
+    date_time BLOB,
+    power BLOB,
+    temperature BLOB,
+    FOREIGN KEY (plant_id) REFERENCES Plant(id) ON DELETE CASCADE ON UPDATE CASCADE,
+    PRIMARY KEY (plant_id, chunk_start)
+) STRICT;
@@ -0,0 +1,21 @@
+-- Schema: Packed vector group
+-- Tests: One row per element with each vector stored as a BLOB of little-endian float64s
+PRAGMA foreign_keys = ON;
+
+CREATE TABLE Configuration (
+    id INTEGER PRIMARY KEY,
+    label TEXT UNIQUE NOT NULL
+) STRICT;
+
+CREATE TABLE Collection (
+    id INTEGER PRIMARY KEY AUTOINCREMENT,
+    label TEXT UNIQUE NOT NULL,
+    some_integer INTEGER
+) STRICT;
+
+CREATE TABLE Collection_vector_profiles (
+    id INTEGER PRIMARY KEY,
+    load BLOB,
+    price BLOB,
+    FOREIGN KEY (id) REFERENCES Collection(id) ON DELETE CASCADE ON UPDATE CASCADE
+) STRICT;
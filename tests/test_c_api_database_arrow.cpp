@@ -0,0 +1,276 @@
+#include "test_utils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <quiver/c/arrow.h>
+#include <quiver/c/database.h>
+#include <quiver/c/element.h>
+#include <string>
+#include <vector>
+
+namespace {
+
+quiver_database_t* open_collections() {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    return quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options);
+}
+
+// Item 1 has values for everything, Item 2 only a label
+void create_items(quiver_database_t* db) {
+    auto e1 = quiver_element_create();
+    quiver_element_set_string(e1, "label", "Item 1");
+    quiver_element_set_integer(e1, "some_integer", 7);
+    quiver_element_set_float(e1, "some_float", 1.5);
+    const int64_t value_int[] = {1, 2, 3};
+    quiver_element_set_array_integer(e1, "value_int", value_int, 3);
+    const char* tags[] = {"a", "bc"};
+    quiver_element_set_array_string(e1, "tag", tags, 2);
+    quiver_database_create_element(db, "Collection", e1);
+    quiver_element_destroy(e1);
+
+    auto e2 = quiver_element_create();
+    quiver_element_set_string(e2, "label", "Item 2");
+    quiver_database_create_element(db, "Collection", e2);
+    quiver_element_destroy(e2);
+}
+
+bool is_valid(const ArrowArray& array, int64_t row) {
+    const auto* validity = static_cast<const uint8_t*>(array.buffers[0]);
+    return validity == nullptr || ((validity[row / 8] >> (row % 8)) & 1);
+}
+
+std::string text_at(const ArrowArray& array, int64_t row) {
+    const auto* offsets = static_cast<const int64_t*>(array.buffers[1]);
+    const auto* data = static_cast<const char*>(array.buffers[2]);
+    return std::string(data + offsets[row], data + offsets[row + 1]);
+}
+
+}  // namespace
+
+TEST(DatabaseCApi, ReadScalarIntegersArrow) {
+    auto db = open_collections();
+    ASSERT_NE(db, nullptr);
+    create_items(db);
+
+    ArrowSchema schema;
+    ArrowArray array;
+    ASSERT_EQ(quiver_database_read_scalar_integers_arrow(db, "Collection", "some_integer", &schema, &array),
+              QUIVER_OK);
+    // The export outlives the database
+    quiver_database_close(db);
+
+    EXPECT_STREQ(schema.format, "l");
+    EXPECT_STREQ(schema.name, "some_integer");
+    EXPECT_EQ(schema.flags, ARROW_FLAG_NULLABLE);
+    EXPECT_EQ(schema.n_children, 0);
+    ASSERT_EQ(array.length, 2);
+    EXPECT_EQ(array.null_count, 1);
+    ASSERT_EQ(array.n_buffers, 2);
+    EXPECT_TRUE(is_valid(array, 0));
+    EXPECT_FALSE(is_valid(array, 1));
+    EXPECT_EQ(static_cast<const int64_t*>(array.buffers[1])[0], 7);
+
+    schema.release(&schema);
+    array.release(&array);
+    EXPECT_EQ(schema.release, nullptr);
+    EXPECT_EQ(array.release, nullptr);
+}
+
+TEST(DatabaseCApi, ReadScalarStringsArrow) {
+    auto db = open_collections();
+    ASSERT_NE(db, nullptr);
+    create_items(db);
+
+    ArrowSchema schema;
+    ArrowArray array;
+    ASSERT_EQ(quiver_database_read_scalar_strings_arrow(db, "Collection", "label", &schema, &array), QUIVER_OK);
+    EXPECT_STREQ(schema.format, "U");
+    ASSERT_EQ(array.length, 2);
+    EXPECT_EQ(array.null_count, 0);
+    ASSERT_EQ(array.n_buffers, 3);
+    EXPECT_EQ(text_at(array, 0), "Item 1");
+    EXPECT_EQ(text_at(array, 1), "Item 2");
+    schema.release(&schema);
+    array.release(&array);
+
+    ASSERT_EQ(quiver_database_read_scalar_floats_arrow(db, "Collection", "some_float", &schema, &array), QUIVER_OK);
+    EXPECT_STREQ(schema.format, "g");
+    EXPECT_EQ(static_cast<const double*>(array.buffers[1])[0], 1.5);
+    EXPECT_FALSE(is_valid(array, 1));
+    schema.release(&schema);
+    array.release(&array);
+
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, ReadVectorAndSetArrow) {
+    auto db = open_collections();
+    ASSERT_NE(db, nullptr);
+    create_items(db);
+
+    ArrowSchema schema;
+    ArrowArray array;
+    ASSERT_EQ(quiver_database_read_vector_integers_arrow(db, "Collection", "value_int", &schema, &array), QUIVER_OK);
+    EXPECT_STREQ(schema.format, "+L");
+    ASSERT_EQ(schema.n_children, 1);
+    EXPECT_STREQ(schema.children[0]->format, "l");
+    // One list per element, the second empty
+    ASSERT_EQ(array.length, 2);
+    ASSERT_EQ(array.n_children, 1);
+    const auto* offsets = static_cast<const int64_t*>(array.buffers[1]);
+    EXPECT_EQ(offsets[0], 0);
+    EXPECT_EQ(offsets[1], 3);
+    EXPECT_EQ(offsets[2], 3);
+    const auto& values = *array.children[0];
+    ASSERT_EQ(values.length, 3);
+    const auto* items = static_cast<const int64_t*>(values.buffers[1]);
+    EXPECT_EQ(std::vector<int64_t>(items, items + 3), (std::vector<int64_t>{1, 2, 3}));
+
+    // A consumer may take a child over and release it on its own, after the parent
+    ArrowArray child = *array.children[0];
+    array.children[0]->release = nullptr;
+    array.release(&array);
+    EXPECT_EQ(static_cast<const int64_t*>(child.buffers[1])[2], 3);
+    child.release(&child);
+    schema.release(&schema);
+
+    ASSERT_EQ(quiver_database_read_set_strings_arrow(db, "Collection", "tag", &schema, &array), QUIVER_OK);
+    EXPECT_STREQ(schema.children[0]->format, "U");
+    ASSERT_EQ(array.length, 2);
+    const auto& tags = *array.children[0];
+    ASSERT_EQ(tags.length, 2);
+    std::vector<std::string> read{text_at(tags, 0), text_at(tags, 1)};
+    std::sort(read.begin(), read.end());
+    EXPECT_EQ(read, (std::vector<std::string>{"a", "bc"}));
+    schema.release(&schema);
+    array.release(&array);
+
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, QueryArrow) {
+    auto db = open_collections();
+    ASSERT_NE(db, nullptr);
+    create_items(db);
+
+    int param_types[] = {QUIVER_DATA_TYPE_INTEGER};
+    int64_t min_id = 0;
+    const void* param_values[] = {&min_id};
+    ArrowSchema schema;
+    ArrowArray array;
+    ASSERT_EQ(quiver_database_query_arrow(db,
+                                          "SELECT label, some_integer, CASE WHEN id = 1 THEN 2 ELSE 0.5 END AS mixed, "
+                                          "NULL AS no_value, x'00ff' AS bytes FROM Collection "
+                                          "WHERE id > ? ORDER BY id DESC",
+                                          param_types,
+                                          param_values,
+                                          1,
+                                          &schema,
+                                          &array),
+              QUIVER_OK);
+
+    EXPECT_STREQ(schema.format, "+s");
+    ASSERT_EQ(schema.n_children, 5);
+    ASSERT_EQ(array.n_children, 5);
+    ASSERT_EQ(array.length, 2);
+    EXPECT_STREQ(schema.children[0]->name, "label");
+    EXPECT_STREQ(schema.children[0]->format, "U");
+    EXPECT_EQ(text_at(*array.children[0], 0), "Item 2");
+
+    // Leading NULLs are kept once the column's type is known
+    EXPECT_STREQ(schema.children[1]->format, "l");
+    EXPECT_FALSE(is_valid(*array.children[1], 0));
+    EXPECT_EQ(static_cast<const int64_t*>(array.children[1]->buffers[1])[1], 7);
+
+    // Integers in a float column are widened
+    EXPECT_STREQ(schema.children[2]->format, "g");
+    const auto* mixed = static_cast<const double*>(array.children[2]->buffers[1]);
+    EXPECT_EQ(mixed[0], 0.5);
+    EXPECT_EQ(mixed[1], 2.0);
+
+    EXPECT_STREQ(schema.children[3]->format, "n");
+    EXPECT_EQ(array.children[3]->null_count, 2);
+
+    // BLOBs export as large_binary
+    EXPECT_STREQ(schema.children[4]->format, "Z");
+    EXPECT_EQ(text_at(*array.children[4], 1), std::string("\x00\xff", 2));
+
+    schema.release(&schema);
+    array.release(&array);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, QueryArrowMixedTypes) {
+    auto db = open_collections();
+    ASSERT_NE(db, nullptr);
+    create_items(db);
+
+    // An integer column turns float64 at its first REAL value, keeping the integers and NULLs before it
+    ArrowSchema schema;
+    ArrowArray array;
+    ASSERT_EQ(quiver_database_query_arrow(db,
+                                          "SELECT value FROM (SELECT 1 AS k, NULL AS value UNION ALL SELECT 2, 1 "
+                                          "UNION ALL SELECT 3, 1.5) ORDER BY k",
+                                          nullptr,
+                                          nullptr,
+                                          0,
+                                          &schema,
+                                          &array),
+              QUIVER_OK);
+    EXPECT_STREQ(schema.children[0]->format, "g");
+    ASSERT_EQ(array.children[0]->length, 3);
+    EXPECT_FALSE(is_valid(*array.children[0], 0));
+    const auto* values = static_cast<const double*>(array.children[0]->buffers[1]);
+    EXPECT_EQ(values[1], 1.0);
+    EXPECT_EQ(values[2], 1.5);
+    schema.release(&schema);
+    array.release(&array);
+
+    // Text and numbers in one column cannot share an Arrow type
+    std::memset(&schema, 0, sizeof(schema));
+    std::memset(&array, 0, sizeof(array));
+    EXPECT_EQ(quiver_database_query_arrow(db,
+                                          "SELECT CASE WHEN id = 1 THEN label ELSE id END FROM Collection",
+                                          nullptr,
+                                          nullptr,
+                                          0,
+                                          &schema,
+                                          &array),
+              QUIVER_ERROR_DATABASE);
+    EXPECT_EQ(quiver_database_query_arrow(db,
+                                          "SELECT CASE WHEN id = 1 THEN id ELSE label END FROM Collection",
+                                          nullptr,
+                                          nullptr,
+                                          0,
+                                          &schema,
+                                          &array),
+              QUIVER_ERROR_DATABASE);
+    EXPECT_EQ(schema.release, nullptr);
+
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, ArrowErrors) {
+    auto db = open_collections();
+    ASSERT_NE(db, nullptr);
+
+    ArrowSchema schema;
+    ArrowArray array;
+    std::memset(&schema, 0, sizeof(schema));
+    std::memset(&array, 0, sizeof(array));
+    EXPECT_EQ(quiver_database_read_scalar_integers_arrow(nullptr, "Collection", "some_integer", &schema, &array),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_read_vector_floats_arrow(db, "Collection", "value_float", nullptr, &array),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_read_scalar_integers_arrow(db, "Collection", "missing", &schema, &array),
+              QUIVER_ERROR_DATABASE);
+    EXPECT_EQ(quiver_database_query_arrow(db, "SELECT * FROM Missing", nullptr, nullptr, 0, &schema, &array),
+              QUIVER_ERROR_DATABASE);
+    // Failures leave the output untouched
+    EXPECT_EQ(schema.release, nullptr);
+    EXPECT_EQ(array.release, nullptr);
+
+    quiver_database_close(db);
+}
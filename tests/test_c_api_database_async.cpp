@@ -0,0 +1,185 @@
+#include "test_utils.h"
+
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <quiver/c/async.h>
+#include <quiver/c/database.h>
+#include <quiver/c/element.h>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+quiver_database_t* open_collections() {
+    auto options = quiver::test::quiet_options();
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options);
+    if (!db) {
+        return nullptr;
+    }
+    auto config = quiver_element_create();
+    quiver_element_set_string(config, "label", "Config");
+    quiver_database_create_element(db, "Configuration", config);
+    quiver_element_destroy(config);
+
+    for (int64_t i = 1; i <= 3; ++i) {
+        std::vector<double> values(static_cast<size_t>(i), 0.5 * static_cast<double>(i));
+        auto e = quiver_element_create();
+        quiver_element_set_string(e, "label", ("Item " + std::to_string(i)).c_str());
+        quiver_element_set_integer(e, "some_integer", i * 10);
+        quiver_element_set_array_float(e, "value_float", values.data(), static_cast<int32_t>(values.size()));
+        quiver_database_create_element(db, "Collection", e);
+        quiver_element_destroy(e);
+    }
+    return db;
+}
+
+}  // namespace
+
+TEST(DatabaseCApiAsync, ReadScalarsAsync) {
+    auto db = open_collections();
+    ASSERT_NE(db, nullptr);
+
+    quiver_future_t* future = nullptr;
+    ASSERT_EQ(quiver_database_read_scalar_integers_async(db, "Collection", "some_integer", &future), QUIVER_OK);
+    int done = 0;
+    ASSERT_EQ(quiver_future_wait(future, -1, &done), QUIVER_OK);
+    EXPECT_EQ(done, 1);
+
+    quiver_result_t* result = nullptr;
+    ASSERT_EQ(quiver_future_result(future, &result), QUIVER_OK);
+    ASSERT_NE(result, nullptr);
+    size_t count = 0;
+    const int64_t* values = nullptr;
+    EXPECT_EQ(quiver_result_count(result, &count), QUIVER_OK);
+    EXPECT_EQ(quiver_result_integers(result, &values), QUIVER_OK);
+    EXPECT_EQ(std::vector<int64_t>(values, values + count), (std::vector<int64_t>{10, 20, 30}));
+    quiver_result_free(result);
+    quiver_future_free(future);
+
+    ASSERT_EQ(quiver_database_read_scalar_strings_async(db, "Collection", "label", &future), QUIVER_OK);
+    ASSERT_EQ(quiver_future_wait(future, -1, &done), QUIVER_OK);
+    ASSERT_EQ(quiver_future_result(future, &result), QUIVER_OK);
+    const char* const* labels = nullptr;
+    EXPECT_EQ(quiver_result_strings(result, &labels), QUIVER_OK);
+    EXPECT_STREQ(labels[2], "Item 3");
+    quiver_result_free(result);
+    quiver_future_free(future);
+
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApiAsync, ReadVectorAsyncIsGrouped) {
+    auto db = open_collections();
+    ASSERT_NE(db, nullptr);
+
+    quiver_future_t* future = nullptr;
+    ASSERT_EQ(quiver_database_read_vector_floats_async(db, "Collection", "value_float", &future), QUIVER_OK);
+    int done = 0;
+    ASSERT_EQ(quiver_future_wait(future, -1, &done), QUIVER_OK);
+
+    quiver_result_t* result = nullptr;
+    ASSERT_EQ(quiver_future_result(future, &result), QUIVER_OK);
+    const size_t* offsets = nullptr;
+    size_t groups = 0;
+    ASSERT_EQ(quiver_result_offsets(result, &offsets, &groups), QUIVER_OK);
+    ASSERT_EQ(groups, 3);
+    EXPECT_EQ(std::vector<size_t>(offsets, offsets + groups + 1), (std::vector<size_t>{0, 1, 3, 6}));
+    const double* values = nullptr;
+    ASSERT_EQ(quiver_result_floats(result, &values), QUIVER_OK);
+    EXPECT_DOUBLE_EQ(values[5], 1.5);
+    quiver_result_free(result);
+    quiver_future_free(future);
+
+    // Scalar results are not grouped
+    ASSERT_EQ(quiver_database_read_scalar_floats_async(db, "Collection", "some_float", &future), QUIVER_OK);
+    ASSERT_EQ(quiver_future_wait(future, -1, &done), QUIVER_OK);
+    ASSERT_EQ(quiver_future_result(future, &result), QUIVER_OK);
+    EXPECT_EQ(quiver_result_offsets(result, &offsets, &groups), QUIVER_ERROR_INVALID_ARGUMENT);
+    quiver_result_free(result);
+    quiver_future_free(future);
+
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApiAsync, ErrorsAreReportedByResult) {
+    auto db = open_collections();
+    ASSERT_NE(db, nullptr);
+
+    quiver_future_t* future = nullptr;
+    EXPECT_EQ(quiver_database_read_scalar_floats_async(nullptr, "Collection", "some_float", &future),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_read_scalar_floats_async(db, "Collection", nullptr, &future),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_future_wait(nullptr, 0, nullptr), QUIVER_ERROR_INVALID_ARGUMENT);
+
+    ASSERT_EQ(quiver_database_read_scalar_floats_async(db, "Missing", "some_float", &future), QUIVER_OK);
+    int done = 0;
+    ASSERT_EQ(quiver_future_wait(future, -1, &done), QUIVER_OK);
+    quiver_result_t* result = nullptr;
+    EXPECT_EQ(quiver_future_result(future, &result), QUIVER_ERROR_DATABASE);
+    EXPECT_NE(std::string(quiver_get_last_error()), "");
+    quiver_future_free(future);
+
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApiAsync, CancelAndCloseFinishEveryFuture) {
+    auto db = open_collections();
+    ASSERT_NE(db, nullptr);
+
+    std::vector<quiver_future_t*> futures(32);
+    for (auto& future : futures) {
+        ASSERT_EQ(quiver_database_read_vector_floats_async(db, "Collection", "value_float", &future), QUIVER_OK);
+    }
+    for (size_t i = 0; i < futures.size(); i += 2) {
+        EXPECT_EQ(quiver_future_cancel(futures[i]), QUIVER_OK);
+    }
+    // Closing cancels whatever is still queued; the handles outlive the database
+    quiver_database_close(db);
+
+    for (size_t i = 0; i < futures.size(); ++i) {
+        int done = 0;
+        ASSERT_EQ(quiver_future_wait(futures[i], 0, &done), QUIVER_OK);
+        EXPECT_EQ(done, 1);
+        const auto status = quiver_future_result(futures[i], nullptr);
+        EXPECT_TRUE(status == QUIVER_OK || status == QUIVER_ERROR_CANCELLED) << status;
+        EXPECT_EQ(quiver_future_cancel(futures[i]), QUIVER_OK);
+        quiver_future_free(futures[i]);
+    }
+}
+
+TEST(DatabaseCApiAsync, ExportAndImportAsync) {
+    const auto csv_path = (fs::temp_directory_path() / "quiver_async_test.csv").string();
+    auto source = open_collections();
+    auto options = quiver::test::quiet_options();
+    auto target = quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options);
+    ASSERT_NE(source, nullptr);
+    ASSERT_NE(target, nullptr);
+
+    quiver_future_t* future = nullptr;
+    int done = 0;
+    ASSERT_EQ(quiver_database_export_to_csv_async(source, "Configuration", csv_path.c_str(), &future), QUIVER_OK);
+    ASSERT_EQ(quiver_future_wait(future, -1, &done), QUIVER_OK);
+    quiver_result_t* result = nullptr;
+    EXPECT_EQ(quiver_future_result(future, &result), QUIVER_OK);
+    EXPECT_EQ(result, nullptr);
+    quiver_future_free(future);
+
+    ASSERT_EQ(quiver_database_import_from_csv_async(target, "Configuration", csv_path.c_str(), &future), QUIVER_OK);
+    ASSERT_EQ(quiver_future_wait(future, -1, &done), QUIVER_OK);
+    EXPECT_EQ(quiver_future_result(future, nullptr), QUIVER_OK);
+    quiver_future_free(future);
+
+    char* label = nullptr;
+    int has_value = 0;
+    EXPECT_EQ(quiver_database_read_scalar_strings_by_id(target, "Configuration", "label", 1, &label, &has_value),
+              QUIVER_OK);
+    EXPECT_STREQ(label, "Config");
+    delete[] label;
+
+    quiver_database_close(source);
+    quiver_database_close(target);
+    fs::remove(csv_path);
+}
@@ -117,3 +117,179 @@ TEST(DatabaseCApi, CreateElementWithDatetime) {
     quiver_element_destroy(element);
     quiver_database_close(db);
 }
+
+TEST(DatabaseCApi, CreateElements) {
+    auto options = quiver::test::quiet_options();
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    quiver_element_t* elements[3];
+    const char* labels[3] = {"Config 1", "Config 2", "Config 3"};
+    for (int i = 0; i < 3; ++i) {
+        elements[i] = quiver_element_create();
+        quiver_element_set_string(elements[i], "label", labels[i]);
+        quiver_element_set_integer(elements[i], "integer_attribute", i * 10);
+    }
+
+    int64_t ids[3] = {0, 0, 0};
+    auto err = quiver_database_create_elements(db, "Configuration", elements, 3, ids);
+    EXPECT_EQ(err, QUIVER_OK);
+    EXPECT_EQ(ids[0], 1);
+    EXPECT_EQ(ids[1], 2);
+    EXPECT_EQ(ids[2], 3);
+
+    int64_t* values = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(quiver_database_read_scalar_integers(db, "Configuration", "integer_attribute", &values, &count),
+              QUIVER_OK);
+    ASSERT_EQ(count, 3);
+    EXPECT_EQ(values[2], 20);
+    quiver_free_integer_array(values);
+
+    for (auto* element : elements) {
+        quiver_element_destroy(element);
+    }
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, CreateElementsRollsBackOnFailure) {
+    auto options = quiver::test::quiet_options();
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    quiver_element_t* elements[2];
+    for (auto& element : elements) {
+        element = quiver_element_create();
+        quiver_element_set_string(element, "label", "Duplicate");
+    }
+
+    int64_t ids[2];
+    auto err = quiver_database_create_elements(db, "Configuration", elements, 2, ids);
+    EXPECT_EQ(err, QUIVER_ERROR_DATABASE);
+
+    int64_t* values = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(quiver_database_read_element_ids(db, "Configuration", &values, &count), QUIVER_OK);
+    EXPECT_EQ(count, 0);
+    quiver_free_integer_array(values);
+
+    for (auto* element : elements) {
+        quiver_element_destroy(element);
+    }
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, CreateElementsNullArguments) {
+    auto options = quiver::test::quiet_options();
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto element = quiver_element_create();
+    quiver_element_set_string(element, "label", "Config 1");
+    quiver_element_t* elements[2] = {element, nullptr};
+    int64_t ids[2];
+
+    EXPECT_EQ(quiver_database_create_elements(nullptr, "Configuration", elements, 1, ids),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_create_elements(db, nullptr, elements, 1, ids), QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_create_elements(db, "Configuration", nullptr, 1, ids), QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_create_elements(db, "Configuration", elements, 1, nullptr),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_create_elements(db, "Configuration", elements, 2, ids), QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_create_elements(db, "Configuration", nullptr, 0, nullptr), QUIVER_OK);
+
+    quiver_element_destroy(element);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, UpsertElements) {
+    auto options = quiver::test::quiet_options();
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto element = quiver_element_create();
+    quiver_element_set_string(element, "label", "Config 1");
+    quiver_element_set_integer(element, "integer_attribute", 1);
+    int64_t id = 0;
+    ASSERT_EQ(quiver_database_upsert_element(db, "Configuration", element, &id), QUIVER_OK);
+    EXPECT_EQ(id, 1);
+
+    quiver_element_t* elements[2] = {quiver_element_create(), quiver_element_create()};
+    quiver_element_set_string(elements[0], "label", "Config 2");
+    quiver_element_set_string(elements[1], "label", "Config 1");
+    quiver_element_set_integer(elements[1], "integer_attribute", 7);
+    int64_t ids[2] = {0, 0};
+    ASSERT_EQ(quiver_database_upsert_elements(db, "Configuration", elements, 2, ids), QUIVER_OK);
+    EXPECT_EQ(ids[1], 1);
+
+    int64_t* values = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(quiver_database_read_scalar_integers(db, "Configuration", "integer_attribute", &values, &count),
+              QUIVER_OK);
+    ASSERT_EQ(count, 2);
+    EXPECT_EQ(values[0], 7);
+    quiver_free_integer_array(values);
+
+    EXPECT_EQ(quiver_database_upsert_element(db, "Configuration", element, nullptr), QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_upsert_elements(db, "Configuration", nullptr, 1, ids), QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_upsert_elements(db, "Configuration", nullptr, 0, nullptr), QUIVER_OK);
+
+    quiver_element_destroy(element);
+    for (auto* e : elements) {
+        quiver_element_destroy(e);
+    }
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, CreateElementsColumns) {
+    auto options = quiver::test::quiet_options();
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    const char* labels[3] = {"Config 1", "Config 2", "Config 3"};
+    int64_t integers[3] = {10, 0, 30};
+    uint8_t nulls[3] = {0, 1, 0};
+    double floats[3] = {0.5, 1.5, 2.5};
+    quiver_scalar_column_t columns[3] = {
+        {"label", QUIVER_DATA_TYPE_STRING, nullptr, nullptr, const_cast<char**>(labels), nullptr},
+        {"integer_attribute", QUIVER_DATA_TYPE_INTEGER, integers, nullptr, nullptr, nulls},
+        {"float_attribute", QUIVER_DATA_TYPE_FLOAT, nullptr, floats, nullptr, nullptr},
+    };
+
+    int64_t ids[3] = {0, 0, 0};
+    ASSERT_EQ(quiver_database_create_elements_columns(db, "Configuration", columns, 3, 3, ids), QUIVER_OK);
+    EXPECT_EQ(ids[2], 3);
+
+    int64_t* values = nullptr;
+    uint8_t* validity = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(quiver_database_read_scalar_integers_nullable(
+                  db, "Configuration", "integer_attribute", &values, &validity, &count),
+              QUIVER_OK);
+    ASSERT_EQ(count, 3);
+    // A null leaves the attribute unset, so the column default applies
+    EXPECT_EQ(validity[0], 0b111);
+    EXPECT_EQ(values[0], 10);
+    EXPECT_EQ(values[1], 6);
+    EXPECT_EQ(values[2], 30);
+    quiver_free_integer_array(values);
+    quiver_free_validity_bitmap(validity);
+
+    double value = 0;
+    int has_value = 0;
+    ASSERT_EQ(quiver_database_read_scalar_floats_by_id(db, "Configuration", "float_attribute", 2, &value, &has_value),
+              QUIVER_OK);
+    EXPECT_EQ(value, 1.5);
+
+    // Failures roll the whole batch back
+    EXPECT_EQ(quiver_database_create_elements_columns(db, "Configuration", columns, 3, 3, ids), QUIVER_ERROR_DATABASE);
+    columns[1].integers = nullptr;
+    EXPECT_EQ(quiver_database_create_elements_columns(db, "Configuration", columns, 3, 3, ids),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_create_elements_columns(db, "Configuration", nullptr, 0, 0, nullptr), QUIVER_OK);
+    ASSERT_EQ(quiver_database_read_element_ids(db, "Configuration", &values, &count), QUIVER_OK);
+    EXPECT_EQ(count, 3);
+    quiver_free_integer_array(values);
+
+    quiver_database_close(db);
+}
@@ -3,6 +3,8 @@
 #include <gtest/gtest.h>
 #include <quiver/c/database.h>
 #include <quiver/c/element.h>
+#include <quiver/c/filter.h>
+#include <string>
 
 TEST(DatabaseCApi, DeleteElementById) {
     auto options = quiver_database_options_default();
@@ -236,3 +238,46 @@ TEST(DatabaseCApi, DeleteElementByIdNullArguments) {
 
     quiver_database_close(db);
 }
+
+TEST(DatabaseCApi, DeleteElementsByIdsAndWhere) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    int64_t ids[4];
+    for (int i = 0; i < 4; ++i) {
+        auto e = quiver_element_create();
+        quiver_element_set_string(e, "label", ("Config " + std::to_string(i)).c_str());
+        quiver_element_set_integer(e, "integer_attribute", i * 10);
+        ids[i] = quiver_database_create_element(db, "Configuration", e);
+        quiver_element_destroy(e);
+    }
+
+    size_t deleted = 0;
+    int64_t doomed[] = {ids[0], 999};
+    EXPECT_EQ(quiver_database_delete_elements_by_ids(db, "Configuration", doomed, 2, &deleted), QUIVER_OK);
+    EXPECT_EQ(deleted, 1u);
+
+    auto filter = quiver_filter_create();
+    quiver_filter_where_integer(filter, "integer_attribute", QUIVER_FILTER_GREATER, 10);
+    EXPECT_EQ(quiver_database_delete_elements_where(db, "Configuration", filter, &deleted), QUIVER_OK);
+    EXPECT_EQ(deleted, 2u);
+    quiver_filter_destroy(filter);
+
+    int64_t* remaining = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(quiver_database_read_element_ids(db, "Configuration", &remaining, &count), QUIVER_OK);
+    ASSERT_EQ(count, 1u);
+    EXPECT_EQ(remaining[0], ids[1]);
+    quiver_free_integer_array(remaining);
+
+    EXPECT_EQ(quiver_database_delete_elements_by_ids(db, "Configuration", nullptr, 1, &deleted),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_delete_elements_by_ids(db, "Configuration", nullptr, 0, nullptr),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_delete_elements_where(db, "Configuration", nullptr, &deleted),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+
+    quiver_database_close(db);
+}
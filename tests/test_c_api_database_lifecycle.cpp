@@ -11,8 +11,10 @@ class TempFileFixture : public ::testing::Test {
 protected:
     void SetUp() override { path = (fs::temp_directory_path() / "quiver_test.db").string(); }
     void TearDown() override {
-        if (fs::exists(path))
-            fs::remove(path);
+        for (const auto& file : {path, path + "-wal", path + "-shm"}) {
+            if (fs::exists(file))
+                fs::remove(file);
+        }
     }
     std::string path;
 };
@@ -148,6 +150,44 @@ TEST_F(TempFileFixture, DefaultOptions) {
 
     EXPECT_EQ(options.read_only, 0);
     EXPECT_EQ(options.console_level, QUIVER_LOG_INFO);
+    EXPECT_EQ(options.journal_mode, QUIVER_JOURNAL_MODE_DEFAULT);
+    EXPECT_EQ(options.synchronous, QUIVER_SYNCHRONOUS_DEFAULT);
+    EXPECT_EQ(options.cache_size, 0);
+    EXPECT_EQ(options.mapped, 0);
+    EXPECT_EQ(options.validate_schema, 1);
+    EXPECT_EQ(options.file_level, QUIVER_LOG_DEBUG);
+    EXPECT_EQ(options.async_logging, 0);
+    EXPECT_EQ(options.collect_stats, 0);
+    EXPECT_EQ(options.slow_query_ms, 0);
+    EXPECT_EQ(options.busy_timeout_ms, 0);
+    EXPECT_EQ(options.statement_timeout_ms, 0);
+    EXPECT_EQ(options.load_into_memory, 0);
+}
+
+TEST_F(TempFileFixture, OpenWithPragmaOptions) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    options.journal_mode = QUIVER_JOURNAL_MODE_WAL;
+    options.synchronous = QUIVER_SYNCHRONOUS_NORMAL;
+    options.cache_size = -4096;
+    auto db = quiver_database_open(path.c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    char* mode = nullptr;
+    int has_value = 0;
+    ASSERT_EQ(quiver_database_query_string(db, "PRAGMA journal_mode", &mode, &has_value), QUIVER_OK);
+    EXPECT_STREQ(mode, "wal");
+    delete[] mode;
+
+    int64_t value = 0;
+    ASSERT_EQ(quiver_database_query_integer(db, "PRAGMA synchronous", &value, &has_value), QUIVER_OK);
+    EXPECT_EQ(value, 1);
+    ASSERT_EQ(quiver_database_query_integer(db, "PRAGMA cache_size", &value, &has_value), QUIVER_OK);
+    EXPECT_EQ(value, -4096);
+    quiver_database_close(db);
+
+    options.page_size = 1000;
+    EXPECT_EQ(quiver_database_open(":memory:", &options), nullptr);
 }
 
 TEST_F(TempFileFixture, OpenWithNullOptions) {
@@ -172,6 +212,26 @@ TEST_F(TempFileFixture, OpenReadOnly) {
     quiver_database_close(db);
 }
 
+TEST_F(TempFileFixture, OpenMapped) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_open(path.c_str(), &options);
+    ASSERT_NE(db, nullptr);
+    quiver_database_close(db);
+
+    options.mapped = 1;
+    db = quiver_database_open(path.c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    int64_t value = 0;
+    int has_value = 0;
+    ASSERT_EQ(quiver_database_query_integer(db, "PRAGMA query_only", &value, &has_value), QUIVER_OK);
+    EXPECT_EQ(value, 1);
+    quiver_database_close(db);
+
+    EXPECT_EQ(quiver_database_open(":memory:", &options), nullptr);
+}
+
 // ============================================================================
 // Current version tests
 // ============================================================================
@@ -218,6 +278,18 @@ TEST_F(TempFileFixture, FromSchemaInvalidPath) {
     EXPECT_EQ(db, nullptr);
 }
 
+TEST_F(TempFileFixture, FromSchemaWithoutValidation) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    const auto schema = INVALID_SCHEMA("vector_no_index.sql");
+    EXPECT_EQ(quiver_database_from_schema(":memory:", schema.c_str(), &options), nullptr);
+
+    options.validate_schema = 0;
+    auto db = quiver_database_from_schema(":memory:", schema.c_str(), &options);
+    ASSERT_NE(db, nullptr);
+    quiver_database_close(db);
+}
+
 // ============================================================================
 // From migrations tests
 // ============================================================================
@@ -244,6 +316,111 @@ TEST_F(TempFileFixture, FromMigrationsInvalidPath) {
     EXPECT_EQ(db, nullptr);
 }
 
+TEST_F(TempFileFixture, BackupSnapshotAndClone) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+    auto element = quiver_element_create();
+    quiver_element_set_string(element, "label", "Config");
+    EXPECT_GT(quiver_database_create_element(db, "Configuration", element), 0);
+    quiver_element_destroy(element);
+
+    int steps = 0;
+    auto count_steps = [](int, int, void* user_data) { ++*static_cast<int*>(user_data); };
+    ASSERT_EQ(quiver_database_backup_to(db, path.c_str(), 1, count_steps, &steps), QUIVER_OK);
+    EXPECT_GT(steps, 0);
+
+    quiver_database_t* clone = nullptr;
+    ASSERT_EQ(quiver_database_clone_in_memory(db, &clone), QUIVER_OK);
+    ASSERT_NE(clone, nullptr);
+    EXPECT_STREQ(quiver_database_path(clone), ":memory:");
+    quiver_database_close(clone);
+    quiver_database_close(db);
+
+    auto snapshot = quiver_database_from_snapshot(path.c_str(), &options);
+    ASSERT_NE(snapshot, nullptr);
+    int64_t count = 0;
+    int has_value = 0;
+    ASSERT_EQ(quiver_database_query_integer(snapshot, "SELECT count(*) FROM Configuration", &count, &has_value),
+              QUIVER_OK);
+    EXPECT_EQ(count, 1);
+    EXPECT_EQ(quiver_database_backup_to(snapshot, nullptr, 0, nullptr, nullptr), QUIVER_ERROR_INVALID_ARGUMENT);
+    quiver_database_close(snapshot);
+
+    EXPECT_EQ(quiver_database_from_snapshot("nonexistent/quiver.db", &options), nullptr);
+    EXPECT_EQ(quiver_database_clone_in_memory(nullptr, &clone), QUIVER_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(TempFileFixture, LoadIntoMemoryAndFlush) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    options.load_into_memory = 1;
+    auto db = quiver_database_from_schema(path.c_str(), VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+    EXPECT_FALSE(fs::exists(path));
+    ASSERT_EQ(quiver_database_flush(db), QUIVER_OK);
+    EXPECT_TRUE(fs::exists(path));
+    quiver_database_close(db);
+
+    options.load_into_memory = 0;
+    db = quiver_database_open(path.c_str(), &options);
+    ASSERT_NE(db, nullptr);
+    int64_t count = 0;
+    int has_value = 0;
+    ASSERT_EQ(quiver_database_query_integer(
+                  db, "SELECT count(*) FROM sqlite_master WHERE name = 'Configuration'", &count, &has_value),
+              QUIVER_OK);
+    EXPECT_EQ(count, 1);
+    // Writes already go to the file
+    EXPECT_EQ(quiver_database_flush(db), QUIVER_OK);
+    quiver_database_close(db);
+
+    EXPECT_EQ(quiver_database_flush(nullptr), QUIVER_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(TempFileFixture, TrackChanges) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+    int64_t token = 0;
+    EXPECT_EQ(quiver_database_change_token(db, &token), QUIVER_ERROR_DATABASE);
+    quiver_database_close(db);
+
+    options.track_changes = 1;
+    db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+    ASSERT_EQ(quiver_database_change_token(db, &token), QUIVER_OK);
+    EXPECT_EQ(token, 0);
+
+    int64_t id = 0;
+    int has_value = 0;
+    ASSERT_EQ(quiver_database_query_integer(
+                  db, "INSERT INTO Configuration (label) VALUES ('Config 1') RETURNING id", &id, &has_value),
+              QUIVER_OK);
+
+    quiver_change_t* changes = nullptr;
+    size_t count = 0;
+    int64_t next = 0;
+    ASSERT_EQ(quiver_database_changes_since(db, token, &changes, &count, &next), QUIVER_OK);
+    ASSERT_EQ(count, 1);
+    EXPECT_STREQ(changes[0].collection, "Configuration");
+    EXPECT_EQ(changes[0].id, id);
+    EXPECT_EQ(changes[0].attribute, nullptr);
+    EXPECT_EQ(changes[0].kind, QUIVER_CHANGE_CREATED);
+    EXPECT_GT(next, token);
+    quiver_free_changes(changes, count);
+
+    ASSERT_EQ(quiver_database_discard_changes(db, next), QUIVER_OK);
+    ASSERT_EQ(quiver_database_changes_since(db, 0, &changes, &count, &next), QUIVER_OK);
+    EXPECT_EQ(count, 0);
+    EXPECT_EQ(changes, nullptr);
+
+    EXPECT_EQ(quiver_database_changes_since(db, 0, nullptr, &count, &next), QUIVER_ERROR_INVALID_ARGUMENT);
+    quiver_database_close(db);
+}
+
 // ============================================================================
 // Relation operation tests
 // ============================================================================
@@ -412,6 +589,55 @@ TEST_F(TempFileFixture, ReadScalarRelationValid) {
     quiver_database_close(db);
 }
 
+TEST_F(TempFileFixture, SetScalarRelationsAndReadIds) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("relations.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    for (const auto* label : {"Parent 1", "Parent 2"}) {
+        auto parent = quiver_element_create();
+        quiver_element_set_string(parent, "label", label);
+        quiver_database_create_element(db, "Parent", parent);
+        quiver_element_destroy(parent);
+    }
+    for (const auto* label : {"Child 1", "Child 2", "Child 3"}) {
+        auto child = quiver_element_create();
+        quiver_element_set_string(child, "label", label);
+        quiver_database_create_element(db, "Child", child);
+        quiver_element_destroy(child);
+    }
+
+    const char* from_labels[] = {"Child 1", "Child 3"};
+    const char* to_labels[] = {"Parent 2", "Parent 1"};
+    auto err = quiver_database_set_scalar_relations(db, "Child", "parent_id", from_labels, to_labels, 2);
+    EXPECT_EQ(err, QUIVER_OK);
+
+    int64_t* ids = nullptr;
+    size_t count = 0;
+    err = quiver_database_read_scalar_relation_ids(db, "Child", "parent_id", &ids, &count);
+    EXPECT_EQ(err, QUIVER_OK);
+    ASSERT_EQ(count, 3);
+    EXPECT_EQ(ids[0], 2);
+    EXPECT_EQ(ids[1], 0);
+    EXPECT_EQ(ids[2], 1);
+    quiver_free_integer_array(ids);
+
+    const char* null_label[] = {nullptr};
+    err = quiver_database_set_scalar_relations(db, "Child", "parent_id", from_labels, null_label, 1);
+    EXPECT_EQ(err, QUIVER_ERROR_INVALID_ARGUMENT);
+    err = quiver_database_set_scalar_relations(db, "Child", "parent_id", nullptr, to_labels, 2);
+    EXPECT_EQ(err, QUIVER_ERROR_INVALID_ARGUMENT);
+    err = quiver_database_read_scalar_relation_ids(db, "Child", "parent_id", nullptr, &count);
+    EXPECT_EQ(err, QUIVER_ERROR_INVALID_ARGUMENT);
+
+    const char* unknown[] = {"Parent 9"};
+    err = quiver_database_set_scalar_relations(db, "Child", "parent_id", from_labels, unknown, 1);
+    EXPECT_EQ(err, QUIVER_ERROR_DATABASE);
+
+    quiver_database_close(db);
+}
+
 // ============================================================================
 // Additional error handling tests
 // ============================================================================
@@ -631,3 +857,69 @@ TEST_F(TempFileFixture, UpdateElementNullElement) {
 
     quiver_database_close(db);
 }
+
+TEST_F(TempFileFixture, CsvExportImport) {
+    const auto csv_path = path + ".csv";
+    auto options = quiver::test::quiet_options();
+    auto source = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    auto target = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(source, nullptr);
+    ASSERT_NE(target, nullptr);
+
+    auto element = quiver_element_create();
+    quiver_element_set_string(element, "label", "Config 1");
+    quiver_element_set_integer(element, "integer_attribute", 42);
+    quiver_database_create_element(source, "Configuration", element);
+    quiver_element_destroy(element);
+
+    EXPECT_EQ(quiver_database_export_to_csv(source, "Configuration", csv_path.c_str()), QUIVER_OK);
+    EXPECT_EQ(quiver_database_import_from_csv(target, "Configuration", csv_path.c_str()), QUIVER_OK);
+
+    int64_t value = 0;
+    int has_value = 0;
+    EXPECT_EQ(quiver_database_read_scalar_integers_by_id(target, "Configuration", "integer_attribute", 1, &value,
+                                                         &has_value),
+              QUIVER_OK);
+    EXPECT_EQ(has_value, 1);
+    EXPECT_EQ(value, 42);
+
+    EXPECT_EQ(quiver_database_import_from_csv(target, "Missing", csv_path.c_str()), QUIVER_ERROR_DATABASE);
+    EXPECT_EQ(quiver_database_export_to_csv(source, nullptr, csv_path.c_str()), QUIVER_ERROR_INVALID_ARGUMENT);
+
+    quiver_database_close(source);
+    quiver_database_close(target);
+    fs::remove(csv_path);
+}
+
+TEST_F(TempFileFixture, ArrowExportImportCollection) {
+    const auto directory = path + ".arrow";
+    auto options = quiver::test::quiet_options();
+    auto source = quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options);
+    auto target = quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options);
+    ASSERT_NE(source, nullptr);
+    ASSERT_NE(target, nullptr);
+
+    auto element = quiver_element_create();
+    quiver_element_set_string(element, "label", "Item 1");
+    quiver_element_set_integer(element, "some_integer", 42);
+    quiver_database_create_element(source, "Collection", element);
+    quiver_element_destroy(element);
+
+    EXPECT_EQ(quiver_database_export_collection(source, "Collection", directory.c_str()), QUIVER_OK);
+    EXPECT_EQ(quiver_database_import_collection(target, "Collection", directory.c_str()), QUIVER_OK);
+
+    int64_t value = 0;
+    int has_value = 0;
+    EXPECT_EQ(
+        quiver_database_read_scalar_integers_by_id(target, "Collection", "some_integer", 1, &value, &has_value),
+        QUIVER_OK);
+    EXPECT_EQ(has_value, 1);
+    EXPECT_EQ(value, 42);
+
+    EXPECT_EQ(quiver_database_import_collection(target, "Missing", directory.c_str()), QUIVER_ERROR_DATABASE);
+    EXPECT_EQ(quiver_database_export_collection(source, "Collection", nullptr), QUIVER_ERROR_INVALID_ARGUMENT);
+
+    quiver_database_close(source);
+    quiver_database_close(target);
+    fs::remove_all(directory);
+}
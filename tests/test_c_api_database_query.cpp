@@ -1,6 +1,7 @@
 #include "test_utils.h"
 
 #include <gtest/gtest.h>
+#include <quiver/c/cursor.h>
 #include <quiver/c/database.h>
 #include <quiver/c/element.h>
 #include <string>
@@ -430,3 +431,370 @@ TEST(DatabaseCApiQuery, QueryParamsNullDb) {
     auto err = quiver_database_query_integer_params(nullptr, "SELECT 1", nullptr, nullptr, 0, &value, &has_value);
     EXPECT_EQ(err, QUIVER_ERROR_INVALID_ARGUMENT);
 }
+
+// ============================================================================
+// Statement cache tests
+// ============================================================================
+
+TEST(DatabaseCApiQuery, StatementCacheStats) {
+    auto options = quiver::test::quiet_options();
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    quiver_statement_cache_stats_t before;
+    ASSERT_EQ(quiver_database_statement_cache_stats(db, &before), QUIVER_OK);
+    EXPECT_EQ(before.capacity, static_cast<size_t>(options.statement_cache_size));
+
+    int64_t value = 0;
+    int has_value = 0;
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(quiver_database_query_integer(db, "SELECT 42", &value, &has_value), QUIVER_OK);
+        EXPECT_EQ(value, 42);
+    }
+
+    quiver_statement_cache_stats_t after;
+    ASSERT_EQ(quiver_database_statement_cache_stats(db, &after), QUIVER_OK);
+    EXPECT_EQ(after.misses - before.misses, 1);
+    EXPECT_EQ(after.hits - before.hits, 2);
+
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApiQuery, StatementCacheDisabled) {
+    auto options = quiver::test::quiet_options();
+    options.statement_cache_size = 0;
+    auto db = quiver_database_open(":memory:", &options);
+    ASSERT_NE(db, nullptr);
+
+    quiver_statement_cache_stats_t stats;
+    ASSERT_EQ(quiver_database_statement_cache_stats(db, &stats), QUIVER_OK);
+    EXPECT_EQ(stats.capacity, 0u);
+
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApiQuery, StatementCacheStatsNullArguments) {
+    quiver_statement_cache_stats_t stats;
+    EXPECT_EQ(quiver_database_statement_cache_stats(nullptr, &stats), QUIVER_ERROR_INVALID_ARGUMENT);
+
+    auto options = quiver::test::quiet_options();
+    auto db = quiver_database_open(":memory:", &options);
+    ASSERT_NE(db, nullptr);
+    EXPECT_EQ(quiver_database_statement_cache_stats(db, nullptr), QUIVER_ERROR_INVALID_ARGUMENT);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApiQuery, DatabaseStats) {
+    auto options = quiver::test::quiet_options();
+    options.collect_stats = 1;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+    ASSERT_EQ(quiver_database_reset_stats(db), QUIVER_OK);
+
+    int64_t value = 0;
+    int has_value = 0;
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_EQ(quiver_database_query_integer(db, "SELECT 42", &value, &has_value), QUIVER_OK);
+    }
+
+    quiver_database_stats_t stats;
+    ASSERT_EQ(quiver_database_stats(db, &stats), QUIVER_OK);
+    ASSERT_EQ(stats.operation_count, 1u);
+    EXPECT_STREQ(stats.operations[0].name, "query_integer");
+    EXPECT_EQ(stats.operations[0].calls, 2);
+    EXPECT_EQ(stats.operations[0].rows_read, 2);
+    ASSERT_EQ(stats.statement_count, 1u);
+    EXPECT_STREQ(stats.statements[0].sql, "SELECT 42");
+    EXPECT_EQ(stats.statements[0].executions, 2);
+    EXPECT_EQ(stats.statements[0].prepares, 1);
+    EXPECT_EQ(stats.statement_cache.capacity, static_cast<size_t>(options.statement_cache_size));
+    quiver_free_database_stats(&stats);
+    EXPECT_EQ(stats.operations, nullptr);
+
+    EXPECT_EQ(quiver_database_stats(nullptr, &stats), QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_reset_stats(nullptr), QUIVER_ERROR_INVALID_ARGUMENT);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApiQuery, MemoryUsageAndShrink) {
+    auto options = quiver::test::quiet_options();
+    options.cache_reads = 1;
+    options.read_cache_limit = 1 << 20;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    char** labels = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(quiver_database_read_scalar_strings(db, "Configuration", "label", &labels, &count), QUIVER_OK);
+    quiver_free_string_array(labels, count);
+
+    quiver_memory_usage_t usage;
+    ASSERT_EQ(quiver_database_memory_usage(db, &usage), QUIVER_OK);
+    EXPECT_GT(usage.sqlite_schema, 0);
+    EXPECT_GT(usage.schema, 0);
+    EXPECT_GT(usage.read_cache, 0);
+    EXPECT_GE(usage.sqlite_heap, usage.page_cache);
+    EXPECT_EQ(usage.total,
+              usage.page_cache + usage.sqlite_schema + usage.statements + usage.schema + usage.read_cache +
+                  usage.label_cache);
+
+    int64_t released = 0;
+    ASSERT_EQ(quiver_database_shrink_memory(db, &released), QUIVER_OK);
+    EXPECT_GT(released, 0);
+    ASSERT_EQ(quiver_database_memory_usage(db, &usage), QUIVER_OK);
+    EXPECT_EQ(usage.read_cache, 0);
+    EXPECT_EQ(quiver_database_shrink_memory(db, nullptr), QUIVER_OK);
+
+    EXPECT_EQ(quiver_database_memory_usage(nullptr, &usage), QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_memory_usage(db, nullptr), QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_shrink_memory(nullptr, &released), QUIVER_ERROR_INVALID_ARGUMENT);
+    quiver_database_close(db);
+}
+
+// ============================================================================
+// Cursor tests
+// ============================================================================
+
+TEST(DatabaseCApiQuery, CursorStreamsRows) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    for (int i = 0; i < 3; ++i) {
+        auto e = quiver_element_create();
+        quiver_element_set_string(e, "label", ("Config " + std::to_string(i)).c_str());
+        quiver_element_set_integer(e, "integer_attribute", i * 10);
+        quiver_database_create_element(db, "Configuration", e);
+        quiver_element_destroy(e);
+    }
+
+    int64_t min_value = 10;
+    int param_types[] = {QUIVER_DATA_TYPE_INTEGER};
+    const void* param_values[] = {&min_value};
+    quiver_cursor_t* cursor = nullptr;
+    auto err = quiver_database_open_cursor(db,
+                                           "SELECT label, integer_attribute FROM Configuration "
+                                           "WHERE integer_attribute >= ? ORDER BY id",
+                                           param_types,
+                                           param_values,
+                                           1,
+                                           &cursor);
+    ASSERT_EQ(err, QUIVER_OK);
+    ASSERT_NE(cursor, nullptr);
+
+    size_t column_count = 0;
+    EXPECT_EQ(quiver_cursor_column_count(cursor, &column_count), QUIVER_OK);
+    EXPECT_EQ(column_count, 2);
+
+    const char* name = nullptr;
+    EXPECT_EQ(quiver_cursor_column_name(cursor, 1, &name), QUIVER_OK);
+    EXPECT_STREQ(name, "integer_attribute");
+
+    int has_row = 0;
+    int rows = 0;
+    while (quiver_cursor_next(cursor, &has_row) == QUIVER_OK && has_row) {
+        char* label = nullptr;
+        int has_value = 0;
+        EXPECT_EQ(quiver_cursor_get_string(cursor, 0, &label, &has_value), QUIVER_OK);
+        EXPECT_EQ(has_value, 1);
+        EXPECT_EQ(std::string(label), "Config " + std::to_string(rows + 1));
+        quiver_string_free(label);
+
+        quiver_data_type_t type;
+        EXPECT_EQ(quiver_cursor_column_type(cursor, 1, &type), QUIVER_OK);
+        EXPECT_EQ(type, QUIVER_DATA_TYPE_INTEGER);
+
+        int64_t value = 0;
+        EXPECT_EQ(quiver_cursor_get_integer(cursor, 1, &value, &has_value), QUIVER_OK);
+        EXPECT_EQ(has_value, 1);
+        EXPECT_EQ(value, (rows + 1) * 10);
+        ++rows;
+    }
+    EXPECT_EQ(rows, 2);
+
+    quiver_cursor_free(cursor);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApiQuery, CursorNullFloat) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto e = quiver_element_create();
+    quiver_element_set_string(e, "label", "Test");
+    quiver_database_create_element(db, "Configuration", e);
+    quiver_element_destroy(e);
+
+    quiver_cursor_t* cursor = nullptr;
+    ASSERT_EQ(
+        quiver_database_open_cursor(db, "SELECT float_attribute FROM Configuration", nullptr, nullptr, 0, &cursor),
+        QUIVER_OK);
+
+    int has_row = 0;
+    ASSERT_EQ(quiver_cursor_next(cursor, &has_row), QUIVER_OK);
+    ASSERT_EQ(has_row, 1);
+
+    double value = 0.0;
+    int has_value = 1;
+    EXPECT_EQ(quiver_cursor_get_float(cursor, 0, &value, &has_value), QUIVER_OK);
+    EXPECT_EQ(has_value, 0);
+
+    quiver_data_type_t type;
+    EXPECT_EQ(quiver_cursor_column_type(cursor, 0, &type), QUIVER_OK);
+    EXPECT_EQ(type, QUIVER_DATA_TYPE_NULL);
+
+    quiver_cursor_free(cursor);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApiQuery, CursorBlob) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    quiver_cursor_t* cursor = nullptr;
+    ASSERT_EQ(quiver_database_open_cursor(db, "SELECT x'01ff02', x''", nullptr, nullptr, 0, &cursor), QUIVER_OK);
+    int has_row = 0;
+    ASSERT_EQ(quiver_cursor_next(cursor, &has_row), QUIVER_OK);
+    ASSERT_EQ(has_row, 1);
+
+    quiver_data_type_t type;
+    EXPECT_EQ(quiver_cursor_column_type(cursor, 0, &type), QUIVER_OK);
+    EXPECT_EQ(type, QUIVER_DATA_TYPE_BLOB);
+
+    uint8_t* data = nullptr;
+    size_t size = 0;
+    int has_value = 0;
+    EXPECT_EQ(quiver_cursor_get_blob(cursor, 0, &data, &size, &has_value), QUIVER_OK);
+    EXPECT_EQ(has_value, 1);
+    ASSERT_EQ(size, 3);
+    EXPECT_EQ(data[0], 0x01);
+    EXPECT_EQ(data[1], 0xff);
+    EXPECT_EQ(data[2], 0x02);
+    quiver_blob_free(data);
+
+    EXPECT_EQ(quiver_cursor_get_blob(cursor, 1, &data, &size, &has_value), QUIVER_OK);
+    EXPECT_EQ(has_value, 1);
+    EXPECT_EQ(size, 0);
+    EXPECT_EQ(data, nullptr);
+
+    int64_t value = 0;
+    EXPECT_EQ(quiver_cursor_get_integer(cursor, 0, &value, &has_value), QUIVER_OK);
+    EXPECT_EQ(has_value, 0);
+
+    quiver_cursor_free(cursor);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApiQuery, CursorErrors) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    quiver_cursor_t* cursor = nullptr;
+    EXPECT_EQ(quiver_database_open_cursor(nullptr, "SELECT 1", nullptr, nullptr, 0, &cursor),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_open_cursor(db, "SELECT * FROM Missing", nullptr, nullptr, 0, &cursor),
+              QUIVER_ERROR_DATABASE);
+    EXPECT_EQ(cursor, nullptr);
+
+    ASSERT_EQ(quiver_database_open_cursor(db, "SELECT 1", nullptr, nullptr, 0, &cursor), QUIVER_OK);
+    int64_t value = 0;
+    int has_value = 0;
+    EXPECT_EQ(quiver_cursor_get_integer(cursor, 0, &value, &has_value), QUIVER_ERROR_DATABASE);
+    const char* name = nullptr;
+    EXPECT_EQ(quiver_cursor_column_name(cursor, 5, &name), QUIVER_ERROR_INVALID_ARGUMENT);
+
+    quiver_cursor_free(cursor);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApiQuery, CollectionCursors) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto config = quiver_element_create();
+    quiver_element_set_string(config, "label", "Config");
+    quiver_database_create_element(db, "Configuration", config);
+    quiver_element_destroy(config);
+
+    int64_t vector[] = {4, 5};
+    auto e = quiver_element_create();
+    quiver_element_set_string(e, "label", "Item 1");
+    quiver_element_set_integer(e, "some_integer", 9);
+    quiver_element_set_array_integer(e, "value_int", vector, 2);
+    quiver_database_create_element(db, "Collection", e);
+    quiver_element_destroy(e);
+
+    const char* attributes[] = {"some_integer"};
+    quiver_cursor_t* cursor = nullptr;
+    ASSERT_EQ(quiver_database_open_scalars_cursor(db, "Collection", attributes, 1, &cursor), QUIVER_OK);
+    int has_row = 0;
+    int64_t value = 0;
+    int has_value = 0;
+    ASSERT_EQ(quiver_cursor_next(cursor, &has_row), QUIVER_OK);
+    ASSERT_EQ(has_row, 1);
+    EXPECT_EQ(quiver_cursor_get_integer(cursor, 1, &value, &has_value), QUIVER_OK);
+    EXPECT_EQ(value, 9);
+    quiver_cursor_free(cursor);
+
+    ASSERT_EQ(quiver_database_open_vector_cursor(db, "Collection", "value_int", &cursor), QUIVER_OK);
+    int64_t total = 0;
+    while (quiver_cursor_next(cursor, &has_row) == QUIVER_OK && has_row) {
+        EXPECT_EQ(quiver_cursor_get_integer(cursor, 2, &value, &has_value), QUIVER_OK);
+        total += value;
+    }
+    EXPECT_EQ(total, 9);
+    quiver_cursor_free(cursor);
+
+    EXPECT_EQ(quiver_database_open_scalars_cursor(db, "Collection", nullptr, 1, &cursor),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_open_vector_cursor(db, "Missing", "value_int", &cursor), QUIVER_ERROR_DATABASE);
+    EXPECT_EQ(cursor, nullptr);
+
+    quiver_database_close(db);
+}
+
+// ============================================================================
+// Timeout and interruption tests
+// ============================================================================
+
+TEST(DatabaseCApiQuery, StatementTimeoutAndProgressHandler) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    options.statement_timeout_ms = 50;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    const char* endless =
+        "WITH RECURSIVE counter(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM counter) SELECT count(*) FROM counter";
+    int64_t value = 0;
+    int has_value = 0;
+    EXPECT_EQ(quiver_database_query_integer(db, endless, &value, &has_value), QUIVER_ERROR_DATABASE);
+    EXPECT_NE(std::string(quiver_get_last_error()).find("interrupted"), std::string::npos);
+
+    ASSERT_EQ(quiver_database_set_statement_timeout(db, 0), QUIVER_OK);
+    int calls = 0;
+    auto abort_third_call = [](void* user_data) -> int { return ++*static_cast<int*>(user_data) >= 3 ? 1 : 0; };
+    ASSERT_EQ(quiver_database_set_progress_handler(db, abort_third_call, &calls), QUIVER_OK);
+    EXPECT_EQ(quiver_database_query_integer(db, endless, &value, &has_value), QUIVER_ERROR_DATABASE);
+    EXPECT_EQ(calls, 3);
+
+    ASSERT_EQ(quiver_database_set_progress_handler(db, nullptr, nullptr), QUIVER_OK);
+    ASSERT_EQ(quiver_database_query_integer(db, "SELECT 7", &value, &has_value), QUIVER_OK);
+    EXPECT_EQ(value, 7);
+
+    EXPECT_EQ(quiver_database_set_busy_timeout(db, 100), QUIVER_OK);
+    EXPECT_EQ(quiver_database_interrupt(db), QUIVER_OK);
+    EXPECT_EQ(quiver_database_interrupt(nullptr), QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_set_statement_timeout(nullptr, 10), QUIVER_ERROR_INVALID_ARGUMENT);
+
+    quiver_database_close(db);
+}
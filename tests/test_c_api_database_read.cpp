@@ -2,8 +2,11 @@
 
 #include <algorithm>
 #include <gtest/gtest.h>
+#include <quiver/c/attribute_handle.h>
 #include <quiver/c/database.h>
 #include <quiver/c/element.h>
+#include <quiver/c/filter.h>
+#include <quiver/c/result.h>
 #include <string>
 #include <vector>
 
@@ -42,6 +45,126 @@ TEST(DatabaseCApi, ReadScalarIntegers) {
     quiver_database_close(db);
 }
 
+TEST(DatabaseCApi, ReadScalarIntegersIntoBuffer) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    for (int64_t value : {42, 100, 7}) {
+        auto e = quiver_element_create();
+        quiver_element_set_string(e, "label", ("Config " + std::to_string(value)).c_str());
+        quiver_element_set_integer(e, "integer_attribute", value);
+        quiver_database_create_element(db, "Configuration", e);
+        quiver_element_destroy(e);
+    }
+
+    size_t total = 0;
+    EXPECT_EQ(quiver_database_count_scalar_values(db, "Configuration", "integer_attribute", &total), QUIVER_OK);
+    ASSERT_EQ(total, 3);
+
+    std::vector<int64_t> buffer(total);
+    size_t count = 0;
+    auto err = quiver_database_read_scalar_integers_into(
+        db, "Configuration", "integer_attribute", buffer.data(), buffer.size(), &count);
+    EXPECT_EQ(err, QUIVER_OK);
+    EXPECT_EQ(count, 3);
+    EXPECT_EQ(buffer, (std::vector<int64_t>{42, 100, 7}));
+
+    // Truncated read still reports the total
+    int64_t first = 0;
+    err = quiver_database_read_scalar_integers_into(db, "Configuration", "integer_attribute", &first, 1, &count);
+    EXPECT_EQ(err, QUIVER_OK);
+    EXPECT_EQ(count, 3);
+    EXPECT_EQ(first, 42);
+
+    // Size-only query with no buffer
+    err = quiver_database_read_scalar_integers_into(db, "Configuration", "integer_attribute", nullptr, 0, &count);
+    EXPECT_EQ(err, QUIVER_OK);
+    EXPECT_EQ(count, 3);
+
+    EXPECT_EQ(quiver_database_read_scalar_integers_into(db, "Configuration", "integer_attribute", nullptr, 2, &count),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, ReadScalarFloatsIntoBuffer) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto e = quiver_element_create();
+    quiver_element_set_string(e, "label", "Config 1");
+    quiver_element_set_float(e, "float_attribute", 2.5);
+    quiver_database_create_element(db, "Configuration", e);
+    quiver_element_destroy(e);
+
+    double value = 0.0;
+    size_t count = 0;
+    EXPECT_EQ(quiver_database_read_scalar_floats_into(db, "Configuration", "float_attribute", &value, 1, &count),
+              QUIVER_OK);
+    EXPECT_EQ(count, 1);
+    EXPECT_DOUBLE_EQ(value, 2.5);
+
+    EXPECT_EQ(quiver_database_read_scalar_floats_into(db, "Missing", "float_attribute", &value, 1, &count),
+              QUIVER_ERROR_DATABASE);
+
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, ReadScalarResultHandles) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto e1 = quiver_element_create();
+    quiver_element_set_string(e1, "label", "Config 1");
+    quiver_element_set_integer(e1, "integer_attribute", 42);
+    quiver_database_create_element(db, "Configuration", e1);
+    quiver_element_destroy(e1);
+
+    auto e2 = quiver_element_create();
+    quiver_element_set_string(e2, "label", "Config 2");
+    quiver_element_set_integer(e2, "integer_attribute", 100);
+    quiver_database_create_element(db, "Configuration", e2);
+    quiver_element_destroy(e2);
+
+    quiver_result_t* integers = nullptr;
+    ASSERT_EQ(quiver_database_read_scalar_integers_result(db, "Configuration", "integer_attribute", &integers),
+              QUIVER_OK);
+    quiver_result_t* labels = nullptr;
+    ASSERT_EQ(quiver_database_read_scalar_strings_result(db, "Configuration", "label", &labels), QUIVER_OK);
+
+    // Results outlive the database
+    quiver_database_close(db);
+
+    size_t count = 0;
+    EXPECT_EQ(quiver_result_count(integers, &count), QUIVER_OK);
+    EXPECT_EQ(count, 2);
+    quiver_data_type_t type;
+    EXPECT_EQ(quiver_result_type(integers, &type), QUIVER_OK);
+    EXPECT_EQ(type, QUIVER_DATA_TYPE_INTEGER);
+
+    const int64_t* values = nullptr;
+    EXPECT_EQ(quiver_result_integers(integers, &values), QUIVER_OK);
+    EXPECT_EQ(values[0], 42);
+    EXPECT_EQ(values[1], 100);
+
+    const double* wrong = nullptr;
+    EXPECT_EQ(quiver_result_floats(integers, &wrong), QUIVER_ERROR_INVALID_ARGUMENT);
+
+    const char* const* names = nullptr;
+    EXPECT_EQ(quiver_result_strings(labels, &names), QUIVER_OK);
+    EXPECT_STREQ(names[0], "Config 1");
+    EXPECT_STREQ(names[1], "Config 2");
+
+    quiver_result_free(integers);
+    quiver_result_free(labels);
+}
+
 TEST(DatabaseCApi, ReadScalarFloats) {
     auto options = quiver_database_options_default();
     options.console_level = QUIVER_LOG_OFF;
@@ -132,6 +255,177 @@ TEST(DatabaseCApi, ReadScalarEmpty) {
     quiver_database_close(db);
 }
 
+TEST(DatabaseCApi, ReadScalarNullable) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto e1 = quiver_element_create();
+    quiver_element_set_string(e1, "label", "Config 1");
+    quiver_database_create_element(db, "Configuration", e1);
+    quiver_element_destroy(e1);
+
+    auto e2 = quiver_element_create();
+    quiver_element_set_string(e2, "label", "Config 2");
+    quiver_element_set_float(e2, "float_attribute", 4.5);
+    quiver_element_set_string(e2, "string_attribute", "hello");
+    quiver_database_create_element(db, "Configuration", e2);
+    quiver_element_destroy(e2);
+
+    double* floats = nullptr;
+    uint8_t* validity = nullptr;
+    size_t count = 0;
+    auto err =
+        quiver_database_read_scalar_floats_nullable(db, "Configuration", "float_attribute", &floats, &validity, &count);
+    EXPECT_EQ(err, QUIVER_OK);
+    ASSERT_EQ(count, 2);
+    EXPECT_EQ(validity[0], 0b10);
+    EXPECT_DOUBLE_EQ(floats[1], 4.5);
+    quiver_free_float_array(floats);
+    quiver_free_validity_bitmap(validity);
+
+    char** strings = nullptr;
+    err = quiver_database_read_scalar_strings_nullable(
+        db, "Configuration", "string_attribute", &strings, &validity, &count);
+    EXPECT_EQ(err, QUIVER_OK);
+    ASSERT_EQ(count, 2);
+    EXPECT_EQ(strings[0], nullptr);
+    EXPECT_STREQ(strings[1], "hello");
+    EXPECT_EQ(validity[0], 0b10);
+    quiver_free_string_array(strings, count);
+    quiver_free_validity_bitmap(validity);
+
+    int64_t* integers = nullptr;
+    err = quiver_database_read_scalar_integers_nullable(
+        db, "Configuration", "integer_attribute", &integers, &validity, &count);
+    EXPECT_EQ(err, QUIVER_OK);
+    EXPECT_EQ(validity[0], 0b11);
+    EXPECT_EQ(integers[0], 6);
+    quiver_free_integer_array(integers);
+    quiver_free_validity_bitmap(validity);
+
+    err = quiver_database_read_scalar_integers_nullable(
+        db, "Configuration", "integer_attribute", &integers, nullptr, &count);
+    EXPECT_EQ(err, QUIVER_ERROR_INVALID_ARGUMENT);
+
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, ReadByIds) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto config = quiver_element_create();
+    quiver_element_set_string(config, "label", "Test Config");
+    quiver_database_create_element(db, "Configuration", config);
+    quiver_element_destroy(config);
+
+    auto e1 = quiver_element_create();
+    quiver_element_set_string(e1, "label", "Item 1");
+    quiver_element_set_integer(e1, "some_integer", 7);
+    int64_t values1[] = {1, 2, 3};
+    quiver_element_set_array_integer(e1, "value_int", values1, 3);
+    auto id1 = quiver_database_create_element(db, "Collection", e1);
+    quiver_element_destroy(e1);
+
+    auto e2 = quiver_element_create();
+    quiver_element_set_string(e2, "label", "Item 2");
+    auto id2 = quiver_database_create_element(db, "Collection", e2);
+    quiver_element_destroy(e2);
+
+    int64_t ids[] = {id2, 999, id1};
+    int64_t* integers = nullptr;
+    uint8_t* validity = nullptr;
+    auto err =
+        quiver_database_read_scalar_integers_by_ids(db, "Collection", "some_integer", ids, 3, &integers, &validity);
+    EXPECT_EQ(err, QUIVER_OK);
+    EXPECT_EQ(validity[0], 0b100);
+    EXPECT_EQ(integers[2], 7);
+    quiver_free_integer_array(integers);
+    quiver_free_validity_bitmap(validity);
+
+    char** labels = nullptr;
+    err = quiver_database_read_scalar_strings_by_ids(db, "Collection", "label", ids, 3, &labels, &validity);
+    EXPECT_EQ(err, QUIVER_OK);
+    EXPECT_STREQ(labels[0], "Item 2");
+    EXPECT_EQ(labels[1], nullptr);
+    EXPECT_STREQ(labels[2], "Item 1");
+    quiver_free_string_array(labels, 3);
+    quiver_free_validity_bitmap(validity);
+
+    int64_t* values = nullptr;
+    size_t* offsets = nullptr;
+    err = quiver_database_read_vector_integers_by_ids(db, "Collection", "value_int", ids, 3, &values, &offsets);
+    EXPECT_EQ(err, QUIVER_OK);
+    EXPECT_EQ(offsets[0], 0);
+    EXPECT_EQ(offsets[1], 0);
+    EXPECT_EQ(offsets[2], 0);
+    EXPECT_EQ(offsets[3], 3);
+    EXPECT_EQ(values[0], 1);
+    EXPECT_EQ(values[2], 3);
+    quiver_free_integer_flat(values, offsets);
+
+    err = quiver_database_read_vector_integers_by_ids(db, "Collection", "value_int", nullptr, 3, &values, &offsets);
+    EXPECT_EQ(err, QUIVER_ERROR_INVALID_ARGUMENT);
+
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, ReadScalarsColumns) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto e1 = quiver_element_create();
+    quiver_element_set_string(e1, "label", "Config 1");
+    quiver_element_set_float(e1, "float_attribute", 2.5);
+    quiver_database_create_element(db, "Configuration", e1);
+    quiver_element_destroy(e1);
+
+    auto e2 = quiver_element_create();
+    quiver_element_set_string(e2, "label", "Config 2");
+    quiver_element_set_integer(e2, "integer_attribute", 9);
+    quiver_database_create_element(db, "Configuration", e2);
+    quiver_element_destroy(e2);
+
+    const char* attributes[] = {"label", "integer_attribute", "float_attribute"};
+    int64_t* ids = nullptr;
+    quiver_scalar_column_t* columns = nullptr;
+    size_t count = 0;
+    auto err = quiver_database_read_scalars(db, "Configuration", attributes, 3, &ids, &columns, &count);
+    ASSERT_EQ(err, QUIVER_OK);
+    ASSERT_EQ(count, 2);
+    EXPECT_EQ(ids[0], 1);
+    EXPECT_EQ(ids[1], 2);
+
+    EXPECT_STREQ(columns[0].name, "label");
+    EXPECT_EQ(columns[0].data_type, QUIVER_DATA_TYPE_STRING);
+    EXPECT_STREQ(columns[0].strings[1], "Config 2");
+    EXPECT_EQ(columns[0].integers, nullptr);
+
+    EXPECT_EQ(columns[1].data_type, QUIVER_DATA_TYPE_INTEGER);
+    EXPECT_EQ(columns[1].integers[0], 6);
+    EXPECT_EQ(columns[1].integers[1], 9);
+
+    EXPECT_EQ(columns[2].data_type, QUIVER_DATA_TYPE_FLOAT);
+    EXPECT_DOUBLE_EQ(columns[2].floats[0], 2.5);
+    EXPECT_EQ(columns[2].nulls[0], 0);
+    EXPECT_EQ(columns[2].nulls[1], 1);
+    quiver_free_scalar_columns(ids, columns, 3, count);
+
+    const char* missing[] = {"missing"};
+    err = quiver_database_read_scalars(db, "Configuration", missing, 1, &ids, &columns, &count);
+    EXPECT_EQ(err, QUIVER_ERROR_DATABASE);
+    err = quiver_database_read_scalars(db, "Configuration", nullptr, 1, &ids, &columns, &count);
+    EXPECT_EQ(err, QUIVER_ERROR_INVALID_ARGUMENT);
+
+    quiver_database_close(db);
+}
+
 // ============================================================================
 // Read vector tests
 // ============================================================================
@@ -180,6 +474,427 @@ TEST(DatabaseCApi, ReadVectorIntegers) {
     quiver_database_close(db);
 }
 
+TEST(DatabaseCApi, ReadVectorIntegersFlat) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto config = quiver_element_create();
+    quiver_element_set_string(config, "label", "Test Config");
+    quiver_database_create_element(db, "Configuration", config);
+    quiver_element_destroy(config);
+
+    auto e1 = quiver_element_create();
+    quiver_element_set_string(e1, "label", "Item 1");
+    int64_t values1[] = {1, 2, 3};
+    quiver_element_set_array_integer(e1, "value_int", values1, 3);
+    quiver_database_create_element(db, "Collection", e1);
+    quiver_element_destroy(e1);
+
+    auto e2 = quiver_element_create();
+    quiver_element_set_string(e2, "label", "Item 2");
+    int64_t values2[] = {10, 20};
+    quiver_element_set_array_integer(e2, "value_int", values2, 2);
+    quiver_database_create_element(db, "Collection", e2);
+    quiver_element_destroy(e2);
+
+    int64_t* values = nullptr;
+    size_t* offsets = nullptr;
+    size_t count = 0;
+    auto err = quiver_database_read_vector_integers_flat(db, "Collection", "value_int", &values, &offsets, &count);
+
+    EXPECT_EQ(err, QUIVER_OK);
+    ASSERT_EQ(count, 2);
+    EXPECT_EQ(offsets[0], 0);
+    EXPECT_EQ(offsets[1], 3);
+    EXPECT_EQ(offsets[2], 5);
+    EXPECT_EQ(values[0], 1);
+    EXPECT_EQ(values[2], 3);
+    EXPECT_EQ(values[3], 10);
+    EXPECT_EQ(values[4], 20);
+
+    quiver_free_integer_flat(values, offsets);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, ReadElement) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto config = quiver_element_create();
+    quiver_element_set_string(config, "label", "Test Config");
+    quiver_database_create_element(db, "Configuration", config);
+    quiver_element_destroy(config);
+
+    auto e = quiver_element_create();
+    quiver_element_set_string(e, "label", "Item 1");
+    quiver_element_set_integer(e, "some_integer", 42);
+    double values[] = {1.5, 2.5};
+    quiver_element_set_array_float(e, "value_float", values, 2);
+    const char* tags[] = {"x"};
+    quiver_element_set_array_string(e, "tag", tags, 1);
+    const auto id = quiver_database_create_element(db, "Collection", e);
+    quiver_element_destroy(e);
+
+    quiver_element_t* element = nullptr;
+    ASSERT_EQ(quiver_database_read_element(db, "Collection", id, &element), QUIVER_OK);
+    ASSERT_NE(element, nullptr);
+
+    const char* label = nullptr;
+    int has_value = 0;
+    ASSERT_EQ(quiver_element_get_string(element, "label", &label, &has_value), QUIVER_OK);
+    EXPECT_EQ(has_value, 1);
+    EXPECT_STREQ(label, "Item 1");
+    int64_t integer = 0;
+    ASSERT_EQ(quiver_element_get_integer(element, "some_integer", &integer, &has_value), QUIVER_OK);
+    EXPECT_EQ(integer, 42);
+    double number = 0;
+    ASSERT_EQ(quiver_element_get_float(element, "some_float", &number, &has_value), QUIVER_OK);
+    EXPECT_EQ(has_value, 0);
+    EXPECT_EQ(quiver_element_get_float(element, "some_integer", &number, &has_value), QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_element_get_float(element, "missing", &number, &has_value), QUIVER_ERROR_NOT_FOUND);
+
+    const double* floats = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(quiver_element_get_array_float(element, "value_float", &floats, &count), QUIVER_OK);
+    ASSERT_EQ(count, 2);
+    EXPECT_DOUBLE_EQ(floats[1], 2.5);
+    char** strings = nullptr;
+    ASSERT_EQ(quiver_element_get_array_string(element, "tag", &strings, &count), QUIVER_OK);
+    ASSERT_EQ(count, 1);
+    EXPECT_STREQ(strings[0], "x");
+    quiver_free_string_array(strings, count);
+    EXPECT_EQ(quiver_element_get_array_integer(element, "value_int", nullptr, &count), QUIVER_ERROR_INVALID_ARGUMENT);
+
+    EXPECT_STREQ(quiver_element_array_name(element, 0), "tag");
+    EXPECT_EQ(quiver_element_array_name(element, 2), nullptr);
+    EXPECT_EQ(quiver_element_scalar_count(element), 3);
+    quiver_element_destroy(element);
+
+    EXPECT_EQ(quiver_database_read_element(db, "Collection", 999, &element), QUIVER_ERROR_DATABASE);
+    EXPECT_EQ(element, nullptr);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, ReadFlatAligned) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto config = quiver_element_create();
+    quiver_element_set_string(config, "label", "Test Config");
+    quiver_database_create_element(db, "Configuration", config);
+    quiver_element_destroy(config);
+
+    // No vector data for the first element
+    auto e1 = quiver_element_create();
+    quiver_element_set_string(e1, "label", "Item 1");
+    quiver_database_create_element(db, "Collection", e1);
+    quiver_element_destroy(e1);
+
+    auto e2 = quiver_element_create();
+    quiver_element_set_string(e2, "label", "Item 2");
+    double values2[] = {1.5, 2.5};
+    quiver_element_set_array_float(e2, "value_float", values2, 2);
+    quiver_database_create_element(db, "Collection", e2);
+    quiver_element_destroy(e2);
+
+    double* values = nullptr;
+    size_t* offsets = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(
+        quiver_database_read_vector_floats_flat_aligned(db, "Collection", "value_float", &values, &offsets, &count),
+        QUIVER_OK);
+    ASSERT_EQ(count, 2);
+    EXPECT_EQ(offsets[0], 0);
+    EXPECT_EQ(offsets[1], 0);
+    EXPECT_EQ(offsets[2], 2);
+    EXPECT_DOUBLE_EQ(values[1], 2.5);
+    quiver_free_float_flat(values, offsets);
+
+    char** tags = nullptr;
+    ASSERT_EQ(quiver_database_read_set_strings_flat_aligned(db, "Collection", "tag", &tags, &offsets, &count),
+              QUIVER_OK);
+    ASSERT_EQ(count, 2);
+    EXPECT_EQ(offsets[2], 0);
+    quiver_free_string_flat(tags, offsets, count);
+
+    EXPECT_EQ(quiver_database_read_set_strings_flat_aligned(db, "Collection", nullptr, &tags, &offsets, &count),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, Aggregate) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto config = quiver_element_create();
+    quiver_element_set_string(config, "label", "Test Config");
+    quiver_database_create_element(db, "Configuration", config);
+    quiver_element_destroy(config);
+
+    auto e = quiver_element_create();
+    quiver_element_set_string(e, "label", "Item 1");
+    double values[] = {1.0, 2.0, 6.0};
+    quiver_element_set_array_float(e, "value_float", values, 3);
+    const auto id = quiver_database_create_element(db, "Collection", e);
+    quiver_element_destroy(e);
+
+    const quiver_aggregate_t statistics[] = {QUIVER_AGGREGATE_MAX, QUIVER_AGGREGATE_MEAN};
+    int64_t* ids = nullptr;
+    double* out = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(quiver_database_aggregate_vector(db, "Collection", "value_float", statistics, 2, &ids, &out, &count),
+              QUIVER_OK);
+    ASSERT_EQ(count, 1);
+    EXPECT_EQ(ids[0], id);
+    EXPECT_DOUBLE_EQ(out[0], 6.0);
+    EXPECT_DOUBLE_EQ(out[1], 3.0);
+    quiver_free_integer_array(ids);
+    quiver_free_float_array(out);
+
+    const char* date_times[] = {"2024-01-01 00:00:00", "2024-01-02 00:00:00"};
+    double series[] = {4.0, 8.0};
+    ASSERT_EQ(quiver_database_update_time_series_floats(db, "Collection", "value", id, date_times, series, 2),
+              QUIVER_OK);
+    char** buckets = nullptr;
+    ASSERT_EQ(quiver_database_aggregate_time_series(
+                  db, "Collection", "value", QUIVER_TIME_BUCKET_DAY, statistics, 2, &ids, &buckets, &out, &count),
+              QUIVER_OK);
+    ASSERT_EQ(count, 2);
+    EXPECT_STREQ(buckets[1], "2024-01-02");
+    EXPECT_DOUBLE_EQ(out[1], 8.0);  // max of the second day
+    EXPECT_DOUBLE_EQ(out[2], 4.0);  // mean of the first day
+    quiver_free_integer_array(ids);
+    quiver_free_string_array(buckets, count);
+    quiver_free_float_array(out);
+
+    const auto unknown = static_cast<quiver_aggregate_t>(42);
+    EXPECT_EQ(quiver_database_aggregate_vector(db, "Collection", "value_float", &unknown, 1, &ids, &out, &count),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, ReadPackedVectorRange) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("packed.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto config = quiver_element_create();
+    quiver_element_set_string(config, "label", "Test Config");
+    quiver_database_create_element(db, "Configuration", config);
+    quiver_element_destroy(config);
+
+    auto e = quiver_element_create();
+    quiver_element_set_string(e, "label", "Item 1");
+    double values[] = {1.0, 2.0, 3.0, 4.0};
+    quiver_element_set_array_float(e, "load", values, 4);
+    const auto id = quiver_database_create_element(db, "Collection", e);
+    quiver_element_destroy(e);
+
+    double* out = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(quiver_database_read_vector_floats_range(db, "Collection", "load", id, 2, 5, &out, &count), QUIVER_OK);
+    ASSERT_EQ(count, 2);
+    EXPECT_DOUBLE_EQ(out[0], 3.0);
+    EXPECT_DOUBLE_EQ(out[1], 4.0);
+    quiver_free_float_array(out);
+
+    EXPECT_EQ(quiver_database_read_vector_floats_range(db, "Collection", "load", id, -1, 1, &out, &count),
+              QUIVER_ERROR_DATABASE);
+    EXPECT_EQ(quiver_database_read_vector_floats_range(db, "Collection", "load", id, 0, 1, nullptr, &count),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, ReadFiltered) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto config = quiver_element_create();
+    quiver_element_set_string(config, "label", "Test Config");
+    quiver_database_create_element(db, "Configuration", config);
+    quiver_element_destroy(config);
+
+    std::vector<int64_t> ids;
+    for (int64_t i = 1; i <= 3; ++i) {
+        auto e = quiver_element_create();
+        quiver_element_set_string(e, "label", ("Item " + std::to_string(i)).c_str());
+        quiver_element_set_integer(e, "some_integer", i);
+        int64_t values[] = {i, i * 10};
+        quiver_element_set_array_integer(e, "value_int", values, 2);
+        ids.push_back(quiver_database_create_element(db, "Collection", e));
+        quiver_element_destroy(e);
+    }
+
+    auto filter = quiver_filter_create();
+    ASSERT_NE(filter, nullptr);
+    ASSERT_EQ(quiver_filter_where_integer(filter, "some_integer", QUIVER_FILTER_GREATER_EQUAL, 2), QUIVER_OK);
+    ASSERT_EQ(quiver_filter_where_string(filter, "label", QUIVER_FILTER_NOT_EQUAL, "Item 3"), QUIVER_OK);
+
+    int64_t* out_ids = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(quiver_database_read_element_ids_filtered(db, "Collection", filter, &out_ids, &count), QUIVER_OK);
+    ASSERT_EQ(count, 1);
+    EXPECT_EQ(out_ids[0], ids[1]);
+    quiver_free_integer_array(out_ids);
+
+    int64_t* values = nullptr;
+    size_t* offsets = nullptr;
+    ASSERT_EQ(quiver_database_read_vector_integers_flat_filtered(
+                  db, "Collection", "value_int", filter, &values, &offsets, &count),
+              QUIVER_OK);
+    ASSERT_EQ(count, 1);
+    EXPECT_EQ(offsets[1], 2);
+    EXPECT_EQ(values[1], 20);
+    quiver_free_integer_flat(values, offsets);
+
+    char** labels = nullptr;
+    ASSERT_EQ(quiver_filter_id_in(filter, ids.data(), 0), QUIVER_OK);
+    ASSERT_EQ(quiver_database_read_scalar_strings_filtered(db, "Collection", "label", filter, &labels, &count),
+              QUIVER_OK);
+    EXPECT_EQ(count, 0);
+    quiver_free_string_array(labels, count);
+
+    // Unknown attributes fail at read time; bad operators at build time
+    ASSERT_EQ(quiver_filter_where_null(filter, "missing", QUIVER_FILTER_IS_NULL), QUIVER_OK);
+    EXPECT_EQ(quiver_database_read_element_ids_filtered(db, "Collection", filter, &out_ids, &count),
+              QUIVER_ERROR_DATABASE);
+    EXPECT_EQ(quiver_filter_where_null(filter, "label", QUIVER_FILTER_EQUAL), QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_read_element_ids_filtered(db, "Collection", nullptr, &out_ids, &count),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+
+    quiver_filter_destroy(filter);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, ReadVectorFlatEmpty) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    double* values = nullptr;
+    size_t* offsets = nullptr;
+    size_t count = 99;
+    auto err = quiver_database_read_vector_floats_flat(db, "Collection", "value_float", &values, &offsets, &count);
+
+    EXPECT_EQ(err, QUIVER_OK);
+    EXPECT_EQ(count, 0);
+    EXPECT_EQ(values, nullptr);
+    ASSERT_NE(offsets, nullptr);
+    EXPECT_EQ(offsets[0], 0);
+
+    quiver_free_float_flat(values, offsets);
+
+    EXPECT_EQ(quiver_database_read_vector_floats_flat(db, "Collection", nullptr, &values, &offsets, &count),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, ReadSetStringsFlat) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto config = quiver_element_create();
+    quiver_element_set_string(config, "label", "Test Config");
+    quiver_database_create_element(db, "Configuration", config);
+    quiver_element_destroy(config);
+
+    auto e1 = quiver_element_create();
+    quiver_element_set_string(e1, "label", "Item 1");
+    const char* tags1[] = {"review"};
+    quiver_element_set_array_string(e1, "tag", tags1, 1);
+    quiver_database_create_element(db, "Collection", e1);
+    quiver_element_destroy(e1);
+
+    auto e2 = quiver_element_create();
+    quiver_element_set_string(e2, "label", "Item 2");
+    const char* tags2[] = {"a", "b"};
+    quiver_element_set_array_string(e2, "tag", tags2, 2);
+    quiver_database_create_element(db, "Collection", e2);
+    quiver_element_destroy(e2);
+
+    char** values = nullptr;
+    size_t* offsets = nullptr;
+    size_t count = 0;
+    auto err = quiver_database_read_set_strings_flat(db, "Collection", "tag", &values, &offsets, &count);
+
+    EXPECT_EQ(err, QUIVER_OK);
+    ASSERT_EQ(count, 2);
+    EXPECT_EQ(offsets[1], 1);
+    EXPECT_EQ(offsets[2], 3);
+    EXPECT_STREQ(values[0], "review");
+
+    quiver_free_string_flat(values, offsets, count);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, ReadStringArenas) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto config = quiver_element_create();
+    quiver_element_set_string(config, "label", "Test Config");
+    quiver_database_create_element(db, "Configuration", config);
+    quiver_element_destroy(config);
+
+    for (const auto* label : {"Item 1", "Item 2"}) {
+        auto e = quiver_element_create();
+        quiver_element_set_string(e, "label", label);
+        const char* tags[] = {"common", label};
+        quiver_element_set_array_string(e, "tag", tags, 2);
+        quiver_database_create_element(db, "Collection", e);
+        quiver_element_destroy(e);
+    }
+
+    char** labels = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(quiver_database_read_scalar_strings_arena(db, "Collection", "label", 0, &labels, &count), QUIVER_OK);
+    ASSERT_EQ(count, 2);
+    EXPECT_STREQ(labels[0], "Item 1");
+    EXPECT_STREQ(labels[1], "Item 2");
+    quiver_free_string_arena(labels);
+
+    char** tags = nullptr;
+    size_t* offsets = nullptr;
+    ASSERT_EQ(quiver_database_read_set_strings_arena(db, "Collection", "tag", 1, &tags, &offsets, &count), QUIVER_OK);
+    ASSERT_EQ(count, 2);
+    EXPECT_EQ(offsets[2], 4);
+    std::vector<const char*> common;
+    for (size_t i = 0; i < offsets[2]; ++i) {
+        if (std::string(tags[i]) == "common") {
+            common.push_back(tags[i]);
+        }
+    }
+    ASSERT_EQ(common.size(), 2);
+    EXPECT_EQ(common[0], common[1]);
+    quiver_free_string_arena_flat(tags, offsets);
+
+    // A null result (no values) may be freed too
+    ASSERT_EQ(quiver_database_read_scalar_strings_arena(db, "Configuration", "label", 0, &labels, &count), QUIVER_OK);
+    EXPECT_EQ(count, 1);
+    quiver_free_string_arena(labels);
+    quiver_free_string_arena(nullptr);
+    EXPECT_EQ(quiver_database_read_scalar_strings_arena(db, "Collection", "label", 0, nullptr, &count),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+
+    quiver_database_close(db);
+}
+
 TEST(DatabaseCApi, ReadVectorFloats) {
     auto options = quiver_database_options_default();
     options.console_level = QUIVER_LOG_OFF;
@@ -1440,3 +2155,69 @@ TEST(DatabaseCApi, DateTimeReadScalarString) {
     delete[] value;
     quiver_database_close(db);
 }
+
+// ============================================================================
+// Attribute handle tests
+// ============================================================================
+
+TEST(DatabaseCApi, ReadAndUpdateByAttributeHandle) {
+    auto options = quiver::test::quiet_options();
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto element = quiver_element_create();
+    quiver_element_set_string(element, "label", "Item 1");
+    quiver_element_set_integer(element, "some_integer", 7);
+    int64_t values[] = {1, 2, 3};
+    quiver_element_set_array_integer(element, "value_int", values, 3);
+    auto id = quiver_database_create_element(db, "Collection", element);
+    quiver_element_destroy(element);
+
+    quiver_attribute_handle_t* integer = nullptr;
+    ASSERT_EQ(quiver_database_attribute_handle(db, "Collection", "some_integer", &integer), QUIVER_OK);
+    quiver_data_structure_t structure;
+    quiver_data_type_t type;
+    ASSERT_EQ(quiver_attribute_handle_info(integer, &structure, &type), QUIVER_OK);
+    EXPECT_EQ(structure, QUIVER_DATA_STRUCTURE_SCALAR);
+    EXPECT_EQ(type, QUIVER_DATA_TYPE_INTEGER);
+
+    ASSERT_EQ(quiver_database_update_scalar_integer_by_handle(db, integer, id, 42), QUIVER_OK);
+    int64_t value = 0;
+    int has_value = 0;
+    ASSERT_EQ(quiver_database_read_scalar_integer_by_handle(db, integer, id, &value, &has_value), QUIVER_OK);
+    EXPECT_EQ(has_value, 1);
+    EXPECT_EQ(value, 42);
+    ASSERT_EQ(quiver_database_read_scalar_integer_by_handle(db, integer, id + 1, &value, &has_value), QUIVER_OK);
+    EXPECT_EQ(has_value, 0);
+
+    // Wrong type for the handle
+    double real = 0;
+    EXPECT_EQ(quiver_database_read_scalar_float_by_handle(db, integer, id, &real, &has_value), QUIVER_ERROR_DATABASE);
+    quiver_attribute_handle_free(integer);
+
+    quiver_attribute_handle_t* label = nullptr;
+    ASSERT_EQ(quiver_database_attribute_handle(db, "Collection", "label", &label), QUIVER_OK);
+    char* text = nullptr;
+    ASSERT_EQ(quiver_database_read_scalar_string_by_handle(db, label, id, &text, &has_value), QUIVER_OK);
+    EXPECT_STREQ(text, "Item 1");
+    quiver_string_free(text);
+    quiver_attribute_handle_free(label);
+
+    quiver_attribute_handle_t* vector = nullptr;
+    ASSERT_EQ(quiver_database_attribute_handle(db, "Collection", "value_int", &vector), QUIVER_OK);
+    int64_t buffer[2] = {};
+    size_t count = 0;
+    ASSERT_EQ(quiver_database_read_vector_integers_by_handle(db, vector, id, buffer, 2, &count), QUIVER_OK);
+    EXPECT_EQ(count, 3u);
+    EXPECT_EQ(buffer[0], 1);
+    EXPECT_EQ(buffer[1], 2);
+    quiver_attribute_handle_free(vector);
+
+    quiver_attribute_handle_t* missing = nullptr;
+    EXPECT_EQ(quiver_database_attribute_handle(db, "Collection", "missing", &missing), QUIVER_ERROR_DATABASE);
+    EXPECT_EQ(missing, nullptr);
+    EXPECT_EQ(quiver_database_read_scalar_integer_by_handle(db, nullptr, id, &value, &has_value),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+
+    quiver_database_close(db);
+}
@@ -0,0 +1,85 @@
+#include "test_utils.h"
+
+#include <gtest/gtest.h>
+#include <quiver/c/database.h>
+#include <quiver/c/element.h>
+
+TEST(DatabaseCApiTransaction, CommitAndRollback) {
+    auto options = quiver::test::quiet_options();
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    int active = -1;
+    ASSERT_EQ(quiver_database_in_transaction(db, &active), QUIVER_OK);
+    EXPECT_EQ(active, 0);
+
+    ASSERT_EQ(quiver_database_begin_transaction(db), QUIVER_OK);
+    ASSERT_EQ(quiver_database_in_transaction(db, &active), QUIVER_OK);
+    EXPECT_EQ(active, 1);
+
+    auto element = quiver_element_create();
+    quiver_element_set_string(element, "label", "Kept");
+    quiver_database_create_element(db, "Configuration", element);
+    ASSERT_EQ(quiver_database_commit(db), QUIVER_OK);
+
+    ASSERT_EQ(quiver_database_begin_transaction(db), QUIVER_OK);
+    quiver_element_set_string(element, "label", "Discarded");
+    quiver_database_create_element(db, "Configuration", element);
+    ASSERT_EQ(quiver_database_rollback(db), QUIVER_OK);
+    quiver_element_destroy(element);
+
+    char** labels = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(quiver_database_read_scalar_strings(db, "Configuration", "label", &labels, &count), QUIVER_OK);
+    ASSERT_EQ(count, 1);
+    EXPECT_STREQ(labels[0], "Kept");
+    quiver_free_string_array(labels, count);
+
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApiTransaction, NestedTransaction) {
+    auto options = quiver::test::quiet_options();
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    ASSERT_EQ(quiver_database_begin_transaction(db), QUIVER_OK);
+    ASSERT_EQ(quiver_database_begin_transaction(db), QUIVER_OK);
+    ASSERT_EQ(quiver_database_rollback(db), QUIVER_OK);
+
+    int active = 0;
+    ASSERT_EQ(quiver_database_in_transaction(db, &active), QUIVER_OK);
+    EXPECT_EQ(active, 1);
+
+    ASSERT_EQ(quiver_database_commit(db), QUIVER_OK);
+    ASSERT_EQ(quiver_database_in_transaction(db, &active), QUIVER_OK);
+    EXPECT_EQ(active, 0);
+
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApiTransaction, CommitWithoutTransaction) {
+    auto options = quiver::test::quiet_options();
+    auto db = quiver_database_open(":memory:", &options);
+    ASSERT_NE(db, nullptr);
+
+    EXPECT_EQ(quiver_database_commit(db), QUIVER_ERROR_DATABASE);
+    EXPECT_EQ(quiver_database_rollback(db), QUIVER_ERROR_DATABASE);
+
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApiTransaction, NullArguments) {
+    EXPECT_EQ(quiver_database_begin_transaction(nullptr), QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_commit(nullptr), QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_rollback(nullptr), QUIVER_ERROR_INVALID_ARGUMENT);
+
+    int active = 0;
+    EXPECT_EQ(quiver_database_in_transaction(nullptr, &active), QUIVER_ERROR_INVALID_ARGUMENT);
+
+    auto options = quiver::test::quiet_options();
+    auto db = quiver_database_open(":memory:", &options);
+    ASSERT_NE(db, nullptr);
+    EXPECT_EQ(quiver_database_in_transaction(db, nullptr), QUIVER_ERROR_INVALID_ARGUMENT);
+    quiver_database_close(db);
+}
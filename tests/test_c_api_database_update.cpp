@@ -36,6 +36,48 @@ TEST(DatabaseCApi, UpdateScalarInteger) {
     quiver_database_close(db);
 }
 
+TEST(DatabaseCApi, UpdateScalarsMany) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    int64_t ids[2];
+    for (int i = 0; i < 2; ++i) {
+        auto e = quiver_element_create();
+        quiver_element_set_string(e, "label", ("Config " + std::to_string(i)).c_str());
+        ids[i] = quiver_database_create_element(db, "Configuration", e);
+        quiver_element_destroy(e);
+    }
+
+    int64_t integers[] = {7, 8};
+    auto err = quiver_database_update_scalar_integers(db, "Configuration", "integer_attribute", ids, integers, 2);
+    EXPECT_EQ(err, QUIVER_OK);
+
+    const char* strings[] = {"x", "y"};
+    err = quiver_database_update_scalar_strings(db, "Configuration", "string_attribute", ids, strings, 2);
+    EXPECT_EQ(err, QUIVER_OK);
+
+    int64_t value;
+    int has_value;
+    err = quiver_database_read_scalar_integers_by_id(
+        db, "Configuration", "integer_attribute", ids[1], &value, &has_value);
+    EXPECT_EQ(err, QUIVER_OK);
+    EXPECT_EQ(value, 8);
+
+    char* text = nullptr;
+    err = quiver_database_read_scalar_strings_by_id(db, "Configuration", "string_attribute", ids[0], &text, &has_value);
+    EXPECT_EQ(err, QUIVER_OK);
+    EXPECT_STREQ(text, "x");
+    delete[] text;
+
+    double floats[] = {1.0, 2.0};
+    err = quiver_database_update_scalar_floats(db, "Configuration", "float_attribute", nullptr, floats, 2);
+    EXPECT_EQ(err, QUIVER_ERROR_INVALID_ARGUMENT);
+
+    quiver_database_close(db);
+}
+
 TEST(DatabaseCApi, UpdateScalarFloat) {
     auto options = quiver_database_options_default();
     options.console_level = QUIVER_LOG_OFF;
@@ -693,3 +735,103 @@ TEST(DatabaseCApi, UpdateDateTimeScalar) {
     delete[] value;
     quiver_database_close(db);
 }
+
+// ============================================================================
+// Append and vector entry tests
+// ============================================================================
+
+TEST(DatabaseCApi, AppendVectorAndUpdateEntry) {
+    auto options = quiver::test::quiet_options();
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto config = quiver_element_create();
+    quiver_element_set_string(config, "label", "Test Config");
+    quiver_database_create_element(db, "Configuration", config);
+    quiver_element_destroy(config);
+
+    auto e = quiver_element_create();
+    quiver_element_set_string(e, "label", "Item 1");
+    int64_t id = quiver_database_create_element(db, "Collection", e);
+    quiver_element_destroy(e);
+
+    int64_t first[] = {1, 2};
+    int64_t second[] = {3};
+    EXPECT_EQ(quiver_database_append_vector_integers(db, "Collection", "value_int", id, first, 2), QUIVER_OK);
+    EXPECT_EQ(quiver_database_append_vector_integers(db, "Collection", "value_int", id, second, 1), QUIVER_OK);
+    EXPECT_EQ(quiver_database_update_vector_integer_entry(db, "Collection", "value_int", id, 0, 10), QUIVER_OK);
+
+    int64_t* values = nullptr;
+    size_t count = 0;
+    auto err = quiver_database_read_vector_integers_by_id(db, "Collection", "value_int", id, &values, &count);
+    EXPECT_EQ(err, QUIVER_OK);
+    ASSERT_EQ(count, 3);
+    EXPECT_EQ(values[0], 10);
+    EXPECT_EQ(values[1], 2);
+    EXPECT_EQ(values[2], 3);
+    quiver_free_integer_array(values);
+
+    EXPECT_EQ(quiver_database_update_vector_integer_entry(db, "Collection", "value_int", id, 5, 1),
+              QUIVER_ERROR_DATABASE);
+    EXPECT_EQ(quiver_database_append_vector_integers(db, "Collection", "value_int", id, nullptr, 1),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_update_vector_string_entry(db, "Collection", "value_int", id, 0, nullptr),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+
+    quiver_database_close(db);
+}
+
+// ============================================================================
+// Update time series tests
+// ============================================================================
+
+TEST(DatabaseCApi, UpdateAndReadTimeSeriesFloats) {
+    auto options = quiver::test::quiet_options();
+    auto db = quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto config = quiver_element_create();
+    quiver_element_set_string(config, "label", "Test Config");
+    quiver_database_create_element(db, "Configuration", config);
+    quiver_element_destroy(config);
+
+    auto e = quiver_element_create();
+    quiver_element_set_string(e, "label", "Item 1");
+    int64_t id = quiver_database_create_element(db, "Collection", e);
+    quiver_element_destroy(e);
+
+    const char* date_times[] = {"2024-01-02 00:00:00", "2024-01-01 00:00:00", "2024-01-03 00:00:00"};
+    double values[] = {2.0, 1.0, 3.0};
+    auto err = quiver_database_update_time_series_floats(db, "Collection", "value", id, date_times, values, 3);
+    EXPECT_EQ(err, QUIVER_OK);
+
+    char** out_date_times = nullptr;
+    double* out_values = nullptr;
+    size_t count = 0;
+    err = quiver_database_read_time_series_floats(
+        db, "Collection", "value", id, "2024-01-02 00:00:00", nullptr, &out_date_times, &out_values, &count);
+    EXPECT_EQ(err, QUIVER_OK);
+    ASSERT_EQ(count, 2);
+    EXPECT_STREQ(out_date_times[0], "2024-01-02 00:00:00");
+    EXPECT_STREQ(out_date_times[1], "2024-01-03 00:00:00");
+    EXPECT_DOUBLE_EQ(out_values[0], 2.0);
+    EXPECT_DOUBLE_EQ(out_values[1], 3.0);
+    quiver_free_time_series_floats(out_date_times, out_values, count);
+
+    err = quiver_database_read_time_series_floats(
+        db, "Collection", "value", id, nullptr, nullptr, &out_date_times, &out_values, &count);
+    EXPECT_EQ(err, QUIVER_OK);
+    EXPECT_EQ(count, 3);
+    quiver_free_time_series_floats(out_date_times, out_values, count);
+
+    // Null arrays are only allowed for an empty series
+    EXPECT_EQ(quiver_database_update_time_series_floats(db, "Collection", "value", id, nullptr, values, 1),
+              QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_database_update_time_series_floats(db, "Collection", "value", id, nullptr, nullptr, 0), QUIVER_OK);
+
+    err = quiver_database_read_time_series_floats(
+        db, "Collection", "nonexistent", id, nullptr, nullptr, &out_date_times, &out_values, &count);
+    EXPECT_EQ(err, QUIVER_ERROR_DATABASE);
+
+    quiver_database_close(db);
+}
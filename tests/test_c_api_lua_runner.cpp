@@ -422,3 +422,72 @@ TEST_F(LuaRunnerCApiTest, ReadVectorIntegersFromLua) {
     quiver_lua_runner_free(lua);
     quiver_database_close(db);
 }
+
+TEST_F(LuaRunnerCApiTest, CompileAndRunWithArgs) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", collections_schema.c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto lua = quiver_lua_runner_new(db);
+    ASSERT_NE(lua, nullptr);
+
+    ASSERT_EQ(quiver_lua_runner_run(lua, R"(db:create_element("Configuration", { label = "Config" }))"), QUIVER_OK);
+
+    size_t handle = 0;
+    ASSERT_EQ(quiver_lua_runner_compile(lua,
+                                        "create_item",
+                                        R"(
+        local label, value = ...
+        db:create_element("Collection", { label = label, some_float = value })
+    )",
+                                        &handle),
+              QUIVER_OK);
+
+    double value = 2.5;
+    int types[] = {QUIVER_DATA_TYPE_STRING, QUIVER_DATA_TYPE_FLOAT};
+    const void* values[] = {"Item 1", &value};
+    EXPECT_EQ(quiver_lua_runner_run_compiled(lua, handle, types, values, 2), QUIVER_OK);
+    values[0] = "Item 2";
+    EXPECT_EQ(quiver_lua_runner_run_compiled(lua, handle, types, values, 2), QUIVER_OK);
+
+    EXPECT_EQ(quiver_lua_runner_run(lua, R"(
+        local labels = db:read_scalar_strings("Collection", "label")
+        assert(#labels == 2 and labels[2] == "Item 2")
+        assert(db:read_scalar_floats("Collection", "some_float")[1] == 2.5)
+    )"),
+              QUIVER_OK);
+
+    quiver_lua_runner_free(lua);
+    quiver_database_close(db);
+}
+
+TEST_F(LuaRunnerCApiTest, CompileErrors) {
+    auto options = quiver_database_options_default();
+    options.console_level = QUIVER_LOG_OFF;
+    auto db = quiver_database_from_schema(":memory:", collections_schema.c_str(), &options);
+    ASSERT_NE(db, nullptr);
+
+    auto lua = quiver_lua_runner_new(db);
+    ASSERT_NE(lua, nullptr);
+
+    size_t handle = 0;
+    EXPECT_EQ(quiver_lua_runner_compile(nullptr, "name", "local x = 1", &handle), QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_lua_runner_compile(lua, "name", "local x = 1", nullptr), QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_lua_runner_run_compiled(lua, 0, nullptr, nullptr, 1), QUIVER_ERROR_INVALID_ARGUMENT);
+
+    EXPECT_EQ(quiver_lua_runner_compile(lua, "broken", "invalid lua syntax !!!", &handle), QUIVER_ERROR_DATABASE);
+    EXPECT_NE(quiver_lua_runner_get_error(lua), nullptr);
+
+    EXPECT_EQ(quiver_lua_runner_run_compiled(lua, 7, nullptr, nullptr, 0), QUIVER_ERROR_DATABASE);
+    EXPECT_NE(quiver_lua_runner_get_error(lua), nullptr);
+
+    ASSERT_EQ(quiver_lua_runner_compile(lua, "name", "local x = 1", &handle), QUIVER_OK);
+    EXPECT_EQ(quiver_lua_runner_release(nullptr, handle), QUIVER_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(quiver_lua_runner_release(lua, handle), QUIVER_OK);
+    EXPECT_EQ(quiver_lua_runner_run_compiled(lua, handle, nullptr, nullptr, 0), QUIVER_ERROR_DATABASE);
+    EXPECT_EQ(quiver_lua_runner_release(lua, handle), QUIVER_ERROR_DATABASE);
+
+    quiver_lua_runner_free(lua);
+    quiver_database_close(db);
+}
@@ -0,0 +1,200 @@
+#include "test_utils.h"
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <quiver/database.h>
+#include <quiver/element.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+class DatabaseArrowFixture : public ::testing::Test {
+protected:
+    void SetUp() override { directory = fs::temp_directory_path() / "quiver_arrow_test"; }
+    void TearDown() override { fs::remove_all(directory); }
+
+    std::string read_file(const std::string& name) const {
+        std::ifstream in(directory / name, std::ios::binary);
+        std::stringstream contents;
+        contents << in.rdbuf();
+        return contents.str();
+    }
+    void write_file(const std::string& name, const std::string& contents) const {
+        std::ofstream out(directory / name, std::ios::binary);
+        out << contents;
+    }
+
+    static quiver::Database open_collections() {
+        return quiver::Database::from_schema(
+            ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    }
+
+    fs::path directory;
+};
+
+TEST_F(DatabaseArrowFixture, ExportWritesOneArrowFilePerTable) {
+    auto db = open_collections();
+    db.create_element("Collection",
+                      quiver::Element().set("label", std::string("Item 1")).set("value_int", std::vector<int64_t>{1}));
+    db.export_collection("Collection", directory.string());
+
+    for (const auto* table :
+         {"Collection", "Collection_vector_values", "Collection_set_tags", "Collection_time_series_data"}) {
+        const auto contents = read_file(std::string(table) + ".arrow");
+        ASSERT_GE(contents.size(), 16u) << table;
+        // Padded leading magic, a continuation marker before the schema message, and the trailing magic
+        EXPECT_EQ(contents.substr(0, 8), std::string("ARROW1\0\0", 8)) << table;
+        EXPECT_EQ(contents.substr(8, 4), std::string("\xFF\xFF\xFF\xFF", 4)) << table;
+        EXPECT_EQ(contents.substr(contents.size() - 6), "ARROW1") << table;
+    }
+}
+
+TEST_F(DatabaseArrowFixture, RoundTrip) {
+    auto source = open_collections();
+    source.create_element("Collection",
+                          quiver::Element()
+                              .set("label", std::string("Item, \"one\" \xC3\xA9"))
+                              .set("some_integer", int64_t{-7})
+                              .set("some_float", 1.0 / 3.0)
+                              .set("value_int", std::vector<int64_t>{1, 2, 3})
+                              .set("value_float", std::vector<double>{0.5, 1.5, 2.5})
+                              .set("tag", std::vector<std::string>{"a", ""}));
+    source.create_element("Collection", quiver::Element().set("label", std::string("Item 2")));
+    source.update_time_series_floats(
+        "Collection", "value", 2, {"2024-01-01 00:00:00", "2024-01-02 00:00:00"}, {1.25, std::nan("")});
+    source.export_collection("Collection", directory.string());
+
+    auto target = open_collections();
+    target.import_collection("Collection", directory.string());
+
+    EXPECT_EQ(target.read_element_ids("Collection"), source.read_element_ids("Collection"));
+    EXPECT_EQ(target.read_scalar_strings_by_id("Collection", "label", 1), "Item, \"one\" \xC3\xA9");
+    EXPECT_EQ(target.read_scalar_integers_by_id("Collection", "some_integer", 1), -7);
+    EXPECT_EQ(target.read_scalar_integers_by_id("Collection", "some_integer", 2), std::nullopt);
+    EXPECT_EQ(target.read_scalar_floats_by_id("Collection", "some_float", 1), 1.0 / 3.0);
+    EXPECT_EQ(target.read_scalar_floats_by_id("Collection", "some_float", 2), std::nullopt);
+    EXPECT_EQ(target.read_vector_integers("Collection", "value_int"),
+              source.read_vector_integers("Collection", "value_int"));
+    EXPECT_EQ(target.read_vector_floats("Collection", "value_float"),
+              source.read_vector_floats("Collection", "value_float"));
+    EXPECT_EQ(target.read_set_strings_by_id("Collection", "tag", 1),
+              source.read_set_strings_by_id("Collection", "tag", 1));
+
+    const auto series = target.read_time_series_floats("Collection", "value", 2);
+    EXPECT_EQ(series.date_times, (std::vector<std::string>{"2024-01-01 00:00:00", "2024-01-02 00:00:00"}));
+    ASSERT_EQ(series.values.size(), 2u);
+    EXPECT_EQ(series.values[0], 1.25);
+    EXPECT_TRUE(std::isnan(series.values[1]));
+}
+
+TEST_F(DatabaseArrowFixture, RoundTripPackedVectors) {
+    const auto open_packed = [] {
+        return quiver::Database::from_schema(
+            ":memory:", VALID_SCHEMA("packed.sql"), {.console_level = quiver::LogLevel::off});
+    };
+    auto source = open_packed();
+    source.create_element(
+        "Collection",
+        quiver::Element().set("label", std::string("Item 1")).set("load", std::vector<double>{1.5, -2.0}));
+    source.create_element("Collection", quiver::Element().set("label", std::string("Item 2")));
+    source.export_collection("Collection", directory.string());
+
+    auto target = open_packed();
+    target.import_collection("Collection", directory.string());
+    EXPECT_EQ(target.read_vector_floats_by_id("Collection", "load", 1), (std::vector<double>{1.5, -2.0}));
+    EXPECT_TRUE(target.read_vector_floats_by_id("Collection", "load", 2).empty());
+    EXPECT_EQ(target.read_vector_floats("Collection", "load"), source.read_vector_floats("Collection", "load"));
+}
+
+TEST_F(DatabaseArrowFixture, RoundTripCompressedTimeSeries) {
+    const auto open_compressed = [] {
+        return quiver::Database::from_schema(
+            ":memory:", VALID_SCHEMA("compressed.sql"), {.console_level = quiver::LogLevel::off});
+    };
+    auto source = open_compressed();
+    const auto id = source.create_element("Plant", quiver::Element().set("label", std::string("Plant 1")));
+    source.update_time_series_floats(
+        "Plant", "power", id, {"2024-01-01 00:00:00", "2024-01-01 01:00:00"}, {1.5, -2.0});
+    source.export_collection("Plant", directory.string());
+
+    // The chunks are copied byte for byte, so the samples decode unchanged
+    auto target = open_compressed();
+    target.import_collection("Plant", directory.string());
+    EXPECT_EQ(target.query_integer("SELECT COUNT(*) FROM Plant_time_series_generation WHERE date_time IS NOT NULL "
+                                   "AND power IS NOT NULL"),
+              1);
+    const auto series = target.read_time_series_floats("Plant", "power", id);
+    EXPECT_EQ(series.date_times, (std::vector<std::string>{"2024-01-01 00:00:00", "2024-01-01 01:00:00"}));
+    EXPECT_EQ(series.values, (std::vector<double>{1.5, -2.0}));
+}
+
+TEST_F(DatabaseArrowFixture, RoundTripSpansRecordBatches) {
+    auto source = open_collections();
+    constexpr int64_t kElements = 70000;
+    std::vector<quiver::Element> elements;
+    for (int64_t i = 0; i < kElements; ++i) {
+        auto& element = elements.emplace_back();
+        element.set("label", "Item " + std::to_string(i));
+        if (i % 3 != 0) {
+            element.set("some_integer", i);
+        }
+    }
+    source.create_elements("Collection", elements);
+    source.export_collection("Collection", directory.string());
+
+    auto target = open_collections();
+    target.import_collection("Collection", directory.string());
+    EXPECT_EQ(target.query_integer("SELECT COUNT(*) FROM Collection"), kElements);
+    EXPECT_EQ(target.query_integer("SELECT COUNT(some_integer) FROM Collection"),
+              source.query_integer("SELECT COUNT(some_integer) FROM Collection"));
+    EXPECT_EQ(target.query_integer("SELECT SUM(some_integer) FROM Collection"),
+              source.query_integer("SELECT SUM(some_integer) FROM Collection"));
+    EXPECT_EQ(target.read_scalar_strings_by_id("Collection", "label", kElements),
+              "Item " + std::to_string(kElements - 1));
+}
+
+TEST_F(DatabaseArrowFixture, ImportSkipsMissingGroupFiles) {
+    auto source = open_collections();
+    source.create_element(
+        "Collection", quiver::Element().set("label", std::string("Item 1")).set("value_int", std::vector<int64_t>{4}));
+    source.export_collection("Collection", directory.string());
+    fs::remove(directory / "Collection_vector_values.arrow");
+
+    auto target = open_collections();
+    target.import_collection("Collection", directory.string());
+    EXPECT_EQ(target.read_element_ids("Collection"), (std::vector<int64_t>{1}));
+    EXPECT_TRUE(target.read_vector_integers_by_id("Collection", "value_int", 1).empty());
+}
+
+TEST_F(DatabaseArrowFixture, ImportErrorsRollBack) {
+    auto source = open_collections();
+    source.create_element(
+        "Collection", quiver::Element().set("label", std::string("Item 1")).set("value_int", std::vector<int64_t>{4}));
+    source.export_collection("Collection", directory.string());
+    const auto vectors = read_file("Collection_vector_values.arrow");
+
+    auto target = open_collections();
+    // A corrupt group file fails after the collection rows were inserted; none of them are kept
+    write_file("Collection_vector_values.arrow", vectors.substr(0, vectors.size() / 2) + "ARROW1");
+    EXPECT_THROW(target.import_collection("Collection", directory.string()), std::runtime_error);
+    write_file("Collection_vector_values.arrow", "not an arrow file");
+    EXPECT_THROW(target.import_collection("Collection", directory.string()), std::runtime_error);
+    EXPECT_EQ(target.query_integer("SELECT COUNT(*) FROM Collection"), 0);
+
+    // Columns are matched by name and type
+    fs::copy_file(directory / "Collection.arrow",
+                  directory / "Collection_set_tags.arrow",
+                  fs::copy_options::overwrite_existing);
+    fs::remove(directory / "Collection_vector_values.arrow");
+    EXPECT_THROW(target.import_collection("Collection", directory.string()), std::runtime_error);
+    EXPECT_EQ(target.query_integer("SELECT COUNT(*) FROM Collection"), 0);
+
+    fs::remove(directory / "Collection.arrow");
+    EXPECT_THROW(target.import_collection("Collection", directory.string()), std::runtime_error);
+    EXPECT_THROW(target.import_collection("Missing", directory.string()), std::runtime_error);
+    EXPECT_THROW(source.export_collection("Missing", directory.string()), std::runtime_error);
+}
@@ -58,6 +58,30 @@ TEST(Database, CreateElementWithVector) {
     EXPECT_EQ(float_vectors[0], (std::vector<double>{1.5, 2.5, 3.5}));
 }
 
+TEST(Database, CreateElementWithLargeVectors) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+
+    // Two zipped columns across several insert chunks plus a remainder
+    std::vector<int64_t> ints(1234);
+    std::vector<double> floats(1234);
+    for (size_t i = 0; i < ints.size(); ++i) {
+        ints[i] = static_cast<int64_t>(i);
+        floats[i] = static_cast<double>(i) / 2;
+    }
+
+    quiver::Element element;
+    element.set("label", std::string("Item 1")).set("value_int", ints).set("value_float", floats);
+    int64_t id = db.create_element("Collection", element);
+
+    EXPECT_EQ(db.read_vector_integers_by_id("Collection", "value_int", id), ints);
+    EXPECT_EQ(db.read_vector_floats_by_id("Collection", "value_float", id), floats);
+}
+
 TEST(Database, CreateElementWithVectorGroup) {
     auto db = quiver::Database::from_schema(
         ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
@@ -247,3 +271,151 @@ TEST(Database, CreateElementWithDatetime) {
     EXPECT_EQ(dates.size(), 1);
     EXPECT_EQ(dates[0], "2024-03-15T14:30:45");
 }
+
+// ============================================================================
+// Bulk creation tests
+// ============================================================================
+
+TEST(Database, CreateElementsReturnsIdsInOrder) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+
+    std::vector<quiver::Element> elements(3);
+    elements[0].set("label", std::string("Item 1")).set("value_int", std::vector<int64_t>{1, 2});
+    elements[1].set("label", std::string("Item 2")).set("tag", std::vector<std::string>{"a", "b"});
+    elements[2].set("label", std::string("Item 3")).set("value_int", std::vector<int64_t>{3});
+
+    auto ids = db.create_elements("Collection", elements);
+    EXPECT_EQ(ids, (std::vector<int64_t>{1, 2, 3}));
+
+    auto labels = db.read_scalar_strings("Collection", "label");
+    EXPECT_EQ(labels, (std::vector<std::string>{"Item 1", "Item 2", "Item 3"}));
+    EXPECT_EQ(db.read_vector_integers_by_id("Collection", "value_int", 1), (std::vector<int64_t>{1, 2}));
+    EXPECT_EQ(db.read_vector_integers_by_id("Collection", "value_int", 3), (std::vector<int64_t>{3}));
+    EXPECT_EQ(db.read_set_strings_by_id("Collection", "tag", 2).size(), 2);
+}
+
+TEST(Database, CreateElementsEmpty) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    auto ids = db.create_elements("Configuration", {});
+    EXPECT_TRUE(ids.empty());
+}
+
+TEST(Database, CreateElementsRollsBackOnFailure) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    std::vector<quiver::Element> elements(3);
+    elements[0].set("label", std::string("Config 1"));
+    elements[1].set("label", std::string("Config 2"));
+    elements[2].set("label", std::string("Config 1"));  // Duplicate label
+
+    EXPECT_THROW(db.create_elements("Configuration", elements), std::runtime_error);
+    EXPECT_TRUE(db.read_scalar_strings("Configuration", "label").empty());
+}
+
+TEST(Database, CreateElementsInvalidCollection) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    std::vector<quiver::Element> elements(1);
+    elements[0].set("label", std::string("Test"));
+
+    EXPECT_THROW(db.create_elements("NonexistentCollection", elements), std::runtime_error);
+}
+
+TEST(Database, CreateElementIsAtomic) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+
+    // Scalar row is valid but the vector values have the wrong type
+    quiver::Element element;
+    element.set("label", std::string("Item 1")).set("value_int", std::vector<std::string>{"a", "b"});
+    EXPECT_THROW(db.create_element("Collection", element), std::runtime_error);
+
+    // No half-written element is left behind
+    EXPECT_TRUE(db.read_scalar_strings("Collection", "label").empty());
+    EXPECT_TRUE(db.read_element_ids("Collection").empty());
+
+    // Label is free again
+    element.set("value_int", std::vector<int64_t>{1, 2});
+    EXPECT_EQ(db.create_element("Collection", element), 1);
+}
+
+TEST(Database, UpsertElementInsertsThenUpdates) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+
+    quiver::Element element;
+    element.set("label", std::string("Item 1"))
+        .set("some_integer", int64_t{1})
+        .set("some_float", 1.5)
+        .set("value_int", std::vector<int64_t>{1, 2, 3})
+        .set("tag", std::vector<std::string>{"a", "b"});
+    const auto id = db.upsert_element("Collection", element);
+    EXPECT_EQ(id, 1);
+
+    // Same label: scalars and groups it carries are rewritten, the rest is kept
+    quiver::Element update;
+    update.set("label", std::string("Item 1"))
+        .set("some_integer", int64_t{2})
+        .set("value_int", std::vector<int64_t>{9});
+    EXPECT_EQ(db.upsert_element("Collection", update), id);
+
+    EXPECT_EQ(db.read_element_ids("Collection").size(), 1);
+    EXPECT_EQ(db.read_scalar_integers_by_id("Collection", "some_integer", id), 2);
+    EXPECT_EQ(db.read_scalar_floats_by_id("Collection", "some_float", id), 1.5);
+    EXPECT_EQ(db.read_vector_integers_by_id("Collection", "value_int", id), (std::vector<int64_t>{9}));
+    EXPECT_EQ(db.read_set_strings_by_id("Collection", "tag", id).size(), 2);
+
+    // A label alone still reports the existing id
+    EXPECT_EQ(db.upsert_element("Collection", quiver::Element().set("label", std::string("Item 1"))), id);
+}
+
+TEST(Database, UpsertElementsMixesInsertsAndUpdates) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+    db.create_element("Collection",
+                      quiver::Element().set("label", std::string("Item 2")).set("some_integer", int64_t{5}));
+
+    std::vector<quiver::Element> elements(3);
+    elements[0].set("label", std::string("Item 1")).set("some_integer", int64_t{1});
+    elements[1].set("label", std::string("Item 2")).set("some_integer", int64_t{2});
+    elements[2].set("label", std::string("Item 3")).set("tag", std::vector<std::string>{"x"});
+
+    // AUTOINCREMENT spends an id on the conflicting insert, so the new elements need not be consecutive
+    const auto ids = db.upsert_elements("Collection", elements);
+    ASSERT_EQ(ids.size(), 3);
+    EXPECT_EQ(ids[1], 1);
+    EXPECT_GT(ids[2], ids[0]);
+    EXPECT_EQ(db.read_element_ids("Collection").size(), 3);
+    EXPECT_EQ(db.read_scalar_integers_by_id("Collection", "some_integer", ids[0]), 1);
+    EXPECT_EQ(db.read_scalar_integers_by_id("Collection", "some_integer", ids[1]), 2);
+    EXPECT_EQ(db.read_set_strings_by_id("Collection", "tag", ids[2]), (std::vector<std::string>{"x"}));
+
+    EXPECT_TRUE(db.upsert_elements("Collection", {}).empty());
+}
+
+TEST(Database, UpsertElementRequiresLabel) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    EXPECT_THROW(db.upsert_element("Configuration", quiver::Element().set("integer_attribute", int64_t{1})),
+                 std::runtime_error);
+
+    std::vector<quiver::Element> elements(2);
+    elements[0].set("label", std::string("Config 1"));
+    elements[1].set("integer_attribute", int64_t{1});
+    EXPECT_THROW(db.upsert_elements("Configuration", elements), std::runtime_error);
+    EXPECT_TRUE(db.read_scalar_strings("Configuration", "label").empty());
+}
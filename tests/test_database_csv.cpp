@@ -0,0 +1,222 @@
+#include "test_utils.h"
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <quiver/database.h>
+#include <quiver/element.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+class DatabaseCsvFixture : public ::testing::Test {
+protected:
+    void SetUp() override { path = (fs::temp_directory_path() / "quiver_csv_test.csv").string(); }
+    void TearDown() override {
+        if (fs::exists(path))
+            fs::remove(path);
+    }
+
+    std::string read_file() const {
+        std::ifstream in(path, std::ios::binary);
+        std::stringstream contents;
+        contents << in.rdbuf();
+        return contents.str();
+    }
+    void write_file(const std::string& contents) const {
+        std::ofstream out(path, std::ios::binary);
+        out << contents;
+    }
+
+    std::string path;
+};
+
+TEST_F(DatabaseCsvFixture, ExportQuotesOnlyWhenNeeded) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration",
+                      quiver::Element()
+                          .set("label", std::string("Config 1"))
+                          .set("integer_attribute", int64_t{42})
+                          .set("float_attribute", 0.1)
+                          .set("string_attribute", std::string("say \"hi\", then\nleave")));
+    db.create_element("Configuration",
+                      quiver::Element()
+                          .set("label", std::string("Config 2"))
+                          .set_null("integer_attribute")
+                          .set("string_attribute", std::string("")));
+
+    db.export_to_csv("Configuration", path);
+
+    EXPECT_EQ(read_file(),
+              "id,label,integer_attribute,float_attribute,string_attribute,date_attribute,boolean_attribute\n"
+              "1,Config 1,42,0.1,\"say \"\"hi\"\", then\nleave\",,\n"
+              "2,Config 2,,,\"\",,\n");
+}
+
+TEST_F(DatabaseCsvFixture, RoundTrip) {
+    auto source = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    source.create_element("Collection",
+                          quiver::Element()
+                              .set("label", std::string("Item, \"one\""))
+                              .set("some_integer", int64_t{-7})
+                              .set("some_float", 1.0 / 3.0)
+                              .set("value_int", std::vector<int64_t>{1, 2, 3}));
+    source.create_element("Collection", quiver::Element().set("label", std::string("Item 2")));
+
+    auto target = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    for (const auto* table : {"Collection", "Collection_vector_values"}) {
+        source.export_to_csv(table, path);
+        target.import_from_csv(table, path);
+    }
+
+    EXPECT_EQ(target.read_element_ids("Collection"), source.read_element_ids("Collection"));
+    EXPECT_EQ(target.read_scalar_strings_by_id("Collection", "label", 1), "Item, \"one\"");
+    EXPECT_EQ(target.read_scalar_strings_by_id("Collection", "label", 2), "Item 2");
+    EXPECT_EQ(target.read_scalar_integers_by_id("Collection", "some_integer", 1), -7);
+    EXPECT_EQ(target.read_scalar_integers_by_id("Collection", "some_integer", 2), std::nullopt);
+    // Shortest round-trip formatting keeps doubles exact
+    EXPECT_EQ(target.read_scalar_floats("Collection", "some_float"), (std::vector<double>{1.0 / 3.0}));
+    EXPECT_EQ(target.read_vector_integers("Collection", "value_int"), (std::vector<std::vector<int64_t>>{{1, 2, 3}}));
+}
+
+TEST_F(DatabaseCsvFixture, RoundTripPackedVectors) {
+    const auto open_packed = [] {
+        return quiver::Database::from_schema(
+            ":memory:", VALID_SCHEMA("packed.sql"), {.console_level = quiver::LogLevel::off});
+    };
+    auto source = open_packed();
+    source.create_element(
+        "Collection",
+        quiver::Element().set("label", std::string("Item 1")).set("load", std::vector<double>{1.5, -2.0}));
+    source.export_to_csv("Collection_vector_profiles", path);
+
+    // BLOBs are written as the hex of their bytes, little-endian float64s here
+    EXPECT_EQ(read_file(), "id,load,price\n1,000000000000f83f00000000000000c0,\n");
+
+    auto target = open_packed();
+    target.create_element("Collection", quiver::Element().set("label", std::string("Item 1")));
+    target.import_from_csv("Collection_vector_profiles", path);
+    EXPECT_EQ(target.read_vector_floats_by_id("Collection", "load", 1), (std::vector<double>{1.5, -2.0}));
+    EXPECT_TRUE(target.read_vector_floats_by_id("Collection", "price", 1).empty());
+}
+
+TEST_F(DatabaseCsvFixture, ImportTimeSeries) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    auto id = db.create_element("Collection", quiver::Element().set("label", std::string("Item 1")));
+
+    // Byte order mark, CRLF line endings, quoted fields, columns in any order, a blank line and no final newline
+    write_file("\xEF\xBB\xBF" "date_time,value,collection_id\r\n"
+               "\"2024-01-01 00:00:00\",1.5,1\r\n"
+               "\r\n"
+               "2024-01-02 00:00:00,,1\r\n"
+               "2024-01-03 00:00:00,3,1");
+    db.import_from_csv("Collection_time_series_data", path);
+
+    auto series = db.read_time_series_floats("Collection", "value", id);
+    EXPECT_EQ(series.date_times,
+              (std::vector<std::string>{"2024-01-01 00:00:00", "2024-01-02 00:00:00", "2024-01-03 00:00:00"}));
+    ASSERT_EQ(series.values.size(), 3);
+    EXPECT_EQ(series.values[0], 1.5);
+    EXPECT_TRUE(std::isnan(series.values[1]));
+    EXPECT_EQ(series.values[2], 3.0);
+}
+
+TEST_F(DatabaseCsvFixture, ImportSpansBufferRefills) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    auto id = db.create_element("Collection", quiver::Element().set("label", std::string("Item 1")));
+
+    // Larger than the reader's buffer, with one record longer than the buffer on its own
+    constexpr int64_t kRows = 100000;
+    const std::string long_value(3 << 20, 'x');
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "collection_id,date_time,value\n";
+        for (int64_t i = 0; i < kRows; ++i) {
+            out << id << ",\"t" << i << "\"," << i << ".5\n";
+        }
+        out << "2,tail,0\n";
+    }
+    db.create_element("Collection", quiver::Element().set("label", long_value));
+    db.import_from_csv("Collection_time_series_data", path);
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Collection_time_series_data"), kRows + 1);
+    EXPECT_EQ(db.query_float("SELECT SUM(value) FROM Collection_time_series_data"),
+              static_cast<double>(kRows) * (kRows - 1) / 2 + 0.5 * kRows);
+
+    db.export_to_csv("Collection", path);
+    auto copy = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    copy.import_from_csv("Collection", path);
+    EXPECT_EQ(copy.read_scalar_strings_by_id("Collection", "label", 2), long_value);
+}
+
+TEST_F(DatabaseCsvFixture, ImportKeepsFileOrderAcrossChunks) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    // Several parse chunks' worth of records without ids, so ids show the insert order, and with quoted newlines
+    // that must not be taken as record boundaries
+    constexpr int64_t kRows = 60000;
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "label,some_integer\n";
+        for (int64_t i = 1; i <= kRows; ++i) {
+            out << "\"Item\n" << i << "\"," << i * 2 << "\n";
+        }
+    }
+    db.import_from_csv("Collection", path);
+
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Collection"), kRows);
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Collection WHERE some_integer = 2 * id"), kRows);
+    EXPECT_EQ(db.read_scalar_strings_by_id("Collection", "label", kRows), "Item\n" + std::to_string(kRows));
+}
+
+TEST_F(DatabaseCsvFixture, ImportErrorReportsLine) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "label,some_integer\n";
+        for (int64_t i = 1; i <= 50000; ++i) {
+            out << "\"Item\n" << i << "\"," << i << "\n";
+        }
+        out << "Bad,x\n";
+    }
+    try {
+        db.import_from_csv("Collection", path);
+        FAIL() << "expected import_from_csv to throw";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find("line 100002: invalid INTEGER value 'x' for column 'some_integer'"),
+                  std::string::npos)
+            << e.what();
+    }
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Collection"), 0);
+}
+
+TEST_F(DatabaseCsvFixture, ImportErrorsRollBack) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+    const auto import_fails = [&](const std::string& contents) {
+        write_file(contents);
+        EXPECT_THROW(db.import_from_csv("Configuration", path), std::runtime_error) << contents;
+    };
+
+    import_fails("");
+    import_fails("label,missing\nConfig 1,1\n");
+    import_fails("label,integer_attribute\nConfig 1,1\nConfig 2,2.5\n");
+    import_fails("label,integer_attribute\nConfig 1,1\nConfig 2\n");
+    import_fails("label,float_attribute\n\"Config 1,1.0\n");
+    import_fails("label,float_attribute\n\"Config\" 1,1.0\n");
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Configuration"), 0);
+
+    EXPECT_THROW(db.import_from_csv("Missing", path), std::runtime_error);
+    EXPECT_THROW(db.import_from_csv("Configuration", path + ".missing"), std::runtime_error);
+    EXPECT_THROW(db.export_to_csv("Missing", path), std::runtime_error);
+}
@@ -3,6 +3,9 @@
 #include <gtest/gtest.h>
 #include <quiver/database.h>
 #include <quiver/element.h>
+#include <quiver/filter.h>
+#include <string>
+#include <vector>
 
 TEST(Database, DeleteElementById) {
     auto db =
@@ -131,3 +134,61 @@ TEST(Database, DeleteElementByIdOtherElementsUnchanged) {
     EXPECT_TRUE(val3.has_value());
     EXPECT_EQ(*val3, 200);
 }
+
+TEST(Database, DeleteElementsByIdsWithGroupData) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+
+    std::vector<int64_t> ids;
+    for (int i = 1; i <= 4; ++i) {
+        quiver::Element e;
+        e.set("label", "Item " + std::to_string(i))
+            .set("value_int", std::vector<int64_t>{i, i * 10})
+            .set("tag", std::vector<std::string>{"tag" + std::to_string(i)});
+        ids.push_back(db.create_element("Collection", e));
+        db.update_time_series_floats("Collection", "value", ids.back(), {"2024-01-01", "2024-01-02"}, {1.0, 2.0});
+    }
+
+    // Unknown ids are skipped
+    std::vector<int64_t> doomed{ids[0], ids[2], 999};
+    EXPECT_EQ(db.delete_elements_by_ids("Collection", doomed), 2u);
+
+    EXPECT_EQ(db.read_element_ids("Collection"), (std::vector<int64_t>{ids[1], ids[3]}));
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Collection_vector_values"), 4);
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Collection_set_tags"), 2);
+    EXPECT_EQ(db.query_integer("SELECT COUNT(DISTINCT collection_id) FROM Collection_time_series_data"), 2);
+    EXPECT_EQ(db.read_vector_integers_by_id("Collection", "value_int", ids[3]), (std::vector<int64_t>{4, 40}));
+
+    EXPECT_EQ(db.delete_elements_by_ids("Collection", std::vector<int64_t>{}), 0u);
+    EXPECT_THROW(db.delete_elements_by_ids("Nonexistent", doomed), std::runtime_error);
+}
+
+TEST(Database, DeleteElementsWhere) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+
+    std::vector<int64_t> ids;
+    for (int i = 1; i <= 5; ++i) {
+        quiver::Element e;
+        e.set("label", "Item " + std::to_string(i))
+            .set("some_integer", int64_t{i})
+            .set("value_int", std::vector<int64_t>{i});
+        ids.push_back(db.create_element("Collection", e));
+    }
+
+    const auto filter = quiver::Filter{}.where("some_integer", quiver::FilterOp::greater_equal, int64_t{3});
+    EXPECT_EQ(db.delete_elements_where("Collection", filter), 3u);
+    EXPECT_EQ(db.read_element_ids("Collection"), (std::vector<int64_t>{ids[0], ids[1]}));
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Collection_vector_values"), 2);
+
+    // Predicates are checked against the schema
+    EXPECT_THROW(db.delete_elements_where("Collection", quiver::Filter{}.where("missing", quiver::FilterOp::is_null)),
+                 std::runtime_error);
+
+    // An empty filter matches every element
+    EXPECT_EQ(db.delete_elements_where("Collection", quiver::Filter{}), 2u);
+    EXPECT_TRUE(db.read_element_ids("Collection").empty());
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Collection_vector_values"), 0);
+}
@@ -1,6 +1,12 @@
+#include "test_utils.h"
+
+#include <chrono>
 #include <filesystem>
+#include <fstream>
 #include <gtest/gtest.h>
+#include <iterator>
 #include <quiver/database.h>
+#include <quiver/element.h>
 #include <quiver/migration.h>
 #include <quiver/migrations.h>
 #include <string>
@@ -11,8 +17,10 @@ class TempFileFixture : public ::testing::Test {
 protected:
     void SetUp() override { path = (fs::temp_directory_path() / "quiver_test.db").string(); }
     void TearDown() override {
-        if (fs::exists(path))
-            fs::remove(path);
+        for (const auto& file : {path, path + "-wal", path + "-shm", path + ".backup"}) {
+            if (fs::exists(file))
+                fs::remove(file);
+        }
     }
     std::string path;
 };
@@ -66,6 +74,184 @@ TEST_F(TempFileFixture, LogLevelOff) {
     EXPECT_TRUE(db.is_healthy());
 }
 
+TEST_F(TempFileFixture, FileLogLevel) {
+    const auto log_path = fs::path(path).parent_path() / "quiver_database.log";
+    auto read_log = [&] {
+        std::ifstream file(log_path);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    };
+
+    fs::remove(log_path);
+    { quiver::Database db(path, {.console_level = quiver::LogLevel::off, .file_level = quiver::LogLevel::off}); }
+    EXPECT_FALSE(fs::exists(log_path));
+
+    { quiver::Database db(path, {.console_level = quiver::LogLevel::off, .file_level = quiver::LogLevel::warn}); }
+    EXPECT_EQ(read_log().find("Database opened successfully"), std::string::npos);
+
+    { quiver::Database db(path, {.console_level = quiver::LogLevel::off, .file_level = quiver::LogLevel::info}); }
+    EXPECT_NE(read_log().find("Database opened successfully"), std::string::npos);
+}
+
+TEST_F(TempFileFixture, AsyncLogging) {
+    const auto log_path = fs::path(path).parent_path() / "quiver_database.log";
+    {
+        auto db = quiver::Database::from_schema(
+            path, VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off, .async_logging = true});
+        for (int i = 0; i < 100; ++i) {
+            db.create_element("Configuration", quiver::Element().set("label", "Config " + std::to_string(i)));
+        }
+    }
+
+    // Closing the last async Database drains the queue before the log file is released
+    std::ifstream file(log_path);
+    const std::string log((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_NE(log.find("Database opened successfully"), std::string::npos);
+    EXPECT_NE(log.find("Created element 100 in Configuration"), std::string::npos);
+}
+
+TEST_F(TempFileFixture, SlowQueryLog) {
+    const auto log_path = fs::path(path).parent_path() / "quiver_database.log";
+    auto read_log = [&] {
+        std::ifstream file(log_path);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    };
+
+    fs::remove(log_path);
+    {
+        quiver::Database db(path, {.console_level = quiver::LogLevel::off});
+        db.query_integer("SELECT ?", {int64_t{42}});
+    }
+    EXPECT_EQ(read_log().find("Slow query"), std::string::npos);
+
+    {
+        // A zero threshold reports every statement
+        quiver::Database db(
+            path, {.console_level = quiver::LogLevel::off, .slow_query_threshold = std::chrono::milliseconds(0)});
+        db.query_integer("SELECT ?", {int64_t{42}});
+    }
+    const auto log = read_log();
+    EXPECT_NE(log.find("in query_integer: SELECT 42"), std::string::npos);
+}
+
+TEST_F(TempFileFixture, BusyTimeoutWaitsForLock) {
+    auto writer =
+        quiver::Database::from_schema(path, VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+    quiver::Database other(path, {.console_level = quiver::LogLevel::off});
+    const std::string insert = "INSERT INTO Configuration (label) VALUES ('Second') RETURNING id";
+
+    writer.begin_transaction();
+    writer.create_element("Configuration", quiver::Element().set("label", std::string("First")));
+
+    // Without a busy timeout the second writer fails at once
+    EXPECT_THROW(other.query_integer(insert), std::runtime_error);
+
+    other.set_busy_timeout(std::chrono::milliseconds(100));
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_THROW(other.query_integer(insert), std::runtime_error);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(90));
+
+    writer.commit();
+    EXPECT_EQ(other.query_integer(insert), 2);
+}
+
+TEST_F(TempFileFixture, BackupToFileReportsProgress) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+    for (int i = 0; i < 200; ++i) {
+        db.create_element("Configuration",
+                          quiver::Element()
+                              .set("label", "Config " + std::to_string(i))
+                              .set("string_attribute", std::string(200, 'x')));
+    }
+
+    std::vector<std::pair<int, int>> steps;
+    db.backup_to(path + ".backup",
+                 {.pages_per_step = 4, .on_progress = [&](int remaining, int total) {
+                      steps.emplace_back(remaining, total);
+                  }});
+    ASSERT_GT(steps.size(), 1u);
+    EXPECT_EQ(steps.back().first, 0);
+    EXPECT_GT(steps.front().first, steps.back().first);
+
+    auto copy = quiver::Database::from_snapshot(path + ".backup", {.console_level = quiver::LogLevel::off});
+    EXPECT_EQ(copy.read_scalar_strings("Configuration", "label").size(), 200u);
+}
+
+TEST_F(TempFileFixture, SnapshotMutatesCopyAndWritesBack) {
+    {
+        auto db =
+            quiver::Database::from_schema(path, VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+        db.create_element("Configuration", quiver::Element().set("label", std::string("Base")));
+    }
+
+    auto snapshot = quiver::Database::from_snapshot(path, {.console_level = quiver::LogLevel::off});
+    EXPECT_EQ(snapshot.path(), ":memory:");
+    snapshot.create_element("Configuration", quiver::Element().set("label", std::string("Scenario")));
+
+    const auto count_on_disk = [this] {
+        quiver::Database file(path, {.console_level = quiver::LogLevel::off});
+        return file.query_integer("SELECT count(*) FROM Configuration").value();
+    };
+    EXPECT_EQ(count_on_disk(), 1);
+
+    snapshot.backup_to(path);
+    EXPECT_EQ(count_on_disk(), 2);
+}
+
+TEST_F(TempFileFixture, CloneInMemoryIsIndependent) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Base")));
+
+    auto clone = db.clone_in_memory();
+    clone.create_element("Configuration", quiver::Element().set("label", std::string("Clone only")));
+
+    EXPECT_EQ(db.read_scalar_strings("Configuration", "label"), (std::vector<std::string>{"Base"}));
+    EXPECT_EQ(clone.read_scalar_strings("Configuration", "label"), (std::vector<std::string>{"Base", "Clone only"}));
+}
+
+TEST_F(TempFileFixture, LoadIntoMemoryWritesBackOnFlush) {
+    {
+        auto db = quiver::Database::from_schema(
+            path,
+            VALID_SCHEMA("basic.sql"),
+            {.console_level = quiver::LogLevel::off, .page_size = 8192, .load_into_memory = true});
+        db.create_element("Configuration", quiver::Element().set("label", std::string("Base")));
+        EXPECT_FALSE(fs::exists(path));
+        db.flush();
+    }
+    const auto count_on_disk = [this] {
+        quiver::Database file(path, {.console_level = quiver::LogLevel::off});
+        return file.query_integer("SELECT count(*) FROM Configuration").value();
+    };
+    EXPECT_EQ(count_on_disk(), 1);
+
+    {
+        quiver::Database db(path, {.console_level = quiver::LogLevel::off, .load_into_memory = true});
+        EXPECT_EQ(db.path(), path);
+        EXPECT_EQ(db.query_integer("PRAGMA page_size"), 8192);
+        db.query_integer("INSERT INTO Configuration (label) VALUES ('Draft') RETURNING id");
+        EXPECT_EQ(count_on_disk(), 1);
+
+        db.begin_transaction();
+        EXPECT_THROW(db.flush(), std::runtime_error);
+        db.commit();
+        db.flush();
+        EXPECT_EQ(count_on_disk(), 2);
+
+        // Not flushed, so lost on close
+        db.query_integer("INSERT INTO Configuration (label) VALUES ('Discarded') RETURNING id");
+    }
+    EXPECT_EQ(count_on_disk(), 2);
+
+    quiver::Database reader(path,
+                            {.read_only = true, .console_level = quiver::LogLevel::off, .load_into_memory = true});
+    EXPECT_EQ(reader.query_integer("SELECT count(*) FROM Configuration"), 2);
+    EXPECT_THROW(reader.query_integer("INSERT INTO Configuration (label) VALUES ('No') RETURNING id"),
+                 std::runtime_error);
+    EXPECT_THROW(reader.flush(), std::runtime_error);
+}
+
 TEST_F(TempFileFixture, CreatesFileOnDisk) {
     {
         quiver::Database db(path);
@@ -74,6 +260,79 @@ TEST_F(TempFileFixture, CreatesFileOnDisk) {
     EXPECT_TRUE(fs::exists(path));
 }
 
+TEST_F(TempFileFixture, PragmaOptions) {
+    {
+        quiver::Database db(path,
+                            {.console_level = quiver::LogLevel::off,
+                             .journal_mode = quiver::JournalMode::wal,
+                             .synchronous = quiver::SynchronousMode::normal,
+                             .cache_size = -8192,
+                             .mmap_size = 1 << 20,
+                             .temp_store = quiver::TempStore::memory,
+                             .page_size = 8192});
+        EXPECT_EQ(db.query_string("PRAGMA journal_mode"), "wal");
+        EXPECT_EQ(db.query_integer("PRAGMA synchronous"), 1);
+        EXPECT_EQ(db.query_integer("PRAGMA cache_size"), -8192);
+        EXPECT_EQ(db.query_integer("PRAGMA temp_store"), 2);
+        EXPECT_EQ(db.query_integer("PRAGMA page_size"), 8192);
+    }
+    // Unset fields keep SQLite's defaults; WAL is persistent in the file
+    quiver::Database db(path, {.console_level = quiver::LogLevel::off});
+    EXPECT_EQ(db.query_string("PRAGMA journal_mode"), "wal");
+    EXPECT_EQ(db.query_integer("PRAGMA synchronous"), 2);
+    EXPECT_EQ(db.query_integer("PRAGMA temp_store"), 0);
+}
+
+TEST_F(TempFileFixture, PragmaOptionsInvalid) {
+    EXPECT_THROW(quiver::Database(":memory:", {.console_level = quiver::LogLevel::off, .page_size = 1000}),
+                 std::runtime_error);
+    EXPECT_THROW(quiver::Database(":memory:", {.console_level = quiver::LogLevel::off, .mmap_size = -1}),
+                 std::runtime_error);
+
+    // In-memory databases cannot use WAL; SQLite keeps "memory" and the open still succeeds
+    quiver::Database db(":memory:", {.console_level = quiver::LogLevel::off, .journal_mode = quiver::JournalMode::wal});
+    EXPECT_EQ(db.query_string("PRAGMA journal_mode"), "memory");
+}
+
+TEST_F(TempFileFixture, WalReaderDoesNotBlockWriter) {
+    auto writer = quiver::Database::from_schema(
+        path,
+        VALID_SCHEMA("basic.sql"),
+        {.console_level = quiver::LogLevel::off, .journal_mode = quiver::JournalMode::wal});
+    writer.create_element("Configuration", quiver::Element().set("label", std::string("Config 1")));
+
+    quiver::Database reader(path, {.read_only = true, .console_level = quiver::LogLevel::off});
+    reader.begin_transaction();
+    EXPECT_EQ(reader.query_integer("SELECT COUNT(*) FROM Configuration"), 1);
+
+    // The open read transaction neither blocks the commit nor sees it
+    EXPECT_NO_THROW(writer.create_element("Configuration", quiver::Element().set("label", std::string("Config 2"))));
+    EXPECT_EQ(reader.query_integer("SELECT COUNT(*) FROM Configuration"), 1);
+    reader.commit();
+    EXPECT_EQ(reader.query_integer("SELECT COUNT(*) FROM Configuration"), 2);
+}
+
+TEST_F(TempFileFixture, MappedReadOnly) {
+    {
+        auto db =
+            quiver::Database::from_schema(path, VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+        db.create_element("Configuration", quiver::Element().set("label", std::string("Config 1")));
+    }
+
+    quiver::Database db(path, {.console_level = quiver::LogLevel::off, .mapped = true});
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Configuration"), 1);
+    EXPECT_EQ(db.query_integer("PRAGMA query_only"), 1);
+    EXPECT_GT(db.query_integer("PRAGMA mmap_size").value_or(0), 0);
+    EXPECT_THROW(db.create_element("Configuration", quiver::Element().set("label", std::string("Config 2"))),
+                 std::runtime_error);
+}
+
+TEST_F(TempFileFixture, MappedRequiresFile) {
+    EXPECT_THROW(quiver::Database(":memory:", {.console_level = quiver::LogLevel::off, .mapped = true}),
+                 std::runtime_error);
+    EXPECT_THROW(quiver::Database(path, {.console_level = quiver::LogLevel::off, .mapped = true}), std::runtime_error);
+}
+
 TEST_F(TempFileFixture, CurrentVersion) {
     quiver::Database db(":memory:", {.console_level = quiver::LogLevel::off});
     EXPECT_EQ(db.current_version(), 0);
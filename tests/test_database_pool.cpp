@@ -0,0 +1,135 @@
+#include "test_utils.h"
+
+#include <atomic>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <quiver/database.h>
+#include <quiver/database_pool.h>
+#include <quiver/element.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+class DatabasePoolFixture : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path = (fs::temp_directory_path() / "quiver_pool_test.db").string();
+        auto db =
+            quiver::Database::from_schema(path, VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+        for (int64_t i = 1; i <= 3; ++i) {
+            auto element = quiver::Element().set("label", "Config " + std::to_string(i)).set("integer_attribute", i);
+            db.create_element("Configuration", element);
+        }
+    }
+    void TearDown() override {
+        for (const auto& file : {path, path + "-wal", path + "-shm"}) {
+            if (fs::exists(file))
+                fs::remove(file);
+        }
+    }
+    quiver::DatabasePoolOptions quiet_options(size_t readers) const {
+        quiver::DatabasePoolOptions options;
+        options.readers = readers;
+        options.options.console_level = quiver::LogLevel::off;
+        return options;
+    }
+    std::string path;
+};
+
+TEST_F(DatabasePoolFixture, ReadersShareSchema) {
+    quiver::DatabasePool pool(path, quiet_options(2));
+    EXPECT_EQ(pool.reader_count(), 2u);
+    EXPECT_EQ(pool.idle_readers(), 2u);
+
+    auto labels = pool.read([](quiver::Database& db) { return db.read_scalar_strings("Configuration", "label"); });
+    EXPECT_EQ(labels, (std::vector<std::string>{"Config 1", "Config 2", "Config 3"}));
+
+    auto writer = pool.writer();
+    EXPECT_EQ(writer->query_string("PRAGMA journal_mode"), "wal");
+}
+
+TEST_F(DatabasePoolFixture, ReadersAreReadOnly) {
+    quiver::DatabasePool pool(path, quiet_options(1));
+    auto reader = pool.reader();
+    EXPECT_THROW(reader->create_element("Configuration", quiver::Element().set("label", std::string("Config 4"))),
+                 std::runtime_error);
+}
+
+TEST_F(DatabasePoolFixture, LeaseReturnsConnection) {
+    quiver::DatabasePool pool(path, quiet_options(2));
+    {
+        auto first = pool.reader();
+        auto second = pool.reader();
+        EXPECT_NE(&*first, &*second);
+        EXPECT_EQ(pool.idle_readers(), 0u);
+    }
+    EXPECT_EQ(pool.idle_readers(), 2u);
+}
+
+TEST_F(DatabasePoolFixture, WriterVisibleToReaders) {
+    quiver::DatabasePool pool(path, quiet_options(1));
+    pool.write([](quiver::Database& db) {
+        return db.create_element("Configuration", quiver::Element().set("label", std::string("Config 4")));
+    });
+    auto count = pool.read([](quiver::Database& db) { return db.query_integer("SELECT COUNT(*) FROM Configuration"); });
+    EXPECT_EQ(count, 4);
+}
+
+TEST_F(DatabasePoolFixture, ConcurrentReadsAndWrites) {
+    constexpr int kThreads = 4;
+    constexpr int kReadsPerThread = 50;
+    constexpr int kWrites = 20;
+    quiver::DatabasePool pool(path, quiet_options(kThreads));
+
+    std::atomic<int> failures{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&] {
+            int64_t last = 0;
+            for (int i = 0; i < kReadsPerThread; ++i) {
+                try {
+                    const auto count = pool.read([](quiver::Database& db) {
+                        return db.read_scalar_integers("Configuration", "integer_attribute").size();
+                    });
+                    // Every read sees a committed snapshot that never shrinks
+                    if (static_cast<int64_t>(count) < last) {
+                        ++failures;
+                    }
+                    last = static_cast<int64_t>(count);
+                } catch (const std::exception&) {
+                    ++failures;
+                }
+            }
+        });
+    }
+    threads.emplace_back([&] {
+        for (int i = 0; i < kWrites; ++i) {
+            try {
+                pool.write([i](quiver::Database& db) {
+                    return db.create_element("Configuration",
+                                             quiver::Element().set("label", "Extra " + std::to_string(i)));
+                });
+            } catch (const std::exception&) {
+                ++failures;
+            }
+        }
+    });
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(failures.load(), 0);
+    auto count = pool.read([](quiver::Database& db) { return db.query_integer("SELECT COUNT(*) FROM Configuration"); });
+    EXPECT_EQ(count, 3 + kWrites);
+}
+
+TEST_F(DatabasePoolFixture, InvalidOptions) {
+    EXPECT_THROW(quiver::DatabasePool(path, quiet_options(0)), std::runtime_error);
+    EXPECT_THROW(quiver::DatabasePool(":memory:", quiet_options(1)), std::runtime_error);
+
+    auto options = quiet_options(1);
+    options.options.read_only = true;
+    EXPECT_THROW(quiver::DatabasePool(path, options), std::runtime_error);
+}
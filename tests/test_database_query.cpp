@@ -1,8 +1,12 @@
 #include "test_utils.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <gtest/gtest.h>
 #include <quiver/database.h>
 #include <quiver/element.h>
+#include <thread>
 
 // ============================================================================
 // Query string tests
@@ -253,3 +257,493 @@ TEST(DatabaseQuery, QueryWithNullParam) {
     ASSERT_TRUE(result.has_value());
     EXPECT_EQ(*result, 1);
 }
+
+// ============================================================================
+// Statement cache tests
+// ============================================================================
+
+TEST(DatabaseQuery, StatementCacheReusesRepeatedQueries) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    auto before = db.statement_cache_stats();
+    for (int64_t i = 0; i < 5; ++i) {
+        auto result = db.query_integer("SELECT ? + 1", {i});
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(*result, i + 1);
+    }
+    auto after = db.statement_cache_stats();
+
+    EXPECT_EQ(after.misses - before.misses, 1);
+    EXPECT_EQ(after.hits - before.hits, 4);
+    EXPECT_EQ(after.capacity, 128u);
+}
+
+TEST(DatabaseQuery, StatementCacheRebindsParameters) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    db.create_element("Configuration", quiver::Element().set("label", "A").set("integer_attribute", int64_t{1}));
+    db.create_element("Configuration", quiver::Element().set("label", "B").set("integer_attribute", int64_t{2}));
+
+    const std::string sql = "SELECT integer_attribute FROM Configuration WHERE label = ?";
+    EXPECT_EQ(db.query_integer(sql, {std::string("A")}), 1);
+    EXPECT_EQ(db.query_integer(sql, {std::string("B")}), 2);
+    EXPECT_FALSE(db.query_integer(sql, {std::string("C")}).has_value());
+}
+
+TEST(DatabaseQuery, StatementCacheDisabled) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off, .statement_cache_size = 0});
+
+    db.query_integer("SELECT 1");
+    db.query_integer("SELECT 1");
+
+    auto stats = db.statement_cache_stats();
+    EXPECT_EQ(stats.hits, 0);
+    EXPECT_EQ(stats.size, 0u);
+    EXPECT_EQ(stats.capacity, 0u);
+}
+
+// ============================================================================
+// Operation and statement stats tests
+// ============================================================================
+
+TEST(DatabaseQuery, StatsCountOperationsAndStatements) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off, .collect_stats = true});
+    db.reset_stats();
+
+    for (int64_t i = 0; i < 3; ++i) {
+        db.create_element("Configuration", quiver::Element().set("label", "Config " + std::to_string(i)));
+    }
+    EXPECT_EQ(db.read_scalar_strings("Configuration", "label").size(), 3u);
+
+    const auto stats = db.stats();
+    auto find_operation = [&](const std::string& name) {
+        auto it = std::find_if(stats.operations.begin(), stats.operations.end(), [&](const auto& op) {
+            return op.name == name;
+        });
+        return it != stats.operations.end() ? *it : quiver::OperationStats{};
+    };
+    const auto create = find_operation("create_element");
+    EXPECT_EQ(create.calls, 3);
+    EXPECT_EQ(create.rows_written, 3);
+    EXPECT_GT(create.total_ns, 0);
+    EXPECT_GE(create.total_ns, create.max_ns);
+
+    const auto read = find_operation("read_scalar_strings");
+    EXPECT_EQ(read.calls, 1);
+    EXPECT_EQ(read.rows_read, 3);
+    EXPECT_EQ(read.rows_written, 0);
+
+    auto select = std::find_if(stats.statements.begin(), stats.statements.end(), [](const auto& statement) {
+        return statement.sql == "SELECT label FROM Configuration";
+    });
+    ASSERT_NE(select, stats.statements.end());
+    EXPECT_EQ(select->prepares, 1);
+    EXPECT_EQ(select->executions, 1);
+    EXPECT_EQ(select->rows_read, 3);
+
+    // Slowest first
+    for (size_t i = 1; i < stats.operations.size(); ++i) {
+        EXPECT_GE(stats.operations[i - 1].total_ns, stats.operations[i].total_ns);
+    }
+
+    db.reset_stats();
+    EXPECT_TRUE(db.stats().operations.empty());
+}
+
+TEST(DatabaseQuery, StatsOffByDefault) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Config")));
+
+    const auto stats = db.stats();
+    EXPECT_TRUE(stats.operations.empty());
+    EXPECT_TRUE(stats.statements.empty());
+    EXPECT_EQ(stats.statement_cache.capacity, 128u);
+}
+
+TEST(DatabaseQuery, StatementCacheEvictsLeastRecentlyUsed) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off, .statement_cache_size = 2});
+
+    db.query_integer("SELECT 1");
+    db.query_integer("SELECT 2");
+    db.query_integer("SELECT 3");
+    EXPECT_EQ(db.statement_cache_stats().size, 2u);
+
+    // "SELECT 1" was evicted, "SELECT 3" is still cached
+    auto before = db.statement_cache_stats();
+    db.query_integer("SELECT 3");
+    db.query_integer("SELECT 1");
+    auto after = db.statement_cache_stats();
+    EXPECT_EQ(after.hits - before.hits, 1);
+    EXPECT_EQ(after.misses - before.misses, 1);
+}
+
+TEST(DatabaseQuery, StatementCacheSurvivesFailedStep) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    db.create_element("Configuration", quiver::Element().set("label", "A"));
+
+    // Duplicate label violates the UNIQUE constraint; the cached INSERT must be usable afterwards
+    EXPECT_THROW(db.create_element("Configuration", quiver::Element().set("label", "A")), std::runtime_error);
+    EXPECT_EQ(db.create_element("Configuration", quiver::Element().set("label", "B")), 2);
+}
+
+// ============================================================================
+// Cursor tests
+// ============================================================================
+
+TEST(DatabaseQuery, CursorStreamsRows) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    for (int i = 0; i < 5; ++i) {
+        quiver::Element e;
+        e.set("label", "Config " + std::to_string(i)).set("integer_attribute", int64_t{i * 10});
+        db.create_element("Configuration", e);
+    }
+
+    auto cursor = db.cursor("SELECT label, integer_attribute FROM Configuration ORDER BY id");
+    ASSERT_EQ(cursor.column_count(), 2);
+    EXPECT_EQ(cursor.columns()[0], "label");
+    EXPECT_EQ(cursor.columns()[1], "integer_attribute");
+
+    int64_t count = 0;
+    while (cursor.next()) {
+        EXPECT_EQ(cursor.get_string(0).value(), "Config " + std::to_string(count));
+        EXPECT_EQ(cursor.get_integer(1).value(), count * 10);
+        ++count;
+    }
+    EXPECT_EQ(count, 5);
+    EXPECT_TRUE(cursor.done());
+    EXPECT_FALSE(cursor.next());
+}
+
+TEST(DatabaseQuery, CursorWithParamsAndNulls) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    quiver::Element e1;
+    e1.set("label", std::string("A")).set("float_attribute", 1.5);
+    db.create_element("Configuration", e1);
+
+    quiver::Element e2;
+    e2.set("label", std::string("B"));
+    db.create_element("Configuration", e2);
+
+    auto cursor = db.cursor("SELECT float_attribute FROM Configuration WHERE label = ?", {std::string("B")});
+    ASSERT_TRUE(cursor.next());
+    EXPECT_TRUE(cursor.is_null(0));
+    EXPECT_FALSE(cursor.get_float(0).has_value());
+    EXPECT_TRUE(std::holds_alternative<std::nullptr_t>(cursor.value(0)));
+    EXPECT_FALSE(cursor.next());
+}
+
+TEST(DatabaseQuery, CursorFetchBatches) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    for (int i = 0; i < 7; ++i) {
+        quiver::Element e;
+        e.set("label", "Config " + std::to_string(i));
+        db.create_element("Configuration", e);
+    }
+
+    auto cursor = db.cursor("SELECT id FROM Configuration ORDER BY id");
+    EXPECT_EQ(cursor.fetch(3).size(), 3);
+    EXPECT_EQ(cursor.fetch(3).size(), 3);
+    auto last = cursor.fetch(3);
+    ASSERT_EQ(last.size(), 1);
+    EXPECT_EQ(last[0].get_integer(0).value(), 7);
+    EXPECT_TRUE(cursor.fetch(3).empty());
+}
+
+TEST(DatabaseQuery, CursorAccessWithoutRowThrows) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    auto cursor = db.cursor("SELECT label FROM Configuration");
+    EXPECT_THROW(cursor.value(0), std::runtime_error);
+    EXPECT_FALSE(cursor.next());
+    EXPECT_THROW(cursor.get_string(0), std::runtime_error);
+}
+
+TEST(DatabaseQuery, CursorInvalidSqlThrows) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    EXPECT_THROW(db.cursor("SELECT nope FROM Missing"), std::runtime_error);
+}
+
+TEST(DatabaseQuery, CursorReadsBlobs) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("packed.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element(
+        "Collection",
+        quiver::Element().set("label", std::string("Item 1")).set("load", std::vector<double>{1.5, -2.0}));
+    const quiver::Blob expected{0, 0, 0, 0, 0, 0, 0xf8, 0x3f, 0, 0, 0, 0, 0, 0, 0, 0xc0};
+
+    auto cursor = db.cursor("SELECT load, price FROM Collection_vector_profiles");
+    ASSERT_TRUE(cursor.next());
+    EXPECT_EQ(cursor.get_blob(0).value(), expected);
+    EXPECT_FALSE(cursor.get_blob(1).has_value());
+    EXPECT_EQ(std::get<quiver::Blob>(cursor.value(0)), expected);
+    EXPECT_EQ(cursor.row().get_blob(0).value(), expected);
+    // As with any storage class mismatch, a BLOB read as another type is absent
+    EXPECT_FALSE(cursor.get_float(0).has_value());
+
+    // A Blob parameter binds as a BLOB, so a read value can be written back unchanged
+    EXPECT_EQ(db.query_integer("UPDATE Collection_vector_profiles SET price = ? RETURNING id", {expected}), 1);
+    EXPECT_EQ(db.read_vector_floats_by_id("Collection", "price", 1), (std::vector<double>{1.5, -2.0}));
+}
+
+TEST(DatabaseQuery, CursorScalarsAndVector) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", "Config"));
+    db.create_element("Collection", quiver::Element().set("label", "A").set("value_int", std::vector<int64_t>{1, 2}));
+    db.create_element("Collection", quiver::Element().set("label", "B").set("some_integer", int64_t{7}));
+    db.create_element("Collection", quiver::Element().set("label", "C").set("value_int", std::vector<int64_t>{3}));
+
+    auto scalars = db.cursor_scalars("Collection", {"label", "some_integer"});
+    ASSERT_EQ(scalars.column_count(), 3);
+    std::vector<std::string> labels;
+    while (scalars.next()) {
+        labels.push_back(scalars.get_string(1).value());
+        EXPECT_EQ(scalars.is_null(2), labels.back() != "B");
+    }
+    EXPECT_EQ(labels, (std::vector<std::string>{"A", "B", "C"}));
+
+    auto vector = db.cursor_vector("Collection", "value_int");
+    std::vector<std::pair<int64_t, int64_t>> values;
+    while (vector.next()) {
+        values.emplace_back(vector.get_integer(0).value(), vector.get_integer(2).value());
+    }
+    EXPECT_EQ(values, (std::vector<std::pair<int64_t, int64_t>>{{1, 1}, {1, 2}, {3, 3}}));
+
+    EXPECT_THROW(db.cursor_scalars("Missing", {"label"}), std::runtime_error);
+    EXPECT_THROW(db.cursor_vector("Collection", "missing"), std::runtime_error);
+}
+
+TEST(DatabaseQuery, CursorScalarsUnknownAttribute) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off, .collect_stats = true});
+    db.create_element("Configuration", quiver::Element().set("label", "Config"));
+    db.create_element("Collection", quiver::Element().set("label", "A"));
+
+    try {
+        db.cursor_scalars("Collection", {"label", "missing"});
+        ADD_FAILURE() << "Expected an unknown attribute to be rejected";
+    } catch (const std::runtime_error& e) {
+        EXPECT_STREQ(e.what(), "Scalar attribute 'missing' not found in collection 'Collection'");
+    }
+
+    // Names are checked against the schema, never spliced into SQL
+    EXPECT_THROW(db.cursor_scalars("Collection", {"label FROM Collection; --"}), std::runtime_error);
+
+    db.cursor_vector("Collection", "value_int");
+    const auto stats = db.stats();
+    for (const auto* name : {"cursor_scalars", "cursor_vector"}) {
+        EXPECT_TRUE(std::any_of(stats.operations.begin(), stats.operations.end(), [&](const auto& op) {
+            return op.name == name;
+        })) << name;
+    }
+}
+
+// ============================================================================
+// Timeout and interruption tests
+// ============================================================================
+
+namespace {
+
+// Never finishes on its own
+constexpr const char* kEndlessQuery =
+    "WITH RECURSIVE counter(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM counter) SELECT count(*) FROM counter";
+
+}  // namespace
+
+TEST(DatabaseQuery, StatementTimeoutAbortsLongQuery) {
+    auto db = quiver::Database::from_schema(
+        ":memory:",
+        VALID_SCHEMA("basic.sql"),
+        {.console_level = quiver::LogLevel::off, .statement_timeout = std::chrono::milliseconds(50)});
+    EXPECT_EQ(db.statement_timeout(), std::chrono::milliseconds(50));
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_THROW(db.query_integer(kEndlessQuery), std::runtime_error);
+    EXPECT_THROW(db.query_string(kEndlessQuery), std::runtime_error);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+
+    // The connection stays usable, and the next call gets a fresh deadline
+    EXPECT_EQ(db.query_integer("SELECT 42"), 42);
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Config")));
+
+    db.set_statement_timeout(std::nullopt);
+    EXPECT_FALSE(db.statement_timeout().has_value());
+    db.set_statement_timeout(std::chrono::milliseconds(20));
+    EXPECT_THROW(db.query_integer(kEndlessQuery), std::runtime_error);
+}
+
+TEST(DatabaseQuery, ProgressHandlerCanAbort) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    // A handler that never aborts leaves results unchanged
+    int64_t calls = 0;
+    db.set_progress_handler([&calls] {
+        ++calls;
+        return true;
+    });
+    EXPECT_EQ(db.query_integer("WITH RECURSIVE counter(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM counter "
+                               "LIMIT 100000) SELECT count(*) FROM counter"),
+              100000);
+    EXPECT_GT(calls, 0);
+
+    calls = 0;
+    db.set_progress_handler([&calls] { return ++calls < 3; });
+    EXPECT_THROW(db.query_integer(kEndlessQuery), std::runtime_error);
+    EXPECT_EQ(calls, 3);
+
+    db.set_progress_handler(nullptr);
+    EXPECT_EQ(db.query_integer("SELECT 1"), 1);
+}
+
+TEST(DatabaseQuery, InterruptFromAnotherThread) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    // Interrupting before the query starts is a no-op, so keep trying until it has failed
+    std::atomic<bool> finished{false};
+    std::thread interrupter([&db, &finished] {
+        while (!finished) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            db.interrupt();
+        }
+    });
+    try {
+        db.query_integer(kEndlessQuery);
+        ADD_FAILURE() << "Expected the query to be interrupted";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find("interrupted"), std::string::npos) << e.what();
+    }
+    finished = true;
+    interrupter.join();
+
+    EXPECT_EQ(db.query_integer("SELECT 1"), 1);
+}
+
+// ============================================================================
+// Vector SQL function tests
+// ============================================================================
+
+TEST(DatabaseQuery, VectorFunctionsComputeInsideSqlite) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+    const auto id1 = db.create_element("Collection",
+                                       quiver::Element()
+                                           .set("label", std::string("Item 1"))
+                                           .set("value_int", std::vector<int64_t>{1, 2, 3})
+                                           .set("value_float", std::vector<double>{1.0, 2.0, 3.0}));
+    const auto id2 = db.create_element(
+        "Collection",
+        quiver::Element().set("label", std::string("Item 2")).set("value_float", std::vector<double>{4.0, 5.0, 6.0}));
+    const auto id3 = db.create_element("Collection", quiver::Element().set("label", std::string("Item 3")));
+
+    EXPECT_EQ(db.query_float("SELECT quiver_vector_dot(quiver_vector('Collection', 'value_float', ?), "
+                             "quiver_vector('Collection', 'value_float', ?))",
+                             {id1, id2}),
+              32.0);
+    EXPECT_EQ(db.query_integer("SELECT quiver_vector_length(quiver_vector('Collection', 'value_int', ?))", {id1}), 3);
+    // An element without a vector reads as NULL
+    EXPECT_EQ(db.query_integer("SELECT quiver_vector_length(quiver_vector('Collection', 'value_float', ?))", {id3}),
+              0);
+    EXPECT_FALSE(db.query_float("SELECT quiver_vector_dot(quiver_vector('Collection', 'value_float', ?), "
+                                "quiver_vector('Collection', 'value_float', ?))",
+                                {id1, id3})
+                     .has_value());
+
+    const std::string sum =
+        "(SELECT quiver_vector_sum(quiver_vector('Collection', 'value_float', id)) FROM Collection)";
+    EXPECT_EQ(db.query_integer("SELECT quiver_vector_length(" + sum + ")"), 3);
+    EXPECT_EQ(db.query_float("SELECT value FROM quiver_unpack(" + sum + ") WHERE vector_index = 3"), 9.0);
+
+    EXPECT_EQ(db.query_float("SELECT quiver_vector_dot(quiver_pack(value_float), quiver_vector('Collection', "
+                             "'value_float', ?)) FROM (SELECT value_float FROM Collection_vector_values WHERE id = ? "
+                             "ORDER BY vector_index)",
+                             {id1, id2}),
+              32.0);
+}
+
+TEST(DatabaseQuery, VectorFunctionsReadPackedVectors) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("packed.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+    const auto id = db.create_element(
+        "Collection", quiver::Element().set("label", std::string("Item 1")).set("load", std::vector<double>{1.5, 2.5}));
+
+    EXPECT_EQ(db.query_float("SELECT quiver_vector_dot(quiver_vector('Collection', 'load', ?), load) "
+                             "FROM Collection_vector_profiles WHERE id = ?",
+                             {id, id}),
+              1.5 * 1.5 + 2.5 * 2.5);
+    EXPECT_EQ(db.query_float("SELECT value FROM quiver_unpack((SELECT quiver_vector_sum(load) "
+                             "FROM Collection_vector_profiles)) WHERE vector_index = 2"),
+              2.5);
+}
+
+TEST(DatabaseQuery, VectorFunctionsKeepNullEntries) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+    const auto id = db.create_element(
+        "Collection",
+        quiver::Element().set("label", std::string("Item 1")).set("value_float", std::vector<double>{1.0, 2.0, 3.0}));
+    EXPECT_EQ(db.query_integer("UPDATE Collection_vector_values SET value_float = NULL WHERE id = ? "
+                               "AND vector_index = (SELECT MIN(vector_index) + 1 FROM Collection_vector_values) "
+                               "RETURNING id",
+                               {id}),
+              id);
+
+    // The NULL entry is packed as NaN in its place instead of shifting the entries after it; SQLite turns the NaN
+    // back into NULL when quiver_unpack returns it
+    const std::string vector = "quiver_vector('Collection', 'value_float', " + std::to_string(id) + ")";
+    EXPECT_EQ(db.query_integer("SELECT quiver_vector_length(" + vector + ")"), 3);
+    EXPECT_FALSE(
+        db.query_float("SELECT value FROM quiver_unpack(" + vector + ") WHERE vector_index = 2").has_value());
+    EXPECT_EQ(db.query_float("SELECT value FROM quiver_unpack(" + vector + ") WHERE vector_index = 3"), 3.0);
+
+    // quiver_pack agrees with quiver_vector
+    EXPECT_EQ(db.query_integer("SELECT quiver_vector_length(quiver_pack(value_float)) FROM (SELECT value_float "
+                               "FROM Collection_vector_values WHERE id = ? ORDER BY vector_index)",
+                               {id}),
+              3);
+}
+
+TEST(DatabaseQuery, VectorFunctionsRejectBadArguments) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+    db.create_element(
+        "Collection",
+        quiver::Element().set("label", std::string("Item 1")).set("value_float", std::vector<double>{1.0, 2.0}));
+    db.create_element(
+        "Collection",
+        quiver::Element().set("label", std::string("Item 2")).set("value_float", std::vector<double>{1.0}));
+
+    EXPECT_THROW(db.query_float("SELECT quiver_vector_dot(quiver_vector('Collection', 'value_float', 1), "
+                                "quiver_vector('Collection', 'value_float', 2))"),
+                 std::runtime_error);
+    EXPECT_THROW(db.query_integer("SELECT quiver_vector_length(quiver_vector_sum("
+                                  "quiver_vector('Collection', 'value_float', id))) FROM Collection"),
+                 std::runtime_error);
+    EXPECT_THROW(db.query_integer("SELECT quiver_vector_length(quiver_vector('Collection', 'missing', 1))"),
+                 std::runtime_error);
+    EXPECT_THROW(db.query_float("SELECT quiver_vector_dot('text', 'text')"), std::runtime_error);
+    EXPECT_THROW(db.query_integer("SELECT quiver_vector_length(quiver_pack(label)) FROM Collection"),
+                 std::runtime_error);
+}
@@ -1,6 +1,11 @@
 #include "test_utils.h"
 
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdio>
 #include <gtest/gtest.h>
+#include <limits>
 #include <quiver/attribute_type.h>
 #include <quiver/database.h>
 #include <quiver/element.h>
@@ -81,6 +86,124 @@ TEST(Database, ReadScalarEmpty) {
     EXPECT_TRUE(strings.empty());
 }
 
+TEST(Database, ReadScalarIntoBuffer) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    for (int i = 0; i < 3; ++i) {
+        quiver::Element e;
+        e.set("label", "Config " + std::to_string(i)).set("integer_attribute", int64_t{i + 1});
+        if (i != 1) {
+            e.set("float_attribute", i * 0.5);
+        }
+        db.create_element("Configuration", e);
+    }
+
+    EXPECT_EQ(db.count_scalar_values("Configuration", "integer_attribute"), 3);
+    std::vector<int64_t> integers(db.count_scalar_values("Configuration", "integer_attribute"));
+    EXPECT_EQ(db.read_scalar_integers_into("Configuration", "integer_attribute", integers), 3);
+    EXPECT_EQ(integers, (std::vector<int64_t>{1, 2, 3}));
+
+    // Nulls are skipped, matching read_scalar_floats
+    EXPECT_EQ(db.count_scalar_values("Configuration", "float_attribute"), 2);
+    std::vector<double> floats(2);
+    EXPECT_EQ(db.read_scalar_floats_into("Configuration", "float_attribute", floats), 2);
+    EXPECT_EQ(floats, db.read_scalar_floats("Configuration", "float_attribute"));
+
+    // A short buffer is filled and the full count is still reported
+    std::vector<int64_t> small(2, -1);
+    EXPECT_EQ(db.read_scalar_integers_into("Configuration", "integer_attribute", small), 3);
+    EXPECT_EQ(small, (std::vector<int64_t>{1, 2}));
+}
+
+TEST(Database, ReadScalarNullableAlignedWithIds) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    // Ten elements so the bitmap spans two bytes; every third one has no float or string
+    for (int i = 0; i < 10; ++i) {
+        quiver::Element e;
+        e.set("label", "Config " + std::to_string(i));
+        if (i % 3 != 0) {
+            e.set("float_attribute", i * 1.5).set("string_attribute", "s" + std::to_string(i));
+        }
+        db.create_element("Configuration", e);
+    }
+
+    auto ids = db.read_element_ids("Configuration");
+    auto floats = db.read_scalar_floats_nullable("Configuration", "float_attribute");
+    auto strings = db.read_scalar_strings_nullable("Configuration", "string_attribute");
+    auto integers = db.read_scalar_integers_nullable("Configuration", "boolean_attribute");
+    ASSERT_EQ(floats.size(), ids.size());
+    ASSERT_EQ(strings.size(), ids.size());
+    EXPECT_EQ(floats.validity.size(), 2);
+    EXPECT_EQ(floats.null_count(), 4);
+    EXPECT_EQ(integers.null_count(), 10);
+
+    for (size_t i = 0; i < ids.size(); ++i) {
+        const auto valid = i % 3 != 0;
+        EXPECT_EQ(floats.is_valid(i), valid);
+        EXPECT_EQ(strings.is_valid(i), valid);
+        EXPECT_EQ(floats.values[i], valid ? i * 1.5 : 0.0);
+        EXPECT_EQ(strings.values[i], valid ? "s" + std::to_string(i) : "");
+        if (valid) {
+            EXPECT_EQ(db.read_scalar_floats_by_id("Configuration", "float_attribute", ids[i]), floats.values[i]);
+        }
+    }
+}
+
+TEST(Database, ReadScalarsColumns) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    quiver::Element e1;
+    e1.set("label", std::string("Config 1")).set("integer_attribute", int64_t{7}).set("float_attribute", 1.5);
+    auto id1 = db.create_element("Configuration", e1);
+
+    quiver::Element e2;
+    e2.set("label", std::string("Config 2")).set("string_attribute", std::string("hello"));
+    auto id2 = db.create_element("Configuration", e2);
+
+    auto columns = db.read_scalars("Configuration", {"float_attribute", "integer_attribute", "string_attribute"});
+    EXPECT_EQ(columns.ids, db.read_element_ids("Configuration"));
+    EXPECT_EQ(columns.ids, (std::vector<int64_t>{id1, id2}));
+    ASSERT_EQ(columns.columns.size(), 3);
+
+    const auto& floats = columns.column("float_attribute");
+    EXPECT_EQ(floats.type, quiver::DataType::Real);
+    EXPECT_EQ(floats.size(), 2);
+    EXPECT_DOUBLE_EQ(floats.floats[0], 1.5);
+    EXPECT_FALSE(floats.is_null(0));
+    EXPECT_TRUE(floats.is_null(1));
+
+    // Column default applies to the second element
+    const auto& integers = columns.columns[1];
+    EXPECT_EQ(integers.name, "integer_attribute");
+    EXPECT_EQ(integers.integers, (std::vector<int64_t>{7, 6}));
+    EXPECT_EQ(integers.nulls, (std::vector<uint8_t>{0, 0}));
+
+    const auto& strings = columns.column("string_attribute");
+    EXPECT_EQ(strings.type, quiver::DataType::Text);
+    EXPECT_EQ(strings.strings[1], "hello");
+    EXPECT_EQ(strings.nulls, (std::vector<uint8_t>{1, 0}));
+    EXPECT_TRUE(floats.integers.empty() && floats.strings.empty());
+
+    EXPECT_THROW(columns.column("label"), std::runtime_error);
+    EXPECT_THROW(db.read_scalars("Configuration", {"missing"}), std::runtime_error);
+    EXPECT_THROW(db.read_scalars("Missing", {"label"}), std::runtime_error);
+}
+
+TEST(Database, ReadScalarsEmpty) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    auto columns = db.read_scalars("Collection", {"label", "some_integer"});
+    EXPECT_EQ(columns.size(), 0);
+    ASSERT_EQ(columns.columns.size(), 2);
+    EXPECT_TRUE(columns.columns[0].strings.empty());
+    EXPECT_EQ(columns.columns[1].size(), 0);
+}
+
 // ============================================================================
 // Read vector tests
 // ============================================================================
@@ -175,6 +298,55 @@ TEST(Database, ReadVectorOnlyReturnsElementsWithData) {
     EXPECT_EQ(vectors[1], (std::vector<int64_t>{4, 5}));
 }
 
+TEST(Database, ReadVectorIntegersFlat) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+
+    quiver::Element e1;
+    e1.set("label", std::string("Item 1")).set("value_int", std::vector<int64_t>{1, 2, 3});
+    db.create_element("Collection", e1);
+
+    quiver::Element e2;
+    e2.set("label", std::string("Item 2"));
+    db.create_element("Collection", e2);
+
+    quiver::Element e3;
+    e3.set("label", std::string("Item 3")).set("value_int", std::vector<int64_t>{4, 5});
+    db.create_element("Collection", e3);
+
+    auto flat = db.read_vector_integers_flat("Collection", "value_int");
+    ASSERT_EQ(flat.size(), 2);
+    EXPECT_EQ(flat.values, (std::vector<int64_t>{1, 2, 3, 4, 5}));
+    EXPECT_EQ(flat.offsets, (std::vector<size_t>{0, 3, 5}));
+    EXPECT_EQ(flat.size(1), 2);
+    EXPECT_EQ(flat[1][0], 4);
+
+    // Same grouping as the nested read
+    auto nested = db.read_vector_integers("Collection", "value_int");
+    ASSERT_EQ(nested.size(), flat.size());
+    for (size_t i = 0; i < nested.size(); ++i) {
+        EXPECT_EQ(nested[i], (std::vector<int64_t>(flat[i].begin(), flat[i].end())));
+    }
+}
+
+TEST(Database, ReadVectorFlatEmpty) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+
+    auto flat = db.read_vector_floats_flat("Collection", "value_float");
+    EXPECT_TRUE(flat.empty());
+    EXPECT_TRUE(flat.values.empty());
+    EXPECT_EQ(flat.offsets, (std::vector<size_t>{0}));
+}
+
 // ============================================================================
 // Read set tests
 // ============================================================================
@@ -247,6 +419,64 @@ TEST(Database, ReadSetOnlyReturnsElementsWithData) {
     EXPECT_EQ(sets.size(), 2);
 }
 
+TEST(Database, ReadSetStringsFlat) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+
+    quiver::Element e1;
+    e1.set("label", std::string("Item 1")).set("tag", std::vector<std::string>{"important", "urgent"});
+    db.create_element("Collection", e1);
+
+    quiver::Element e2;
+    e2.set("label", std::string("Item 2")).set("tag", std::vector<std::string>{"review"});
+    db.create_element("Collection", e2);
+
+    auto flat = db.read_set_strings_flat("Collection", "tag");
+    ASSERT_EQ(flat.size(), 2);
+    EXPECT_EQ(flat.offsets, (std::vector<size_t>{0, 2, 3}));
+    std::vector<std::string> set1(flat[0].begin(), flat[0].end());
+    std::sort(set1.begin(), set1.end());
+    EXPECT_EQ(set1, (std::vector<std::string>{"important", "urgent"}));
+    EXPECT_EQ(flat[1][0], "review");
+}
+
+TEST(Database, ReadStringsIntoArena) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+    for (int i = 1; i <= 3; ++i) {
+        quiver::Element e;
+        e.set("label", "Item " + std::to_string(i))
+            .set("tag", std::vector<std::string>{"shared", "tag " + std::to_string(i)});
+        db.create_element("Collection", e);
+    }
+
+    const auto labels = db.read_scalar_strings_arena("Collection", "label");
+    EXPECT_EQ(labels.to_vector(), db.read_scalar_strings("Collection", "label"));
+    EXPECT_EQ(labels[2], "Item 3");
+    EXPECT_STREQ(labels.c_str(0), "Item 1");
+
+    const auto plain = db.read_set_strings_arena("Collection", "tag");
+    const auto interned = db.read_set_strings_arena("Collection", "tag", true);
+    EXPECT_EQ(interned.offsets, (std::vector<size_t>{0, 2, 4, 6}));
+    EXPECT_EQ(interned.values.to_vector(), plain.values.to_vector());
+
+    // "shared" is stored once and every group points at it
+    std::vector<size_t> shared_starts;
+    for (size_t i = 0; i < interned.values.size(); ++i) {
+        if (interned.values[i] == "shared") {
+            shared_starts.push_back(interned.values.start(i));
+        }
+    }
+    ASSERT_EQ(shared_starts.size(), 3u);
+    EXPECT_EQ(shared_starts[0], shared_starts[2]);
+    EXPECT_EQ(plain.values.buffer().size() - interned.values.buffer().size(), 2 * std::string("shared").size() + 2);
+}
+
 // ============================================================================
 // Read scalar by ID tests
 // ============================================================================
@@ -438,6 +668,86 @@ TEST(Database, ReadSetByIdEmpty) {
     EXPECT_TRUE(set.empty());
 }
 
+// ============================================================================
+// Read by IDs (batch) tests
+// ============================================================================
+
+TEST(Database, ReadScalarByIdsInputOrder) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+    auto id1 = db.create_element("Collection", quiver::Element().set("label", std::string("Item 1")).set("some_float", 1.5));
+    auto id2 = db.create_element("Collection", quiver::Element().set("label", std::string("Item 2")));
+    auto id3 = db.create_element("Collection", quiver::Element().set("label", std::string("Item 3")).set("some_float", 3.5));
+
+    // Reversed, with a repeat and an unknown id
+    std::vector<int64_t> ids = {id3, 999, id2, id1, id3};
+    auto floats = db.read_scalar_floats_by_ids("Collection", "some_float", ids);
+    ASSERT_EQ(floats.size(), 5);
+    EXPECT_DOUBLE_EQ(floats.values[0], 3.5);
+    EXPECT_FALSE(floats.is_valid(1));
+    EXPECT_FALSE(floats.is_valid(2));
+    EXPECT_DOUBLE_EQ(floats.values[3], 1.5);
+    EXPECT_DOUBLE_EQ(floats.values[4], 3.5);
+    EXPECT_EQ(floats.null_count(), 2);
+
+    auto labels = db.read_scalar_strings_by_ids("Collection", "label", ids);
+    EXPECT_EQ(labels.values, (std::vector<std::string>{"Item 3", "", "Item 2", "Item 1", "Item 3"}));
+
+    EXPECT_TRUE(db.read_scalar_integers_by_ids("Collection", "some_integer", {}).empty());
+    EXPECT_THROW(db.read_scalar_integers_by_ids("Collection", "missing", ids), std::runtime_error);
+}
+
+TEST(Database, ReadScalarByIdsManyChunks) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+    std::vector<int64_t> ids;
+    for (int64_t i = 0; i < 1200; ++i) {
+        ids.push_back(db.create_element(
+            "Collection", quiver::Element().set("label", "Item " + std::to_string(i)).set("some_integer", i * 2)));
+    }
+    std::reverse(ids.begin(), ids.end());
+
+    auto integers = db.read_scalar_integers_by_ids("Collection", "some_integer", ids);
+    ASSERT_EQ(integers.size(), ids.size());
+    EXPECT_EQ(integers.null_count(), 0);
+    for (size_t i = 0; i < ids.size(); ++i) {
+        EXPECT_EQ(integers.values[i], *db.read_scalar_integers_by_id("Collection", "some_integer", ids[i]));
+    }
+}
+
+TEST(Database, ReadVectorAndSetByIds) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+
+    quiver::Element e1;
+    e1.set("label", std::string("Item 1")).set("value_int", std::vector<int64_t>{1, 2, 3});
+    e1.set("tag", std::vector<std::string>{"a", "b"});
+    auto id1 = db.create_element("Collection", e1);
+
+    quiver::Element e2;
+    e2.set("label", std::string("Item 2")).set("value_int", std::vector<int64_t>{10, 20});
+    auto id2 = db.create_element("Collection", e2);
+
+    auto vectors = db.read_vector_integers_by_ids("Collection", "value_int", std::vector<int64_t>{id2, 999, id1});
+    ASSERT_EQ(vectors.size(), 3);
+    EXPECT_EQ(std::vector<int64_t>(vectors[0].begin(), vectors[0].end()), (std::vector<int64_t>{10, 20}));
+    EXPECT_TRUE(vectors[1].empty());
+    EXPECT_EQ(std::vector<int64_t>(vectors[2].begin(), vectors[2].end()), (std::vector<int64_t>{1, 2, 3}));
+
+    auto sets = db.read_set_strings_by_ids("Collection", "tag", std::vector<int64_t>{id2, id1});
+    ASSERT_EQ(sets.size(), 2);
+    EXPECT_EQ(sets.size(0), 0);
+    auto tags = std::vector<std::string>(sets[1].begin(), sets[1].end());
+    std::sort(tags.begin(), tags.end());
+    EXPECT_EQ(tags, (std::vector<std::string>{"a", "b"}));
+}
+
 // ============================================================================
 // Read element IDs tests
 // ============================================================================
@@ -649,3 +959,656 @@ TEST(Database, DatetimeMetadataType) {
     auto metadata = db.get_scalar_metadata("Configuration", "date_attribute");
     EXPECT_EQ(metadata.data_type, quiver::DataType::DateTime);
 }
+
+TEST(Database, ReadScalarsManyElements) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    std::vector<quiver::Element> elements(1000);
+    for (size_t i = 0; i < elements.size(); ++i) {
+        elements[i]
+            .set("label", "Config " + std::to_string(i))
+            .set("integer_attribute", static_cast<int64_t>(i))
+            .set("string_attribute", "value " + std::to_string(i));
+        if (i % 2 == 0) {
+            elements[i].set("float_attribute", static_cast<double>(i) * 0.5);
+        }
+    }
+    db.create_elements("Configuration", elements);
+
+    auto integers = db.read_scalar_integers("Configuration", "integer_attribute");
+    ASSERT_EQ(integers.size(), 1000u);
+    EXPECT_EQ(integers[999], 999);
+
+    // Elements without a value are skipped
+    auto floats = db.read_scalar_floats("Configuration", "float_attribute");
+    ASSERT_EQ(floats.size(), 500u);
+    EXPECT_DOUBLE_EQ(floats[1], 1.0);
+
+    auto strings = db.read_scalar_strings("Configuration", "string_attribute");
+    ASSERT_EQ(strings.size(), 1000u);
+    EXPECT_EQ(strings[42], "value 42");
+}
+
+// ============================================================================
+// Time series tests
+// ============================================================================
+
+TEST(Database, ReadTimeSeriesFloatsRange) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+
+    quiver::Element e1;
+    e1.set("label", std::string("Item 1"));
+    int64_t id1 = db.create_element("Collection", e1);
+
+    quiver::Element e2;
+    e2.set("label", std::string("Item 2"));
+    int64_t id2 = db.create_element("Collection", e2);
+
+    db.update_time_series_floats("Collection",
+                                 "value",
+                                 id1,
+                                 {"2024-03-01 00:00:00", "2024-01-01 00:00:00", "2024-02-01 00:00:00"},
+                                 {3.0, 1.0, 2.0});
+    db.update_time_series_floats("Collection", "value", id2, {"2024-01-01 00:00:00"}, {10.0});
+
+    // Ordered by date_time, only the requested element
+    auto all = db.read_time_series_floats("Collection", "value", id1);
+    EXPECT_EQ(all.date_times,
+              (std::vector<std::string>{"2024-01-01 00:00:00", "2024-02-01 00:00:00", "2024-03-01 00:00:00"}));
+    EXPECT_EQ(all.values, (std::vector<double>{1.0, 2.0, 3.0}));
+
+    // Inclusive bounds
+    auto range = db.read_time_series_floats("Collection", "value", id1, "2024-02-01 00:00:00", "2024-03-01 00:00:00");
+    EXPECT_EQ(range.values, (std::vector<double>{2.0, 3.0}));
+
+    auto from = db.read_time_series_floats("Collection", "value", id1, "2024-01-15 00:00:00");
+    EXPECT_EQ(from.size(), 2);
+
+    auto to = db.read_time_series_floats("Collection", "value", id1, std::nullopt, "2024-01-15 00:00:00");
+    EXPECT_EQ(to.values, (std::vector<double>{1.0}));
+
+    EXPECT_TRUE(db.read_time_series_floats("Collection", "value", 999).empty());
+}
+
+TEST(Database, ReadTimeSeriesFloatsMissingIsNan) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+
+    quiver::Element e;
+    e.set("label", std::string("Item 1"));
+    int64_t id = db.create_element("Collection", e);
+
+    db.update_time_series_floats("Collection",
+                                 "value",
+                                 id,
+                                 {"2024-01-01 00:00:00", "2024-01-02 00:00:00"},
+                                 {1.0, std::numeric_limits<double>::quiet_NaN()});
+
+    auto series = db.read_time_series_floats("Collection", "value", id);
+    ASSERT_EQ(series.size(), 2);
+    EXPECT_EQ(series.date_times.size(), 2);
+    EXPECT_DOUBLE_EQ(series.values[0], 1.0);
+    EXPECT_TRUE(std::isnan(series.values[1]));
+}
+
+TEST(Database, ReadTimeSeriesFloatsInvalidAttribute) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    EXPECT_THROW(db.read_time_series_floats("Collection", "nonexistent", 1), std::runtime_error);
+    EXPECT_THROW(db.read_time_series_floats("Collection", "data", 1), std::runtime_error);
+    EXPECT_THROW(db.read_time_series_floats("Collection", "collection_id", 1), std::runtime_error);
+    EXPECT_THROW(db.read_time_series_floats("Nonexistent", "value", 1), std::runtime_error);
+}
+
+TEST(Database, ReadCompressedTimeSeries) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("compressed.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+    const auto id = db.create_element("Plant", quiver::Element().set("label", std::string("Plant 1")));
+
+    // Hourly samples over three chunks, written newest first; values are not all compressible
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<std::string> date_times;
+    std::vector<double> values;
+    const int month_days[] = {31, 29, 31, 30};
+    for (int hour = 2499; hour >= 0; --hour) {
+        int month = 0;
+        int day = hour / 24;
+        while (day >= month_days[month]) {
+            day -= month_days[month++];
+        }
+        char text[20];
+        std::snprintf(text, sizeof(text), "2024-%02d-%02d %02d:00:00", month + 1, day + 1, hour % 24);
+        date_times.emplace_back(text);
+        values.push_back(hour == 7 ? nan : hour % 5 == 0 ? 1.0 / (hour + 1) : 100.0);
+    }
+    values[0] = -0.0;
+    db.update_time_series_floats("Plant", "power", id, date_times, values);
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Plant_time_series_generation"), 3);
+    // Evenly spaced timestamps: a zero delta-of-delta, one byte each
+    EXPECT_LT(db.query_integer("SELECT SUM(length(date_time)) FROM Plant_time_series_generation"), 2600);
+
+    const auto series = db.read_time_series_floats("Plant", "power", id);
+    ASSERT_EQ(series.size(), 2500u);
+    EXPECT_EQ(series.date_times.front(), "2024-01-01 00:00:00");
+    EXPECT_EQ(series.date_times.back(), date_times.front());
+    EXPECT_TRUE(std::is_sorted(series.date_times.begin(), series.date_times.end()));
+    for (size_t i = 0; i < series.size(); ++i) {
+        const auto& expected = values[values.size() - 1 - i];
+        if (std::isnan(expected)) {
+            EXPECT_TRUE(std::isnan(series.values[i]));
+        } else {
+            EXPECT_EQ(std::bit_cast<uint64_t>(series.values[i]), std::bit_cast<uint64_t>(expected));
+        }
+    }
+
+    // Ranges cut across chunk boundaries (the second chunk starts at hour 1024, 2024-02-12 16:00)
+    const auto range = db.read_time_series_floats("Plant", "power", id, "2024-02-12 14:00:00", "2024-02-12 17:30");
+    EXPECT_EQ(range.date_times,
+              (std::vector<std::string>{
+                  "2024-02-12 14:00:00", "2024-02-12 15:00:00", "2024-02-12 16:00:00", "2024-02-12 17:00:00"}));
+    EXPECT_TRUE(db.read_time_series_floats("Plant", "power", id, "2025-01-01").empty());
+
+    // SQL sees the decoded samples, NaN as NULL
+    const auto daily = db.aggregate_time_series(
+        "Plant", "power", quiver::TimeBucket::day, {quiver::Aggregate::count, quiver::Aggregate::max});
+    EXPECT_EQ(daily.buckets.front(), "2024-01-01");
+    EXPECT_EQ(daily.column(quiver::Aggregate::count).front(), 23.0);
+    EXPECT_EQ(daily.column(quiver::Aggregate::max).front(), 100.0);
+
+    EXPECT_THROW(db.read_time_series_floats("Plant", "chunk_start", id), std::runtime_error);
+    EXPECT_THROW(db.read_time_series_floats("Plant", "power", id, "2024-02-30"), std::runtime_error);
+    EXPECT_THROW(db.update_time_series_floats(
+                     "Plant", "power", id, {"2024-01-01 00:00:00", "2024-01-01T00:00:00"}, {1.0, 2.0}),
+                 std::runtime_error);
+    EXPECT_THROW(db.update_time_series_floats("Plant", "power", id, {"January 1st"}, {1.0}), std::runtime_error);
+    EXPECT_EQ(db.read_time_series_floats("Plant", "power", id).size(), 2500u);
+
+    db.update_time_series_floats("Plant", "power", id, {}, {});
+    EXPECT_TRUE(db.read_time_series_floats("Plant", "power", id).empty());
+}
+
+// ============================================================================
+// Attribute handle tests
+// ============================================================================
+
+TEST(Database, ReadByAttributeHandle) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    auto id = db.create_element("Collection",
+                                quiver::Element()
+                                    .set("label", std::string("Item 1"))
+                                    .set("some_integer", int64_t{7})
+                                    .set("some_float", 1.5)
+                                    .set("value_int", std::vector<int64_t>{1, 2, 3}));
+
+    const auto integer = db.attribute_handle("Collection", "some_integer");
+    EXPECT_EQ(integer.collection(), "Collection");
+    EXPECT_EQ(integer.data_structure(), quiver::DataStructure::Scalar);
+    EXPECT_EQ(integer.data_type(), quiver::DataType::Integer);
+    EXPECT_EQ(db.read_scalar_integers_by_id(integer, id), 7);
+    EXPECT_EQ(db.read_scalar_integers_by_id(integer, id + 1), std::nullopt);
+    EXPECT_EQ(db.read_scalar_integers(integer), (std::vector<int64_t>{7}));
+
+    EXPECT_EQ(db.read_scalar_floats_by_id(db.attribute_handle("Collection", "some_float"), id), 1.5);
+    EXPECT_EQ(db.read_scalar_strings_by_id(db.attribute_handle("Collection", "label"), id), "Item 1");
+
+    const auto vector = db.attribute_handle("Collection", "value_int");
+    EXPECT_EQ(vector.data_structure(), quiver::DataStructure::Vector);
+    EXPECT_EQ(db.read_vector_integers_by_id(vector, id), (std::vector<int64_t>{1, 2, 3}));
+}
+
+TEST(Database, ReadTypedAccessors) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    auto id = db.create_element("Collection",
+                                quiver::Element()
+                                    .set("label", std::string("Item 1"))
+                                    .set("some_integer", int64_t{7})
+                                    .set("some_float", 1.5)
+                                    .set("value_int", std::vector<int64_t>{1, 2, 3})
+                                    .set("tag", std::vector<std::string>{"important"}));
+
+    EXPECT_EQ(db.read_scalar<int64_t>("Collection", "some_integer"), (std::vector<int64_t>{7}));
+    EXPECT_EQ(db.read_scalar<double>("Collection", "some_float"), (std::vector<double>{1.5}));
+    EXPECT_EQ(db.read_scalar<std::string>("Collection", "label"), (std::vector<std::string>{"Item 1"}));
+    EXPECT_EQ(db.read_scalar_by_id<int64_t>("Collection", "some_integer", id), 7);
+    EXPECT_EQ(db.read_scalar_by_id<int64_t>("Collection", "some_integer", id + 1), std::nullopt);
+    // A stored value of another type reads as null, like the named functions
+    EXPECT_EQ(db.read_scalar_by_id<double>("Collection", "some_integer", id), std::nullopt);
+
+    EXPECT_EQ(db.read_vector<int64_t>("Collection", "value_int"), (std::vector<std::vector<int64_t>>{{1, 2, 3}}));
+    EXPECT_EQ(db.read_vector_by_id<int64_t>("Collection", "value_int", id), (std::vector<int64_t>{1, 2, 3}));
+    EXPECT_EQ(db.read_set<std::string>("Collection", "tag"), (std::vector<std::vector<std::string>>{{"important"}}));
+    EXPECT_EQ(db.read_set_by_id<std::string>("Collection", "tag", id), (std::vector<std::string>{"important"}));
+}
+
+TEST(Database, AttributeHandleErrors) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    EXPECT_THROW(db.attribute_handle("Collection", "missing"), std::runtime_error);
+    EXPECT_THROW(db.attribute_handle("Missing", "some_integer"), std::runtime_error);
+
+    // Reading a handle as another structure or type is rejected before touching the database
+    const auto integer = db.attribute_handle("Collection", "some_integer");
+    EXPECT_THROW(db.read_scalar_floats_by_id(integer, 1), std::runtime_error);
+    EXPECT_THROW(db.read_vector_integers_by_id(integer, 1), std::runtime_error);
+    EXPECT_THROW(db.update_scalar_string(integer, 1, "x"), std::runtime_error);
+}
+
+// ============================================================================
+// Whole element read tests
+// ============================================================================
+
+TEST(Database, ReadElementRoundTrips) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+
+    quiver::Element e;
+    e.set("label", std::string("Item 1"))
+        .set("some_integer", int64_t{7})
+        .set("value_int", std::vector<int64_t>{1, 2, 3})
+        .set("value_float", std::vector<double>{0.5, 1.5, 2.5})
+        .set("tag", std::vector<std::string>{"a", "b"});
+    const auto id = db.create_element("Collection", e);
+    const auto bare = db.create_element("Collection", quiver::Element().set("label", std::string("Item 2")));
+
+    const auto element = db.read_element("Collection", id);
+    EXPECT_EQ(std::get<std::string>(element.scalars().at("label")), "Item 1");
+    EXPECT_EQ(std::get<int64_t>(element.scalars().at("some_integer")), 7);
+    EXPECT_TRUE(std::holds_alternative<std::nullptr_t>(element.scalars().at("some_float")));
+    EXPECT_FALSE(element.scalars().contains("id"));
+    EXPECT_EQ(std::get<std::vector<int64_t>>(element.arrays().at("value_int")), (std::vector<int64_t>{1, 2, 3}));
+    EXPECT_EQ(std::get<std::vector<double>>(element.arrays().at("value_float")),
+              (std::vector<double>{0.5, 1.5, 2.5}));
+    auto tags = std::get<std::vector<std::string>>(element.arrays().at("tag"));
+    std::sort(tags.begin(), tags.end());
+    EXPECT_EQ(tags, (std::vector<std::string>{"a", "b"}));
+
+    // Reads back into an equivalent element
+    auto copy = element;
+    copy.set("label", std::string("Item 3"));
+    const auto copy_id = db.create_element("Collection", copy);
+    EXPECT_EQ(db.read_vector_integers_by_id("Collection", "value_int", copy_id), (std::vector<int64_t>{1, 2, 3}));
+
+    // Input order, duplicates repeated; elements without arrays have none
+    const std::vector<int64_t> ids{bare, id, bare};
+    const auto elements = db.read_elements("Collection", ids);
+    ASSERT_EQ(elements.size(), 3u);
+    EXPECT_FALSE(elements[0].has_arrays());
+    EXPECT_EQ(std::get<std::string>(elements[1].scalars().at("label")), "Item 1");
+    EXPECT_EQ(std::get<std::string>(elements[2].scalars().at("label")), "Item 2");
+
+    EXPECT_THROW(db.read_element("Collection", 999), std::runtime_error);
+    EXPECT_THROW(db.read_element("Missing", id), std::runtime_error);
+    EXPECT_TRUE(db.read_elements("Collection", {}).empty());
+}
+
+TEST(Database, ReadPackedVectorsLikeRows) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("packed.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+
+    quiver::Element e;
+    e.set("label", std::string("Item 1"))
+        .set("load", std::vector<double>{1.5, 2.5, 3.5})
+        .set("price", std::vector<double>{10.0, 20.0, 30.0});
+    const auto id1 = db.create_element("Collection", e);
+    const auto id2 = db.create_element("Collection", quiver::Element().set("label", std::string("Item 2")));
+
+    // One row per element, 8 bytes per value
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Collection_vector_profiles"), 1);
+    EXPECT_EQ(db.query_integer("SELECT length(load) FROM Collection_vector_profiles"), 24);
+
+    EXPECT_EQ(db.read_vector_floats("Collection", "load"), (std::vector<std::vector<double>>{{1.5, 2.5, 3.5}}));
+    EXPECT_EQ(db.read_vector_floats_by_id("Collection", "price", id1), (std::vector<double>{10.0, 20.0, 30.0}));
+    EXPECT_TRUE(db.read_vector_floats_by_id("Collection", "price", id2).empty());
+
+    const std::vector<int64_t> ids{id2, id1};
+    const auto flat = db.read_vector_floats_by_ids("Collection", "load", ids);
+    EXPECT_EQ(flat.values, (std::vector<double>{1.5, 2.5, 3.5}));
+    EXPECT_EQ(flat.offsets, (std::vector<size_t>{0, 0, 3}));
+    EXPECT_EQ(db.read_vector_floats("Collection", "load", quiver::Filter().id_in({id2})).size(), 0u);
+
+    const auto element = db.read_element("Collection", id1);
+    EXPECT_EQ(std::get<std::vector<double>>(element.arrays().at("price")), (std::vector<double>{10.0, 20.0, 30.0}));
+    const auto sums = db.aggregate_vector("Collection", "load", {quiver::Aggregate::sum});
+    EXPECT_EQ(sums.column(quiver::Aggregate::sum), (std::vector<double>{7.5, 0.0}));
+
+    // Ranges are clipped to the stored length
+    EXPECT_EQ(db.read_vector_floats_range("Collection", "load", id1, 1, 5), (std::vector<double>{2.5, 3.5}));
+    EXPECT_TRUE(db.read_vector_floats_range("Collection", "load", id1, 3, 1).empty());
+    EXPECT_TRUE(db.read_vector_floats_range("Collection", "load", id2, 0, 2).empty());
+    EXPECT_THROW(db.read_vector_floats_range("Collection", "load", id1, -1, 2), std::runtime_error);
+}
+
+TEST(Database, ReadVectorFloatsRangeOfRows) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+
+    quiver::Element e;
+    e.set("label", std::string("Item 1")).set("value_float", std::vector<double>{0.5, 1.5, 2.5, 3.5});
+    const auto id = db.create_element("Collection", e);
+
+    EXPECT_EQ(db.read_vector_floats_range("Collection", "value_float", id, 1, 2), (std::vector<double>{1.5, 2.5}));
+    EXPECT_EQ(db.read_vector_floats_range("Collection", "value_float", id, 2, 10), (std::vector<double>{2.5, 3.5}));
+    EXPECT_TRUE(db.read_vector_floats_range("Collection", "value_float", id, 0, 0).empty());
+}
+
+// ============================================================================
+// Aggregation tests
+// ============================================================================
+
+TEST(Database, AggregateVectorPerElement) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+
+    quiver::Element e;
+    e.set("label", std::string("Item 1")).set("value_int", std::vector<int64_t>{1, 5, 3});
+    const auto id1 = db.create_element("Collection", e);
+    const auto id2 = db.create_element("Collection", quiver::Element().set("label", std::string("Item 2")));
+
+    using quiver::Aggregate;
+    const auto result = db.aggregate_vector(
+        "Collection", "value_int", {Aggregate::sum, Aggregate::mean, Aggregate::min, Aggregate::max, Aggregate::count});
+    EXPECT_EQ(result.ids, (std::vector<int64_t>{id1, id2}));
+    EXPECT_TRUE(result.buckets.empty());
+    EXPECT_EQ(result.column(Aggregate::sum), (std::vector<double>{9.0, 0.0}));
+    EXPECT_DOUBLE_EQ(result.column(Aggregate::mean)[0], 3.0);
+    EXPECT_EQ(result.column(Aggregate::min)[0], 1.0);
+    EXPECT_EQ(result.column(Aggregate::max)[0], 5.0);
+    EXPECT_EQ(result.column(Aggregate::count), (std::vector<double>{3.0, 0.0}));
+
+    // Elements without values: no mean, min or max
+    EXPECT_TRUE(std::isnan(result.column(Aggregate::mean)[1]));
+    EXPECT_TRUE(std::isnan(result.column(Aggregate::max)[1]));
+
+    EXPECT_THROW(db.aggregate_vector("Collection", "value_int", {}), std::runtime_error);
+    EXPECT_THROW(db.aggregate_vector("Collection", "tag", {Aggregate::sum}), std::runtime_error);
+    EXPECT_THROW(db.aggregate_vector("Collection", "value_int", {Aggregate::sum}).column(Aggregate::count),
+                 std::runtime_error);
+}
+
+TEST(Database, AggregateTimeSeriesByBucket) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+
+    const auto id1 = db.create_element("Collection", quiver::Element().set("label", std::string("Item 1")));
+    const auto id2 = db.create_element("Collection", quiver::Element().set("label", std::string("Item 2")));
+    db.update_time_series_floats("Collection",
+                                 "value",
+                                 id1,
+                                 {"2024-01-01 00:00:00", "2024-01-20 06:00:00", "2024-02-01 00:00:00"},
+                                 {1.0, 3.0, 10.0});
+    db.update_time_series_floats("Collection", "value", id2, {"2024-01-05 00:00:00"}, {7.0});
+
+    using quiver::Aggregate;
+    const auto months =
+        db.aggregate_time_series("Collection", "value", quiver::TimeBucket::month, {Aggregate::mean, Aggregate::count});
+    EXPECT_EQ(months.ids, (std::vector<int64_t>{id1, id1, id2}));
+    EXPECT_EQ(months.buckets, (std::vector<std::string>{"2024-01", "2024-02", "2024-01"}));
+    EXPECT_EQ(months.columns[0], (std::vector<double>{2.0, 10.0, 7.0}));
+    EXPECT_EQ(months.columns[1], (std::vector<double>{2.0, 1.0, 1.0}));
+
+    const auto years = db.aggregate_time_series("Collection", "value", quiver::TimeBucket::year, {Aggregate::sum});
+    EXPECT_EQ(years.buckets, (std::vector<std::string>{"2024", "2024"}));
+    EXPECT_EQ(years.columns[0], (std::vector<double>{14.0, 7.0}));
+
+    EXPECT_THROW(db.aggregate_time_series("Collection", "missing", quiver::TimeBucket::day, {Aggregate::sum}),
+                 std::runtime_error);
+}
+
+// ============================================================================
+// Filtered read tests
+// ============================================================================
+
+TEST(Database, ReadFilteredByIdsAndPredicates) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+
+    std::vector<int64_t> ids;
+    for (int64_t i = 1; i <= 5; ++i) {
+        quiver::Element e;
+        e.set("label", "Item " + std::to_string(i)).set("value_int", std::vector<int64_t>{i, i * 10});
+        if (i % 2 == 1) {
+            e.set("some_integer", i * 100).set("tag", std::vector<std::string>{"odd"});
+        }
+        ids.push_back(db.create_element("Collection", e));
+    }
+
+    // Predicates are ANDed with each other and with the id conditions; results keep element order
+    quiver::Filter filter;
+    filter.id_range(ids[1], ids[4]).where("some_integer", quiver::FilterOp::greater, int64_t{100});
+    EXPECT_EQ(db.read_element_ids("Collection", filter), (std::vector<int64_t>{ids[2], ids[4]}));
+    EXPECT_EQ(db.read_scalar_integers("Collection", "some_integer", filter), (std::vector<int64_t>{300, 500}));
+    EXPECT_EQ(db.read_scalar_strings("Collection", "label", filter), (std::vector<std::string>{"Item 3", "Item 5"}));
+
+    const auto groups = db.read_vector_integers_flat("Collection", "value_int", filter);
+    EXPECT_EQ(groups.values, (std::vector<int64_t>{3, 30, 5, 50}));
+    EXPECT_EQ(groups.offsets, (std::vector<size_t>{0, 2, 4}));
+    EXPECT_EQ(db.read_set_strings("Collection", "tag", filter).size(), 2u);
+
+    // Id lists are membership tests; nullable reads line up with the filtered ids
+    const auto nulls = quiver::Filter().id_in({ids[4], ids[1]}).where("some_integer", quiver::FilterOp::is_null);
+    EXPECT_EQ(db.read_element_ids("Collection", nulls), (std::vector<int64_t>{ids[1]}));
+    const auto column = db.read_scalar_integers_nullable("Collection", "some_integer", quiver::Filter().id_in(ids));
+    ASSERT_EQ(column.size(), 5u);
+    EXPECT_EQ(column.null_count(), 2u);
+    EXPECT_TRUE(db.read_scalar_strings("Collection", "label", quiver::Filter().id_in({})).empty());
+
+    // Values are bound, never pasted into the SQL
+    const auto quoted = quiver::Filter().where("label", quiver::FilterOp::equal, std::string("x' OR '1'='1"));
+    EXPECT_TRUE(db.read_element_ids("Collection", quoted).empty());
+    EXPECT_EQ(db.read_element_ids("Collection", quiver::Filter()).size(), 5u);
+
+    const auto vector_filter = quiver::Filter().where("value_int", quiver::FilterOp::equal, int64_t{1});
+    EXPECT_THROW(db.read_element_ids("Collection", vector_filter), std::runtime_error);
+    EXPECT_THROW(db.read_element_ids("Collection", quiver::Filter().where("label", quiver::FilterOp::less)),
+                 std::runtime_error);
+}
+
+// ============================================================================
+// Id index and aligned read tests
+// ============================================================================
+
+TEST(Database, IdIndexPositions) {
+    const quiver::IdIndex dense({3, 4, 6});
+    EXPECT_EQ(dense.position(3), 0u);
+    EXPECT_EQ(dense.position(6), 2u);
+    EXPECT_FALSE(dense.position(5).has_value());
+    EXPECT_FALSE(dense.position(2).has_value());
+    EXPECT_FALSE(dense.position(7).has_value());
+
+    // Too sparse for a direct table: binary search
+    const quiver::IdIndex sparse({-5, 10, 1000000, std::numeric_limits<int64_t>::max()});
+    EXPECT_EQ(sparse.position(1000000), 2u);
+    EXPECT_EQ(sparse.position(std::numeric_limits<int64_t>::max()), 3u);
+    EXPECT_FALSE(sparse.contains(11));
+
+    EXPECT_FALSE(quiver::IdIndex().position(1).has_value());
+    EXPECT_THROW(quiver::IdIndex({2, 1}), std::runtime_error);
+    EXPECT_THROW(quiver::IdIndex({1, 1}), std::runtime_error);
+}
+
+TEST(Database, ReadFlatAlignedWithIdIndex) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+
+    quiver::Element e1;
+    e1.set("label", std::string("Item 1"))
+        .set("value_int", std::vector<int64_t>{1, 2})
+        .set("tag", std::vector<std::string>{"a"});
+    db.create_element("Collection", e1);
+    db.create_element("Collection", quiver::Element().set("label", std::string("Item 2")));
+    quiver::Element e3;
+    e3.set("label", std::string("Item 3")).set("value_int", std::vector<int64_t>{3});
+    const auto id3 = db.create_element("Collection", e3);
+
+    const auto index = db.read_id_index("Collection");
+    EXPECT_EQ(index.ids(), db.read_element_ids("Collection"));
+    EXPECT_EQ(index.position(id3), 2u);
+
+    // One group per element, including the ones without values
+    const auto vectors = db.read_vector_integers_flat("Collection", "value_int", index);
+    ASSERT_EQ(vectors.size(), 3u);
+    EXPECT_EQ(std::vector<int64_t>(vectors[0].begin(), vectors[0].end()), (std::vector<int64_t>{1, 2}));
+    EXPECT_TRUE(vectors[1].empty());
+    EXPECT_EQ(std::vector<int64_t>(vectors[2].begin(), vectors[2].end()), (std::vector<int64_t>{3}));
+
+    const auto sets = db.read_set_strings_flat("Collection", "tag", index);
+    ASSERT_EQ(sets.size(), 3u);
+    EXPECT_EQ(sets.size(0), 1u);
+    EXPECT_EQ(sets[0][0], "a");
+    EXPECT_EQ(sets.size(1), 0u);
+    EXPECT_EQ(sets.size(2), 0u);
+
+    // Elements outside the index are skipped
+    const auto partial = db.read_vector_integers_flat("Collection", "value_int", quiver::IdIndex({id3}));
+    ASSERT_EQ(partial.size(), 1u);
+    EXPECT_EQ(partial.values, (std::vector<int64_t>{3}));
+}
+
+// ============================================================================
+// Read cache tests
+// ============================================================================
+
+namespace {
+
+int64_t executions(const quiver::Database& db, const std::string& sql) {
+    const auto stats = db.stats();
+    auto it = std::find_if(stats.statements.begin(), stats.statements.end(), [&](const auto& statement) {
+        return statement.sql == sql;
+    });
+    return it != stats.statements.end() ? it->executions : 0;
+}
+
+}  // namespace
+
+TEST(Database, CacheReadsAnswersRepeatsUntilWrite) {
+    auto db = quiver::Database::from_schema(
+        ":memory:",
+        VALID_SCHEMA("collections.sql"),
+        {.console_level = quiver::LogLevel::off, .cache_reads = true, .collect_stats = true});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+    quiver::Element e;
+    e.set("label", std::string("Item 1")).set("some_float", 1.5).set("value_float", std::vector<double>{1.0, 2.0});
+    const auto id = db.create_element("Collection", e);
+
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(db.read_scalar_floats("Collection", "some_float"), (std::vector<double>{1.5}));
+        EXPECT_EQ(db.read_vector_floats_by_id("Collection", "value_float", id), (std::vector<double>{1.0, 2.0}));
+    }
+    EXPECT_EQ(executions(db, "SELECT some_float FROM Collection"), 1);
+    EXPECT_EQ(executions(db, "SELECT value_float FROM Collection_vector_values WHERE id = ? ORDER BY vector_index"),
+              1);
+    // Same SQL, other type: cached separately
+    EXPECT_EQ(db.read_scalar_strings("Collection", "label"), (std::vector<std::string>{"Item 1"}));
+    EXPECT_EQ(db.read_scalar_strings_by_id("Collection", "label", id), "Item 1");
+
+    // Each write drops only what was read from its table
+    db.update_scalar_float("Collection", "some_float", id, 2.5);
+    EXPECT_EQ(db.read_scalar_floats("Collection", "some_float"), (std::vector<double>{2.5}));
+    EXPECT_EQ(db.read_vector_floats_by_id("Collection", "value_float", id), (std::vector<double>{1.0, 2.0}));
+    db.update_vector_floats("Collection", "value_float", id, {3.0});
+    EXPECT_EQ(db.read_vector_floats_by_id("Collection", "value_float", id), (std::vector<double>{3.0}));
+
+    db.begin_transaction();
+    db.update_scalar_float("Collection", "some_float", id, 9.0);
+    EXPECT_EQ(db.read_scalar_floats("Collection", "some_float"), (std::vector<double>{9.0}));
+    db.rollback();
+    EXPECT_EQ(db.read_scalar_floats("Collection", "some_float"), (std::vector<double>{2.5}));
+
+    // A DELETE without WHERE skips the update hook
+    db.query_integer("DELETE FROM Collection_vector_values");
+    EXPECT_TRUE(db.read_vector_floats_by_id("Collection", "value_float", id).empty());
+    db.delete_element_by_id("Collection", id);
+    EXPECT_TRUE(db.read_scalar_floats("Collection", "some_float").empty());
+    EXPECT_FALSE(db.read_scalar_strings_by_id("Collection", "label", id).has_value());
+}
+
+TEST(Database, CacheReadsSeesOtherConnections) {
+    const auto path = (std::filesystem::temp_directory_path() / "quiver_read_cache.db").string();
+    std::filesystem::remove(path);
+    {
+        auto db = quiver::Database::from_schema(
+            path, VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off, .cache_reads = true});
+        db.create_element("Configuration", quiver::Element().set("label", std::string("Config 1")));
+        EXPECT_EQ(db.read_scalar_strings("Configuration", "label").size(), 1u);
+
+        quiver::Database writer(path, {.console_level = quiver::LogLevel::off});
+        writer.query_integer("INSERT INTO Configuration (label) VALUES ('Config 2') RETURNING id");
+        EXPECT_EQ(db.read_scalar_strings("Configuration", "label").size(), 2u);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(Database, MemoryUsageCountsCachesUntilShrink) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off, .cache_reads = true});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+    for (int i = 0; i < 100; ++i) {
+        db.create_element("Collection",
+                          quiver::Element()
+                              .set("label", "A much longer label than the small string buffer " + std::to_string(i))
+                              .set("value_float", std::vector<double>{1.0, 2.0, 3.0}));
+    }
+
+    const auto before = db.memory_usage();
+    EXPECT_GT(before.sqlite_schema, 0);
+    EXPECT_GT(before.statements, 0);
+    EXPECT_GT(before.schema, 0);
+    EXPECT_GT(before.sqlite_heap, 0);
+    EXPECT_GE(before.sqlite_heap_highwater, before.sqlite_heap);
+
+    EXPECT_EQ(db.read_scalar_strings("Collection", "label").size(), 100u);
+    EXPECT_EQ(db.read_vector_floats("Collection", "value_float").size(), 100u);
+    const auto cached = db.memory_usage();
+    // 100 heap-allocated labels and 100 vectors of three doubles at least
+    EXPECT_GT(cached.read_cache - before.read_cache, 100 * (50 + 3 * 8));
+    EXPECT_GT(cached.total(), before.total());
+
+    EXPECT_GT(db.shrink_memory(), cached.read_cache);
+    const auto after = db.memory_usage();
+    EXPECT_EQ(after.read_cache, 0);
+    EXPECT_LT(after.total(), cached.total());
+    EXPECT_EQ(db.read_scalar_strings("Collection", "label").size(), 100u);
+}
+
+TEST(Database, ReadCacheLimitBoundsCachedBytes) {
+    auto db = quiver::Database::from_schema(
+        ":memory:",
+        VALID_SCHEMA("collections.sql"),
+        {.console_level = quiver::LogLevel::off, .cache_reads = true, .read_cache_limit = 4'096});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+    std::vector<int64_t> ids;
+    for (int i = 0; i < 200; ++i) {
+        ids.push_back(db.create_element("Collection", quiver::Element().set("label", "Item " + std::to_string(i))));
+    }
+
+    // Larger than the limit: answered but not kept
+    EXPECT_EQ(db.read_scalar_strings("Collection", "label").size(), 200u);
+    EXPECT_EQ(db.memory_usage().read_cache, 0);
+
+    for (const auto id : ids) {
+        EXPECT_TRUE(db.read_scalar_strings_by_id("Collection", "label", id).has_value());
+        EXPECT_LE(db.memory_usage().read_cache, 4'096);
+    }
+    EXPECT_GT(db.memory_usage().read_cache, 0);
+}
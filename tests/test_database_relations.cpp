@@ -80,6 +80,22 @@ TEST(Database, ReadScalarRelationWithNulls) {
     EXPECT_EQ(relations[1], "");  // NULL parent
 }
 
+TEST(Database, ReadScalarRelationArena) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("relations.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Parent", quiver::Element().set("label", std::string("Parent 1")));
+    for (const auto* label : {"Child 1", "Child 2", "Child 3"}) {
+        db.create_element("Child", quiver::Element().set("label", std::string(label)));
+    }
+    db.set_scalar_relation("Child", "parent_id", "Child 1", "Parent 1");
+    db.set_scalar_relation("Child", "parent_id", "Child 3", "Parent 1");
+
+    const auto labels = db.read_scalar_relation_arena("Child", "parent_id", true);
+    EXPECT_EQ(labels.to_vector(), db.read_scalar_relation("Child", "parent_id"));
+    EXPECT_EQ(labels[1], "");
+    EXPECT_EQ(labels.start(0), labels.start(2));
+}
+
 TEST(Database, ReadScalarRelationMixedNullsAndValues) {
     auto db = quiver::Database::from_schema(
         ":memory:", VALID_SCHEMA("relations.sql"), {.console_level = quiver::LogLevel::off});
@@ -183,3 +199,103 @@ TEST(Database, SetScalarRelationOverwrite) {
     relations = db.read_scalar_relation("Child", "parent_id");
     EXPECT_EQ(relations[0], "Parent 2");
 }
+
+// ============================================================================
+// Label resolution for foreign key writes
+// ============================================================================
+
+TEST(Database, CreateAndUpdateElementResolveArrayLabels) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("relations.sql"), {.console_level = quiver::LogLevel::off});
+
+    auto p1 = db.create_element("Parent", quiver::Element().set("label", std::string("Parent 1")));
+    auto p2 = db.create_element("Parent", quiver::Element().set("label", std::string("Parent 2")));
+
+    quiver::Element child;
+    child.set("label", std::string("Child 1"));
+    child.set("parent_ref", std::vector<std::string>{"Parent 2", "Parent 1"});
+    auto id = db.create_element("Child", child);
+
+    EXPECT_EQ(db.read_vector_integers_by_id("Child", "parent_ref", id), (std::vector<int64_t>{p2, p1}));
+
+    db.update_element("Child", id, quiver::Element().set("parent_ref", std::vector<std::string>{"Parent 2"}));
+    EXPECT_EQ(db.read_vector_integers_by_id("Child", "parent_ref", id), (std::vector<int64_t>{p2}));
+
+    quiver::Element bad;
+    bad.set("parent_ref", std::vector<std::string>{"Parent 3"});
+    EXPECT_THROW(db.update_element("Child", id, bad), std::runtime_error);
+    EXPECT_EQ(db.read_vector_integers_by_id("Child", "parent_ref", id), (std::vector<int64_t>{p2}));
+}
+
+TEST(Database, SetScalarRelationAfterLabelChange) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("relations.sql"), {.console_level = quiver::LogLevel::off});
+
+    auto p1 = db.create_element("Parent", quiver::Element().set("label", std::string("Parent 1")));
+    db.create_element("Child", quiver::Element().set("label", std::string("Child 1")));
+    db.set_scalar_relation("Child", "parent_id", "Child 1", "Parent 1");
+
+    // Renaming the label must not leave the old id behind a cached "Parent 1"
+    db.update_scalar_string("Parent", "label", p1, "Renamed");
+    EXPECT_THROW(db.set_scalar_relation("Child", "parent_id", "Child 1", "Parent 1"), std::runtime_error);
+
+    auto p2 = db.create_element("Parent", quiver::Element().set("label", std::string("Parent 1")));
+    db.set_scalar_relation("Child", "parent_id", "Child 1", "Parent 1");
+    EXPECT_EQ(db.read_scalar_integers("Child", "parent_id"), (std::vector<int64_t>{p2}));
+
+    db.delete_element_by_id("Parent", p2);
+    EXPECT_THROW(db.set_scalar_relation("Child", "parent_id", "Child 1", "Parent 1"), std::runtime_error);
+}
+
+// ============================================================================
+// Bulk relations
+// ============================================================================
+
+TEST(Database, SetScalarRelations) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("relations.sql"), {.console_level = quiver::LogLevel::off});
+
+    auto p1 = db.create_element("Parent", quiver::Element().set("label", std::string("Parent 1")));
+    auto p2 = db.create_element("Parent", quiver::Element().set("label", std::string("Parent 2")));
+    for (const auto* label : {"Child 1", "Child 2", "Child 3"}) {
+        db.create_element("Child", quiver::Element().set("label", std::string(label)));
+    }
+
+    db.set_scalar_relations("Child", "parent_id", {"Child 3", "Child 1"}, {"Parent 1", "Parent 2"});
+
+    EXPECT_EQ(db.read_scalar_relation("Child", "parent_id"), (std::vector<std::string>{"Parent 2", "", "Parent 1"}));
+    EXPECT_EQ(db.read_scalar_relation_ids("Child", "parent_id"), (std::vector<int64_t>{p2, 0, p1}));
+
+    // A repeated source label keeps its last target
+    db.set_scalar_relations("Child", "parent_id", {"Child 2", "Child 2"}, {"Parent 2", "Parent 1"});
+    EXPECT_EQ(db.read_scalar_relation_ids("Child", "parent_id"), (std::vector<int64_t>{p2, p1, p1}));
+}
+
+TEST(Database, SetScalarRelationsSelfReference) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("relations.sql"), {.console_level = quiver::LogLevel::off});
+
+    for (const auto* label : {"Child 1", "Child 2"}) {
+        db.create_element("Child", quiver::Element().set("label", std::string(label)));
+    }
+
+    db.set_scalar_relations("Child", "sibling_id", {"Child 1", "Child 2"}, {"Child 2", "Child 1"});
+    EXPECT_EQ(db.read_scalar_relation("Child", "sibling_id"), (std::vector<std::string>{"Child 2", "Child 1"}));
+}
+
+TEST(Database, SetScalarRelationsMissingTargetWritesNothing) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("relations.sql"), {.console_level = quiver::LogLevel::off});
+
+    db.create_element("Parent", quiver::Element().set("label", std::string("Parent 1")));
+    db.create_element("Child", quiver::Element().set("label", std::string("Child 1")));
+    db.create_element("Child", quiver::Element().set("label", std::string("Child 2")));
+
+    EXPECT_THROW(db.set_scalar_relations("Child", "parent_id", {"Child 1", "Child 2"}, {"Parent 1", "Parent 9"}),
+                 std::runtime_error);
+    EXPECT_EQ(db.read_scalar_relation_ids("Child", "parent_id"), (std::vector<int64_t>{0, 0}));
+
+    EXPECT_THROW(db.set_scalar_relations("Child", "parent_id", {"Child 1"}, {}), std::runtime_error);
+    EXPECT_THROW(db.set_scalar_relations("Child", "label", {"Child 1"}, {"Parent 1"}), std::runtime_error);
+    EXPECT_THROW(db.read_scalar_relation_ids("Child", "label"), std::runtime_error);
+}
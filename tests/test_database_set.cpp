@@ -0,0 +1,82 @@
+#include "test_utils.h"
+
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <quiver/database.h>
+#include <quiver/database_set.h>
+#include <quiver/element.h>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+class DatabaseSetFixture : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (int64_t file = 1; file <= 4; ++file) {
+            auto path = (fs::temp_directory_path() / ("quiver_set_test_" + std::to_string(file) + ".db")).string();
+            auto db = quiver::Database::from_schema(
+                path, VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+            for (int64_t i = 1; i <= file; ++i) {
+                auto element =
+                    quiver::Element().set("label", "Config " + std::to_string(i)).set("integer_attribute", i * file);
+                db.create_element("Configuration", element);
+            }
+            paths.push_back(path);
+        }
+    }
+    void TearDown() override {
+        for (const auto& path : paths) {
+            if (fs::exists(path))
+                fs::remove(path);
+        }
+    }
+    quiver::DatabaseSetOptions quiet_options(size_t threads) const {
+        quiver::DatabaseSetOptions options;
+        options.threads = threads;
+        options.options.console_level = quiver::LogLevel::off;
+        return options;
+    }
+    std::vector<std::string> paths;
+};
+
+TEST_F(DatabaseSetFixture, MapReturnsResultsKeyedByPath) {
+    quiver::DatabaseSet set(paths, quiet_options(3));
+    EXPECT_EQ(set.size(), 4u);
+
+    auto results =
+        set.map([](quiver::Database& db) { return db.read_scalar_integers("Configuration", "integer_attribute"); });
+    ASSERT_EQ(results.size(), 4u);
+    EXPECT_EQ(results.at(paths[0]), (std::vector<int64_t>{1}));
+    EXPECT_EQ(results.at(paths[3]), (std::vector<int64_t>{4, 8, 12, 16}));
+
+    auto counts = set.map([](quiver::Database& db) {
+        return db.query_integer("SELECT COUNT(*) FROM Configuration").value_or(0);
+    });
+    EXPECT_EQ(counts.at(paths[2]), 3);
+}
+
+TEST_F(DatabaseSetFixture, FilesAreReadOnlyWithSchemaLoaded) {
+    quiver::DatabaseSet set(paths, quiet_options(2));
+    set.for_each([](const std::string&, quiver::Database& db) {
+        EXPECT_EQ(db.get_scalar_metadata("Configuration", "label").data_type, quiver::DataType::Text);
+    });
+    EXPECT_THROW(set.at(paths[1]).create_element("Configuration", quiver::Element().set("label", "New")),
+                 std::runtime_error);
+    EXPECT_THROW(set.at("missing.db"), std::runtime_error);
+}
+
+TEST_F(DatabaseSetFixture, ForEachRethrowsFirstError) {
+    quiver::DatabaseSet set(paths, quiet_options(4));
+    EXPECT_THROW(set.for_each([&](const std::string& path, quiver::Database& db) {
+        if (path == paths[1]) {
+            db.read_scalar_integers("Missing", "integer_attribute");
+        }
+    }),
+                 std::runtime_error);
+}
+
+TEST_F(DatabaseSetFixture, InvalidPaths) {
+    EXPECT_THROW(quiver::DatabaseSet({paths[0], paths[0]}, quiet_options(1)), std::runtime_error);
+    EXPECT_THROW(quiver::DatabaseSet({paths[0], "/nonexistent/dir/file.db"}, quiet_options(2)), std::runtime_error);
+}
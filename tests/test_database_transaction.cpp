@@ -0,0 +1,167 @@
+#include "test_utils.h"
+
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <quiver/database.h>
+#include <quiver/element.h>
+
+namespace fs = std::filesystem;
+
+// ============================================================================
+// Explicit transaction tests
+// ============================================================================
+
+TEST(DatabaseTransaction, CommitPersistsChanges) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    EXPECT_FALSE(db.in_transaction());
+    db.begin_transaction();
+    EXPECT_TRUE(db.in_transaction());
+    db.create_element("Configuration", quiver::Element().set("label", "Config 1"));
+    db.create_element("Configuration", quiver::Element().set("label", "Config 2"));
+    db.commit();
+    EXPECT_FALSE(db.in_transaction());
+
+    EXPECT_EQ(db.read_scalar_strings("Configuration", "label").size(), 2);
+}
+
+TEST(DatabaseTransaction, RollbackDiscardsChanges) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    db.create_element("Configuration", quiver::Element().set("label", "Config 1").set("integer_attribute", int64_t{1}));
+
+    db.begin_transaction();
+    db.update_scalar_integer("Configuration", "integer_attribute", 1, 99);
+    db.create_element("Configuration", quiver::Element().set("label", "Config 2"));
+    db.rollback();
+
+    EXPECT_EQ(db.read_scalar_integers("Configuration", "integer_attribute"), (std::vector<int64_t>{1}));
+    EXPECT_EQ(db.read_scalar_strings("Configuration", "label").size(), 1);
+}
+
+TEST(DatabaseTransaction, NestedRollbackKeepsOuterChanges) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    db.begin_transaction();
+    db.create_element("Configuration", quiver::Element().set("label", "Outer"));
+
+    db.begin_transaction();
+    db.create_element("Configuration", quiver::Element().set("label", "Inner"));
+    db.rollback();
+
+    EXPECT_TRUE(db.in_transaction());
+    db.commit();
+
+    EXPECT_EQ(db.read_scalar_strings("Configuration", "label"), (std::vector<std::string>{"Outer"}));
+}
+
+TEST(DatabaseTransaction, OuterRollbackDiscardsNestedCommit) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    db.begin_transaction();
+    db.begin_transaction();
+    db.create_element("Configuration", quiver::Element().set("label", "Inner"));
+    db.commit();
+    db.rollback();
+
+    EXPECT_TRUE(db.read_scalar_strings("Configuration", "label").empty());
+}
+
+TEST(DatabaseTransaction, FailedOperationInsideTransactionOnlyUndoesItself) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    db.create_element("Configuration", quiver::Element().set("label", "Test Config"));
+
+    db.begin_transaction();
+    db.create_element("Collection", quiver::Element().set("label", "Item 1"));
+
+    // create_element nests through a savepoint, so its failure keeps the outer transaction usable
+    quiver::Element bad;
+    bad.set("label", "Item 2").set("value_int", std::vector<std::string>{"not", "integers"});
+    EXPECT_THROW(db.create_element("Collection", bad), std::runtime_error);
+    EXPECT_TRUE(db.in_transaction());
+
+    db.create_element("Collection", quiver::Element().set("label", "Item 3"));
+    db.commit();
+
+    EXPECT_EQ(db.read_scalar_strings("Collection", "label"), (std::vector<std::string>{"Item 1", "Item 3"}));
+}
+
+TEST(DatabaseTransaction, CommitWithoutTransactionThrows) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    EXPECT_THROW(db.commit(), std::runtime_error);
+    EXPECT_THROW(db.rollback(), std::runtime_error);
+}
+
+// ============================================================================
+// Transaction scope tests
+// ============================================================================
+
+TEST(DatabaseTransaction, ScopeRollsBackWhenNotCommitted) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    {
+        quiver::Database::Transaction txn(db);
+        db.create_element("Configuration", quiver::Element().set("label", "Config 1"));
+    }
+
+    EXPECT_FALSE(db.in_transaction());
+    EXPECT_TRUE(db.read_scalar_strings("Configuration", "label").empty());
+}
+
+TEST(DatabaseTransaction, ScopeCommit) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    {
+        quiver::Database::Transaction txn(db);
+        db.create_element("Configuration", quiver::Element().set("label", "Config 1"));
+        txn.commit();
+        EXPECT_THROW(txn.commit(), std::runtime_error);
+    }
+
+    EXPECT_EQ(db.read_scalar_strings("Configuration", "label").size(), 1);
+}
+
+TEST(DatabaseTransaction, TransactionFunctionRollsBackOnException) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    EXPECT_THROW(db.transaction([&]() {
+        db.create_element("Configuration", quiver::Element().set("label", "Config 1"));
+        throw std::runtime_error("abort");
+    }),
+                 std::runtime_error);
+    EXPECT_TRUE(db.read_scalar_strings("Configuration", "label").empty());
+
+    db.transaction([&]() { db.create_element("Configuration", quiver::Element().set("label", "Config 2")); });
+    EXPECT_EQ(db.read_scalar_strings("Configuration", "label"), (std::vector<std::string>{"Config 2"}));
+}
+
+TEST(DatabaseTransaction, BatchedUpdatesOnDisk) {
+    auto path = (fs::temp_directory_path() / "quiver_transaction_test.db").string();
+    {
+        auto db =
+            quiver::Database::from_schema(path, VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+        db.create_element("Configuration", quiver::Element().set("label", "Config 1"));
+
+        db.transaction([&]() {
+            for (int64_t i = 0; i < 100; ++i) {
+                db.update_scalar_integer("Configuration", "integer_attribute", 1, i);
+            }
+        });
+    }
+    {
+        quiver::Database db(path, {.console_level = quiver::LogLevel::off});
+        EXPECT_EQ(db.query_integer("SELECT integer_attribute FROM Configuration WHERE id = 1"), 99);
+    }
+    fs::remove(path);
+}
@@ -1,6 +1,8 @@
 #include "test_utils.h"
 
+#include <algorithm>
 #include <gtest/gtest.h>
+#include <limits>
 #include <quiver/database.h>
 #include <quiver/element.h>
 
@@ -53,6 +55,43 @@ TEST(Database, UpdateScalarString) {
     EXPECT_EQ(*val, "world");
 }
 
+TEST(Database, UpdateByAttributeHandle) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+    auto id = db.create_element("Configuration", quiver::Element().set("label", std::string("Config 1")));
+
+    const auto integer = db.attribute_handle("Configuration", "integer_attribute");
+    const auto real = db.attribute_handle("Configuration", "float_attribute");
+    const auto text = db.attribute_handle("Configuration", "string_attribute");
+    for (int64_t value = 1; value <= 3; ++value) {
+        db.update_scalar_integer(integer, id, value);
+    }
+    db.update_scalar_float(real, id, 2.5);
+    db.update_scalar_string(text, id, "updated");
+
+    EXPECT_EQ(db.read_scalar_integers_by_id("Configuration", "integer_attribute", id), 3);
+    EXPECT_EQ(db.read_scalar_floats_by_id("Configuration", "float_attribute", id), 2.5);
+    EXPECT_EQ(db.read_scalar_strings_by_id("Configuration", "string_attribute", id), "updated");
+}
+
+TEST(Database, UpdateTypedAccessors) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    auto id = db.create_element("Collection", quiver::Element().set("label", std::string("Item 1")));
+
+    db.update_scalar<int64_t>("Collection", "some_integer", id, 42);
+    db.update_scalar<double>("Collection", "some_float", id, 2.5);
+    db.update_vector<int64_t>("Collection", "value_int", id, {4, 5});
+    db.update_set<std::string>("Collection", "tag", id, {"review"});
+
+    EXPECT_EQ(db.read_scalar_integers_by_id("Collection", "some_integer", id), 42);
+    EXPECT_EQ(db.read_scalar_floats_by_id("Collection", "some_float", id), 2.5);
+    EXPECT_EQ(db.read_vector_integers_by_id("Collection", "value_int", id), (std::vector<int64_t>{4, 5}));
+    EXPECT_EQ(db.read_set_strings_by_id("Collection", "tag", id), (std::vector<std::string>{"review"}));
+
+    EXPECT_THROW(db.update_scalar<std::string>("Collection", "some_integer", id, "text"), std::runtime_error);
+}
+
 TEST(Database, UpdateScalarMultipleElements) {
     auto db =
         quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
@@ -79,6 +118,55 @@ TEST(Database, UpdateScalarMultipleElements) {
     EXPECT_EQ(*val2, 100);
 }
 
+TEST(Database, UpdateScalarsMany) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    std::vector<int64_t> ids;
+    for (int i = 0; i < 3; ++i) {
+        ids.push_back(db.create_element("Configuration",
+                                        quiver::Element().set("label", "Config " + std::to_string(i))));
+    }
+
+    db.update_scalar_integers("Configuration", "integer_attribute", ids, std::vector<int64_t>{10, 20, 30});
+    db.update_scalar_floats("Configuration", "float_attribute", ids, std::vector<double>{1.5, 2.5, 3.5});
+    db.update_scalar_strings("Configuration", "string_attribute", ids, std::vector<std::string>{"a", "b", "c"});
+
+    EXPECT_EQ(db.read_scalar_integers("Configuration", "integer_attribute"), (std::vector<int64_t>{10, 20, 30}));
+    EXPECT_EQ(db.read_scalar_floats("Configuration", "float_attribute"), (std::vector<double>{1.5, 2.5, 3.5}));
+    EXPECT_EQ(db.read_scalar_strings("Configuration", "string_attribute"), (std::vector<std::string>{"a", "b", "c"}));
+
+    // Only the listed ids are written; a repeated id keeps its last value
+    std::vector<int64_t> partial = {ids[2], ids[0], ids[2]};
+    db.update_scalar_integers("Configuration", "integer_attribute", partial, std::vector<int64_t>{1, 2, 3});
+    EXPECT_EQ(db.read_scalar_integers("Configuration", "integer_attribute"), (std::vector<int64_t>{2, 20, 3}));
+
+    db.update_scalar_integers("Configuration", "integer_attribute", {}, {});
+}
+
+TEST(Database, UpdateScalarsManyErrors) {
+    auto db =
+        quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), {.console_level = quiver::LogLevel::off});
+
+    auto id = db.create_element("Configuration", quiver::Element().set("label", std::string("Config 1")));
+    std::vector<int64_t> ids = {id};
+
+    EXPECT_THROW(db.update_scalar_integers("Configuration", "integer_attribute", ids, std::vector<int64_t>{1, 2}),
+                 std::runtime_error);
+    EXPECT_THROW(db.update_scalar_strings("Configuration", "integer_attribute", ids, std::vector<std::string>{"x"}),
+                 std::runtime_error);
+    EXPECT_THROW(db.update_scalar_floats("NonexistentCollection", "float_attribute", ids, std::vector<double>{1.0}),
+                 std::runtime_error);
+
+    // A failing row rolls back the whole batch
+    quiver::Element e2;
+    e2.set("label", std::string("Config 2"));
+    ids.push_back(db.create_element("Configuration", e2));
+    std::vector<std::string> labels = {"Renamed", "Renamed"};
+    EXPECT_THROW(db.update_scalar_strings("Configuration", "label", ids, labels), std::runtime_error);
+    EXPECT_EQ(db.read_scalar_strings("Configuration", "label"), (std::vector<std::string>{"Config 1", "Config 2"}));
+}
+
 // ============================================================================
 // Update vector tests
 // ============================================================================
@@ -536,6 +624,131 @@ TEST(Database, UpdateVectorFromEmptyToNonEmpty) {
     EXPECT_EQ(vec, (std::vector<int64_t>{1, 2, 3}));
 }
 
+TEST(Database, UpdateLargeVectorAndSet) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+
+    quiver::Element e;
+    e.set("label", std::string("Item 1"));
+    int64_t id = db.create_element("Collection", e);
+
+    // Not a multiple of the insert chunk size, so both the multi-row and single-row paths run
+    std::vector<int64_t> values(10007);
+    std::vector<std::string> tags;
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int64_t>(i * 3);
+        tags.push_back("tag" + std::to_string(i));
+    }
+
+    db.update_vector_integers("Collection", "value_int", id, values);
+    db.update_set_strings("Collection", "tag", id, tags);
+
+    EXPECT_EQ(db.read_vector_integers_by_id("Collection", "value_int", id), values);
+    EXPECT_EQ(db.read_set_strings_by_id("Collection", "tag", id).size(), tags.size());
+    EXPECT_EQ(db.query_integer("SELECT MAX(vector_index) FROM Collection_vector_values"), 10007);
+
+    // Replacing with a shorter vector leaves no stale rows
+    db.update_vector_integers("Collection", "value_int", id, {7, 8});
+    EXPECT_EQ(db.read_vector_integers_by_id("Collection", "value_int", id), (std::vector<int64_t>{7, 8}));
+}
+
+TEST(Database, UpdateVectorOnlyRewritesChangedEntries) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+
+    quiver::Element e;
+    e.set("label", std::string("Item 1"))
+        .set("value_int", std::vector<int64_t>{1, 2, 3, 4})
+        .set("value_float", std::vector<double>{1.5, 2.5, 3.5, 4.5});
+    int64_t id = db.create_element("Collection", e);
+
+    // Rows that remain are updated in place, so the sibling column survives
+    db.update_vector_integers("Collection", "value_int", id, {1, 20, 3});
+    EXPECT_EQ(db.read_vector_integers_by_id("Collection", "value_int", id), (std::vector<int64_t>{1, 20, 3}));
+    EXPECT_EQ(db.read_vector_floats_by_id("Collection", "value_float", id), (std::vector<double>{1.5, 2.5, 3.5}));
+
+    // Growing inserts only the new indices
+    db.update_vector_integers("Collection", "value_int", id, {1, 20, 3, 40, 50});
+    EXPECT_EQ(db.read_vector_integers_by_id("Collection", "value_int", id),
+              (std::vector<int64_t>{1, 20, 3, 40, 50}));
+    EXPECT_EQ(db.query_integer("SELECT MAX(vector_index) FROM Collection_vector_values WHERE id = ?", {id}), 5);
+}
+
+TEST(Database, UpdateSetOnlyRewritesChangedValues) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+
+    quiver::Element e;
+    e.set("label", std::string("Item 1")).set("tag", std::vector<std::string>{"a", "b", "c"});
+    int64_t id = db.create_element("Collection", e);
+
+    auto rowid_of_a = db.query_integer("SELECT rowid FROM Collection_set_tags WHERE tag = 'a'");
+
+    db.update_set_strings("Collection", "tag", id, {"a", "c", "d"});
+
+    auto values = db.read_set_strings_by_id("Collection", "tag", id);
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ(values, (std::vector<std::string>{"a", "c", "d"}));
+
+    // Unchanged values keep their row
+    EXPECT_EQ(db.query_integer("SELECT rowid FROM Collection_set_tags WHERE tag = 'a'"), rowid_of_a);
+}
+
+TEST(Database, AppendVector) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+
+    quiver::Element e;
+    e.set("label", std::string("Item 1"));
+    int64_t id = db.create_element("Collection", e);
+
+    db.append_vector_floats("Collection", "value_float", id, {1.0, 2.0});
+    db.append_vector_floats("Collection", "value_float", id, {3.0});
+    EXPECT_EQ(db.read_vector_floats_by_id("Collection", "value_float", id), (std::vector<double>{1.0, 2.0, 3.0}));
+
+    db.append_vector_integers("Collection", "value_int", id, {});
+    EXPECT_THROW(db.append_vector_integers("Collection", "nonexistent", id, {1}), std::runtime_error);
+}
+
+TEST(Database, UpdateVectorEntry) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+
+    quiver::Element e;
+    e.set("label", std::string("Item 1")).set("value_int", std::vector<int64_t>{1, 2, 3});
+    int64_t id = db.create_element("Collection", e);
+
+    db.update_vector_integer_entry("Collection", "value_int", id, 1, 200);
+    EXPECT_EQ(db.read_vector_integers_by_id("Collection", "value_int", id), (std::vector<int64_t>{1, 200, 3}));
+
+    db.update_vector_float_entry("Collection", "value_float", id, 0, 0.5);
+    auto floats = db.read_vector_floats_by_id("Collection", "value_float", id);
+    EXPECT_EQ(floats, (std::vector<double>{0.5}));
+
+    EXPECT_THROW(db.update_vector_integer_entry("Collection", "value_int", id, 3, 4), std::runtime_error);
+    EXPECT_THROW(db.update_vector_integer_entry("Collection", "value_int", id, -1, 4), std::runtime_error);
+}
+
 TEST(Database, UpdateSetFromEmptyToNonEmpty) {
     auto db = quiver::Database::from_schema(
         ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
@@ -579,3 +792,185 @@ TEST(Database, UpdateDateTimeScalar) {
     EXPECT_TRUE(date.has_value());
     EXPECT_EQ(date.value(), "2024-03-17T09:00:00");
 }
+
+// ============================================================================
+// Update time series tests
+// ============================================================================
+
+TEST(Database, UpdateTimeSeriesFloats) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+
+    quiver::Element e;
+    e.set("label", std::string("Item 1"));
+    int64_t id = db.create_element("Collection", e);
+
+    db.update_time_series_floats(
+        "Collection", "value", id, {"2024-01-02 00:00:00", "2024-01-01 00:00:00"}, {2.0, 1.0});
+    db.update_time_series_floats("Collection", "value", id, {"2025-01-01 00:00:00"}, {5.0});
+
+    // Previous rows are replaced
+    auto series = db.read_time_series_floats("Collection", "value", id);
+    EXPECT_EQ(series.date_times, (std::vector<std::string>{"2025-01-01 00:00:00"}));
+    EXPECT_EQ(series.values, (std::vector<double>{5.0}));
+
+    db.update_time_series_floats("Collection", "value", id, {}, {});
+    EXPECT_TRUE(db.read_time_series_floats("Collection", "value", id).empty());
+}
+
+TEST(Database, UpdateTimeSeriesFloatsStoresNanAsNull) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+
+    quiver::Element e;
+    e.set("label", std::string("Item 1"));
+    int64_t id = db.create_element("Collection", e);
+
+    db.update_time_series_floats("Collection",
+                                 "value",
+                                 id,
+                                 {"2024-01-01 00:00:00", "2024-01-02 00:00:00"},
+                                 {std::numeric_limits<double>::quiet_NaN(), 2.0});
+
+    auto nulls = db.query_integer("SELECT COUNT(*) FROM Collection_time_series_data WHERE value IS NULL");
+    EXPECT_EQ(nulls, 1);
+}
+
+TEST(Database, UpdateTimeSeriesFloatsSizeMismatch) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+
+    quiver::Element e;
+    e.set("label", std::string("Item 1"));
+    int64_t id = db.create_element("Collection", e);
+
+    EXPECT_THROW(db.update_time_series_floats("Collection", "value", id, {"2024-01-01 00:00:00"}, {1.0, 2.0}),
+                 std::runtime_error);
+    EXPECT_THROW(db.update_time_series_floats("Collection", "nonexistent", id, {}, {}), std::runtime_error);
+    EXPECT_THROW(db.update_time_series_floats("Collection", "date_time", id, {}, {}), std::runtime_error);
+}
+
+// ============================================================================
+// Change tracking tests
+// ============================================================================
+
+namespace {
+
+std::vector<std::string> describe(const quiver::ChangeSet& set) {
+    std::vector<std::string> lines;
+    for (const auto& change : set.changes) {
+        const char* kind = change.kind == quiver::ChangeKind::created   ? "created"
+                           : change.kind == quiver::ChangeKind::deleted ? "deleted"
+                                                                        : "updated";
+        lines.push_back(change.collection + "/" + std::to_string(change.id) + "/" + change.attribute + " " + kind);
+    }
+    return lines;
+}
+
+}  // namespace
+
+TEST(Database, TrackChangesReportsEachChangedAttribute) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off, .track_changes = true});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+    const auto start = db.change_token();
+    EXPECT_GT(start, 0);
+
+    int64_t id = db.create_element("Collection", quiver::Element().set("label", std::string("Item 1")));
+    db.update_scalar_integer("Collection", "some_integer", id, 7);
+    db.update_scalar_integer("Collection", "some_integer", id, 7);  // Unchanged value: not reported
+    db.update_vector_integers("Collection", "value_int", id, {1, 2});
+
+    auto set = db.changes_since(start);
+    EXPECT_EQ(set.token, db.change_token());
+    EXPECT_EQ(describe(set),
+              (std::vector<std::string>{"Collection/1/ created",
+                                        "Collection/1/some_integer updated",
+                                        "Collection/1/value_float updated",
+                                        "Collection/1/value_int updated"}));
+
+    // Only what changed after the returned token, with the latest kind per attribute
+    db.update_time_series_floats("Collection", "value", id, {"2024-01-01 00:00:00"}, {1.0});
+    db.delete_element_by_id("Collection", id);
+    auto later = db.changes_since(set.token);
+    EXPECT_EQ(describe(later),
+              (std::vector<std::string>{"Collection/1/date_time updated",
+                                        "Collection/1/value updated",
+                                        "Collection/1/value_float updated",
+                                        "Collection/1/value_int updated",
+                                        "Collection/1/ deleted"}));
+    EXPECT_TRUE(db.changes_since(later.token).changes.empty());
+}
+
+TEST(Database, TrackChangesRollbackAndDiscard) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off, .track_changes = true});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+    const auto start = db.change_token();
+
+    db.begin_transaction();
+    db.create_element("Collection", quiver::Element().set("label", std::string("Item 1")));
+    db.rollback();
+    EXPECT_TRUE(db.changes_since(start).changes.empty());
+
+    // Raw SQL is tracked too
+    db.query_integer("INSERT INTO Collection (label) VALUES ('Item 2') RETURNING id");
+    const auto token = db.change_token();
+    EXPECT_GT(token, start);
+    db.discard_changes(token);
+    EXPECT_TRUE(db.changes_since(0).changes.empty());
+    EXPECT_EQ(db.change_token(), token);
+}
+
+TEST(Database, UpdatePackedVectorEntryInPlace) {
+    auto db = quiver::Database::from_schema(
+        ":memory:",
+        VALID_SCHEMA("packed.sql"),
+        {.console_level = quiver::LogLevel::off, .track_changes = true, .cache_reads = true});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+    quiver::Element e;
+    e.set("label", std::string("Item 1")).set("load", std::vector<double>{1.0, 2.0, 3.0});
+    const auto id = db.create_element("Collection", e);
+    EXPECT_EQ(db.read_vector_floats_by_id("Collection", "load", id), (std::vector<double>{1.0, 2.0, 3.0}));
+
+    // Blob writes bypass the triggers and update hook, yet reach the cache and the change log
+    const auto token = db.change_token();
+    db.update_vector_float_entry("Collection", "load", id, 1, 9.0);
+    EXPECT_EQ(db.read_vector_floats_by_id("Collection", "load", id), (std::vector<double>{1.0, 9.0, 3.0}));
+    EXPECT_EQ(describe(db.changes_since(token)), (std::vector<std::string>{"Collection/1/load updated"}));
+    EXPECT_THROW(db.update_vector_float_entry("Collection", "load", id, 3, 1.0), std::runtime_error);
+    EXPECT_THROW(db.update_vector_float_entry("Collection", "price", id, 0, 1.0), std::runtime_error);
+    EXPECT_THROW(db.update_vector_integer_entry("Collection", "load", id, 0, 1), std::runtime_error);
+
+    db.update_vector_floats("Collection", "load", id, {4.0, 5.0});
+    db.append_vector_floats("Collection", "load", id, {6.0});
+    db.append_vector_floats("Collection", "price", id, {7.0});
+    EXPECT_EQ(db.read_vector_floats_by_id("Collection", "load", id), (std::vector<double>{4.0, 5.0, 6.0}));
+    EXPECT_EQ(db.read_vector_floats_by_id("Collection", "price", id), (std::vector<double>{7.0}));
+    EXPECT_THROW(db.update_vector_integers("Collection", "load", id, {1}), std::runtime_error);
+
+    db.update_vector_floats("Collection", "load", id, {});
+    EXPECT_TRUE(db.read_vector_floats_by_id("Collection", "load", id).empty());
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Collection_vector_profiles WHERE load IS NULL"), 1);
+}
+
+TEST(Database, TrackChangesRequiresOption) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    EXPECT_THROW(db.change_token(), std::runtime_error);
+    EXPECT_THROW(db.changes_since(0), std::runtime_error);
+    EXPECT_THROW(db.discard_changes(0), std::runtime_error);
+    EXPECT_EQ(db.query_integer("SELECT count(*) FROM sqlite_temp_master"), 0);
+}
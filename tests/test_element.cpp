@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include <quiver/element.h>
+#include <span>
+#include <utility>
+#include <vector>
 
 TEST(Element, DefaultEmpty) {
     quiver::Element element;
@@ -49,10 +52,7 @@ TEST(Element, SetArrayInt) {
     EXPECT_TRUE(element.has_arrays());
     const auto& arrays = element.arrays();
     EXPECT_EQ(arrays.size(), 1);
-    EXPECT_EQ(arrays.at("counts").size(), 3);
-    EXPECT_EQ(std::get<int64_t>(arrays.at("counts")[0]), 10);
-    EXPECT_EQ(std::get<int64_t>(arrays.at("counts")[1]), 20);
-    EXPECT_EQ(std::get<int64_t>(arrays.at("counts")[2]), 30);
+    EXPECT_EQ(std::get<std::vector<int64_t>>(arrays.at("counts")), (std::vector<int64_t>{10, 20, 30}));
 }
 
 TEST(Element, SetArrayFloat) {
@@ -62,9 +62,7 @@ TEST(Element, SetArrayFloat) {
     EXPECT_TRUE(element.has_arrays());
     const auto& arrays = element.arrays();
     EXPECT_EQ(arrays.size(), 1);
-    EXPECT_EQ(arrays.at("values").size(), 3);
-    EXPECT_EQ(std::get<double>(arrays.at("values")[0]), 1.5);
-    EXPECT_EQ(std::get<double>(arrays.at("values")[2]), 3.5);
+    EXPECT_EQ(std::get<std::vector<double>>(arrays.at("values")), (std::vector<double>{1.5, 2.5, 3.5}));
 }
 
 TEST(Element, SetArrayString) {
@@ -74,9 +72,8 @@ TEST(Element, SetArrayString) {
     EXPECT_TRUE(element.has_arrays());
     const auto& arrays = element.arrays();
     EXPECT_EQ(arrays.size(), 1);
-    EXPECT_EQ(arrays.at("tags").size(), 2);
-    EXPECT_EQ(std::get<std::string>(arrays.at("tags")[0]), "important");
-    EXPECT_EQ(std::get<std::string>(arrays.at("tags")[1]), "urgent");
+    EXPECT_EQ(std::get<std::vector<std::string>>(arrays.at("tags")),
+              (std::vector<std::string>{"important", "urgent"}));
 }
 
 TEST(Element, FluentChaining) {
@@ -222,7 +219,21 @@ TEST(Element, ClearAndReuse) {
     EXPECT_TRUE(element.has_scalars());
     EXPECT_TRUE(element.has_arrays());
     EXPECT_EQ(std::get<std::string>(element.scalars().at("new_label")), "Reused");
-    EXPECT_EQ(element.arrays().at("new_data").size(), 3);
+    EXPECT_EQ(quiver::array_size(element.arrays().at("new_data")), 3);
+}
+
+TEST(Element, SetArrayMovesAndCopiesSpans) {
+    std::vector<double> values(10000, 0.5);
+    const auto* buffer = values.data();
+
+    quiver::Element element;
+    element.set("moved", std::move(values));
+    // The moved vector's buffer is kept, not copied
+    EXPECT_EQ(std::get<std::vector<double>>(element.arrays().at("moved")).data(), buffer);
+
+    const int64_t raw[] = {4, 5, 6};
+    element.set("span", std::span<const int64_t>(raw));
+    EXPECT_EQ(std::get<std::vector<int64_t>>(element.arrays().at("span")), (std::vector<int64_t>{4, 5, 6}));
 }
 
 TEST(Element, SetMultipleSameNameArrays) {
@@ -233,8 +244,7 @@ TEST(Element, SetMultipleSameNameArrays) {
     element.set("values", std::vector<int64_t>{10, 20});
 
     EXPECT_EQ(element.arrays().size(), 1);
-    EXPECT_EQ(element.arrays().at("values").size(), 2);
-    EXPECT_EQ(std::get<int64_t>(element.arrays().at("values")[0]), 10);
+    EXPECT_EQ(std::get<std::vector<int64_t>>(element.arrays().at("values")), (std::vector<int64_t>{10, 20}));
 }
 
 TEST(Element, SetMixedScalarsAndArrays) {
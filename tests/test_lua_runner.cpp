@@ -324,6 +324,36 @@ TEST_F(LuaRunnerTest, ReadScalarByIdNotFoundFromLua) {
     )");
 }
 
+TEST_F(LuaRunnerTest, ReadByIdsFromLua) {
+    auto db = quiver::Database::from_schema(":memory:", collections_schema);
+
+    db.create_element("Configuration", quiver::Element().set("label", "Config"));
+    db.create_element("Collection",
+                      quiver::Element()
+                          .set("label", "Item 1")
+                          .set("some_integer", int64_t{42})
+                          .set("value_int", std::vector<int64_t>{1, 2, 3}));
+    db.create_element("Collection", quiver::Element().set("label", "Item 2"));
+
+    quiver::LuaRunner lua(db);
+
+    lua.run(R"(
+        local labels = db:read_scalar_strings_by_ids("Collection", "label", {2, 999, 1})
+        assert(labels[1] == "Item 2", "labels[1] should be 'Item 2'")
+        assert(labels[2] == nil, "labels[2] should be nil for unknown id")
+        assert(labels[3] == "Item 1", "labels[3] should be 'Item 1'")
+
+        local values = db:read_scalar_integers_by_ids("Collection", "some_integer", {1, 2})
+        assert(values[1] == 42, "values[1] should be 42")
+        assert(values[2] == nil, "values[2] should be nil")
+
+        local vectors = db:read_vector_integers_by_ids("Collection", "value_int", {2, 1})
+        assert(#vectors == 2, "Expected 2 groups")
+        assert(#vectors[1] == 0, "Item 2 has no vector values")
+        assert(#vectors[2] == 3 and vectors[2][3] == 3, "Item 1 should have {1, 2, 3}")
+    )");
+}
+
 TEST_F(LuaRunnerTest, ReadVectorIntegerByIdFromLua) {
     auto db = quiver::Database::from_schema(":memory:", collections_schema);
 
@@ -466,6 +496,46 @@ TEST_F(LuaRunnerTest, DeleteElementByIdWithVectorDataFromLua) {
     EXPECT_EQ(vectors[0], (std::vector<int64_t>{4, 5, 6}));
 }
 
+TEST_F(LuaRunnerTest, DeleteElementsByIdsFromLua) {
+    auto db = quiver::Database::from_schema(":memory:", collections_schema);
+
+    db.create_element("Configuration", quiver::Element().set("label", "Config"));
+    for (const auto* label : {"Item 1", "Item 2", "Item 3"}) {
+        db.create_element("Collection",
+                          quiver::Element().set("label", label).set("value_int", std::vector<int64_t>{1}));
+    }
+
+    quiver::LuaRunner lua(db);
+
+    lua.run(R"(
+        local deleted = db:delete_elements_by_ids("Collection", {1, 3, 42})
+        assert(deleted == 2, "Expected 2 elements deleted")
+    )");
+
+    EXPECT_EQ(db.read_element_ids("Collection"), (std::vector<int64_t>{2}));
+    EXPECT_EQ(db.read_vector_integers("Collection", "value_int").size(), 1);
+}
+
+TEST_F(LuaRunnerTest, UpsertElementsFromLua) {
+    auto db = quiver::Database::from_schema(":memory:", collections_schema);
+
+    db.create_element("Configuration", quiver::Element().set("label", "Config"));
+    db.create_element("Collection", quiver::Element().set("label", "Item 1").set("some_integer", int64_t{1}));
+
+    quiver::LuaRunner lua(db);
+
+    lua.run(R"(
+        local id = db:upsert_element("Collection", { label = "Item 1", some_integer = 5 })
+        assert(id == 1, "Expected the existing id")
+        local ids = db:upsert_elements("Collection", { { label = "Item 1", value_int = {7} }, { label = "Item 2" } })
+        assert(#ids == 2 and ids[1] == 1, "Expected two ids, the first one existing")
+    )");
+
+    EXPECT_EQ(db.read_element_ids("Collection").size(), 2);
+    EXPECT_EQ(db.read_scalar_integers_by_id("Collection", "some_integer", 1), 5);
+    EXPECT_EQ(db.read_vector_integers_by_id("Collection", "value_int", 1), (std::vector<int64_t>{7}));
+}
+
 TEST_F(LuaRunnerTest, DeleteElementByIdNonExistentFromLua) {
     auto db = quiver::Database::from_schema(":memory:", collections_schema);
 
@@ -1097,3 +1167,213 @@ TEST_F(LuaRunnerTest, LuaScriptWithUnicodeCharacters) {
     EXPECT_EQ(config_labels.size(), 1);
     EXPECT_EQ(collection_labels.size(), 1);
 }
+
+TEST_F(LuaRunnerTest, TransactionCommitsFromLua) {
+    auto db = quiver::Database::from_schema(":memory:", collections_schema);
+    quiver::LuaRunner lua(db);
+
+    lua.run(R"(
+        db:create_element("Configuration", { label = "Test Config" })
+        db:transaction(function()
+            assert(db:in_transaction())
+            for i = 1, 10 do
+                db:create_element("Collection", { label = "Item " .. i })
+            end
+        end)
+        assert(not db:in_transaction())
+    )");
+
+    EXPECT_EQ(db.read_scalar_strings("Collection", "label").size(), 10);
+}
+
+TEST_F(LuaRunnerTest, TransactionRollsBackOnLuaError) {
+    auto db = quiver::Database::from_schema(":memory:", collections_schema);
+    db.create_element("Configuration", quiver::Element().set("label", "Test Config"));
+    quiver::LuaRunner lua(db);
+
+    EXPECT_THROW(
+        {
+            lua.run(R"(
+                db:transaction(function()
+                    db:create_element("Collection", { label = "Item 1" })
+                    error("abort")
+                end)
+            )");
+        },
+        std::runtime_error);
+
+    EXPECT_FALSE(db.in_transaction());
+    EXPECT_TRUE(db.read_scalar_strings("Collection", "label").empty());
+}
+
+TEST_F(LuaRunnerTest, ExplicitTransactionFromLua) {
+    auto db = quiver::Database::from_schema(":memory:", collections_schema);
+    db.create_element("Configuration", quiver::Element().set("label", "Test Config"));
+    quiver::LuaRunner lua(db);
+
+    lua.run(R"(
+        db:begin_transaction()
+        db:create_element("Collection", { label = "Kept" })
+        db:commit()
+
+        db:begin_transaction()
+        db:create_element("Collection", { label = "Discarded" })
+        db:rollback()
+    )");
+
+    auto labels = db.read_scalar_strings("Collection", "label");
+    ASSERT_EQ(labels.size(), 1);
+    EXPECT_EQ(labels[0], "Kept");
+}
+
+TEST_F(LuaRunnerTest, CreateElementsFromLua) {
+    auto db = quiver::Database::from_schema(":memory:", collections_schema);
+    quiver::LuaRunner lua(db);
+
+    lua.run(R"(
+        db:create_element("Configuration", { label = "Test Config" })
+        local ids = db:create_elements("Collection", {
+            { label = "Item 1", some_integer = 10 },
+            { label = "Item 2", some_integer = 20 },
+        })
+        assert(#ids == 2, "Expected 2 ids")
+        assert(ids[2] > ids[1], "Ids should be increasing")
+    )");
+
+    auto labels = db.read_scalar_strings("Collection", "label");
+    ASSERT_EQ(labels.size(), 2);
+    EXPECT_EQ(labels[1], "Item 2");
+    EXPECT_EQ(db.read_scalar_integers("Collection", "some_integer"), (std::vector<int64_t>{10, 20}));
+}
+
+TEST_F(LuaRunnerTest, UpdateScalarsManyFromLua) {
+    auto db = quiver::Database::from_schema(":memory:", collections_schema);
+    db.create_element("Configuration", quiver::Element().set("label", "Test Config"));
+    auto id1 = db.create_element("Collection", quiver::Element().set("label", "Item 1"));
+    auto id2 = db.create_element("Collection", quiver::Element().set("label", "Item 2"));
+    quiver::LuaRunner lua(db);
+
+    lua.run(R"(
+        local ids = db:read_element_ids("Collection")
+        db:update_scalar_integers("Collection", "some_integer", ids, { 7, 8 })
+        db:update_scalar_floats("Collection", "some_float", ids, { 1.5, 2.5 })
+        db:update_scalar_strings("Collection", "label", { ids[2] }, { "Renamed" })
+    )");
+
+    EXPECT_EQ(db.read_scalar_integers_by_id("Collection", "some_integer", id1), 7);
+    EXPECT_EQ(db.read_scalar_floats_by_id("Collection", "some_float", id2), 2.5);
+    EXPECT_EQ(db.read_scalar_strings_by_id("Collection", "label", id2), "Renamed");
+
+    EXPECT_THROW(lua.run(R"(db:update_scalar_integers("Collection", "some_integer", { 1, 2 }, { 1 }))"),
+                 std::runtime_error);
+}
+
+TEST_F(LuaRunnerTest, RepeatedScriptRunsEachTime) {
+    auto db = quiver::Database::from_schema(":memory:", collections_schema);
+    db.create_element("Configuration", quiver::Element().set("label", "Test Config"));
+    quiver::LuaRunner lua(db);
+
+    const std::string script = R"(
+        local n = #db:read_element_ids("Collection")
+        db:create_element("Collection", { label = "Item " .. (n + 1) })
+    )";
+    for (int i = 0; i < 3; ++i) {
+        lua.run(script);
+    }
+
+    EXPECT_EQ(db.read_scalar_strings("Collection", "label"), (std::vector<std::string>{"Item 1", "Item 2", "Item 3"}));
+    EXPECT_THROW(lua.run("invalid lua syntax !!!"), std::runtime_error);
+    EXPECT_THROW(lua.run("invalid lua syntax !!!"), std::runtime_error);
+}
+
+TEST_F(LuaRunnerTest, CompiledScriptWithArgs) {
+    auto db = quiver::Database::from_schema(":memory:", collections_schema);
+    db.create_element("Configuration", quiver::Element().set("label", "Test Config"));
+    quiver::LuaRunner lua(db);
+
+    auto handle = lua.compile("create_item", R"(
+        local label, value, missing = ...
+        assert(missing == nil, "Expected nil argument")
+        db:create_element("Collection", { label = label, some_integer = value })
+    )");
+    lua.run(handle, {std::string("Item 1"), int64_t{10}, nullptr});
+    lua.run(handle, {std::string("Item 2"), int64_t{20}, nullptr});
+
+    EXPECT_EQ(db.read_scalar_strings("Collection", "label"), (std::vector<std::string>{"Item 1", "Item 2"}));
+    EXPECT_EQ(db.read_scalar_integers("Collection", "some_integer"), (std::vector<int64_t>{10, 20}));
+}
+
+TEST_F(LuaRunnerTest, CompiledScriptErrors) {
+    auto db = quiver::Database::from_schema(":memory:", collections_schema);
+    quiver::LuaRunner lua(db);
+
+    EXPECT_THROW(lua.compile("broken", "invalid lua syntax !!!"), std::runtime_error);
+    EXPECT_THROW(lua.run(size_t{42}), std::runtime_error);
+
+    auto handle = lua.compile("validate", "error('rejected')");
+    try {
+        lua.run(handle);
+        FAIL() << "Expected std::runtime_error";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find("validate:1:"), std::string::npos);
+    }
+}
+
+TEST_F(LuaRunnerTest, ReleaseCompiledScript) {
+    auto db = quiver::Database::from_schema(":memory:", collections_schema);
+    quiver::LuaRunner lua(db);
+
+    auto first = lua.compile("first", "return 1");
+    auto second = lua.compile("second", "return 2");
+    lua.release(first);
+    EXPECT_THROW(lua.run(first), std::runtime_error);
+    EXPECT_THROW(lua.release(first), std::runtime_error);
+    EXPECT_NO_THROW(lua.run(second));
+
+    // The released slot is reused instead of growing the runner
+    EXPECT_EQ(lua.compile("third", "return 3"), first);
+    EXPECT_NO_THROW(lua.run(first));
+}
+
+TEST_F(LuaRunnerTest, IterScalarsFromLua) {
+    auto db = quiver::Database::from_schema(":memory:", collections_schema);
+    quiver::LuaRunner lua(db);
+
+    lua.run(R"(
+        db:create_element("Configuration", { label = "Test Config" })
+        db:create_element("Collection", { label = "Item 1", some_integer = 10 })
+        db:create_element("Collection", { label = "Item 2" })
+        db:create_element("Collection", { label = "Item 3", some_integer = 30 })
+
+        local count, total = 0, 0
+        for id, row in db:iter_scalars("Collection", { "label", "some_integer" }) do
+            count = count + 1
+            assert(row.label == "Item " .. count, "Label mismatch")
+            total = total + (row.some_integer or 0)
+        end
+        assert(count == 3, "Expected 3 rows")
+        assert(total == 40, "Expected total 40")
+    )");
+}
+
+TEST_F(LuaRunnerTest, IterVectorFromLua) {
+    auto db = quiver::Database::from_schema(":memory:", collections_schema);
+    quiver::LuaRunner lua(db);
+
+    lua.run(R"(
+        db:create_element("Configuration", { label = "Test Config" })
+        db:create_element("Collection", { label = "Item 1", value_float = { 1.5, 2.5 } })
+        db:create_element("Collection", { label = "Item 2" })
+        db:create_element("Collection", { label = "Item 3", value_float = { 4.0 } })
+
+        local groups = {}
+        for id, values in db:iter_vector("Collection", "value_float") do
+            groups[#groups + 1] = { id = id, n = #values, first = values[1] }
+        end
+        assert(#groups == 2, "Empty vectors are skipped")
+        assert(groups[1].n == 2 and groups[1].first == 1.5)
+        assert(groups[2].id == 3 and groups[2].first == 4.0)
+    )");
+
+    EXPECT_THROW(lua.run(R"(db:iter_vector("Collection", "missing"))"), std::runtime_error);
+}
@@ -268,3 +268,97 @@ TEST_F(MigrationsTestFixture, MigrationsWithNegativeVersionDirectory) {
 
     EXPECT_EQ(migrations.count(), 1u);
 }
+
+// ============================================================================
+// Database::migrate_up tests
+// ============================================================================
+
+TEST_F(MigrationsTestFixture, MigrateUpReportsEachMigration) {
+    quiver::Database db(":memory:", {.console_level = quiver::LogLevel::off});
+
+    std::vector<int64_t> reported;
+    const auto results = db.migrate_up(
+        migrations_path, {.on_migration = [&](const quiver::MigrationResult& r) { reported.push_back(r.version); }});
+
+    ASSERT_EQ(results.size(), 3u);
+    EXPECT_EQ(reported, (std::vector<int64_t>{1, 2, 3}));
+    // 1/up.sql: two pragmas and three tables; comments and the trailing blank text are not statements
+    EXPECT_EQ(results[0].statements, 5u);
+    EXPECT_EQ(results[1].statements, 2u);
+    for (const auto& result : results) {
+        EXPECT_GE(result.elapsed_ns, 0);
+    }
+    EXPECT_EQ(db.current_version(), 3);
+    EXPECT_TRUE(db.migrate_up(migrations_path).empty());
+}
+
+TEST_F(MigrationsTestFixture, MigrateUpDryRunLeavesFileUnchanged) {
+    quiver::Database db(":memory:", {.console_level = quiver::LogLevel::off});
+
+    const auto results = db.migrate_up(migrations_path, {.dry_run = true});
+    EXPECT_EQ(results.size(), 3u);
+    EXPECT_EQ(db.current_version(), 0);
+    EXPECT_EQ(db.query_integer("SELECT count(*) FROM sqlite_master WHERE type = 'table'"), 0);
+
+    EXPECT_EQ(db.migrate_up(migrations_path).size(), 3u);
+    EXPECT_EQ(db.current_version(), 3);
+}
+
+TEST_F(MigrationsTestFixture, MigrateUpDefersForeignKeysToCommit) {
+    fs::create_directories(fs::path(temp_dir) / "1");
+    fs::create_directories(fs::path(temp_dir) / "2");
+    std::ofstream(fs::path(temp_dir) / "1" / "up.sql")
+        << "CREATE TABLE Configuration (id INTEGER PRIMARY KEY, label TEXT UNIQUE NOT NULL) STRICT;\n"
+           "CREATE TABLE Parent (id INTEGER PRIMARY KEY, label TEXT UNIQUE NOT NULL) STRICT;\n"
+           "CREATE TABLE Child (id INTEGER PRIMARY KEY, label TEXT UNIQUE NOT NULL, parent_id INTEGER,\n"
+           "    FOREIGN KEY (parent_id) REFERENCES Parent(id) ON DELETE SET NULL ON UPDATE CASCADE) STRICT;\n";
+    // The child row comes before its parent, which an immediate foreign key check would reject
+    std::ofstream(fs::path(temp_dir) / "2" / "up.sql")
+        << "INSERT INTO Child (id, label, parent_id) VALUES (1, 'Child 1', 1);\n"
+           "INSERT INTO Parent (id, label) VALUES (1, 'Parent 1');\n";
+
+    quiver::Database db(":memory:", {.console_level = quiver::LogLevel::off});
+    EXPECT_EQ(db.migrate_up(temp_dir).size(), 2u);
+    EXPECT_EQ(db.read_scalar_integers("Child", "parent_id"), (std::vector<int64_t>{1}));
+}
+
+TEST_F(MigrationsTestFixture, MigrateUpFailureRollsBackWholeSet) {
+    fs::create_directories(fs::path(temp_dir) / "1");
+    fs::create_directories(fs::path(temp_dir) / "2");
+    std::ofstream(fs::path(temp_dir) / "1" / "up.sql") << "CREATE TABLE First (id INTEGER PRIMARY KEY);";
+    std::ofstream(fs::path(temp_dir) / "2" / "up.sql") << "CREATE TABLE Second (id INTEGER PRIMARY KEY);\nNOT SQL;";
+
+    quiver::Database db(":memory:", {.console_level = quiver::LogLevel::off});
+    try {
+        db.migrate_up(temp_dir);
+        FAIL() << "Expected migration 2 to fail";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find("Migration 2 failed"), std::string::npos) << e.what();
+    }
+    EXPECT_EQ(db.current_version(), 0);
+    EXPECT_EQ(db.query_integer("SELECT count(*) FROM sqlite_master WHERE type = 'table'"), 0);
+    EXPECT_FALSE(db.in_transaction());
+}
+
+TEST_F(MigrationsTestFixture, MigrateUpRebuildsChangeTriggers) {
+    fs::create_directories(fs::path(temp_dir) / "1");
+    std::ofstream(fs::path(temp_dir) / "1" / "up.sql")
+        << "CREATE TABLE Configuration (id INTEGER PRIMARY KEY, label TEXT UNIQUE NOT NULL) STRICT;\n"
+           "CREATE TABLE Item (id INTEGER PRIMARY KEY, label TEXT UNIQUE NOT NULL, old_value INTEGER) STRICT;\n";
+
+    quiver::Database db(":memory:", {.console_level = quiver::LogLevel::off, .track_changes = true});
+    db.migrate_up(temp_dir);
+    const auto id = db.create_element("Item", quiver::Element().set("label", std::string("Item 1")));
+
+    // The old_value trigger would make the DROP COLUMN fail if it were still installed
+    fs::create_directories(fs::path(temp_dir) / "2");
+    std::ofstream(fs::path(temp_dir) / "2" / "up.sql") << "ALTER TABLE Item DROP COLUMN old_value;";
+    db.migrate_up(temp_dir);
+
+    const auto token = db.change_token();
+    db.update_scalar_string("Item", "label", id, "Renamed");
+    const auto set = db.changes_since(token);
+    ASSERT_EQ(set.changes.size(), 1u);
+    EXPECT_EQ(set.changes[0].attribute, "label");
+    EXPECT_EQ(set.changes[0].kind, quiver::ChangeKind::updated);
+}
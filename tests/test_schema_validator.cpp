@@ -1,7 +1,15 @@
 #include "test_utils.h"
 
+#include <algorithm>
+#include <fstream>
 #include <gtest/gtest.h>
 #include <quiver/database.h>
+#include <quiver/element.h>
+#include <quiver/schema.h>
+#include <sqlite3.h>
+#include <sstream>
+#include <string>
+#include <vector>
 
 class SchemaValidatorFixture : public ::testing::Test {
 protected:
@@ -21,6 +29,14 @@ TEST_F(SchemaValidatorFixture, ValidSchemaRelations) {
     EXPECT_NO_THROW(quiver::Database::from_schema(":memory:", VALID_SCHEMA("relations.sql"), opts));
 }
 
+TEST_F(SchemaValidatorFixture, ValidSchemaPacked) {
+    EXPECT_NO_THROW(quiver::Database::from_schema(":memory:", VALID_SCHEMA("packed.sql"), opts));
+}
+
+TEST_F(SchemaValidatorFixture, ValidSchemaCompressed) {
+    EXPECT_NO_THROW(quiver::Database::from_schema(":memory:", VALID_SCHEMA("compressed.sql"), opts));
+}
+
 // Invalid schemas
 TEST_F(SchemaValidatorFixture, InvalidNoConfiguration) {
     EXPECT_THROW(quiver::Database::from_schema(":memory:", INVALID_SCHEMA("no_configuration.sql"), opts),
@@ -52,6 +68,16 @@ TEST_F(SchemaValidatorFixture, InvalidVectorNoIndex) {
                  std::runtime_error);
 }
 
+TEST_F(SchemaValidatorFixture, InvalidPackedNotBlob) {
+    EXPECT_THROW(quiver::Database::from_schema(":memory:", INVALID_SCHEMA("packed_not_blob.sql"), opts),
+                 std::runtime_error);
+}
+
+TEST_F(SchemaValidatorFixture, InvalidCompressedNoChunk) {
+    EXPECT_THROW(quiver::Database::from_schema(":memory:", INVALID_SCHEMA("compressed_no_chunk.sql"), opts),
+                 std::runtime_error);
+}
+
 TEST_F(SchemaValidatorFixture, InvalidSetNoUnique) {
     EXPECT_THROW(quiver::Database::from_schema(":memory:", INVALID_SCHEMA("set_no_unique.sql"), opts),
                  std::runtime_error);
@@ -303,3 +329,177 @@ TEST_F(SchemaValidatorFixture, GetScalarMetadataIdColumn) {
     EXPECT_EQ(meta.name, "id");
     EXPECT_EQ(meta.data_type, quiver::DataType::Integer);
 }
+
+// ============================================================================
+// Attribute routing index
+// ============================================================================
+
+namespace {
+
+// Loads a schema file into a raw in-memory connection and inspects it directly
+class RawSchema {
+public:
+    explicit RawSchema(const std::string& path) {
+        sqlite3_open(":memory:", &db_);
+        std::ifstream file(path);
+        std::stringstream sql;
+        sql << file.rdbuf();
+        sqlite3_exec(db_, sql.str().c_str(), nullptr, nullptr, nullptr);
+    }
+    ~RawSchema() { sqlite3_close(db_); }
+
+    quiver::Schema load() const { return quiver::Schema::from_database(db_); }
+
+private:
+    sqlite3* db_ = nullptr;
+};
+
+}  // namespace
+
+TEST_F(SchemaValidatorFixture, FindAttributeRoutesByKind) {
+    auto schema = RawSchema(VALID_SCHEMA("collections.sql")).load();
+
+    const auto* scalar = schema.find_attribute("Collection", "some_integer", quiver::AttributeKind::Scalar);
+    ASSERT_NE(scalar, nullptr);
+    EXPECT_EQ(scalar->table, "Collection");
+    ASSERT_NE(scalar->column, nullptr);
+    EXPECT_EQ(scalar->column->type, quiver::DataType::Integer);
+
+    const auto* vector = schema.find_attribute("Collection", "value_float", quiver::AttributeKind::Vector);
+    ASSERT_NE(vector, nullptr);
+    EXPECT_EQ(vector->table, "Collection_vector_values");
+    EXPECT_EQ(vector->kind, quiver::AttributeKind::Vector);
+
+    const auto* set = schema.find_attribute("Collection", "tag", quiver::AttributeKind::Set);
+    ASSERT_NE(set, nullptr);
+    EXPECT_EQ(set->table, "Collection_set_tags");
+
+    const auto* series = schema.find_attribute("Collection", "value", quiver::AttributeKind::TimeSeries);
+    ASSERT_NE(series, nullptr);
+    EXPECT_EQ(series->table, "Collection_time_series_data");
+
+    EXPECT_EQ(schema.find_attribute("Collection", "tag", quiver::AttributeKind::Vector), nullptr);
+    EXPECT_EQ(schema.find_attribute("Collection", "nonexistent", quiver::AttributeKind::Scalar), nullptr);
+    EXPECT_EQ(schema.find_attribute("Nonexistent", "label", quiver::AttributeKind::Scalar), nullptr);
+}
+
+TEST_F(SchemaValidatorFixture, FindAttributeGroupNameTakesPrecedence) {
+    auto schema = RawSchema(VALID_SCHEMA("collections.sql")).load();
+
+    // "values" is a group name, not a column: routed to its table without column metadata
+    const auto* group = schema.find_attribute("Collection", "values", quiver::AttributeKind::Vector);
+    ASSERT_NE(group, nullptr);
+    EXPECT_EQ(group->table, "Collection_vector_values");
+    EXPECT_EQ(group->column, nullptr);
+    EXPECT_EQ(schema.find_vector_table("Collection", "values"), "Collection_vector_values");
+    EXPECT_EQ(schema.find_set_table("Collection", "tags"), "Collection_set_tags");
+}
+
+TEST_F(SchemaValidatorFixture, FindAttributeForeignKeyTarget) {
+    auto schema = RawSchema(VALID_SCHEMA("relations.sql")).load();
+
+    const auto* scalar = schema.find_attribute("Child", "parent_id", quiver::AttributeKind::Scalar);
+    ASSERT_NE(scalar, nullptr);
+    ASSERT_NE(scalar->foreign_key, nullptr);
+    EXPECT_EQ(scalar->foreign_key->to_table, "Parent");
+
+    const auto* set = schema.find_attribute("Child", "parent_ref", quiver::AttributeKind::Set);
+    ASSERT_NE(set, nullptr);
+    ASSERT_NE(set->foreign_key, nullptr);
+    EXPECT_EQ(set->foreign_key->to_table, "Parent");
+
+    const auto* label = schema.find_attribute("Child", "label", quiver::AttributeKind::Scalar);
+    ASSERT_NE(label, nullptr);
+    EXPECT_EQ(label->foreign_key, nullptr);
+}
+
+TEST_F(SchemaValidatorFixture, ChildTablesPerCollection) {
+    auto schema = RawSchema(VALID_SCHEMA("collections.sql")).load();
+
+    EXPECT_EQ(schema.vector_tables("Collection"), std::vector<std::string>{"Collection_vector_values"});
+    EXPECT_EQ(schema.set_tables("Collection"), std::vector<std::string>{"Collection_set_tags"});
+    EXPECT_EQ(schema.time_series_tables("Collection"), std::vector<std::string>{"Collection_time_series_data"});
+    EXPECT_TRUE(schema.vector_tables("Configuration").empty());
+    EXPECT_TRUE(schema.set_tables("Nonexistent").empty());
+
+    // Copies carry their own index
+    auto copy = schema;
+    const auto* location = copy.find_attribute("Collection", "label", quiver::AttributeKind::Scalar);
+    ASSERT_NE(location, nullptr);
+    EXPECT_EQ(location->column, copy.get_table("Collection")->get_column("label"));
+}
+
+// Loaded schemas are cached by DDL; the cache must never serve a different or unvalidated schema
+TEST_F(SchemaValidatorFixture, InvalidSchemaRejectedOnEveryLoad) {
+    for (int i = 0; i < 2; ++i) {
+        EXPECT_THROW(quiver::Database::from_schema(":memory:", INVALID_SCHEMA("label_not_unique.sql"), opts),
+                     std::runtime_error);
+    }
+}
+
+TEST_F(SchemaValidatorFixture, SameSchemaAcrossDatabases) {
+    auto first = quiver::Database::from_schema(":memory:", VALID_SCHEMA("collections.sql"), opts);
+    auto second = quiver::Database::from_schema(":memory:", VALID_SCHEMA("collections.sql"), opts);
+    auto basic = quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), opts);
+
+    first.create_element("Configuration", quiver::Element().set("label", std::string("Config")));
+    first.create_element("Collection", quiver::Element().set("label", std::string("Item 1")));
+    EXPECT_EQ(first.read_scalar_strings("Collection", "label"), std::vector<std::string>{"Item 1"});
+    EXPECT_TRUE(second.read_scalar_strings("Collection", "label").empty());
+    EXPECT_THROW(basic.read_scalar_strings("Collection", "label"), std::runtime_error);
+}
+
+TEST_F(SchemaValidatorFixture, ValidationCanBeSkipped) {
+    auto trusted = opts;
+    trusted.validate_schema = false;
+    EXPECT_NO_THROW(quiver::Database::from_schema(":memory:", INVALID_SCHEMA("set_no_unique.sql"), trusted));
+
+    // The unvalidated entry is still checked when a later open asks for validation
+    EXPECT_THROW(quiver::Database::from_schema(":memory:", INVALID_SCHEMA("set_no_unique.sql"), opts),
+                 std::runtime_error);
+}
+
+// Index lint
+
+TEST_F(SchemaValidatorFixture, MissingIndexesOfCollectionsSchema) {
+    auto db = quiver::Database::from_schema(":memory:", VALID_SCHEMA("collections.sql"), opts);
+    EXPECT_TRUE(db.missing_indexes().empty());
+    for (const auto& check : db.check_query_plans()) {
+        EXPECT_FALSE(check.full_scan) << check.sql;
+    }
+}
+
+TEST_F(SchemaValidatorFixture, MissingIndexesOfRelationColumns) {
+    auto db = quiver::Database::from_schema(":memory:", VALID_SCHEMA("relations.sql"), opts);
+
+    std::vector<std::string> missing;
+    for (const auto& index : db.missing_indexes()) {
+        ASSERT_EQ(index.columns.size(), 1u);
+        missing.push_back(index.table + "." + index.columns[0]);
+    }
+    std::sort(missing.begin(), missing.end());
+    EXPECT_EQ(missing,
+              (std::vector<std::string>{"Child.parent_id",
+                                        "Child.sibling_id",
+                                        "Child_set_parents.parent_ref",
+                                        "Child_vector_refs.parent_ref"}));
+
+    const auto scans = [&] {
+        std::vector<std::string> sql;
+        for (const auto& check : db.check_query_plans()) {
+            if (check.full_scan) {
+                sql.push_back(check.sql);
+            }
+        }
+        return sql;
+    };
+    const auto before = scans();
+    EXPECT_EQ(before.size(), 4u);
+    EXPECT_NE(std::find(before.begin(), before.end(), "SELECT 1 FROM Child WHERE parent_id = ?"), before.end());
+
+    EXPECT_EQ(db.create_missing_indexes(), 4u);
+    EXPECT_TRUE(db.missing_indexes().empty());
+    EXPECT_TRUE(scans().empty());
+    EXPECT_EQ(db.create_missing_indexes(), 0u);
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM sqlite_master WHERE name = 'quiver_index_Child_parent_id'"), 1);
+}
@@ -0,0 +1,146 @@
+#include "test_utils.h"
+
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <quiver/database.h>
+#include <quiver/study_generator.h>
+
+namespace {
+
+quiver::StudyGeneratorOptions small_study() {
+    quiver::StudyGeneratorOptions options;
+    options.elements = 50;
+    options.vector_length = 4;
+    options.set_size = 2;
+    options.fan_out = 5;
+    options.time_series_length = 6;
+    options.batch_size = 16;
+    return options;
+}
+
+}  // namespace
+
+TEST(StudyGenerator, FillsEveryGroup) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+
+    const auto study = quiver::StudyGenerator(small_study()).generate(db);
+
+    EXPECT_EQ(study.elements.at("Configuration"), 1);
+    EXPECT_EQ(study.elements.at("Collection"), 50);
+    EXPECT_EQ(study.vector_rows, 50 * 4);
+    EXPECT_EQ(study.set_rows, 50 * 2);
+    EXPECT_EQ(study.time_series_rows, 50 * 6);
+
+    EXPECT_EQ(db.read_element_ids("Collection").size(), 50);
+    EXPECT_EQ(db.read_scalar_strings_by_id("Collection", "label", 3), "Collection 3");
+    EXPECT_EQ(db.read_scalar_integers("Collection", "some_integer").size(), 50);
+    for (const auto& values : db.read_vector_integers("Collection", "value_int")) {
+        EXPECT_EQ(values.size(), 4);
+    }
+    for (const auto& tags : db.read_set_strings("Collection", "tag")) {
+        EXPECT_EQ(tags.size(), 2);
+    }
+
+    const auto series = db.read_time_series_floats("Collection", "value", 7);
+    ASSERT_EQ(series.size(), 6);
+    EXPECT_EQ(series.date_times.front(), "2024-01-01 00:00:00");
+    EXPECT_EQ(series.date_times.back(), "2024-01-01 05:00:00");
+}
+
+TEST(StudyGenerator, IsDeterministic) {
+    auto generate = [](uint64_t seed) {
+        auto db = quiver::Database::from_schema(
+            ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+        auto options = small_study();
+        options.seed = seed;
+        quiver::StudyGenerator(options).generate(db);
+        return std::make_tuple(db.read_scalar_floats("Collection", "some_float"),
+                               db.read_vector_integers("Collection", "value_int"),
+                               db.read_set_strings("Collection", "tag"),
+                               db.read_time_series_floats("Collection", "value", 3).values);
+    };
+
+    EXPECT_EQ(generate(7), generate(7));
+    EXPECT_NE(std::get<0>(generate(7)), std::get<0>(generate(8)));
+
+    // Each element gets a series of its own
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    quiver::StudyGenerator(small_study()).generate(db);
+    EXPECT_NE(db.read_time_series_floats("Collection", "value", 3).values,
+              db.read_time_series_floats("Collection", "value", 4).values);
+}
+
+TEST(StudyGenerator, RelationsPointAtGeneratedElements) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("relations.sql"), {.console_level = quiver::LogLevel::off});
+
+    auto options = small_study();
+    options.counts = {{"Parent", 10}, {"Child", 40}};
+    quiver::StudyGenerator(options).generate(db);
+
+    // fan_out consecutive children share a parent
+    const auto parents = db.read_scalar_integers("Child", "parent_id");
+    ASSERT_EQ(parents.size(), 40);
+    EXPECT_EQ(parents[0], parents[4]);
+    EXPECT_NE(parents[4], parents[5]);
+
+    // The self reference is written once every child exists
+    const auto siblings = db.read_scalar_integers("Child", "sibling_id");
+    ASSERT_EQ(siblings.size(), 40);
+    for (const auto sibling : siblings) {
+        EXPECT_GE(sibling, 1);
+        EXPECT_LE(sibling, 40);
+    }
+
+    for (const auto& refs : db.read_set_integers("Child", "parent_ref")) {
+        EXPECT_EQ(refs.size(), 2);
+    }
+    EXPECT_EQ(db.read_vector_integers("Child", "parent_ref").size(), 40);
+}
+
+TEST(StudyGenerator, PackedAndCompressedGroups) {
+    auto packed = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("packed.sql"), {.console_level = quiver::LogLevel::off});
+    const auto packed_study = quiver::StudyGenerator(small_study()).generate(packed);
+    EXPECT_EQ(packed_study.vector_rows, 50);
+    EXPECT_EQ(packed.read_vector_floats_by_id("Collection", "load", 1).size(), 4);
+
+    auto compressed = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("compressed.sql"), {.console_level = quiver::LogLevel::off});
+    auto options = small_study();
+    options.time_series_length = 2'000;  // Two chunks per element
+    const auto compressed_study = quiver::StudyGenerator(options).generate(compressed);
+    EXPECT_EQ(compressed_study.time_series_rows, 50 * 2'000);
+    EXPECT_EQ(compressed.read_time_series_floats("Plant", "power", 50).size(), 2'000);
+
+    // Every value column of a chunk is encoded, not only the first
+    const auto power = compressed.read_time_series_floats("Plant", "power", 50);
+    const auto temperature = compressed.read_time_series_floats("Plant", "temperature", 50);
+    ASSERT_EQ(temperature.size(), 2'000);
+    EXPECT_EQ(temperature.date_times, power.date_times);
+    EXPECT_NE(temperature.values, power.values);
+}
+
+TEST(StudyGenerator, RequiresEmptyCollections) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.console_level = quiver::LogLevel::off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+
+    EXPECT_THROW(quiver::StudyGenerator(small_study()).generate(db), std::runtime_error);
+}
+
+TEST(StudyGenerator, CreatesFile) {
+    const auto path = (std::filesystem::temp_directory_path() / "quiver_study_generator_test.db").string();
+    const quiver::DatabaseOptions options{.console_level = quiver::LogLevel::off, .file_level = quiver::LogLevel::off};
+    const auto study = quiver::StudyGenerator(small_study()).generate(path, VALID_SCHEMA("basic.sql"), options);
+    EXPECT_EQ(study.elements.at("Configuration"), 1);
+    EXPECT_GE(study.elapsed_ns, 0);
+
+    {
+        quiver::Database db(path, options);
+        EXPECT_EQ(db.read_element_ids("Configuration").size(), 1);
+    }
+    std::filesystem::remove(path);
+}